@@ -122,6 +122,10 @@ class adsAllocator
     // Destroy an object and call the destructor
     void destroy( T * );
 
+    // Move all the memory of the pool "other" into this pool. The objects
+    // allocated from "other" must now be free'ed to this pool.
+    void merge( adsAllocator<T> & other );
+
     uint size() const { return _size; }
 
     uint vm_size() const;
@@ -211,6 +215,39 @@ inline void adsAllocator<T>::destroy( T * t )
     adsAllocator<T>::free(t);
 }
 
+template <class T>
+inline void adsAllocator<T>::merge( adsAllocator<T> & other )
+{
+    _size += other._size;
+    _vm_size += other._vm_size;
+    other._size = 0;
+    other._vm_size = 0;
+
+    if ( other._block_list )
+    {
+        block * b = other._block_list;
+
+        while( b->_next )
+            b = b->_next;
+
+        b->_next = _block_list;
+        _block_list = other._block_list;
+        other._block_list = NULL;
+    }
+
+    if ( other._free_list )
+    {
+        chunk * c = other._free_list;
+
+        while( c->_next )
+            c = c->_next;
+
+        c->_next = _free_list;
+        _free_list = other._free_list;
+        other._free_list = NULL;
+    }
+}
+
 template <class T>
 inline void adsAllocator<T>::new_block()
 {
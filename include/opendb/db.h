@@ -91,6 +91,7 @@ class dbJournalEntry;
 
 // Property objects
 class dbProperty;
+class dbAttrColumn;
 class dbBoolProperty;
 class dbStringProperty;
 class dbIntProperty;
@@ -401,6 +402,111 @@ class dbDoubleProperty : public dbProperty
     static dbDoubleProperty * find( dbObject * object, const char * name );
 };
 
+///
+/// dbAttrColumn - A named, typed column of values attached to one object type
+/// of a block (instances, nets, iterms, ...). Values are stored densely by
+/// object id, so get/set are O(1) and ranges of ids can be read or written in
+/// bulk. Columns are saved with the block.
+///
+/// A column backs the properties of its name and type on its objects. The
+/// dbProperty API keeps working: property values are read from and written to
+/// the column, and destroying a property clears its value. A value set through
+/// the column is not a property: dbProperty::find and getProperties do not see
+/// it until the property is created with dbXProperty::create, or for all the
+/// values with exportProperties. The values of backed properties are saved
+/// with the column only.
+///
+class dbAttrColumn
+{
+  public:
+
+    enum Type
+    {
+        // Do not change the order or the values of this enum.
+        INT_ATTR     = 0,
+        DOUBLE_ATTR  = 1,
+        BOOL_ATTR    = 2,
+        STRING_ATTR  = 3
+    };
+
+    /// Get the name of this column.
+    const char * getName();
+
+    /// Get the type of the values of this column.
+    Type getType();
+
+    /// Get the type of the objects this column is attached to.
+    dbObjectType getObjectType();
+
+    /// Get the block of this column.
+    dbBlock * getBlock();
+
+    /// Returns the number of id slots of this column. Ids >= size() have no value.
+    uint size();
+
+    /// Returns true if a value has been set for this object.
+    bool hasValue( dbObject * object );
+
+    /// Clear the value of this object, this destroys its property.
+    void clearValue( dbObject * object );
+
+    /// Clear all values, this destroys the properties of the column.
+    void clear();
+
+    ///
+    /// Get/Set the value of an object. The accessor must match the type of the
+    /// column. The get methods return 0, 0.0, false or NULL if the object has no value.
+    ///
+    int getInt( dbObject * object );
+    void setInt( dbObject * object, int value );
+    double getDouble( dbObject * object );
+    void setDouble( dbObject * object, double value );
+    bool getBool( dbObject * object );
+    void setBool( dbObject * object, bool value );
+    const char * getString( dbObject * object );
+    void setString( dbObject * object, const char * value );
+
+    ///
+    /// Bulk access to the values of the object ids [first, first + count).
+    /// The get methods return 0 (0.0, false) for ids without a value. The set
+    /// methods mark all the ids of the range as set; they return false and set
+    /// nothing if an id of the range is not the id of an existing object.
+    /// getInts on a string column returns the string-ids, see getStringValue.
+    ///
+    void getInts( uint first, uint count, int * values );
+    bool setInts( uint first, uint count, const int * values );
+    void getDoubles( uint first, uint count, double * values );
+    bool setDoubles( uint first, uint count, const double * values );
+    void getBools( uint first, uint count, bool * values );
+    bool setBools( uint first, uint count, const bool * values );
+
+    /// Get the string of a string-id returned by getInts.
+    const char * getStringValue( int string_id );
+
+    /// Copy the values of the properties named like this column into the column,
+    /// for the objects without a value. Properties of a different type are
+    /// ignored. Called by create. Returns the number of values copied.
+    uint importProperties();
+
+    /// Create or update the properties named like this column from the column values.
+    /// Returns the number of properties written.
+    uint exportProperties();
+
+    /// Create a column, holding the values of the existing properties of this
+    /// name and type. Returns NULL if a column of this name already exists
+    /// for this object type, or if objects of this type are not owned by the block.
+    static dbAttrColumn * create( dbBlock * block, const char * name, dbObjectType obj_type, Type type );
+
+    /// Find a column. Returns NULL if the column does not exist.
+    static dbAttrColumn * find( dbBlock * block, const char * name, dbObjectType obj_type );
+
+    /// Get the columns of this block.
+    static void getColumns( dbBlock * block, std::vector<dbAttrColumn *> & columns );
+
+    /// Destroy a column. The properties of the column keep their values.
+    static void destroy( dbAttrColumn * column );
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 ///
 /// This class encapsulates a persitant ADS database.
@@ -529,6 +635,11 @@ class dbDatabase : public dbObject
     ///
     /// Write the eco netlist changes to the specified stream.
     ///
+    /// The eco is written in a compact, versioned format: runs of field updates
+    /// (instance placement, flags, parasitic values) are coalesced per object and
+    /// grouped by object type and field, so commitEco applies them as a batch.
+    /// readEco also accepts the older format.
+    ///
     static void writeEco( dbBlock * block,  FILE * stream );
     static int checkEco( dbBlock * block);
 
@@ -537,6 +648,88 @@ class dbDatabase : public dbObject
     ///
     static void commitEco( dbBlock * block );
 
+    ///
+    /// Savepoints - named marks in the eco being collected on the specified
+    /// block (see beginEco). Savepoints may be nested. Rolling back to a
+    /// savepoint undoes only the changes made since it was set, newest first,
+    /// and drops them from the eco; the cost is proportional to the number of
+    /// changes undone.
+    ///
+    /// Instance moves, orientation and master swaps, iterm connections, flag
+    /// updates, net/inst creation and parasitic value updates are undone.
+    /// Deletions and the creation of parasitics cannot be undone; rolling
+    /// back over them throws ZException and leaves the eco unchanged.
+    ///
+    /// These methods return false if no eco is active or the savepoint does
+    /// not exist.
+    ///
+    static bool setSavepoint( dbBlock * block, const char * name );
+
+    ///
+    /// Undo the changes made since the most recent savepoint of this name.
+    /// The savepoint remains set, later savepoints are discarded.
+    ///
+    static bool rollbackToSavepoint( dbBlock * block, const char * name );
+
+    ///
+    /// Discard the most recent savepoint of this name and any later savepoints.
+    /// The changes made since the savepoint are kept.
+    ///
+    static bool releaseSavepoint( dbBlock * block, const char * name );
+
+    ///
+    /// Snapshots - what-if variants of a block, kept as journal replays
+    /// against a base state (not copies of the block). beginSnapshot makes the
+    /// current state of the block the base and starts journaling changes. A
+    /// variant costs memory only for what changed.
+    ///
+    /// Only journaled changes can be reverted, the same as for savepoints:
+    /// instance placement, master swaps, iterm connections, the creation and
+    /// deletion of nets and instances, wire updates and parasitic values.
+    /// Reverting throws ZException, before anything is undone, if a net or
+    /// instance was deleted with state the journal does not keep (bterms,
+    /// special wires, parasitics, properties, halos, hierarchy). After the
+    /// nets are read saveSnapshot, revertSnapshot and restoreSnapshot fail and
+    /// return false; endSnapshot keeps the block as it is.
+    ///
+    /// If an eco is active the snapshot shares its journal and the base state
+    /// is the block at beginSnapshot; the eco records the variant the block
+    /// is left in. beginEco and endEco fail while a snapshot is active.
+    /// beginSnapshot returns false if a snapshot is already active.
+    ///
+    static bool beginSnapshot( dbBlock * block );
+
+    ///
+    /// Store the changes since the base state as variant "name". The block is
+    /// left unchanged. An existing variant of this name is replaced.
+    /// Returns false if there is no snapshot or it has unjournaled changes.
+    ///
+    static bool saveSnapshot( dbBlock * block, const char * name );
+
+    ///
+    /// Undo the changes since the base state.
+    /// Returns false if there is no snapshot or it has unjournaled changes.
+    ///
+    static bool revertSnapshot( dbBlock * block );
+
+    ///
+    /// Revert to the base state and apply the variant "name".
+    /// Returns false if the variant does not exist or the revert fails.
+    ///
+    static bool restoreSnapshot( dbBlock * block, const char * name );
+
+    ///
+    /// Report the differences between variant "name" and the base state
+    /// without applying it. Returns true if differences were found.
+    ///
+    static bool diffSnapshot( dbBlock * block, const char * name, FILE * out );
+
+    ///
+    /// Keep the current state of the block and discard the base state and all
+    /// variants.
+    ///
+    static void endSnapshot( dbBlock * block );
+
     ///
     /// Initializes the database to nothing.
     ///
@@ -872,6 +1065,9 @@ class dbBlock : public dbObject
 
     ///
     /// Get the bounding box of this block.
+    /// The bbox is updated incrementally as objects are created or moved; it
+    /// is only recomputed after the last object on one of its edges is moved
+    /// inside or destroyed.
     ///
     dbBox * getBBox();
 
@@ -1354,6 +1550,14 @@ class dbBlock : public dbObject
     void keepOldParasitics(std::vector<dbNet *> & nets, bool coupled_rc, std::vector<dbNet*> &ccHaloNets, std::vector<uint> * capnn, std::vector<uint> * rsegn);
     void keepOldCornerParasitics(dbBlock *pBlock, std::vector<dbNet *> & nets, bool coupled_rc, std::vector<dbNet*> &ccHaloNets, std::vector<uint> & capnn, std::vector<uint> & rsegn);
 
+    ///
+    /// Reduce the RC networks of nets (all the nets of the block if nets is
+    /// empty), see dbNet::reduceParasitics. The reduced networks are computed
+    /// on "threads" threads (0 = all hardware threads) and written back
+    /// serially. Returns the number of cap nodes removed.
+    ///
+    uint reduceParasitics(std::vector<dbNet *> & nets, double tolerance, uint threads = 0);
+
     ///
     /// merge rsegs before doing exttree
     ///
@@ -1396,13 +1600,28 @@ class dbBlock : public dbObject
 
     ///
     ///  Levelelize from Primary inputs or inout to sequential
+    ///  The wavefronts are processed on up to "threads" threads (zero
+    ///  selects the number of hardware threads). Returns the number of
+    ///  instances given a level (earlier releases always returned 0).
     ///
-	uint levelizeFromPrimaryInputs();
+	uint levelizeFromPrimaryInputs( uint threads = 0 );
 
     ///
     ///  Levelelize from sequential
+    ///  The wavefronts are processed on up to "threads" threads (zero
+    ///  selects the number of hardware threads). Returns the number of
+    ///  instances given a level, the sequential instances included
+    ///  (earlier releases always returned 0).
     ///
-	uint levelizeFromSequential();
+	uint levelizeFromSequential( uint threads = 0 );
+
+    ///
+    ///  Find the combinational loops: the non-sequential CORE instances that
+    ///  lie on a combinational cycle, or on a path between two cycles.
+    ///  The levels of these instances depend on where the cycle is entered.
+    ///  Returns the number of instances found.
+    ///
+	uint findCombinationalLoops( std::vector<dbInst *> & loopInsts, uint threads = 0 );
 
     ///
     ///  Mark inst backwards usinh user flag 2
@@ -1437,6 +1656,16 @@ class dbBlock : public dbObject
 
 private:
     friend class ZDB;
+    friend class definNet;
+
+    ///
+    ///  Move the encoding of this wire to a temporary file and release its
+    ///  memory, for defin::convertToDb. A spilled wire must not be decoded:
+    ///  dbDatabase::write copies it back into the database stream, and
+    ///  re-encoding, copying, appending or destroying the wire brings it
+    ///  back into memory or drops the spilled encoding.
+    ///
+    void spillWire( dbWire * wire );
 
     /// 
     /// Build search database for fast area searches
@@ -2469,6 +2698,18 @@ class dbNet : public dbObject
     ///
     void destroyParasitics ();
 
+    ///
+    /// Reduce the RC network of this net in place. Series resistors are
+    /// merged, dangling internal nodes are folded into their neighbor and
+    /// resistors smaller than tolerance * (total net resistance) are shorted.
+    /// The total capacitance is conserved and, except for the shorted
+    /// resistors, so is the Elmore delay of every remaining node. Terminal
+    /// nodes and nodes with coupling caps are kept. Nets that mix foreign
+    /// and non-foreign cap nodes are left as is.
+    /// Returns the number of cap nodes removed.
+    ///
+    uint reduceParasitics(double tolerance);
+
     /// 
     /// Get total capacitance in FF
     ///
@@ -3067,6 +3308,26 @@ class dbInst : public dbObject
     ///
     static dbInst * getInst( dbBlock * block, uint oid );
 
+    ///
+    /// Set the location (and orientation) of many instances at once. The i-th
+    /// instance (database-id inst_ids[i]) gets the orientation orients[i], if
+    /// orients is not NULL, and then the location (x[i], y[i]) as if by
+    /// setLocationOrient() and setLocation().
+    ///
+    /// The instance bboxes are updated on up to "threads" threads (zero
+    /// selects the number of hardware threads), and the callbacks are
+    /// notified once with inDbMoveInsts().
+    /// Returns false (and changes nothing) if inst_ids holds an id that is not
+    /// an instance of the block, or the same instance more than once.
+    ///
+    static bool setLocations( dbBlock * block,
+                              uint cnt,
+                              const uint * inst_ids,
+                              const int * x,
+                              const int * y,
+                              const dbOrientType::Value * orients = NULL,
+                              uint threads = 0 );
+
     ///
     /// Translate a valid database-id back to a pointer.
     ///
@@ -3260,6 +3521,12 @@ class dbITerm : public dbObject
     ///
     bool getAvgXY( int *x, int *y);
 
+    ///
+    /// Get the bounding box of the iterm shapes.
+    /// Returns false if iterm has no shapes
+    ///
+    bool getBBox( adsRect & bbox );
+
     ///
     /// Translate a database-id back to a pointer.
     ///
@@ -3698,11 +3965,13 @@ class dbGCellGrid : public dbObject
 
     ///
     /// Add a "X" grid pattern.
+    /// The routing resources of the grid are destroyed.
     ///
     void addGridPatternX( int origin_x, int line_count, int step );
 
     ///
     /// Add a "Y" grid pattern.
+    /// The routing resources of the grid are destroyed.
     ///
     void addGridPatternY( int origin_y, int line_count, int step );
 
@@ -3725,6 +3994,112 @@ class dbGCellGrid : public dbObject
     /// Get the "ith" "Y" grid pattern.
     ///
     void getGridPatternY( int i, int & origin_y, int & line_count, int & step );
+
+    ///
+    /// Queries on the gcell coordinates computed from the grid patterns, without
+    /// building the coordinate vectors. An index is the position of a coordinate
+    /// in the list returned by getGridX/getGridY. Each query is a binary search
+    /// over the patterns (overlapping patterns are merged into a sorted list when
+    /// a pattern is added), so concurrent queries are safe.
+    ///
+    /// Get the number of "X"/"Y" grid coordinates.
+    ///
+    int getGridCountX();
+    int getGridCountY();
+
+    ///
+    /// Get the "X"/"Y" grid coordinate of index idx (0 <= idx < count).
+    ///
+    int getGridCoordX( int idx );
+    int getGridCoordY( int idx );
+
+    ///
+    /// Get the index of the last "X"/"Y" grid coordinate <= x/y.
+    /// Returns -1 if there is none.
+    ///
+    int findGridIndexX( int x );
+    int findGridIndexY( int y );
+
+    ///
+    /// Get the index of the "X"/"Y" grid coordinate nearest to x/y (the lower
+    /// one on a tie). Returns -1 if the grid is empty.
+    ///
+    int findNearestGridX( int x );
+    int findNearestGridY( int y );
+
+    ///
+    /// Get the indexes [first, end) of the "X"/"Y" grid coordinates in [lo, hi).
+    ///
+    void findGridRangeX( int lo, int hi, int & first, int & end );
+    void findGridRangeY( int lo, int hi, int & first, int & end );
+
+    ///
+    /// Get the number of gcell columns/rows. The gcell (col, row) is the
+    /// rectangle between the grid coordinates col, col+1 and row, row+1.
+    ///
+    int getNumCols();
+    int getNumRows();
+
+    ///
+    /// Get the gcell containing the point (x, y).
+    /// Returns false if the point is outside of the grid.
+    ///
+    bool findGCell( int x, int y, int & col, int & row );
+
+    ///
+    /// Per-gcell routing resources. Each routing layer has a capacity (number
+    /// of tracks in the preferred direction), a usage (number of wire segments
+    /// crossing the gcell) and a blockage (number of blocked tracks) per gcell.
+    /// The counters are 32-bit. The resources are stored with the grid in the
+    /// database.
+    ///
+    /// Returns true if the resources have been created.
+    ///
+    bool hasResources();
+
+    ///
+    /// Create the resources for every routing layer of the technology with all
+    /// counters set to zero. Existing resources are discarded.
+    /// The grid patterns must be defined before the resources are created.
+    ///
+    void initResources();
+
+    ///
+    /// Destroy the resources.
+    ///
+    void clearResources();
+
+    ///
+    /// Get/set the resources of a gcell on a routing layer.
+    ///
+    uint getCapacity( dbTechLayer * layer, int col, int row );
+    uint getUsage( dbTechLayer * layer, int col, int row );
+    uint getBlockage( dbTechLayer * layer, int col, int row );
+    void setCapacity( dbTechLayer * layer, int col, int row, uint value );
+    void setUsage( dbTechLayer * layer, int col, int row, uint value );
+    void setBlockage( dbTechLayer * layer, int col, int row, uint value );
+
+    ///
+    /// Add delta (can be negative) to the usage of a gcell. The usage does
+    /// not go below zero.
+    ///
+    void addUsage( dbTechLayer * layer, int col, int row, int delta );
+
+    ///
+    /// Add (or remove) the usage of the wire segments of this wire. Use this
+    /// to update the usage incrementally when a net is rerouted.
+    ///
+    void addWireUsage( dbWire * wire, bool remove = false );
+
+    ///
+    /// Compute the resources of the block: the capacity from the track grids,
+    /// the blockage from the routing obstructions and special wires, and the
+    /// usage from the wires of the nets. Creates the resources if required.
+    /// The layers and nets are processed on up to "threads" threads (zero
+    /// selects the number of hardware threads).
+    ///
+    void computeResources( uint threads = 0 );
+
     ///
     /// Create an empty GCell grid.
     /// Returns NULL if a grid already exists.
@@ -3794,6 +4169,45 @@ class dbTrackGrid : public dbObject
     /// Get the "ith" "Y" grid pattern.
     ///
     void getGridPatternY( int i, int & origin_y, int & line_count, int & step );
+
+    ///
+    /// Queries on the track coordinates computed from the grid patterns, without
+    /// building the coordinate vectors. An index is the position of a coordinate
+    /// in the list returned by getGridX/getGridY. Each query is a binary search
+    /// over the patterns (overlapping patterns are merged into a sorted list when
+    /// a pattern is added), so concurrent queries are safe.
+    ///
+    /// Get the number of "X"/"Y" grid coordinates.
+    ///
+    int getGridCountX();
+    int getGridCountY();
+
+    ///
+    /// Get the "X"/"Y" grid coordinate of index idx (0 <= idx < count).
+    ///
+    int getGridCoordX( int idx );
+    int getGridCoordY( int idx );
+
+    ///
+    /// Get the index of the last "X"/"Y" grid coordinate <= x/y.
+    /// Returns -1 if there is none.
+    ///
+    int findGridIndexX( int x );
+    int findGridIndexY( int y );
+
+    ///
+    /// Get the index of the "X"/"Y" grid coordinate nearest to x/y (the lower
+    /// one on a tie). Returns -1 if the grid is empty.
+    ///
+    int findNearestGridX( int x );
+    int findNearestGridY( int y );
+
+    ///
+    /// Get the indexes [first, end) of the "X"/"Y" grid coordinates in [lo, hi).
+    ///
+    void findGridRangeX( int lo, int hi, int & first, int & end );
+    void findGridRangeY( int lo, int hi, int & first, int & end );
+
     ///
     /// Create an empty Track grid.
     /// Returns NULL if a the grid for this layer already exists.
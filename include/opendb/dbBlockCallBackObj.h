@@ -29,12 +29,17 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#ifndef ADS_DB_BLOCK_CALLBACKOBJ_H
+#define ADS_DB_BLOCK_CALLBACKOBJ_H
+
 #include "ads.h"
 #include <list>
+#include <vector>
 
 namespace odb {
 
 class dbBlock;
+class dbBTerm;
 class dbInst;
 class dbMaster;
 class dbNet;
@@ -65,10 +70,22 @@ class dbBlockCallBackObj
   virtual void inDbITermDestroy(dbITerm *) {} // Bugzilla #7 - payam
   virtual void inDbITermDisconnect(dbITerm *) {}
   virtual void inDbITermConnect(dbITerm *) {}
+  // A bterm is bound to its net when it is created, it is moved to another
+  // net by destroying and re-creating it.
+  virtual void inDbBTermCreate(dbBTerm *) {}
+  virtual void inDbBTermDestroy(dbBTerm *) {}
   virtual void inDbBlockStreamOutBefore(dbBlock *) {}
   virtual void inDbBlockStreamOutAfter(dbBlock *) {}
   virtual void inDbBlockReadNetsBefore(dbBlock *) {}
   virtual void inDbMoveInst(dbInst *) {}
+  // A batch of instances moved (dbInst::setLocations), the default
+  // calls inDbMoveInst for each instance.
+  virtual void inDbMoveInsts(const std::vector<dbInst *> & insts)
+  {
+    std::vector<dbInst *>::const_iterator itr;
+    for (itr = insts.begin(); itr != insts.end(); ++itr)
+      inDbMoveInst(*itr);
+  }
   virtual void inDbWireUpdate( dbWire * ) { }
 
   // allow ECO client initialization - payam
@@ -87,3 +104,5 @@ class dbBlockCallBackObj
 };
 
 } // namespace
+
+#endif
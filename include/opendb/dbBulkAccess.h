@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_BULK_ACCESS_H
+#define ADS_DB_BULK_ACCESS_H
+
+#include <vector>
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+namespace odb {
+
+class dbBlock;
+
+///
+/// dbBulkAccess - Columnar export (and import) of block data.
+///
+/// Each method fills flat arrays, one entry per object (or a CSR layout for
+/// lists), instead of returning a dbSet of objects, so that a script can read
+/// or update a whole block with a few calls. The Python bindings return the
+/// arrays as typed memoryviews (numpy.frombuffer can wrap them without a
+/// copy) and accept any buffer (array.array, numpy arrays) for the setters.
+///
+/// The objects are listed in dbSet order. The arrays are filled on up to
+/// "threads" threads (zero selects the number of hardware threads).
+///
+class dbBulkAccess
+{
+  public:
+    ///
+    /// Placement of the instances: database-id, location (as by
+    /// dbInst::getLocation()), orientation (dbOrientType::Value) and master
+    /// database-id (dbMaster::getId(), unique within the library of the
+    /// master).
+    /// Returns the number of instances.
+    ///
+    static uint getInstPlacement( dbBlock * block,
+                                  std::vector<uint> & inst_ids,
+                                  std::vector<int> & inst_x,
+                                  std::vector<int> & inst_y,
+                                  std::vector<int> & inst_orients,
+                                  std::vector<uint> & inst_masters,
+                                  uint threads = 0 );
+
+    ///
+    /// Move the instances inst_ids[i] to (inst_x[i], inst_y[i]), and set the
+    /// orientation inst_orients[i] if inst_orients is not empty, as by
+    /// dbInst::setLocations(). Returns false (and changes nothing) if the
+    /// arrays have different sizes, hold an invalid or repeated id, or an
+    /// invalid orientation.
+    ///
+    static bool setInstPlacement( dbBlock * block,
+                                  const std::vector<uint> & inst_ids,
+                                  const std::vector<int> & inst_x,
+                                  const std::vector<int> & inst_y,
+                                  const std::vector<int> & inst_orients,
+                                  uint threads = 0 );
+
+    ///
+    /// The iterms of the nets in CSR form: the iterms of net net_ids[n] are
+    /// the entries [net_iterm_begin[n], net_iterm_begin[n+1]) of iterm_ids
+    /// and iterm_insts (the database-id of the instance of the iterm).
+    /// Returns the number of nets.
+    ///
+    static uint getNetITerms( dbBlock * block,
+                              std::vector<uint> & net_ids,
+                              std::vector<uint> & net_iterm_begin,
+                              std::vector<uint> & iterm_ids,
+                              std::vector<uint> & iterm_insts,
+                              uint threads = 0 );
+
+    ///
+    /// The wire segments (the non-via shapes of the net wires): net
+    /// database-id, routing level of the layer and rectangle.
+    /// Returns the number of segments.
+    ///
+    static uint getWireSegments( dbBlock * block,
+                                 std::vector<uint> & seg_nets,
+                                 std::vector<uint> & seg_levels,
+                                 std::vector<int> & seg_x1,
+                                 std::vector<int> & seg_y1,
+                                 std::vector<int> & seg_x2,
+                                 std::vector<int> & seg_y2,
+                                 uint threads = 0 );
+
+    ///
+    /// The parasitic resistors of the nets at an extraction corner: rseg
+    /// database-id, net database-id, source and target cap-node ids,
+    /// resistance and capacitance. The rsegs of a net are the ones listed
+    /// by dbNet::getRSegs(). Returns the number of rsegs (zero if the
+    /// corner is not stored in the block).
+    ///
+    static uint getRSegs( dbBlock * block,
+                          uint corner,
+                          std::vector<uint> & rseg_ids,
+                          std::vector<uint> & rseg_nets,
+                          std::vector<uint> & rseg_sources,
+                          std::vector<uint> & rseg_targets,
+                          std::vector<double> & rseg_res,
+                          std::vector<double> & rseg_cap,
+                          uint threads = 0 );
+
+    ///
+    /// The parasitic cap-nodes of the nets at an extraction corner: cap-node
+    /// database-id, net database-id and capacitance. Returns the number of
+    /// cap-nodes (zero if the corner is not stored in the block).
+    ///
+    static uint getCapNodes( dbBlock * block,
+                             uint corner,
+                             std::vector<uint> & node_ids,
+                             std::vector<uint> & node_nets,
+                             std::vector<double> & node_cap,
+                             uint threads = 0 );
+};
+
+} // namespace
+
+#endif
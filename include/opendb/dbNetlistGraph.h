@@ -0,0 +1,194 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_NETLIST_GRAPH_H
+#define ADS_DB_NETLIST_GRAPH_H
+
+#include <vector>
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#include "dbBlockCallBackObj.h"
+
+namespace odb {
+
+class dbBlock;
+class dbBTerm;
+class dbInst;
+class dbNet;
+class dbITerm;
+class dbRegion;
+
+///
+/// dbNetlistGraph - Read-only hypergraph snapshot of the netlist of a block
+/// in compressed-sparse-row (CSR) form, for partitioners and placers.
+///
+/// The vertices are the instances of the block, the hyperedges are the nets.
+/// The pins of net n are the indexes [getNetPinBegin()[n], getNetPinBegin()[n+1])
+/// of the pin arrays; the nets of instance i are the entries
+/// [getInstNetBegin()[i], getInstNetBegin()[i+1]) of getInstNets(), each net
+/// listed once. A pin of a block terminal has no instance (instance index -1).
+///
+/// The pin offsets are from the center of the instance bbox to the center of
+/// the pin bbox (the absolute pin location for a block terminal).
+///
+/// The arrays are not updated when the netlist changes: the graph registers
+/// itself as a callback of the block and becomes stale when an instance, net
+/// or iterm is created or destroyed, an iterm is connected or disconnected, a
+/// master is swapped, or a block terminal is created or destroyed (a block
+/// terminal moves to another net by being re-created). Moving a pin does not
+/// make the graph stale.
+///
+/// In Python the array getters return read-only memoryviews over the arrays,
+/// without a copy. A view keeps the graph alive, and build and clear raise
+/// BufferError while a view is alive. In Tcl they return lists (copies).
+///
+class dbNetlistGraph : public dbBlockCallBackObj
+{
+  public:
+    dbNetlistGraph();
+    ~dbNetlistGraph();
+
+    ///
+    /// Skip the POWER and GROUND nets (default true).
+    ///
+    void setSkipSupplyNets( bool skip ) { _skip_supply = skip; }
+
+    ///
+    /// Skip the nets with more than max_fanout pins, zero for no limit
+    /// (default 0).
+    ///
+    void setMaxFanout( uint max_fanout ) { _max_fanout = max_fanout; }
+
+    ///
+    /// Include the block terminals as pins (default true).
+    ///
+    void setIncludeBTerms( bool include ) { _include_bterms = include; }
+
+    ///
+    /// Build the graph of the block on up to "threads" threads (zero selects
+    /// the number of hardware threads).
+    ///
+    void build( dbBlock * block, uint threads = 0 );
+
+    ///
+    /// Discard the graph and unregister from the block.
+    ///
+    void clear();
+
+    ///
+    /// Returns true if the netlist changed since the graph was built.
+    ///
+    bool isStale() const { return _stale; }
+
+    int getNumNets() const { return _net_ids.size(); }
+    int getNumInsts() const { return _inst_ids.size(); }
+    int getNumPins() const { return _pin_ids.size(); }
+
+    ///
+    /// Get the database-id of net n / instance i.
+    ///
+    const std::vector<uint> & getNetIds() const { return _net_ids; }
+    const std::vector<uint> & getInstIds() const { return _inst_ids; }
+
+    ///
+    /// Get the index of a net / instance, -1 if it is not in the graph.
+    ///
+    int findNet( dbNet * net ) const;
+    int findInst( dbInst * inst ) const;
+
+    ///
+    /// net -> pins (getNumNets() + 1 entries)
+    ///
+    const std::vector<int> & getNetPinBegin() const { return _net_pin_begin; }
+
+    ///
+    /// pin arrays: the instance index (-1 for a block terminal), the net
+    /// index, the iterm (or bterm) database-id, and the pin offset.
+    ///
+    const std::vector<int> & getPinInsts() const { return _pin_insts; }
+    const std::vector<int> & getPinNets() const { return _pin_nets; }
+    const std::vector<uint> & getPinIds() const { return _pin_ids; }
+    const std::vector<int> & getPinOffsetX() const { return _pin_dx; }
+    const std::vector<int> & getPinOffsetY() const { return _pin_dy; }
+
+    ///
+    /// instance -> nets (getNumInsts() + 1 entries)
+    ///
+    const std::vector<int> & getInstNetBegin() const { return _inst_net_begin; }
+    const std::vector<int> & getInstNets() const { return _inst_nets; }
+
+    ///
+    /// Weights: dbNet::getWeight() and dbInst::getWeight().
+    ///
+    const std::vector<int> & getNetWeights() const { return _net_weights; }
+    const std::vector<int> & getInstWeights() const { return _inst_weights; }
+
+    void inDbInstCreate( dbInst * inst );
+    void inDbInstCreate( dbInst * inst, dbRegion * region );
+    void inDbInstDestroy( dbInst * inst );
+    void inDbInstSwapMasterAfter( dbInst * inst );
+    void inDbNetCreate( dbNet * net );
+    void inDbNetDestroy( dbNet * net );
+    void inDbITermCreate( dbITerm * iterm );
+    void inDbITermDestroy( dbITerm * iterm );
+    void inDbITermConnect( dbITerm * iterm );
+    void inDbITermDisconnect( dbITerm * iterm );
+    void inDbBTermCreate( dbBTerm * bterm );
+    void inDbBTermDestroy( dbBTerm * bterm );
+
+  private:
+    bool              _skip_supply;
+    uint              _max_fanout;
+    bool              _include_bterms;
+    bool              _stale;
+
+    std::vector<uint> _net_ids;
+    std::vector<uint> _inst_ids;
+    std::vector<int>  _net_index;    // by net database-id
+    std::vector<int>  _inst_index;   // by instance database-id
+    std::vector<int>  _net_pin_begin;
+    std::vector<int>  _pin_insts;
+    std::vector<int>  _pin_nets;
+    std::vector<uint> _pin_ids;
+    std::vector<int>  _pin_dx;
+    std::vector<int>  _pin_dy;
+    std::vector<int>  _inst_net_begin;
+    std::vector<int>  _inst_nets;
+    std::vector<int>  _net_weights;
+    std::vector<int>  _inst_weights;
+};
+
+} // namespace
+
+#endif
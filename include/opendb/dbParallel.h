@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_PARALLEL_H
+#define ADS_DB_PARALLEL_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#include <thread>
+#include <atomic>
+#include <vector>
+
+namespace odb {
+
+//
+// dbParallelFor - Calls fn(i) for every i in [0, cnt) on up to "threads"
+// worker threads. A thread count of zero selects the number of hardware
+// threads. Work is handed out in chunks of "grain" indices, so fn must be
+// safe to call concurrently for different indices. Small loops (or a single
+// thread) run inline on the calling thread.
+//
+inline uint dbThreadCount( uint threads )
+{
+    if ( threads == 0 )
+    {
+        threads = std::thread::hardware_concurrency();
+
+        if ( threads == 0 )
+            threads = 1;
+    }
+
+    return threads;
+}
+
+template <class FN>
+inline void dbParallelFor( uint cnt, uint threads, FN fn, uint grain = 64 )
+{
+    threads = dbThreadCount(threads);
+
+    if ( grain == 0 )
+        grain = 1;
+
+    uint max_threads = (cnt + grain - 1) / grain;
+
+    if ( threads > max_threads )
+        threads = max_threads;
+
+    if ( threads <= 1 )
+    {
+        uint i;
+        for( i = 0; i < cnt; ++i )
+            fn(i);
+        return;
+    }
+
+    std::atomic<uint> next(0);
+
+    auto worker = [&]()
+    {
+        for(;;)
+        {
+            uint start = next.fetch_add(grain);
+
+            if ( start >= cnt )
+                break;
+
+            uint end = start + grain < cnt ? start + grain : cnt;
+
+            uint i;
+            for( i = start; i < end; ++i )
+                fn(i);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+
+    uint t;
+    for( t = 1; t < threads; ++t )
+        workers.push_back( std::thread(worker) );
+
+    worker();
+
+    for( t = 0; t < workers.size(); ++t )
+        workers[t].join();
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,189 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_ROW_OCCUPANCY_H
+#define ADS_DB_ROW_OCCUPANCY_H
+
+#include <vector>
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#ifndef ADS_GEOM_H
+#include "geom.h"
+#endif
+
+#include "dbBlockCallBackObj.h"
+
+namespace odb {
+
+class dbBlock;
+class dbInst;
+class dbRow;
+class dbRegion;
+
+///
+/// dbRowOccupancy - Site occupancy of the placement rows of a block.
+///
+/// A site of a row is occupied if the bounding box of a placed instance
+/// overlaps it (instances may overlap, an occupied site is freed when the
+/// last instance covering it is removed). Each row keeps a segment tree over
+/// its sites, so the free-span and utilization queries of a row are O(log n)
+/// in the number of sites.
+///
+/// The occupancy is kept up to date through the block callbacks: instance
+/// create, destroy, move (setOrigin, setOrient, setLocation) and master
+/// swap. A change of placement status does not invoke a callback, call
+/// updateInst() after dbInst::setPlacementStatus(). The rows are read when
+/// the occupancy is built, call build() again if the rows change.
+///
+/// Only horizontal rows are supported, vertical rows are ignored.
+///
+class dbRowOccupancy : public dbBlockCallBackObj
+{
+  public:
+    dbRowOccupancy();
+    ~dbRowOccupancy();
+
+    ///
+    /// Build the occupancy from the rows and the placed instances of the block.
+    /// The rows are built on up to "threads" threads (zero selects the number
+    /// of hardware threads). The occupancy registers itself as a callback
+    /// of the block.
+    ///
+    void build( dbBlock * block, uint threads = 0 );
+
+    ///
+    /// Discard the occupancy and unregister from the block.
+    ///
+    void clear();
+
+    ///
+    /// Update the sites occupied by this instance.
+    ///
+    void updateInst( dbInst * inst );
+
+    ///
+    /// Get the number of rows (sorted by y, then x).
+    ///
+    int getRowCount() const { return _rows.size(); }
+
+    ///
+    /// Get the ith row.
+    ///
+    dbRow * getRow( int i ) const { return _rows[i]._row; }
+
+    ///
+    /// Find the free span of sites nearest to (x, y) that can hold a cell of
+    /// the given width. The distance is measured from (x, y) to the lower left
+    /// corner of the span. Returns false if there is no such span.
+    ///
+    bool findFreeSpan( int x, int y, int width, int & span_x, int & span_y, dbRow ** row = NULL );
+
+    ///
+    /// Count the sites of the rows in the region and how many of them are
+    /// occupied. A site is counted if it overlaps the region.
+    ///
+    void getSiteCount( const adsRect & region, uint & used, uint & total );
+
+    ///
+    /// Get the fraction of the sites in the region that are occupied.
+    /// Returns 0.0 if there are no sites in the region.
+    ///
+    double getUtilization( const adsRect & region );
+
+    void inDbInstCreate( dbInst * inst );
+    void inDbInstCreate( dbInst * inst, dbRegion * region );
+    void inDbInstDestroy( dbInst * inst );
+    void inDbInstSwapMasterAfter( dbInst * inst );
+    void inDbMoveInst( dbInst * inst );
+
+  private:
+    struct Node
+    {
+        int _cover;  // number of intervals covering the node range exactly
+        int _used;   // number of occupied sites
+        int _pre;    // free sites at the start of the range
+        int _suf;    // free sites at the end of the range
+        int _best;   // longest run of free sites
+    };
+
+    struct Row
+    {
+        dbRow *           _row;
+        int               _x;         // origin of the first site
+        int               _y;
+        int               _height;
+        int               _site_width;
+        int               _spacing;
+        int               _count;     // number of sites
+        std::vector<Node> _nodes;
+
+        bool operator<( const Row & r ) const
+        {
+            if ( _y != r._y )
+                return _y < r._y;
+
+            return _x < r._x;
+        }
+
+        void init();
+        void update( int lo, int hi, int delta );
+        int  getUsed( int lo, int hi ) const;
+        int  findRight( int s, int w ) const;
+        int  findLeft( int s, int w ) const;
+        bool getSites( int xlo, int xhi, int & lo, int & hi ) const;
+        int  getSpanSites( int width ) const;
+
+      private:
+        void pull( int n, int lo, int hi );
+        void build( int n, int lo, int hi );
+        void update( int n, int lo, int hi, int a, int b, int delta );
+        int  getUsed( int n, int lo, int hi, int a, int b ) const;
+        int  findRight( int n, int lo, int hi, int s, int w, int & carry ) const;
+        int  findLeft( int n, int lo, int hi, int e, int w, int & carry ) const;
+    };
+
+    dbBlock *            _block;
+    std::vector<Row>     _rows;
+    int                  _max_height;   // max row height
+    std::vector<adsRect> _inst_rect;    // recorded bbox of the instance (by id)
+    std::vector<char>    _inst_placed;  // true if the instance was recorded
+
+    void getRows( const adsRect & r, std::vector<int> & rows ) const;
+    void addRect( const adsRect & r, int delta );
+    void removeInst( dbInst * inst );
+};
+
+} // namespace
+
+#endif
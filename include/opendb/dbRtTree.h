@@ -71,12 +71,18 @@ class dbRtTechVia;
 class dbRtBlockVia;
 class dbRtShort;
 class dbRtVWire;
+class dbRtPool;
 
 //
 // dbRtTree - This class is used to represent an encoded dbWire as a graph.
 //
 //     The graph is undirected and cannot contain cycles.
 //
+//     Each tree allocates its nodes and edges from its own pool, so different
+//     trees can be decoded, edited and encoded concurrently on different
+//     threads. The memory of the pool is reused after clear() and is released
+//     when the tree is destroyed.
+//
 class dbRtTree
 {
   public:
@@ -174,7 +180,7 @@ class dbRtTree
     dbRtTree * duplicate();
 
     // Move the tree "T" into this tree
-    // All the nodes/edges of "T" will be moved to this tree.
+    // All the nodes/edges of "T", and the pool memory that holds them, will be moved to this tree.
     void move( dbRtTree * T );
 
     // Copy the tree "T" into this tree
@@ -189,6 +195,9 @@ class dbRtTree
     
 
   private:
+    // A tree owns its pool, use copy() or move() instead.
+    dbRtTree( const dbRtTree & );
+    dbRtTree & operator=( const dbRtTree & );
     void encodePath( dbWireEncoder & encoder, std::vector<dbRtEdge *> & path, dbRtNode * src,
                      dbWireType::Value cur_type, dbTechLayerRule * cur_rule,
                      bool encode_bterms_iterms);
@@ -203,6 +212,7 @@ class dbRtTree
     static void copyNode( dbRtTree * G, dbRtNode * node, dbRtNode * src, bool copy_edge_map );
     static void copyEdge( dbRtTree * G, dbRtNode * src, dbRtNode * tgt, dbRtEdge * edge, bool copy_edge_map );
     
+    dbRtPool * _pool;
     std::vector<dbRtEdge *> _edge_map;
     adsDList<dbRtNode, &dbRtNode::rtNode> _nodes;
     adsDList<dbRtEdge, &dbRtEdge::rtEdge> _edges;
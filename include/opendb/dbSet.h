@@ -39,6 +39,7 @@
 namespace odb {
 
 template <class T> class dbSet;
+class dbSetCursor;
 
 template <class T>
 class dbSetIterator
@@ -86,6 +87,8 @@ class dbSetIterator
 template <class T>
 class dbSet
 {
+    friend class dbSetCursor;
+
     dbIterator * _itr;
     dbObject *   _parent;
     
@@ -178,6 +181,40 @@ class dbSet
     bool empty() { return begin() == end(); }
 };
 
+///
+/// A dbSetCursor walks the objects of a set one at a time, without copying
+/// the set. It is not templated, so the scripting bindings use it to iterate
+/// any set lazily.
+///
+class dbSetCursor
+{
+    dbIterator * _itr;
+    uint         _cur;
+    uint         _end;
+
+  public:
+    template <class T>
+    dbSetCursor( dbSet<T> set )
+    {
+        _itr = set._itr;
+        _cur = _itr->begin(set._parent);
+        _end = _itr->end(set._parent);
+    }
+
+    ///
+    /// Returns the next object of the set, or NULL after the last object.
+    ///
+    dbObject * next()
+    {
+        if ( _cur == _end )
+            return NULL;
+
+        dbObject * obj = _itr->getObject(_cur);
+        _cur = _itr->next(_cur);
+        return obj;
+    }
+};
+
 template <class T>
 inline dbSetIterator<T>::dbSetIterator()
 {
@@ -76,6 +76,7 @@ class dbTechLayer;
 class dbWire;
 class dbSWire;
 class dbObstruction;
+struct _dbMasterShape;
 
 ///////////////////////////////////////////////////////////////////////////////
 ///
@@ -400,28 +401,14 @@ class dbInstShapeItr
 
   private:
     
-    dbSet<dbBox>             _boxes;
-    dbSet<dbMPin>            _mpins;
-    dbSet<dbMTerm>           _mterms;
-    dbSet<dbBox>::iterator   _box_itr;
-    dbSet<dbMTerm>::iterator _mterm_itr;
-    dbSet<dbMPin>::iterator  _mpin_itr;
-    int                      _state;
+    const _dbMasterShape *   _cur;
+    const _dbMasterShape *   _end;
     dbInst *                 _inst;
-    dbMaster *               _master;
-    dbMPin *                 _mpin;
-    dbTransform              _transform;
-    IteratorType             _type;
-    dbTechVia *              _via;
-    dbSet<dbBox>             _via_boxes;
-    dbSet<dbBox>::iterator   _via_box_itr;
-    int                      _via_x;
-    int                      _via_y;
+    int                      _x;
+    int                      _y;
     bool                     _expand_vias;
-    int                      _prev_state;
-    
-    void getShape( dbBox * box, dbShape & shape );
-    void getViaBox( dbBox * box, dbShape & shape );
+
+    void init( dbInst * inst, IteratorType type, const dbTransform & t );
      
   public:
     dbInstShapeItr(bool expand_vias = false);
@@ -438,24 +425,12 @@ class dbInstShapeItr
 class dbITermShapeItr
 {
   private:
-    dbSet<dbBox>             _boxes;
-    dbSet<dbMPin>            _mpins;
-    dbMTerm *                _mterm;
-    dbSet<dbBox>::iterator   _box_itr;
-    dbSet<dbMPin>::iterator  _mpin_itr;
-    int                      _state;
+    const _dbMasterShape *   _cur;
+    const _dbMasterShape *   _end;
     dbITerm *                _iterm;
-    dbMPin *                 _mpin;
-    dbTransform              _transform;
-    dbTechVia *              _via;
-    dbSet<dbBox>             _via_boxes;
-    dbSet<dbBox>::iterator   _via_box_itr;
-    int                      _via_x;
-    int                      _via_y;
+    int                      _x;
+    int                      _y;
     bool                     _expand_vias;
-    
-    void getShape( dbBox * box, dbShape & shape );
-    void getViaBox( dbBox * box, dbShape & shape );
      
   public:
     dbITermShapeItr( bool expand_vias = false );
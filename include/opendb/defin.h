@@ -73,6 +73,13 @@ class defin
 
     /// Replace the wires of this block.
     bool replaceWires( dbBlock * block, const char * def_file );
+
+    /// Convert a DEF file into a database file (see dbDatabase::read).
+    /// The routing of each net is spilled to a temporary file as soon as the
+    /// net is read, so the routed wires are never all in memory. The database
+    /// must hold the technology and libraries and must not have a chip; the
+    /// chip is destroyed once the database file is written.
+    bool convertToDb( std::vector<dbLib *> & search_libs, const char * def_file, const char * db_file );
 };
     
 } // namespace
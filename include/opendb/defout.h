@@ -41,6 +41,7 @@ namespace odb {
 class defout_impl;
 class dbNet;
 class dbBlock;
+class adsRect;
 
 class defout
 {
@@ -58,6 +59,14 @@ class defout
     void selectNet( dbNet *net );
     void setVersion( Version v ); // default is 5.5
 
+    /// Write only the objects that intersect the window: the die area
+    /// becomes the window, the routed wires are clipped to it and the
+    /// nets keep only the terminals of the written objects.
+    void selectWindow( const adsRect & window );
+
+    /// Number of threads used to clip the wires (default zero: all hardware threads).
+    void setThreads( uint threads );
+
     bool writeBlock( dbBlock * block, const char * def_file );
     
 };
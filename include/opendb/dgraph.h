@@ -39,6 +39,7 @@ _________________________________________________________________*/
 #include "hash.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <vector>
 #define MAXIT 1000
 class Dedge {
   public:
@@ -62,6 +63,8 @@ class Dgraph {
          void modify(int i, double delta); 
          bool has_cycle();
          bool bellmanford(bool *rest = NULL);
+         bool resolve(bool *rest = NULL);
+         void set_threads(int threads);
          int dfs(int i); 
          bool Dfs(int i);
          int n();
@@ -87,6 +90,29 @@ class Dgraph {
          Hash<int, Hash<Dedge*, int>*> _neighbors;
          Hash<Dedge*, int> *_curnei;
          Darr<int> sources;
-         
+
+         // Flat (CSR) copy of the adjacency used by the solvers, rebuilt
+         // after add_edge/remove_edge, and the weakly connected components
+         // of the graph, which are solved independently.
+         bool _csr_valid;
+         std::vector<int> _csr_begin;
+         std::vector<Dedge*> _csr_edges;
+         std::vector<int> _comp;
+         int _ncomp;
+         std::vector<int> _len;
+         std::vector<char> _inq;
+         // State for resolve(): every distance is the length of its
+         // predecessor path, the vertices in _pending were not propagated
+         // (the relaxation stopped at an upper bound violation) and these
+         // edge weights and upper bounds changed since.
+         bool _solved;
+         std::vector<int> _pending;
+         std::vector<Dedge*> _dirty_edges;
+         std::vector<int> _dirty_uppers;
+         int _threads;
+         void build_csr();
+         int spfa(const int *seeds, int nseeds, int nverts, bool check_upper, int &bad, std::vector<int> &pending);
+         bool pred_cycle(int i, int nverts);
+         bool solved(int status, int bad, bool *rest);
 };
 #endif
@@ -37,6 +37,7 @@
 #include "hash.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <vector>
 #define MAXIT 1000
 #define LARGE 2000000000
 enum Matchkind {OPT = 0, NOOPT};
@@ -76,6 +77,7 @@ class Graph {
   void sort_neighbor_weights(void);
   int  get_thresh(int vertex);
   int find_matching(Matchkind kind = OPT);
+  void set_threads(int threads);
   int get_matched_vertex(int i);
   void print();
   long matchwt();
@@ -90,8 +92,42 @@ class Graph {
            HashP<int, Edge *> _edge_table;
 	   Darr<int> _thresh;
            int *_match;
-           int  _negative_cycle(long *dist, int *pred, int *vis, int *rightd, int &k); 
-           int _bellman_ford(Darr<Edge*> *edges, long *dist, int *pred, int *vis, int *rightd, int factor, int &k);
+
+           // Flat (CSR) copy of the edges of the left and of the right
+           // vertices, rebuilt after add_edge, and the connected components
+           // of the graph, which are matched independently.
+           bool _csr_valid;
+           std::vector<int> _left_begin;
+           std::vector<int> _left_right;
+           std::vector<long> _left_wt;
+           std::vector<int> _right_begin;
+           std::vector<int> _right_left;
+           std::vector<long> _right_wt;
+           std::vector<int> _comp;
+           int _ncomp;
+           std::vector<int> _match_edge;
+           std::vector<int> _load;
+           // State for warm starts of the weighted matching: _match is of
+           // minimum weight for the potentials _pot, except at the left
+           // vertices whose edges changed since. Their right vertices keep
+           // the capacity in _reserved until it is matched again.
+           bool _opt_valid;
+           std::vector<long> _pot;
+           std::vector<int> _dirty;
+           std::vector<int> _reserved;
+           std::vector<long> _dist;
+           std::vector<int> _pred;
+           std::vector<int> _pred_edge;
+           std::vector<int> _mark;
+           int _threads;
+           void _build_csr();
+           int _hopcroft_karp();
+           bool _hk_augment(int i, std::vector<int> &dist, std::vector<int> &it, int limit);
+           template <class FN>
+           void _residual_arcs(int u, int sink, const int *verts, int nverts, FN fn);
+           void _flip(int u, int v, int e, int sink);
+           bool _is_deficit(int u, int sink, int need);
+           bool _min_cost_matching(int sink, const int *verts, int nverts);
 	   void _dfs_hall(int i, int *vis, int *par, int k);
 }; 
 #endif
@@ -72,6 +72,10 @@ class dbLib;
 class dbMaster;
 class dbDatabase;
 class dbTechLayer;
+class lefinPin;
+class lefinMacro;
+class lefinMacroAttributes;
+class lefinMacroQueue;
 
 class lefin
 {
@@ -97,6 +101,9 @@ class lefin
     bool         _override_lef_dbu;
     bool         _master_modified;
 	bool		 _ignore_non_routing_layers;
+    bool         _pipeline_macros;
+    lefinMacroQueue * _macro_queue;
+    lefinMacro * _macro_record;
 
     void init();
     void setDBUPerMicron( int dbu );
@@ -131,6 +138,16 @@ class lefin
     bool addGeoms( dbObject * object, bool is_pin, lefiGeometries * geometry);
     void createLibrary();
     void createPolygon( dbObject * object, bool is_pin, dbTechLayer * layer, lefiGeomPolygon * p, double offset_x = 0.0 , double offset_y  = 0.0 );
+    void beginMaster( const char * name );
+    void endMaster();
+    void setMasterAttributes( lefinMacroAttributes & attr );
+    void createPin( lefinPin & pin );
+    void addObstructions( lefiGeometries * geometries );
+    void commitMacro( lefinMacro * macro );
+    void startMacroQueue();
+    void stopMacroQueue();
+
+    friend class lefinMacroQueue;
 
   public:
     enum AntennaType
@@ -197,6 +214,18 @@ class lefin
     // Skip macro-obstructions in the lef file.
     void skipObstructions() { _skip_obstructions = true; }
 
+    //
+    // Create the masters on a second thread while the LEF files are parsed,
+    // for every read that creates or updates a library. Masters are created
+    // in file order, so the library matches a sequential read.
+    //
+    void pipelineMacros() { _pipeline_macros = true; }
+
+    // Called by the parser callbacks around any database update other than
+    // a macro; waits for the pending macros when pipelining.
+    void beginCallback();
+    void endCallback();
+
     //
     // Override the LEF DBU-PER-MICRON unit.
     // This function only is only effective when creating a technolgy, because the DBU-PER-MICRON is
@@ -167,6 +167,7 @@ class dbArrayTable : public dbObjectTable
     void writePage( dbOStream & stream, const dbArrayTablePage * page ) const;
     void getObjects( std::vector<T *> & objects );
     dbObject * getObject( uint id, ... ) { return getPtr(id); }
+    bool validObject( uint id ) { return validId(id); }
     
   private:
     T * create();
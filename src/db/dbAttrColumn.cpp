@@ -0,0 +1,890 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbAttrColumn.h"
+#include "dbBlock.h"
+#include "dbProperty.h"
+#include "dbNameCache.h"
+#include "dbDatabase.h"
+#include "dbTable.h"
+#include "dbTable.hpp"
+#include "dbStream.h"
+#include "db.h"
+#include "logger.h"
+#include <string.h>
+#include <algorithm>
+
+namespace odb {
+
+static _dbAttrStore * getAttrStore( dbBlock * block_ )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+    return block->_attr_store;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// _dbAttrColumn - Methods
+//
+////////////////////////////////////////////////////////////////////
+
+_dbAttrColumn::_dbAttrColumn( _dbBlock * block, uint name, dbObjectType obj_type, dbAttrColumn::Type type )
+    : _block(block),
+      _name(name),
+      _obj_type(obj_type),
+      _type(type)
+{
+}
+
+_dbAttrColumn::_dbAttrColumn( _dbBlock * block, const _dbAttrColumn & c )
+    : _block(block),
+      _name(c._name),
+      _obj_type(c._obj_type),
+      _type(c._type),
+      _ints(c._ints),
+      _doubles(c._doubles),
+      _valid(c._valid)
+{
+}
+
+uint _dbAttrColumn::size() const
+{
+    if ( _type == dbAttrColumn::DOUBLE_ATTR )
+        return _doubles.size();
+
+    return _ints.size();
+}
+
+void _dbAttrColumn::reserve( uint sz )
+{
+    uint cur = size();
+
+    if ( sz <= cur )
+        return;
+
+    // grow geometrically, ids are usually written in increasing order
+    uint n = std::max( sz, cur + (cur >> 1) );
+
+    if ( _type == dbAttrColumn::DOUBLE_ATTR )
+        _doubles.resize(n, 0.0);
+    else
+        _ints.resize(n, 0);
+
+    _valid.resize( (n + 31) >> 5, 0U );
+}
+
+void _dbAttrColumn::setInt( uint id, int value )
+{
+    reserve(id + 1);
+    _ints[id] = value;
+    setValid(id);
+}
+
+void _dbAttrColumn::setDouble( uint id, double value )
+{
+    reserve(id + 1);
+    _doubles[id] = value;
+    setValid(id);
+}
+
+void _dbAttrColumn::setString( uint id, const char * value )
+{
+    // add the new name before removing the old one, they may be the same.
+    uint name_id = _block->_name_cache->addName(value);
+    
+    if ( isValid(id) )
+        _block->_name_cache->removeName( _ints[id] );
+
+    reserve(id + 1);
+    _ints[id] = name_id;
+    setValid(id);
+}
+
+const char * _dbAttrColumn::getString( uint id ) const
+{
+    if ( ! isValid(id) )
+        return NULL;
+
+    return _block->_name_cache->getName( _ints[id] );
+}
+
+void _dbAttrColumn::clearValue( uint id )
+{
+    if ( ! isValid(id) )
+        return;
+
+    if ( _type == dbAttrColumn::STRING_ATTR )
+        _block->_name_cache->removeName( _ints[id] );
+
+    _valid[id >> 5] &= ~(1U << (id & 31));
+}
+
+void _dbAttrColumn::clear()
+{
+    if ( _type == dbAttrColumn::STRING_ATTR )
+    {
+        uint id;
+        uint n = size();
+
+        for( id = 0; id < n; ++id )
+            if ( isValid(id) )
+                _block->_name_cache->removeName( _ints[id] );
+    }
+
+    std::vector<int>().swap(_ints);
+    std::vector<double>().swap(_doubles);
+    std::vector<uint>().swap(_valid);
+}
+
+_PropTypeEnum _dbAttrColumn::getPropType() const
+{
+    switch( _type )
+    {
+        case dbAttrColumn::INT_ATTR:    return DB_INT_PROP;
+        case dbAttrColumn::DOUBLE_ATTR: return DB_DOUBLE_PROP;
+        case dbAttrColumn::BOOL_ATTR:   return DB_BOOL_PROP;
+        case dbAttrColumn::STRING_ATTR: return DB_STRING_PROP;
+    }
+
+    assert(0);
+    return DB_INT_PROP;
+}
+
+void _dbAttrColumn::storeProperty( _dbProperty * prop, uint id ) const
+{
+    switch( _type )
+    {
+        case dbAttrColumn::INT_ATTR:
+            prop->_value._int_val = getInt(id);
+            break;
+
+        case dbAttrColumn::DOUBLE_ATTR:
+            prop->_value._double_val = getDouble(id);
+            break;
+
+        case dbAttrColumn::BOOL_ATTR:
+            prop->_value._bool_val = getInt(id) != 0;
+            break;
+
+        case dbAttrColumn::STRING_ATTR:
+        {
+            const char * value = getString(id);
+
+            if ( prop->_value._str_val )
+                free( (void *) prop->_value._str_val );
+
+            prop->_value._str_val = strdup( value ? value : "" );
+            ZALLOCATED(prop->_value._str_val);
+            break;
+        }
+    }
+}
+
+// Get the attribute store of the block owning an object, NULL if the object
+// is not owned by a block or the block has no columns.
+static _dbAttrStore * getObjectStore( dbObject * object )
+{
+    dbObject * owner = object->getOwner();
+
+    if ( (owner == NULL) || (owner->getObjectType() != dbBlockObj) )
+        return NULL;
+
+    _dbAttrStore * store = ((_dbBlock *) owner)->_attr_store;
+
+    if ( store->_columns.empty() )
+        return NULL;
+
+    return store;
+}
+
+_dbAttrColumn * _dbAttrColumn::getColumn( _dbProperty * prop )
+{
+    _dbAttrStore * store = getObjectStore(prop);
+
+    if ( store == NULL )
+        return NULL;
+
+    _dbAttrColumn * c = store->find( prop->_name, (dbObjectType) prop->_flags._owner_type );
+
+    if ( (c == NULL) || (c->getPropType() != prop->_flags._type) )
+        return NULL;
+
+    return c;
+}
+
+void _dbAttrColumn::releaseProperty( _dbProperty * prop )
+{
+    if ( (prop->_flags._type == DB_STRING_PROP) && prop->_value._str_val )
+        free( (void *) prop->_value._str_val );
+
+    memset( &prop->_value, 0, sizeof(prop->_value) );
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// _dbAttrStore - Methods
+//
+////////////////////////////////////////////////////////////////////
+
+_dbAttrStore::_dbAttrStore( _dbBlock * block )
+    : _block(block)
+{
+}
+
+_dbAttrStore::_dbAttrStore( _dbBlock * block, const _dbAttrStore & s )
+    : _block(block)
+{
+    std::vector<_dbAttrColumn *>::const_iterator itr;
+
+    for( itr = s._columns.begin(); itr != s._columns.end(); ++itr )
+    {
+        _dbAttrColumn * c = new _dbAttrColumn( block, **itr );
+        ZALLOCATED(c);
+        _columns.push_back(c);
+    }
+}
+
+_dbAttrStore::~_dbAttrStore()
+{
+    std::vector<_dbAttrColumn *>::iterator itr;
+
+    for( itr = _columns.begin(); itr != _columns.end(); ++itr )
+        delete *itr;
+}
+
+_dbAttrColumn * _dbAttrStore::find( const char * name, dbObjectType obj_type ) const
+{
+    if ( _columns.empty() )
+        return NULL;
+
+    uint name_id = _block->_name_cache->findName(name);
+
+    if ( name_id == 0 )
+        return NULL;
+
+    return find(name_id, obj_type);
+}
+
+_dbAttrColumn * _dbAttrStore::find( uint name_id, dbObjectType obj_type ) const
+{
+    std::vector<_dbAttrColumn *>::const_iterator itr;
+
+    for( itr = _columns.begin(); itr != _columns.end(); ++itr )
+    {
+        _dbAttrColumn * c = *itr;
+
+        if ( (c->_name == name_id) && (c->_obj_type == obj_type) )
+            return c;
+    }
+
+    return NULL;
+}
+
+_dbAttrColumn * _dbAttrStore::create( const char * name, dbObjectType obj_type, dbAttrColumn::Type type )
+{
+    uint name_id = _block->_name_cache->addName(name);
+    _dbAttrColumn * c = new _dbAttrColumn( _block, name_id, obj_type, type );
+    ZALLOCATED(c);
+    _columns.push_back(c);
+    return c;
+}
+
+void _dbAttrStore::destroy( _dbAttrColumn * c )
+{
+    std::vector<_dbAttrColumn *>::iterator itr = std::find( _columns.begin(), _columns.end(), c );
+    assert( itr != _columns.end() );
+    _columns.erase(itr);
+
+    c->clear();
+    _block->_name_cache->removeName(c->_name);
+    delete c;
+}
+
+void _dbAttrStore::clearObject( dbObjectType obj_type, uint id )
+{
+    std::vector<_dbAttrColumn *>::iterator itr;
+
+    for( itr = _columns.begin(); itr != _columns.end(); ++itr )
+    {
+        _dbAttrColumn * c = *itr;
+
+        if ( c->_obj_type == obj_type )
+            c->clearValue(id);
+    }
+}
+
+bool _dbAttrStore::hasValues( dbObjectType obj_type, uint id ) const
+{
+    std::vector<_dbAttrColumn *>::const_iterator itr;
+
+    for( itr = _columns.begin(); itr != _columns.end(); ++itr )
+    {
+        const _dbAttrColumn * c = *itr;
+
+        if ( (c->_obj_type == obj_type) && c->isValid(id) )
+            return true;
+    }
+
+    return false;
+}
+
+dbOStream & operator<<( dbOStream & stream, const _dbAttrStore & store )
+{
+    stream << (uint) store._columns.size();
+
+    std::vector<_dbAttrColumn *>::const_iterator itr;
+
+    for( itr = store._columns.begin(); itr != store._columns.end(); ++itr )
+    {
+        const _dbAttrColumn * c = *itr;
+        uint n = c->size();
+        stream << c->_name;
+        stream << (uint) c->_obj_type;
+        stream << (uint) c->_type;
+        stream << n;
+
+        uint i;
+        for( i = 0; i < c->_valid.size(); ++i )
+            stream << c->_valid[i];
+
+        // only the values which are set are written
+        for( i = 0; i < n; ++i )
+        {
+            if ( ! c->isValid(i) )
+                continue;
+
+            if ( c->_type == dbAttrColumn::DOUBLE_ATTR )
+                stream << c->_doubles[i];
+            else
+                stream << c->_ints[i];
+        }
+    }
+
+    return stream;
+}
+
+dbIStream & operator>>( dbIStream & stream, _dbAttrStore & store )
+{
+    uint ncolumns;
+    stream >> ncolumns;
+
+    uint k;
+    for( k = 0; k < ncolumns; ++k )
+    {
+        uint name, obj_type, type, n;
+        stream >> name;
+        stream >> obj_type;
+        stream >> type;
+        stream >> n;
+
+        _dbAttrColumn * c = new _dbAttrColumn( store._block, name, (dbObjectType) obj_type, (dbAttrColumn::Type) type );
+        ZALLOCATED(c);
+        store._columns.push_back(c);
+        c->reserve(n);
+
+        uint i;
+        for( i = 0; i < c->_valid.size(); ++i )
+            stream >> c->_valid[i];
+
+        for( i = 0; i < n; ++i )
+        {
+            if ( ! c->isValid(i) )
+                continue;
+
+            if ( c->_type == dbAttrColumn::DOUBLE_ATTR )
+                stream >> c->_doubles[i];
+            else
+                stream >> c->_ints[i];
+        }
+    }
+
+    return stream;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// dbAttrColumn - Methods
+//
+////////////////////////////////////////////////////////////////////
+
+// Get the column-index of an object, the object must be owned by the block of the column.
+static inline uint getColumnId( _dbAttrColumn * c, dbObject * object )
+{
+    assert( object->getObjectType() == c->_obj_type );
+    assert( object->getOwner() == (dbObject *) c->_block );
+    return object->getId();
+}
+
+// Returns true if the ids [first, first + count) are ids of objects of the column.
+static bool validIds( _dbAttrColumn * c, uint first, uint count )
+{
+    if ( first + count < first )
+        return false;
+
+    dbObjectTable * table = c->_block->getObjectTable(c->_obj_type);
+    uint id;
+
+    for( id = first; id < first + count; ++id )
+    {
+        if ( ! table->validObject(id) )
+        {
+            warning(0, "attribute column %s: id %d is not an object id\n",
+                    c->_block->_name_cache->getName(c->_name), id);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Collect the properties backed by a column, one pass over the property table.
+static void getColumnProperties( _dbAttrColumn * c, std::vector<_dbProperty *> & props )
+{
+    dbTable<_dbProperty> * prop_tbl = c->_block->_prop_tbl;
+    _PropTypeEnum prop_type = c->getPropType();
+    uint id;
+
+    for( id = 1; id <= prop_tbl->_top_idx; ++id )
+    {
+        if ( ! prop_tbl->validId(id) )
+            continue;
+
+        _dbProperty * p = prop_tbl->getPtr(id);
+
+        if ( (p->_name == c->_name)
+             && (p->_flags._owner_type == (uint) c->_obj_type)
+             && (p->_flags._type == prop_type) )
+            props.push_back(p);
+    }
+}
+
+const char * dbAttrColumn::getName()
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    return c->_block->_name_cache->getName(c->_name);
+}
+
+dbAttrColumn::Type dbAttrColumn::getType()
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    return c->_type;
+}
+
+dbObjectType dbAttrColumn::getObjectType()
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    return c->_obj_type;
+}
+
+dbBlock * dbAttrColumn::getBlock()
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    return (dbBlock *) c->_block;
+}
+
+uint dbAttrColumn::size()
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    return c->size();
+}
+
+bool dbAttrColumn::hasValue( dbObject * object )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    return c->isValid( getColumnId(c, object) );
+}
+
+void dbAttrColumn::clearValue( dbObject * object )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    c->clearValue( getColumnId(c, object) );
+
+    dbProperty * p = dbProperty::find( object, getName(), (dbProperty::Type) c->getPropType() );
+
+    if ( p )
+        dbProperty::destroy(p);
+}
+
+void dbAttrColumn::clear()
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    c->clear();
+
+    std::vector<_dbProperty *> props;
+    getColumnProperties(c, props);
+
+    std::vector<_dbProperty *>::iterator itr;
+
+    for( itr = props.begin(); itr != props.end(); ++itr )
+        dbProperty::destroy( (dbProperty *) *itr );
+}
+
+int dbAttrColumn::getInt( dbObject * object )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == INT_ATTR );
+    return c->getInt( getColumnId(c, object) );
+}
+
+void dbAttrColumn::setInt( dbObject * object, int value )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == INT_ATTR );
+    c->setInt( getColumnId(c, object), value );
+}
+
+double dbAttrColumn::getDouble( dbObject * object )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == DOUBLE_ATTR );
+    return c->getDouble( getColumnId(c, object) );
+}
+
+void dbAttrColumn::setDouble( dbObject * object, double value )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == DOUBLE_ATTR );
+    c->setDouble( getColumnId(c, object), value );
+}
+
+bool dbAttrColumn::getBool( dbObject * object )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == BOOL_ATTR );
+    return c->getInt( getColumnId(c, object) ) != 0;
+}
+
+void dbAttrColumn::setBool( dbObject * object, bool value )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == BOOL_ATTR );
+    c->setInt( getColumnId(c, object), value ? 1 : 0 );
+}
+
+const char * dbAttrColumn::getString( dbObject * object )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == STRING_ATTR );
+    return c->getString( getColumnId(c, object) );
+}
+
+void dbAttrColumn::setString( dbObject * object, const char * value )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == STRING_ATTR );
+    c->setString( getColumnId(c, object), value );
+}
+
+void dbAttrColumn::getInts( uint first, uint count, int * values )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type != DOUBLE_ATTR );
+    uint i;
+
+    for( i = 0; i < count; ++i )
+        values[i] = c->getInt(first + i);
+}
+
+bool dbAttrColumn::setInts( uint first, uint count, const int * values )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == INT_ATTR );
+
+    if ( ! validIds(c, first, count) )
+        return false;
+
+    if ( count == 0 )
+        return true;
+
+    c->reserve(first + count);
+    std::copy( values, values + count, c->_ints.begin() + first );
+
+    uint i;
+    for( i = first; i < first + count; ++i )
+        c->setValid(i);
+
+    return true;
+}
+
+void dbAttrColumn::getDoubles( uint first, uint count, double * values )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == DOUBLE_ATTR );
+    uint i;
+
+    for( i = 0; i < count; ++i )
+        values[i] = c->getDouble(first + i);
+}
+
+bool dbAttrColumn::setDoubles( uint first, uint count, const double * values )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == DOUBLE_ATTR );
+
+    if ( ! validIds(c, first, count) )
+        return false;
+
+    if ( count == 0 )
+        return true;
+
+    c->reserve(first + count);
+    std::copy( values, values + count, c->_doubles.begin() + first );
+
+    uint i;
+    for( i = first; i < first + count; ++i )
+        c->setValid(i);
+
+    return true;
+}
+
+void dbAttrColumn::getBools( uint first, uint count, bool * values )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == BOOL_ATTR );
+    uint i;
+
+    for( i = 0; i < count; ++i )
+        values[i] = c->getInt(first + i) != 0;
+}
+
+bool dbAttrColumn::setBools( uint first, uint count, const bool * values )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    assert( c->_type == BOOL_ATTR );
+
+    if ( ! validIds(c, first, count) )
+        return false;
+
+    if ( count == 0 )
+        return true;
+
+    c->reserve(first + count);
+
+    uint i;
+    for( i = 0; i < count; ++i )
+    {
+        c->_ints[first + i] = values[i] ? 1 : 0;
+        c->setValid(first + i);
+    }
+
+    return true;
+}
+
+const char * dbAttrColumn::getStringValue( int string_id )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+
+    if ( string_id == 0 )
+        return NULL;
+
+    return c->_block->_name_cache->getName(string_id);
+}
+
+uint dbAttrColumn::importProperties()
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+
+    // One pass over the property table of the block, rather than a list
+    // walk per object.
+    std::vector<_dbProperty *> props;
+    getColumnProperties(c, props);
+
+    std::vector<_dbProperty *>::iterator itr;
+    uint cnt = 0;
+
+    for( itr = props.begin(); itr != props.end(); ++itr )
+    {
+        _dbProperty * p = *itr;
+
+        // The value of a backed property is already in the column.
+        if ( c->isValid(p->_owner) )
+        {
+            _dbAttrColumn::releaseProperty(p);
+            continue;
+        }
+
+        switch( c->_type )
+        {
+            case INT_ATTR:
+                c->setInt(p->_owner, p->_value._int_val);
+                break;
+
+            case DOUBLE_ATTR:
+                c->setDouble(p->_owner, p->_value._double_val);
+                break;
+
+            case BOOL_ATTR:
+                c->setInt(p->_owner, p->_value._bool_val ? 1 : 0);
+                break;
+
+            case STRING_ATTR:
+                c->setString(p->_owner, p->_value._str_val);
+                break;
+        }
+
+        _dbAttrColumn::releaseProperty(p);
+        ++cnt;
+    }
+
+    return cnt;
+}
+
+uint dbAttrColumn::exportProperties()
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) this;
+    dbObjectTable * table = c->_block->getObjectTable(c->_obj_type);
+    const char * name = getName();
+    uint cnt = 0;
+    uint n = c->size();
+    uint id;
+
+    for( id = 0; id < n; ++id )
+    {
+        if ( ! c->isValid(id) )
+            continue;
+
+        dbObject * object = table->getObject(id);
+
+        switch( c->_type )
+        {
+            case INT_ATTR:
+            {
+                dbIntProperty * p = dbIntProperty::find(object, name);
+
+                if ( p )
+                    p->setValue( c->_ints[id] );
+                else
+                    p = dbIntProperty::create(object, name, c->_ints[id]);
+
+                if ( p )
+                    ++cnt;
+                break;
+            }
+
+            case DOUBLE_ATTR:
+            {
+                dbDoubleProperty * p = dbDoubleProperty::find(object, name);
+
+                if ( p )
+                    p->setValue( c->_doubles[id] );
+                else
+                    p = dbDoubleProperty::create(object, name, c->_doubles[id]);
+
+                if ( p )
+                    ++cnt;
+                break;
+            }
+
+            case BOOL_ATTR:
+            {
+                dbBoolProperty * p = dbBoolProperty::find(object, name);
+
+                if ( p )
+                    p->setValue( c->_ints[id] != 0 );
+                else
+                    p = dbBoolProperty::create(object, name, c->_ints[id] != 0);
+
+                if ( p )
+                    ++cnt;
+                break;
+            }
+
+            case STRING_ATTR:
+            {
+                const char * value = c->getString(id);
+                dbStringProperty * p = dbStringProperty::find(object, name);
+
+                if ( p )
+                    p->setValue(value);
+                else
+                    p = dbStringProperty::create(object, name, value);
+
+                if ( p )
+                    ++cnt;
+                break;
+            }
+        }
+    }
+
+    return cnt;
+}
+
+dbAttrColumn * dbAttrColumn::create( dbBlock * block_, const char * name, dbObjectType obj_type, Type type )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+    dbObjectTable * table = block->getObjectTable(obj_type);
+
+    if ( (table == NULL) || (table->_owner != (dbObject *) block) )
+        return NULL;
+
+    _dbAttrStore * store = getAttrStore(block_);
+
+    if ( store->find(name, obj_type) )
+        return NULL;
+
+    dbAttrColumn * column = (dbAttrColumn *) store->create(name, obj_type, type);
+    column->importProperties();
+    return column;
+}
+
+dbAttrColumn * dbAttrColumn::find( dbBlock * block, const char * name, dbObjectType obj_type )
+{
+    return (dbAttrColumn *) getAttrStore(block)->find(name, obj_type);
+}
+
+void dbAttrColumn::getColumns( dbBlock * block, std::vector<dbAttrColumn *> & columns )
+{
+    _dbAttrStore * store = getAttrStore(block);
+    columns.clear();
+
+    std::vector<_dbAttrColumn *>::iterator itr;
+
+    for( itr = store->_columns.begin(); itr != store->_columns.end(); ++itr )
+        columns.push_back( (dbAttrColumn *) *itr );
+}
+
+void dbAttrColumn::destroy( dbAttrColumn * column )
+{
+    _dbAttrColumn * c = (_dbAttrColumn *) column;
+
+    // The properties keep the values of the column.
+    std::vector<_dbProperty *> props;
+    getColumnProperties(c, props);
+
+    std::vector<_dbProperty *>::iterator itr;
+
+    for( itr = props.begin(); itr != props.end(); ++itr )
+        c->storeProperty( *itr, (*itr)->_owner );
+
+    c->_block->_attr_store->destroy(c);
+}
+
+} // namespace
@@ -0,0 +1,156 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_ATTR_COLUMN_H
+#define ADS_DB_ATTR_COLUMN_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#ifndef ADS_DB_H
+#include "db.h"
+#endif
+
+#ifndef ADS_DB_PROPERTY_H
+#include "dbProperty.h"
+#endif
+
+#include <vector>
+
+namespace odb {
+
+class _dbBlock;
+class dbIStream;
+class dbOStream;
+
+//
+// _dbAttrColumn - One named, typed column of values indexed by object id.
+//
+// INT, BOOL and STRING values live in _ints (STRING values are name-ids of
+// the block's name cache, reference counted like property names). DOUBLE
+// values live in _doubles. _valid is a bitmap of the ids holding a value.
+// The vectors grow on demand up to the largest id written.
+//
+// A column backs the properties of its name and type on its objects: the
+// property values are read from and written to the column, and the property
+// rows hold no value. A value set through the column has no property row
+// until one is created through the property API, lookups never create rows.
+//
+class _dbAttrColumn
+{
+  public:
+    _dbBlock *          _block;
+    uint                _name;      // name-id in the block's name cache
+    dbObjectType        _obj_type;
+    dbAttrColumn::Type  _type;
+    std::vector<int>    _ints;
+    std::vector<double> _doubles;
+    std::vector<uint>   _valid;
+
+    _dbAttrColumn( _dbBlock * block, uint name, dbObjectType obj_type, dbAttrColumn::Type type );
+    _dbAttrColumn( _dbBlock * block, const _dbAttrColumn & c );
+
+    uint size() const;
+    void reserve( uint size );
+
+    bool isValid( uint id ) const
+    {
+        uint w = id >> 5;
+        return (w < _valid.size()) && (_valid[w] & (1U << (id & 31)));
+    }
+
+    void setValid( uint id )
+    {
+        _valid[id >> 5] |= (1U << (id & 31));
+    }
+
+    int getInt( uint id ) const
+    {
+        return isValid(id) ? _ints[id] : 0;
+    }
+
+    double getDouble( uint id ) const
+    {
+        return isValid(id) ? _doubles[id] : 0.0;
+    }
+
+    void setInt( uint id, int value );
+    void setDouble( uint id, double value );
+    void setString( uint id, const char * value );
+    const char * getString( uint id ) const;
+    void clearValue( uint id );
+    void clear();
+
+    // Get the property type of the values.
+    _PropTypeEnum getPropType() const;
+
+    // Copy the value of an id into the storage of a property.
+    void storeProperty( _dbProperty * prop, uint id ) const;
+
+    // Get the column backing a property, NULL if there is none.
+    static _dbAttrColumn * getColumn( _dbProperty * prop );
+
+    // Drop the value held by a property, its column holds it.
+    static void releaseProperty( _dbProperty * prop );
+};
+
+//
+// _dbAttrStore - The attribute columns of a block.
+//
+class _dbAttrStore
+{
+  public:
+    _dbBlock *                    _block;
+    std::vector<_dbAttrColumn *>  _columns;
+
+    _dbAttrStore( _dbBlock * block );
+    _dbAttrStore( _dbBlock * block, const _dbAttrStore & s );
+    ~_dbAttrStore();
+
+    _dbAttrColumn * find( const char * name, dbObjectType obj_type ) const;
+    _dbAttrColumn * find( uint name_id, dbObjectType obj_type ) const;
+    _dbAttrColumn * create( const char * name, dbObjectType obj_type, dbAttrColumn::Type type );
+    void destroy( _dbAttrColumn * column );
+
+    // Clear the values of a destroyed object.
+    void clearObject( dbObjectType obj_type, uint id );
+
+    // True if a column holds a value of the object.
+    bool hasValues( dbObjectType obj_type, uint id ) const;
+};
+
+dbOStream & operator<<( dbOStream & stream, const _dbAttrStore & store );
+dbIStream & operator>>( dbIStream & stream, _dbAttrStore & store );
+
+} // namespace
+
+#endif
@@ -46,6 +46,7 @@
 #include "dbDiff.h"
 #include "dbTable.hpp"
 #include "dbDiff.hpp"
+#include "dbBlockCallBackObj.h"
 
 namespace odb {
 
@@ -566,6 +567,11 @@ dbBTerm::create( dbNet * net_, const char * name )
     }
 
     net->_bterms = bterm->getOID();
+
+    std::list<dbBlockCallBackObj *>::iterator  cbitr;
+    for (cbitr = block->_callbacks.begin(); cbitr !=  block->_callbacks.end(); ++cbitr)
+      (**cbitr)().inDbBTermCreate((dbBTerm *) bterm);
+
     return (dbBTerm *) bterm;
 }
 
@@ -574,6 +580,10 @@ void dbBTerm::destroy( dbBTerm * bterm_ )
     _dbBTerm * bterm = (_dbBTerm *) bterm_;
     _dbBlock * block = (_dbBlock *) bterm->getOwner();
 
+    std::list<dbBlockCallBackObj *>::iterator  cbitr;
+    for (cbitr = block->_callbacks.begin(); cbitr !=  block->_callbacks.end(); ++cbitr)
+      (**cbitr)().inDbBTermDestroy(bterm_);
+
     // delete bpins
     dbSet<dbBPin> bpins = bterm_->getBPins();
     dbSet<dbBPin>::iterator itr;
@@ -81,7 +81,13 @@
 #include "dbTechNonDefaultRule.h"
 #include "dbTechLayerRule.h"
 #include "dbJournal.h"
+#include "dbSnapshot.h"
+#include "dbWireSpill.h"
+#include "dbAttrColumn.h"
 #include "dbBlockCallBackObj.h"
+#include "dbRcReduce.h"
+#include "dbLevelizer.h"
+#include "dbParallel.h"
 #include "dbHashTable.hpp"
 #include "dbIntHashTable.hpp"
 #include "dbTable.h"
@@ -96,6 +102,7 @@
 #include "defout.h"
 #include "lefout.h"
 #include<string>
+#include<algorithm>
 
 namespace odb {
 
@@ -249,6 +256,9 @@ _dbBlock::_dbBlock( _dbDatabase * db )
     _extControl = new dbExtControl();
     ZALLOCATED(_extControl);
 
+    _attr_store = new _dbAttrStore(this);
+    ZALLOCATED(_attr_store);
+
     _net_hash.setTable( _net_tbl );
     _inst_hash.setTable( _inst_tbl );
     _inst_hdr_hash.setTable( _inst_hdr_tbl );
@@ -299,6 +309,12 @@ _dbBlock::_dbBlock( _dbDatabase * db )
     _ptFile = NULL;
     _journal = NULL;
     _journal_pending = NULL;
+    _snapshot = NULL;
+    _wire_spill = NULL;
+
+    int i;
+    for( i = 0; i < 4; ++i )
+        _bbox_edge_cnt[i] = 0;
 
     _printControl = new dbPrintControl();
 }
@@ -433,6 +449,9 @@ _dbBlock::_dbBlock( _dbDatabase * db, const _dbBlock & block )
     _extControl = new dbExtControl();
     ZALLOCATED(_extControl);
 
+    _attr_store = new _dbAttrStore(this, *block._attr_store);
+    ZALLOCATED(_attr_store);
+
     _net_hash.setTable( _net_tbl );
     _inst_hash.setTable( _inst_tbl );
     _inst_hdr_hash.setTable( _inst_hdr_tbl );
@@ -488,6 +507,16 @@ _dbBlock::_dbBlock( _dbDatabase * db, const _dbBlock & block )
     _extmi = block._extmi;
     _journal = NULL;
     _journal_pending = NULL;
+    _snapshot = NULL;
+    _wire_spill = NULL;
+
+    // The copy does not share the spill file: load the spilled wires.
+    if ( block._wire_spill )
+        block._wire_spill->restore( *_wire_tbl );
+
+    int i;
+    for( i = 0; i < 4; ++i )
+        _bbox_edge_cnt[i] = block._bbox_edge_cnt[i];
 }
 
 _dbBlock::~_dbBlock()
@@ -525,6 +554,7 @@ _dbBlock::~_dbBlock()
     delete _r_seg_tbl;
     delete _cc_seg_tbl;
     delete _extControl;
+    delete _attr_store;
 /*
 	compilee warning
 dbBlock.cpp:513:12: warning: deleting object of polymorphic class type ‘dbNetBTermItr’ which has non-virtual destructor might cause undefined behavior [-Wdelete-non-virtual-dtor]
@@ -555,11 +585,17 @@ dbBlock.cpp:513:12: warning: deleting object of polymorphic class type ‘dbNetB
     if ( _searchDb )
         delete _searchDb;
 #endif
+    if ( _snapshot )
+        delete _snapshot;
+
     if ( _journal )
         delete _journal;
 
     if ( _journal_pending )
         delete _journal_pending;
+
+    if ( _wire_spill )
+        delete _wire_spill;
 }
 
 void dbBlock::clear()
@@ -809,6 +845,8 @@ dbOStream & operator<<( dbOStream & stream, const _dbBlock & block )
 	stream << propList;
 	// TOM
 //---------------------------------------------------------- 
+
+    stream << *block._attr_store;
 	
     for (cbitr = block._callbacks.begin(); cbitr !=  block._callbacks.end(); ++cbitr)
       (*cbitr)->inDbBlockStreamOutAfter((dbBlock *)&block);
@@ -960,6 +998,9 @@ dbIStream & operator>>( dbIStream & stream, _dbBlock & block )
 	// TOM
 	//-------------------------------------------------------------------------------
 
+    if ( stream.getDatabase()->isSchema(ADS_DB_ATTR_COLUMNS) )
+        stream >> *block._attr_store;
+
     // Create bpins
     if ( stream.getDatabase()->isLessThanSchema(ADS_DB_HIER_INST_SCHEMA) )
     {
@@ -1001,20 +1042,99 @@ dbIStream & operator>>( dbIStream & stream, _dbBlock & block )
     return stream;
 }
 
+//
+// The bbox is maintained incrementally: each edge counts the rects lying on
+// it, and the bbox is only recomputed (see dbBlock::ComputeBBox) when the
+// last rect on an edge is removed or moved off the edge.
+//
+void _dbBlock::merge_rect( adsRect & bbox, const adsRect & rect )
+{
+    if ( rect.xMin() < bbox.xMin() )
+    {
+        bbox.set_xlo( rect.xMin() );
+        _bbox_edge_cnt[0] = 1;
+    }
+    else if ( rect.xMin() == bbox.xMin() )
+        ++_bbox_edge_cnt[0];
+
+    if ( rect.yMin() < bbox.yMin() )
+    {
+        bbox.set_ylo( rect.yMin() );
+        _bbox_edge_cnt[1] = 1;
+    }
+    else if ( rect.yMin() == bbox.yMin() )
+        ++_bbox_edge_cnt[1];
+
+    if ( rect.xMax() > bbox.xMax() )
+    {
+        bbox.set_xhi( rect.xMax() );
+        _bbox_edge_cnt[2] = 1;
+    }
+    else if ( rect.xMax() == bbox.xMax() )
+        ++_bbox_edge_cnt[2];
+
+    if ( rect.yMax() > bbox.yMax() )
+    {
+        bbox.set_yhi( rect.yMax() );
+        _bbox_edge_cnt[3] = 1;
+    }
+    else if ( rect.yMax() == bbox.yMax() )
+        ++_bbox_edge_cnt[3];
+}
+
 void _dbBlock::add_rect( const adsRect & rect )
 {
     _dbBox * box = _box_tbl->getPtr(_bbox);
 
     if ( _flags._valid_bbox )
-        box->_rect.merge(rect);
+        merge_rect( box->_rect, rect );
 }
 
 void _dbBlock::remove_rect( const adsRect & rect )
 {
    _dbBox * box = _box_tbl->getPtr(_bbox);
 
-    if ( _flags._valid_bbox )
-        _flags._valid_bbox = box->_rect.inside(rect);
+    if ( _flags._valid_bbox == 0 )
+        return;
+
+    const adsRect & bbox = box->_rect;
+
+    if ( (rect.xMin() < bbox.xMin()) || (rect.yMin() < bbox.yMin())
+         || (rect.xMax() > bbox.xMax()) || (rect.yMax() > bbox.yMax()) )
+    {
+        _flags._valid_bbox = 0;
+        return;
+    }
+
+    bool on_edge[4];
+    on_edge[0] = (rect.xMin() == bbox.xMin());
+    on_edge[1] = (rect.yMin() == bbox.yMin());
+    on_edge[2] = (rect.xMax() == bbox.xMax());
+    on_edge[3] = (rect.yMax() == bbox.yMax());
+
+    int i;
+    for( i = 0; i < 4; ++i )
+    {
+        if ( on_edge[i] && (_bbox_edge_cnt[i] <= 1) )
+        {
+            _flags._valid_bbox = 0;
+            return;
+        }
+    }
+
+    for( i = 0; i < 4; ++i )
+        if ( on_edge[i] )
+            --_bbox_edge_cnt[i];
+}
+
+//
+// The new rect is added first, so a rect that stays on (or extends) an edge
+// does not invalidate the bbox.
+//
+void _dbBlock::move_rect( const adsRect & prev_rect, const adsRect & rect )
+{
+    add_rect(rect);
+    remove_rect(prev_rect);
 }
 
 bool _dbBlock::operator==( const _dbBlock & rhs ) const
@@ -1400,6 +1520,10 @@ void dbBlock::ComputeBBox()
     _dbBox * bbox = block->_box_tbl->getPtr(block->_bbox);
     bbox->_rect.reset( INT_MAX, INT_MAX, INT_MIN, INT_MIN );
 
+    int i;
+    for( i = 0; i < 4; ++i )
+        block->_bbox_edge_cnt[i] = 0;
+
     dbSet<dbInst> insts = getInsts();
     dbSet<dbInst>::iterator iitr;
 
@@ -1407,7 +1531,7 @@ void dbBlock::ComputeBBox()
     {
         dbInst * inst = *iitr;
         _dbBox * box = (_dbBox *) inst->getBBox();
-        bbox->_rect.merge(box->_rect);
+        block->merge_rect( bbox->_rect, box->_rect );
     }
     
     dbSet<dbBTerm> bterms = getBTerms();
@@ -1425,7 +1549,7 @@ void dbBlock::ComputeBBox()
             dbBox * box = bp->getBox();
             adsRect r;
             box->getBox(r);
-            bbox->_rect.merge(r);
+            block->merge_rect( bbox->_rect, r );
         }
     }
 
@@ -1436,7 +1560,7 @@ void dbBlock::ComputeBBox()
     {
         dbObstruction * obs = *oitr;
         _dbBox * box = (_dbBox *) obs->getBBox();
-        bbox->_rect.merge(box->_rect);
+        block->merge_rect( bbox->_rect, box->_rect );
     }
 
     dbSet<dbSBox> sboxes( block, block->_sbox_tbl );
@@ -1445,7 +1569,7 @@ void dbBlock::ComputeBBox()
     for( sitr = sboxes.begin(); sitr != sboxes.end(); ++sitr )
     {
         _dbBox * box = (_dbBox *) *sitr;
-        bbox->_rect.merge(box->_rect);
+        block->merge_rect( bbox->_rect, box->_rect );
     }
 
     dbSet<dbWire> wires( block, block->_wire_tbl );
@@ -1457,7 +1581,7 @@ void dbBlock::ComputeBBox()
         adsRect r;
         if ( wire->getBBox(r) )
         {
-            bbox->_rect.merge(r);
+            block->merge_rect( bbox->_rect, r );
         }
     }
 
@@ -1940,6 +2064,17 @@ dbSet<dbTechNonDefaultRule> dbBlock::getNonDefaultRules()
     return dbSet<dbTechNonDefaultRule>( block, block->_non_default_rule_tbl );
 }
 
+void dbBlock::spillWire( dbWire * wire_ )
+{
+    _dbBlock * block = (_dbBlock *) this;
+    _dbWire * wire = (_dbWire *) wire_;
+
+    if ( block->_wire_spill == NULL )
+        block->_wire_spill = new dbWireSpill( block->getDatabase() );
+
+    block->_wire_spill->spill( wire );
+}
+
 void dbBlock::copyExtDb(uint fr, uint to, uint extDbCnt, double resFactor, double ccFactor, double gndcFactor)
 {
     _dbBlock * block = (_dbBlock *) this;
@@ -2955,6 +3090,56 @@ dbBlock::keepOldParasitics(std::vector<dbNet *> & nets, bool coupled_rc, std::ve
     }
 }
 
+uint
+dbBlock::reduceParasitics(std::vector<dbNet *> & nets, double tolerance, uint threads)
+{
+    _dbBlock * block = (_dbBlock *) this;
+    std::vector<dbNet *> all_nets;
+
+    if ( nets.empty() )
+    {
+        dbSet<dbNet> bnets = getNets();
+        all_nets.reserve( bnets.size() );
+        dbSet<dbNet>::iterator itr;
+
+        for( itr = bnets.begin(); itr != bnets.end(); ++itr )
+            all_nets.push_back(*itr);
+    }
+
+    std::vector<dbNet *> & rnets = nets.empty() ? all_nets : nets;
+    threads = dbThreadCount(threads);
+
+    // Nets are staged in batches to bound the memory of the staged networks.
+    uint batch_size = 1024 * threads;
+    std::vector<dbRcReduceNet> results;
+    uint removed = 0;
+    uint start;
+
+    for( start = 0; start < rnets.size(); start += batch_size )
+    {
+        uint cnt = std::min( batch_size, (uint) rnets.size() - start );
+        results.clear();
+        results.resize(cnt);
+
+        // one reducer per chunk of nets, its scratch arrays are reused
+        uint chunk = 64;
+        dbParallelFor( (cnt + chunk - 1) / chunk, threads, [&]( uint k )
+        {
+            dbRcReduce reducer(block, tolerance);
+            uint i;
+
+            for( i = k * chunk; (i < (k + 1) * chunk) && (i < cnt); ++i )
+                reducer.stage( (_dbNet *) rnets[start + i], results[i] );
+        }, 1 );
+
+        uint i;
+        for( i = 0; i < cnt; ++i )
+            removed += dbRcReduce::commit(block, results[i]);
+    }
+
+    return removed;
+}
+
 #if 0
 //
 // Utility to create a net comprising a single SWire and two BTerms
@@ -3296,67 +3481,28 @@ uint dbBlock::levelize(std::vector<dbInst *> & startingInsts, std::vector<dbInst
 	}
 	return instsToBeLeveled.size();
 }
-uint dbBlock::levelizeFromPrimaryInputs()
+uint dbBlock::levelizeFromPrimaryInputs( uint threads )
 {
-	dbSet<dbBTerm> bterms= getBTerms();
-	dbSet<dbBTerm>::iterator bitr;
-	
-	std::vector<dbInst *> instsToBeLeveled;
-	
-	uint level= 1;
-    for( bitr = bterms.begin(); bitr != bterms.end(); ++bitr ) 
-	{
-        dbBTerm * bterm = *bitr;
-
-		dbNet *net= bterm->getNet();
-
-		if (net!=NULL) {
-			if ((net->getSigType()==dbSigType::GROUND) || (net->getSigType()==dbSigType::POWER))
-				continue;
-
-			net->setLevelAtFanout(level, true, instsToBeLeveled);
-		}
-	}
-	if (instsToBeLeveled.size()<=0)
-		return 0;
-
-	while (1) {
-		std::vector<dbInst *> startingInsts= instsToBeLeveled;
-		instsToBeLeveled.clear();
-		
-		uint cnt= levelize(startingInsts, instsToBeLeveled);
-		if (cnt==0)
-			break;
-	}
-	return 0;
+	dbLevelizer levelizer( (_dbBlock *) this, threads );
+	return levelizer.levelizeFromPrimaryInputs();
 }
-uint dbBlock::levelizeFromSequential()
+uint dbBlock::levelizeFromSequential( uint threads )
 {
-	std::vector<dbInst *> instsToBeLeveled;
-
-	dbSet<dbInst> insts= getInsts();
-	dbSet<dbInst>::iterator iitr;
+	dbLevelizer levelizer( (_dbBlock *) this, threads );
+	return levelizer.levelizeFromSequential();
+}
+uint dbBlock::findCombinationalLoops( std::vector<dbInst *> & loopInsts, uint threads )
+{
+	dbLevelizer levelizer( (_dbBlock *) this, threads );
+	std::vector<uint> ids;
+	levelizer.findLoops(ids);
 
-	for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
-	{
-		dbInst * inst = *iitr;
-		if (!inst->getMaster()->isSequential())
-			continue;
-		inst->setLevel(1, false);
-		instsToBeLeveled.push_back(inst);
-	}
-	if (instsToBeLeveled.size()<=0)
-		return 0;
+	loopInsts.clear();
+	std::vector<uint>::iterator itr;
+	for (itr= ids.begin(); itr != ids.end(); ++itr)
+		loopInsts.push_back( dbInst::getInst(this, *itr) );
 
-	while (1) {
-		std::vector<dbInst *> startingInsts= instsToBeLeveled;
-		instsToBeLeveled.clear();
-		
-		uint cnt= levelize(startingInsts, instsToBeLeveled);
-		if (cnt==0)
-			break;
-	}
-	return 0;
+	return loopInsts.size();
 }
 int dbBlock::markBackwardsUser2(dbInst *firstInst, bool mark, std::vector<dbInst *> & resultTable)
 {
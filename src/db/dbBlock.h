@@ -118,6 +118,9 @@ class _dbBPin;
 class _dbTechLayerRule;
 class _dbTechNonDefaultRule;
 class dbJournal;
+class dbSnapshot;
+class dbWireSpill;
+class _dbAttrStore;
 
 class dbString;
 class dbNetBTermItr;
@@ -237,6 +240,7 @@ class _dbBlock : public dbObject
     dbTable<_dbRSeg> *         _r_seg_tbl;
     dbTable<_dbCCSeg> *        _cc_seg_tbl;
     dbExtControl *             _extControl;
+    _dbAttrStore *             _attr_store;
 
     // NON-PERSISTANT-NON-STREAMED-MEMBERS
     dbPrintControl *             _printControl;
@@ -265,15 +269,23 @@ class _dbBlock : public dbObject
 
     dbJournal *                      _journal;
     dbJournal *                      _journal_pending;
+    dbSnapshot *                     _snapshot;
+    dbWireSpill *                    _wire_spill;
 
     // This is a temporary vector to fix bterm pins pre dbBPin...
     std::vector<_dbBTermPin> *       _bterm_pins;
 
+    // Number of rects on the xMin, yMin, xMax, yMax edges of the bbox,
+    // zero if unknown (e.g. after reading the block).
+    uint                             _bbox_edge_cnt[4];
+
     _dbBlock( _dbDatabase * db );
     _dbBlock( _dbDatabase * db, const _dbBlock & block );
     ~_dbBlock();
     void add_rect( const adsRect & rect );
     void remove_rect( const adsRect & rect );
+    void move_rect( const adsRect & prev_rect, const adsRect & rect );
+    void merge_rect( adsRect & bbox, const adsRect & rect );
     void invalidate_bbox() { _flags._valid_bbox = 0; }
     void initialize( _dbChip * chip,
                      _dbBlock * parent,
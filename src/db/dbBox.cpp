@@ -752,6 +752,7 @@ dbBox::create( dbMaster * master_, dbTechLayer * layer_,
     // link box to master
     box->_next_box = master->_obstructions;
     master->_obstructions = box->getOID();
+    master->invalidateShapeCache();
     return (dbBox *) box;
 }
 
@@ -780,6 +781,7 @@ dbBox::create( dbMaster * master_, dbTechVia * via_, int x, int y )
     // link box to master
     box->_next_box = master->_obstructions;
     master->_obstructions = box->getOID();
+    master->invalidateShapeCache();
     return (dbBox *) box;
 }
 
@@ -798,6 +800,7 @@ dbBox::create( dbMPin * pin_, dbTechLayer * layer_,
     // link box to pin
     box->_next_box = pin->_geoms;
     pin->_geoms = box->getOID();
+    master->invalidateShapeCache();
     return (dbBox *) box;
 }
 
@@ -827,6 +830,7 @@ dbBox::create( dbMPin * pin_, dbTechVia * via_, int x, int y )
     // link box to pin
     box->_next_box = pin->_geoms;
     pin->_geoms = box->getOID();
+    master->invalidateShapeCache();
     return (dbBox *) box;
 }
 
@@ -0,0 +1,403 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbBulkAccess.h"
+#include "dbBlock.h"
+#include "dbInst.h"
+#include "dbInstHdr.h"
+#include "dbBox.h"
+#include "dbNet.h"
+#include "dbITerm.h"
+#include "dbWire.h"
+#include "dbRSeg.h"
+#include "dbCapNode.h"
+#include "dbShape.h"
+#include "dbTable.h"
+#include "dbParallel.h"
+#include "db.h"
+
+namespace odb {
+
+//
+// Lay out per-object counts as CSR offsets; begin gets cnt.size() + 1 entries.
+//
+static uint prefixSum( const std::vector<uint> & cnt, std::vector<uint> & begin )
+{
+    begin.resize( cnt.size() + 1 );
+    uint n = 0;
+    uint i;
+
+    for( i = 0; i < cnt.size(); ++i )
+    {
+        begin[i] = n;
+        n += cnt[i];
+    }
+
+    begin[cnt.size()] = n;
+    return n;
+}
+
+static void getNets( dbBlock * block, std::vector<_dbNet *> & nets )
+{
+    dbSet<dbNet> bnets = block->getNets();
+    dbSet<dbNet>::iterator itr;
+    nets.clear();
+    nets.reserve( bnets.size() );
+
+    for( itr = bnets.begin(); itr != bnets.end(); ++itr )
+        nets.push_back( (_dbNet *) *itr );
+}
+
+//
+// The first rseg of a net is not listed by dbNet::getRSegs (see
+// dbRSegItr::begin), the export starts from the same rseg.
+//
+static uint firstRSeg( _dbBlock * block, _dbNet * net )
+{
+    if ( net->_r_segs == 0 )
+        return 0;
+
+    return block->_r_seg_tbl->getPtr(net->_r_segs)->_next;
+}
+
+uint dbBulkAccess::getInstPlacement( dbBlock * block_,
+                                     std::vector<uint> & inst_ids,
+                                     std::vector<int> & inst_x,
+                                     std::vector<int> & inst_y,
+                                     std::vector<int> & inst_orients,
+                                     std::vector<uint> & inst_masters,
+                                     uint threads )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+    dbSet<dbInst> insts = block_->getInsts();
+    dbSet<dbInst>::iterator itr;
+
+    inst_ids.clear();
+    inst_ids.reserve( insts.size() );
+
+    for( itr = insts.begin(); itr != insts.end(); ++itr )
+        inst_ids.push_back( itr->getId() );
+
+    uint cnt = inst_ids.size();
+    inst_x.resize(cnt);
+    inst_y.resize(cnt);
+    inst_orients.resize(cnt);
+    inst_masters.resize(cnt);
+
+    dbParallelFor( cnt, threads, [&]( uint i )
+    {
+        _dbInst * inst = block->_inst_tbl->getPtr( inst_ids[i] );
+        _dbInstHdr * inst_hdr = block->_inst_hdr_tbl->getPtr( inst->_inst_hdr );
+        _dbBox * bbox = block->_box_tbl->getPtr( inst->_bbox );
+        inst_x[i] = bbox->_rect.xMin();
+        inst_y[i] = bbox->_rect.yMin();
+        inst_orients[i] = inst->_flags._orient;
+        inst_masters[i] = inst_hdr->_master;
+    }, 1024 );
+
+    return cnt;
+}
+
+bool dbBulkAccess::setInstPlacement( dbBlock * block_,
+                                     const std::vector<uint> & inst_ids,
+                                     const std::vector<int> & inst_x,
+                                     const std::vector<int> & inst_y,
+                                     const std::vector<int> & inst_orients,
+                                     uint threads )
+{
+    uint cnt = inst_ids.size();
+
+    if ( (inst_x.size() != cnt) || (inst_y.size() != cnt) )
+        return false;
+
+    if ( ! inst_orients.empty() && (inst_orients.size() != cnt) )
+        return false;
+
+    std::vector<dbOrientType::Value> orients( inst_orients.size() );
+    uint i;
+
+    for( i = 0; i < orients.size(); ++i )
+    {
+        if ( (inst_orients[i] < dbOrientType::R0) || (inst_orients[i] > dbOrientType::MXR90) )
+            return false;
+
+        orients[i] = (dbOrientType::Value) inst_orients[i];
+    }
+
+    if ( cnt == 0 )
+        return true;
+
+    return dbInst::setLocations( block_, cnt, &inst_ids[0], &inst_x[0], &inst_y[0],
+                                 orients.empty() ? NULL : &orients[0], threads );
+}
+
+uint dbBulkAccess::getNetITerms( dbBlock * block_,
+                                 std::vector<uint> & net_ids,
+                                 std::vector<uint> & net_iterm_begin,
+                                 std::vector<uint> & iterm_ids,
+                                 std::vector<uint> & iterm_insts,
+                                 uint threads )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+    std::vector<_dbNet *> nets;
+    getNets( block_, nets );
+
+    uint num_nets = nets.size();
+    std::vector<uint> cnt( num_nets );
+    net_ids.resize( num_nets );
+
+    dbParallelFor( num_nets, threads, [&]( uint n )
+    {
+        uint c = 0;
+        dbId<_dbITerm> id;
+
+        for( id = nets[n]->_iterms; id != 0; id = block->_iterm_tbl->getPtr(id)->_next_net_iterm )
+            ++c;
+
+        net_ids[n] = nets[n]->getOID();
+        cnt[n] = c;
+    }, 256 );
+
+    uint num_iterms = prefixSum( cnt, net_iterm_begin );
+    iterm_ids.resize( num_iterms );
+    iterm_insts.resize( num_iterms );
+
+    dbParallelFor( num_nets, threads, [&]( uint n )
+    {
+        uint k = net_iterm_begin[n];
+        dbId<_dbITerm> id;
+
+        for( id = nets[n]->_iterms; id != 0; ++k )
+        {
+            _dbITerm * iterm = block->_iterm_tbl->getPtr(id);
+            iterm_ids[k] = id;
+            iterm_insts[k] = iterm->_inst;
+            id = iterm->_next_net_iterm;
+        }
+    }, 256 );
+
+    return num_nets;
+}
+
+uint dbBulkAccess::getWireSegments( dbBlock * block_,
+                                    std::vector<uint> & seg_nets,
+                                    std::vector<uint> & seg_levels,
+                                    std::vector<int> & seg_x1,
+                                    std::vector<int> & seg_y1,
+                                    std::vector<int> & seg_x2,
+                                    std::vector<int> & seg_y2,
+                                    uint threads )
+{
+    struct Seg
+    {
+        uint    _level;
+        adsRect _rect;
+    };
+
+    std::vector<_dbNet *> nets;
+    getNets( block_, nets );
+
+    // each wire is decoded once into a per-net buffer
+    uint num_nets = nets.size();
+    std::vector< std::vector<Seg> > segs( num_nets );
+    std::vector<uint> cnt( num_nets );
+
+    dbParallelFor( num_nets, threads, [&]( uint n )
+    {
+        dbWire * wire = ((dbNet *) nets[n])->getWire();
+
+        if ( wire == NULL )
+        {
+            cnt[n] = 0;
+            return;
+        }
+
+        dbWireShapeItr itr;
+        dbShape shape;
+
+        for( itr.begin(wire); itr.next(shape); )
+        {
+            if ( shape.isVia() )
+                continue;
+
+            Seg s;
+            s._level = shape.getTechLayer()->getRoutingLevel();
+            shape.getBox(s._rect);
+            segs[n].push_back(s);
+        }
+
+        cnt[n] = segs[n].size();
+    }, 16 );
+
+    std::vector<uint> begin;
+    uint num_segs = prefixSum( cnt, begin );
+    seg_nets.resize( num_segs );
+    seg_levels.resize( num_segs );
+    seg_x1.resize( num_segs );
+    seg_y1.resize( num_segs );
+    seg_x2.resize( num_segs );
+    seg_y2.resize( num_segs );
+
+    dbParallelFor( num_nets, threads, [&]( uint n )
+    {
+        uint k = begin[n];
+        uint i;
+
+        for( i = 0; i < segs[n].size(); ++i, ++k )
+        {
+            const Seg & s = segs[n][i];
+            seg_nets[k] = nets[n]->getOID();
+            seg_levels[k] = s._level;
+            seg_x1[k] = s._rect.xMin();
+            seg_y1[k] = s._rect.yMin();
+            seg_x2[k] = s._rect.xMax();
+            seg_y2[k] = s._rect.yMax();
+        }
+
+        std::vector<Seg>().swap( segs[n] );
+    }, 16 );
+
+    return num_segs;
+}
+
+uint dbBulkAccess::getRSegs( dbBlock * block_,
+                             uint corner,
+                             std::vector<uint> & rseg_ids,
+                             std::vector<uint> & rseg_nets,
+                             std::vector<uint> & rseg_sources,
+                             std::vector<uint> & rseg_targets,
+                             std::vector<double> & rseg_res,
+                             std::vector<double> & rseg_cap,
+                             uint threads )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+    std::vector<_dbNet *> nets;
+
+    if ( corner < block->_corners_per_block )
+        getNets( block_, nets );
+
+    uint num_nets = nets.size();
+    std::vector<uint> cnt( num_nets );
+
+    dbParallelFor( num_nets, threads, [&]( uint n )
+    {
+        uint c = 0;
+        dbId<_dbRSeg> id;
+
+        for( id = firstRSeg( block, nets[n] ); id != 0; id = block->_r_seg_tbl->getPtr(id)->_next )
+            ++c;
+
+        cnt[n] = c;
+    }, 256 );
+
+    std::vector<uint> begin;
+    uint num_rsegs = prefixSum( cnt, begin );
+    rseg_ids.resize( num_rsegs );
+    rseg_nets.resize( num_rsegs );
+    rseg_sources.resize( num_rsegs );
+    rseg_targets.resize( num_rsegs );
+    rseg_res.resize( num_rsegs );
+    rseg_cap.resize( num_rsegs );
+
+    dbParallelFor( num_nets, threads, [&]( uint n )
+    {
+        uint k = begin[n];
+        dbId<_dbRSeg> id;
+
+        for( id = firstRSeg( block, nets[n] ); id != 0; ++k )
+        {
+            _dbRSeg * seg = block->_r_seg_tbl->getPtr(id);
+            dbRSeg * seg_ = (dbRSeg *) seg;
+            rseg_ids[k] = id;
+            rseg_nets[k] = nets[n]->getOID();
+            rseg_sources[k] = seg->_source;
+            rseg_targets[k] = seg->_target;
+            rseg_res[k] = seg_->getResistance(corner);
+            rseg_cap[k] = seg_->getCapacitance(corner);
+            id = seg->_next;
+        }
+    }, 256 );
+
+    return num_rsegs;
+}
+
+uint dbBulkAccess::getCapNodes( dbBlock * block_,
+                                uint corner,
+                                std::vector<uint> & node_ids,
+                                std::vector<uint> & node_nets,
+                                std::vector<double> & node_cap,
+                                uint threads )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+    std::vector<_dbNet *> nets;
+
+    if ( corner < block->_corners_per_block )
+        getNets( block_, nets );
+
+    uint num_nets = nets.size();
+    std::vector<uint> cnt( num_nets );
+
+    dbParallelFor( num_nets, threads, [&]( uint n )
+    {
+        uint c = 0;
+        dbId<_dbCapNode> id;
+
+        for( id = nets[n]->_cap_nodes; id != 0; id = block->_cap_node_tbl->getPtr(id)->_next )
+            ++c;
+
+        cnt[n] = c;
+    }, 256 );
+
+    std::vector<uint> begin;
+    uint num_nodes = prefixSum( cnt, begin );
+    node_ids.resize( num_nodes );
+    node_nets.resize( num_nodes );
+    node_cap.resize( num_nodes );
+
+    dbParallelFor( num_nets, threads, [&]( uint n )
+    {
+        uint k = begin[n];
+        dbId<_dbCapNode> id;
+
+        for( id = nets[n]->_cap_nodes; id != 0; ++k )
+        {
+            _dbCapNode * node = block->_cap_node_tbl->getPtr(id);
+            node_ids[k] = id;
+            node_nets[k] = nets[n]->getOID();
+            node_cap[k] = ((dbCapNode *) node)->getCapacitance(corner);
+            id = node->_next;
+        }
+    }, 256 );
+
+    return num_nodes;
+}
+
+} // namespace
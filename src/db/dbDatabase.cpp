@@ -34,6 +34,7 @@
 #include "dbProperty.h"
 #include "dbNameCache.h"
 #include "dbLib.h"
+#include "dbMaster.h"
 #include "dbChip.h"
 #include "dbBlock.h"
 #include "dbITerm.h"
@@ -45,6 +46,8 @@
 #include "dbRSeg.h"
 #include "dbCCSeg.h"
 #include "dbJournal.h"
+#include "dbEcoStream.h"
+#include "dbSnapshot.h"
 #include "dbStream.h"
 #include "dbTable.h"
 #include "dbArrayTable.h"
@@ -259,6 +262,8 @@ _dbDatabase::_dbDatabase( _dbDatabase * db, const _dbDatabase & d )
 
     _prop_itr = new dbPropertyItr(_prop_tbl);
     ZALLOCATED(_prop_itr);
+
+    indexMasters();
 }
 
 _dbDatabase::~_dbDatabase()
@@ -275,6 +280,46 @@ _dbDatabase::~_dbDatabase()
         free( _file );
 }
 
+_dbMaster * _dbDatabase::findMaster( const char * name )
+{
+    MasterIndex::const_iterator itr = _master_index.find(name);
+
+    if ( itr == _master_index.end() )
+        return NULL;
+
+    return itr->second;
+}
+
+void _dbDatabase::indexMaster( _dbMaster * master )
+{
+    std::pair<MasterIndex::iterator, bool> r = _master_index.insert(MasterIndex::value_type(master->_name, master));
+
+    // The name is taken, a library earlier in the table shadows the later ones.
+    if ( ! r.second && (r.first->second->getOwner()->getOID() > master->getOwner()->getOID()) )
+        r.first->second = master;
+}
+
+void _dbDatabase::indexMasters()
+{
+    _master_index.clear();
+
+    dbSet<dbLib> libs(this, _lib_tbl);
+    dbSet<dbLib>::iterator litr;
+
+    for( litr = libs.begin(); litr != libs.end(); ++litr )
+    {
+        dbSet<dbMaster> masters = litr->getMasters();
+        dbSet<dbMaster>::iterator mitr;
+
+        // Libraries are visited in table order, the first one keeps the name.
+        for( mitr = masters.begin(); mitr != masters.end(); ++mitr )
+        {
+            _dbMaster * master = (_dbMaster *) *mitr;
+            _master_index.insert(MasterIndex::value_type(master->_name, master));
+        }
+    }
+}
+
 dbOStream & operator<<( dbOStream & stream, const _dbDatabase & db )
 {
     stream << db._magic1;
@@ -322,7 +367,9 @@ dbIStream & operator>>( dbIStream & stream, _dbDatabase & db )
     stream >> db._chip;
     stream >> db._tech;
     stream >> *db._tech_tbl;
+    db._master_index.clear();
     stream >> *db._lib_tbl;
+    db.indexMasters();
     stream >> *db._chip_tbl;
 
     if ( db._schema_minor >= ADS_DB_PROPERTIES )
@@ -381,15 +428,8 @@ dbDatabase::findLib( const char * name )
 dbMaster *
 dbDatabase::findMaster(const char *name)
 {
-  dbSet<dbLib> libs = getLibs();
-  dbSet<dbLib>::iterator it;
-  for (it = libs.begin(); it != libs.end(); it++) {
-    dbLib *lib = *it;
-    dbMaster *master = lib->findMaster(name);
-    if (master)
-      return master;
-  }
-  return NULL;
+  _dbDatabase * db = (_dbDatabase *) this;
+  return (dbMaster *) db->findMaster(name);
 }
 
 dbSet<dbChip>
@@ -459,11 +499,13 @@ dbDatabase::readLib( FILE * file, dbLib * lib )
     _dbDatabase * db = (_dbDatabase *) this;
     _dbLib * l = (_dbLib *) lib;
 
+    db->_master_index.clear();
     l->~_dbLib();
     new(l) _dbLib(db);
 
     dbIStream  stream(db, file);
     stream >> *l;
+    db->indexMasters();
 }
 
 void 
@@ -471,7 +513,9 @@ dbDatabase::readLibs( FILE * file )
 {
     _dbDatabase * db = (_dbDatabase *) this;
     dbIStream  stream(db, file);
+    db->_master_index.clear();
     stream >> *db->_lib_tbl;
+    db->indexMasters();
 }
 
 void 
@@ -635,6 +679,12 @@ void dbDatabase::beginEco( dbBlock * block_ )
 {
     _dbBlock * block = (_dbBlock *) block_;
 
+    if ( block->_snapshot )
+    {
+        warning(0, "beginEco: block %s has active snapshots\n", block->_name);
+        return;
+    }
+
     if ( block->_journal )
         delete block->_journal;
 
@@ -645,6 +695,13 @@ void dbDatabase::beginEco( dbBlock * block_ )
 void dbDatabase::endEco( dbBlock * block_ ) 
 {
     _dbBlock * block = (_dbBlock *) block_;
+
+    if ( block->_snapshot )
+    {
+        warning(0, "endEco: block %s has active snapshots\n", block->_name);
+        return;
+    }
+
     dbJournal * eco = block->_journal;
     block->_journal = NULL;
 
@@ -681,10 +738,9 @@ int dbDatabase::checkEco( dbBlock * block_ )
 void dbDatabase::readEco( dbBlock * block_, FILE * file )
 {
     _dbBlock * block = (_dbBlock *) block_;
-    dbIStream stream(block->getDatabase(),file);
     dbJournal * eco = new dbJournal(block_);
     assert(eco);
-    stream >> *eco;
+    dbEcoStream::read(file, *eco);
 
     if ( block->_journal_pending )
         delete block->_journal_pending;
@@ -698,10 +754,7 @@ void dbDatabase::writeEco( dbBlock * block_,  FILE * file )
     _dbBlock * block = (_dbBlock *) block_;
 
     if ( block->_journal_pending )
-    {
-        dbOStream stream(block->getDatabase(),file);
-        stream << *block->_journal_pending;
-    }
+        dbEcoStream::write(file, *block->_journal_pending);
 }
 
 void dbDatabase::commitEco( dbBlock * block_ )
@@ -718,6 +771,100 @@ void dbDatabase::commitEco( dbBlock * block_ )
     }
 }
 
+bool dbDatabase::setSavepoint( dbBlock * block_, const char * name )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+
+    if ( block->_journal == NULL )
+        return false;
+
+    block->_journal->setSavepoint(name);
+    return true;
+}
+
+bool dbDatabase::rollbackToSavepoint( dbBlock * block_, const char * name )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+
+    if ( block->_journal == NULL )
+        return false;
+
+    return block->_journal->rollbackToSavepoint(name);
+}
+
+bool dbDatabase::releaseSavepoint( dbBlock * block_, const char * name )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+
+    if ( block->_journal == NULL )
+        return false;
+
+    return block->_journal->releaseSavepoint(name);
+}
+
+bool dbDatabase::beginSnapshot( dbBlock * block_ )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+
+    if ( block->_snapshot )
+        return false;
+
+    block->_snapshot = new dbSnapshot(block);
+    ZALLOCATED(block->_snapshot);
+    return true;
+}
+
+bool dbDatabase::saveSnapshot( dbBlock * block_, const char * name )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+
+    if ( block->_snapshot == NULL )
+        return false;
+
+    return block->_snapshot->save(name);
+}
+
+bool dbDatabase::revertSnapshot( dbBlock * block_ )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+
+    if ( block->_snapshot == NULL )
+        return false;
+
+    return block->_snapshot->revert();
+}
+
+bool dbDatabase::restoreSnapshot( dbBlock * block_, const char * name )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+
+    if ( block->_snapshot == NULL )
+        return false;
+
+    return block->_snapshot->restore(name);
+}
+
+bool dbDatabase::diffSnapshot( dbBlock * block_, const char * name, FILE * out )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+
+    if ( block->_snapshot == NULL )
+        return false;
+
+    return block->_snapshot->diff(name, out);
+}
+
+void dbDatabase::endSnapshot( dbBlock * block_ )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+
+    if ( block->_snapshot )
+    {
+        delete block->_snapshot;
+        block->_snapshot = NULL;
+    }
+}
+
 dbDatabase *
 dbDatabase::create()
 {
@@ -40,6 +40,9 @@
 #include "dbCore.h"
 #endif
 
+#include <string.h>
+#include <unordered_map>
+
 namespace odb {
 
 //
@@ -85,7 +88,10 @@ namespace odb {
 #define ADS_DB_ADJUSTCC                     49
 #define ADS_DB_5BITCAPNODECHILDRENCNT       50
 #define ADS_DB_EXT_CONTROL_STAMPWIRE        51
-#define ADS_DB_SCHEMA_MINOR                 51 // Current revision number
+#define ADS_DB_ATTR_COLUMNS                 52
+#define ADS_DB_GCELL_RESOURCES              53
+#define ADS_DB_COLUMN_PROPERTIES            54
+#define ADS_DB_SCHEMA_MINOR                 54 // Current revision number
 
 template <class T> class dbTable;
 class _dbProperty;
@@ -94,6 +100,7 @@ class _dbNameCache;
 class _dbTech;
 class _dbChip;
 class _dbLib;
+class _dbMaster;
 class dbOStream;
 class dbIStream;
 class dbDiff;
@@ -120,7 +127,36 @@ class _dbDatabase : public dbObject
     int                    _unique_id;
 
     char *            _file;
-    
+
+    // Cross-library master index, kept up to date by every edit of the
+    // libraries so lookups never write it. Holds the master of the first
+    // library (in table order) that defines the name.
+    struct MasterNameHash
+    {
+        size_t operator()( const char * name ) const
+        {
+            size_t hash = 0;
+            int c;
+
+            while( (c = *name++) != '\0' )
+                hash = c + (hash << 6) + (hash << 16) - hash;
+
+            return hash;
+        }
+    };
+
+    struct MasterNameEqual
+    {
+        bool operator()( const char * n1, const char * n2 ) const { return strcmp(n1, n2) == 0; }
+    };
+
+    typedef std::unordered_map<const char *, _dbMaster *, MasterNameHash, MasterNameEqual> MasterIndex;
+    MasterIndex       _master_index;
+
+    _dbMaster * findMaster( const char * name );
+    void indexMaster( _dbMaster * master );
+    void indexMasters();
+
     _dbDatabase( _dbDatabase * db );
     _dbDatabase( _dbDatabase * db, int id );
     _dbDatabase( _dbDatabase * db, const _dbDatabase & d );
@@ -0,0 +1,578 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbEcoStream.h"
+#include "dbJournal.h"
+#include "dbDatabase.h"
+#include "dbInst.h"
+#include "dbNet.h"
+#include "dbITerm.h"
+#include "dbRSeg.h"
+#include "dbCapNode.h"
+#include "dbCCSeg.h"
+#include "dbStream.h"
+#include "db.h"
+#include <string.h>
+#include <algorithm>
+
+namespace odb {
+
+enum EcoRecord
+{
+    ECO_END,
+    ECO_RAW,
+    ECO_BATCH
+};
+
+static void putVarint( std::vector<unsigned char> & buf, uint v )
+{
+    while( v >= 0x80 )
+    {
+        buf.push_back( (unsigned char) (v | 0x80) );
+        v >>= 7;
+    }
+
+    buf.push_back( (unsigned char) v );
+}
+
+static void putSigned( std::vector<unsigned char> & buf, int v )
+{
+    putVarint( buf, ((uint) v << 1) ^ (uint) (v >> 31) );
+}
+
+static void putWord( std::vector<unsigned char> & buf, uint v )
+{
+    unsigned char * b = (unsigned char *) &v;
+    buf.insert( buf.end(), b, b + sizeof(uint) );
+}
+
+static void checkAvail( const unsigned char * p, const unsigned char * end, uint n )
+{
+    if ( (uint) (end - p) < n )
+        throw ZException( "read failed on eco stream (unexpected end of data)." );
+}
+
+static uint getVarint( const unsigned char * & p, const unsigned char * end )
+{
+    uint v = 0;
+    int shift;
+
+    for( shift = 0; shift < 35; shift += 7 )
+    {
+        checkAvail(p, end, 1);
+        unsigned char b = *p++;
+        v |= (uint) (b & 0x7f) << shift;
+
+        if ( (b & 0x80) == 0 )
+            return v;
+    }
+
+    throw ZException( "read failed on eco stream (invalid varint)." );
+    return 0;
+}
+
+static int getSigned( const unsigned char * & p, const unsigned char * end )
+{
+    uint v = getVarint(p, end);
+    return (int) (v >> 1) ^ -(int) (v & 1);
+}
+
+static uint getWord( const unsigned char * & p, const unsigned char * end )
+{
+    uint v;
+    checkAvail(p, end, sizeof(uint));
+    memcpy( &v, p, sizeof(uint) );
+    p += sizeof(uint);
+    return v;
+}
+
+struct dbEcoUpdateLess
+{
+    template <class U>
+    bool operator()( const U & a, const U & b ) const
+    {
+        if ( a._id != b._id )
+            return a._id < b._id;
+
+        if ( a._corner != b._corner )
+            return a._corner < b._corner;
+
+        return a._seq < b._seq;
+    }
+};
+
+dbEcoStream::Kind dbEcoStream::getKind( int obj_type, int field )
+{
+    switch( (dbObjectType) obj_type )
+    {
+        case dbInstObj:
+            if ( field == _dbInst::FLAGS )
+                return FLAGS;
+            if ( field == _dbInst::ORIGIN )
+                return ORIGIN;
+            break;
+
+        case dbNetObj:
+            if ( field == _dbNet::FLAGS )
+                return FLAGS;
+            break;
+
+        case dbITermObj:
+            if ( field == _dbITerm::FLAGS )
+                return FLAGS;
+            break;
+
+        case dbRSegObj:
+            if ( field == _dbRSeg::FLAGS )
+                return FLAGS;
+            if ( field == _dbRSeg::RESISTANCE || field == _dbRSeg::CAPACITANCE )
+                return VALUE;
+            break;
+
+        case dbCapNodeObj:
+            if ( field == _dbCapNode::FLAGS )
+                return FLAGS;
+            if ( field == _dbCapNode::CAPACITANCE )
+                return VALUE;
+            break;
+
+        case dbCCSegObj:
+            if ( field == _dbCCSeg::FLAGS )
+                return FLAGS;
+            if ( field == _dbCCSeg::CAPACITANCE )
+                return VALUE;
+            break;
+
+        default:
+            break;
+    }
+
+    return NONE;
+}
+
+//
+// Sort the run by object, coalesce repeated updates of the same object and
+// write the result column-wise.
+//
+void dbEcoStream::writeBatch( std::vector<unsigned char> & buf, Batch & batch )
+{
+    std::vector<Update> & updates = batch._updates;
+    std::sort( updates.begin(), updates.end(), dbEcoUpdateLess() );
+
+    uint n = 0;
+    uint i;
+    for( i = 0; i < updates.size(); ++i )
+    {
+        if ( n && updates[n-1]._id == updates[i]._id && updates[n-1]._corner == updates[i]._corner )
+        {
+            // keep the first previous value and the last new value
+            updates[n-1]._next[0] = updates[i]._next[0];
+            updates[n-1]._next[1] = updates[i]._next[1];
+        }
+        else
+            updates[n++] = updates[i];
+    }
+
+    updates.resize(n);
+
+    Kind kind = getKind( batch._obj_type, batch._field );
+    buf.push_back( ECO_BATCH );
+    putVarint( buf, batch._obj_type );
+    putVarint( buf, batch._field );
+    putVarint( buf, n );
+
+    uint prev_id = 0;
+
+    for( i = 0; i < n; ++i )
+    {
+        Update & u = updates[i];
+        putVarint( buf, u._id - prev_id );
+        prev_id = u._id;
+
+        switch( kind )
+        {
+            case FLAGS:
+                putVarint( buf, u._prev[0] );
+                putVarint( buf, u._next[0] );
+                break;
+
+            case ORIGIN:
+                putSigned( buf, (int) u._prev[0] );
+                putSigned( buf, (int) u._prev[1] );
+                putSigned( buf, (int) u._next[0] - (int) u._prev[0] );
+                putSigned( buf, (int) u._next[1] - (int) u._prev[1] );
+                break;
+
+            case VALUE:
+                putVarint( buf, u._corner );
+                putWord( buf, u._prev[0] );
+                putWord( buf, u._next[0] );
+                break;
+
+            case NONE:
+                break;
+        }
+    }
+}
+
+void dbEcoStream::getActions( dbJournalLog & log, std::vector<uint> & starts, uint start )
+{
+    // Each action ends with its start offset, so the action boundaries are
+    // found by walking the log backwards.
+    starts.clear();
+    uint end = log.size();
+
+    while( end > start )
+    {
+        log.set( end - log.uintSize() );
+        log.pop( end );
+        starts.push_back( end );
+    }
+
+    std::reverse( starts.begin(), starts.end() );
+}
+
+dbEcoStream::Kind dbEcoStream::getUpdate( dbJournalLog & log, uint start, int & obj_type, int & field, Update & u )
+{
+    unsigned char action;
+    log.set( start );
+    log.pop( action );
+
+    if ( action != dbJournal::UPDATE_FIELD )
+        return NONE;
+
+    log.pop( obj_type );
+    log.pop( u._id );
+    log.pop( field );
+    u._corner = 0;
+    u._seq = 0;
+    u._prev[1] = u._next[1] = 0;
+
+    Kind kind = getKind( obj_type, field );
+
+    switch( kind )
+    {
+        case FLAGS:
+            log.pop( u._prev[0] );
+            log.pop( u._next[0] );
+            break;
+
+        case ORIGIN:
+        {
+            int v[4];
+            log.pop( v[0] );
+            log.pop( v[1] );
+            log.pop( v[2] );
+            log.pop( v[3] );
+            u._prev[0] = v[0];
+            u._prev[1] = v[1];
+            u._next[0] = v[2];
+            u._next[1] = v[3];
+            break;
+        }
+
+        case VALUE:
+        {
+            float prev;
+            float next;
+            log.pop( prev );
+            log.pop( next );
+            log.pop( u._corner );
+            memcpy( &u._prev[0], &prev, sizeof(float) );
+            memcpy( &u._next[0], &next, sizeof(float) );
+            break;
+        }
+
+        case NONE:
+            break;
+    }
+
+    return kind;
+}
+
+void dbEcoStream::encode( std::vector<unsigned char> & buf, dbJournal & journal, uint start )
+{
+    dbJournalLog & log = journal._log;
+    uint trailer = log.ucharSize() + log.uintSize();
+
+    std::vector<uint> starts;
+    getActions( log, starts, start );
+
+    std::vector<unsigned char> raw;
+    std::vector<Batch> batches;
+    uint raw_cnt = 0;
+    uint seq = 0;
+
+    uint i;
+    for( i = 0; i <= starts.size(); ++i )
+    {
+        Update u;
+        int obj_type = 0;
+        int field = 0;
+        Kind kind = NONE;
+
+        if ( i < starts.size() )
+            kind = getUpdate( log, starts[i], obj_type, field, u );
+
+        if ( kind != NONE )
+        {
+            // A run of field updates ends at the next structural action.
+            if ( raw_cnt )
+            {
+                buf.push_back( ECO_RAW );
+                putVarint( buf, raw_cnt );
+                buf.insert( buf.end(), raw.begin(), raw.end() );
+                raw.clear();
+                raw_cnt = 0;
+            }
+
+            uint j;
+            for( j = 0; j < batches.size(); ++j )
+            {
+                if ( batches[j]._obj_type == obj_type && batches[j]._field == field )
+                    break;
+            }
+
+            if ( j == batches.size() )
+            {
+                batches.push_back( Batch() );
+                batches[j]._obj_type = obj_type;
+                batches[j]._field = field;
+            }
+
+            u._seq = seq++;
+            batches[j]._updates.push_back( u );
+            continue;
+        }
+
+        uint j;
+        for( j = 0; j < batches.size(); ++j )
+            writeBatch( buf, batches[j] );
+
+        batches.clear();
+
+        if ( i < starts.size() )
+        {
+            uint start = starts[i];
+            uint stop = ((i + 1 < starts.size()) ? starts[i+1] : log.size()) - trailer;
+            uint len = stop - start;
+            putVarint( raw, len );
+            uint offset = raw.size();
+            raw.resize( offset + len );
+
+            if ( len )
+                log.getBytes( start, &raw[offset], len );
+
+            ++raw_cnt;
+        }
+    }
+
+    if ( raw_cnt )
+    {
+        buf.push_back( ECO_RAW );
+        putVarint( buf, raw_cnt );
+        buf.insert( buf.end(), raw.begin(), raw.end() );
+    }
+
+    buf.push_back( ECO_END );
+}
+
+void dbEcoStream::write( FILE * file, dbJournal & journal )
+{
+    if ( journal._log_version == dbJournal::LOG_LEGACY )
+    {
+        // The records of a legacy journal predate the eco stream, write it
+        // back in the format it was read from.
+        dbOStream stream( (_dbDatabase *) journal._block->getDataBase(), file );
+        stream << journal._log;
+        return;
+    }
+
+    std::vector<unsigned char> buf;
+    encode( buf, journal );
+
+    uint header[4];
+    header[0] = MAGIC;
+    header[1] = journal._log_version;
+    header[2] = journal._log.debug();
+    header[3] = buf.size();
+
+    if ( fwrite( header, sizeof(header), 1, file ) != 1
+         || fwrite( &buf[0], buf.size(), 1, file ) != 1 )
+        throw ZIOError( ferror(file), "write failed on eco stream; system io error: " );
+}
+
+void dbEcoStream::readBatch( const unsigned char * & p, const unsigned char * end, dbJournal & journal )
+{
+    int obj_type = getVarint(p, end);
+    int field = getVarint(p, end);
+    uint n = getVarint(p, end);
+    Kind kind = getKind( obj_type, field );
+
+    if ( kind == NONE )
+        throw ZException( "read failed on eco stream (invalid batch %d/%d).", obj_type, field );
+
+    uint id = 0;
+    uint i;
+    for( i = 0; i < n; ++i )
+    {
+        id += getVarint(p, end);
+        journal.beginAction( dbJournal::UPDATE_FIELD );
+        journal.pushParam( obj_type );
+        journal.pushParam( id );
+        journal.pushParam( field );
+
+        switch( kind )
+        {
+            case FLAGS:
+            {
+                uint prev = getVarint(p, end);
+                uint next = getVarint(p, end);
+                journal.pushParam( prev );
+                journal.pushParam( next );
+                break;
+            }
+
+            case ORIGIN:
+            {
+                int prev_x = getSigned(p, end);
+                int prev_y = getSigned(p, end);
+                int x = prev_x + getSigned(p, end);
+                int y = prev_y + getSigned(p, end);
+                journal.pushParam( prev_x );
+                journal.pushParam( prev_y );
+                journal.pushParam( x );
+                journal.pushParam( y );
+                break;
+            }
+
+            case VALUE:
+            {
+                int corner = getVarint(p, end);
+                uint prev = getWord(p, end);
+                uint next = getWord(p, end);
+                float v;
+                memcpy( &v, &prev, sizeof(float) );
+                journal.pushParam( v );
+                memcpy( &v, &next, sizeof(float) );
+                journal.pushParam( v );
+                journal.pushParam( corner );
+                break;
+            }
+
+            case NONE:
+                break;
+        }
+
+        journal.endAction();
+    }
+}
+
+void dbEcoStream::read( FILE * file, dbJournal & journal )
+{
+    dbJournalLog & log = journal._log;
+    journal.clear();
+
+    uint magic;
+    if ( fread( &magic, sizeof(uint), 1, file ) != 1 )
+        throw ZException( "read failed on eco stream (unexpected end-of-file encounted)." );
+
+    if ( magic != MAGIC )
+    {
+        // legacy format: <debug> <log-data>
+        if ( (int) magic != log.debug() )
+            throw ZException( "read failed on eco stream (journal debug mode mismatch)." );
+
+        dbIStream stream( (_dbDatabase *) journal._block->getDataBase(), file );
+        stream >> log._data;
+        journal._log_version = dbJournal::LOG_LEGACY;
+        return;
+    }
+
+    uint header[3];
+    if ( fread( header, sizeof(header), 1, file ) != 1 )
+        throw ZException( "read failed on eco stream (unexpected end-of-file encounted)." );
+
+    if ( header[0] > VERSION )
+        throw ZException( "read failed on eco stream (unsupported version %d).", header[0] );
+
+    if ( (int) header[1] != log.debug() )
+        throw ZException( "read failed on eco stream (journal debug mode mismatch)." );
+
+    std::vector<unsigned char> buf( header[2] );
+
+    if ( header[2] && fread( &buf[0], header[2], 1, file ) != 1 )
+        throw ZException( "read failed on eco stream (unexpected end-of-file encounted)." );
+
+    decode( buf.empty() ? NULL : &buf[0], buf.size(), journal );
+
+    // The records keep the layout of the revision they were written with.
+    journal._log_version = header[0];
+}
+
+void dbEcoStream::decode( const unsigned char * p, uint size, dbJournal & journal )
+{
+    dbJournalLog & log = journal._log;
+    const unsigned char * end = p + size;
+
+    for( ;; )
+    {
+        checkAvail(p, end, 1);
+        unsigned char record = *p++;
+
+        if ( record == ECO_END )
+            break;
+
+        if ( record == ECO_BATCH )
+        {
+            readBatch( p, end, journal );
+            continue;
+        }
+
+        if ( record != ECO_RAW )
+            throw ZException( "read failed on eco stream (invalid record %d).", record );
+
+        uint n = getVarint(p, end);
+        uint i;
+        for( i = 0; i < n; ++i )
+        {
+            uint len = getVarint(p, end);
+            checkAvail(p, end, len);
+            journal._action_idx = log.size();
+            journal._start_action = true;
+            log.pushBytes( p, len );
+            journal.endAction();
+            p += len;
+        }
+    }
+}
+
+} // namespace
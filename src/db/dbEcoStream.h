@@ -0,0 +1,123 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_ECO_STREAM_H
+#define ADS_DB_ECO_STREAM_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#include <stdio.h>
+#include <vector>
+
+namespace odb {
+
+class dbJournal;
+class dbJournalLog;
+
+//
+// dbEcoStream - Compact, versioned file format for ECO journals.
+//
+// The journal is written as a sequence of records:
+//
+//    RAW   - structural actions (create, delete, connect, ...), verbatim and
+//            in journal order.
+//    BATCH - a run of field updates of one object type and field. Updates
+//            in a run between two structural actions are coalesced per
+//            object (first previous value, last new value), sorted by id,
+//            and written column-wise with delta/varint encoding.
+//
+// Reading rebuilds a journal in which each run is grouped by object type
+// and field, so that dbJournal::redo() applies it as a batch.
+//
+// The version of a stream is the dbJournal::LogVersion of its records; a
+// journal read from an older stream is written back with its version.
+// The legacy format (dbJournal streamed through dbOStream) is still read.
+// Its records predate dbJournal::LOG_DISCONNECT_NET, such a journal is
+// written back in the legacy format.
+//
+class dbEcoStream
+{
+  public:
+    enum { MAGIC = 0x4f434345, VERSION = 2 };
+
+    static void write( FILE * file, dbJournal & journal );
+
+    // Throws ZException if the stream is truncated or not a valid eco.
+    static void read( FILE * file, dbJournal & journal );
+
+    // Encode/decode the records (without the file header) to/from memory.
+    // Only the actions logged at or after the log offset "start" are encoded.
+    static void encode( std::vector<unsigned char> & buf, dbJournal & journal, uint start = 0 );
+    static void decode( const unsigned char * p, uint size, dbJournal & journal );
+
+    struct Update
+    {
+        uint _id;
+        int  _corner;
+        uint _seq;
+        uint _prev[2];
+        uint _next[2];
+    };
+
+    enum Kind
+    {
+        NONE,
+        FLAGS,     // uint prev, uint next
+        ORIGIN,    // int prev_x, int prev_y, int x, int y
+        VALUE      // float prev, float next, int corner
+    };
+
+    static Kind getKind( int obj_type, int field );
+
+    // Get the start offset of every action in the log at or after "start".
+    static void getActions( dbJournalLog & log, std::vector<uint> & starts, uint start = 0 );
+
+    // Decode the field update at "start". Returns the kind of the update, NONE
+    // if the action is not a batchable field update.
+    static Kind getUpdate( dbJournalLog & log, uint start, int & obj_type, int & field, Update & u );
+
+  private:
+    struct Batch
+    {
+        int                 _obj_type;
+        int                 _field;
+        std::vector<Update> _updates;
+    };
+
+    static void writeBatch( std::vector<unsigned char> & buf, Batch & batch );
+    static void readBatch( const unsigned char * & p, const unsigned char * end, dbJournal & journal );
+};
+
+} // namespace
+
+#endif
@@ -40,6 +40,7 @@
 #include "dbObstruction.h"
 #include "dbShape.h"
 #include "dbCapNode.h"
+#include "dbParallel.h"
 
 namespace odb {
 
@@ -49,7 +50,8 @@ dbFlatten::dbFlatten()
           _create_boundary_regions(false),
           _create_bterm_map(false),
           _copy_parasitics(false),
-          _next_bterm_map_id(0)
+          _next_bterm_map_id(0),
+          _threads(0)
 {
 }
 
@@ -190,21 +192,44 @@ bool dbFlatten::flatten( dbBlock * parent, dbBlock * child, int level, dbPropert
     ////////////////////////////
     dbSet<dbNet> nets = child->getNets();
     dbSet<dbNet>::iterator nitr;
+    std::vector<NetCopy> net_copies( nets.size() );
+    uint n = 0;
 
-    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr, ++n )
+        net_copies[n]._src = *nitr;
+
+    std::string prefix = (const char *) child->getParentInst()->getName();
+    prefix += _hier_d;
+
+    dbParallelFor( net_copies.size(), _threads, [&]( uint k )
     {
-        dbNet * src = *nitr;
-        dbNet * dst = copyNet(parent,src);
+        NetCopy & copy = net_copies[k];
+        copy._dst = getParentNet( parent, copy._src );
 
-        if ( dst == NULL )
-            error = true;
+        if ( copy._dst == NULL )
+            copy._name = prefix + (const char *) copy._src->getName();
+    } );
+
+    for( n = 0; n < net_copies.size(); ++n )
+    {
+        NetCopy & copy = net_copies[n];
+
+        if ( copy._dst == NULL )
+        {
+            copy._dst = copyNet( parent, copy._src, copy._name );
 
-        _net_map[src] = dst;
+            if ( copy._dst == NULL )
+                error = true;
+        }
+
+        _net_map[copy._src] = copy._dst;
     }
 
     ////////////////////////////
     // Copy instances
     ////////////////////////////
+    std::vector<InstCopy> inst_copies;
+
     for( itr = insts.begin(); itr != insts.end(); )
     {
         dbInst * inst = *itr;
@@ -218,23 +243,51 @@ bool dbFlatten::flatten( dbBlock * parent, dbBlock * child, int level, dbPropert
         }
         else
         {
-            if ( ! copyInst( parent, child->getParentInst(), inst ) )
-                error = true;
-
+            inst_copies.push_back( InstCopy() );
+            inst_copies.back()._src = inst;
             ++itr;
         }
     }
 
+    dbParallelFor( inst_copies.size(), _threads, [&]( uint i )
+    {
+        stageInst( inst_copies[i], child->getParentInst(), inst_copies[i]._src );
+    } );
+
+    uint i;
+    for( i = 0; i < inst_copies.size(); ++i )
+    {
+        if ( ! copyInst( parent, child->getParentInst(), inst_copies[i] ) )
+            error = true;
+    }
+
     ////////////////////////////
     // Copy the wires seperately
     ////////////////////////////
-    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+
+    // The wires are staged in batches to bound the memory of the copies.
+    uint batch_size = 1024 * dbThreadCount(_threads);
+    uint start;
+
+    for( start = 0; start < net_copies.size(); start += batch_size )
     {
-        dbNet * src = *nitr;
-        dbNet * dst = _net_map[src];
+        uint end = std::min( start + batch_size, (uint) net_copies.size() );
+
+        dbParallelFor( end - start, _threads, [&]( uint k )
+        {
+            NetCopy & copy = net_copies[start + k];
+
+            if ( copy._dst )
+                stageWires( copy, level );
+        }, 16 );
 
-        if ( dst )
-            copyNetWires(dst,src, level, bterm_map);
+        for( n = start; n < end; ++n )
+        {
+            NetCopy & copy = net_copies[n];
+
+            if ( copy._dst )
+                copyNetWires( copy, level, bterm_map );
+        }
     }
 
 
@@ -329,23 +382,15 @@ bool dbFlatten::flatten( dbBlock * parent, dbBlock * child, int level, dbPropert
 //           o Grandchild (inst)
 //
 */
-bool dbFlatten::copyInst( dbBlock * parent, dbInst * child, dbInst * grandchild )
+void dbFlatten::stageInst( InstCopy & copy, dbInst * child, dbInst * grandchild )
 {
-    std::string name = (const char *) child->getName();
-    name += _hier_d;
-    name += (const char *) grandchild->getName();
-    
-    dbInst * inst = dbInst::create( parent, grandchild->getMaster(), name.c_str() );
-    _inst_map[grandchild]= inst;
+    copy._name = (const char *) child->getName();
+    copy._name += _hier_d;
+    copy._name += (const char *) grandchild->getName();
 
-    // Copy placement
-    dbTransform gt;
-    grandchild->getTransform(gt);
-    gt.concat(_transform);
-    inst->setTransform(gt);
-    inst->setPlacementStatus( child->getPlacementStatus() );
+    grandchild->getTransform(copy._transform);
+    copy._transform.concat(_transform);
 
-    // Copy connections
     dbSet<dbITerm> iterms = grandchild->getITerms();
     dbSet<dbITerm>::iterator itr;
 
@@ -356,50 +401,67 @@ bool dbFlatten::copyInst( dbBlock * parent, dbInst * child, dbInst * grandchild
 
         if ( child_net != NULL )
         {
-            dbNet * parent_net = _net_map[child_net];
+            std::map<dbNet *, dbNet *>::const_iterator nitr = _net_map.find(child_net);
 
-            if ( parent_net == NULL )
+            if ( (nitr == _net_map.end()) || (nitr->second == NULL) )
                 continue; // error
 
-            dbITerm * parent_iterm = inst->getITerm( child_iterm->getMTerm() );
-            dbITerm::connect( parent_iterm, parent_net );
+            copy._conns.push_back( std::make_pair( child_iterm->getMTerm(), nitr->second ) );
         }
     }
+}
+
+bool dbFlatten::copyInst( dbBlock * parent, dbInst * child, InstCopy & copy )
+{
+    dbInst * grandchild = copy._src;
+    dbInst * inst = dbInst::create( parent, grandchild->getMaster(), copy._name.c_str() );
+    _inst_map[grandchild]= inst;
+
+    // Copy placement
+    inst->setTransform(copy._transform);
+    inst->setPlacementStatus( child->getPlacementStatus() );
+
+    // Copy connections
+    uint i;
+    for( i = 0; i < copy._conns.size(); ++i )
+    {
+        dbITerm * parent_iterm = inst->getITerm( copy._conns[i].first );
+        dbITerm::connect( parent_iterm, copy._conns[i].second );
+    }
 
     // Copy misc. attributes
     copyAttrs( inst, child );
     return true;
 }
 
-dbNet * dbFlatten::copyNet( dbBlock * parent_block, dbNet * child_net )
+//
+// Returns the parent net of an external child net, NULL if the net is
+// internal (or none of its iterms is connected in the parent).
+//
+dbNet * dbFlatten::getParentNet( dbBlock * parent_block, dbNet * child_net )
 {
     dbSet<dbBTerm> bterms = child_net->getBTerms();
+    dbSet<dbBTerm>::iterator itr;
 
-    if ( ! bterms.empty() )
+    for( itr = bterms.begin(); itr != bterms.end(); ++itr )
     {
-        // external net, find a parent
-        dbSet<dbBTerm>::iterator itr;
-
-        for( itr = bterms.begin(); itr != bterms.end(); ++itr )
-        {
-            dbBTerm * bterm = *itr;
-            dbITerm * iterm = bterm->getITerm();
-            dbNet * net = iterm->getNet();
+        dbBTerm * bterm = *itr;
+        dbITerm * iterm = bterm->getITerm();
+        dbNet * net = iterm->getNet();
 
-            if ( net )
-                return net;
-        }
-
-        // None of the iterms were connected to a net in the parent-inst.
-        // Create a new net?
-        // TODO: Does this case need special consideration...
+        if ( net )
+            return net;
     }
 
-    // internal net, export up hierarchy
-    dbInst * inst = child_net->getBlock()->getParentInst();
-    std::string name = (const char *) inst->getName();
-    name += _hier_d;
-    name += (const char *) child_net->getName();
+    // None of the iterms were connected to a net in the parent-inst.
+    // Create a new net?
+    // TODO: Does this case need special consideration...
+    return NULL;
+}
+
+// internal net, export up hierarchy
+dbNet * dbFlatten::copyNet( dbBlock * parent_block, dbNet * child_net, const std::string & name )
+{
     dbNet * net = dbNet::create( parent_block, name.c_str() );
 
     if ( net == NULL )
@@ -579,13 +641,26 @@ FILE *dbFlatten::debugNetWires(FILE *fp, dbNet * dst, dbNet * src, const char *m
 	}
 	return fp;
 }
-void dbFlatten::copyNetWires( dbNet * dst, dbNet * src, int level, dbProperty * bterm_map )
+void dbFlatten::copyNetWires( NetCopy & copy, int level, dbProperty * bterm_map )
 {
+    dbNet * dst = copy._dst;
+    dbNet * src = copy._src;
     FILE *fp= NULL;
     if(isDebug("FLATTEN", "R"))
     	fp= debugNetWires(NULL, dst, src, "Before CopyWires");
 
-    copyWires( dst, src, level, bterm_map, _copy_parasitics );
+    bool copied = copy._wire._copy;
+    commitWire( copy._wire, dst, false, src->getBlock(), bterm_map );
+
+    if ( copied && _copy_parasitics ) {
+	dbSet<dbRSeg> rSet= dst->getRSegs(); 
+	rSet.reverse();
+
+	rSet= dst->getRSegs(); 
+	rSet.reverse();
+    }
+
+    commitWire( copy._global_wire, dst, true, src->getBlock(), bterm_map );
     copySWires( dst, src );
 
     if (fp!=NULL) {
@@ -641,81 +716,73 @@ void dbFlatten::copyAttrs( dbNet * dst_, dbNet * src_ )
     dst->_non_default_rule = src->_non_default_rule;
 }
 
-void dbFlatten::copyWires( dbNet * dst_, dbNet * src_, int level, dbProperty * bterm_map, bool copyParasitics )
+//
+// Stage the fixed-up copies of the wire and global wire of a child net.
+// Only the child wires are modified (shape properties of the parasitics),
+// so different nets can be staged concurrently.
+//
+void dbFlatten::stageWires( NetCopy & copy, int level )
 {
-    //_dbNet * dst = (_dbNet *) dst_;
-    _dbNet * src = (_dbNet *) src_;
+    _dbNet * src = (_dbNet *) copy._src;
 
     if ( src->_wire )
     {
-        _dbWire * src_wire = (_dbWire *) src_->getWire();
+        dbWire * src_wire = copy._src->getWire();
 
-        if ( canCopyWire( (dbWire *) src_wire, src->_flags._sig_type ) )
+        if ( canCopyWire( src_wire, src->_flags._sig_type ) )
         {
-	    if (copyParasitics)
-		setOldShapeIds(src_->getWire());
-
-            if ( dst_->getWire() )
-            {	
-                dbVector<unsigned char> opcodes;
-                dbVector<int> data;
-                opcodes.reserve( src_wire->_opcodes.size() );
-                opcodes = src_wire->_opcodes;
-                data.reserve( src_wire->_data.size() );
-                data = src_wire->_data;
-                fixWire(opcodes, data, src_->getBlock(), level, bterm_map);
-                appendWire(opcodes, data, dst_->getWire());
-            }
-            else
-            {
-                _dbWire * dst_wire = (_dbWire *) dbWire::create( dst_ );
-                dst_wire->_opcodes.reserve( src_wire->_opcodes.size() );
-                dst_wire->_opcodes = src_wire->_opcodes;
-                dst_wire->_data.reserve( src_wire->_data.size() );
-                dst_wire->_data = src_wire->_data;
-                fixWire(dst_wire->_opcodes, dst_wire->_data, src_->getBlock(), level, bterm_map);
-            }
-	    if (copyParasitics) { 
-		dbSet<dbRSeg> rSet= dst_->getRSegs(); 
-		rSet.reverse();
+	    if (_copy_parasitics)
+		setOldShapeIds(src_wire);
 
-		rSet= dst_->getRSegs(); 
-		rSet.reverse();
-	    }
+            stageWire( copy._wire, src_wire, level );
         }
     }
 
     if ( src->_global_wire )
     {
-        _dbWire * src_wire = (_dbWire *) src_->getGlobalWire();
+        dbWire * src_wire = copy._src->getGlobalWire();
 
-        if ( canCopyWire( (dbWire *) src_wire, src->_flags._sig_type ) )
-        {
-            if ( dst_->getGlobalWire() )
-            {
-                dbVector<unsigned char> opcodes;
-                dbVector<int> data;
-                opcodes.reserve( src_wire->_opcodes.size() );
-                opcodes = src_wire->_opcodes;
-                data.reserve( src_wire->_data.size() );
-                data = src_wire->_data;
-                fixWire(opcodes, data, src_->getBlock(), level, bterm_map);
-                appendWire(opcodes, data, dst_->getGlobalWire());
-            }
-            else
-            {
-                _dbWire * dst_wire = (_dbWire *) dbWire::create( dst_, true );
-                dst_wire->_opcodes.reserve( src_wire->_opcodes.size() );
-                dst_wire->_opcodes = src_wire->_opcodes;
-                dst_wire->_data.reserve( src_wire->_data.size() );
-                dst_wire->_data = src_wire->_data;
-                fixWire(dst_wire->_opcodes, dst_wire->_data, src_->getBlock(), level, bterm_map);
-            }
-        }
+        if ( canCopyWire( src_wire, src->_flags._sig_type ) )
+            stageWire( copy._global_wire, src_wire, level );
     }
 }
 
-void dbFlatten::fixWire( dbVector<unsigned char> & opcodes, dbVector<int> & data, dbBlock * src, int level, dbProperty * bterm_map )
+void dbFlatten::stageWire( WireCopy & copy, dbWire * src_, int level )
+{
+    _dbWire * src = (_dbWire *) src_;
+    copy._copy = true;
+    copy._opcodes = src->_opcodes;
+    copy._data = src->_data;
+    fixWire( copy._opcodes, copy._data, src_->getBlock(), level, _create_bterm_map, copy._bterms );
+}
+
+void dbFlatten::commitWire( WireCopy & copy, dbNet * dst, bool global_wire, dbBlock * src, dbProperty * bterm_map )
+{
+    if ( ! copy._copy )
+        return;
+
+    mapBTerms( copy._opcodes, copy._data, src, bterm_map, copy._bterms );
+
+    dbWire * dst_wire = global_wire ? dst->getGlobalWire() : dst->getWire();
+
+    if ( dst_wire )
+        appendWire( copy._opcodes, copy._data, dst_wire );
+    else
+    {
+        _dbWire * wire = (_dbWire *) dbWire::create( dst, global_wire );
+        wire->_opcodes.swap( copy._opcodes );
+        wire->_data.swap( copy._data );
+    }
+
+    copy = WireCopy();
+}
+
+//
+// Translate a child wire to the parent. The id maps are only read, so
+// different wires can be fixed concurrently; the WOP_BTERM opcodes that
+// need a bterm-map entry are collected in "bterms" for mapBTerms.
+//
+void dbFlatten::fixWire( dbVector<unsigned char> & opcodes, dbVector<int> & data, dbBlock * src, int level, bool bterm_map, std::vector<uint> & bterms )
 {
     uint i;
     uint n = opcodes.size();
@@ -795,7 +862,7 @@ void dbFlatten::fixWire( dbVector<unsigned char> & opcodes, dbVector<int> & data
             {
                 uint vid = data[i];
                 dbVia * src_via = dbVia::getVia(src,vid);
-                dbVia * dst_via = _via_map[src_via];
+                dbVia * dst_via = _via_map.find(src_via)->second;
                 data[i] = dst_via->getOID();
                 break;
             }
@@ -822,7 +889,8 @@ void dbFlatten::fixWire( dbVector<unsigned char> & opcodes, dbVector<int> & data
                 }
                 
                 dbInst * src_inst = src_iterm->getInst();
-                dbInst * dst_inst = _inst_map[src_inst];
+                std::map<dbInst *, dbInst *>::const_iterator iitr = _inst_map.find(src_inst);
+                dbInst * dst_inst = iitr != _inst_map.end() ? iitr->second : NULL;
                 assert(dst_inst);
                 dbMTerm * mterm = src_iterm->getMTerm();
                 dbITerm * dst_iterm = dst_inst->getITerm( mterm );
@@ -832,20 +900,13 @@ void dbFlatten::fixWire( dbVector<unsigned char> & opcodes, dbVector<int> & data
 
             case WOP_BTERM:
             {
-                if ( bterm_map == NULL )
+                if ( ! bterm_map )
                 {
                     opcodes[i] = WOP_NOP;
                     data[i] = 0;
                 }
                 else
-                {
-                    dbBTerm * bterm = dbBTerm::getBTerm( src, data[i] );
-                    dbString name = bterm->getName();
-                    dbIntProperty::create( bterm_map, name.c_str(), _next_bterm_map_id );
-                    opcodes[i] = WOP_BTERM_MAP;
-                    data[i] = _next_bterm_map_id;;
-                    ++_next_bterm_map_id;
-                }
+                    bterms.push_back(i);
                 
                 break;
             }
@@ -862,13 +923,32 @@ void dbFlatten::fixWire( dbVector<unsigned char> & opcodes, dbVector<int> & data
                 if ( opcode & WOP_BLOCK_RULE )
                 {
                     dbTechLayerRule * rule = dbTechLayerRule::getTechLayerRule( src, data[i] );
-                    data[i] = _layer_rule_map[rule]->getOID();
+                    data[i] = _layer_rule_map.find(rule)->second->getOID();
                 }
             }
         }
     }
 }
 
+//
+// Give the collected WOP_BTERM opcodes of a wire their bterm-map ids, in
+// wire order.
+//
+void dbFlatten::mapBTerms( dbVector<unsigned char> & opcodes, dbVector<int> & data, dbBlock * src, dbProperty * bterm_map, std::vector<uint> & bterms )
+{
+    uint k;
+    for( k = 0; k < bterms.size(); ++k )
+    {
+        uint i = bterms[k];
+        dbBTerm * bterm = dbBTerm::getBTerm( src, data[i] );
+        dbString name = bterm->getName();
+        dbIntProperty::create( bterm_map, name.c_str(), _next_bterm_map_id );
+        opcodes[i] = WOP_BTERM_MAP;
+        data[i] = _next_bterm_map_id;;
+        ++_next_bterm_map_id;
+    }
+}
+
 void dbFlatten::appendWire( dbVector<unsigned char> & opcodes, dbVector<int> & data, dbWire * dst_ )
 {
     _dbWire * dst = (_dbWire *) dst_;
@@ -53,6 +53,8 @@
 #endif
 
 #include <map>
+#include <string>
+#include <vector>
 
 namespace odb {
 
@@ -69,9 +71,47 @@ class dbTechLayerRule;
 class dbTechNonDefaultRule;
 class dbProperty;
 class dbCapNode;
+class dbMTerm;
 
+//
+// dbFlatten - Flattens the hierarchical instances of a block into the block.
+//
+// Each child block is copied in two phases: the names, transforms,
+// connections and fixed-up wires of the child objects are first computed on
+// multiple threads into staging buffers (reading the child block and the
+// id maps only), then committed serially into the parent tables in the
+// order of the child objects, so the result does not depend on the number
+// of threads.
+//
 class dbFlatten
 {
+    struct InstCopy
+    {
+        dbInst *                                  _src;
+        std::string                               _name;
+        dbTransform                               _transform;
+        std::vector<std::pair<dbMTerm *, dbNet *> > _conns;
+    };
+
+    struct WireCopy
+    {
+        bool                    _copy;
+        dbVector<unsigned char> _opcodes;
+        dbVector<int>           _data;
+        std::vector<uint>       _bterms;  // WOP_BTERM opcodes to map at commit
+
+        WireCopy() : _copy(false) {}
+    };
+
+    struct NetCopy
+    {
+        dbNet *     _src;
+        dbNet *     _dst;
+        std::string _name;  // name of the new parent net (internal nets)
+        WireCopy    _wire;
+        WireCopy    _global_wire;
+    };
+
     bool                         _do_not_copy_power_wires;
     bool                         _copy_shields;
     bool                         _create_boundary_regions;
@@ -87,21 +127,26 @@ class dbFlatten
     dbTransform                  _transform;
     char                         _hier_d;
     int                          _next_bterm_map_id;
+    uint                         _threads;
     
     bool canCopyWire( dbWire * wire, dbSigType::Value sig_type );
     bool canCopySWire( dbSWire * wire, dbSigType::Value sig_type );
     void copySWire( dbNet * dst, dbNet * src, dbSWire * src_swire );
-    void copyNetWires( dbNet * dst_, dbNet * src_, int level, dbProperty * bterm_map );
-    void copyWires( dbNet * dst_, dbNet * src_, int level, dbProperty * bterm_map, bool copyParasitics );
+    void copyNetWires( NetCopy & copy, int level, dbProperty * bterm_map );
+    void stageWires( NetCopy & copy, int level );
+    void stageWire( WireCopy & copy, dbWire * src, int level );
+    void commitWire( WireCopy & copy, dbNet * dst, bool global_wire, dbBlock * src, dbProperty * bterm_map );
     void copySWires( dbNet * dst_, dbNet * src_ );
     void copyAttrs( dbNet * dst, dbNet * src );
     void copyAttrs( dbInst * dst, dbInst * src );
     dbNet * getParentNet( dbBlock * parent_block, dbNet * child_net );
-    bool copyInst( dbBlock * parent, dbInst * child, dbInst * grandchild );
+    void stageInst( InstCopy & copy, dbInst * child, dbInst * grandchild );
+    bool copyInst( dbBlock * parent, dbInst * child, InstCopy & copy );
     bool flatten( dbBlock * parent, dbBlock * child, int level, dbProperty * bterm_map );
-    dbNet * copyNet( dbBlock * parent_block, dbNet * child_net );
+    dbNet * copyNet( dbBlock * parent_block, dbNet * child_net, const std::string & name );
     dbTechNonDefaultRule * copyNonDefaultRule( dbBlock * parent, dbInst * child, dbTechNonDefaultRule * child_rule );
-    void fixWire( dbVector<unsigned char> & opcodes, dbVector<int> & data, dbBlock * src, int level, dbProperty * bterm_map );
+    void fixWire( dbVector<unsigned char> & opcodes, dbVector<int> & data, dbBlock * src, int level, bool bterm_map, std::vector<uint> & bterms );
+    void mapBTerms( dbVector<unsigned char> & opcodes, dbVector<int> & data, dbBlock * src, dbProperty * bterm_map, std::vector<uint> & bterms );
     void appendWire( dbVector<unsigned char> & opcodes, dbVector<int> & data, dbWire * dst_ );
     void copyObstruction( dbBlock * dst_block, dbObstruction * src );
     void copyBlockage( dbBlock * dst_block, dbBlockage * src );
@@ -129,6 +174,7 @@ class dbFlatten
     void setCreateBoundaryRegions( bool value ) { _create_boundary_regions = value; }
     void setCreateBTermMap( bool value ) { _create_bterm_map = value; }
     void setCopyParasitics( bool value ) { _copy_parasitics = value; }
+    void setThreads( uint threads ) { _threads = threads; } // 0 = all hardware threads
     bool flatten( dbBlock * block, int level );
     void printShapes(FILE *fp, dbWire *wire, bool skipRCs=false);
 };
@@ -32,11 +32,16 @@
 #include "dbGCellGrid.h"
 #include "dbDatabase.h"
 #include "dbBlock.h"
+#include "dbTrackGrid.h"
+#include "dbWire.h"
+#include "dbParallel.h"
 #include "dbSet.h"
 #include "dbTable.h"
 #include "dbTable.hpp"
 #include "dbDiff.hpp"
+#include "dbStream.h"
 #include "db.h"
+#include "dbShape.h"
 #include <algorithm>
 
 namespace odb {
@@ -62,6 +67,12 @@ bool _dbGCellGrid::operator==( const _dbGCellGrid & rhs ) const
     
     if ( _y_step != rhs._y_step )
         return false;
+
+    if ( (_resources == NULL) != (rhs._resources == NULL) )
+        return false;
+
+    if ( _resources && (*_resources != *rhs._resources) )
+        return false;
     
     return true;
 }
@@ -75,6 +86,12 @@ void _dbGCellGrid::differences( dbDiff & diff, const char * field, const _dbGCel
     DIFF_VECTOR(_y_origin);
     DIFF_VECTOR(_y_count);
     DIFF_VECTOR(_y_step);
+
+    if ( (_resources != NULL) != (rhs._resources != NULL) )
+        diff.diff( "_resources", _resources != NULL, rhs._resources != NULL );
+    else if ( _resources && (*_resources != *rhs._resources) )
+        _resources->differences( diff, "_resources", *rhs._resources );
+
     DIFF_END
 }
 
@@ -87,85 +104,310 @@ void _dbGCellGrid::out( dbDiff & diff, char side, const char * field  ) const
     DIFF_OUT_VECTOR(_y_origin);
     DIFF_OUT_VECTOR(_y_count);
     DIFF_OUT_VECTOR(_y_step);
+
+    if ( _resources )
+        _resources->out( diff, side, "_resources" );
     DIFF_END
 }
 
-////////////////////////////////////////////////////////////////////
+dbOStream & operator<<( dbOStream & stream,  const _dbGCellGrid & grid )
+{
+    stream << grid._x_origin;
+    stream << grid._x_count;
+    stream << grid._x_step;
+    stream << grid._y_origin;
+    stream << grid._y_count;
+    stream << grid._y_step;
+
+    bool has_resources = (grid._resources != NULL);
+    stream << has_resources;
+
+    if ( has_resources )
+        stream << *grid._resources;
+
+    return stream;
+}
+
+dbIStream & operator>>( dbIStream & stream, _dbGCellGrid & grid )
+{
+    stream >> grid._x_origin;
+    stream >> grid._x_count;
+    stream >> grid._x_step;
+    stream >> grid._y_origin;
+    stream >> grid._y_count;
+    stream >> grid._y_step;
+    grid._x_axis.build( grid._x_origin, grid._x_count, grid._x_step );
+    grid._y_axis.build( grid._y_origin, grid._y_count, grid._y_step );
+
+    delete grid._resources;
+    grid._resources = NULL;
+
+    if ( stream.getDatabase()->isSchema(ADS_DB_GCELL_RESOURCES) )
+    {
+        bool has_resources;
+        stream >> has_resources;
+
+        if ( has_resources )
+        {
+            grid._resources = new dbGCellResources();
+            ZALLOCATED(grid._resources);
+            stream >> *grid._resources;
+        }
+    }
+
+    return stream;
+}
+
 //
-// dbGCellGrid - Methods
+// Find the gcells [first, last] covering the interval [lo, hi) of an axis
+// (or the point lo if lo == hi). Returns false if the interval is outside of
+// the grid.
 //
-////////////////////////////////////////////////////////////////////
+static bool findCells( const dbGridAxis & axis, int lo, int hi, int & first, int & last )
+{
+    int n = axis.getCount();
 
-void dbGCellGrid::getGridX( std::vector<int> & x_grid )
+    if ( (n < 2) || (hi < axis.getCoord(0)) || (lo > axis.getCoord(n - 1)) )
+        return false;
+
+    first = std::min( std::max( axis.findIndex(lo), 0 ), n - 2 );
+    last = std::min( std::max( axis.findIndex(hi > lo ? hi - 1 : hi), 0 ), n - 2 );
+    return true;
+}
+
+//
+// Get the number of tracks of a layer in the interval [lo, hi) perpendicular
+// to the preferred direction. The track axis is NULL if the layer has no
+// track grid, in which case the count is derived from the layer pitch.
+//
+static uint countTracks( const dbGridAxis * tracks, int pitch, int lo, int hi )
 {
-    x_grid.clear();
+    if ( hi <= lo )
+        return 0;
 
-    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    if ( tracks )
+    {
+        int first, end;
+        tracks->findRange( lo, hi, first, end );
+        return end - first;
+    }
 
-    uint i;
+    if ( pitch <= 0 )
+        return 0;
 
-    for( i = 0; i < grid->_x_origin.size(); ++i )
+    return (hi - lo) / pitch;
+}
+
+//
+// A wire segment crossing the gcells [c0, c1] x [r0, r1] of a routing level.
+//
+struct dbGCellSegment
+{
+    uint _level;
+    int  _c0;
+    int  _c1;
+    int  _r0;
+    int  _r1;
+};
+
+//
+// Get the gcells crossed by the wire segments of a wire. A segment is counted
+// in the row (horizontal segment) or column (vertical segment) of its center
+// line. Vias are skipped. The grid axes must be built by the caller, so this
+// function can be called on multiple threads.
+//
+static void getWireSegments( _dbGCellGrid * grid, uint num_layers, dbWire * wire,
+                             std::vector<dbGCellSegment> & segments )
+{
+    const dbGridAxis & x_axis = grid->_x_axis;
+    const dbGridAxis & y_axis = grid->_y_axis;
+
+    dbWireShapeItr itr;
+    dbShape shape;
+
+    for( itr.begin(wire); itr.next(shape); )
     {
-        int j;
+        if ( shape.isVia() )
+            continue;
+
+        dbTechLayer * layer = shape.getTechLayer();
+        uint level = layer->getRoutingLevel();
+
+        if ( (level == 0) || (level > num_layers) )
+            continue;
 
-        int x = grid->_x_origin[i];
-        int count = grid->_x_count[i];
-        int step = grid->_x_step[i];
+        adsRect r;
+        shape.getBox(r);
 
-        for ( j = 0; j < count; ++j )
+        dbGCellSegment s;
+        s._level = level;
+
+        if ( r.dx() >= r.dy() )
+        {
+            int y = (r.yMin() + r.yMax()) / 2;
+
+            if ( ! findCells( x_axis, r.xMin(), r.xMax(), s._c0, s._c1 ) )
+                continue;
+
+            if ( ! findCells( y_axis, y, y, s._r0, s._r1 ) )
+                continue;
+        }
+        else
         {
-            x_grid.push_back( x );
-            x += step;
+            int x = (r.xMin() + r.xMax()) / 2;
+
+            if ( ! findCells( x_axis, x, x, s._c0, s._c1 ) )
+                continue;
+
+            if ( ! findCells( y_axis, r.yMin(), r.yMax(), s._r0, s._r1 ) )
+                continue;
         }
+
+        segments.push_back(s);
     }
+}
 
-    // empty grid
-    if ( x_grid.begin() == x_grid.end() )
-        return;
-    
-    // sort coords in asscending order
-    std::sort( x_grid.begin(), x_grid.end() );
+static void addSegments( dbGCellResources * res, const std::vector<dbGCellSegment> & segments, int delta )
+{
+    std::vector<dbGCellSegment>::const_iterator itr;
 
-    // remove any duplicates
-    std::vector<int>::iterator new_end;
-    new_end = std::unique( x_grid.begin(), x_grid.end() );
-    x_grid.erase( new_end, x_grid.end() );
+    for( itr = segments.begin(); itr != segments.end(); ++itr )
+    {
+        const dbGCellSegment & s = *itr;
+        int c, r;
+
+        for( r = s._r0; r <= s._r1; ++r )
+            for( c = s._c0; c <= s._c1; ++c )
+                res->add( dbGCellResources::USAGE, s._level, c, r, delta );
+    }
 }
 
-void dbGCellGrid::getGridY( std::vector<int> & y_grid )
+//
+// Compute the capacity and blockage of one routing level. The blockages are
+// the routing boxes on this layer. A box blocks the tracks inside its extent
+// in the gcells where it covers at least half of the gcell length along the
+// preferred direction.
+//
+static void computeLayerResources( _dbGCellGrid * grid, dbGCellResources * res, uint level,
+                                   dbTechLayer * layer, const dbGridAxis * tracks,
+                                   const std::vector<adsRect> & blockages )
 {
-    y_grid.clear();
+    const dbGridAxis & x_axis = grid->_x_axis;
+    const dbGridAxis & y_axis = grid->_y_axis;
+    bool horizontal = (layer->getDirection() != dbTechLayerDir::VERTICAL);
+    int pitch = layer->getPitch();
+    int c, r;
+
+    // capacity: the tracks of a row (horizontal) or column (vertical)
+    if ( horizontal )
+    {
+        for( r = 0; r < (int) res->_num_rows; ++r )
+        {
+            uint cap = countTracks( tracks, pitch, y_axis.getCoord(r), y_axis.getCoord(r + 1) );
 
-    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+            for( c = 0; c < (int) res->_num_cols; ++c )
+                res->set( dbGCellResources::CAPACITY, level, c, r, cap );
+        }
+    }
+    else
+    {
+        for( c = 0; c < (int) res->_num_cols; ++c )
+        {
+            uint cap = countTracks( tracks, pitch, x_axis.getCoord(c), x_axis.getCoord(c + 1) );
+
+            for( r = 0; r < (int) res->_num_rows; ++r )
+                res->set( dbGCellResources::CAPACITY, level, c, r, cap );
+        }
+    }
 
-    uint i;
+    // blockage
+    std::vector<adsRect>::const_iterator itr;
 
-    for( i = 0; i < grid->_y_origin.size(); ++i )
+    for( itr = blockages.begin(); itr != blockages.end(); ++itr )
     {
-        int j;
+        const adsRect & b = *itr;
+        int c0, c1, r0, r1;
 
-        int y = grid->_y_origin[i];
-        int count = grid->_y_count[i];
-        int step = grid->_y_step[i];
+        if ( ! findCells( x_axis, b.xMin(), b.xMax(), c0, c1 ) )
+            continue;
 
-        for ( j = 0; j < count; ++j )
+        if ( ! findCells( y_axis, b.yMin(), b.yMax(), r0, r1 ) )
+            continue;
+
+        for( r = r0; r <= r1; ++r )
         {
-            y_grid.push_back( y );
-            y += step;
+            int ylo = y_axis.getCoord(r);
+            int yhi = y_axis.getCoord(r + 1);
+
+            for( c = c0; c <= c1; ++c )
+            {
+                int xlo = x_axis.getCoord(c);
+                int xhi = x_axis.getCoord(c + 1);
+                int lo, hi;
+
+                if ( horizontal )
+                {
+                    int len = std::min( b.xMax(), xhi ) - std::max( b.xMin(), xlo );
+
+                    if ( 2 * len < xhi - xlo )
+                        continue;
+
+                    lo = std::max( b.yMin(), ylo );
+                    hi = std::min( b.yMax() + 1, yhi );
+                }
+                else
+                {
+                    int len = std::min( b.yMax(), yhi ) - std::max( b.yMin(), ylo );
+
+                    if ( 2 * len < yhi - ylo )
+                        continue;
+
+                    lo = std::max( b.xMin(), xlo );
+                    hi = std::min( b.xMax() + 1, xhi );
+                }
+
+                res->add( dbGCellResources::BLOCKAGE, level, c, r, countTracks( tracks, pitch, lo, hi ) );
+            }
         }
     }
 
-    // empty grid
-    if ( y_grid.begin() == y_grid.end() )
-        return;
-    
-    // sort coords in asscending order
-    std::sort( y_grid.begin(), y_grid.end() );
+    // a gcell cannot have more blocked tracks than tracks
+    for( r = 0; r < (int) res->_num_rows; ++r )
+    {
+        for( c = 0; c < (int) res->_num_cols; ++c )
+        {
+            uint cap = res->get( dbGCellResources::CAPACITY, level, c, r );
+
+            if ( res->get( dbGCellResources::BLOCKAGE, level, c, r ) > cap )
+                res->set( dbGCellResources::BLOCKAGE, level, c, r, cap );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// dbGCellGrid - Methods
+//
+////////////////////////////////////////////////////////////////////
+
+void dbGCellGrid::getGridX( std::vector<int> & x_grid )
+{
+    x_grid.clear();
+
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
 
-    // remove any duplicates
-    std::vector<int>::iterator new_end;
-    new_end = std::unique( y_grid.begin(), y_grid.end() );
-    y_grid.erase( new_end, y_grid.end() );
+    // coords in ascending order without duplicates
+    grid->getAxisX().getCoords( x_grid );
+}
+
+void dbGCellGrid::getGridY( std::vector<int> & y_grid )
+{
+    y_grid.clear();
+
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+
+    // coords in ascending order without duplicates
+    grid->getAxisY().getCoords( y_grid );
 }
 
 dbBlock *
@@ -181,6 +423,8 @@ dbGCellGrid::addGridPatternX( int origin_x, int line_count, int step )
     grid->_x_origin.push_back( origin_x );
     grid->_x_count.push_back( line_count );
     grid->_x_step.push_back( step );
+    grid->_x_axis.build( grid->_x_origin, grid->_x_count, grid->_x_step );
+    clearResources();
 }
 
 void 
@@ -190,6 +434,8 @@ dbGCellGrid::addGridPatternY( int origin_y, int line_count, int step )
     grid->_y_origin.push_back( origin_y );
     grid->_y_count.push_back( line_count );
     grid->_y_step.push_back( step );
+    grid->_y_axis.build( grid->_y_origin, grid->_y_count, grid->_y_step );
+    clearResources();
 }
 
 int 
@@ -226,6 +472,346 @@ dbGCellGrid::getGridPatternY( int i, int & origin_y, int & line_count, int & ste
     step = grid->_y_step[i];
 }
 
+int
+dbGCellGrid::getGridCountX()
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return grid->getAxisX().getCount();
+}
+
+int
+dbGCellGrid::getGridCoordX( int idx )
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return grid->getAxisX().getCoord(idx);
+}
+
+int
+dbGCellGrid::findGridIndexX( int x )
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return grid->getAxisX().findIndex(x);
+}
+
+int
+dbGCellGrid::findNearestGridX( int x )
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return grid->getAxisX().findNearest(x);
+}
+
+void
+dbGCellGrid::findGridRangeX( int lo, int hi, int & first, int & end )
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    grid->getAxisX().findRange(lo, hi, first, end);
+}
+
+int
+dbGCellGrid::getGridCountY()
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return grid->getAxisY().getCount();
+}
+
+int
+dbGCellGrid::getGridCoordY( int idx )
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return grid->getAxisY().getCoord(idx);
+}
+
+int
+dbGCellGrid::findGridIndexY( int y )
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return grid->getAxisY().findIndex(y);
+}
+
+int
+dbGCellGrid::findNearestGridY( int y )
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return grid->getAxisY().findNearest(y);
+}
+
+void
+dbGCellGrid::findGridRangeY( int lo, int hi, int & first, int & end )
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    grid->getAxisY().findRange(lo, hi, first, end);
+}
+
+int
+dbGCellGrid::getNumCols()
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return std::max( grid->getAxisX().getCount() - 1, 0 );
+}
+
+int
+dbGCellGrid::getNumRows()
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return std::max( grid->getAxisY().getCount() - 1, 0 );
+}
+
+bool
+dbGCellGrid::findGCell( int x, int y, int & col, int & row )
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return findCells( grid->getAxisX(), x, x, col, col )
+           && findCells( grid->getAxisY(), y, y, row, row );
+}
+
+bool
+dbGCellGrid::hasResources()
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    return grid->_resources != NULL;
+}
+
+void
+dbGCellGrid::initResources()
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    dbTech * tech = getBlock()->getDataBase()->getTech();
+
+    if ( grid->_resources == NULL )
+    {
+        grid->_resources = new dbGCellResources();
+        ZALLOCATED(grid->_resources);
+    }
+
+    grid->_resources->init( tech->getRoutingLayerCount(), getNumCols(), getNumRows() );
+}
+
+void
+dbGCellGrid::clearResources()
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    delete grid->_resources;
+    grid->_resources = NULL;
+}
+
+//
+// Get the resources and the routing level of a gcell,
+// returns NULL if the gcell has no resources.
+//
+static dbGCellResources * getResources( _dbGCellGrid * grid, dbTechLayer * layer, int col, int row, uint & level )
+{
+    dbGCellResources * res = grid->_resources;
+
+    if ( res == NULL )
+        return NULL;
+
+    level = layer->getRoutingLevel();
+
+    if ( ! res->valid( level, col, row ) )
+        return NULL;
+
+    return res;
+}
+
+uint
+dbGCellGrid::getCapacity( dbTechLayer * layer, int col, int row )
+{
+    uint level;
+    dbGCellResources * res = getResources( (_dbGCellGrid *) this, layer, col, row, level );
+    return res ? res->get( dbGCellResources::CAPACITY, level, col, row ) : 0;
+}
+
+uint
+dbGCellGrid::getUsage( dbTechLayer * layer, int col, int row )
+{
+    uint level;
+    dbGCellResources * res = getResources( (_dbGCellGrid *) this, layer, col, row, level );
+    return res ? res->get( dbGCellResources::USAGE, level, col, row ) : 0;
+}
+
+uint
+dbGCellGrid::getBlockage( dbTechLayer * layer, int col, int row )
+{
+    uint level;
+    dbGCellResources * res = getResources( (_dbGCellGrid *) this, layer, col, row, level );
+    return res ? res->get( dbGCellResources::BLOCKAGE, level, col, row ) : 0;
+}
+
+void
+dbGCellGrid::setCapacity( dbTechLayer * layer, int col, int row, uint value )
+{
+    uint level;
+    dbGCellResources * res = getResources( (_dbGCellGrid *) this, layer, col, row, level );
+    ZASSERT( res );
+    res->set( dbGCellResources::CAPACITY, level, col, row, value );
+}
+
+void
+dbGCellGrid::setUsage( dbTechLayer * layer, int col, int row, uint value )
+{
+    uint level;
+    dbGCellResources * res = getResources( (_dbGCellGrid *) this, layer, col, row, level );
+    ZASSERT( res );
+    res->set( dbGCellResources::USAGE, level, col, row, value );
+}
+
+void
+dbGCellGrid::setBlockage( dbTechLayer * layer, int col, int row, uint value )
+{
+    uint level;
+    dbGCellResources * res = getResources( (_dbGCellGrid *) this, layer, col, row, level );
+    ZASSERT( res );
+    res->set( dbGCellResources::BLOCKAGE, level, col, row, value );
+}
+
+void
+dbGCellGrid::addUsage( dbTechLayer * layer, int col, int row, int delta )
+{
+    uint level;
+    dbGCellResources * res = getResources( (_dbGCellGrid *) this, layer, col, row, level );
+    ZASSERT( res );
+    res->add( dbGCellResources::USAGE, level, col, row, delta );
+}
+
+void
+dbGCellGrid::addWireUsage( dbWire * wire, bool remove )
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    ZASSERT( grid->_resources );
+
+    std::vector<dbGCellSegment> segments;
+    getWireSegments( grid, grid->_resources->_num_layers, wire, segments );
+    addSegments( grid->_resources, segments, remove ? -1 : 1 );
+}
+
+void
+dbGCellGrid::computeResources( uint threads )
+{
+    _dbGCellGrid * grid = (_dbGCellGrid *) this;
+    dbBlock * block = getBlock();
+    dbTech * tech = block->getDataBase()->getTech();
+
+    initResources();
+    dbGCellResources * res = grid->_resources;
+    uint num_layers = res->_num_layers;
+
+    if ( (res->_num_cols == 0) || (res->_num_rows == 0) )
+        return;
+
+    std::vector<dbTechLayer *> layers( num_layers + 1, (dbTechLayer *) NULL );
+    std::vector<const dbGridAxis *> tracks( num_layers + 1, (const dbGridAxis *) NULL );
+    std::vector< std::vector<adsRect> > blockages( num_layers + 1 );
+    uint level;
+
+    for( level = 1; level <= num_layers; ++level )
+    {
+        dbTechLayer * layer = tech->findRoutingLayer(level);
+        layers[level] = layer;
+
+        if ( layer == NULL )
+            continue;
+
+        _dbTrackGrid * track_grid = (_dbTrackGrid *) block->findTrackGrid(layer);
+
+        if ( track_grid == NULL )
+            continue;
+
+        // tracks run along the preferred direction
+        if ( layer->getDirection() != dbTechLayerDir::VERTICAL )
+            tracks[level] = &track_grid->getAxisY();
+        else
+            tracks[level] = &track_grid->getAxisX();
+    }
+
+    // blockages: routing obstructions and special wires
+    dbSet<dbObstruction> obstructions = block->getObstructions();
+    dbSet<dbObstruction>::iterator oitr;
+
+    for( oitr = obstructions.begin(); oitr != obstructions.end(); ++oitr )
+    {
+        dbBox * box = (*oitr)->getBBox();
+        dbTechLayer * layer = box->getTechLayer();
+
+        if ( layer == NULL )
+            continue;
+
+        level = layer->getRoutingLevel();
+
+        if ( (level == 0) || (level > num_layers) )
+            continue;
+
+        adsRect r;
+        box->getBox(r);
+        blockages[level].push_back(r);
+    }
+
+    dbSet<dbNet> nets = block->getNets();
+    dbSet<dbNet>::iterator nitr;
+    std::vector<dbWire *> wires;
+
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+    {
+        dbNet * net = *nitr;
+        dbWire * wire = net->getWire();
+
+        if ( wire )
+            wires.push_back(wire);
+
+        dbSet<dbSWire> swires = net->getSWires();
+        dbSet<dbSWire>::iterator switr;
+
+        for( switr = swires.begin(); switr != swires.end(); ++switr )
+        {
+            dbSet<dbSBox> sboxes = (*switr)->getWires();
+            dbSet<dbSBox>::iterator bitr;
+
+            for( bitr = sboxes.begin(); bitr != sboxes.end(); ++bitr )
+            {
+                dbSBox * box = *bitr;
+
+                if ( box->isVia() )
+                    continue;
+
+                level = box->getTechLayer()->getRoutingLevel();
+
+                if ( (level == 0) || (level > num_layers) )
+                    continue;
+
+                adsRect r;
+                box->getBox(r);
+                blockages[level].push_back(r);
+            }
+        }
+    }
+
+    // capacity and blockage, one layer per task
+    dbParallelFor( num_layers, threads, [&]( uint i )
+    {
+        uint l = i + 1;
+
+        if ( layers[l] )
+            computeLayerResources( grid, res, l, layers[l], tracks[l], blockages[l] );
+    }, 1 );
+
+    // usage: the wires are decoded on multiple threads, the segments are
+    // added in order afterwards
+    uint cnt = wires.size();
+    uint chunk = 256;
+    uint num_chunks = (cnt + chunk - 1) / chunk;
+    std::vector< std::vector<dbGCellSegment> > segments( num_chunks );
+
+    dbParallelFor( num_chunks, threads, [&]( uint k )
+    {
+        uint i;
+        for( i = k * chunk; (i < (k + 1) * chunk) && (i < cnt); ++i )
+            getWireSegments( grid, num_layers, wires[i], segments[k] );
+    }, 1 );
+
+    uint k;
+    for( k = 0; k < num_chunks; ++k )
+        addSegments( res, segments[k], 1 );
+}
+
 dbGCellGrid * dbGCellGrid::create( dbBlock * block_ )
 {
     _dbBlock * block = (_dbBlock *) block_;
@@ -52,6 +52,14 @@
 #include "dbVector.h"
 #endif
 
+#ifndef ADS_DB_GRID_AXIS_H
+#include "dbGridAxis.h"
+#endif
+
+#ifndef ADS_DB_GCELL_RESOURCES_H
+#include "dbGCellResources.h"
+#endif
+
 namespace odb {
 
 class _dbDatabase;
@@ -68,6 +76,11 @@ class _dbGCellGrid : public dbObject
     dbVector<int> _y_origin;
     dbVector<int> _y_count;
     dbVector<int> _y_step;
+    dbGCellResources * _resources;  // NULL if no resources were created
+
+    // NON-PERSISTANT-MEMBERS (rebuilt whenever the patterns change)
+    dbGridAxis    _x_axis;
+    dbGridAxis    _y_axis;
     
     _dbGCellGrid(_dbDatabase * );
     _dbGCellGrid(_dbDatabase *, const _dbGCellGrid & g );
@@ -78,6 +91,10 @@ class _dbGCellGrid : public dbObject
     void differences( dbDiff & diff, const char * field, const _dbGCellGrid & rhs ) const;
     void out( dbDiff & diff, char side, const char * field ) const;
 
+    const dbGridAxis & getAxisX() const { return _x_axis; }
+
+    const dbGridAxis & getAxisY() const { return _y_axis; }
+
     bool operator<( const _dbGCellGrid & rhs ) const
     {
         _dbGCellGrid * o1 = (_dbGCellGrid *) this;
@@ -87,6 +104,7 @@ class _dbGCellGrid : public dbObject
 };
 
 inline _dbGCellGrid::_dbGCellGrid(_dbDatabase * )
+    : _resources(NULL)
 {
 }
 
@@ -96,35 +114,25 @@ inline _dbGCellGrid::_dbGCellGrid(_dbDatabase *, const _dbGCellGrid & g )
           _x_step(g._x_step),
           _y_origin(g._y_origin),
           _y_count(g._y_count),
-          _y_step(g._y_step)
+          _y_step(g._y_step),
+          _resources(NULL),
+          _x_axis(g._x_axis),
+          _y_axis(g._y_axis)
 {
+    if ( g._resources )
+    {
+        _resources = new dbGCellResources( *g._resources );
+        ZALLOCATED(_resources);
+    }
 }
 
 inline _dbGCellGrid::~_dbGCellGrid()
 {
+    delete _resources;
 }
 
-inline dbOStream & operator<<( dbOStream & stream,  const _dbGCellGrid & grid )
-{
-    stream << grid._x_origin;
-    stream << grid._x_count;
-    stream << grid._x_step;
-    stream << grid._y_origin;
-    stream << grid._y_count;
-    stream << grid._y_step;
-    return stream;
-}
-
-inline dbIStream & operator>>( dbIStream & stream, _dbGCellGrid & grid )
-{
-    stream >> grid._x_origin;
-    stream >> grid._x_count;
-    stream >> grid._x_step;
-    stream >> grid._y_origin;
-    stream >> grid._y_count;
-    stream >> grid._y_step;
-    return stream;
-}
+dbOStream & operator<<( dbOStream & stream,  const _dbGCellGrid & grid );
+dbIStream & operator>>( dbIStream & stream, _dbGCellGrid & grid );
 
 } // namespace
 
@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbGCellResources.h"
+#include "dbStream.h"
+#include "dbDiff.h"
+
+namespace odb {
+
+dbGCellResources::dbGCellResources()
+    : _num_layers(0),
+      _num_cols(0),
+      _num_rows(0),
+      _tiles_x(0),
+      _layer_size(0)
+{
+}
+
+void dbGCellResources::init( uint num_layers, uint num_cols, uint num_rows )
+{
+    _num_layers = num_layers;
+    _num_cols = num_cols;
+    _num_rows = num_rows;
+    _tiles_x = (num_cols + TILE_MASK) >> TILE_SHIFT;
+    uint tiles_y = (num_rows + TILE_MASK) >> TILE_SHIFT;
+    _layer_size = (_tiles_x * tiles_y) << (2 * TILE_SHIFT);
+
+    int c;
+    for( c = 0; c < 3; ++c )
+        _counters[c].assign( _num_layers * _layer_size, 0 );
+}
+
+bool dbGCellResources::operator==( const dbGCellResources & rhs ) const
+{
+    if ( _num_layers != rhs._num_layers )
+        return false;
+
+    if ( _num_cols != rhs._num_cols )
+        return false;
+
+    if ( _num_rows != rhs._num_rows )
+        return false;
+
+    int c;
+    for( c = 0; c < 3; ++c )
+        if ( _counters[c] != rhs._counters[c] )
+            return false;
+
+    return true;
+}
+
+static const char * counterName( int c )
+{
+    switch( c )
+    {
+        case dbGCellResources::CAPACITY:
+            return "capacity";
+        case dbGCellResources::USAGE:
+            return "usage";
+        default:
+            return "blockage";
+    }
+}
+
+void dbGCellResources::differences( dbDiff & diff, const char * field, const dbGCellResources & rhs ) const
+{
+    if ( field )
+        diff.begin_object("<> %s\n", field );
+    else
+        diff.begin_object("<> dbGCellResources\n");
+
+    DIFF_FIELD(_num_layers);
+    DIFF_FIELD(_num_cols);
+    DIFF_FIELD(_num_rows);
+
+    // The gcells are only comparable if the dimensions are the same.
+    if ( (_num_layers == rhs._num_layers) && (_num_cols == rhs._num_cols)
+         && (_num_rows == rhs._num_rows) )
+    {
+        int c;
+        for( c = 0; c < 3; ++c )
+        {
+            if ( _counters[c] == rhs._counters[c] )
+                continue;
+
+            uint level, col, row;
+            for( level = 1; level <= _num_layers; ++level )
+                for( row = 0; row < _num_rows; ++row )
+                    for( col = 0; col < _num_cols; ++col )
+                    {
+                        uint lhs_value = get( (Counter) c, level, col, row );
+                        uint rhs_value = rhs.get( (Counter) c, level, col, row );
+
+                        if ( lhs_value != rhs_value )
+                        {
+                            diff.report("< %s[%d][%d,%d] = %u\n", counterName(c), level, col, row, lhs_value );
+                            diff.report("> %s[%d][%d,%d] = %u\n", counterName(c), level, col, row, rhs_value );
+                        }
+                    }
+        }
+    }
+
+    diff.end_object();
+}
+
+void dbGCellResources::out( dbDiff & diff, char side, const char * field ) const
+{
+    if ( field )
+        diff.begin_object("%c %s\n", side, field );
+    else
+        diff.begin_object("%c dbGCellResources\n", side);
+
+    DIFF_OUT_FIELD(_num_layers);
+    DIFF_OUT_FIELD(_num_cols);
+    DIFF_OUT_FIELD(_num_rows);
+
+    // zero counters are not written
+    int c;
+    for( c = 0; c < 3; ++c )
+    {
+        uint level, col, row;
+        for( level = 1; level <= _num_layers; ++level )
+            for( row = 0; row < _num_rows; ++row )
+                for( col = 0; col < _num_cols; ++col )
+                {
+                    uint value = get( (Counter) c, level, col, row );
+
+                    if ( value )
+                        diff.report("%c %s[%d][%d,%d] = %u\n", side, counterName(c), level, col, row, value );
+                }
+    }
+
+    diff.end_object();
+}
+
+dbOStream & operator<<( dbOStream & stream, const dbGCellResources & r )
+{
+    stream << r._num_layers;
+    stream << r._num_cols;
+    stream << r._num_rows;
+
+    int c;
+    for( c = 0; c < 3; ++c )
+    {
+        uint i;
+        uint n = r._counters[c].size();
+
+        for( i = 0; i < n; ++i )
+            stream << r._counters[c][i];
+    }
+
+    return stream;
+}
+
+dbIStream & operator>>( dbIStream & stream, dbGCellResources & r )
+{
+    uint num_layers, num_cols, num_rows;
+    stream >> num_layers;
+    stream >> num_cols;
+    stream >> num_rows;
+    r.init( num_layers, num_cols, num_rows );
+
+    int c;
+    for( c = 0; c < 3; ++c )
+    {
+        uint i;
+        uint n = r._counters[c].size();
+
+        for( i = 0; i < n; ++i )
+            stream >> r._counters[c][i];
+    }
+
+    return stream;
+}
+
+} // namespace
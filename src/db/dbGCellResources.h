@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_GCELL_RESOURCES_H
+#define ADS_DB_GCELL_RESOURCES_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#include <vector>
+#include <limits.h>
+
+namespace odb {
+
+class dbIStream;
+class dbOStream;
+class dbDiff;
+
+//
+// dbGCellResources - Per-gcell routing resources of the routing layers of a
+// gcell grid: track capacity, track usage and blocked tracks.
+//
+// The counters are 32-bit, so removing a usage that was added restores the
+// counter exactly (a counter is clamped to zero if more is removed than was
+// added). Each layer is stored as tiles of TILE x TILE gcells, row-major
+// inside a tile, so that a window of neighbouring gcells is a few contiguous
+// runs of memory.
+//
+class dbGCellResources
+{
+  public:
+    enum Counter
+    {
+        CAPACITY = 0,
+        USAGE    = 1,
+        BLOCKAGE = 2
+    };
+
+    enum { TILE_SHIFT = 3, TILE = 1 << TILE_SHIFT, TILE_MASK = TILE - 1 };
+
+    // PERSISTANT-MEMBERS
+    uint                          _num_layers;  // routing levels 1..._num_layers
+    uint                          _num_cols;
+    uint                          _num_rows;
+    std::vector<uint>             _counters[3];
+
+    // NON-PERSISTANT-MEMBERS
+    uint                          _tiles_x;
+    uint                          _layer_size;
+
+    dbGCellResources();
+    void init( uint num_layers, uint num_cols, uint num_rows );
+
+    // level is the routing level of the layer (1..._num_layers)
+    uint index( uint level, uint col, uint row ) const
+    {
+        uint tile = (row >> TILE_SHIFT) * _tiles_x + (col >> TILE_SHIFT);
+        return (level - 1) * _layer_size
+               + (tile << (2 * TILE_SHIFT))
+               + ((row & TILE_MASK) << TILE_SHIFT)
+               + (col & TILE_MASK);
+    }
+
+    bool valid( uint level, int col, int row ) const
+    {
+        return (level >= 1) && (level <= _num_layers)
+               && (col >= 0) && ((uint) col < _num_cols)
+               && (row >= 0) && ((uint) row < _num_rows);
+    }
+
+    uint get( Counter c, uint level, uint col, uint row ) const
+    {
+        return _counters[c][ index(level, col, row) ];
+    }
+
+    void set( Counter c, uint level, uint col, uint row, uint value )
+    {
+        _counters[c][ index(level, col, row) ] = value;
+    }
+
+    void add( Counter c, uint level, uint col, uint row, int delta )
+    {
+        uint & v = _counters[c][ index(level, col, row) ];
+        int64 n = (int64) v + delta;
+        v = (uint) (n < 0 ? 0 : (n > UINT_MAX ? UINT_MAX : n));
+    }
+
+    bool operator==( const dbGCellResources & rhs ) const;
+    bool operator!=( const dbGCellResources & rhs ) const { return ! operator==(rhs); }
+    void differences( dbDiff & diff, const char * field, const dbGCellResources & rhs ) const;
+    void out( dbDiff & diff, char side, const char * field ) const;
+};
+
+dbOStream & operator<<( dbOStream & stream, const dbGCellResources & r );
+dbIStream & operator>>( dbIStream & stream, dbGCellResources & r );
+
+} // namespace
+
+#endif
@@ -0,0 +1,229 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbGridAxis.h"
+#include <algorithm>
+#include <limits.h>
+
+namespace odb {
+
+void dbGridAxis::build( const dbVector<int> & origin, const dbVector<int> & count, const dbVector<int> & step )
+{
+    _patterns.clear();
+    _coords.clear();
+    _merged = false;
+    _count = 0;
+
+    uint i;
+
+    for( i = 0; i < origin.size(); ++i )
+    {
+        if ( count[i] <= 0 )
+            continue;
+
+        Pattern p;
+        p._count = count[i];
+        p._step = step[i];
+
+        if ( (p._count == 1) || (p._step == 0) )
+        {
+            p._count = 1;
+            p._step = 0;
+        }
+
+        int64 last = (int64) origin[i] + (int64) (p._count - 1) * p._step;
+
+        if ( p._step < 0 )
+        {
+            p._first = (int) last;
+            p._last = origin[i];
+            p._step = -p._step;
+        }
+        else
+        {
+            p._first = origin[i];
+            p._last = (int) last;
+        }
+
+        _patterns.push_back(p);
+    }
+
+    std::sort( _patterns.begin(), _patterns.end() );
+
+    std::vector<Pattern>::iterator itr;
+    int64 next_first = 0;
+    bool overlap = false;
+
+    for( itr = _patterns.begin(); itr != _patterns.end(); ++itr )
+    {
+        if ( (itr != _patterns.begin()) && (itr->_first < next_first) )
+            overlap = true;
+
+        next_first = (int64) itr->_last + 1;
+        itr->_index = _count;
+        _count += itr->_count;
+    }
+
+    if ( ! overlap )
+        return;
+
+    // Interleaved or overlapping patterns, merge the coordinates.
+    for( itr = _patterns.begin(); itr != _patterns.end(); ++itr )
+    {
+        int j;
+        int c = itr->_first;
+
+        for( j = 0; j < itr->_count; ++j, c += itr->_step )
+            _coords.push_back(c);
+    }
+
+    std::sort( _coords.begin(), _coords.end() );
+    _coords.erase( std::unique( _coords.begin(), _coords.end() ), _coords.end() );
+    _count = _coords.size();
+    _merged = true;
+    _patterns.clear();
+}
+
+// Returns the pattern of the last _first <= coord, _patterns must not be empty
+// and coord >= _patterns[0]._first.
+const dbGridAxis::Pattern & dbGridAxis::findPattern( int coord ) const
+{
+    uint lo = 0;
+    uint hi = _patterns.size();
+
+    while( hi - lo > 1 )
+    {
+        uint mid = (lo + hi) / 2;
+
+        if ( _patterns[mid]._first <= coord )
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    return _patterns[lo];
+}
+
+int dbGridAxis::getCoord( int idx ) const
+{
+    ZASSERT( (idx >= 0) && (idx < _count) );
+
+    if ( _merged )
+        return _coords[idx];
+
+    uint lo = 0;
+    uint hi = _patterns.size();
+
+    while( hi - lo > 1 )
+    {
+        uint mid = (lo + hi) / 2;
+
+        if ( _patterns[mid]._index <= idx )
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    const Pattern & p = _patterns[lo];
+    return p._first + (idx - p._index) * p._step;
+}
+
+int dbGridAxis::findIndex( int coord ) const
+{
+    if ( _merged )
+        return (int) (std::upper_bound( _coords.begin(), _coords.end(), coord ) - _coords.begin()) - 1;
+
+    if ( _patterns.empty() || (coord < _patterns[0]._first) )
+        return -1;
+
+    const Pattern & p = findPattern(coord);
+
+    if ( coord >= p._last )
+        return p._index + p._count - 1;
+
+    return p._index + (int) (((int64) coord - p._first) / p._step);
+}
+
+int dbGridAxis::findNearest( int coord ) const
+{
+    if ( _count == 0 )
+        return -1;
+
+    int idx = findIndex(coord);
+
+    if ( idx < 0 )
+        return 0;
+
+    if ( idx == _count - 1 )
+        return idx;
+
+    int64 below = (int64) coord - getCoord(idx);
+    int64 above = (int64) getCoord(idx + 1) - coord;
+    return (above < below) ? idx + 1 : idx;
+}
+
+// Index of the first coordinate >= coord, getCount() if there is none.
+int dbGridAxis::findFirst( int coord ) const
+{
+    if ( coord == INT_MIN )
+        return 0;
+
+    return findIndex(coord - 1) + 1;
+}
+
+void dbGridAxis::findRange( int lo, int hi, int & first, int & end ) const
+{
+    first = findFirst(lo);
+    end = (hi <= lo) ? first : findFirst(hi);
+}
+
+void dbGridAxis::getCoords( std::vector<int> & coords ) const
+{
+    if ( _merged )
+    {
+        coords.insert( coords.end(), _coords.begin(), _coords.end() );
+        return;
+    }
+
+    coords.reserve( coords.size() + _count );
+    std::vector<Pattern>::const_iterator itr;
+
+    for( itr = _patterns.begin(); itr != _patterns.end(); ++itr )
+    {
+        int j;
+        int c = itr->_first;
+
+        for( j = 0; j < itr->_count; ++j, c += itr->_step )
+            coords.push_back(c);
+    }
+}
+
+} // namespace
@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_GRID_AXIS_H
+#define ADS_DB_GRID_AXIS_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#ifndef ADS_ZEXCEPTION_H
+#include "ZException.h"
+#endif
+
+#ifndef ADS_DB_VECTOR_H
+#include "dbVector.h"
+#endif
+
+#include <vector>
+
+namespace odb {
+
+//
+// dbGridAxis - Compiled form of the (origin, count, step) patterns of one
+// axis of a track or gcell grid.
+//
+// The coordinates of the axis are the sorted, unique union of the patterns
+// (see dbTrackGrid::getGridX). When the patterns do not overlap, they are
+// kept sorted with the index of their first coordinate, so index <-> coord
+// lookups are a binary search over the patterns. Overlapping patterns are
+// merged into an explicit coordinate list instead.
+//
+class dbGridAxis
+{
+    struct Pattern
+    {
+        int _first;  // lowest coordinate
+        int _last;   // highest coordinate
+        int _step;   // > 0, or 0 if _count == 1
+        int _count;
+        int _index;  // index of _first in the axis
+
+        bool operator<( const Pattern & p ) const { return _first < p._first; }
+    };
+
+    std::vector<Pattern> _patterns;
+    std::vector<int>     _coords;   // used if _merged
+    bool                 _merged;
+    int                  _count;
+
+    const Pattern & findPattern( int coord ) const;
+    int findFirst( int coord ) const;
+
+  public:
+    dbGridAxis() : _merged(false), _count(0) {}
+
+    void build( const dbVector<int> & origin, const dbVector<int> & count, const dbVector<int> & step );
+
+    // Number of coordinates.
+    int getCount() const { return _count; }
+
+    // Coordinate of index idx, 0 <= idx < getCount().
+    int getCoord( int idx ) const;
+
+    // Index of the last coordinate <= coord, -1 if there is none.
+    int findIndex( int coord ) const;
+
+    // Index of the coordinate nearest to coord (the lower one on a tie),
+    // -1 if the axis is empty.
+    int findNearest( int coord ) const;
+
+    // The coordinates in [lo, hi) are the indexes [first, end).
+    void findRange( int lo, int hi, int & first, int & end ) const;
+
+    // Append all the coordinates in ascending order.
+    void getCoords( std::vector<int> & coords ) const;
+};
+
+} // namespace
+
+#endif
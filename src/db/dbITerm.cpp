@@ -39,6 +39,7 @@
 #include "dbNet.h"
 #include "dbLib.h"
 #include "dbMaster.h"
+#include "dbMasterShapeCache.h"
 #include "dbMTerm.h"
 #include "dbBlock.h"
 #include "dbBlockCallBackObj.h"
@@ -513,6 +514,7 @@ dbITerm::disconnect( dbITerm * iterm_ )
         block->_journal->beginAction( dbJournal::DISCONNECT_OBJECT );
         block->_journal->pushParam( dbITermObj );
         block->_journal->pushParam( iterm_->getId() );
+        block->_journal->pushParam( net->getId() );
         block->_journal->endAction();
     }
 
@@ -613,31 +615,21 @@ dbITerm::getITerm( dbBlock * block_, uint dbid )
 bool
 dbITerm::getAvgXY( int *x, int *y)
 {
-    dbMTerm *mterm = getMTerm(); 
     int nn = 0; 
     double xx=0.0, yy=0.0; 
     int px,py; 
     dbInst *inst = getInst(); 
     inst->getOrigin(px,py); 
-    adsPoint origin = adsPoint(px,py); 
-    dbOrientType orient = inst->getOrient(); 
-    dbTransform transform( orient, origin );
-
-
-    dbSet<dbMPin> mpins = mterm->getMPins(); 
-    dbSet<dbMPin>::iterator mpin_itr; 
-    for (mpin_itr = mpins.begin(); mpin_itr != mpins.end(); mpin_itr++) { 
-        dbMPin *mpin = *mpin_itr; 
-        dbSet<dbBox> boxes = mpin->getGeometry(); 
-        dbSet<dbBox>::iterator box_itr; 
-        for (box_itr = boxes.begin(); box_itr != boxes.end(); box_itr++) { 
-            dbBox * box = *box_itr; adsRect rect; 
-            box->getBox( rect ); 
-            transform.apply( rect ); 
-            xx += rect.xMin()+rect.xMax(); 
-            yy += rect.yMin()+rect.yMax(); 
-            nn += 2; 
-        } 
+    _dbMaster * master = (_dbMaster *) inst->getMaster();
+    const dbMasterShapeTable * table = master->getShapeCache()->getTable( inst->getOrient() );
+    uint idx = getMTerm()->getIndex();
+    const _dbMasterShape * s = table->pinsBegin(false, idx);
+    const _dbMasterShape * e = table->pinsEnd(false, idx);
+
+    for ( ; s != e; ++s ) {
+        xx += s->_rect.xMin()+s->_rect.xMax()+2*px; 
+        yy += s->_rect.yMin()+s->_rect.yMax()+2*py; 
+        nn += 2; 
     } 
     if (!nn) { 
         warning(0, "Can not find physical location of iterm %s/%s\n", 
@@ -649,6 +641,24 @@ dbITerm::getAvgXY( int *x, int *y)
     *y = int(yy); 
     return true;
 }
+
+bool dbITerm::getBBox( adsRect & bbox )
+{
+    int px,py; 
+    dbInst *inst = getInst(); 
+    inst->getOrigin(px,py); 
+    _dbMaster * master = (_dbMaster *) inst->getMaster();
+    const dbMasterShapeTable * table = master->getShapeCache()->getTable( inst->getOrient() );
+    uint idx = getMTerm()->getIndex();
+
+    if ( ! table->_mterm_has_bbox[idx] )
+        return false;
+
+    const adsRect & r = table->_mterm_bbox[idx];
+    bbox.init( r.xMin() + px, r.yMin() + py, r.xMax() + px, r.yMax() + py );
+    return true;
+}
+
 void dbITerm::print(FILE *fp, const char *trail)
 {
 	if (fp==NULL)
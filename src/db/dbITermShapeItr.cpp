@@ -30,6 +30,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "dbShape.h"
+#include "dbMaster.h"
+#include "dbMasterShapeCache.h"
 #include "db.h"
 #include "ZException.h"
 
@@ -38,6 +40,8 @@ namespace odb {
 dbITermShapeItr::dbITermShapeItr( bool expand_vias )
 {
     _iterm = NULL;
+    _cur = NULL;
+    _end = NULL;
     _expand_vias = expand_vias;
 }
 
@@ -45,123 +49,24 @@ void dbITermShapeItr::begin( dbITerm * iterm )
 {
     _iterm = iterm;
     dbInst * inst = iterm->getInst();
-    _mterm = iterm->getMTerm();
-    int x, y;
-    inst->getOrigin(x,y);
-    _transform = dbTransform( inst->getOrient(), adsPoint(x,y) );
-    _state = 0;
+    inst->getOrigin(_x,_y);
+    _dbMaster * master = (_dbMaster *) inst->getMaster();
+    const dbMasterShapeTable * table = master->getShapeCache()->getTable( inst->getOrient() );
+    uint idx = iterm->getMTerm()->getIndex();
+    _cur = table->pinsBegin(_expand_vias, idx);
+    _end = table->pinsEnd(_expand_vias, idx);
 }
 
-void dbITermShapeItr::getShape( dbBox * box, dbShape & shape )
-{
-    adsRect r;
-    box->getBox( r );
-    _transform.apply( r );
-
-    dbTechVia * via = box->getTechVia();
-
-    if ( via )
-        shape.setVia(via,r);
-    else
-        shape.setSegment(box->getTechLayer(),r);
-}
-
-#define INIT         0
-#define MPIN_ITR     1
-#define MBOX_ITR     2
-#define VIA_BOX_ITR  3
-
 bool dbITermShapeItr::next( dbShape & shape )
 {
     ZASSERT( _iterm );
 
-  next_state:
-
-    switch( _state )
-    {
-        case INIT:
-        {
-            _mpins = _mterm->getMPins();
-            _mpin_itr = _mpins.begin();
-            _state = MPIN_ITR;
-            goto next_state;
-        }
-            
-        case MPIN_ITR:
-        {
-            if ( _mpin_itr == _mpins.end() )
-                return false;
-            else
-            {
-                _mpin = *_mpin_itr;
-                ++_mpin_itr;
-                _boxes = _mpin->getGeometry();
-                _box_itr = _boxes.begin();
-                _state = MBOX_ITR;
-            }
+    if ( _cur == _end )
+        return false;
 
-            goto next_state;
-        }
-
-        case MBOX_ITR:
-        {
-            if ( _box_itr == _boxes.end() )
-                _state = MPIN_ITR;
-            else
-            {
-                dbBox * box = *_box_itr;
-                ++_box_itr;
-
-                if ( (_expand_vias == false) || (box->isVia() == false) )
-                {
-                    getShape(box,shape);
-                    return true;
-                }
-                
-                else
-                {
-                    box->getViaXY(_via_x,_via_y);
-                    _via = box->getTechVia();
-                    assert(_via);
-                    _via_boxes = _via->getBoxes();
-                    _via_box_itr = _via_boxes.begin();
-                    _state = VIA_BOX_ITR;
-                }
-            }
-            
-            goto next_state;
-        }
-
-        case VIA_BOX_ITR:
-        {
-            if ( _via_box_itr == _via_boxes.end() )
-                _state = MBOX_ITR;
-            else
-            {
-                dbBox * box = *_via_box_itr;
-                ++_via_box_itr;
-                getViaBox(box,shape);
-                return true;
-            }
-            
-            goto next_state;
-        }
-    }
-
-    return false;
-}
-
-void dbITermShapeItr::getViaBox( dbBox * box, dbShape & shape )
-{
-    adsRect b;
-    box->getBox(b);
-    int xmin = b.xMin() + _via_x;
-    int ymin = b.yMin() + _via_y;
-    int xmax = b.xMax() + _via_x;
-    int ymax = b.yMax() + _via_y;
-    adsRect r(xmin, ymin, xmax, ymax);
-    _transform.apply( r );
-    shape.setViaBox( _via, box->getTechLayer(), r );
+    _cur->getShape(_x, _y, shape);
+    ++_cur;
+    return true;
 }
 
 } // namespace
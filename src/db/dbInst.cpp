@@ -49,11 +49,13 @@
 #include "dbBlockCallBackObj.h"
 #include "dbSet.h"
 #include "dbJournal.h"
+#include "dbProperty.h"
 #include "dbTable.h"
 #include "dbTable.hpp"
 #include "dbArrayTable.h"
 #include "dbArrayTable.hpp"
 #include "dbDiff.hpp"
+#include "dbParallel.h"
 #include "db.h"
 #include <algorithm>
 
@@ -88,19 +90,17 @@ public:
     }
 };
 
-#define FLAGS(inst) (*((uint *) &inst->_flags))
-
-static void setInstBBox( _dbInst * inst )
+void _dbInst::setInstBBox( _dbInst * inst )
 {
     _dbBlock * block = (_dbBlock *) inst->getOwner();
     _dbBox * box = block->_box_tbl->getPtr(inst->_bbox);
-    block->remove_rect( box->_rect );
+    adsRect prev_rect = box->_rect;
 
     dbMaster * master = ((dbInst *) inst)->getMaster();
     master->getPlacementBoundary(box->_rect);
     dbTransform transform( inst->_flags._orient, adsPoint(inst->_x, inst->_y) );
     transform.apply( box->_rect );
-    block->add_rect( box->_rect );
+    block->move_rect( prev_rect, box->_rect );
 }
 
 _dbInst::_dbInst( _dbDatabase * )
@@ -158,8 +158,7 @@ _dbInst::~_dbInst()
 
 dbOStream & operator<<( dbOStream & stream,  const _dbInst & inst )
 {
-    uint * bit_field = (uint *) &inst._flags;
-    stream << *bit_field;
+    stream << inst.getFlagWord();
     stream << inst._name;
     stream << inst._x;
     stream << inst._y;
@@ -178,8 +177,9 @@ dbOStream & operator<<( dbOStream & stream,  const _dbInst & inst )
 
 dbIStream & operator>>( dbIStream & stream, _dbInst & inst )
 {
-    uint * bit_field = (uint *) &inst._flags;
-    stream >> *bit_field;
+    uint flags;
+    stream >> flags;
+    inst.setFlagWord(flags);
     stream >> inst._name;
     stream >> inst._x;
     stream >> inst._y;
@@ -460,7 +460,7 @@ void dbInst::setOrigin( int x, int y )
     
     inst->_x = x;
     inst->_y = y;
-    setInstBBox(inst);
+    _dbInst::setInstBBox(inst);
 
     if ( block->_journal )
     {
@@ -525,19 +525,21 @@ void dbInst::setOrient( dbOrientType orient )
 {
     _dbInst * inst = (_dbInst *) this;
     _dbBlock * block = (_dbBlock *) getOwner();
-#ifdef FULL_ECO
-    uint prev_flags = FLAGS(inst);
-#endif
+    uint prev_flags = inst->getFlagWord();
     inst->_flags._orient = orient.getValue();
-    setInstBBox(inst);
+    _dbInst::setInstBBox(inst);
 
+    // Flag changes are part of an eco only with FULL_ECO, snapshots always
+    // record them.
 #ifdef FULL_ECO
     if ( block->_journal )
+#else
+    if ( block->_journal && block->_snapshot )
+#endif
     {
         debug("DB_ECO","A","ECO: setOrient %d\n",orient.getValue());
-        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, FLAGS(inst) );
+        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, inst->getFlagWord() );
     }
-#endif
 
     std::list<dbBlockCallBackObj *>::iterator  cbitr;
     for (cbitr = block->_callbacks.begin(); cbitr !=  block->_callbacks.end(); ++cbitr)
@@ -553,17 +555,19 @@ dbPlacementStatus dbInst::getPlacementStatus()
 void dbInst::setPlacementStatus( dbPlacementStatus status )
 {
     _dbInst * inst = (_dbInst *) this;
-    //_dbBlock * block = (_dbBlock *) getOwner();
-    //uint prev_flags = FLAGS(inst);
+    _dbBlock * block = (_dbBlock *) getOwner();
+    uint prev_flags = inst->getFlagWord();
     inst->_flags._status = status.getValue();
 
 #ifdef FULL_ECO
     if ( block->_journal )
+#else
+    if ( block->_journal && block->_snapshot )
+#endif
     {
         debug("DB_ECO","A","ECO: setPlacementStatus %d\n",status.getValue());
-        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, FLAGS(inst) );
+        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, inst->getFlagWord() );
     }
-#endif
 }
 
 void dbInst::getTransform( dbTransform & t )
@@ -644,7 +648,7 @@ void dbInst::setEcoCreate(bool v)
 {
     _dbInst * inst = (_dbInst *) this;
     // _dbBlock * block = (_dbBlock *) getOwner();
-    // uint prev_flags = FLAGS(inst);
+    // uint prev_flags = inst->getFlagWord();
 	if (v)
 		inst->_flags._eco_create = 1;
 	else
@@ -659,7 +663,7 @@ void dbInst::setEcoDestroy(bool v)
 {
     _dbInst * inst = (_dbInst *) this;
     // _dbBlock * block = (_dbBlock *) getOwner();
-    // uint prev_flags = FLAGS(inst);
+    // uint prev_flags = inst->getFlagWord();
 	if (v)
 		inst->_flags._eco_destroy = 1;
 	else
@@ -674,7 +678,7 @@ void dbInst::setEcoModify(bool v)
 {
     _dbInst * inst = (_dbInst *) this;
     // _dbBlock * block = (_dbBlock *) getOwner();
-    // uint prev_flags = FLAGS(inst);
+    // uint prev_flags = inst->getFlagWord();
 	if (v)
 		inst->_flags._eco_modify = 1;
 	else
@@ -690,12 +694,12 @@ void dbInst::setUserFlag1()
 {
     _dbInst * inst = (_dbInst *) this;
     //_dbBlock * block = (_dbBlock *) getOwner();
-    //uint prev_flags = FLAGS(inst);
+    //uint prev_flags = inst->getFlagWord();
     inst->_flags._user_flag_1 = 1;
 
 #ifdef FULL_ECO
     if ( block->_journal )
-        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, FLAGS(inst) );
+        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, inst->getFlagWord() );
 #endif
 }
 
@@ -703,12 +707,12 @@ void dbInst::clearUserFlag1()
 {
     _dbInst * inst = (_dbInst *) this;
     //_dbBlock * block = (_dbBlock *) getOwner();
-    //uint prev_flags = FLAGS(inst);
+    //uint prev_flags = inst->getFlagWord();
     inst->_flags._user_flag_1 = 0;
 
 #ifdef FULL_ECO
     if ( block->_journal )
-        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, FLAGS(inst) );
+        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, inst->getFlagWord() );
 #endif
 }
 
@@ -722,12 +726,12 @@ void dbInst::setUserFlag2()
 {
     _dbInst * inst = (_dbInst *) this;
     //_dbBlock * block = (_dbBlock *) getOwner();
-    //uint prev_flags = FLAGS(inst);
+    //uint prev_flags = inst->getFlagWord();
     inst->_flags._user_flag_2 = 1;
 
 #ifdef FULL_ECO
     if ( block->_journal )
-        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, FLAGS(inst) );
+        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, inst->getFlagWord() );
 #endif
 }
 
@@ -735,12 +739,12 @@ void dbInst::clearUserFlag2()
 {
     _dbInst * inst = (_dbInst *) this;
     //_dbBlock * block = (_dbBlock *) getOwner();
-    //uint prev_flags = FLAGS(inst);
+    //uint prev_flags = inst->getFlagWord();
     inst->_flags._user_flag_2 = 0;
 
 #ifdef FULL_ECO
     if ( block->_journal )
-        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, FLAGS(inst) );
+        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, inst->getFlagWord() );
 #endif
 }
 
@@ -754,12 +758,12 @@ void dbInst::setUserFlag3()
 {
     _dbInst * inst = (_dbInst *) this;
     //_dbBlock * block = (_dbBlock *) getOwner();
-    //uint prev_flags = FLAGS(inst);
+    //uint prev_flags = inst->getFlagWord();
     inst->_flags._user_flag_3 = 1;
 
 #ifdef FULL_ECO
     if ( block->_journal )
-        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, FLAGS(inst) );
+        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, inst->getFlagWord() );
 #endif
 }
 
@@ -767,12 +771,12 @@ void dbInst::clearUserFlag3()
 {
     _dbInst * inst = (_dbInst *) this;
     //_dbBlock * block = (_dbBlock *) getOwner();
-    //uint prev_flags = FLAGS(inst);
+    //uint prev_flags = inst->getFlagWord();
     inst->_flags._user_flag_3 = 0;
 
 #ifdef FULL_ECO
     if ( block->_journal )
-        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, FLAGS(inst) );
+        block->_journal->updateField( this, _dbInst::FLAGS, prev_flags, inst->getFlagWord() );
 #endif
 }
 
@@ -1244,18 +1248,6 @@ dbInst::create( dbBlock * block_, dbMaster * master_, const char * name_, dbRegi
     if ( block->_inst_hash.hasMember(name_) )
         return NULL;
 
-    if ( block->_journal )
-    {
-        debug("DB_ECO","A","ECO: dbInst:create\n");
-        dbLib * lib = master_->getLib();
-        block->_journal->beginAction( dbJournal::CREATE_OBJECT );
-        block->_journal->pushParam( dbInstObj );
-        block->_journal->pushParam( lib->getId() );
-        block->_journal->pushParam( master_->getId() );
-        block->_journal->pushParam( name_ );
-        block->_journal->endAction();
-    }
-    
     _dbInst * inst = block->_inst_tbl->create();
     inst->_name = strdup(name_);
     ZALLOCATED(inst->_name);
@@ -1284,6 +1276,25 @@ dbInst::create( dbBlock * block_, dbMaster * master_, const char * name_, dbRegi
 
     block->add_rect( box->_rect );
 
+    if ( block->_journal )
+    {
+        debug("DB_ECO","A","ECO: dbInst:create\n");
+        dbLib * lib = master_->getLib();
+        block->_journal->beginAction( dbJournal::CREATE_OBJECT );
+        block->_journal->pushParam( dbInstObj );
+        block->_journal->pushParam( lib->getId() );
+        block->_journal->pushParam( master_->getId() );
+        block->_journal->pushParam( name_ );
+        block->_journal->pushParam( inst->getOID() );
+        block->_journal->pushParam( box->getOID() );
+        block->_journal->pushParam( mterm_cnt );
+
+        for( i = 0; i < mterm_cnt; ++i )
+            block->_journal->pushParam( inst->_iterms[i] );
+
+        block->_journal->endAction();
+    }
+
     if ( region )
     {
         region->addInst((dbInst *) inst);
@@ -1323,6 +1334,27 @@ dbInst::destroy( dbInst * inst_ )
     uint i;
     uint n = inst->_iterms.size();
 
+    // The journal keeps the state of the instance and its iterms, so the
+    // deletion can be undone. The iterms are destroyed before it is logged.
+    std::vector<uint> iterm_state;
+    bool restorable = false;
+
+    if ( block->_journal )
+    {
+        restorable = (inst->_hierarchy == 0) && (inst->_halo == 0)
+            && ! _dbProperty::hasProperties(inst)
+            && ! _dbProperty::hasProperties( block->_box_tbl->getPtr(inst->_bbox) );
+
+        for( i = 0; i < n; ++i )
+        {
+            _dbITerm * it = block->_iterm_tbl->getPtr( inst->_iterms[i] );
+            restorable = restorable && ! _dbProperty::hasProperties(it);
+            iterm_state.push_back( it->getOID() );
+            iterm_state.push_back( *(uint *) &it->_flags );
+            iterm_state.push_back( it->_ext_id );
+        }
+    }
+
     for( i = 0; i < n; ++i )
     {
         dbId<_dbITerm> id = inst->_iterms[i];
@@ -1352,9 +1384,25 @@ dbInst::destroy( dbInst * inst_ )
     if ( block->_journal )
     {
         debug("DB_ECO","A","ECO: dbInst:destroy\n");
+        dbMaster * master = inst_->getMaster();
         block->_journal->beginAction( dbJournal::DELETE_OBJECT );
         block->_journal->pushParam( dbInstObj );
         block->_journal->pushParam( inst->getId() );
+        block->_journal->pushParam( restorable );
+        block->_journal->pushParam( master->getLib()->getId() );
+        block->_journal->pushParam( master->getId() );
+        block->_journal->pushParam( inst->_name );
+        block->_journal->pushParam( *(uint *) &inst->_flags );
+        block->_journal->pushParam( inst->_x );
+        block->_journal->pushParam( inst->_y );
+        block->_journal->pushParam( inst->_weight );
+        block->_journal->pushParam( region ? region->getId() : 0U );
+        block->_journal->pushParam( inst->_bbox.id() );
+        block->_journal->pushParam( n );
+
+        for( i = 0; i < iterm_state.size(); ++i )
+            block->_journal->pushParam( iterm_state[i] );
+
         block->_journal->endAction();
     }
 
@@ -1403,6 +1451,160 @@ dbInst::getInst( dbBlock * block_, uint dbid_ )
     return (dbInst *) block->_inst_tbl->getPtr(dbid_);
 }
 
+bool
+dbInst::setLocations( dbBlock * block_,
+                      uint cnt,
+                      const uint * inst_ids,
+                      const int * x,
+                      const int * y,
+                      const dbOrientType::Value * orients,
+                      uint threads )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+    _dbDatabase * db = block->getDatabase();
+
+    if ( cnt == 0 )
+        return true;
+
+    // The instances are moved in parallel, each one must be a distinct
+    // instance of the block.
+    std::vector<char> seen( block->_inst_tbl->_top_idx + 1, 0 );
+    uint i;
+
+    for( i = 0; i < cnt; ++i )
+    {
+        uint id = inst_ids[i];
+
+        if ( ! block->_inst_tbl->validId(id) )
+        {
+            warning(0, "setLocations: %d is not an instance id\n", id);
+            return false;
+        }
+
+        if ( seen[id] )
+        {
+            warning(0, "setLocations: instance id %d appears more than once\n", id);
+            return false;
+        }
+
+        seen[id] = 1;
+    }
+
+    // Flag changes are part of an eco only with FULL_ECO, snapshots always
+    // record them (as in setOrient).
+#ifdef FULL_ECO
+    bool journal_flags = block->_journal != NULL;
+#else
+    bool journal_flags = (block->_journal != NULL) && (block->_snapshot != NULL);
+#endif
+
+    // previous origin and flags, for the journal
+    std::vector<int> prev_x;
+    std::vector<int> prev_y;
+    std::vector<uint> prev_flags;
+
+    if ( block->_journal )
+    {
+        prev_x.resize(cnt);
+        prev_y.resize(cnt);
+    }
+
+    if ( journal_flags )
+        prev_flags.resize(cnt);
+
+    // previous bboxes, for the incremental block bbox
+    bool valid_bbox = block->_flags._valid_bbox;
+    std::vector<adsRect> prev_rect;
+
+    if ( valid_bbox )
+        prev_rect.resize(cnt);
+
+    dbParallelFor( cnt, threads, [&]( uint i )
+    {
+        _dbInst * inst = block->_inst_tbl->getPtr( inst_ids[i] );
+
+        if ( block->_journal )
+        {
+            prev_x[i] = inst->_x;
+            prev_y[i] = inst->_y;
+        }
+
+        if ( journal_flags )
+            prev_flags[i] = inst->getFlagWord();
+
+        if ( orients )
+            inst->_flags._orient = orients[i];
+
+        _dbInstHdr * inst_hdr = block->_inst_hdr_tbl->getPtr(inst->_inst_hdr);
+        _dbLib * lib = db->_lib_tbl->getPtr(inst_hdr->_lib);
+        _dbMaster * master = lib->_master_tbl->getPtr(inst_hdr->_master);
+
+        // same as setLocation: the lower-left of the transformed placement
+        // boundary is moved to (x, y)
+        adsRect bbox( 0, 0, master->_width, master->_height );
+        bbox.moveDelta( master->_x, master->_y );
+        dbTransform t( inst->_flags._orient );
+        t.apply(bbox);
+        inst->_x = x[i] - bbox.xMin();
+        inst->_y = y[i] - bbox.yMin();
+
+        _dbBox * box = block->_box_tbl->getPtr(inst->_bbox);
+
+        if ( valid_bbox )
+            prev_rect[i] = box->_rect;
+
+        bbox.moveTo( x[i], y[i] );
+        box->_rect = bbox;
+    }, 256 );
+
+    if ( valid_bbox )
+    {
+        for( i = 0; (i < cnt) && block->_flags._valid_bbox; ++i )
+        {
+            _dbInst * inst = block->_inst_tbl->getPtr( inst_ids[i] );
+            _dbBox * box = block->_box_tbl->getPtr(inst->_bbox);
+            block->move_rect( prev_rect[i], box->_rect );
+        }
+    }
+
+    if ( block->_journal )
+    {
+        debug("DB_ECO","A","ECO: setLocations %u\n",cnt);
+
+        for( i = 0; i < cnt; ++i )
+        {
+            _dbInst * inst = block->_inst_tbl->getPtr( inst_ids[i] );
+
+            if ( journal_flags && (prev_flags[i] != inst->getFlagWord()) )
+                block->_journal->updateField( (dbInst *) inst, _dbInst::FLAGS, prev_flags[i], inst->getFlagWord() );
+
+            block->_journal->beginAction( dbJournal::UPDATE_FIELD );
+            block->_journal->pushParam( inst->getObjectType() );
+            block->_journal->pushParam( inst->getId() );
+            block->_journal->pushParam( _dbInst::ORIGIN );
+            block->_journal->pushParam( prev_x[i] );
+            block->_journal->pushParam( prev_y[i] );
+            block->_journal->pushParam( inst->_x );
+            block->_journal->pushParam( inst->_y );
+            block->_journal->endAction();
+        }
+    }
+
+    if ( ! block->_callbacks.empty() )
+    {
+        std::vector<dbInst *> insts( cnt );
+
+        for( i = 0; i < cnt; ++i )
+            insts[i] = (dbInst *) block->_inst_tbl->getPtr( inst_ids[i] );
+
+        std::list<dbBlockCallBackObj *>::iterator  cbitr;
+        for (cbitr = block->_callbacks.begin(); cbitr !=  block->_callbacks.end(); ++cbitr)
+            (**cbitr)().inDbMoveInsts(insts);
+    }
+
+    return true;
+}
+
 dbInst *
 dbInst::getValidInst( dbBlock * block_, uint dbid_ )
 {
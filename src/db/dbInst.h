@@ -57,6 +57,8 @@
 #include "dbDatabase.h"
 #endif
 
+#include <string.h>
+
 namespace odb {
 
 class _dbBox;
@@ -125,6 +127,19 @@ class _dbInst : public dbObject
     bool operator<( const _dbInst & rhs ) const;
     void differences( dbDiff & diff, const char * field, const _dbInst & rhs ) const;
     void out( dbDiff & diff, char side, const char * field ) const;
+
+    // Recompute the placement bbox from the origin and orientation.
+    static void setInstBBox( _dbInst * inst );
+
+    // The flags as one word (the journal FLAGS field).
+    uint getFlagWord() const
+    {
+        uint flags;
+        memcpy( &flags, &_flags, sizeof(flags) );
+        return flags;
+    }
+
+    void setFlagWord( uint flags ) { memcpy( &_flags, &flags, sizeof(flags) ); }
 };
 
 dbOStream & operator<<( dbOStream & stream,  const _dbInst & inst );
@@ -30,6 +30,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "dbShape.h"
+#include "dbMaster.h"
+#include "dbMasterShapeCache.h"
 #include "ZException.h"
 #include "db.h"
 
@@ -38,214 +40,66 @@ namespace odb {
 dbInstShapeItr::dbInstShapeItr( bool expand_vias )
 {
     _inst = NULL;
+    _cur = NULL;
+    _end = NULL;
     _expand_vias = expand_vias;
 }
 
-void dbInstShapeItr::begin( dbInst * inst, IteratorType type )
+void dbInstShapeItr::init( dbInst * inst, IteratorType type, const dbTransform & t )
 {
-    int x, y;
+    // The shapes of the master are cached per orientation, only the offset
+    // of the transform is applied per shape.
     _inst = inst;
-    _inst->getOrigin(x,y);
-    _master = _inst->getMaster();
-    _transform = dbTransform( inst->getOrient(), adsPoint(x,y) );
-    _type = type;
-    _state = 0;
-}
+    _x = t.getOffset().x();
+    _y = t.getOffset().y();
+    _dbMaster * master = (_dbMaster *) _inst->getMaster();
+    const dbMasterShapeTable * table = master->getShapeCache()->getTable( t.getOrient() );
 
-void dbInstShapeItr::begin( dbInst * inst, IteratorType type, const dbTransform & t )
-{
-    int x, y;
-    _inst = inst;
-    _inst->getOrigin(x,y);
-    _master = _inst->getMaster();
-    _transform = dbTransform( inst->getOrient(), adsPoint(x,y) );
-    _transform.concat(t);
-    _type = type;
-    _state = 0;
+    switch( type )
+    {
+        case ALL:
+            _cur = table->pinsBegin(_expand_vias, 0);
+            _end = table->obsEnd(_expand_vias);
+            break;
+
+        case PINS:
+            _cur = table->pinsBegin(_expand_vias, 0);
+            _end = table->obsBegin(_expand_vias);
+            break;
+
+        case OBSTRUCTIONS:
+            _cur = table->obsBegin(_expand_vias);
+            _end = table->obsEnd(_expand_vias);
+            break;
+    }
 }
 
-void dbInstShapeItr::getViaBox( dbBox * box, dbShape & shape )
+void dbInstShapeItr::begin( dbInst * inst, IteratorType type )
 {
-    adsRect b;
-    box->getBox(b);
-    int xmin = b.xMin() + _via_x;
-    int ymin = b.yMin() + _via_y;
-    int xmax = b.xMax() + _via_x;
-    int ymax = b.yMax() + _via_y;
-    adsRect r(xmin, ymin, xmax, ymax);
-    _transform.apply( r );
-    shape.setViaBox( _via, box->getTechLayer(), r );
+    int x, y;
+    inst->getOrigin(x,y);
+    init( inst, type, dbTransform( inst->getOrient(), adsPoint(x,y) ) );
 }
 
-void dbInstShapeItr::getShape( dbBox * box, dbShape & shape )
+void dbInstShapeItr::begin( dbInst * inst, IteratorType type, const dbTransform & t )
 {
-    adsRect r;
-    box->getBox( r );
-    _transform.apply( r );
-
-    dbTechVia * via = box->getTechVia();
-
-    if ( via )
-        shape.setVia(via,r);
-    else
-        shape.setSegment(box->getTechLayer(),r);
+    int x, y;
+    inst->getOrigin(x,y);
+    dbTransform transform( inst->getOrient(), adsPoint(x,y) );
+    transform.concat(t);
+    init( inst, type, transform );
 }
 
-#define INIT        0
-#define MTERM_ITR   1
-#define MPIN_ITR    2
-#define MBOX_ITR    3
-#define OBS_ITR     4
-#define VIA_BOX_ITR 5
-#define PINS_DONE   6
-
 bool dbInstShapeItr::next( dbShape & shape )
 {
     ZASSERT( _inst );
 
-  next_state:
-
-    switch( _state )
-    {
-        case INIT:
-        {
-            if ( _type == OBSTRUCTIONS )
-            {
-                _boxes = _master->getObstructions();
-                _box_itr = _boxes.begin();
-                _state = OBS_ITR;
-            }
-            else
-            {
-                _mterms = _master->getMTerms();
-                _mterm_itr = _mterms.begin();
-                _state = MTERM_ITR;
-            }
-            
-            goto next_state;
-        }
-            
-        case MTERM_ITR:
-        {
-            if ( _mterm_itr == _mterms.end() )
-                _state = PINS_DONE;
-            else
-            {
-                dbMTerm * mterm = *_mterm_itr;
-                ++_mterm_itr;
-                _mpins = mterm->getMPins();
-                _mpin_itr = _mpins.begin();
-                _state = MPIN_ITR;
-            }
-
-            goto next_state;
-        }
-            
-        case MPIN_ITR:
-        {
-            if ( _mpin_itr == _mpins.end() )
-                _state = MTERM_ITR;
-            else
-            {
-                _mpin = *_mpin_itr;
-                ++_mpin_itr;
-                _boxes = _mpin->getGeometry();
-                _box_itr = _boxes.begin();
-                _state = MBOX_ITR;
-            }
-
-            goto next_state;
-        }
-
-        case MBOX_ITR:
-        {
-            if ( _box_itr == _boxes.end() )
-                _state = MPIN_ITR;
-            else
-            {
-                dbBox * box = *_box_itr;
-                ++_box_itr;
-
-                if ( (_expand_vias == false) || (box->isVia() == false) )
-                {
-                    getShape(box,shape);
-                    return true;
-                }
-                
-                else
-                {
-                    box->getViaXY(_via_x,_via_y);
-                    _via = box->getTechVia();
-                    assert(_via);
-                    _via_boxes = _via->getBoxes();
-                    _via_box_itr = _via_boxes.begin();
-                    _prev_state = MBOX_ITR;
-                    _state = VIA_BOX_ITR;
-                }
-            }
-            
-            goto next_state;
-        }
-
-        case OBS_ITR:
-        {
-            if ( _box_itr == _boxes.end() )
-                return false;
-            
-            else
-            {
-                dbBox * box = *_box_itr;
-                ++_box_itr;
-
-                if ( (_expand_vias == false) || (box->isVia() == false) )
-                {
-                    getShape(box,shape);
-                    return true;
-                }
-                
-                else
-                {
-                    box->getViaXY(_via_x,_via_y);
-                    _via = box->getTechVia();
-                    assert(_via);
-                    _via_boxes = _via->getBoxes();
-                    _via_box_itr = _via_boxes.begin();
-                    _prev_state = OBS_ITR;
-                    _state = VIA_BOX_ITR;
-                }
-            }
-            goto next_state;
-        }
-
-        case VIA_BOX_ITR:
-        {
-            if ( _via_box_itr == _via_boxes.end() )
-                _state = _prev_state;
-            else
-            {
-                dbBox * box = *_via_box_itr;
-                ++_via_box_itr;
-                getViaBox(box,shape);
-                return true;
-            }
-            
-            goto next_state;
-        }   
-
-        case PINS_DONE:
-        {
-            if ( _type == ALL )
-            {
-                _type = OBSTRUCTIONS;
-                _state = INIT;
-                goto next_state;
-            }
-            
-            return false;
-        }
-    }
+    if ( _cur == _end )
+        return false;
 
-    return false;
+    _cur->getShape(_x, _y, shape);
+    ++_cur;
+    return true;
 }
 
 } // namespace
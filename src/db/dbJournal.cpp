@@ -31,13 +31,20 @@
 
 #include "dbJournal.h"
 #include "dbBlock.h"
+#include "dbTable.h"
 #include "dbNet.h"
 #include "dbInst.h"
 #include "dbITerm.h"
 #include "dbRSeg.h"
 #include "dbCCSeg.h"
 #include "dbCapNode.h"
+#include "dbWire.h"
+#include "dbBox.h"
+#include "dbRegion.h"
+#include "dbProperty.h"
 #include "db.h"
+#include "dbBlockCallBackObj.h"
+#include <algorithm>
 
 namespace odb {
 
@@ -46,7 +53,7 @@ void invalidateTiming (dbInst *inst);
 void invalidateTiming (dbNet *net);
 
 dbJournal::dbJournal( dbBlock * block )
-        : _block(block), _start_action(false)
+        : _block(block), _log_version(LOG_VERSION), _start_action(false)
 {    
 }
     
@@ -58,7 +65,9 @@ dbJournal::~dbJournal()
 void dbJournal::clear()
 {
     _log.clear();
+    _savepoints.clear();
     _start_action = false;
+    _log_version = LOG_VERSION;
 }
 
 
@@ -150,6 +159,227 @@ void dbJournal::updateField( dbObject * obj, int field_id, const char * prev_val
     endAction();
 }
 
+//
+// The state of a deleted instance: enough to create it again under the same
+// ids. It is not restorable if it had state the record does not hold.
+//
+struct dbJournal::InstState
+{
+    uint              _id;
+    bool              _restorable;
+    uint              _lib_id;
+    uint              _master_id;
+    std::string       _name;
+    uint              _flags;
+    int               _x;
+    int               _y;
+    int               _weight;
+    uint              _region;
+    uint              _bbox;
+    std::vector<uint> _iterms;       // id, flags, ext-id of each iterm
+};
+
+struct dbJournal::NetState
+{
+    uint        _id;
+    bool        _restorable;
+    std::string _name;
+    uint        _flags;
+    float       _gndc_calibration_factor;
+    float       _cc_calibration_factor;
+    uint        _non_default_rule;
+    int         _weight;
+    int         _xtalk;
+    float       _cc_adjust_factor;
+    uint        _cc_adjust_order;
+};
+
+void dbJournal::popInst( InstState & state )
+{
+    _log.pop(state._id);
+    _log.pop(state._restorable);
+    _log.pop(state._lib_id);
+    _log.pop(state._master_id);
+    _log.pop(state._name);
+    _log.pop(state._flags);
+    _log.pop(state._x);
+    _log.pop(state._y);
+    _log.pop(state._weight);
+    _log.pop(state._region);
+    _log.pop(state._bbox);
+
+    uint n;
+    _log.pop(n);
+    state._iterms.resize(3 * n);
+
+    uint i;
+    for( i = 0; i < 3 * n; ++i )
+        _log.pop(state._iterms[i]);
+}
+
+void dbJournal::popNet( NetState & state )
+{
+    _log.pop(state._id);
+    _log.pop(state._restorable);
+    _log.pop(state._name);
+    _log.pop(state._flags);
+    _log.pop(state._gndc_calibration_factor);
+    _log.pop(state._cc_calibration_factor);
+    _log.pop(state._non_default_rule);
+    _log.pop(state._weight);
+    _log.pop(state._xtalk);
+    _log.pop(state._cc_adjust_factor);
+    _log.pop(state._cc_adjust_order);
+}
+
+void dbJournal::getWire( _dbNet * net, bool global, WireState & state )
+{
+    _dbBlock * block = (_dbBlock *) net->getOwner();
+    uint id = global ? net->_global_wire : net->_wire;
+    state._exists = (id != 0);
+    state._id = id;
+    state._net_flags = *(uint *) &net->_flags;
+    state._opcodes.clear();
+    state._data.clear();
+
+    if ( id == 0 )
+        return;
+
+    _dbWire * wire = block->_wire_tbl->getPtr(id);
+    wire->unspill();
+    state._opcodes.assign( wire->_opcodes.begin(), wire->_opcodes.end() );
+    state._data.assign( wire->_data.begin(), wire->_data.end() );
+}
+
+void dbJournal::updateWire( _dbNet * net, bool global, const WireState & prev )
+{
+    WireState next;
+    getWire( net, global, next );
+
+    debug("DB_ECO","A","ECO: update wire of net %u\n", net->getOID());
+    beginAction( UPDATE_FIELD );
+    _log.push( dbNetObj );
+    _log.push( net->getOID() );
+    _log.push( _dbNet::WIRE );
+    _log.push( global );
+
+    const WireState * states[2] = { &prev, &next };
+    uint i;
+
+    for( i = 0; i < 2; ++i )
+    {
+        const WireState & s = *states[i];
+        uint n = s._opcodes.size();
+        _log.push( s._exists );
+        _log.push( s._id );
+        _log.push( s._net_flags );
+        _log.push( n );
+
+        uint j;
+        for( j = 0; j < n; ++j )
+            _log.push( s._opcodes[j] );
+
+        for( j = 0; j < n; ++j )
+            _log.push( s._data[j] );
+    }
+
+    endAction();
+}
+
+void dbJournal::popWire( WireState & state )
+{
+    _log.pop(state._exists);
+    _log.pop(state._id);
+    _log.pop(state._net_flags);
+
+    uint n;
+    _log.pop(n);
+    state._opcodes.resize(n);
+    state._data.resize(n);
+
+    uint i;
+    for( i = 0; i < n; ++i )
+        _log.pop(state._opcodes[i]);
+
+    for( i = 0; i < n; ++i )
+        _log.pop(state._data[i]);
+}
+
+//
+// Give the net the logged wire, under its logged id if that id is free.
+//
+void dbJournal::setWire( _dbNet * net, bool global, const WireState & state )
+{
+    _dbBlock * block = (_dbBlock *) _block;
+    uint & id = global ? net->_global_wire.id() : net->_wire.id();
+
+    if ( (id != 0) && ((! state._exists) || (id != state._id)) )
+    {
+        _dbWire * wire = block->_wire_tbl->getPtr(id);
+        wire->dropSpill();
+        dbProperty::destroyProperties(wire);
+        block->_wire_tbl->destroy(wire);
+        id = 0;
+    }
+
+    if ( state._exists )
+    {
+        if ( id == 0 )
+        {
+            block->_wire_tbl->setNextId( state._id );
+            _dbWire * wire = block->_wire_tbl->create();
+            wire->_net = net->getOID();
+            wire->_flags._is_global = global ? 1 : 0;
+            id = wire->getOID();
+        }
+
+        _dbWire * wire = block->_wire_tbl->getPtr(id);
+        wire->dropSpill();
+        wire->_opcodes.assign( state._opcodes.begin(), state._opcodes.end() );
+        wire->_data.assign( state._data.begin(), state._data.end() );
+    }
+
+    *(uint *) &net->_flags = state._net_flags;
+    block->_flags._valid_bbox = 0;
+}
+
+dbWireUpdate::dbWireUpdate( _dbWire * wire )
+        : _journal(NULL), _net(NULL), _global(false)
+{
+    if ( wire->_net == 0 )
+        return;
+
+    _dbBlock * block = (_dbBlock *) wire->getOwner();
+    begin( block->_net_tbl->getPtr(wire->_net), wire->_flags._is_global );
+}
+
+dbWireUpdate::dbWireUpdate( _dbNet * net, bool global )
+        : _journal(NULL), _net(NULL), _global(false)
+{
+    begin( net, global );
+}
+
+void dbWireUpdate::begin( _dbNet * net, bool global )
+{
+    _dbBlock * block = (_dbBlock *) net->getOwner();
+
+    if ( block->_journal == NULL )
+        return;
+
+    _journal = block->_journal;
+    _net = net;
+    _global = global;
+    dbJournal::getWire( net, global, _prev );
+}
+
+void dbWireUpdate::end()
+{
+    if ( _journal )
+        _journal->updateWire( _net, _global, _prev );
+
+    _journal = NULL;
+}
+
 void dbJournal::beginAction( Action action )
 {
     assert(_start_action == false);
@@ -205,6 +435,37 @@ void dbJournal::endAction()
     _log.push( _action_idx ); // This value allows log to be scanned backwards.
 }
 
+//
+// Instance origin/flag updates only record the instance; the bboxes (and
+// move callbacks) are updated once per run of field updates.
+//
+void dbJournal::flushMovedInsts()
+{
+    if ( _moved_insts.empty() )
+        return;
+
+    std::sort( _moved_insts.begin(), _moved_insts.end() );
+    _moved_insts.erase( std::unique( _moved_insts.begin(), _moved_insts.end() ), _moved_insts.end() );
+
+    _dbBlock * block = (_dbBlock *) _block;
+    std::vector<dbInst *> insts;
+    insts.reserve( _moved_insts.size() );
+    std::vector<uint>::iterator itr;
+
+    for( itr = _moved_insts.begin(); itr != _moved_insts.end(); ++itr )
+    {
+        _dbInst * inst = block->_inst_tbl->getPtr( *itr );
+        _dbInst::setInstBBox(inst);
+        insts.push_back( (dbInst *) inst );
+    }
+
+    std::list<dbBlockCallBackObj *>::iterator  cbitr;
+    for (cbitr = block->_callbacks.begin(); cbitr !=  block->_callbacks.end(); ++cbitr)
+        (**cbitr)().inDbMoveInsts(insts);
+
+    _moved_insts.clear();
+}
+
 void dbJournal::redo()
 {
     _log.begin();
@@ -216,6 +477,9 @@ void dbJournal::redo()
 #endif
         _log.pop(_cur_action);
 
+        if ( _cur_action != UPDATE_FIELD )
+            flushMovedInsts();
+
         switch( _cur_action )
         {
             case CREATE_OBJECT:
@@ -254,6 +518,8 @@ void dbJournal::redo()
         assert( end_action == END_ACTION );
         assert( action_idx == s );
     }
+
+    flushMovedInsts();
 }
 
 void dbJournal::redo_createObject()
@@ -267,6 +533,14 @@ void dbJournal::redo_createObject()
         {
             std::string name;
             _log.pop(name);
+
+            if ( _log_version >= LOG_OBJECT_STATE )
+            {
+                uint net_id;
+                _log.pop(net_id);
+                ((_dbBlock *) _block)->_net_tbl->setNextId(net_id);
+            }
+
             debug("DB_ECO","R","REDO ECO: create dbNet %s\n",name.c_str());
             dbNet::create( _block, name.c_str() );
             break;
@@ -282,6 +556,31 @@ void dbJournal::redo_createObject()
             _log.pop(name);
             dbLib * lib = dbLib::getLib(_block->getDb(), lib_id );
             dbMaster * master = dbMaster::getMaster(lib, master_id );
+
+            if ( _log_version >= LOG_OBJECT_STATE )
+            {
+                // Create the instance under the logged ids, the actions
+                // after this one refer to it and its iterms by id.
+                _dbBlock * block = (_dbBlock *) _block;
+                uint inst_id;
+                uint box_id;
+                uint n;
+                _log.pop(inst_id);
+                _log.pop(box_id);
+                _log.pop(n);
+                std::vector<uint> iterms(n);
+
+                uint i;
+                for( i = 0; i < n; ++i )
+                    _log.pop(iterms[i]);
+
+                block->_inst_tbl->setNextId(inst_id);
+                block->_box_tbl->setNextId(box_id);
+
+                for( i = n; i > 0; --i )
+                    block->_iterm_tbl->setNextId(iterms[i-1]);
+            }
+
             debug("DB_ECO","R","REDO ECO: create dbInstObj %s, master: %u, lib: %u\n",name.c_str(),master_id,lib_id);
             dbInst::create( _block, master, name.c_str() );
             break;
@@ -347,8 +646,14 @@ void dbJournal::redo_deleteObject()
     {
         case dbNetObj:
         {
-            uint net_id;
-            _log.pop(net_id);
+            NetState state;
+
+            if ( _log_version >= LOG_OBJECT_STATE )
+                popNet(state);
+            else
+                _log.pop(state._id);
+
+            uint net_id = state._id;
             dbNet * net = dbNet::getNet(_block, net_id );
             debug("DB_ECO","R","REDO ECO: destroy dbNet, net_id %u\n",net_id);
             dbNet::destroy(net);
@@ -357,8 +662,14 @@ void dbJournal::redo_deleteObject()
 
         case dbInstObj:
         {
-            uint inst_id;
-            _log.pop(inst_id);
+            InstState state;
+
+            if ( _log_version >= LOG_OBJECT_STATE )
+                popInst(state);
+            else
+                _log.pop(state._id);
+
+            uint inst_id = state._id;
             dbInst * inst = dbInst::getInst(_block, inst_id );
             debug("DB_ECO","R","REDO ECO: destroy dbInst, inst_id %u\n",inst_id);
             dbInst::destroy(inst);
@@ -457,7 +768,10 @@ void dbJournal::redo_disconnectObject()
             uint iterm_id;
             _log.pop(iterm_id);
             dbITerm * iterm = dbITerm::getITerm(_block, iterm_id );
-            debug("DB_ECO","R","REDO ECO: disconnect dbITermObj, iterm_id %u\n",iterm_id);
+            uint net_id = 0;
+            if ( _log_version >= LOG_DISCONNECT_NET )
+                _log.pop(net_id);
+            debug("DB_ECO","R","REDO ECO: disconnect dbITermObj, iterm_id %u, net_id %u\n",iterm_id, net_id);
             dbITerm::disconnect( iterm );
             break;
         }
@@ -545,6 +859,8 @@ void dbJournal::redo_updateField()
 
 void dbJournal::redo_updateBlockField()
 {
+    flushMovedInsts();
+
     uint block_id;
     _log.pop(block_id);
     int field;
@@ -668,8 +984,22 @@ void dbJournal::redo_updateNetField()
 #ifdef TMG_SI
 		invalidateTiming((dbNet*)net);
 #endif
+            break;
 	}
 
+        case _dbNet::WIRE:
+        {
+            bool global;
+            WireState prev;
+            WireState next;
+            _log.pop(global);
+            popWire(prev);
+            popWire(next);
+            debug("DB_ECO","R","REDO ECO: dbNetObj %u, update wire\n",net_id);
+            setWire( net, global, next );
+            break;
+        }
+
         default:
             break;
 
@@ -691,9 +1021,11 @@ void dbJournal::redo_updateInstField()
         {
             uint prev_flags;
             _log.pop(prev_flags);
-            uint * flags = (uint *) &inst->_flags;
-            _log.pop(*flags);
-            debug("DB_ECO","R","REDO ECO: dbInst %u, updateInstField: %u to %u\n",inst_id,prev_flags,*flags);
+            uint flags;
+            _log.pop(flags);
+            inst->setFlagWord(flags);
+            debug("DB_ECO","R","REDO ECO: dbInst %u, updateInstField: %u to %u\n",inst_id,prev_flags,flags);
+            _moved_insts.push_back(inst_id);
             break;
         }
 
@@ -706,6 +1038,7 @@ void dbJournal::redo_updateInstField()
             _log.pop(inst->_x);
             _log.pop(inst->_y);
             debug("DB_ECO","R","REDO ECO: dbInst %u, origin: %u,%u to %u,%u\n",inst_id,prev_x,prev_y,inst->_x,inst->_y);
+            _moved_insts.push_back(inst_id);
             break;
         }
 
@@ -1023,14 +1356,36 @@ void dbJournal::redo_updateCCSegField()
 }
 
 //
-// WORK-IN-PROGRESS undo does not yet work.
+// Undo the complete transaction log.
 //
 void dbJournal::undo()
 {
-    if ( _log.empty() )
+    undo(0);
+}
+
+//
+// Walk the log backwards from the last action to "mark", undoing each action,
+// then truncate the log to "mark". Only the tail of the log is touched, so the
+// cost is proportional to the number of actions after the mark.
+//
+// The deletion of nets and instances that held more than the record keeps,
+// and the creation of parasitic objects, cannot be reversed; the log is
+// checked for them before anything is undone.
+//
+void dbJournal::undo( uint mark )
+{
+    if ( _log.size() <= mark )
         return;
+
+    assert(_start_action == false);
+    checkUndo( mark );
+
+    // The undo operations must not be journaled.
+    _dbBlock * block = (_dbBlock *) _block;
+    dbJournal * journal = block->_journal;
+    block->_journal = NULL;
     
-    _log.set( _log.size() - sizeof(uint) );
+    _log.set( _log.size() - _log.uintSize() );
     
     for( ;; )
     {
@@ -1070,11 +1425,118 @@ void dbJournal::undo()
                 break;
         }
 
-        if ( action_idx == 0 )
+        if ( action_idx <= mark )
+        {
+            assert( action_idx == mark );
             break;
+        }
 
-        _log.set( action_idx -= sizeof(uint) );
+        _log.set( action_idx - _log.uintSize() );
     }
+
+    _log.truncate(mark);
+    block->_journal = journal;
+}
+
+//
+// Throw if an action logged at or after "mark" cannot be undone.
+//
+void dbJournal::checkUndo( uint mark )
+{
+    uint idx = _log.size() - _log.uintSize();
+
+    for( ;; )
+    {
+        uint action_idx;
+        unsigned char action;
+        int obj_type;
+        _log.set(idx);
+        _log.pop(action_idx);
+        _log.set(action_idx);
+        _log.pop(action);
+        _log.pop(obj_type);
+
+        bool parasitic = (obj_type == dbRSegObj) || (obj_type == dbCapNodeObj) || (obj_type == dbCCSegObj);
+
+        if ( action == DELETE_OBJECT )
+        {
+            // Nets and instances deleted without state the record does not
+            // hold (bterms, special wires, parasitics, properties, halos,
+            // hierarchy) can be created again.
+            bool restorable = false;
+
+            if ( (_log_version >= LOG_OBJECT_STATE) && ((obj_type == dbNetObj) || (obj_type == dbInstObj)) )
+            {
+                uint id;
+                _log.pop(id);
+                _log.pop(restorable);
+            }
+
+            if ( ! restorable )
+                throw ZException( "journal: cannot undo deletion of %s", dbObject::getObjName( (dbObjectType) obj_type ) );
+        }
+
+        if ( (action == CREATE_OBJECT) && parasitic )
+            throw ZException( "journal: cannot undo creation of %s", dbObject::getObjName( (dbObjectType) obj_type ) );
+
+        if ( (action == DISCONNECT_OBJECT) && (_log_version < LOG_DISCONNECT_NET) )
+            throw ZException( "journal: cannot undo disconnect of %s, the net is not recorded", dbObject::getObjName( (dbObjectType) obj_type ) );
+
+        if ( action_idx <= mark )
+            break;
+
+        idx = action_idx - _log.uintSize();
+    }
+}
+
+int dbJournal::findSavepoint( const char * name )
+{
+    int i;
+    for( i = (int) _savepoints.size() - 1; i >= 0; --i )
+    {
+        if ( _savepoints[i].first == name )
+            return i;
+    }
+
+    return -1;
+}
+
+void dbJournal::setSavepoint( const char * name )
+{
+    assert(_start_action == false);
+    _savepoints.push_back( std::make_pair( std::string(name), _log.size() ) );
+}
+
+//
+// Undo the actions logged since the most recent savepoint called "name".
+// The savepoint itself is kept, savepoints set after it are discarded.
+//
+bool dbJournal::rollbackToSavepoint( const char * name )
+{
+    int i = findSavepoint(name);
+
+    if ( i < 0 )
+        return false;
+
+    debug("DB_ECO","U","UNDO ECO: rollback to savepoint %s\n",name);
+    undo( _savepoints[i].second );
+    _savepoints.resize(i + 1);
+    return true;
+}
+
+//
+// Forget the most recent savepoint called "name" and the savepoints set after
+// it. The logged actions are kept.
+//
+bool dbJournal::releaseSavepoint( const char * name )
+{
+    int i = findSavepoint(name);
+
+    if ( i < 0 )
+        return false;
+
+    _savepoints.resize(i);
+    return true;
 }
 
 void dbJournal::undo_createObject()
@@ -1085,29 +1547,106 @@ void dbJournal::undo_createObject()
     switch( (dbObjectType) obj_type )
     {
         case dbNetObj:
+        {
+            std::string name;
+            _log.pop(name);
+            dbNet * net = _block->findNet( name.c_str() );
+            debug("DB_ECO","U","UNDO ECO: create dbNet %s\n",name.c_str());
+            if ( net )
+                dbNet::destroy(net);
+            break;
+        }
+
         case dbInstObj:
-        case dbRSegObj:
-        case dbCapNodeObj:
-        case dbCCSegObj:
+        {
+            uint lib_id;
+            uint master_id;
+            std::string name;
+            _log.pop(lib_id);
+            _log.pop(master_id);
+            _log.pop(name);
+            dbInst * inst = _block->findInst( name.c_str() );
+            debug("DB_ECO","U","UNDO ECO: create dbInst %s\n",name.c_str());
+            if ( inst )
+                dbInst::destroy(inst);
+            break;
+        }
 
-        default:
+        default: // rejected by checkUndo
+            assert(0);
             break;
     }
 }
 
+//
+// Create the deleted object again under its ids. The actions logged before
+// the deletion (iterm disconnects, the removal of the wire) are undone next
+// and restore the rest.
+//
 void dbJournal::undo_deleteObject()
 {
     int obj_type;
     _log.pop(obj_type);
+    _dbBlock * block = (_dbBlock *) _block;
 
     switch( (dbObjectType) obj_type )
     {
         case dbNetObj:
+        {
+            NetState state;
+            popNet(state);
+            debug("DB_ECO","U","UNDO ECO: destroy dbNet %s, net_id %u\n",state._name.c_str(),state._id);
+            block->_net_tbl->setNextId(state._id);
+            _dbNet * net = (_dbNet *) dbNet::create( _block, state._name.c_str() );
+            *(uint *) &net->_flags = state._flags;
+            net->_gndc_calibration_factor = state._gndc_calibration_factor;
+            net->_cc_calibration_factor = state._cc_calibration_factor;
+            net->_non_default_rule = state._non_default_rule;
+            net->_weight = state._weight;
+            net->_xtalk = state._xtalk;
+            net->_ccAdjustFactor = state._cc_adjust_factor;
+            net->_ccAdjustOrder = state._cc_adjust_order;
+            break;
+        }
+
         case dbInstObj:
-        case dbRSegObj:
-        case dbCapNodeObj:
-        case dbCCSegObj:
-        default:
+        {
+            InstState state;
+            popInst(state);
+            debug("DB_ECO","U","UNDO ECO: destroy dbInst %s, inst_id %u\n",state._name.c_str(),state._id);
+
+            uint n = state._iterms.size() / 3;
+            uint i;
+
+            block->_inst_tbl->setNextId(state._id);
+            block->_box_tbl->setNextId(state._bbox);
+
+            for( i = n; i > 0; --i )
+                block->_iterm_tbl->setNextId(state._iterms[3 * (i-1)]);
+
+            dbLib * lib = dbLib::getLib(_block->getDb(), state._lib_id );
+            dbMaster * master = dbMaster::getMaster(lib, state._master_id );
+            dbRegion * region = state._region ? dbRegion::getRegion(_block, state._region) : NULL;
+            _dbInst * inst = (_dbInst *) dbInst::create( _block, master, state._name.c_str(), region );
+
+            *(uint *) &inst->_flags = state._flags;
+            inst->_x = state._x;
+            inst->_y = state._y;
+            inst->_weight = state._weight;
+
+            for( i = 0; i < n; ++i )
+            {
+                _dbITerm * iterm = block->_iterm_tbl->getPtr( inst->_iterms[i] );
+                *(uint *) &iterm->_flags = state._iterms[3 * i + 1];
+                iterm->_ext_id = state._iterms[3 * i + 2];
+            }
+
+            _dbInst::setInstBBox(inst);
+            break;
+        }
+
+        default: // rejected by checkUndo
+            assert(0);
             break;
     }
 }
@@ -1120,6 +1659,15 @@ void dbJournal::undo_connectObject()
     switch( (dbObjectType) obj_type )
     {
         case dbITermObj:
+        {
+            uint iterm_id;
+            _log.pop(iterm_id);
+            dbITerm * iterm = dbITerm::getITerm(_block, iterm_id );
+            debug("DB_ECO","U","UNDO ECO: connect dbITermObj, iterm_id %u\n",iterm_id);
+            dbITerm::disconnect( iterm );
+            break;
+        }
+
         default:
             break;
     }
@@ -1133,6 +1681,18 @@ void dbJournal::undo_disconnectObject()
     switch( (dbObjectType) obj_type )
     {
         case dbITermObj:
+        {
+            uint iterm_id;
+            _log.pop(iterm_id);
+            dbITerm * iterm = dbITerm::getITerm(_block, iterm_id );
+            uint net_id;
+            _log.pop(net_id);
+            dbNet * net = dbNet::getNet(_block, net_id );
+            debug("DB_ECO","U","UNDO ECO: disconnect dbITermObj, iterm_id %u, net_id %u\n",iterm_id, net_id);
+            dbITerm::connect( iterm, net );
+            break;
+        }
+
         default:
             break;
     }
@@ -1146,6 +1706,23 @@ void dbJournal::undo_swapObject()
     switch( (dbObjectType) obj_type )
     {
         case dbInstObj:
+        {
+            uint inst_id;
+            _log.pop(inst_id);
+            dbInst * inst = dbInst::getInst(_block, inst_id );
+
+            uint prev_lib_id;
+            _log.pop(prev_lib_id);
+            dbLib * lib = dbLib::getLib(_block->getDb(), prev_lib_id );
+
+            uint prev_master_id;
+            _log.pop(prev_master_id);
+            dbMaster * master = dbMaster::getMaster(lib, prev_master_id );
+            debug("DB_ECO","U","UNDO ECO: swapMaster inst %u, lib/master: %u/%u\n",inst_id,prev_lib_id,prev_master_id);
+            inst->swapMaster(master);
+            break;
+        }
+
         default:
             break;
     }
@@ -1178,6 +1755,10 @@ void dbJournal::undo_updateField()
             undo_updateCapNodeField();
             break;
 
+        case dbCCSegObj:
+            undo_updateCCSegField();
+            break;
+
         default:
             break;
     }
@@ -1187,7 +1768,7 @@ void dbJournal::undo_updateNetField()
 {
     uint net_id;
     _log.pop(net_id);
-    //_dbNet * net = (_dbNet *) dbNet::getNet(_block, net_id );
+    _dbNet * net = (_dbNet *) dbNet::getNet(_block, net_id );
 
     int field;
     _log.pop(field);
@@ -1195,8 +1776,46 @@ void dbJournal::undo_updateNetField()
     switch( (_dbNet::Field) field )
     {
         case _dbNet::FLAGS:
-        case _dbNet::NON_DEFAULT_RULE:
-            break; 
+        {
+            uint * flags = (uint *) &net->_flags;
+            _log.pop(*flags);
+            debug("DB_ECO","U","UNDO ECO: dbNetObj %u, updateNetField: %u\n",net_id,*flags);
+            break;
+        }
+
+        case _dbNet::HEAD_RSEG:
+        {
+            _log.pop(net->_r_segs.id());
+            debug("DB_ECO","U","UNDO ECO: dbNetObj %u, set1stRSegId %u\n",net_id,(uint) net->_r_segs);
+            break;
+        }
+
+        case _dbNet::REVERSE_RSEG:
+        {
+            dbSet<dbRSeg> rSet= ((dbNet*)net)->getRSegs();
+            rSet.reverse();
+            debug("DB_ECO","U","UNDO ECO: dbNetObj %u, reverse rsegs sequence\n",net_id);
+            break;
+        }
+
+        case _dbNet::HEAD_CAPNODE:
+        {
+            _log.pop(net->_cap_nodes.id());
+            debug("DB_ECO","U","UNDO ECO: dbNetObj %u, set1stCapNodeId %u\n",net_id,(uint) net->_cap_nodes);
+            break;
+        }
+
+        case _dbNet::WIRE:
+        {
+            bool global;
+            WireState prev;
+            _log.pop(global);
+            popWire(prev);
+            debug("DB_ECO","U","UNDO ECO: dbNetObj %u, update wire\n",net_id);
+            setWire( net, global, prev );
+            break;
+        }
+
         default: 
             break;
     }
@@ -1206,26 +1825,45 @@ void dbJournal::undo_updateInstField()
 {
     uint inst_id;
     _log.pop(inst_id);
-    //_dbInst * inst = (_dbInst *) dbInst::getInst(_block, inst_id );
+    _dbInst * inst = (_dbInst *) dbInst::getInst(_block, inst_id );
 
     int field;
     _log.pop(field);
 
-#if 0 // dead code generates warnings -cherry
     switch( (_dbInst::Field) field )
     {
         case _dbInst::FLAGS:
+        {
+            uint flags;
+            _log.pop(flags);
+            inst->setFlagWord(flags);
+            debug("DB_ECO","U","UNDO ECO: dbInst %u, updateInstField: %u\n",inst_id,flags);
+            // refresh the bbox for the restored orientation
+            ((dbInst *) inst)->setOrient( dbOrientType(inst->_flags._orient) );
+            break;
+        }
+
         case _dbInst::ORIGIN:
+        {
+            int prev_x;
+            _log.pop(prev_x);
+            int prev_y;
+            _log.pop(prev_y);
+            debug("DB_ECO","U","UNDO ECO: dbInst %u, origin: %d,%d\n",inst_id,prev_x,prev_y);
+            ((dbInst *) inst)->setOrigin(prev_x,prev_y);
+            break;
+        }
+
+        default:
             break;
     }
-#endif
 }
 
 void dbJournal::undo_updateITermField()
 {
     uint iterm_id;
     _log.pop(iterm_id);
-    //_dbITerm * iterm = (_dbITerm *) dbITerm::getITerm(_block, iterm_id );
+    _dbITerm * iterm = (_dbITerm *) dbITerm::getITerm(_block, iterm_id );
 
     int field;
     _log.pop(field);
@@ -1233,7 +1871,12 @@ void dbJournal::undo_updateITermField()
     switch( (_dbITerm::Field) field )
     {
         case _dbITerm::FLAGS:
+        {
+            uint * flags = (uint *) &iterm->_flags;
+            _log.pop(*flags);
+            debug("DB_ECO","U","UNDO ECO: dbITerm %u, updateITermField: %u\n",iterm_id,*flags);
             break;
+        }
     }
 }
 
@@ -1241,7 +1884,8 @@ void dbJournal::undo_updateRSegField()
 {
     uint rseg_id;
     _log.pop(rseg_id);
-    //_dbRSeg * rseg = (_dbRSeg *) dbRSeg::getRSeg(_block, rseg_id );
+    _dbRSeg * rseg = (_dbRSeg *) dbRSeg::getRSeg(_block, rseg_id );
+    _dbBlock * block = (_dbBlock *) _block;
 
     int field;
     _log.pop(field);
@@ -1249,13 +1893,54 @@ void dbJournal::undo_updateRSegField()
     switch( (_dbRSeg::Field) field )
     {
         case _dbRSeg::FLAGS:
+        {
+            uint * flags = (uint *) &rseg->_flags;
+            _log.pop(*flags);
+            break;
+        }
+
         case _dbRSeg::SOURCE:
+            _log.pop(rseg->_source);
+            break;
+
         case _dbRSeg::TARGET:
+            _log.pop(rseg->_target);
+            break;
+
         case _dbRSeg::SHAPE_ID:
+            _log.pop(rseg->_shape_id);
+            break;
+
         case _dbRSeg::RESISTANCE:
         case _dbRSeg::CAPACITANCE:
+        {
+            float prev_v;
+            float v;
+            int   cnr;
+            _log.pop(prev_v);
+            _log.pop(v);
+            _log.pop(cnr);
+            dbPagedVector<float, 4096, 12> * tbl = (field == _dbRSeg::RESISTANCE) ? block->_r_val_tbl : block->_c_val_tbl;
+            (*tbl)[(rseg->getOID()-1)*block->_corners_per_block + 1 + cnr] = prev_v;
             break;
+        }
+
+        case _dbRSeg::COORDINATES:
+        {
+            int prev_x;
+            int prev_y;
+            int x;
+            int y;
+            _log.pop(prev_x);
+            _log.pop(x);
+            _log.pop(prev_y);
+            _log.pop(y);
+            ((dbRSeg *)rseg)->setCoords(prev_x,prev_y);
+            break;
+        }
+
         default:
+            warning(0, "journal: cannot undo dbRSeg field %d\n", field);
             break;
     }
 }
@@ -1264,7 +1949,8 @@ void dbJournal::undo_updateCapNodeField()
 {
     uint node_id;
     _log.pop(node_id);
-    //_dbCapNode * node = (_dbCapNode *) dbCapNode::getCapNode(_block, node_id );
+    _dbCapNode * node = (_dbCapNode *) dbCapNode::getCapNode(_block, node_id );
+    _dbBlock * block = (_dbBlock *) _block;
 
     int field;
     _log.pop(field);
@@ -1272,18 +1958,40 @@ void dbJournal::undo_updateCapNodeField()
     switch( (_dbCapNode::Fields) field )
     {
         case _dbCapNode::FLAGS:
+        {
+            uint * flags = (uint *) &node->_flags;
+            _log.pop(*flags);
+            break;
+        }
+
+        case _dbCapNode::NODE_NUM:
+            _log.pop(node->_node_num);
+            break;
+
         case _dbCapNode::CAPACITANCE:
+        {
+            float prev_c;
+            float c;
+            int   cnr;
+            _log.pop(prev_c);
+            _log.pop(c);
+            _log.pop(cnr);
+            (*block->_c_val_tbl)[(node->getOID()-1)*block->_corners_per_block + 1 + cnr] = prev_c;
             break;
+        }
+
         default:
+            warning(0, "journal: cannot undo dbCapNode field %d\n", field);
             break;
     }
 }
 
 void dbJournal::undo_updateCCSegField()
 {
-    uint node_id;
-    _log.pop(node_id);
-    //_dbCCSeg * node = (_dbCCSeg *) dbCCSeg::getCCSeg(_block, node_id );
+    uint seg_id;
+    _log.pop(seg_id);
+    _dbCCSeg * seg = (_dbCCSeg *) dbCCSeg::getCCSeg(_block, seg_id );
+    _dbBlock * block = (_dbBlock *) _block;
 
     int field;
     _log.pop(field);
@@ -1291,12 +1999,26 @@ void dbJournal::undo_updateCCSegField()
     switch( (_dbCCSeg::Fields) field )
     {
         case _dbCCSeg::FLAGS:
+        {
+            uint * flags = (uint *) &seg->_flags;
+            _log.pop(*flags);
+            break;
+        }
+
         case _dbCCSeg::CAPACITANCE:
-        case _dbCCSeg::ADDCCCAPACITANCE:
-        case _dbCCSeg::SWAPCAPNODE:
-        case _dbCCSeg::LINKCCSEG:
-        case _dbCCSeg::UNLINKCCSEG:
-        case _dbCCSeg::SETALLCCCAP:
+        {
+            float prev_c;
+            float c;
+            int   cnr;
+            _log.pop(prev_c);
+            _log.pop(c);
+            _log.pop(cnr);
+            (*block->_cc_val_tbl)[(seg->getOID()-1)*block->_corners_per_block + 1 + cnr] = prev_c;
+            break;
+        }
+
+        default:
+            warning(0, "journal: cannot undo dbCCSeg field %d\n", field);
             break;
     }
 }
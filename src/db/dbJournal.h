@@ -40,6 +40,10 @@
 #include "dbJournalLog.h"
 #endif
 
+#include <string>
+#include <vector>
+#include <utility>
+
 namespace odb {
 
 class dbIStream;
@@ -49,14 +53,33 @@ class dbMaster;
 class dbNet;
 class dbInst;
 class dbITerm;
+class _dbNet;
+class _dbWire;
 
 class dbJournal
 {
     dbJournalLog  _log;
     dbBlock *     _block;
+    uint          _log_version;
     bool          _start_action;
     uint          _action_idx;
     unsigned char _cur_action;
+    std::vector< std::pair<std::string,uint> > _savepoints;
+    std::vector<uint> _moved_insts;
+
+    void flushMovedInsts();
+
+    int findSavepoint( const char * name );
+    void checkUndo( uint mark );
+
+    struct InstState;
+    struct NetState;
+    struct WireState;
+
+    void popInst( InstState & state );
+    void popNet( NetState & state );
+    void popWire( WireState & state );
+    void setWire( _dbNet * net, bool global, const WireState & state );
 
     void redo_createObject();
     void redo_deleteObject();
@@ -97,6 +120,20 @@ class dbJournal
         END_ACTION
     };
 
+    //
+    // Revisions of the action records. A log read from a legacy eco file
+    // keeps its revision, so its records are parsed with the layout they
+    // were written with.
+    //
+    enum LogVersion
+    {
+        LOG_LEGACY          = 0,
+        LOG_DISCONNECT_NET  = 1,   // DISCONNECT_OBJECT records the previous net
+        LOG_OBJECT_STATE    = 2,   // net/inst create and delete record the ids
+                                   // and state, wire updates are logged
+        LOG_VERSION         = 2    // Current revision
+    };
+
     dbJournal( dbBlock * block );
     ~dbJournal();
     void clear();
@@ -150,17 +187,84 @@ class dbJournal
     void updateField( dbObject * obj, int field_id, double prev_value, double new_value );
     void updateField( dbObject * obj, int field_id, const char * prev_value, const char * new_value );
 
+    //
+    // updateWire : log the change of the wire (or global wire) of a net
+    // from the state "prev" to its current state, see dbWireUpdate.
+    //
+    // The wire update entries in the log take the form:
+    //
+    //    <UPDATE_FIELD>
+    //    <dbNetObj>
+    //    <NET-ID>
+    //    <_dbNet::WIRE>
+    //    <GLOBAL>
+    //    <PREV_WIRE>
+    //    <NEW_WIRE>
+    //    <ACTION-OFFSET>
+    //
+    // A wire is logged as <EXISTS> <WIRE-ID> <NET-FLAGS> <N> <N OPCODES> <N DATA>.
+    //
+    void updateWire( _dbNet * net, bool global, const WireState & prev );
+    static void getWire( _dbNet * net, bool global, WireState & state );
+
     // redo the transaction log
     void redo();
 
     // undo the transaction log
     void undo();
 
+    // undo the actions logged at or after the log offset "mark", newest first,
+    // then discard them from the log. Throws ZException, before anything is
+    // undone, if one of the actions cannot be undone.
+    void undo( uint mark );
+
+    //
+    // Savepoints: named marks into the log. Savepoints nest; rolling back to a
+    // savepoint undoes only the actions logged after it, so the cost of a
+    // trial is proportional to the trial, not to the log.
+    //
+    void setSavepoint( const char * name );
+    bool rollbackToSavepoint( const char * name );
+    bool releaseSavepoint( const char * name );
+    uint savepointCount() { return _savepoints.size(); }
+
     bool empty() { return _log.empty(); }
 
     friend dbIStream & operator>>( dbIStream & stream, dbJournal & jrnl );
     friend dbOStream & operator<<( dbOStream & stream, const dbJournal & jrnl );
     friend class dbDatabase;
+    friend class dbEcoStream;
+    friend class dbSnapshot;
+    friend class dbWireUpdate;
+};
+
+struct dbJournal::WireState
+{
+    bool                        _exists;
+    uint                        _id;
+    uint                        _net_flags;
+    std::vector<unsigned char>  _opcodes;
+    std::vector<int>            _data;
+};
+
+//
+// dbWireUpdate - Logs the change made to a wire between the construction of
+// the update and end(). Nothing is logged if the block has no journal or the
+// wire belongs to no net.
+//
+class dbWireUpdate
+{
+    dbJournal *           _journal;
+    _dbNet *              _net;
+    bool                  _global;
+    dbJournal::WireState  _prev;
+
+    void begin( _dbNet * net, bool global );
+
+  public:
+    dbWireUpdate( _dbWire * wire );
+    dbWireUpdate( _dbNet * net, bool global );
+    void end();
 };
 
 dbIStream & operator>>( dbIStream & stream, dbJournal & jrnl );
@@ -31,6 +31,7 @@
 
 #include "dbJournalLog.h"
 #include <string>
+#include <string.h>
 
 namespace odb {
 
@@ -38,7 +39,7 @@ namespace odb {
 
 #ifdef DEBUG_JOURNAL_LOG
 #define SET_TYPE(TYPE) _data.push_back( (char) TYPE )
-#define CHECK_TYPE(TYPE) LogDataType type = (LogDataType) next(); assert( type == TYPE )
+#define CHECK_TYPE(TYPE) LogDataType type = (LogDataType) next(); assert( type == TYPE ); (void) type
 #else
 #define SET_TYPE(TYPE)
 #define CHECK_TYPE(TYPE)
@@ -68,66 +69,69 @@ dbJournalLog::~dbJournalLog()
     clear();
 }
 
+//
+// Each value is written with a single bulk append of (type tag, raw bytes)
+// rather than byte-by-byte, and read back the same way.
+//
+void dbJournalLog::append( unsigned char type, const void * value, uint size )
+{
+    unsigned char buf[sizeof(double) + 1];
+    uint n = 0;
+
+    if ( _debug )
+        buf[n++] = type;
+
+    memcpy( &buf[n], value, size );
+    _data.push_back( buf, n + size );
+}
+
+void dbJournalLog::fetch( unsigned char type, void * value, uint size )
+{
+    if ( _debug )
+    {
+        unsigned char t = next();
+        assert( t == type );
+        (void) t;
+    }
+
+    _data.get( _idx, (unsigned char *) value, size );
+    _idx += size;
+}
+
 void dbJournalLog::push( bool value )
 {
-    SET_TYPE( LOG_BOOL );
-    _data.push_back( (value == true) ? 1 : 0 );
+    unsigned char v = (value == true) ? 1 : 0;
+    append( LOG_BOOL, &v, 1 );
 }
 
 void dbJournalLog::push( char value )
 {
-    SET_TYPE( LOG_CHAR );
-    _data.push_back( value );
+    append( LOG_CHAR, &value, 1 );
 }
 
 void dbJournalLog::push( unsigned char value )
 {
-    SET_TYPE( LOG_UCHAR );
-    _data.push_back( value );
+    append( LOG_UCHAR, &value, 1 );
 }
 
 void dbJournalLog::push( int value )
 {
-    SET_TYPE( LOG_INT );
-    unsigned char * v = (unsigned char *) &value;
-    _data.push_back( v[0] );
-    _data.push_back( v[1] );
-    _data.push_back( v[2] );
-    _data.push_back( v[3] );
+    append( LOG_INT, &value, sizeof(int) );
 }
 
 void dbJournalLog::push( unsigned int value )
 {
-    SET_TYPE( LOG_UINT );
-    unsigned char * v = (unsigned char *) &value;
-    _data.push_back( v[0] );
-    _data.push_back( v[1] );
-    _data.push_back( v[2] );
-    _data.push_back( v[3] );
+    append( LOG_UINT, &value, sizeof(unsigned int) );
 }
 
 void dbJournalLog::push( float value )
 {
-    SET_TYPE( LOG_FLOAT );
-    unsigned char * v = (unsigned char *) &value;
-    _data.push_back( v[0] );
-    _data.push_back( v[1] );
-    _data.push_back( v[2] );
-    _data.push_back( v[3] );
+    append( LOG_FLOAT, &value, sizeof(float) );
 }
 
 void dbJournalLog::push( double value )
 {
-    SET_TYPE( LOG_DOUBLE );
-    unsigned char * v = (unsigned char *) &value;
-    _data.push_back( v[0] );
-    _data.push_back( v[1] );
-    _data.push_back( v[2] );
-    _data.push_back( v[3] );
-    _data.push_back( v[4] );
-    _data.push_back( v[5] );
-    _data.push_back( v[6] );
-    _data.push_back( v[7] );
+    append( LOG_DOUBLE, &value, sizeof(double) );
 }
 
 void dbJournalLog::push( const char * value )
@@ -139,72 +143,45 @@ void dbJournalLog::push( const char * value )
     {
         int len = strlen(value);
         push(len);
-
-        for( ; *value != '\0'; ++value )
-            _data.push_back( *value );
+        _data.push_back( (const unsigned char *) value, len );
     }
 }
 
 void dbJournalLog::pop( bool & value )
 {
-    CHECK_TYPE(LOG_BOOL);
-    value = (next() == 1) ? true : false;
+    unsigned char v;
+    fetch( LOG_BOOL, &v, 1 );
+    value = (v == 1) ? true : false;
 }
 
 void dbJournalLog::pop( char & value )
 {
-    CHECK_TYPE(LOG_CHAR);
-    value = next();
+    fetch( LOG_CHAR, &value, 1 );
 }
 
 void dbJournalLog::pop( unsigned char & value )
 {
-    CHECK_TYPE(LOG_UCHAR);
-    value = next();
+    fetch( LOG_UCHAR, &value, 1 );
 }
 
 void dbJournalLog::pop( int & value )
 {
-    CHECK_TYPE(LOG_INT);
-    unsigned char * v = (unsigned char *) &value;
-    v[0] = next();
-    v[1] = next();
-    v[2] = next();
-    v[3] = next();
+    fetch( LOG_INT, &value, sizeof(int) );
 }
 
 void dbJournalLog::pop( unsigned int & value )
 {
-    CHECK_TYPE(LOG_UINT);
-    unsigned char * v = (unsigned char *) &value;
-    v[0] = next();
-    v[1] = next();
-    v[2] = next();
-    v[3] = next();
+    fetch( LOG_UINT, &value, sizeof(unsigned int) );
 }
 
 void dbJournalLog::pop( float & value )
 {
-    CHECK_TYPE(LOG_FLOAT);
-    unsigned char * v = (unsigned char *) &value;
-    v[0] = next();
-    v[1] = next();
-    v[2] = next();
-    v[3] = next();
+    fetch( LOG_FLOAT, &value, sizeof(float) );
 }
 
 void dbJournalLog::pop( double & value )
 {
-    CHECK_TYPE(LOG_DOUBLE);
-    unsigned char * v = (unsigned char *) &value;
-    v[0] = next();
-    v[1] = next();
-    v[2] = next();
-    v[3] = next();
-    v[4] = next();
-    v[5] = next();
-    v[6] = next();
-    v[7] = next();
+    fetch( LOG_DOUBLE, &value, sizeof(double) );
 }
 
 void dbJournalLog::pop( char * & value )
@@ -220,12 +197,9 @@ void dbJournalLog::pop( char * & value )
     }
 
     value = (char *) malloc(len + 1);
-
-    int i;
-    for( i = 0; i < len; ++i )
-        value[i] = next();
-
-    value[i] = '\0';
+    _data.get( _idx, (unsigned char *) value, len );
+    _idx += len;
+    value[len] = '\0';
 }
 
 void dbJournalLog::pop( std::string & value )
@@ -240,16 +214,12 @@ void dbJournalLog::pop( std::string & value )
         return;
     }
 
-    value.reserve(len+1);
-    value = "";
+    value.resize(len);
 
-    int i;
-    for( i = 0; i < len; ++i )
-#ifndef _WIN32
-        value.push_back(next());
-#else
-        value += next();
-#endif
+    if ( len )
+        _data.get( _idx, (unsigned char *) &value[0], len );
+
+    _idx += len;
 }
 
 dbIStream & operator>>( dbIStream & stream, dbJournalLog & log )
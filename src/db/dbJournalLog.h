@@ -52,6 +52,8 @@ class dbJournalLog
     int                          _debug;
 
     unsigned char next() { return _data[_idx++]; }
+    void append( unsigned char type, const void * value, uint size );
+    void fetch( unsigned char type, void * value, uint size );
 
 public:
 
@@ -68,6 +70,15 @@ public:
     
     uint idx() { return _idx; }
     uint size() { return _data.size(); }
+
+    // Number of bytes a logged uint/uchar occupies, including its type tag.
+    uint uintSize() { return sizeof(uint) + (_debug ? 1 : 0); }
+    uint ucharSize() { return 1 + (_debug ? 1 : 0); }
+    int debug() { return _debug; }
+
+    // Raw access to the encoded entries.
+    void pushBytes( const unsigned char * bytes, uint n ) { _data.push_back( bytes, n ); }
+    void getBytes( uint idx, unsigned char * bytes, uint n ) { _data.get( idx, bytes, n ); }
     void push( bool value );
     void push( char value );
     void push( unsigned char value );
@@ -81,6 +92,15 @@ public:
     bool end() { return _idx == (int)_data.size(); }
     void set( uint idx ) { _idx = idx; }
 
+    // Discard every entry at or after idx.
+    void truncate( uint idx )
+    {
+        _data.truncate(idx);
+
+        if ( _idx > (int) idx )
+            _idx = idx;
+    }
+
     void pop( bool & value );
     void pop( char & value );
     void pop( unsigned char & value );
@@ -92,6 +112,7 @@ public:
     void pop( std::string & value );
     friend dbIStream & operator>>( dbIStream & stream, dbJournalLog & log );
     friend dbOStream & operator<<( dbOStream & stream, const dbJournalLog & log );
+    friend class dbEcoStream;
 };
 
 } // namespace    
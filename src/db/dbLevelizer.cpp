@@ -0,0 +1,551 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbLevelizer.h"
+#include "dbBlock.h"
+#include "dbNet.h"
+#include "dbInst.h"
+#include "dbITerm.h"
+#include "dbMTerm.h"
+#include "dbInstHdr.h"
+#include "dbMaster.h"
+#include "dbLib.h"
+#include "dbDatabase.h"
+#include "dbTable.h"
+#include "dbParallel.h"
+#include "db.h"
+
+namespace odb {
+
+//
+// Build a CSR index keyed by database id: the entries of key k are
+// items[begin[k]], ..., items[begin[k+1]-1]. fn(k, out) returns the number
+// of entries of key k and writes them to "out" unless "out" is NULL.
+//
+template <class FN>
+static void buildIndex( const std::vector<uint> & keys, uint size, uint threads,
+                        std::vector<uint> & begin, std::vector<uint> & items, FN fn )
+{
+    std::vector<uint> cnt( size, 0 );
+
+    dbParallelFor( keys.size(), threads, [&]( uint i )
+    {
+        cnt[keys[i]] = fn( keys[i], NULL );
+    }, 256 );
+
+    begin.resize( size + 1 );
+    uint n = 0;
+    uint k;
+
+    for( k = 0; k < size; ++k )
+    {
+        begin[k] = n;
+        n += cnt[k];
+    }
+
+    begin[size] = n;
+    items.resize(n);
+
+    dbParallelFor( keys.size(), threads, [&]( uint i )
+    {
+        fn( keys[i], items.data() + begin[keys[i]] );
+    }, 256 );
+}
+
+//
+// Build the transposed index of a CSR index: the entries of target t are the
+// keys k (with use(k) true) that list t.
+//
+template <class FN>
+static void transposeIndex( const std::vector<uint> & keys, uint size, uint threads,
+                            const std::vector<uint> & begin, const std::vector<uint> & items,
+                            std::vector<uint> & tbegin, std::vector<uint> & titems, FN use )
+{
+    std::vector<std::atomic<uint> > cursor(size);
+
+    dbParallelFor( keys.size(), threads, [&]( uint i )
+    {
+        uint key = keys[i];
+
+        if ( !use(key) )
+            return;
+
+        uint k;
+        for( k = begin[key]; k < begin[key + 1]; ++k )
+            cursor[ items[k] ].fetch_add(1);
+    }, 256 );
+
+    tbegin.resize( size + 1 );
+    uint n = 0;
+    uint t;
+
+    for( t = 0; t < size; ++t )
+    {
+        tbegin[t] = n;
+        n += cursor[t].load();
+        cursor[t].store( tbegin[t] );
+    }
+
+    tbegin[size] = n;
+    titems.resize(n);
+
+    dbParallelFor( keys.size(), threads, [&]( uint i )
+    {
+        uint key = keys[i];
+
+        if ( !use(key) )
+            return;
+
+        uint k;
+        for( k = begin[key]; k < begin[key + 1]; ++k )
+            titems[ cursor[ items[k] ].fetch_add(1) ] = key;
+    }, 256 );
+}
+
+static inline bool isInput( _dbMTerm * mterm )
+{
+    dbIoType::Value io = mterm->_flags._io_type;
+    return (io == dbIoType::INPUT) || (io == dbIoType::INOUT);
+}
+
+static inline bool isSupply( _dbMTerm * mterm )
+{
+    dbSigType::Value sig = mterm->_flags._sig_type;
+    return (sig == dbSigType::POWER) || (sig == dbSigType::GROUND);
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// dbLevelizer - Methods
+//
+////////////////////////////////////////////////////////////////////
+
+dbLevelizer::dbLevelizer( _dbBlock * block, uint threads )
+    : _block(block),
+      _threads(threads),
+      _tail(0)
+{
+    dbBlock * block_ = (dbBlock *) block;
+
+    dbSet<dbInst> insts = block_->getInsts();
+    dbSet<dbInst>::iterator iitr;
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+    {
+        dbInst * inst = *iitr;
+        dbMaster * master = inst->getMaster();
+        uint id = inst->getId();
+
+        if ( id >= _kind.size() )
+            _kind.resize( id + 1, OTHER );
+
+        _insts.push_back(id);
+
+        if ( master->isSequential() )
+            _kind[id] = SEQUENTIAL;
+        else if ( master->getType() == dbMasterType::CORE )
+            _kind[id] = COMBINATIONAL;
+    }
+
+    uint num_nets = 0;
+    dbSet<dbNet> nets = block_->getNets();
+    dbSet<dbNet>::iterator nitr;
+
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+    {
+        uint id = nitr->getId();
+
+        if ( id >= num_nets )
+            num_nets = id + 1;
+    }
+
+    uint num_insts = _kind.size();
+
+    std::vector<std::atomic<uint> > level(num_insts);
+    _level.swap(level);
+
+    dbParallelFor( _insts.size(), _threads, [&]( uint i )
+    {
+        _dbInst * inst = _block->_inst_tbl->getPtr( _insts[i] );
+        uint l = 0;
+
+        if ( inst->_flags._inside_cone || inst->_flags._input_cone )
+            l = inst->_flags._level;
+
+        _level[_insts[i]].store(l);
+    }, 1024 );
+
+    buildIndex( _insts, num_insts, _threads, _out_begin, _out_nets,
+                [this]( uint inst, uint * nets ) { return instNets( inst, true, nets ); } );
+
+    buildIndex( _insts, num_insts, _threads, _in_begin, _in_nets,
+                [this]( uint inst, uint * nets ) { return instNets( inst, false, nets ); } );
+
+    // the sinks of a net are the combinational instances listing it as input
+    transposeIndex( _insts, num_nets, _threads, _in_begin, _in_nets, _sink_begin, _sinks,
+                    []( uint ) { return true; } );
+
+    _queue.resize( _insts.size() );
+}
+
+//
+// The nets of the iterms of an instance: the nets driven by its non-input,
+// non-supply iterms ("output" true), or the nets of the input iterms of a
+// combinational instance.
+//
+uint dbLevelizer::instNets( uint id, bool output, uint * nets )
+{
+    if ( !output && (_kind[id] != COMBINATIONAL) )
+        return 0;
+
+    _dbInst * inst = _block->_inst_tbl->getPtr(id);
+    _dbInstHdr * inst_hdr = _block->_inst_hdr_tbl->getPtr(inst->_inst_hdr);
+    _dbLib * lib = _block->getDatabase()->_lib_tbl->getPtr(inst_hdr->_lib);
+    _dbMaster * master = lib->_master_tbl->getPtr(inst_hdr->_master);
+    uint cnt = 0;
+    uint k;
+
+    for( k = 0; k < inst->_iterms.size(); ++k )
+    {
+        _dbITerm * iterm = _block->_iterm_tbl->getPtr( inst->_iterms[k] );
+
+        if ( iterm->_net == 0 )
+            continue;
+
+        _dbMTerm * mterm = master->_mterm_tbl->getPtr( inst_hdr->_mterms[iterm->_flags._mterm_idx] );
+
+        if ( output ? (isSupply(mterm) || isInput(mterm)) : !isInput(mterm) )
+            continue;
+
+        if ( nets )
+            nets[cnt] = iterm->_net;
+
+        ++cnt;
+    }
+
+    return cnt;
+}
+
+//
+// Process the queue from "begin" one wavefront at a time: fn(inst) is called
+// on multiple threads for every instance of the current wave, and may push
+// the instances of the next wave.
+//
+template <class FN>
+void dbLevelizer::waves( uint begin, FN fn )
+{
+    for(;;)
+    {
+        uint end = _tail.load();
+
+        if ( begin == end )
+            break;
+
+        dbParallelFor( end - begin, _threads, [&]( uint k )
+        {
+            fn( _queue[begin + k] );
+        }, 64 );
+
+        begin = end;
+    }
+}
+
+// Give "level" to the unleveled sinks of a net and queue them. A level of
+// 256 is not stored in the database; the sink is queued but not expanded.
+void dbLevelizer::claim( uint net, uint level )
+{
+    uint k;
+    for( k = _sink_begin[net]; k < _sink_begin[net + 1]; ++k )
+    {
+        uint inst = _sinks[k];
+        uint expected = 0;
+
+        if ( _level[inst].compare_exchange_strong( expected, level ) )
+            push(inst);
+    }
+}
+
+void dbLevelizer::run( uint begin )
+{
+    waves( begin, [this]( uint inst )
+    {
+        uint level = _level[inst].load();
+
+        if ( level > 255 )
+            return;
+
+        uint k;
+        for( k = _out_begin[inst]; k < _out_begin[inst + 1]; ++k )
+            claim( _out_nets[k], level + 1 );
+    } );
+}
+
+// Write the levels of the queued instances [begin, end) to the database.
+uint dbLevelizer::store( uint begin, uint end, bool fromPI )
+{
+    std::atomic<uint> cnt(0);
+
+    dbParallelFor( end - begin, _threads, [&]( uint k )
+    {
+        uint id = _queue[begin + k];
+        uint level = _level[id].load();
+
+        if ( level > 255 )
+            return;
+
+        _dbInst * inst = _block->_inst_tbl->getPtr(id);
+        inst->_flags._level = level;
+        inst->_flags._input_cone = fromPI ? 1 : 0;
+        inst->_flags._inside_cone = fromPI ? 0 : 1;
+        cnt.fetch_add(1);
+    }, 1024 );
+
+    // too deep: let dbInst::setLevel report it
+    uint k;
+    for( k = begin; k < end; ++k )
+    {
+        uint level = _level[_queue[k]].load();
+
+        if ( level > 255 )
+        {
+            dbInst * inst = (dbInst *) _block->_inst_tbl->getPtr( _queue[k] );
+            inst->setLevel( level, fromPI );
+        }
+    }
+
+    return cnt.load();
+}
+
+uint dbLevelizer::levelizeFromPrimaryInputs()
+{
+    dbBlock * block = (dbBlock *) _block;
+    std::vector<uint> nets;
+
+    dbSet<dbBTerm> bterms = block->getBTerms();
+    dbSet<dbBTerm>::iterator bitr;
+
+    for( bitr = bterms.begin(); bitr != bterms.end(); ++bitr )
+    {
+        dbNet * net = bitr->getNet();
+
+        if ( net == NULL )
+            continue;
+
+        if ( (net->getSigType() == dbSigType::GROUND) || (net->getSigType() == dbSigType::POWER) )
+            continue;
+
+        nets.push_back( net->getId() );
+    }
+
+    _tail = 0;
+
+    dbParallelFor( nets.size(), _threads, [&]( uint i )
+    {
+        claim( nets[i], 1 );
+    }, 64 );
+
+    uint inputs = _tail.load();
+
+    if ( inputs == 0 )
+        return 0;
+
+    run(0);
+
+    uint cnt = store( 0, inputs, true );
+    cnt += store( inputs, _tail.load(), false );
+    return cnt;
+}
+
+uint dbLevelizer::levelizeFromSequential()
+{
+    _tail = 0;
+
+    uint i;
+    for( i = 0; i < _insts.size(); ++i )
+    {
+        uint id = _insts[i];
+
+        if ( _kind[id] != SEQUENTIAL )
+            continue;
+
+        _level[id].store(1);
+        push(id);
+    }
+
+    if ( _tail.load() == 0 )
+        return 0;
+
+    run(0);
+
+    return store( 0, _tail.load(), false );
+}
+
+//
+// The loops are found by trimming the combinational graph from both ends:
+// the instances that are not reached by a topological sort from the
+// sources, and that do not reach the sinks in a topological sort of the
+// reversed graph, lie on a cycle or between two cycles. Sequential
+// instances break the cycles.
+//
+uint dbLevelizer::findLoops( std::vector<uint> & result )
+{
+    uint num_insts = _kind.size();
+    uint num_nets = _sink_begin.size() - 1;
+    std::vector<uint> driver_begin;
+    std::vector<uint> drivers;
+
+    transposeIndex( _insts, num_nets, _threads, _out_begin, _out_nets, driver_begin, drivers,
+                    [this]( uint inst ) { return _kind[inst] == COMBINATIONAL; } );
+
+    // forward: in-degree of each instance, counting combinational drivers
+    std::vector<std::atomic<uint> > deg(num_insts);
+
+    dbParallelFor( _insts.size(), _threads, [&]( uint i )
+    {
+        uint inst = _insts[i];
+
+        if ( _kind[inst] != COMBINATIONAL )
+            return;
+
+        uint k, s;
+        for( k = _out_begin[inst]; k < _out_begin[inst + 1]; ++k )
+        {
+            uint net = _out_nets[k];
+
+            for( s = _sink_begin[net]; s < _sink_begin[net + 1]; ++s )
+                deg[ _sinks[s] ].fetch_add(1);
+        }
+    }, 256 );
+
+    _tail = 0;
+
+    uint i;
+    for( i = 0; i < _insts.size(); ++i )
+    {
+        uint inst = _insts[i];
+
+        if ( (_kind[inst] == COMBINATIONAL) && (deg[inst].load() == 0) )
+            push(inst);
+    }
+
+    waves( 0, [&]( uint inst )
+    {
+        uint k, s;
+        for( k = _out_begin[inst]; k < _out_begin[inst + 1]; ++k )
+        {
+            uint net = _out_nets[k];
+
+            for( s = _sink_begin[net]; s < _sink_begin[net + 1]; ++s )
+            {
+                uint sink = _sinks[s];
+
+                if ( deg[sink].fetch_sub(1) == 1 )
+                    push(sink);
+            }
+        }
+    } );
+
+    std::vector<char> loop( num_insts, 0 );
+
+    for( i = 0; i < _insts.size(); ++i )
+    {
+        uint inst = _insts[i];
+
+        if ( (_kind[inst] == COMBINATIONAL) && (deg[inst].load() != 0) )
+            loop[inst] = 1;
+    }
+
+    // backward: out-degree of the remaining instances inside the remainder
+    dbParallelFor( _insts.size(), _threads, [&]( uint i )
+    {
+        uint inst = _insts[i];
+        uint cnt = 0;
+
+        if ( loop[inst] )
+        {
+            uint k, s;
+            for( k = _out_begin[inst]; k < _out_begin[inst + 1]; ++k )
+            {
+                uint net = _out_nets[k];
+
+                for( s = _sink_begin[net]; s < _sink_begin[net + 1]; ++s )
+                    if ( loop[ _sinks[s] ] )
+                        ++cnt;
+            }
+        }
+
+        deg[inst].store(cnt);
+    }, 256 );
+
+    _tail = 0;
+
+    for( i = 0; i < _insts.size(); ++i )
+    {
+        uint inst = _insts[i];
+
+        if ( loop[inst] && (deg[inst].load() == 0) )
+            push(inst);
+    }
+
+    waves( 0, [&]( uint inst )
+    {
+        uint k, d;
+        for( k = _in_begin[inst]; k < _in_begin[inst + 1]; ++k )
+        {
+            uint net = _in_nets[k];
+
+            for( d = driver_begin[net]; d < driver_begin[net + 1]; ++d )
+            {
+                uint driver = drivers[d];
+
+                if ( loop[driver] && (deg[driver].fetch_sub(1) == 1) )
+                    push(driver);
+            }
+        }
+    } );
+
+    uint end = _tail.load();
+
+    for( i = 0; i < end; ++i )
+        loop[ _queue[i] ] = 0;
+
+    result.clear();
+
+    for( i = 0; i < _insts.size(); ++i )
+    {
+        if ( loop[ _insts[i] ] )
+            result.push_back( _insts[i] );
+    }
+
+    return result.size();
+}
+
+} // namespace
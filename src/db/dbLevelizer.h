@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_LEVELIZER_H
+#define ADS_DB_LEVELIZER_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#include <vector>
+#include <atomic>
+
+namespace odb {
+
+class _dbBlock;
+
+//
+// dbLevelizer - Frontier based levelization of the combinational logic of a
+// block over a flat (CSR) inst/net adjacency.
+//
+// The adjacency is read once from the iterms of the instances:
+//
+//   - the driven nets of an instance are the nets of its non-input
+//     (OUTPUT/FEEDTHRU), non-supply iterms,
+//   - the sinks of a net are the instances of its INPUT/INOUT iterms whose
+//     master is a non-sequential CORE master (the "levelable" instances).
+//
+// Each wavefront is processed on multiple threads: a sink is claimed with a
+// compare-and-swap of its level from 0 to the level of the wave, and the
+// claimed sinks are appended to a single queue that holds every wavefront
+// in order. All instances of a wave get the same level, so the result is
+// the breadth-first level of dbBlock::levelize, independently of the order
+// in which the sinks are claimed.
+//
+// Instances and nets are indexed by their database ids.
+//
+class dbLevelizer
+{
+    enum Kind
+    {
+        OTHER         = 0,
+        COMBINATIONAL = 1,  // levelable
+        SEQUENTIAL    = 2
+    };
+
+    _dbBlock *                     _block;
+    uint                           _threads;
+    std::vector<uint>              _insts;          // ids of the instances
+    std::vector<char>              _kind;           // per inst id
+    std::vector<uint>              _out_begin;      // per inst id, driven nets
+    std::vector<uint>              _out_nets;
+    std::vector<uint>              _in_begin;       // per inst id, input nets
+    std::vector<uint>              _in_nets;
+    std::vector<uint>              _sink_begin;     // per net id, sink insts
+    std::vector<uint>              _sinks;
+    std::vector<std::atomic<uint> > _level;         // per inst id
+    std::vector<uint>              _queue;
+    std::atomic<uint>              _tail;
+
+    uint instNets( uint inst, bool output, uint * nets );
+    void push( uint inst ) { _queue[_tail.fetch_add(1)] = inst; }
+    void claim( uint net, uint level );
+    void run( uint begin );
+    uint store( uint begin, uint end, bool fromPI );
+
+    template <class FN>
+    void waves( uint begin, FN fn );
+
+  public:
+    dbLevelizer( _dbBlock * block, uint threads );
+
+    // Level the fanout cones of the primary inputs. Returns the number of
+    // instances levelized.
+    uint levelizeFromPrimaryInputs();
+
+    // Level the fanout cones of the sequential instances. Returns the
+    // number of instances levelized.
+    uint levelizeFromSequential();
+
+    // Find the levelable instances that lie on a combinational cycle, or on
+    // a path between two cycles. Returns the number of instances found.
+    uint findLoops( std::vector<uint> & insts );
+};
+
+} // namespace
+
+#endif
@@ -428,7 +428,9 @@ dbLib::destroy( dbLib * lib_ )
     _dbLib * lib = (_dbLib *) lib_;
     _dbDatabase * db = lib_->getDatabase();
     dbProperty::destroyProperties(lib);
+    db->_master_index.clear();
     db->_lib_tbl->destroy( lib );
+    db->indexMasters();
 }
 
 } // namespace
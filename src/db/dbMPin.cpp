@@ -142,6 +142,7 @@ dbMPin::create( dbMTerm * mterm_ )
     mpin->_mterm = mterm->getOID();
     mpin->_next_mpin = mterm->_pins;
     mterm->_pins = mpin->getOID();
+    master->invalidateShapeCache();
     return (dbMPin *) mpin;
 }
 
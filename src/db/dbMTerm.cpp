@@ -544,6 +544,7 @@ dbMTerm::create( dbMaster * master_,
 		master_->setSequential(1);
     master->_mterm_hash.insert(mterm);
     master->_mterm_cnt++;
+    master->invalidateShapeCache();
     return (dbMTerm *) mterm;
 }
 
@@ -42,10 +42,12 @@
 #include "dbBoxItr.h"
 #include "dbMPinItr.h"
 #include "dbTargetItr.h"
+#include "dbMasterShapeCache.h"
 #include "dbHashTable.hpp"
 #include "dbTable.h"
 #include "dbTable.hpp"
 #include "db.h"
+#include <mutex>
 
 namespace odb {
 
@@ -239,6 +241,7 @@ _dbMaster::_dbMaster( _dbDatabase * db )
     ZALLOCATED(_target_itr);
 
     _mterm_hash.setTable( _mterm_tbl );
+    _shape_cache = NULL;
 }
 
 _dbMaster::_dbMaster( _dbDatabase * db, const _dbMaster & m )
@@ -289,6 +292,7 @@ _dbMaster::_dbMaster( _dbDatabase * db, const _dbMaster & m )
     ZALLOCATED(_target_itr);
 
     _mterm_hash.setTable( _mterm_tbl );
+    _shape_cache = NULL;
 }
 
 _dbMaster::~_dbMaster()
@@ -298,6 +302,7 @@ _dbMaster::~_dbMaster()
     delete _target_tbl;
     delete _box_tbl;
     delete _antenna_pin_model_tbl;
+    delete _shape_cache.load();
 /************************************ dimitri_fix ******************************
 dbMaster.cpp:270:12: warning: deleting object of polymorphic class type ‘dbBoxItr’ which has non-virtual destructor might cause undefined behavior [-Wdelete-non-virtual-dtor]
      delete _box_itr;
@@ -383,6 +388,35 @@ dbObjectTable * _dbMaster::getObjectTable( dbObjectType type )
     return getTable()->getObjectTable(type);
 }
 
+// Serializes creating the shape caches, readers that find a cache created
+// never take it.
+static std::mutex shape_cache_mutex;
+
+dbMasterShapeCache * _dbMaster::getShapeCache()
+{
+    dbMasterShapeCache * cache = _shape_cache.load( std::memory_order_acquire );
+
+    if ( cache )
+        return cache;
+
+    std::lock_guard<std::mutex> lock( shape_cache_mutex );
+    cache = _shape_cache.load( std::memory_order_relaxed );
+
+    if ( cache == NULL )
+    {
+        cache = new dbMasterShapeCache(this);
+        ZALLOCATED(cache);
+        _shape_cache.store( cache, std::memory_order_release );
+    }
+
+    return cache;
+}
+
+void _dbMaster::invalidateShapeCache()
+{
+    delete _shape_cache.exchange( NULL );
+}
+
 ////////////////////////////////////////////////////////////////////
 //
 // dbMaster - Methods
@@ -763,6 +797,7 @@ dbMaster::create( dbLib * lib_, const char * name_ )
     ZALLOCATED(master->_name);
     master->_id = db->_master_id++;
     lib->_master_hash.insert(master);
+    db->indexMaster(master);
     return (dbMaster *) master;
 }
 
@@ -52,6 +52,8 @@
 #include "dbHashTable.h"
 #endif
 
+#include <atomic>
+
 namespace odb {
 
 template <class T> class dbTable;
@@ -68,6 +70,7 @@ class dbTargetItr;
 class dbIStream;
 class dbOStream;
 class dbDiff;
+class dbMasterShapeCache;
 
 struct dbMasterFlags
 {
@@ -114,6 +117,7 @@ class _dbMaster : public dbObject
     dbTargetItr *       _target_itr;
 	int                 _clocked_mterm_index;
 	int                 _output_mterm_index;
+    std::atomic<dbMasterShapeCache *> _shape_cache;
 
     _dbMaster( _dbDatabase * db );
     _dbMaster( _dbDatabase * db, const _dbMaster & m );
@@ -123,6 +127,8 @@ class _dbMaster : public dbObject
     void differences( dbDiff & diff, const char * field, const _dbMaster & rhs ) const;
     void out( dbDiff & diff, char side, const char * field ) const;
     dbObjectTable * getObjectTable( dbObjectType type );
+    dbMasterShapeCache * getShapeCache();
+    void invalidateShapeCache();
 };
 
 dbOStream & operator<<( dbOStream & stream, const _dbMaster & master );
@@ -0,0 +1,188 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbMasterShapeCache.h"
+#include "dbMaster.h"
+#include "dbShape.h"
+#include "dbTransform.h"
+#include "db.h"
+
+namespace odb {
+
+void _dbMasterShape::getShape( int x, int y, dbShape & shape ) const
+{
+    adsRect r( _rect.xMin() + x, _rect.yMin() + y, _rect.xMax() + x, _rect.yMax() + y );
+
+    switch( _type )
+    {
+        case SEGMENT:
+            shape.setSegment(_layer, r);
+            break;
+
+        case VIA:
+            shape.setVia(_via, r);
+            break;
+
+        case VIA_BOX:
+            shape.setViaBox(_via, _layer, r);
+            break;
+    }
+}
+
+static void addBox( dbBox * box, const dbTransform & t, dbMasterShapeTable * table )
+{
+    _dbMasterShape s;
+    box->getBox(s._rect);
+    t.apply(s._rect);
+    s._via = box->getTechVia();
+
+    if ( s._via )
+    {
+        s._layer = NULL;
+        s._type = _dbMasterShape::VIA;
+    }
+    else
+    {
+        s._layer = box->getTechLayer();
+        s._type = _dbMasterShape::SEGMENT;
+    }
+
+    table->_shapes[0].push_back(s);
+
+    if ( s._via == NULL )
+    {
+        table->_shapes[1].push_back(s);
+        return;
+    }
+
+    int via_x, via_y;
+    box->getViaXY(via_x, via_y);
+
+    dbSet<dbBox> boxes = s._via->getBoxes();
+    dbSet<dbBox>::iterator itr;
+
+    for( itr = boxes.begin(); itr != boxes.end(); ++itr )
+    {
+        dbBox * vbox = *itr;
+        _dbMasterShape v;
+        adsRect b;
+        vbox->getBox(b);
+        v._rect.init( b.xMin() + via_x, b.yMin() + via_y, b.xMax() + via_x, b.yMax() + via_y );
+        t.apply(v._rect);
+        v._layer = vbox->getTechLayer();
+        v._via = s._via;
+        v._type = _dbMasterShape::VIA_BOX;
+        table->_shapes[1].push_back(v);
+    }
+}
+
+dbMasterShapeCache::dbMasterShapeCache( _dbMaster * master )
+    : _master(master)
+{
+    int i;
+    for( i = 0; i < 8; ++i )
+        _tables[i] = NULL;
+}
+
+dbMasterShapeCache::~dbMasterShapeCache()
+{
+    int i;
+    for( i = 0; i < 8; ++i )
+        delete _tables[i].load();
+}
+
+dbMasterShapeTable * dbMasterShapeCache::buildTable( dbOrientType::Value orient )
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    dbMasterShapeTable * table = _tables[orient].load( std::memory_order_relaxed );
+
+    if ( table == NULL )
+    {
+        table = build(orient);
+        _tables[orient].store( table, std::memory_order_release );
+    }
+
+    return table;
+}
+
+dbMasterShapeTable * dbMasterShapeCache::build( dbOrientType::Value orient )
+{
+    dbMasterShapeTable * table = new dbMasterShapeTable;
+    ZALLOCATED(table);
+
+    dbMaster * master = (dbMaster *) _master;
+    dbTransform t( orient );
+
+    dbSet<dbMTerm> mterms = master->getMTerms();
+    dbSet<dbMTerm>::iterator mitr;
+
+    for( mitr = mterms.begin(); mitr != mterms.end(); ++mitr )
+    {
+        table->_mterm_begin[0].push_back( table->_shapes[0].size() );
+        table->_mterm_begin[1].push_back( table->_shapes[1].size() );
+        uint first = table->_shapes[0].size();
+
+        dbSet<dbMPin> mpins = (*mitr)->getMPins();
+        dbSet<dbMPin>::iterator pitr;
+
+        for( pitr = mpins.begin(); pitr != mpins.end(); ++pitr )
+        {
+            dbSet<dbBox> boxes = (*pitr)->getGeometry();
+            dbSet<dbBox>::iterator bitr;
+
+            for( bitr = boxes.begin(); bitr != boxes.end(); ++bitr )
+                addBox( *bitr, t, table );
+        }
+
+        adsRect bbox;
+        bbox.mergeInit();
+        uint k;
+
+        for( k = first; k < table->_shapes[0].size(); ++k )
+            bbox.merge( table->_shapes[0][k]._rect );
+
+        table->_mterm_bbox.push_back(bbox);
+        table->_mterm_has_bbox.push_back( first < table->_shapes[0].size() );
+    }
+
+    table->_mterm_begin[0].push_back( table->_shapes[0].size() );
+    table->_mterm_begin[1].push_back( table->_shapes[1].size() );
+
+    dbSet<dbBox> obs = master->getObstructions();
+    dbSet<dbBox>::iterator oitr;
+
+    for( oitr = obs.begin(); oitr != obs.end(); ++oitr )
+        addBox( *oitr, t, table );
+
+    return table;
+}
+
+} // namespace
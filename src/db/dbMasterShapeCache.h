@@ -0,0 +1,143 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_MASTER_SHAPE_CACHE_H
+#define ADS_DB_MASTER_SHAPE_CACHE_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#ifndef ADS_GEOM_H
+#include "geom.h"
+#endif
+
+#ifndef ADS_DB_TYPES_H
+#include "dbTypes.h"
+#endif
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace odb {
+
+class _dbMaster;
+class dbTechLayer;
+class dbTechVia;
+class dbShape;
+
+//
+// _dbMasterShape - One pin or obstruction shape of a master, in the
+// coordinates of an orientation of the master (origin at (0,0)).
+//
+struct _dbMasterShape
+{
+    enum Type
+    {
+        SEGMENT,
+        VIA,
+        VIA_BOX
+    };
+
+    adsRect       _rect;
+    dbTechLayer * _layer;   // NULL for VIA
+    dbTechVia *   _via;     // NULL for SEGMENT
+    Type          _type;
+
+    // Set the shape translated by (x, y).
+    void getShape( int x, int y, dbShape & shape ) const;
+};
+
+//
+// dbMasterShapeTable - The shapes of a master for one orientation.
+//
+// The shapes are flattened in dbMaster::getMTerms() order: the shapes of the
+// mpins of the first mterm, then of the second, ..., then the obstructions.
+// There are two lists, one with the vias as VIA shapes and one with the vias
+// expanded into their VIA_BOX shapes.
+//
+class dbMasterShapeTable
+{
+  public:
+    std::vector<_dbMasterShape> _shapes[2];       // [expand_vias]
+    std::vector<uint>           _mterm_begin[2];  // [expand_vias][mterm-index], mterm_cnt + 1 entries
+    std::vector<adsRect>        _mterm_bbox;      // pin bbox of each mterm
+    std::vector<char>           _mterm_has_bbox;
+
+    const _dbMasterShape * begin( bool expand_vias ) const { return _shapes[expand_vias].empty() ? NULL : &_shapes[expand_vias][0]; }
+
+    // Range of the pin shapes of the mterm of index "idx".
+    const _dbMasterShape * pinsBegin( bool expand_vias, uint idx ) const { return begin(expand_vias) + _mterm_begin[expand_vias][idx]; }
+    const _dbMasterShape * pinsEnd( bool expand_vias, uint idx ) const { return begin(expand_vias) + _mterm_begin[expand_vias][idx+1]; }
+
+    // Range of the obstructions, which follow the pins of the last mterm.
+    const _dbMasterShape * obsBegin( bool expand_vias ) const { return begin(expand_vias) + _mterm_begin[expand_vias].back(); }
+    const _dbMasterShape * obsEnd( bool expand_vias ) const { return begin(expand_vias) + _shapes[expand_vias].size(); }
+
+    uint getMTermCount() const { return _mterm_bbox.size(); }
+};
+
+//
+// dbMasterShapeCache - Flattened pin and obstruction geometry of a master,
+// built once per orientation. The instance shape iterators translate these
+// shapes instead of walking the mterm/mpin/box lists and transforming every
+// box. The cache is not persistent; the master drops it whenever one of its
+// mterms, mpins or boxes is created. Concurrent lookups are safe, lookups
+// concurrent with edits of the master are not.
+//
+class dbMasterShapeCache
+{
+    _dbMaster *                         _master;
+    std::atomic<dbMasterShapeTable *>   _tables[8];  // [dbOrientType::Value]
+    std::mutex                          _mutex;      // serializes the builds
+
+    dbMasterShapeTable * build( dbOrientType::Value orient );
+    dbMasterShapeTable * buildTable( dbOrientType::Value orient );
+
+  public:
+    dbMasterShapeCache( _dbMaster * master );
+    ~dbMasterShapeCache();
+
+    const dbMasterShapeTable * getTable( dbOrientType::Value orient )
+    {
+        dbMasterShapeTable * table = _tables[orient].load( std::memory_order_acquire );
+
+        if ( table == NULL )
+            table = buildTable(orient);
+
+        return table;
+    }
+};
+
+} // namespace
+
+#endif
@@ -56,7 +56,9 @@
 #include "dbDiff.hpp"
 #include "dbShape.h"
 #include "dbJournal.h"
+#include "dbProperty.h"
 #include "dbExtControl.h"
+#include "dbRcReduce.h"
 #include "db.h"
 #include <algorithm>
 
@@ -2529,6 +2531,19 @@ dbNet::destroyParasitics ()
     block->destroyParasitics(nets);
 }
 
+uint
+dbNet::reduceParasitics(double tolerance)
+{
+    _dbBlock * block = (_dbBlock *) getOwner();
+    dbRcReduce reducer(block, tolerance);
+    dbRcReduceNet result;
+
+    if ( ! reducer.stage( (_dbNet *) this, result ) )
+        return 0;
+
+    return dbRcReduce::commit(block, result);
+}
+
 double dbNet::getTotalCouplingCap(uint corner)
 {
     double cap= 0.0;
@@ -2777,20 +2792,21 @@ dbNet::create( dbBlock * block_, const char * name_, bool skipExistingCheck )
     if ( !skipExistingCheck && block->_net_hash.hasMember(name_) )
         return NULL;
 
+    _dbNet * net = block->_net_tbl->create();
+    net->_name = strdup(name_);
+    ZALLOCATED(net->_name);
+    block->_net_hash.insert(net);
+
     if ( block->_journal )
     {
         debug("DB_ECO","A","ECO: create net, name %s\n",name_);
         block->_journal->beginAction( dbJournal::CREATE_OBJECT );
         block->_journal->pushParam( dbNetObj );
         block->_journal->pushParam( name_ );
+        block->_journal->pushParam( net->getOID() );
         block->_journal->endAction();
     }
 
-    _dbNet * net = block->_net_tbl->create();
-    net->_name = strdup(name_);
-    ZALLOCATED(net->_name);
-    block->_net_hash.insert(net);
-
     std::list<dbBlockCallBackObj *>::iterator  cbitr;
     for (cbitr = block->_callbacks.begin(); cbitr !=  block->_callbacks.end(); ++cbitr)
       (**cbitr)().inDbNetCreate((dbNet *) net); // client ECO optimization - payam
@@ -2804,6 +2820,13 @@ dbNet::destroy( dbNet * net_ )
     _dbNet * net = (_dbNet *) net_;
     _dbBlock * block = (_dbBlock *) net->getOwner();
 
+    // The journal keeps the fields of the net, so the deletion can be undone.
+    // The iterm disconnects and the removal of the wire are logged on their
+    // own; bterms, special wires, parasitics and properties are not.
+    bool restorable = (net->_bterms == 0) && (net->_swires == 0) && (net->_global_wire == 0)
+        && (net->_cap_nodes == 0) && (net->_r_segs == 0) && ! _dbProperty::hasProperties(net);
+    uint flags = *(uint *) &net->_flags;
+
     dbSet<dbITerm> iterms = net_->getITerms();
     dbSet<dbITerm>::iterator iitr;
 
@@ -2834,6 +2857,16 @@ dbNet::destroy( dbNet * net_ )
         block->_journal->beginAction( dbJournal::DELETE_OBJECT );
         block->_journal->pushParam( dbNetObj );
         block->_journal->pushParam( net->getId() );
+        block->_journal->pushParam( restorable );
+        block->_journal->pushParam( net->_name );
+        block->_journal->pushParam( flags );
+        block->_journal->pushParam( net->_gndc_calibration_factor );
+        block->_journal->pushParam( net->_cc_calibration_factor );
+        block->_journal->pushParam( net->_non_default_rule.id() );
+        block->_journal->pushParam( net->_weight );
+        block->_journal->pushParam( net->_xtalk );
+        block->_journal->pushParam( net->_ccAdjustFactor );
+        block->_journal->pushParam( net->_ccAdjustOrder );
         block->_journal->endAction();
     }
 
@@ -102,6 +102,7 @@ class _dbNet : public dbObject
         HEAD_RSEG,
         REVERSE_RSEG,
         INVALIDATETIMING,
+        WIRE
     };
 
     // PERSISTANT-MEMBERS
@@ -0,0 +1,397 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbNetlistGraph.h"
+#include "dbBlock.h"
+#include "dbNet.h"
+#include "dbInst.h"
+#include "dbITerm.h"
+#include "dbBTerm.h"
+#include "dbBox.h"
+#include "dbMaster.h"
+#include "dbMTerm.h"
+#include "dbMasterShapeCache.h"
+#include "dbTable.h"
+#include "dbParallel.h"
+#include "db.h"
+#include <algorithm>
+
+namespace odb {
+
+////////////////////////////////////////////////////////////////////
+//
+// dbNetlistGraph - Methods
+//
+////////////////////////////////////////////////////////////////////
+
+dbNetlistGraph::dbNetlistGraph()
+    : _skip_supply(true),
+      _max_fanout(0),
+      _include_bterms(true),
+      _stale(true)
+{
+}
+
+dbNetlistGraph::~dbNetlistGraph()
+{
+}
+
+void dbNetlistGraph::clear()
+{
+    removeOwner();
+    _stale = true;
+    _net_ids.clear();
+    _inst_ids.clear();
+    _net_index.clear();
+    _inst_index.clear();
+    _net_pin_begin.clear();
+    _pin_insts.clear();
+    _pin_nets.clear();
+    _pin_ids.clear();
+    _pin_dx.clear();
+    _pin_dy.clear();
+    _inst_net_begin.clear();
+    _inst_nets.clear();
+    _net_weights.clear();
+    _inst_weights.clear();
+}
+
+int dbNetlistGraph::findNet( dbNet * net ) const
+{
+    uint id = net->getId();
+    return id < _net_index.size() ? _net_index[id] : -1;
+}
+
+int dbNetlistGraph::findInst( dbInst * inst ) const
+{
+    uint id = inst->getId();
+    return id < _inst_index.size() ? _inst_index[id] : -1;
+}
+
+//
+// The graph is built in passes: the instances, nets and block terminal
+// locations are collected serially (this also builds the lazy master shape
+// tables), then the pins of each net and the nets of each instance are
+// counted and filled on multiple threads, walking the raw iterm lists.
+//
+void dbNetlistGraph::build( dbBlock * block_, uint threads )
+{
+    clear();
+    addOwner(block_);
+
+    _dbBlock * block = (_dbBlock *) block_;
+
+    // instances
+    std::vector<const dbMasterShapeTable *> tables;
+    std::vector<int> inst_cx;
+    std::vector<int> inst_cy;
+    dbSet<dbInst> insts = block_->getInsts();
+    dbSet<dbInst>::iterator iitr;
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+    {
+        dbInst * inst_ = *iitr;
+        _dbInst * inst = (_dbInst *) inst_;
+        uint id = inst->getOID();
+
+        if ( id >= _inst_index.size() )
+            _inst_index.resize( id + 1, -1 );
+
+        _inst_index[id] = _inst_ids.size();
+        _inst_ids.push_back(id);
+        _inst_weights.push_back( inst->_weight );
+
+        _dbMaster * master = (_dbMaster *) inst_->getMaster();
+        tables.push_back( master->getShapeCache()->getTable( inst_->getOrient() ) );
+
+        _dbBox * box = block->_box_tbl->getPtr(inst->_bbox);
+        inst_cx.push_back( (box->_rect.xMin() + box->_rect.xMax()) / 2 );
+        inst_cy.push_back( (box->_rect.yMin() + box->_rect.yMax()) / 2 );
+    }
+
+    // candidate nets
+    std::vector<_dbNet *> nets;
+    dbSet<dbNet> bnets = block_->getNets();
+    dbSet<dbNet>::iterator nitr;
+
+    for( nitr = bnets.begin(); nitr != bnets.end(); ++nitr )
+    {
+        _dbNet * net = (_dbNet *) *nitr;
+        dbSigType::Value type = net->_flags._sig_type;
+
+        if ( _skip_supply && ((type == dbSigType::POWER) || (type == dbSigType::GROUND)) )
+            continue;
+
+        nets.push_back(net);
+    }
+
+    // block terminal locations
+    std::vector<int> bterm_x;
+    std::vector<int> bterm_y;
+
+    if ( _include_bterms )
+    {
+        dbSet<dbBTerm> bterms = block_->getBTerms();
+        dbSet<dbBTerm>::iterator bitr;
+
+        for( bitr = bterms.begin(); bitr != bterms.end(); ++bitr )
+        {
+            dbBTerm * bterm = *bitr;
+            uint id = bterm->getId();
+
+            if ( id >= bterm_x.size() )
+            {
+                bterm_x.resize( id + 1, 0 );
+                bterm_y.resize( id + 1, 0 );
+            }
+
+            bterm->getFirstPinLocation( bterm_x[id], bterm_y[id] );
+        }
+    }
+
+    // pins of each net
+    uint num_nets = nets.size();
+    std::vector<int> pin_cnt( num_nets );
+    bool include_bterms = _include_bterms;
+
+    dbParallelFor( num_nets, threads, [&]( uint n )
+    {
+        _dbNet * net = nets[n];
+        int cnt = 0;
+        dbId<_dbITerm> iid;
+
+        for( iid = net->_iterms; iid != 0; iid = block->_iterm_tbl->getPtr(iid)->_next_net_iterm )
+            ++cnt;
+
+        if ( include_bterms )
+        {
+            dbId<_dbBTerm> bid;
+
+            for( bid = net->_bterms; bid != 0; bid = block->_bterm_tbl->getPtr(bid)->_next_bterm )
+                ++cnt;
+        }
+
+        pin_cnt[n] = cnt;
+    }, 256 );
+
+    std::vector<_dbNet *> graph_nets;
+    int num_pins = 0;
+    uint n;
+
+    for( n = 0; n < num_nets; ++n )
+    {
+        if ( _max_fanout && ((uint) pin_cnt[n] > _max_fanout) )
+            continue;
+
+        _dbNet * net = nets[n];
+        uint id = net->getOID();
+
+        if ( id >= _net_index.size() )
+            _net_index.resize( id + 1, -1 );
+
+        _net_index[id] = _net_ids.size();
+        _net_ids.push_back(id);
+        _net_weights.push_back( net->_weight );
+        _net_pin_begin.push_back(num_pins);
+        graph_nets.push_back(net);
+        num_pins += pin_cnt[n];
+    }
+
+    _net_pin_begin.push_back(num_pins);
+
+    _pin_insts.resize(num_pins);
+    _pin_nets.resize(num_pins);
+    _pin_ids.resize(num_pins);
+    _pin_dx.resize(num_pins);
+    _pin_dy.resize(num_pins);
+
+    dbParallelFor( graph_nets.size(), threads, [&]( uint n )
+    {
+        _dbNet * net = graph_nets[n];
+        int p = _net_pin_begin[n];
+        dbId<_dbITerm> iid;
+
+        for( iid = net->_iterms; iid != 0; )
+        {
+            _dbITerm * iterm = block->_iterm_tbl->getPtr(iid);
+            int i = _inst_index[iterm->_inst];
+            const dbMasterShapeTable * table = tables[i];
+            uint idx = iterm->getMTerm()->_order_id;
+
+            _pin_insts[p] = i;
+            _pin_nets[p] = n;
+            _pin_ids[p] = iterm->getOID();
+            _pin_dx[p] = 0;
+            _pin_dy[p] = 0;
+
+            if ( table->_mterm_has_bbox[idx] )
+            {
+                _dbInst * inst = block->_inst_tbl->getPtr(iterm->_inst);
+                const adsRect & r = table->_mterm_bbox[idx];
+                _pin_dx[p] = inst->_x + (r.xMin() + r.xMax()) / 2 - inst_cx[i];
+                _pin_dy[p] = inst->_y + (r.yMin() + r.yMax()) / 2 - inst_cy[i];
+            }
+
+            ++p;
+            iid = iterm->_next_net_iterm;
+        }
+
+        if ( include_bterms )
+        {
+            dbId<_dbBTerm> bid;
+
+            for( bid = net->_bterms; bid != 0; bid = block->_bterm_tbl->getPtr(bid)->_next_bterm )
+            {
+                _pin_insts[p] = -1;
+                _pin_nets[p] = n;
+                _pin_ids[p] = bid;
+                _pin_dx[p] = bterm_x[bid];
+                _pin_dy[p] = bterm_y[bid];
+                ++p;
+            }
+        }
+    }, 256 );
+
+    // nets of each instance, without duplicates
+    uint num_insts = _inst_ids.size();
+    std::vector<int> net_cnt( num_insts + 1, 0 );
+
+    auto getInstNets = [&]( uint i, std::vector<int> & inets )
+    {
+        _dbInst * inst = block->_inst_tbl->getPtr( _inst_ids[i] );
+        inets.clear();
+
+        uint k;
+        for( k = 0; k < inst->_iterms.size(); ++k )
+        {
+            _dbITerm * iterm = block->_iterm_tbl->getPtr( inst->_iterms[k] );
+            uint net = iterm->_net;
+
+            if ( (net != 0) && (net < _net_index.size()) && (_net_index[net] >= 0) )
+                inets.push_back( _net_index[net] );
+        }
+
+        std::sort( inets.begin(), inets.end() );
+        inets.erase( std::unique( inets.begin(), inets.end() ), inets.end() );
+    };
+
+    dbParallelFor( num_insts, threads, [&]( uint i )
+    {
+        std::vector<int> inets;
+        getInstNets( i, inets );
+        net_cnt[i] = inets.size();
+    }, 256 );
+
+    _inst_net_begin.resize( num_insts + 1 );
+    int num_inst_nets = 0;
+    uint i;
+
+    for( i = 0; i <= num_insts; ++i )
+    {
+        _inst_net_begin[i] = num_inst_nets;
+        num_inst_nets += net_cnt[i];
+    }
+
+    _inst_nets.resize(num_inst_nets);
+
+    dbParallelFor( num_insts, threads, [&]( uint i )
+    {
+        std::vector<int> inets;
+        getInstNets( i, inets );
+        std::copy( inets.begin(), inets.end(), _inst_nets.begin() + _inst_net_begin[i] );
+    }, 256 );
+
+    _stale = false;
+}
+
+void dbNetlistGraph::inDbInstCreate( dbInst * )
+{
+    _stale = true;
+}
+
+void dbNetlistGraph::inDbInstCreate( dbInst *, dbRegion * )
+{
+    _stale = true;
+}
+
+void dbNetlistGraph::inDbInstDestroy( dbInst * )
+{
+    _stale = true;
+}
+
+void dbNetlistGraph::inDbInstSwapMasterAfter( dbInst * )
+{
+    _stale = true;
+}
+
+void dbNetlistGraph::inDbNetCreate( dbNet * )
+{
+    _stale = true;
+}
+
+void dbNetlistGraph::inDbNetDestroy( dbNet * )
+{
+    _stale = true;
+}
+
+void dbNetlistGraph::inDbITermCreate( dbITerm * )
+{
+    _stale = true;
+}
+
+void dbNetlistGraph::inDbITermDestroy( dbITerm * )
+{
+    _stale = true;
+}
+
+void dbNetlistGraph::inDbITermConnect( dbITerm * )
+{
+    _stale = true;
+}
+
+void dbNetlistGraph::inDbITermDisconnect( dbITerm * )
+{
+    _stale = true;
+}
+
+void dbNetlistGraph::inDbBTermCreate( dbBTerm * )
+{
+    if ( _include_bterms )
+        _stale = true;
+}
+
+void dbNetlistGraph::inDbBTermDestroy( dbBTerm * )
+{
+    if ( _include_bterms )
+        _stale = true;
+}
+
+} // namespace
@@ -49,6 +49,7 @@
 #endif
 
 #include "logger.h"
+#include <algorithm>
 namespace odb {
 
 template <class T, const uint P, const uint S> class dbPagedVector;
@@ -93,6 +94,19 @@ class dbPagedVector
             push_back(item);
         return id;
     }
+
+    // Append cnt items in page sized runs.
+    void push_back( const T * items, uint cnt );
+
+    // Copy cnt items starting at idx into items.
+    void get( uint idx, T * items, uint cnt ) const;
+
+    // Discard the items at [sz, size()), the pages are retained for reuse.
+    void truncate( uint sz )
+    {
+        ZASSERT( sz <= _next_idx );
+        _next_idx = sz;
+    }
       
     unsigned int size() const { return _next_idx; }
     unsigned int getIdx(uint chunkSize, const T & ival); // DKF - to delete
@@ -285,6 +299,51 @@ void dbPagedVector<T,P,S>::push_back( const T & item )
     objects[offset] = item;
 }
 
+template <class T, const uint P, const uint S>
+void dbPagedVector<T,P,S>::push_back( const T * items, uint cnt )
+{
+    while( cnt )
+    {
+        unsigned int page = (_next_idx & ~(P-1)) >> S;
+
+        if ( page == _page_cnt )
+            newPage();
+
+        unsigned int offset = _next_idx & (P-1);
+        unsigned int n = P - offset;
+
+        if ( n > cnt )
+            n = cnt;
+
+        std::copy( items, items + n, _pages[page] + offset );
+        _next_idx += n;
+        items += n;
+        cnt -= n;
+    }
+}
+
+template <class T, const uint P, const uint S>
+void dbPagedVector<T,P,S>::get( uint idx, T * items, uint cnt ) const
+{
+    ZASSERT( idx + cnt <= _next_idx );
+
+    while( cnt )
+    {
+        unsigned int page = (idx & ~(P-1)) >> S;
+        unsigned int offset = idx & (P-1);
+        unsigned int n = P - offset;
+
+        if ( n > cnt )
+            n = cnt;
+
+        const T * objects = _pages[page] + offset;
+        std::copy( objects, objects + n, items );
+        idx += n;
+        items += n;
+        cnt -= n;
+    }
+}
+
 template <class T, const uint P, const uint S>
 inline bool dbPagedVector<T,P,S>::operator==( const dbPagedVector<T,P,S> & rhs ) const
 {
@@ -36,6 +36,7 @@
 #include "dbDatabase.h"
 #include "dbChip.h"
 #include "dbBlock.h"
+#include "dbAttrColumn.h"
 #include "dbTech.h"
 #include "dbLib.h"
 #include "dbTable.h"
@@ -58,6 +59,7 @@ _dbProperty::_dbProperty( _dbDatabase *, const _dbProperty & n )
 _dbProperty::_dbProperty( _dbDatabase * )
 {
     _flags._type = DB_STRING_PROP;
+    _flags._column = 0;
     _flags._spare_bits = 0;
     _name = 0;
     _owner = 0;
@@ -89,7 +91,13 @@ bool _dbProperty::operator==( const _dbProperty & rhs ) const
     switch( _flags._type )
     {
         case DB_STRING_PROP:
-            if ( strcmp( _value._str_val, rhs._value._str_val ) != 0 )
+            // The value of a column-backed property is held by the column.
+            if ( (_value._str_val == NULL) || (rhs._value._str_val == NULL) )
+            {
+                if ( _value._str_val != rhs._value._str_val )
+                    return false;
+            }
+            else if ( strcmp( _value._str_val, rhs._value._str_val ) != 0 )
                 return false;
 
             break;
@@ -145,12 +153,19 @@ void _dbProperty::out( dbDiff & diff, char side, const char * field  ) const
 
 dbOStream & operator<<( dbOStream & stream, const _dbProperty & prop )
 {
-    uint *bit_field = (uint *) &prop._flags;
+    // The value of a column-backed property is saved with the column.
+    _dbPropertyFlags flags = prop._flags;
+    flags._column = _dbAttrColumn::getColumn( (_dbProperty *) &prop ) != NULL;
+
+    uint *bit_field = (uint *) &flags;
     stream << *bit_field;
     stream << prop._name;
     stream << prop._next;
     stream << prop._owner;
 
+    if ( flags._column )
+        return stream;
+
     switch(  prop._flags._type )
     {
         case DB_BOOL_PROP:
@@ -181,6 +196,12 @@ dbIStream & operator>>( dbIStream & stream, _dbProperty & prop )
     stream >> prop._next;
     stream >> prop._owner;
 
+    if ( prop._flags._column && stream.getDatabase()->isSchema(ADS_DB_COLUMN_PROPERTIES) )
+    {
+        prop._flags._column = 0;
+        return stream;
+    }
+
     switch(  prop._flags._type )
     {
         case DB_BOOL_PROP:
@@ -475,6 +496,12 @@ void dbProperty::destroy( dbProperty * prop_ )
         cur = p->_next;
     }
 
+    // Remove the value from the backing column
+    _dbAttrColumn * column = _dbAttrColumn::getColumn(prop);
+
+    if ( column )
+        column->clearValue(prop->_owner);
+
     // Remove reference to name
     _dbNameCache * cache = _dbProperty::getNameCache(prop);
     cache->removeName(prop->_name);
@@ -485,9 +512,37 @@ void dbProperty::destroy( dbProperty * prop_ )
     propTable->destroy( prop );
 }
 
+bool _dbProperty::hasProperties( dbObject * object )
+{
+    uint oid = object->getOID();
+    dbObject * owner = object->getOwner();
+
+    if ( owner->getObjectType() == dbBlockObj )
+    {
+        _dbAttrStore * store = ((_dbBlock *) owner)->_attr_store;
+
+        if ( store->hasValues( object->getObjectType(), oid ) )
+            return true;
+    }
+
+    return object->getTable()->getPropList(oid) != 0;
+}
+
 void dbProperty::destroyProperties( dbObject * obj )
 {
     uint oid = obj->getOID();
+
+    // Clear the attribute-column values of block objects
+    dbObject * owner = obj->getOwner();
+
+    if ( owner->getObjectType() == dbBlockObj )
+    {
+        _dbAttrStore * store = ((_dbBlock *) owner)->_attr_store;
+
+        if ( ! store->_columns.empty() )
+            store->clearObject( obj->getObjectType(), oid );
+    }
+
     dbObjectTable * objTable = obj->getTable();
     dbId<_dbProperty> cur = objTable->getPropList(oid);
 
@@ -523,13 +578,23 @@ dbSet<dbProperty>::iterator dbProperty::destroy( dbSet<dbProperty>::iterator itr
 bool dbBoolProperty::getValue()
 {
     _dbProperty * prop = (_dbProperty *) this;
+    _dbAttrColumn * column = _dbAttrColumn::getColumn(prop);
+
+    if ( column && column->isValid(prop->_owner) )
+        return column->getInt(prop->_owner) != 0;
+
     return prop->_value._bool_val;
 }
 
 void dbBoolProperty::setValue( bool value )
 {
     _dbProperty * prop = (_dbProperty *) this;
-    prop->_value._bool_val = value;
+    _dbAttrColumn * column = _dbAttrColumn::getColumn(prop);
+
+    if ( column )
+        column->setInt(prop->_owner, value ? 1 : 0);
+    else
+        prop->_value._bool_val = value;
 }
 
 dbBoolProperty * dbBoolProperty::create( dbObject * object, const char * name, bool value )
@@ -538,8 +603,9 @@ dbBoolProperty * dbBoolProperty::create( dbObject * object, const char * name, b
         return NULL;
 
     _dbProperty * prop = _dbProperty::createProperty( object, name, DB_BOOL_PROP );
-    prop->_value._bool_val = value;
-    return (dbBoolProperty *) prop;
+    dbBoolProperty * p = (dbBoolProperty *) prop;
+    p->setValue(value);
+    return p;
 }
 
 dbBoolProperty * dbBoolProperty::find( dbObject * object, const char * name )
@@ -554,6 +620,14 @@ dbBoolProperty * dbBoolProperty::find( dbObject * object, const char * name )
 dbString dbStringProperty::getValue()
 {
     _dbProperty * prop = (_dbProperty *) this;
+    _dbAttrColumn * column = _dbAttrColumn::getColumn(prop);
+
+    if ( column && column->isValid(prop->_owner) )
+    {
+        dbString s( column->getString(prop->_owner) );
+        return s;
+    }
+
     dbString s(prop->_value._str_val);
     return s;
 }
@@ -562,6 +636,13 @@ void dbStringProperty::setValue( const char * value )
 {
     _dbProperty * prop = (_dbProperty *) this;
     assert(value);
+    _dbAttrColumn * column = _dbAttrColumn::getColumn(prop);
+
+    if ( column )
+    {
+        column->setString(prop->_owner, value);
+        return;
+    }
 
     if ( prop->_value._str_val )
         free( (void *) prop->_value._str_val );
@@ -576,9 +657,9 @@ dbStringProperty * dbStringProperty::create( dbObject * object, const char * nam
         return NULL;
 
     _dbProperty * prop = _dbProperty::createProperty( object, name, DB_STRING_PROP );
-    prop->_value._str_val = strdup(value);
-    ZALLOCATED(prop->_value._str_val);
-    return (dbStringProperty *) prop;
+    dbStringProperty * p = (dbStringProperty *) prop;
+    p->setValue(value);
+    return p;
 }
 
 dbStringProperty * dbStringProperty::find( dbObject * object, const char * name )
@@ -593,13 +674,23 @@ dbStringProperty * dbStringProperty::find( dbObject * object, const char * name
 int dbIntProperty::getValue()
 {
     _dbProperty * prop = (_dbProperty *) this;
+    _dbAttrColumn * column = _dbAttrColumn::getColumn(prop);
+
+    if ( column && column->isValid(prop->_owner) )
+        return column->getInt(prop->_owner);
+
     return prop->_value._int_val;
 }
 
 void dbIntProperty::setValue( int value )
 {
     _dbProperty * prop = (_dbProperty *) this;
-    prop->_value._int_val = value;
+    _dbAttrColumn * column = _dbAttrColumn::getColumn(prop);
+
+    if ( column )
+        column->setInt(prop->_owner, value);
+    else
+        prop->_value._int_val = value;
 }
 
 dbIntProperty * dbIntProperty::create( dbObject * object, const char * name, int value )
@@ -608,8 +699,9 @@ dbIntProperty * dbIntProperty::create( dbObject * object, const char * name, int
         return NULL;
 
     _dbProperty * prop = _dbProperty::createProperty( object, name, DB_INT_PROP );
-    prop->_value._int_val = value;
-    return (dbIntProperty *) prop;
+    dbIntProperty * p = (dbIntProperty *) prop;
+    p->setValue(value);
+    return p;
 }
 
 dbIntProperty * dbIntProperty::find( dbObject * object, const char * name )
@@ -624,13 +716,23 @@ dbIntProperty * dbIntProperty::find( dbObject * object, const char * name )
 double dbDoubleProperty::getValue()
 {
     _dbProperty * prop = (_dbProperty *) this;
+    _dbAttrColumn * column = _dbAttrColumn::getColumn(prop);
+
+    if ( column && column->isValid(prop->_owner) )
+        return column->getDouble(prop->_owner);
+
     return prop->_value._double_val;
 }
 
 void dbDoubleProperty::setValue( double value )
 {
     _dbProperty * prop = (_dbProperty *) this;
-    prop->_value._double_val = value;
+    _dbAttrColumn * column = _dbAttrColumn::getColumn(prop);
+
+    if ( column )
+        column->setDouble(prop->_owner, value);
+    else
+        prop->_value._double_val = value;
 }
 
 dbDoubleProperty * dbDoubleProperty::create( dbObject * object, const char * name, double value )
@@ -639,8 +741,9 @@ dbDoubleProperty * dbDoubleProperty::create( dbObject * object, const char * nam
         return NULL;
 
     _dbProperty * prop = _dbProperty::createProperty( object, name, DB_DOUBLE_PROP );
-    prop->_value._double_val = value;
-    return (dbDoubleProperty *) prop;
+    dbDoubleProperty * p = (dbDoubleProperty *) prop;
+    p->setValue(value);
+    return p;
 }
 
 dbDoubleProperty * dbDoubleProperty::find( dbObject * object, const char * name )
@@ -72,7 +72,8 @@ struct _dbPropertyFlags
 {
     _PropTypeEnum  _type         : 4;
     uint           _owner_type   : 8;
-    uint           _spare_bits   : 20;
+    uint           _column       : 1;  // stream only: the value is in an attribute column
+    uint           _spare_bits   : 19;
 };
 
 class _dbProperty : public dbObject
@@ -105,6 +106,9 @@ class _dbProperty : public dbObject
     static _dbNameCache * getNameCache( dbObject * object );
     static dbPropertyItr * getItr( dbObject * object );
     static _dbProperty * createProperty( dbObject * object, const char * name, _PropTypeEnum type );
+
+    // True if the object has properties or attribute-column values.
+    static bool hasProperties( dbObject * object );
 };
 
 dbOStream & operator<<( dbOStream & stream, const _dbProperty & prop );
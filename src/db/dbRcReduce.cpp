@@ -0,0 +1,757 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbRcReduce.h"
+#include "db.h"
+#include "dbBlock.h"
+#include "dbNet.h"
+#include "dbRSeg.h"
+#include "dbCapNode.h"
+#include "dbTable.h"
+#include "dbJournal.h"
+#include <algorithm>
+
+namespace odb {
+
+dbRcReduce::dbRcReduce( _dbBlock * block, double tolerance )
+        : _block(block),
+          _corners(block->_corners_per_block),
+          _tolerance(tolerance)
+{
+}
+
+int dbRcReduce::findNode( std::vector<std::pair<uint,uint> > & ids, uint id )
+{
+    std::vector<std::pair<uint,uint> >::iterator itr;
+    itr = std::lower_bound( ids.begin(), ids.end(), std::make_pair(id, 0U) );
+
+    if ( (itr == ids.end()) || (itr->first != id) )
+        return -1;
+
+    return (int) itr->second;
+}
+
+//
+// Load the RC graph of the net into the local node/seg arrays. The cap of an
+// allocated rseg belongs to its target node, so both storage schemes end up
+// as per-node capacitances.
+//
+bool dbRcReduce::load( _dbNet * net, bool & alloc_cap )
+{
+    _nodes.clear();
+    _segs.clear();
+    _res.clear();
+    _cap.clear();
+    _queue.clear();
+
+    if ( (net->_r_segs == 0) || (net->_cap_nodes == 0) || (_corners == 0) )
+        return false;
+
+    dbSigType sig_type( net->_flags._sig_type );
+
+    if ( (sig_type == dbSigType::POWER) || (sig_type == dbSigType::GROUND) )
+        return false;
+
+    _dbRSeg * zero = _block->_r_seg_tbl->getPtr( net->_r_segs );
+    alloc_cap = zero->_flags._allocated_cap == 1;
+
+    std::vector<std::pair<uint,uint> > ids;
+    uint id;
+    bool foreign = false;
+    bool plain = false;
+
+    for( id = net->_cap_nodes; id != 0; )
+    {
+        _dbCapNode * n = _block->_cap_node_tbl->getPtr( id );
+
+        if ( alloc_cap && n->_flags._foreign )
+            return false; // mixed cap storage
+
+        // Without allocated rseg caps only foreign nodes can hold a
+        // capacitance, cap folded into any other node would be lost.
+        if ( n->_flags._foreign )
+            foreign = true;
+        else
+            plain = true;
+
+        if ( ! alloc_cap && foreign && plain )
+            return false; // mixed cap storage
+
+        Node node;
+        node._id = id;
+        node._keep = n->_flags._iterm || n->_flags._bterm || (n->_cc_segs != 0);
+        node._alive = true;
+        node._queued = false;
+        ids.push_back( std::make_pair(id, (uint) _nodes.size()) );
+        _nodes.push_back(node);
+
+        uint c;
+        for( c = 0; c < _corners; ++c )
+        {
+            if ( n->_flags._foreign )
+                _cap.push_back( (*_block->_c_val_tbl)[(id-1)*_corners + 1 + c] );
+            else
+                _cap.push_back( 0.0 );
+        }
+
+        id = n->_next;
+    }
+
+    std::sort( ids.begin(), ids.end() );
+
+    int root = findNode( ids, zero->_target );
+
+    if ( root < 0 )
+        return false;
+
+    _nodes[root]._keep = true;
+
+    uint c;
+    if ( alloc_cap )
+    {
+        for( c = 0; c < _corners; ++c )
+            _cap[root*_corners + c] += (*_block->_c_val_tbl)[(zero->getOID()-1)*_corners + 1 + c];
+    }
+
+    for( id = zero->_next; id != 0; )
+    {
+        _dbRSeg * s = _block->_r_seg_tbl->getPtr( id );
+
+        if ( (s->_flags._allocated_cap == 1) != alloc_cap )
+            return false;
+
+        int src = findNode( ids, s->_source );
+        int tgt = findNode( ids, s->_target );
+
+        if ( (src < 0) || (tgt < 0) )
+            return false;
+
+        Seg seg;
+        seg._id = id;
+        seg._n[0] = src;
+        seg._n[1] = tgt;
+        seg._alive = true;
+        uint sid = _segs.size();
+        _segs.push_back(seg);
+
+        for( c = 0; c < _corners; ++c )
+        {
+            _res.push_back( (*_block->_r_val_tbl)[(id-1)*_corners + 1 + c] );
+
+            if ( alloc_cap )
+                _cap[tgt*_corners + c] += (*_block->_c_val_tbl)[(id-1)*_corners + 1 + c];
+        }
+
+        _nodes[src]._segs.push_back(sid);
+
+        if ( src != tgt )
+            _nodes[tgt]._segs.push_back(sid);
+        else
+            _segs[sid]._alive = false; // self-loop, cap is already on the node
+
+        id = s->_next;
+    }
+
+    _root = root;
+    _zero = zero->getOID();
+    return true;
+}
+
+uint dbRcReduce::degree( uint n )
+{
+    std::vector<uint> & segs = _nodes[n]._segs;
+    uint i, j = 0;
+
+    for( i = 0; i < segs.size(); ++i )
+    {
+        if ( _segs[segs[i]]._alive )
+            segs[j++] = segs[i];
+    }
+
+    segs.resize(j);
+    return j;
+}
+
+void dbRcReduce::push( uint n )
+{
+    if ( _nodes[n]._queued || ! _nodes[n]._alive || _nodes[n]._keep )
+        return;
+
+    _nodes[n]._queued = true;
+    _queue.push_back(n);
+}
+
+void dbRcReduce::killNode( uint n )
+{
+    _nodes[n]._alive = false;
+    _nodes[n]._segs.clear();
+}
+
+void dbRcReduce::foldLeaf( uint n )
+{
+    uint s = _nodes[n]._segs[0];
+    uint m = other(s, n);
+    uint c;
+
+    for( c = 0; c < _corners; ++c )
+        _cap[m*_corners + c] += _cap[n*_corners + c];
+
+    _segs[s]._alive = false;
+    killNode(n);
+    push(m);
+}
+
+void dbRcReduce::mergeParallel( uint s1, uint s2 )
+{
+    uint c;
+    for( c = 0; c < _corners; ++c )
+    {
+        double r1 = _res[s1*_corners + c];
+        double r2 = _res[s2*_corners + c];
+        double r = r1 + r2;
+        _res[s1*_corners + c] = r > 0.0 ? r1 * r2 / r : 0.0;
+    }
+
+    _segs[s2]._alive = false;
+}
+
+//
+// Attach seg "s" to node "n" (already an endpoint of s), merging it with a
+// parallel seg of n if there is one.
+//
+void dbRcReduce::attach( uint s, uint n )
+{
+    uint o = other(s, n);
+    std::vector<uint> & segs = _nodes[n]._segs;
+    uint i;
+
+    for( i = 0; i < segs.size(); ++i )
+    {
+        uint t = segs[i];
+
+        if ( (t != s) && _segs[t]._alive && (other(t, n) == o) )
+        {
+            mergeParallel(t, s);
+            push(n);
+            push(o);
+            return;
+        }
+    }
+
+    segs.push_back(s);
+}
+
+//
+// Remove node n between segs s1 (to a) and s2 (to b). The node cap is split
+// as C*R2/R to a and C*R1/R to b, which keeps the first moment (Elmore delay)
+// of every remaining node of a tree unchanged.
+//
+void dbRcReduce::mergeSeries( uint n )
+{
+    uint s1 = _nodes[n]._segs[0];
+    uint s2 = _nodes[n]._segs[1];
+    uint a = other(s1, n);
+    uint b = other(s2, n);
+    uint c;
+
+    for( c = 0; c < _corners; ++c )
+    {
+        double r1 = _res[s1*_corners + c];
+        double r2 = _res[s2*_corners + c];
+        double r = r1 + r2;
+        double cap = _cap[n*_corners + c];
+
+        if ( r > 0.0 )
+        {
+            _cap[a*_corners + c] += cap * r2 / r;
+            _cap[b*_corners + c] += cap * r1 / r;
+        }
+        else
+        {
+            _cap[a*_corners + c] += cap * 0.5;
+            _cap[b*_corners + c] += cap * 0.5;
+        }
+
+        _res[s1*_corners + c] = r;
+        _res[s2*_corners + c] = r;
+    }
+
+    // Keep the seg that has n as its source, so the surviving seg still
+    // ends at (and keeps the coordinates of) its original target.
+    uint keep, drop, far;
+
+    if ( _segs[s2]._n[0] == n )
+    {
+        keep = s2;
+        drop = s1;
+        far = a;
+    }
+    else
+    {
+        keep = s1;
+        drop = s2;
+        far = b;
+    }
+
+    if ( _segs[keep]._n[0] == n )
+        _segs[keep]._n[0] = far;
+    else
+        _segs[keep]._n[1] = far;
+
+    _segs[drop]._alive = false;
+    killNode(n);
+    attach(keep, far);
+    push(a);
+    push(b);
+}
+
+//
+// Short seg s by merging node "victim" into node "keep".
+//
+void dbRcReduce::shortSeg( uint s, uint keep, uint victim )
+{
+    uint c;
+    for( c = 0; c < _corners; ++c )
+        _cap[keep*_corners + c] += _cap[victim*_corners + c];
+
+    _segs[s]._alive = false;
+
+    std::vector<uint> segs;
+    segs.swap( _nodes[victim]._segs );
+    killNode(victim);
+
+    uint i;
+    for( i = 0; i < segs.size(); ++i )
+    {
+        uint t = segs[i];
+
+        if ( ! _segs[t]._alive )
+            continue;
+
+        if ( _segs[t]._n[0] == victim )
+            _segs[t]._n[0] = keep;
+
+        if ( _segs[t]._n[1] == victim )
+            _segs[t]._n[1] = keep;
+
+        if ( _segs[t]._n[0] == _segs[t]._n[1] )
+        {
+            _segs[t]._alive = false;
+            continue;
+        }
+
+        attach(t, keep);
+        push( other(t, keep) );
+    }
+
+    push(keep);
+}
+
+bool dbRcReduce::collapse()
+{
+    bool changed = false;
+
+    while( ! _queue.empty() )
+    {
+        uint n = _queue.back();
+        _queue.pop_back();
+        _nodes[n]._queued = false;
+
+        if ( ! _nodes[n]._alive || _nodes[n]._keep )
+            continue;
+
+        uint d = degree(n);
+
+        if ( d == 0 )
+        {
+            uint c;
+            for( c = 0; c < _corners; ++c )
+            {
+                if ( _cap[n*_corners + c] != 0.0 )
+                    break;
+            }
+
+            if ( c == _corners )
+            {
+                killNode(n);
+                changed = true;
+            }
+        }
+        else if ( d == 1 )
+        {
+            foldLeaf(n);
+            changed = true;
+        }
+        else if ( d == 2 )
+        {
+            uint s1 = _nodes[n]._segs[0];
+            uint s2 = _nodes[n]._segs[1];
+
+            if ( other(s1, n) == other(s2, n) )
+            {
+                mergeParallel(s1, s2);
+                push( other(s1, n) );
+                push(n);
+            }
+            else
+            {
+                mergeSeries(n);
+            }
+
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+bool dbRcReduce::shortSmallSegs()
+{
+    if ( _tolerance <= 0.0 )
+        return false;
+
+    bool changed = false;
+    uint s;
+
+    for( s = 0; s < _segs.size(); ++s )
+    {
+        if ( ! _segs[s]._alive )
+            continue;
+
+        uint c;
+        for( c = 0; c < _corners; ++c )
+        {
+            if ( _res[s*_corners + c] > _tolerance * _rtotal[c] )
+                break;
+        }
+
+        if ( c != _corners )
+            continue;
+
+        uint src = _segs[s]._n[0];
+        uint tgt = _segs[s]._n[1];
+
+        if ( ! _nodes[tgt]._keep )
+            shortSeg(s, src, tgt);
+        else if ( ! _nodes[src]._keep )
+            shortSeg(s, tgt, src);
+        else
+            continue;
+
+        changed = true;
+    }
+
+    return changed;
+}
+
+//
+// Copy the reduced graph into the result. For allocated caps every node
+// needs exactly one incoming rseg to hold its capacitance, so the surviving
+// segs are re-oriented away from the driver (the target of the zero rseg).
+//
+void dbRcReduce::store( bool alloc_cap, dbRcReduceNet & result )
+{
+    uint n, s, c;
+    std::vector<int> parent_seg( _nodes.size(), -1 );
+
+    if ( alloc_cap )
+    {
+        std::vector<bool> visited( _nodes.size(), false );
+        std::vector<uint> stack;
+        stack.push_back(_root);
+        visited[_root] = true;
+
+        while( ! stack.empty() )
+        {
+            n = stack.back();
+            stack.pop_back();
+            degree(n);
+
+            uint i;
+            for( i = 0; i < _nodes[n]._segs.size(); ++i )
+            {
+                s = _nodes[n]._segs[i];
+                uint m = other(s, n);
+
+                if ( visited[m] )
+                    continue;
+
+                visited[m] = true;
+                parent_seg[m] = s;
+                _segs[s]._n[0] = n;
+                _segs[s]._n[1] = m;
+                stack.push_back(m);
+            }
+        }
+
+        for( n = 0; n < _nodes.size(); ++n )
+        {
+            if ( _nodes[n]._alive && ! visited[n] )
+                return; // disconnected, leave the net as is
+        }
+
+        // zero rseg holds the cap of the driver node
+        dbRcReduceNet::Seg zseg;
+        zseg._id = _zero;
+        zseg._source = 0;
+        zseg._target = _nodes[_root]._id;
+        result._segs.push_back(zseg);
+
+        for( c = 0; c < _corners; ++c )
+        {
+            result._seg_res.push_back( (*_block->_r_val_tbl)[(_zero-1)*_corners + 1 + c] );
+            result._seg_cap.push_back( _cap[_root*_corners + c] );
+        }
+    }
+
+    for( s = 0; s < _segs.size(); ++s )
+    {
+        if ( ! _segs[s]._alive )
+        {
+            result._dead_segs.push_back( _segs[s]._id );
+            continue;
+        }
+
+        dbRcReduceNet::Seg seg;
+        seg._id = _segs[s]._id;
+        seg._source = _nodes[ _segs[s]._n[0] ]._id;
+        seg._target = _nodes[ _segs[s]._n[1] ]._id;
+        result._segs.push_back(seg);
+
+        uint tgt = _segs[s]._n[1];
+        bool tree_seg = parent_seg[tgt] == (int) s;
+
+        for( c = 0; c < _corners; ++c )
+        {
+            result._seg_res.push_back( _res[s*_corners + c] );
+
+            if ( alloc_cap )
+                result._seg_cap.push_back( tree_seg ? _cap[tgt*_corners + c] : 0.0 );
+        }
+    }
+
+    for( n = 0; n < _nodes.size(); ++n )
+    {
+        if ( ! _nodes[n]._alive )
+        {
+            result._dead_nodes.push_back( _nodes[n]._id );
+            continue;
+        }
+
+        if ( alloc_cap )
+            continue;
+
+        _dbCapNode * node = _block->_cap_node_tbl->getPtr( _nodes[n]._id );
+
+        if ( ! node->_flags._foreign )
+            continue;
+
+        result._nodes.push_back( _nodes[n]._id );
+
+        for( c = 0; c < _corners; ++c )
+            result._node_cap.push_back( _cap[n*_corners + c] );
+    }
+
+    result._alloc_cap = alloc_cap;
+    result._reduced = true;
+}
+
+bool dbRcReduce::stage( _dbNet * net, dbRcReduceNet & result )
+{
+    result = dbRcReduceNet();
+    result._net = net->getOID();
+
+    bool alloc_cap;
+
+    if ( ! load( net, alloc_cap ) )
+        return false;
+
+    _rtotal.assign( _corners, 0.0 );
+
+    uint n, s, c;
+    for( s = 0; s < _segs.size(); ++s )
+    {
+        for( c = 0; c < _corners; ++c )
+            _rtotal[c] += _res[s*_corners + c];
+    }
+
+    for( n = 0; n < _nodes.size(); ++n )
+        push(n);
+
+    bool changed = collapse();
+
+    while( shortSmallSegs() )
+    {
+        collapse();
+        changed = true;
+    }
+
+    if ( ! changed )
+        return false;
+
+    store( alloc_cap, result );
+    return result._reduced;
+}
+
+uint dbRcReduce::commit( _dbBlock * block, dbRcReduceNet & result )
+{
+    if ( ! result._reduced )
+        return 0;
+
+    _dbNet * net = block->_net_tbl->getPtr( result._net );
+    uint corners = block->_corners_per_block;
+    uint i, c;
+
+    for( i = 0; i < result._segs.size(); ++i )
+    {
+        dbRcReduceNet::Seg & s = result._segs[i];
+        dbRSeg * seg = dbRSeg::getRSeg( (dbBlock *) block, s._id );
+
+        if ( seg->getSourceNode() != s._source )
+            seg->setSourceNode( s._source );
+
+        if ( seg->getTargetNode() != s._target )
+            seg->setTargetNode( s._target );
+
+        for( c = 0; c < corners; ++c )
+        {
+            float r = (float) result._seg_res[i*corners + c];
+
+            if ( (*block->_r_val_tbl)[(s._id-1)*corners + 1 + c] != r )
+                seg->setResistance( r, c );
+
+            if ( ! result._alloc_cap )
+                continue;
+
+            float cap = (float) result._seg_cap[i*corners + c];
+
+            if ( (*block->_c_val_tbl)[(s._id-1)*corners + 1 + c] != cap )
+                seg->setCapacitance( cap, c );
+        }
+    }
+
+    for( i = 0; i < result._nodes.size(); ++i )
+    {
+        uint id = result._nodes[i];
+        dbCapNode * node = dbCapNode::getCapNode( (dbBlock *) block, id );
+
+        for( c = 0; c < corners; ++c )
+        {
+            float cap = (float) result._node_cap[i*corners + c];
+
+            if ( (*block->_c_val_tbl)[(id-1)*corners + 1 + c] != cap )
+                node->setCapacitance( cap, c );
+        }
+    }
+
+    //
+    // Unlink the removed rsegs/cap-nodes in a single pass over each list.
+    // The journal records the same actions as dbRSeg::destroy() and
+    // dbCapNode::destroy(), so an ECO replays them through those methods.
+    //
+    std::vector<uint> & dead_segs = result._dead_segs;
+    std::sort( dead_segs.begin(), dead_segs.end() );
+
+    if ( block->_journal )
+    {
+        for( i = 0; i < dead_segs.size(); ++i )
+        {
+            debug("DB_ECO","A","ECO: dbRSeg destroy seg %d, net %d\n", dead_segs[i], net->getId());
+            block->_journal->beginAction( dbJournal::DELETE_OBJECT );
+            block->_journal->pushParam( dbRSegObj );
+            block->_journal->pushParam( dead_segs[i] );
+            block->_journal->pushParam( net->getId() );
+            block->_journal->endAction();
+        }
+    }
+
+    _dbRSeg * prev_seg = block->_r_seg_tbl->getPtr( net->_r_segs ); // zero rseg is never removed
+    uint id;
+
+    for( id = prev_seg->_next; id != 0; )
+    {
+        _dbRSeg * s = block->_r_seg_tbl->getPtr( id );
+        id = s->_next;
+
+        if ( std::binary_search( dead_segs.begin(), dead_segs.end(), s->getOID() ) )
+            prev_seg->_next = id;
+        else
+            prev_seg = s;
+    }
+
+    for( i = 0; i < dead_segs.size(); ++i )
+    {
+        _dbRSeg * s = block->_r_seg_tbl->getPtr( dead_segs[i] );
+        dbProperty::destroyProperties( (dbObject *) s );
+        block->_r_seg_tbl->destroy(s);
+    }
+
+    std::vector<uint> & dead_nodes = result._dead_nodes;
+    std::sort( dead_nodes.begin(), dead_nodes.end() );
+
+    if ( block->_journal )
+    {
+        for( i = 0; i < dead_nodes.size(); ++i )
+        {
+            debug("DB_ECO","A","ECO: dbCapNode::destroy, seg id: %d, net id: %d\n", dead_nodes[i], net->getId());
+            block->_journal->beginAction( dbJournal::DELETE_OBJECT );
+            block->_journal->pushParam( dbCapNodeObj );
+            block->_journal->pushParam( dead_nodes[i] );
+            block->_journal->endAction();
+        }
+    }
+
+    _dbCapNode * prev_node = NULL;
+
+    for( id = net->_cap_nodes; id != 0; )
+    {
+        _dbCapNode * n = block->_cap_node_tbl->getPtr( id );
+        id = n->_next;
+
+        if ( ! std::binary_search( dead_nodes.begin(), dead_nodes.end(), n->getOID() ) )
+            prev_node = n;
+        else if ( prev_node == NULL )
+            net->_cap_nodes = id;
+        else
+            prev_node->_next = id;
+    }
+
+    for( i = 0; i < dead_nodes.size(); ++i )
+    {
+        _dbCapNode * n = block->_cap_node_tbl->getPtr( dead_nodes[i] );
+        dbProperty::destroyProperties( (dbObject *) n );
+        block->_cap_node_tbl->destroy(n);
+    }
+
+    return dead_nodes.size();
+}
+
+} // namespace
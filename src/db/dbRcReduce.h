@@ -0,0 +1,155 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_RC_REDUCE_H
+#define ADS_DB_RC_REDUCE_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#include <vector>
+
+namespace odb {
+
+class _dbBlock;
+class _dbNet;
+
+//
+// dbRcReduce - In-place reduction of the dbCapNode/dbRSeg network of a net.
+//
+// The reduction is split in two phases so that many nets can be processed
+// in parallel:
+//
+//   stage()  - reads the RC graph of one net and computes the reduced
+//              network into a dbRcReduceNet. It does not modify the
+//              database, so different nets can be staged concurrently.
+//
+//   commit() - writes the staged network back into the dbRSeg/dbCapNode
+//              tables of the net (through the journaled setters).
+//
+// Reductions applied (all of them conserve the total capacitance):
+//
+//   - dangling internal nodes are folded into their only neighbor,
+//   - internal nodes between two resistors are removed by merging the
+//     resistors in series; the node capacitance is split between the
+//     neighbors so the Elmore delay of every remaining node is unchanged,
+//   - parallel resistors are merged,
+//   - resistors below "tolerance" times the total net resistance are
+//     shorted, which bounds the Elmore delay error by
+//     tolerance * Rtotal * Ctotal.
+//
+// Terminal nodes (iterm/bterm), the driver node and nodes carrying coupling
+// capacitors are never removed.
+//
+struct dbRcReduceNet
+{
+    struct Seg
+    {
+        uint _id;
+        uint _source; // cap-node id (0 for the zero rseg)
+        uint _target; // cap-node id
+    };
+
+    bool                 _reduced;
+    bool                 _alloc_cap;  // caps are stored on the rsegs
+    uint                 _net;
+    std::vector<Seg>     _segs;       // surviving rsegs
+    std::vector<double>  _seg_res;    // corner values, per surviving rseg
+    std::vector<double>  _seg_cap;    // corner values, per surviving rseg (allocated caps)
+    std::vector<uint>    _nodes;      // surviving foreign cap-nodes
+    std::vector<double>  _node_cap;   // corner values, per surviving foreign cap-node
+    std::vector<uint>    _dead_segs;
+    std::vector<uint>    _dead_nodes;
+
+    dbRcReduceNet() : _reduced(false), _alloc_cap(false), _net(0) {}
+};
+
+class dbRcReduce
+{
+    struct Node
+    {
+        uint              _id;
+        bool              _keep;
+        bool              _alive;
+        bool              _queued;
+        std::vector<uint> _segs;
+    };
+
+    struct Seg
+    {
+        uint _id;
+        uint _n[2]; // local node indices: source, target
+        bool _alive;
+    };
+
+    _dbBlock *          _block;
+    uint                _corners;
+    double              _tolerance;
+    std::vector<Node>   _nodes;
+    std::vector<Seg>    _segs;
+    std::vector<double> _res;  // _segs.size() * _corners
+    std::vector<double> _cap;  // _nodes.size() * _corners
+    std::vector<double> _rtotal;
+    std::vector<uint>   _queue;
+    uint                _root; // driver node
+    uint                _zero; // zero rseg id
+
+    int  findNode( std::vector<std::pair<uint,uint> > & ids, uint id );
+    bool load( _dbNet * net, bool & alloc_cap );
+    uint other( uint s, uint n ) { return _segs[s]._n[0] == n ? _segs[s]._n[1] : _segs[s]._n[0]; }
+    uint degree( uint n );
+    void push( uint n );
+    void killNode( uint n );
+    void attach( uint s, uint n );
+    void foldLeaf( uint n );
+    void mergeSeries( uint n );
+    void mergeParallel( uint s1, uint s2 );
+    void shortSeg( uint s, uint keep, uint victim );
+    bool collapse();
+    bool shortSmallSegs();
+    void store( bool alloc_cap, dbRcReduceNet & result );
+
+  public:
+    dbRcReduce( _dbBlock * block, double tolerance );
+
+    // Compute the reduced network of "net". Returns false if the net was
+    // left unchanged.
+    bool stage( _dbNet * net, dbRcReduceNet & result );
+
+    // Write a staged network back into the database. Returns the number of
+    // cap-nodes removed.
+    static uint commit( _dbBlock * block, dbRcReduceNet & result );
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,632 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbRowOccupancy.h"
+#include "db.h"
+#include "dbParallel.h"
+#include <algorithm>
+#include <limits.h>
+
+namespace odb {
+
+static inline int floorDiv( int a, int b )
+{
+    int q = a / b;
+
+    if ( (a % b != 0) && ((a < 0) != (b < 0)) )
+        --q;
+
+    return q;
+}
+
+static inline int ceilDiv( int a, int b )
+{
+    return -floorDiv( -a, b );
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// dbRowOccupancy::Row - Segment tree over the sites of a row.
+//
+// A node with a non-zero cover is fully occupied, otherwise its counts are
+// computed from its children. The intervals are only removed after they
+// were added, so the covers are never pushed down.
+//
+////////////////////////////////////////////////////////////////////
+
+void dbRowOccupancy::Row::init()
+{
+    _nodes.clear();
+
+    if ( _count > 0 )
+    {
+        _nodes.resize( 4 * _count );
+        build( 1, 0, _count );
+    }
+}
+
+void dbRowOccupancy::Row::build( int n, int lo, int hi )
+{
+    Node & node = _nodes[n];
+    node._cover = 0;
+
+    if ( hi - lo > 1 )
+    {
+        int mid = (lo + hi) / 2;
+        build( 2 * n, lo, mid );
+        build( 2 * n + 1, mid, hi );
+    }
+
+    pull( n, lo, hi );
+}
+
+void dbRowOccupancy::Row::pull( int n, int lo, int hi )
+{
+    Node & node = _nodes[n];
+    int len = hi - lo;
+
+    if ( node._cover > 0 )
+    {
+        node._used = len;
+        node._pre = node._suf = node._best = 0;
+    }
+    else if ( len == 1 )
+    {
+        node._used = 0;
+        node._pre = node._suf = node._best = 1;
+    }
+    else
+    {
+        int mid = (lo + hi) / 2;
+        const Node & l = _nodes[2 * n];
+        const Node & r = _nodes[2 * n + 1];
+        node._used = l._used + r._used;
+        node._pre = (l._pre == mid - lo) ? l._pre + r._pre : l._pre;
+        node._suf = (r._suf == hi - mid) ? r._suf + l._suf : r._suf;
+        node._best = std::max( std::max( l._best, r._best ), l._suf + r._pre );
+    }
+}
+
+void dbRowOccupancy::Row::update( int lo, int hi, int delta )
+{
+    if ( lo < hi )
+        update( 1, 0, _count, lo, hi, delta );
+}
+
+void dbRowOccupancy::Row::update( int n, int lo, int hi, int a, int b, int delta )
+{
+    if ( (b <= lo) || (hi <= a) )
+        return;
+
+    if ( (a <= lo) && (hi <= b) )
+    {
+        _nodes[n]._cover += delta;
+        pull( n, lo, hi );
+        return;
+    }
+
+    int mid = (lo + hi) / 2;
+    update( 2 * n, lo, mid, a, b, delta );
+    update( 2 * n + 1, mid, hi, a, b, delta );
+    pull( n, lo, hi );
+}
+
+int dbRowOccupancy::Row::getUsed( int lo, int hi ) const
+{
+    if ( lo >= hi )
+        return 0;
+
+    return getUsed( 1, 0, _count, lo, hi );
+}
+
+int dbRowOccupancy::Row::getUsed( int n, int lo, int hi, int a, int b ) const
+{
+    if ( (b <= lo) || (hi <= a) )
+        return 0;
+
+    const Node & node = _nodes[n];
+
+    if ( node._cover > 0 )
+        return std::min( hi, b ) - std::max( lo, a );
+
+    if ( (a <= lo) && (hi <= b) )
+        return node._used;
+
+    int mid = (lo + hi) / 2;
+    return getUsed( 2 * n, lo, mid, a, b ) + getUsed( 2 * n + 1, mid, hi, a, b );
+}
+
+//
+// Find the first site p >= s such that the sites [p, p + w) are free.
+// Returns -1 if there is none.
+//
+int dbRowOccupancy::Row::findRight( int s, int w ) const
+{
+    if ( (_count == 0) || (w > _count) )
+        return -1;
+
+    int carry = 0;
+    return findRight( 1, 0, _count, std::max( s, 0 ), w, carry );
+}
+
+// carry is the number of free sites >= s immediately before lo
+int dbRowOccupancy::Row::findRight( int n, int lo, int hi, int s, int w, int & carry ) const
+{
+    if ( hi <= s )
+        return -1;
+
+    const Node & node = _nodes[n];
+
+    if ( node._cover > 0 )
+    {
+        carry = 0;
+        return -1;
+    }
+
+    if ( lo >= s )
+    {
+        if ( carry + node._pre >= w )
+            return lo - carry;
+
+        if ( node._best < w )
+        {
+            carry = (node._pre == hi - lo) ? carry + (hi - lo) : node._suf;
+            return -1;
+        }
+    }
+
+    int mid = (lo + hi) / 2;
+    int p = findRight( 2 * n, lo, mid, s, w, carry );
+
+    if ( p >= 0 )
+        return p;
+
+    return findRight( 2 * n + 1, mid, hi, s, w, carry );
+}
+
+//
+// Find the last site p <= s such that the sites [p, p + w) are free.
+// Returns -1 if there is none.
+//
+int dbRowOccupancy::Row::findLeft( int s, int w ) const
+{
+    if ( (_count == 0) || (w > _count) || (s < 0) )
+        return -1;
+
+    int carry = 0;
+    int e = findLeft( 1, 0, _count, std::min( s + w, _count ), w, carry );
+    return e < 0 ? -1 : e - w;
+}
+
+// carry is the number of free sites < e immediately after hi,
+// returns the end of the span
+int dbRowOccupancy::Row::findLeft( int n, int lo, int hi, int e, int w, int & carry ) const
+{
+    if ( lo >= e )
+        return -1;
+
+    const Node & node = _nodes[n];
+
+    if ( node._cover > 0 )
+    {
+        carry = 0;
+        return -1;
+    }
+
+    if ( hi <= e )
+    {
+        if ( carry + node._suf >= w )
+            return hi + carry;
+
+        if ( node._best < w )
+        {
+            carry = (node._suf == hi - lo) ? carry + (hi - lo) : node._pre;
+            return -1;
+        }
+    }
+
+    int mid = (lo + hi) / 2;
+    int p = findLeft( 2 * n + 1, mid, hi, e, w, carry );
+
+    if ( p >= 0 )
+        return p;
+
+    return findLeft( 2 * n, lo, mid, e, w, carry );
+}
+
+//
+// Get the sites [lo, hi) overlapping the interval [xlo, xhi).
+// Returns false if there are none.
+//
+bool dbRowOccupancy::Row::getSites( int xlo, int xhi, int & lo, int & hi ) const
+{
+    lo = std::max( floorDiv( xlo - _x - _site_width, _spacing ) + 1, 0 );
+    hi = std::min( ceilDiv( xhi - _x, _spacing ), _count );
+    return lo < hi;
+}
+
+// Number of sites spanned by a cell of this width.
+int dbRowOccupancy::Row::getSpanSites( int width ) const
+{
+    if ( width <= _site_width )
+        return 1;
+
+    return ceilDiv( width - _site_width, _spacing ) + 1;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// dbRowOccupancy - Methods
+//
+////////////////////////////////////////////////////////////////////
+
+dbRowOccupancy::dbRowOccupancy()
+    : _block(NULL),
+      _max_height(0)
+{
+}
+
+dbRowOccupancy::~dbRowOccupancy()
+{
+}
+
+void dbRowOccupancy::clear()
+{
+    removeOwner();
+    _block = NULL;
+    _rows.clear();
+    _max_height = 0;
+    _inst_rect.clear();
+    _inst_placed.clear();
+}
+
+void dbRowOccupancy::build( dbBlock * block, uint threads )
+{
+    clear();
+    _block = block;
+    addOwner(block);
+
+    dbSet<dbRow> rows = block->getRows();
+    dbSet<dbRow>::iterator ritr;
+
+    for( ritr = rows.begin(); ritr != rows.end(); ++ritr )
+    {
+        dbRow * row = *ritr;
+
+        if ( row->getDirection() != dbRowDir::HORIZONTAL )
+            continue;
+
+        dbSite * site = row->getSite();
+        Row r;
+        r._row = row;
+        row->getOrigin( r._x, r._y );
+        r._height = site->getHeight();
+        r._site_width = site->getWidth();
+        r._spacing = row->getSpacing();
+        r._count = row->getSiteCount();
+
+        if ( r._spacing <= 0 )
+            r._spacing = r._site_width;
+
+        if ( (r._count <= 0) || (r._spacing <= 0) )
+            continue;
+
+        _max_height = std::max( _max_height, r._height );
+        _rows.push_back(r);
+    }
+
+    std::sort( _rows.begin(), _rows.end() );
+
+    // the site intervals of the placed instances, by row
+    std::vector< std::vector< std::pair<int,int> > > intervals( _rows.size() );
+    std::vector<int> ridx;
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator iitr;
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+    {
+        dbInst * inst = *iitr;
+
+        if ( ! inst->getPlacementStatus().isPlaced() )
+            continue;
+
+        uint id = inst->getId();
+
+        if ( id >= _inst_rect.size() )
+        {
+            _inst_rect.resize( id + 1 );
+            _inst_placed.resize( id + 1, 0 );
+        }
+
+        adsRect r;
+        inst->getBBox()->getBox(r);
+        _inst_rect[id] = r;
+        _inst_placed[id] = 1;
+
+        getRows( r, ridx );
+        std::vector<int>::iterator itr;
+
+        for( itr = ridx.begin(); itr != ridx.end(); ++itr )
+        {
+            int lo, hi;
+
+            if ( _rows[*itr].getSites( r.xMin(), r.xMax(), lo, hi ) )
+                intervals[*itr].push_back( std::make_pair(lo, hi) );
+        }
+    }
+
+    dbParallelFor( _rows.size(), threads, [&]( uint i )
+    {
+        Row & row = _rows[i];
+        row.init();
+
+        std::vector< std::pair<int,int> >::iterator itr;
+
+        for( itr = intervals[i].begin(); itr != intervals[i].end(); ++itr )
+            row.update( itr->first, itr->second, 1 );
+    }, 16 );
+}
+
+//
+// Get the rows overlapping the rect.
+//
+void dbRowOccupancy::getRows( const adsRect & r, std::vector<int> & rows ) const
+{
+    rows.clear();
+
+    // first row with y > r.yMin() - _max_height
+    int lo = 0;
+    int hi = _rows.size();
+    int y = r.yMin() - _max_height;
+
+    while ( lo < hi )
+    {
+        int mid = (lo + hi) / 2;
+
+        if ( _rows[mid]._y <= y )
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    int i;
+    for( i = lo; (i < (int) _rows.size()) && (_rows[i]._y < r.yMax()); ++i )
+    {
+        const Row & row = _rows[i];
+
+        if ( row._y + row._height > r.yMin() )
+            rows.push_back(i);
+    }
+}
+
+void dbRowOccupancy::addRect( const adsRect & r, int delta )
+{
+    std::vector<int> rows;
+    getRows( r, rows );
+
+    std::vector<int>::iterator itr;
+
+    for( itr = rows.begin(); itr != rows.end(); ++itr )
+    {
+        Row & row = _rows[*itr];
+        int lo, hi;
+
+        if ( row.getSites( r.xMin(), r.xMax(), lo, hi ) )
+            row.update( lo, hi, delta );
+    }
+}
+
+void dbRowOccupancy::removeInst( dbInst * inst )
+{
+    uint id = inst->getId();
+
+    if ( (id < _inst_placed.size()) && _inst_placed[id] )
+    {
+        addRect( _inst_rect[id], -1 );
+        _inst_placed[id] = 0;
+    }
+}
+
+void dbRowOccupancy::updateInst( dbInst * inst )
+{
+    if ( _block == NULL )
+        return;
+
+    removeInst(inst);
+
+    if ( ! inst->getPlacementStatus().isPlaced() )
+        return;
+
+    uint id = inst->getId();
+
+    if ( id >= _inst_rect.size() )
+    {
+        _inst_rect.resize( id + 1 );
+        _inst_placed.resize( id + 1, 0 );
+    }
+
+    adsRect r;
+    inst->getBBox()->getBox(r);
+    _inst_rect[id] = r;
+    _inst_placed[id] = 1;
+    addRect( r, 1 );
+}
+
+bool dbRowOccupancy::findFreeSpan( int x, int y, int width, int & span_x, int & span_y, dbRow ** row_ )
+{
+    int n = _rows.size();
+
+    if ( n == 0 )
+        return false;
+
+    // first row with _y >= y
+    int lo = 0;
+    int hi = n;
+
+    while ( lo < hi )
+    {
+        int mid = (lo + hi) / 2;
+
+        if ( _rows[mid]._y < y )
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    // Visit the rows in order of y distance, until the y distance alone
+    // exceeds the best distance.
+    int up = lo;
+    int down = lo - 1;
+    long long best = LLONG_MAX;
+    int best_row = -1;
+    int best_x = 0;
+
+    for(;;)
+    {
+        int i;
+        long long dy;
+
+        if ( (up < n) && ((down < 0) || (_rows[up]._y - y <= y - _rows[down]._y)) )
+        {
+            i = up++;
+            dy = (long long) _rows[i]._y - y;
+        }
+        else if ( down >= 0 )
+        {
+            i = down--;
+            dy = (long long) y - _rows[i]._y;
+        }
+        else
+            break;
+
+        if ( dy >= best )
+            break;
+
+        const Row & row = _rows[i];
+        int w = row.getSpanSites(width);
+        // the nearest span starts at or left of x, or right of x
+        int left = std::min( floorDiv( x - row._x, row._spacing ), row._count - 1 );
+        int right = std::max( ceilDiv( x - row._x, row._spacing ), 0 );
+
+        int cand[2];
+        cand[0] = row.findLeft( left, w );
+        cand[1] = row.findRight( right, w );
+
+        int k;
+        for( k = 0; k < 2; ++k )
+        {
+            if ( cand[k] < 0 )
+                continue;
+
+            int cx = row._x + cand[k] * row._spacing;
+            long long d = dy + (cx > x ? (long long) cx - x : (long long) x - cx);
+
+            if ( d < best )
+            {
+                best = d;
+                best_row = i;
+                best_x = cx;
+            }
+        }
+    }
+
+    if ( best_row < 0 )
+        return false;
+
+    span_x = best_x;
+    span_y = _rows[best_row]._y;
+
+    if ( row_ )
+        *row_ = _rows[best_row]._row;
+
+    return true;
+}
+
+void dbRowOccupancy::getSiteCount( const adsRect & region, uint & used, uint & total )
+{
+    used = 0;
+    total = 0;
+
+    std::vector<int> rows;
+    getRows( region, rows );
+
+    std::vector<int>::iterator itr;
+
+    for( itr = rows.begin(); itr != rows.end(); ++itr )
+    {
+        const Row & row = _rows[*itr];
+        int lo, hi;
+
+        if ( row.getSites( region.xMin(), region.xMax(), lo, hi ) )
+        {
+            used += row.getUsed( lo, hi );
+            total += hi - lo;
+        }
+    }
+}
+
+double dbRowOccupancy::getUtilization( const adsRect & region )
+{
+    uint used, total;
+    getSiteCount( region, used, total );
+
+    if ( total == 0 )
+        return 0.0;
+
+    return (double) used / (double) total;
+}
+
+void dbRowOccupancy::inDbInstCreate( dbInst * inst )
+{
+    updateInst(inst);
+}
+
+void dbRowOccupancy::inDbInstCreate( dbInst * inst, dbRegion * )
+{
+    updateInst(inst);
+}
+
+void dbRowOccupancy::inDbInstDestroy( dbInst * inst )
+{
+    removeInst(inst);
+}
+
+void dbRowOccupancy::inDbInstSwapMasterAfter( dbInst * inst )
+{
+    updateInst(inst);
+}
+
+void dbRowOccupancy::inDbMoveInst( dbInst * inst )
+{
+    updateInst(inst);
+}
+
+} // namespace
@@ -37,108 +37,59 @@
 
 namespace odb {
 
-// object allocators
-static adsAllocator<dbRtNode> g_node_alloc;
-static adsAllocator<dbRtSegment> g_segment_alloc;
-static adsAllocator<dbRtTechVia> g_tech_via_alloc;
-static adsAllocator<dbRtVia> g_via_alloc;
-static adsAllocator<dbRtShort> g_short_alloc;
-static adsAllocator<dbRtVWire> g_vwire_alloc;
-
-// object "edge" destroyers
-class ObjectDestroy
+//
+// dbRtPool - The object allocators of a dbRtTree.
+//
+class dbRtPool
 {
   public:
-    virtual void destroyObject( void * obj ) = 0;
+    adsAllocator<dbRtNode> _node_alloc;
+    adsAllocator<dbRtSegment> _segment_alloc;
+    adsAllocator<dbRtTechVia> _tech_via_alloc;
+    adsAllocator<dbRtVia> _via_alloc;
+    adsAllocator<dbRtShort> _short_alloc;
+    adsAllocator<dbRtVWire> _vwire_alloc;
+
+    void destroyEdge( dbRtEdge * edge );
+    void merge( dbRtPool * other );
 };
 
-class DestroySegment : public ObjectDestroy
+void dbRtPool::destroyEdge( dbRtEdge * edge )
 {
-    public:
-
-    void destroyObject( void * obj )
+    switch( edge->getType() )
     {
-        g_segment_alloc.destroy((dbRtSegment *) obj);
-    }
-
-    static DestroySegment singleton;
-};
-
-class DestroyTechVia : public ObjectDestroy
-{
-    public:
-
-    void destroyObject( void * obj )
-    {
-        g_tech_via_alloc.destroy((dbRtTechVia *) obj);
-    }
-
-    static DestroyTechVia singleton;
-};
-
-class DestroyVia : public ObjectDestroy
-{
-    public:
-
-    void destroyObject( void * obj )
-    {
-        g_via_alloc.destroy((dbRtVia *) obj);
-    }
-
-    static DestroyVia singleton;
-};
-
-class DestroyShort : public ObjectDestroy
-{
-    public:
+        case dbRtEdge::SEGMENT:
+            _segment_alloc.destroy((dbRtSegment *) edge);
+            break;
 
-    void destroyObject( void * obj )
-    {
-        g_short_alloc.destroy((dbRtShort *) obj);
-    }
+        case dbRtEdge::TECH_VIA:
+            _tech_via_alloc.destroy((dbRtTechVia *) edge);
+            break;
 
-    static DestroyShort singleton;
-};
+        case dbRtEdge::VIA:
+            _via_alloc.destroy((dbRtVia *) edge);
+            break;
 
-class DestroyVWire : public ObjectDestroy
-{
-    public:
+        case dbRtEdge::SHORT:
+            _short_alloc.destroy((dbRtShort *) edge);
+            break;
 
-    void destroyObject( void * obj )
-    {
-        g_vwire_alloc.destroy((dbRtVWire *) obj);
+        case dbRtEdge::VWIRE:
+            _vwire_alloc.destroy((dbRtVWire *) edge);
+            break;
     }
+}
 
-    static DestroyVWire singleton;
-};
-
-DestroySegment DestroySegment::singleton;
-DestroyTechVia DestroyTechVia::singleton;
-DestroyVia DestroyVia::singleton;
-DestroyShort DestroyShort::singleton;
-DestroyVWire DestroyVWire::singleton;
-
-
-// allocators
-static ObjectDestroy * g_edge_destroyers[5] =
-{
-    &DestroySegment::singleton,
-    &DestroyTechVia::singleton,
-    &DestroyVia::singleton,
-    &DestroyShort::singleton,
-    &DestroyVWire::singleton,
-};
-
-
-//
-// this code uses a lookup table to find the correct allocator
-//
-inline void destroyEdge( dbRtEdge * edge )
+void dbRtPool::merge( dbRtPool * other )
 {
-    g_edge_destroyers[edge->getType()]->destroyObject(edge);
+    _node_alloc.merge(other->_node_alloc);
+    _segment_alloc.merge(other->_segment_alloc);
+    _tech_via_alloc.merge(other->_tech_via_alloc);
+    _via_alloc.merge(other->_via_alloc);
+    _short_alloc.merge(other->_short_alloc);
+    _vwire_alloc.merge(other->_vwire_alloc);
 }
 
-
 void dbRtTree::addObjects( dbWireEncoder & encoder, dbRtNode * node )
 {
     std::vector<dbObject *>::iterator itr;
@@ -314,19 +265,13 @@ void dbRtVWire::getBBox( adsRect & bbox )
 
 dbRtTree::dbRtTree()
 {
+    _pool = new dbRtPool;
 }
 
 dbRtTree::~dbRtTree()
 {
-    node_iterator nitr;
-
-    for( nitr = _nodes.begin(); nitr != _nodes.end(); ++nitr )
-        g_node_alloc.destroy(*nitr);
-
-    edge_iterator eitr;
-
-    for( eitr = _edges.begin(); eitr != _edges.end(); ++eitr )
-        destroyEdge(*eitr);
+    clear();
+    delete _pool;
 }
 
 void dbRtTree::add_node( dbRtNode * node ) { _nodes.push_back( node); }
@@ -345,12 +290,12 @@ void dbRtTree::clear()
     node_iterator nitr;
 
     for( nitr = _nodes.begin(); nitr != _nodes.end(); ++nitr )
-        g_node_alloc.destroy(*nitr);
+        _pool->_node_alloc.destroy(*nitr);
 
     edge_iterator eitr;
 
     for( eitr = _edges.begin(); eitr != _edges.end(); ++eitr )
-        destroyEdge(*eitr);
+        _pool->destroyEdge(*eitr);
     
     _edges.clear();
     _nodes.clear();
@@ -359,7 +304,7 @@ void dbRtTree::clear()
 
 dbRtNode * dbRtTree::createNode( int x, int y, dbTechLayer * l )
 {
-    dbRtNode * n = new(g_node_alloc.malloc()) dbRtNode(x,y,l);
+    dbRtNode * n = new(_pool->_node_alloc.malloc()) dbRtNode(x,y,l);
     assert(n);
     n->_rt_tree = this;
     add_node(n);
@@ -371,7 +316,7 @@ dbRtVia * dbRtTree::createVia( dbRtNode * src, dbRtNode * tgt, dbVia * via, dbWi
     assert ( (src->_x == tgt->_x) && (src->_y == tgt->_y) && "via coordinates are skewed");
     assert( (src->_rt_tree == this) && (tgt->_rt_tree == this) );
 
-    dbRtVia * v = new(g_via_alloc.malloc()) dbRtVia(via, type, rule);
+    dbRtVia * v = new(_pool->_via_alloc.malloc()) dbRtVia(via, type, rule);
     v->_src = src;
     v->_tgt = tgt;
     v->_rt_tree = this;
@@ -386,7 +331,7 @@ dbRtTechVia * dbRtTree::createTechVia( dbRtNode * src, dbRtNode * tgt, dbTechVia
     assert ( (src->_x == tgt->_x) && (src->_y == tgt->_y) && "via coordinates are skewed");
     assert( (src->_rt_tree == this) && (tgt->_rt_tree == this) );
 
-    dbRtTechVia * v = new(g_tech_via_alloc.malloc()) dbRtTechVia(via, type, rule);
+    dbRtTechVia * v = new(_pool->_tech_via_alloc.malloc()) dbRtTechVia(via, type, rule);
     v->_src = src;
     v->_tgt = tgt;
     v->_rt_tree = this;
@@ -402,7 +347,7 @@ dbRtSegment * dbRtTree::createSegment( dbRtNode * src, dbRtNode * tgt, dbRtEndSt
     assert ( (src->_x == tgt->_x || src->_y == tgt->_y) && "non-orthognal segment" );
     assert( (src->_rt_tree == this) && (tgt->_rt_tree == this) );
 
-    dbRtSegment * s = new(g_segment_alloc.malloc()) dbRtSegment(src_style, tgt_style, type, rule);
+    dbRtSegment * s = new(_pool->_segment_alloc.malloc()) dbRtSegment(src_style, tgt_style, type, rule);
 
     s->_src = src;
     s->_tgt = tgt;
@@ -417,7 +362,7 @@ dbRtShort * dbRtTree::createShort( dbRtNode * src, dbRtNode * tgt, dbWireType::V
 {
     assert( (src->_rt_tree == this) && (tgt->_rt_tree == this) );
     
-    dbRtShort * s = new(g_short_alloc.malloc()) dbRtShort(type, rule);
+    dbRtShort * s = new(_pool->_short_alloc.malloc()) dbRtShort(type, rule);
     s->_src = src;
     s->_tgt = tgt;
     s->_rt_tree = this;
@@ -431,7 +376,7 @@ dbRtVWire * dbRtTree::createVWire( dbRtNode * src, dbRtNode * tgt, dbWireType::V
 {
     assert( (src->_rt_tree == this) && (tgt->_rt_tree == this) );
     
-    dbRtVWire * s = new(g_vwire_alloc.malloc()) dbRtVWire(type, rule);
+    dbRtVWire * s = new(_pool->_vwire_alloc.malloc()) dbRtVWire(type, rule);
     s->_src = src;
     s->_tgt = tgt;
     s->_rt_tree = this;
@@ -453,11 +398,11 @@ void dbRtTree::deleteNode( dbRtNode * n )
         n->remove_edge( e );
         e->opposite(n)->remove_edge(e);
         remove_edge(e);
-        destroyEdge(e);
+        _pool->destroyEdge(e);
     }
 
     remove_node(n);
-    g_node_alloc.destroy(n);
+    _pool->_node_alloc.destroy(n);
 }
 
 void dbRtTree::deleteEdge( dbRtEdge * e )
@@ -466,7 +411,7 @@ void dbRtTree::deleteEdge( dbRtEdge * e )
     e->_src->remove_edge(e);
     e->_tgt->remove_edge(e);
     remove_edge(e);
-    destroyEdge(e);
+    _pool->destroyEdge(e);
 }
 
 void dbRtTree::deleteEdge( dbRtEdge * e, bool destroy_orphan_nodes )
@@ -481,17 +426,17 @@ void dbRtTree::deleteEdge( dbRtEdge * e, bool destroy_orphan_nodes )
         if ( e->_src->_head == NULL )
         {
             remove_node(e->_src);
-            g_node_alloc.destroy(e->_src);
+            _pool->_node_alloc.destroy(e->_src);
         }
 
         if ( e->_tgt->_head == NULL )
         {
             remove_node(e->_tgt);
-            g_node_alloc.destroy(e->_tgt);
+            _pool->_node_alloc.destroy(e->_tgt);
         }
     }
 
-    destroyEdge(e);
+    _pool->destroyEdge(e);
 }
 
 dbRtEdge * dbRtTree::getEdge( uint shape_id )
@@ -1278,6 +1223,7 @@ void dbRtTree::move( dbRtTree * T )
     }
 
     T->_edge_map.clear();
+    _pool->merge(T->_pool);
 }
 
 void dbRtTree::copy( dbRtTree * T )
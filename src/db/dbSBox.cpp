@@ -180,7 +180,6 @@ dbSBox::create( dbSWire * wire_, dbTechLayer * layer_,
 {
     _dbSWire * wire = (_dbSWire *) wire_;
     _dbBlock * block = (_dbBlock *) wire->getOwner();
-    _dbSBox * box = block->_sbox_tbl->create();
 
     uint dx;
     if ( x2 > x1 )
@@ -212,7 +211,8 @@ dbSBox::create( dbSWire * wire_, dbTechLayer * layer_,
                 return NULL;
             break;
     }
-        
+
+    _dbSBox * box = block->_sbox_tbl->create();
     box->_flags._layer_id = layer_->getOID();
     box->_flags._owner_type = dbBoxOwner::SWIRE;
     box->_owner = wire->getOID();
@@ -229,6 +229,7 @@ static void destroySBoxes( _dbSWire * wire )
     {
         _dbSBox * box = block->_sbox_tbl->getPtr(id);
         uint nid = box->_next_box;
+        block->remove_rect( box->_rect );
         dbProperty::destroyProperties(box);
         block->_sbox_tbl->destroy(box);
         id = nid;
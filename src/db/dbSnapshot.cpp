@@ -0,0 +1,268 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbSnapshot.h"
+#include "dbEcoStream.h"
+#include "dbJournal.h"
+#include "dbBlock.h"
+#include "dbInst.h"
+#include "dbRSeg.h"
+#include "dbDiff.h"
+#include "db.h"
+#include <string.h>
+
+namespace odb {
+
+dbSnapshot::dbSnapshot( _dbBlock * block )
+        : _block(block), _journal(block->_journal), _own_journal(false), _unjournaled(false)
+{
+    if ( _journal == NULL )
+    {
+        _journal = new dbJournal( (dbBlock *) _block );
+        ZALLOCATED(_journal);
+        _block->_journal = _journal;
+        _own_journal = true;
+    }
+
+    _base = _journal->size();
+    addOwner( (dbBlock *) _block );
+}
+
+dbSnapshot::~dbSnapshot()
+{
+    removeOwner();
+
+    if ( _own_journal )
+    {
+        delete _journal;
+        _block->_journal = NULL;
+    }
+}
+
+bool dbSnapshot::check( const char * op )
+{
+    if ( ! _unjournaled )
+        return true;
+
+    warning(0, "%s: block %s has changes that are not journaled\n", op, _block->_name);
+    return false;
+}
+
+bool dbSnapshot::save( const char * name )
+{
+    if ( ! check("saveSnapshot") )
+        return false;
+
+    std::vector<unsigned char> & buf = _variants[name];
+    buf.clear();
+    dbEcoStream::encode( buf, *_journal, _base );
+    std::vector<unsigned char>( buf ).swap( buf );
+    return true;
+}
+
+bool dbSnapshot::revert()
+{
+    if ( ! check("revertSnapshot") )
+        return false;
+
+    // undo() throws, before changing anything, on changes it cannot undo.
+    _journal->undo(_base);
+    return true;
+}
+
+bool dbSnapshot::restore( const char * name )
+{
+    std::map<std::string, std::vector<unsigned char> >::iterator itr = _variants.find(name);
+
+    if ( itr == _variants.end() )
+        return false;
+
+    if ( ! revert() )
+        return false;
+
+    // The decoded log is exactly the change set of the variant, replay it
+    // unjournaled, then append it to the journal.
+    dbJournal variant( (dbBlock *) _block );
+    dbEcoStream::decode( &itr->second[0], itr->second.size(), variant );
+    _block->_journal = NULL;
+    variant.redo();
+    _block->_journal = _journal;
+    dbEcoStream::decode( &itr->second[0], itr->second.size(), *_journal );
+    return true;
+}
+
+bool dbSnapshot::discard( const char * name )
+{
+    return _variants.erase(name) != 0;
+}
+
+uint dbSnapshot::variantBytes()
+{
+    uint n = 0;
+    std::map<std::string, std::vector<unsigned char> >::iterator itr;
+
+    for( itr = _variants.begin(); itr != _variants.end(); ++itr )
+        n += itr->second.size();
+
+    return n;
+}
+
+//
+// Describe an action that is not a field update.
+//
+void dbSnapshot::describe( dbDiff & diff, dbJournal & journal, uint start )
+{
+    dbJournalLog & log = journal._log;
+    unsigned char action;
+    int obj_type;
+    log.set( start );
+    log.pop( action );
+    log.pop( obj_type );
+
+    const char * obj_name = dbObject::getObjName( (dbObjectType) obj_type );
+
+    switch( action )
+    {
+        case dbJournal::CREATE_OBJECT:
+        {
+            std::string name;
+
+            if ( obj_type == dbNetObj )
+                log.pop( name );
+            else if ( obj_type == dbInstObj )
+            {
+                uint lib_id;
+                uint master_id;
+                log.pop( lib_id );
+                log.pop( master_id );
+                log.pop( name );
+            }
+
+            diff.report("> create %s %s\n", obj_name, name.c_str() );
+            break;
+        }
+
+        case dbJournal::DELETE_OBJECT:
+        case dbJournal::CONNECT_OBJECT:
+        case dbJournal::DISCONNECT_OBJECT:
+        case dbJournal::SWAP_OBJECT:
+        case dbJournal::UPDATE_FIELD:
+        {
+            static const char * actions[] = { "create", "delete", "connect", "disconnect", "swap", "update" };
+            uint id;
+            log.pop( id );
+            diff.report("> %s %s[%u]\n", actions[action], obj_name, id );
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+bool dbSnapshot::diff( const char * name, FILE * out )
+{
+    std::map<std::string, std::vector<unsigned char> >::iterator itr = _variants.find(name);
+
+    if ( itr == _variants.end() )
+        return false;
+
+    dbJournal journal( (dbBlock *) _block );
+    dbEcoStream::decode( &itr->second[0], itr->second.size(), journal );
+
+    std::vector<uint> starts;
+    dbEcoStream::getActions( journal._log, starts );
+
+    dbDiff diff(out);
+    diff.begin_object("<> snapshot %s\n", name);
+
+    std::vector<uint>::iterator sitr;
+    for( sitr = starts.begin(); sitr != starts.end(); ++sitr )
+    {
+        int obj_type;
+        int field;
+        dbEcoStream::Update u;
+        dbEcoStream::Kind kind = dbEcoStream::getUpdate( journal._log, *sitr, obj_type, field, u );
+
+        if ( kind == dbEcoStream::NONE )
+        {
+            describe( diff, journal, *sitr );
+            continue;
+        }
+
+        diff.begin( NULL, dbObject::getObjName( (dbObjectType) obj_type ), u._id );
+
+        switch( kind )
+        {
+            case dbEcoStream::FLAGS:
+                if ( obj_type == dbInstObj )
+                {
+                    _dbInstFlags prev;
+                    _dbInstFlags next;
+                    memcpy( &prev, &u._prev[0], sizeof(uint) );
+                    memcpy( &next, &u._next[0], sizeof(uint) );
+                    diff.diff( "_flags._orient", prev._orient, next._orient );
+                    diff.diff( "_flags._status", prev._status, next._status );
+                }
+
+                diff.diff( "_flags", u._prev[0], u._next[0] );
+                break;
+
+            case dbEcoStream::ORIGIN:
+                diff.diff( "_x", (int) u._prev[0], (int) u._next[0] );
+                diff.diff( "_y", (int) u._prev[1], (int) u._next[1] );
+                break;
+
+            case dbEcoStream::VALUE:
+            {
+                char field_name[32];
+                float prev;
+                float next;
+                memcpy( &prev, &u._prev[0], sizeof(float) );
+                memcpy( &next, &u._next[0], sizeof(float) );
+                bool res = ( obj_type == dbRSegObj && field == _dbRSeg::RESISTANCE );
+                sprintf( field_name, "%s[%d]", res ? "_r" : "_c", u._corner );
+                diff.diff( field_name, prev, next );
+                break;
+            }
+
+            case dbEcoStream::NONE:
+                break;
+        }
+
+        diff.end_object();
+    }
+
+    diff.end_object();
+    return diff.hasDifferences();
+}
+
+} // namespace
@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_SNAPSHOT_H
+#define ADS_DB_SNAPSHOT_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#include "dbBlockCallBackObj.h"
+#include <stdio.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace odb {
+
+class _dbBlock;
+class dbJournal;
+class dbDiff;
+
+//
+// dbSnapshot - What-if variants of a block, kept as journal replays against
+// a base state.
+//
+// This is not a copy-on-write copy of the block: the block's journal records
+// the changes made since the base state. Saving a variant stores the journal
+// in the compact eco encoding (dbEcoStream); restoring a variant undoes the
+// current changes and replays the stored ones. Memory is proportional to what
+// changed, not to the block.
+//
+// The journal undoes placement, master swaps, iterm connections, the creation
+// and deletion of nets and instances, wire updates and parasitic values. It
+// refuses to undo (save still works) the deletion of a net or instance that
+// had state it does not record (bterms, special wires, parasitics,
+// properties, halos, hierarchy), and the creation of parasitics. Reading
+// nets is not journaled at all; once the block's nets are read save, revert
+// and restore fail.
+//
+// If an eco is active the snapshot shares its journal, the base state is the
+// end of the eco log at beginSnapshot. The eco keeps the changes of the
+// variant the block is left in.
+//
+class dbSnapshot : public dbBlockCallBackObj
+{
+    _dbBlock *                                          _block;
+    dbJournal *                                         _journal;
+    bool                                                _own_journal;
+    uint                                                _base;
+    std::map<std::string, std::vector<unsigned char> >  _variants;
+    bool                                                _unjournaled;
+
+    void describe( dbDiff & diff, dbJournal & journal, uint start );
+    bool check( const char * op );
+
+  public:
+    dbSnapshot( _dbBlock * block );
+    ~dbSnapshot();
+
+    // Store the changes since the base state as variant "name".
+    bool save( const char * name );
+
+    // Undo the changes since the base state.
+    bool revert();
+
+    // Revert, then apply variant "name".
+    bool restore( const char * name );
+    bool discard( const char * name );
+    bool diff( const char * name, FILE * out );
+    uint variantBytes();
+
+    // True if the block was changed in a way the journal cannot undo.
+    bool hasUnjournaledChanges() { return _unjournaled; }
+
+    // dbBlockCallBackObj
+    void inDbBlockReadNetsBefore( dbBlock * ) { _unjournaled = true; }
+};
+
+} // namespace
+
+#endif
@@ -112,6 +112,10 @@ class dbTable : public dbObjectTable, public dbIterator
     // Destroy instance of "T", calls destructor
     void destroy( T * );
 
+    // Make the next create() return the free object "id" (e.g. to recreate
+    // a destroyed object under its old id). Returns false if "id" is in use.
+    bool setNextId( uint id );
+
     // clear the table
     void clear();
 
@@ -182,6 +186,7 @@ class dbTable : public dbObjectTable, public dbIterator
     uint end( dbObject * parent );
     uint next( uint cur, ... );
     dbObject * getObject( uint cur, ... );
+    bool validObject( uint id ) { return validId(id); }
     void getObjects( std::vector<T *> & objects );
     
   private:
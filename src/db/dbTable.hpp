@@ -478,6 +478,27 @@ void dbTable<T>::destroy( T * t )
         findTop();
 }
 
+template <class T>
+bool dbTable<T>::setNextId( uint id )
+{
+    if ( id == 0 )
+        return false;
+
+    while( (id >> _page_shift) >= _page_cnt )
+        newPage();
+
+    uint page = id >> _page_shift;
+    uint offset = id & _page_mask;
+    _dbObject * o = (_dbObject *) &(_pages[page]->_objects[offset*sizeof(T)]);
+
+    if ( o->_oid & DB_ALLOC_BIT )
+        return false;
+
+    unlinkQ(_free_list, o);
+    pushQ(_free_list, o);
+    return true;
+}
+
 template <class T>
 bool dbTable<T>::reversible()
 {
@@ -48,11 +48,17 @@
 #include "dbTechLayerItr.h"
 #include "dbTable.h"
 #include "dbTable.hpp"
+#include "dbHashTable.hpp"
 #include "db.h"
 
 namespace odb {
 
 template class dbTable<_dbTech>;
+template class dbHashTable<_dbTechLayer>;
+template class dbHashTable<_dbTechVia>;
+template class dbHashTable<_dbTechViaRule>;
+template class dbHashTable<_dbTechViaGenerateRule>;
+template class dbHashTable<_dbTechNonDefaultRule>;
 
 bool _dbTech::operator==( const _dbTech & rhs ) const
 {
@@ -312,6 +318,12 @@ _dbTech::_dbTech( _dbDatabase * db )
 
     _prop_itr = new dbPropertyItr(_prop_tbl);
     ZALLOCATED(_prop_itr);
+
+    _layer_hash.setTable(_layer_tbl);
+    _via_hash.setTable(_via_tbl);
+    _via_rule_hash.setTable(_via_rule_tbl);
+    _via_generate_rule_hash.setTable(_via_generate_rule_tbl);
+    _non_default_rule_hash.setTable(_non_default_rule_tbl);
 }
 
 _dbTech::_dbTech( _dbDatabase * db, const _dbTech & t )
@@ -375,6 +387,13 @@ _dbTech::_dbTech( _dbDatabase * db, const _dbTech & t )
 
     _prop_itr = new dbPropertyItr(_prop_tbl);
     ZALLOCATED(_prop_itr);
+
+    _layer_hash.setTable(_layer_tbl);
+    _via_hash.setTable(_via_tbl);
+    _via_rule_hash.setTable(_via_rule_tbl);
+    _via_generate_rule_hash.setTable(_via_generate_rule_tbl);
+    _non_default_rule_hash.setTable(_non_default_rule_tbl);
+    buildIndexes();
 }
 
 _dbTech::~_dbTech()
@@ -498,6 +517,7 @@ dbIStream & operator>>( dbIStream & stream, _dbTech & tech )
         stream >> *tech._name_cache;
     }
 
+    tech.buildIndexes();
     return stream;
 }
 
@@ -524,6 +544,57 @@ void _dbTech::_setLefVersion(double inver)
 
 }
 
+void _dbTech::indexLayer( _dbTechLayer * layer )
+{
+    _layer_hash.insert(layer);
+
+    if ( layer->_number >= _layer_number_idx.size() )
+        _layer_number_idx.resize(layer->_number + 1);
+
+    _layer_number_idx[layer->_number] = layer->getOID();
+
+    if ( layer->_rlevel == 0 )
+        return;
+
+    if ( layer->_rlevel >= _routing_level_idx.size() )
+        _routing_level_idx.resize(layer->_rlevel + 1);
+
+    _routing_level_idx[layer->_rlevel] = layer->getOID();
+}
+
+void _dbTech::buildIndexes()
+{
+    dbSet<dbTechLayer> layers(this, _layer_tbl);
+    dbSet<dbTechLayer>::iterator litr;
+
+    for( litr = layers.begin(); litr != layers.end(); ++litr )
+        indexLayer((_dbTechLayer *) *litr);
+
+    dbSet<dbTechVia> vias(this, _via_tbl);
+    dbSet<dbTechVia>::iterator vitr;
+
+    for( vitr = vias.begin(); vitr != vias.end(); ++vitr )
+        _via_hash.insert((_dbTechVia *) *vitr);
+
+    dbSet<dbTechViaRule> via_rules(this, _via_rule_tbl);
+    dbSet<dbTechViaRule>::iterator ritr;
+
+    for( ritr = via_rules.begin(); ritr != via_rules.end(); ++ritr )
+        _via_rule_hash.insert((_dbTechViaRule *) *ritr);
+
+    dbSet<dbTechViaGenerateRule> gen_rules(this, _via_generate_rule_tbl);
+    dbSet<dbTechViaGenerateRule>::iterator gitr;
+
+    for( gitr = gen_rules.begin(); gitr != gen_rules.end(); ++gitr )
+        _via_generate_rule_hash.insert((_dbTechViaGenerateRule *) *gitr);
+
+    dbSet<dbTechNonDefaultRule> ndrs(this, _non_default_rule_tbl);
+    dbSet<dbTechNonDefaultRule>::iterator nitr;
+
+    for( nitr = ndrs.begin(); nitr != ndrs.end(); ++nitr )
+        _non_default_rule_hash.insert((_dbTechNonDefaultRule *) *nitr);
+}
+
 dbObjectTable * _dbTech::getObjectTable( dbObjectType type )
 {
     switch( type )
@@ -573,52 +644,57 @@ dbTech::getLayers()
 dbTechLayer *
 dbTech::findLayer( const char * name )
 {
-    dbSet<dbTechLayer> layers = getLayers();
-    dbSet<dbTechLayer>::iterator itr;
-
-    for( itr = layers.begin(); itr != layers.end(); ++itr )
-    {
-        _dbTechLayer * layer = (_dbTechLayer *) *itr;
-
-        if ( strcmp(layer->_name, name) == 0 )
-            return (dbTechLayer *) layer;
-    }
-
-    return NULL;
+    _dbTech * tech = (_dbTech *) this;
+    return (dbTechLayer *) tech->_layer_hash.find(name);
 }
 
 dbTechLayer *
 dbTech::findLayer( int layer_number )
 {
-    dbSet<dbTechLayer> layers = getLayers();
-    dbSet<dbTechLayer>::iterator itr;
+    _dbTech * tech = (_dbTech *) this;
 
-    for( itr = layers.begin(); itr != layers.end(); ++itr )
-    {
-        _dbTechLayer * layer = (_dbTechLayer *) *itr;
+    if ( (uint) layer_number >= tech->_layer_number_idx.size() )
+        return NULL;
 
-        if ( layer->_number == (uint) layer_number )
-            return (dbTechLayer *) layer;
-    }
+    dbId<_dbTechLayer> id = tech->_layer_number_idx[layer_number];
+
+    if ( id == 0 )
+        return NULL;
 
-    return NULL;
+    return (dbTechLayer *) tech->_layer_tbl->getPtr(id);
 }
 
 dbTechLayer *
 dbTech::findRoutingLayer( int level_number )
 {
-    dbSet<dbTechLayer> layers = getLayers();
-    dbSet<dbTechLayer>::iterator itr;
+    _dbTech * tech = (_dbTech *) this;
 
-    for( itr = layers.begin(); itr != layers.end(); ++itr )
+    // Level 0 is shared by all non-routing layers, take the first of them.
+    if ( level_number == 0 )
     {
-        _dbTechLayer * layer = (_dbTechLayer *) *itr;
+        dbSet<dbTechLayer> layers = getLayers();
+        dbSet<dbTechLayer>::iterator itr;
 
-        if ( layer->_rlevel == (uint) level_number )
-            return (dbTechLayer *) layer;
+        for( itr = layers.begin(); itr != layers.end(); ++itr )
+        {
+            _dbTechLayer * layer = (_dbTechLayer *) *itr;
+
+            if ( layer->_rlevel == 0 )
+                return (dbTechLayer *) layer;
+        }
+
+        return NULL;
     }
 
-    return NULL;
+    if ( (uint) level_number >= tech->_routing_level_idx.size() )
+        return NULL;
+
+    dbId<_dbTechLayer> id = tech->_routing_level_idx[level_number];
+
+    if ( id == 0 )
+        return NULL;
+
+    return (dbTechLayer *) tech->_layer_tbl->getPtr(id);
 }
 
 void dbTech::setDbUnitsPerMicron( int value )
@@ -643,18 +719,8 @@ dbTech::getVias()
 dbTechVia *
 dbTech::findVia( const char * name )
 {
-    dbSet<dbTechVia> vias = getVias();
-    dbSet<dbTechVia>::iterator itr;
-
-    for( itr = vias.begin(); itr != vias.end(); ++itr )
-    {
-        _dbTechVia * via = (_dbTechVia *) *itr;
-
-        if ( strcmp(via->_name, name) == 0)
-            return (dbTechVia *) via;
-    }
-
-    return NULL;
+    _dbTech * tech = (_dbTech *) this;
+    return (dbTechVia *) tech->_via_hash.find(name);
 }
 
 int dbTech::getLefUnits()
@@ -826,18 +892,8 @@ dbSet<dbTechNonDefaultRule> dbTech::getNonDefaultRules()
 
 dbTechNonDefaultRule * dbTech::findNonDefaultRule( const char * name )
 {
-    dbSet<dbTechNonDefaultRule> rules = getNonDefaultRules();
-    dbSet<dbTechNonDefaultRule>::iterator itr;
-
-    for( itr = rules.begin(); itr != rules.end(); ++itr )
-    {
-        _dbTechNonDefaultRule * r = (_dbTechNonDefaultRule *) *itr;
-
-        if ( strcmp(r->_name,name) == 0 )
-            return (dbTechNonDefaultRule *) r;
-    }
-
-    return NULL;
+    _dbTech * tech = (_dbTech *) this;
+    return (dbTechNonDefaultRule *) tech->_non_default_rule_hash.find(name);
 }
 
 dbTechSameNetRule * dbTech::findSameNetRule( dbTechLayer * l1_, dbTechLayer * l2_ )
@@ -881,34 +937,14 @@ dbSet<dbTechViaGenerateRule> dbTech::getViaGenerateRules()
 
 dbTechViaRule * dbTech::findViaRule( const char * name )
 {
-    dbSet<dbTechViaRule> rules = getViaRules();
-    dbSet<dbTechViaRule>::iterator itr;
-
-    for( itr = rules.begin(); itr != rules.end(); ++itr )
-    {
-        _dbTechViaRule * rule = (_dbTechViaRule *) *itr;
-
-        if ( strcmp(name, rule->_name) == 0 )
-            return (dbTechViaRule *) rule;
-    }
-
-    return NULL;
+    _dbTech * tech = (_dbTech *) this;
+    return (dbTechViaRule *) tech->_via_rule_hash.find(name);
 }
 
 dbTechViaGenerateRule * dbTech::findViaGenerateRule( const char * name )
 {
-    dbSet<dbTechViaGenerateRule> rules = getViaGenerateRules();
-    dbSet<dbTechViaGenerateRule>::iterator itr;
-
-    for( itr = rules.begin(); itr != rules.end(); ++itr )
-    {
-        _dbTechViaGenerateRule * rule = (_dbTechViaGenerateRule *) *itr;
-
-        if ( strcmp(name, rule->_name) == 0 )
-            return (dbTechViaGenerateRule *) rule;
-    }
-
-    return NULL;
+    _dbTech * tech = (_dbTech *) this;
+    return (dbTechViaGenerateRule *) tech->_via_generate_rule_hash.find(name);
 }
 
 void dbTech::checkLayer( bool typeChk, bool widthChk, bool pitchChk, bool spacingChk)
@@ -52,6 +52,10 @@
 #include "dbMatrix.h"
 #endif
 
+#ifndef ADS_DB_HASH_TABLE_H
+#include "dbHashTable.h"
+#endif
+
 namespace odb {
 
 template <class T> class dbTable;
@@ -130,9 +134,21 @@ class _dbTech : public dbObject
     dbBoxItr *                       _box_itr;
     dbPropertyItr *                  _prop_itr;
 
+    // Name, layer-number and routing-level indexes. These are rebuilt when
+    // the tech is read or copied.
+    dbHashTable<_dbTechLayer>            _layer_hash;
+    dbHashTable<_dbTechVia>              _via_hash;
+    dbHashTable<_dbTechViaRule>          _via_rule_hash;
+    dbHashTable<_dbTechViaGenerateRule>  _via_generate_rule_hash;
+    dbHashTable<_dbTechNonDefaultRule>   _non_default_rule_hash;
+    dbVector< dbId<_dbTechLayer> >       _layer_number_idx;
+    dbVector< dbId<_dbTechLayer> >       _routing_level_idx;
+
     double               _getLefVersion() const;
     const char *         _getLefVersionStr() const;    
     void                 _setLefVersion(double inver);
+    void                 indexLayer( _dbTechLayer * layer );
+    void                 buildIndexes();
 
     _dbTech( _dbDatabase * db );
     _dbTech( _dbDatabase * db, const _dbTech & t );
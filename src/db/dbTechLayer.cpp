@@ -35,10 +35,12 @@
 #include "dbTechLayerSpacingRule.h"
 #include "dbTechMinCutOrAreaRule.h"
 #include "dbTechLayerAntennaRule.h"
+#include "dbTechLayerRuleCache.h"
 #include "lefout.h"
 #include "dbTable.h"
 #include "dbTable.hpp"
 #include "db.h"
+#include <mutex>
 
 
 namespace odb {
@@ -290,6 +292,7 @@ _dbTechLayer::_dbTechLayer( _dbDatabase * db )
     _v55sp_spacing.clear();
     _name = 0;
     _alias = 0;
+    _rule_cache = NULL;
 
     _spacing_rules_tbl = new dbTable<_dbTechLayerSpacingRule>(db, this, (GetObjTbl_t) &_dbTechLayer::getObjectTable, dbTechLayerSpacingRuleObj);
     ZALLOCATED(_spacing_rules_tbl);
@@ -328,7 +331,8 @@ _dbTechLayer::_dbTechLayer( _dbDatabase * db, const _dbTechLayer & l )
           _v55sp_width_idx(l._v55sp_width_idx),
           _v55sp_spacing(l._v55sp_spacing),
           _oxide1(l._oxide1),
-          _oxide2(l._oxide2)
+          _oxide2(l._oxide2),
+          _rule_cache(NULL)
 {
     if ( l._name )
     {
@@ -360,6 +364,8 @@ _dbTechLayer::~_dbTechLayer()
   if ( _name )
     free( (void *) _name );
 
+  delete _rule_cache.load();
+
   if (_spacing_rules_tbl)
     delete _spacing_rules_tbl;
 
@@ -416,6 +422,7 @@ dbOStream & operator<<( dbOStream & stream, const _dbTechLayer & layer )
 dbIStream & operator>>( dbIStream & stream, _dbTechLayer & layer )
 {
   //uint tparea;
+    layer.invalidateRuleCache();
     uint * bit_field = (uint *) &layer._flags;
     stream >> *bit_field;
     stream >> layer._pitch;
@@ -472,6 +479,35 @@ dbObjectTable * _dbTechLayer::getObjectTable( dbObjectType type )
     return getTable()->getObjectTable(type);
 }
 
+// Serializes building the rule caches, readers that find a cache built
+// never take it.
+static std::mutex rule_cache_mutex;
+
+dbTechLayerRuleCache * _dbTechLayer::getRuleCache()
+{
+    dbTechLayerRuleCache * cache = _rule_cache.load( std::memory_order_acquire );
+
+    if ( cache )
+        return cache;
+
+    std::lock_guard<std::mutex> lock( rule_cache_mutex );
+    cache = _rule_cache.load( std::memory_order_relaxed );
+
+    if ( cache == NULL )
+    {
+        cache = new dbTechLayerRuleCache(this);
+        ZALLOCATED(cache);
+        _rule_cache.store( cache, std::memory_order_release );
+    }
+
+    return cache;
+}
+
+void _dbTechLayer::invalidateRuleCache()
+{
+    delete _rule_cache.exchange( NULL );
+}
+
 ////////////////////////////////////////////////////////////////////
 //
 // dbTechLayer - Methods
@@ -587,58 +623,12 @@ int
 dbTechLayer::getSpacing( int w, int l )
 {
   _dbTechLayer * layer = (_dbTechLayer *) this;
-  dbSet<dbTechLayerSpacingRule> v54rules;
+  uint spacing;
 
-  bool found_spacing = false;
-  uint spacing = MAX_INT;
+  if ( layer->getRuleCache()->getSpacing((uint) w, (uint) l, spacing) )
+    return spacing;
 
-  bool found_over_spacing = false;
-  uint over_spacing = MAX_INT;
-  uint width = (uint) w;
-  uint length = (uint) l;
-
-  if (getV54SpacingRules(v54rules))
-    {
-      dbSet<dbTechLayerSpacingRule>::iterator  ritr;
-      dbTechLayerSpacingRule * cur_rule;
-      uint rmin, rmax;
-
-      for (ritr = v54rules.begin(); ritr != v54rules.end(); ++ritr)
-	{
-	  cur_rule = *ritr;
-	  if (cur_rule->getRange(rmin,rmax))
-            {
-              if ((width >= rmin) && (width <= rmax))
-	        {
-	          spacing = MIN(spacing, cur_rule->getSpacing());
-	          found_spacing = true;
-                }
-	      if (width > rmax)
-	        {
-	          found_over_spacing = true;
-	          over_spacing = MIN(over_spacing, cur_rule->getSpacing());
-	        }
-            }
-	}
-    }
-
-  std::vector< std::vector<uint> > v55rules;
-  uint i,j;
-  if (getV55SpacingTable(v55rules))
-    {
-      for(i = 1; (i < layer->_v55sp_width_idx.size()) && (width > layer->_v55sp_width_idx[i]); i++);
-      for(j = 1; (j < layer->_v55sp_length_idx.size()) && (length > layer->_v55sp_length_idx[j]); j++);
-      found_spacing = true;
-      spacing = v55rules[i-1][j-1];
-    }
-
-  if ((!found_spacing) && (found_over_spacing))
-    {
-      found_spacing = true;
-      spacing = over_spacing;
-    }
-
-  return (found_spacing) ? spacing : layer->_spacing ;
+  return layer->_spacing;
 }
 
 //
@@ -648,30 +638,8 @@ void
 dbTechLayer::getMaxWideDRCRange( int & owidth, int & olength )
 {
   _dbTechLayer * layer = (_dbTechLayer *) this;
-  dbSet<dbTechLayerSpacingRule> v54rules;
-
   owidth = olength = getWidth();
-
-  if (getV54SpacingRules(v54rules))
-    {
-      dbSet<dbTechLayerSpacingRule>::iterator  ritr;
-      uint rmin, rmax;
-
-      for (ritr = v54rules.begin(); ritr != v54rules.end(); ++ritr)
-	{
-	  if ((*ritr)->getRange(rmin,rmax))
-	    {
-	      if (rmin > (uint) owidth)
-		owidth = olength = rmin;
-	    }
-	}
-    }
-
-  if (hasV55SpacingRules())
-    {
-      owidth =  layer->_v55sp_width_idx[layer->_v55sp_width_idx.size()-1];
-      olength =  layer->_v55sp_length_idx[layer->_v55sp_length_idx.size()-1];
-    }
+  layer->getRuleCache()->getMaxWideDRCRange(owidth, olength);
 }
 
 //
@@ -681,31 +649,8 @@ void
 dbTechLayer::getMinWideDRCRange( int & owidth, int & olength )
 {
   _dbTechLayer * layer = (_dbTechLayer *) this;
-  dbSet<dbTechLayerSpacingRule> v54rules;
-
   owidth = olength = getWidth();
-
-  if (getV54SpacingRules(v54rules))
-    {
-      dbSet<dbTechLayerSpacingRule>::iterator  ritr;
-      uint rmin, rmax;
-      bool range_found = false;
-
-      for (ritr = v54rules.begin(); ritr != v54rules.end(); ++ritr)
-	{
-	  if ((*ritr)->getRange(rmin,rmax))
-	    {
-	      if ((rmin < (uint) owidth) || !range_found)
-		owidth = olength = rmin;
-	    }
-	}
-    }
-
-  if (hasV55SpacingRules())
-    {
-      owidth =  layer->_v55sp_width_idx[1];
-      olength =  layer->_v55sp_length_idx[1];
-    }
+  layer->getRuleCache()->getMinWideDRCRange(owidth, olength);
 }
 
 bool
@@ -777,6 +722,7 @@ dbTechLayer::initV55LengthIndex( uint numelems )
 {
   _dbTechLayer * layer = (_dbTechLayer *) this;
   layer->_v55sp_length_idx.reserve(numelems);
+  layer->invalidateRuleCache();
 }
 
 void
@@ -784,6 +730,7 @@ dbTechLayer::addV55LengthEntry( uint length )
 {
   _dbTechLayer * layer = (_dbTechLayer *) this;
   layer->_v55sp_length_idx.push_back(length);
+  layer->invalidateRuleCache();
 }
 
 void
@@ -791,6 +738,7 @@ dbTechLayer::initV55WidthIndex( uint numelems )
 {
   _dbTechLayer * layer = (_dbTechLayer *) this;
   layer->_v55sp_width_idx.reserve(numelems);
+  layer->invalidateRuleCache();
 }
 
 void
@@ -798,6 +746,7 @@ dbTechLayer::addV55WidthEntry( uint width )
 {
   _dbTechLayer * layer = (_dbTechLayer *) this;
   layer->_v55sp_width_idx.push_back(width);
+  layer->invalidateRuleCache();
 }
 
 void
@@ -805,6 +754,7 @@ dbTechLayer::initV55SpacingTable( uint numrows, uint numcols )
 {
   _dbTechLayer * layer = (_dbTechLayer *) this;
   layer->_v55sp_spacing.resize(numrows,numcols);
+  layer->invalidateRuleCache();
 }
 
 
@@ -813,41 +763,24 @@ dbTechLayer::addV55SpacingTableEntry( uint inrow, uint incol, uint spacing )
 {
   _dbTechLayer * layer = (_dbTechLayer *) this;
   layer->_v55sp_spacing(inrow,incol) = spacing;
+  layer->invalidateRuleCache();
 }
 
 
 bool
 dbTechLayer::getV55InfluenceRules( std::vector<dbTechV55InfluenceEntry *> & inf_tbl ) 
 {
-    inf_tbl.clear();
-    dbSet<dbTechV55InfluenceEntry> entries = getV55InfluenceEntries();
-
-    if ( entries.size() == 0 )
-        return false;
-    
-    dbSet<dbTechV55InfluenceEntry>::iterator itr;
-
-    for( itr = entries.begin(); itr != entries.end(); ++itr )
-        inf_tbl.push_back( *itr );
-    
-    return true;
+    _dbTechLayer * layer = (_dbTechLayer *) this;
+    inf_tbl = layer->getRuleCache()->getInfluenceRules();
+    return ! inf_tbl.empty();
 }
 
 bool
 dbTechLayer::getMinimumCutRules( std::vector<dbTechMinCutRule *> & cut_rules )
 {
-    cut_rules.clear();
-    dbSet<dbTechMinCutRule> rules = getMinCutRules();
-
-    if ( rules.size() == 0 )
-        return false;
-    
-    dbSet<dbTechMinCutRule>::iterator itr;
-
-    for( itr = rules.begin(); itr != rules.end(); ++itr )
-      cut_rules.push_back((dbTechMinCutRule *) *itr);
-        
-    return true;
+    _dbTechLayer * layer = (_dbTechLayer *) this;
+    cut_rules = layer->getRuleCache()->getMinCutRules();
+    return ! cut_rules.empty();
 }
 
 dbSet<dbTechMinCutRule> dbTechLayer::getMinCutRules()
@@ -877,19 +810,9 @@ dbSet<dbTechV55InfluenceEntry> dbTechLayer::getV55InfluenceEntries()
 bool
 dbTechLayer::getMinEnclosureRules( std::vector<dbTechMinEncRule *> & enc_rules )
 {
-    enc_rules.clear();
-    
-    dbSet<dbTechMinEncRule> rules = getMinEncRules();
-
-    if ( rules.size() == 0 )
-        return false;
-  
-    dbSet<dbTechMinEncRule>::iterator itr;
-
-    for( itr = rules.begin(); itr != rules.end(); ++itr )
-        enc_rules.push_back(*itr);
-  
-    return true;
+    _dbTechLayer * layer = (_dbTechLayer *) this;
+    enc_rules = layer->getRuleCache()->getMinEncRules();
+    return ! enc_rules.empty();
 }
 
 dbTechLayerAntennaRule *
@@ -1270,6 +1193,8 @@ dbTechLayer::create( dbTech * tech_, const char * name_, dbTechLayerType type )
         layer->_rlevel = ++tech->_rlayer_cnt;
     }
 
+    tech->indexLayer(layer);
+
     if ( tech->_bottom == 0 )
     {
         tech->_bottom = layer->getOID();
@@ -52,6 +52,8 @@
 #include "dbMatrix.h"
 #endif
 
+#include <atomic>
+
 namespace odb {
 
 template <class T> class dbTable;
@@ -62,6 +64,7 @@ class _dbTechMinCutRule;
 class _dbTechMinEncRule;
 class _dbTechV55InfluenceEntry;
 class _dbTechLayerAntennaRule;
+class dbTechLayerRuleCache;
 class dbIStream;
 class dbOStream;
 class dbDiff;
@@ -116,6 +119,10 @@ struct _LyFlags
     dbId<_dbTechLayerAntennaRule>       _oxide1;
     dbId<_dbTechLayerAntennaRule>       _oxide2;
 
+    // NON-PERSISTANT-NON-STREAMED-MEMBERS
+    std::atomic<dbTechLayerRuleCache *> _rule_cache;
+    dbId<_dbTechLayer>                  _next_entry;
+
     _dbTechLayer( _dbDatabase * db);
     _dbTechLayer( _dbDatabase * db, const _dbTechLayer & l);
     ~_dbTechLayer();
@@ -131,6 +138,11 @@ struct _LyFlags
     }
 
     dbObjectTable * getObjectTable( dbObjectType type );
+
+    // Compiled rules, built on demand (thread safe). Any rule edit must
+    // invalidate them.
+    dbTechLayerRuleCache * getRuleCache();
+    void invalidateRuleCache();
 };
 
 dbOStream & operator<<( dbOStream & stream, const _dbTechLayer & layer );
@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <functional>
+#include "dbTechLayerRuleCache.h"
+#include "dbTechLayer.h"
+#include "dbTechLayerSpacingRule.h"
+#include "dbTechMinCutOrAreaRule.h"
+#include "dbTable.h"
+#include "db.h"
+
+namespace odb {
+
+dbTechLayerRuleCache::dbTechLayerRuleCache( _dbTechLayer * layer )
+{
+    compileV54(layer);
+    compileV55(layer);
+
+    dbTechLayer * tech_layer = (dbTechLayer *) layer;
+
+    dbSet<dbTechV55InfluenceEntry> entries = tech_layer->getV55InfluenceEntries();
+    _influence.reserve(entries.size());
+    dbSet<dbTechV55InfluenceEntry>::iterator iitr;
+
+    for( iitr = entries.begin(); iitr != entries.end(); ++iitr )
+        _influence.push_back(*iitr);
+
+    dbSet<dbTechMinCutRule> cut_rules = tech_layer->getMinCutRules();
+    _min_cut.reserve(cut_rules.size());
+    dbSet<dbTechMinCutRule>::iterator citr;
+
+    for( citr = cut_rules.begin(); citr != cut_rules.end(); ++citr )
+        _min_cut.push_back(*citr);
+
+    dbSet<dbTechMinEncRule> enc_rules = tech_layer->getMinEncRules();
+    _min_enc.reserve(enc_rules.size());
+    dbSet<dbTechMinEncRule>::iterator eitr;
+
+    for( eitr = enc_rules.begin(); eitr != enc_rules.end(); ++eitr )
+        _min_enc.push_back(*eitr);
+}
+
+//
+// Fold the range rules into a step function over the width. The result of
+// the rule scan only changes at a range boundary, so it is evaluated once at
+// the start of each interval.
+//
+void dbTechLayerRuleCache::compileV54( _dbTechLayer * layer )
+{
+    struct Range
+    {
+        uint _min;
+        uint _max;
+        uint _spacing;
+    };
+
+    std::vector<Range> ranges;
+    dbSet<dbTechLayerSpacingRule> rules(layer, layer->_spacing_rules_tbl);
+    dbSet<dbTechLayerSpacingRule>::iterator itr;
+
+    _has_range = false;
+    _max_rmin = 0;
+    _last_rmin = 0;
+
+    for( itr = rules.begin(); itr != rules.end(); ++itr )
+    {
+        Range r;
+
+        if ( ! (*itr)->getRange(r._min, r._max) )
+            continue;
+
+        r._spacing = (*itr)->getSpacing();
+        ranges.push_back(r);
+
+        _max_rmin = _has_range ? std::max(_max_rmin, r._min) : r._min;
+        _last_rmin = r._min;
+        _has_range = true;
+    }
+
+    _v54_bounds.push_back(0);
+
+    std::vector<Range>::iterator ritr;
+
+    for( ritr = ranges.begin(); ritr != ranges.end(); ++ritr )
+    {
+        _v54_bounds.push_back(ritr->_min);
+
+        if ( ritr->_max < 0xffffffffU )
+            _v54_bounds.push_back(ritr->_max + 1);
+    }
+
+    std::sort(_v54_bounds.begin(), _v54_bounds.end());
+    _v54_bounds.erase(std::unique(_v54_bounds.begin(), _v54_bounds.end()), _v54_bounds.end());
+    _v54_spacing.resize(_v54_bounds.size());
+    _v54_found.resize(_v54_bounds.size());
+
+    uint k;
+
+    for( k = 0; k < _v54_bounds.size(); ++k )
+    {
+        uint width = _v54_bounds[k];
+        bool found_spacing = false;
+        uint spacing = MAX_INT;
+        bool found_over_spacing = false;
+        uint over_spacing = MAX_INT;
+
+        for( ritr = ranges.begin(); ritr != ranges.end(); ++ritr )
+        {
+            if ( (width >= ritr->_min) && (width <= ritr->_max) )
+            {
+                spacing = std::min(spacing, ritr->_spacing);
+                found_spacing = true;
+            }
+
+            if ( width > ritr->_max )
+            {
+                over_spacing = std::min(over_spacing, ritr->_spacing);
+                found_over_spacing = true;
+            }
+        }
+
+        _v54_found[k] = found_spacing || found_over_spacing;
+        _v54_spacing[k] = found_spacing ? spacing : over_spacing;
+    }
+}
+
+void dbTechLayerRuleCache::compileV55( _dbTechLayer * layer )
+{
+    _v55_width.assign(layer->_v55sp_width_idx.begin(), layer->_v55sp_width_idx.end());
+    _v55_length.assign(layer->_v55sp_length_idx.begin(), layer->_v55sp_length_idx.end());
+    _v55_cols = layer->_v55sp_spacing.numCols();
+
+    uint i, j;
+    _v55_spacing.reserve(layer->_v55sp_spacing.numElems());
+
+    for( i = 0; i < layer->_v55sp_spacing.numRows(); ++i )
+        for( j = 0; j < _v55_cols; ++j )
+            _v55_spacing.push_back(layer->_v55sp_spacing(i, j));
+
+    _has_v55_table = ! _v55_spacing.empty();
+    _has_v55_rules = _has_v55_table && ! _v55_width.empty() && ! _v55_length.empty();
+
+    // LEF requires ascending indexes; fall back to a scan for anything else.
+    _v55_sorted = (std::adjacent_find(_v55_width.begin(), _v55_width.end(), std::greater<uint>()) == _v55_width.end())
+                  && (std::adjacent_find(_v55_length.begin(), _v55_length.end(), std::greater<uint>()) == _v55_length.end());
+}
+
+//
+// Returns the first index i >= 1 such that value <= idx[i], or idx.size()
+// if there is none. The first entry of an index never takes part in the
+// search, it is the lower bound of the first row/column.
+//
+uint dbTechLayerRuleCache::findIndex( const std::vector<uint> & idx, uint value, bool sorted )
+{
+    if ( idx.size() <= 1 )
+        return 1;
+
+    if ( sorted )
+        return std::lower_bound(idx.begin() + 1, idx.end(), value) - idx.begin();
+
+    uint i;
+    for( i = 1; (i < idx.size()) && (value > idx[i]); ++i );
+    return i;
+}
+
+bool dbTechLayerRuleCache::getSpacing( uint width, uint length, uint & spacing ) const
+{
+    if ( _has_v55_table )
+    {
+        uint rows = _v55_spacing.size() / _v55_cols;
+        uint i = std::min(findIndex(_v55_width, width, _v55_sorted), rows);
+        uint j = std::min(findIndex(_v55_length, length, _v55_sorted), _v55_cols);
+        spacing = _v55_spacing[(i - 1) * _v55_cols + (j - 1)];
+        return true;
+    }
+
+    uint k = std::upper_bound(_v54_bounds.begin(), _v54_bounds.end(), width) - _v54_bounds.begin() - 1;
+    spacing = _v54_spacing[k];
+    return _v54_found[k];
+}
+
+void dbTechLayerRuleCache::getMaxWideDRCRange( int & owidth, int & olength ) const
+{
+    if ( _has_v55_rules )
+    {
+        owidth = _v55_width.back();
+        olength = _v55_length.back();
+    }
+    else if ( _has_range && (_max_rmin > (uint) owidth) )
+        owidth = olength = _max_rmin;
+}
+
+void dbTechLayerRuleCache::getMinWideDRCRange( int & owidth, int & olength ) const
+{
+    if ( _has_v55_rules )
+    {
+        owidth = _v55_width[_v55_width.size() > 1 ? 1 : 0];
+        olength = _v55_length[_v55_length.size() > 1 ? 1 : 0];
+    }
+    else if ( _has_range )
+        owidth = olength = _last_rmin;
+}
+
+} // namespace
@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_TECH_LAYER_RULE_CACHE_H
+#define ADS_DB_TECH_LAYER_RULE_CACHE_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#include <vector>
+
+namespace odb {
+
+class _dbTechLayer;
+class dbTechV55InfluenceEntry;
+class dbTechMinCutRule;
+class dbTechMinEncRule;
+
+//
+// dbTechLayerRuleCache - Compiled form of the design rules of a layer.
+//
+// The V5.4 range rules are folded into a step function over the width, so a
+// spacing lookup is one binary search. The V5.5 spacing table is kept as a
+// flat row-major array addressed by binary searches on the width and length
+// indexes. The cache is not persistent; the layer builds it on the first
+// lookup and drops it whenever one of its rules is edited. Concurrent
+// lookups are safe, lookups concurrent with rule edits are not.
+//
+class dbTechLayerRuleCache
+{
+    // V5.4 range rules: _v54_spacing[k] applies to widths in
+    // [_v54_bounds[k], _v54_bounds[k+1]). _v54_found[k] is 0 when no rule
+    // applies to the interval.
+    std::vector<uint>                       _v54_bounds;
+    std::vector<uint>                       _v54_spacing;
+    std::vector<unsigned char>              _v54_found;
+    bool                                    _has_range;
+    uint                                    _max_rmin;
+    uint                                    _last_rmin;
+
+    // V5.5 spacing table
+    std::vector<uint>                       _v55_width;
+    std::vector<uint>                       _v55_length;
+    std::vector<uint>                       _v55_spacing;
+    uint                                    _v55_cols;
+    bool                                    _has_v55_table;
+    bool                                    _has_v55_rules;
+    bool                                    _v55_sorted;
+
+    std::vector<dbTechV55InfluenceEntry *>  _influence;
+    std::vector<dbTechMinCutRule *>         _min_cut;
+    std::vector<dbTechMinEncRule *>         _min_enc;
+
+    void compileV54( _dbTechLayer * layer );
+    void compileV55( _dbTechLayer * layer );
+    static uint findIndex( const std::vector<uint> & idx, uint value, bool sorted );
+
+  public:
+    dbTechLayerRuleCache( _dbTechLayer * layer );
+
+    // Returns false if no rule applies to this width; the layer spacing is used.
+    bool getSpacing( uint width, uint length, uint & spacing ) const;
+    void getMaxWideDRCRange( int & owidth, int & olength ) const;
+    void getMinWideDRCRange( int & owidth, int & olength ) const;
+
+    const std::vector<dbTechV55InfluenceEntry *> & getInfluenceRules() const { return _influence; }
+    const std::vector<dbTechMinCutRule *> & getMinCutRules() const { return _min_cut; }
+    const std::vector<dbTechMinEncRule *> & getMinEncRules() const { return _min_enc; }
+};
+
+} // namespace
+
+#endif
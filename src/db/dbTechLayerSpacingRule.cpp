@@ -205,6 +205,13 @@ dbIStream & operator>>( dbIStream & stream, _dbTechV55InfluenceEntry & infitem )
 
 using namespace TechLayerSpacingRule;
 
+// The range rules are compiled into the layer rule cache.
+static void invalidateRuleCache( dbTechLayerSpacingRule * rule )
+{
+  _dbTechLayer * layer = (_dbTechLayer *) rule->getOwner();
+  layer->invalidateRuleCache();
+}
+
 uint
 dbTechLayerSpacingRule::getSpacing() const
 {
@@ -217,6 +224,7 @@ dbTechLayerSpacingRule::setSpacing( uint spacing )
 {
   _dbTechLayerSpacingRule * _lsp = (_dbTechLayerSpacingRule *) this;
   _lsp->_spacing = spacing;
+  invalidateRuleCache(this);
 }
 
 bool
@@ -382,6 +390,7 @@ dbTechLayerSpacingRule::setRange( uint rmin, uint rmax )
 
   _lsp->_r1min = rmin;
   _lsp->_r1max = rmax;
+  invalidateRuleCache(this);
 }
 
 void
@@ -395,6 +404,7 @@ dbTechLayerSpacingRule::setUseLengthThreshold()
 	 (_lsp->_flags._rule != RANGE_INFLUENCE));
 
   _lsp->_flags._rule = RANGE_USELENGTH;
+  invalidateRuleCache(this);
 }
 
 void
@@ -414,6 +424,7 @@ dbTechLayerSpacingRule::setInfluence( uint influence )
     _lsp->_flags._rule = RANGE_INFLUENCE;
 
   _lsp->_length_or_influence = influence;
+  invalidateRuleCache(this);
 }
 
 void
@@ -428,6 +439,7 @@ dbTechLayerSpacingRule::setInfluenceRange( uint rmin, uint rmax )
   _lsp->_flags._rule = RANGE_INFLUENCE_RANGE;
   _lsp->_r2min = rmin;
   _lsp->_r2max = rmax;
+  invalidateRuleCache(this);
 }
 
 void
@@ -443,6 +455,7 @@ dbTechLayerSpacingRule::setRangeRange( uint rmin, uint rmax )
   _lsp->_flags._rule = RANGE_RANGE;
   _lsp->_r2min = rmin;
   _lsp->_r2max = rmax;
+  invalidateRuleCache(this);
 }
 
 void
@@ -480,6 +493,7 @@ dbTechLayerSpacingRule::create( dbTechLayer * inly )
   _dbTechLayer * layer = (_dbTechLayer *) inly;
   _dbTechLayerSpacingRule * newrule = layer->_spacing_rules_tbl->create();
   newrule->_layer = inly->getOID();
+  layer->invalidateRuleCache();
 
   return ((dbTechLayerSpacingRule *) newrule);
 }
@@ -578,6 +592,7 @@ dbTechV55InfluenceEntry::create( dbTechLayer * inly )
 {
   _dbTechLayer * layer = (_dbTechLayer *) inly;
   _dbTechV55InfluenceEntry * newitem = layer->_v55inf_tbl->create();
+  layer->invalidateRuleCache();
   return ((dbTechV55InfluenceEntry *) newitem);
 }
 
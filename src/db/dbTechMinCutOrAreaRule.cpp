@@ -282,6 +282,7 @@ dbTechMinCutRule::create( dbTechLayer * inly )
 {
   _dbTechLayer * layer = (_dbTechLayer *) inly;
   _dbTechMinCutRule * newrule = layer->_min_cut_rules_tbl->create();
+  layer->invalidateRuleCache();
   return ((dbTechMinCutRule *) newrule);
 }
 
@@ -351,6 +352,7 @@ dbTechMinEncRule::create( dbTechLayer * inly )
 {
   _dbTechLayer * layer = (_dbTechLayer *) inly;
   _dbTechMinEncRule * newrule = layer->_min_enc_rules_tbl->create();
+  layer->invalidateRuleCache();
   return ((dbTechMinEncRule *) newrule);
 }
 
@@ -447,6 +447,7 @@ dbTechNonDefaultRule::create( dbTech * tech_, const char * name_ )
     _dbTechNonDefaultRule * rule = tech->_non_default_rule_tbl->create();
     rule->_name = strdup(name_);
     ZALLOCATED(rule->_name);
+    tech->_non_default_rule_hash.insert(rule);
     rule->_layer_rules.resize( tech->_layer_cnt );
     
     int i;
@@ -91,6 +91,9 @@ class _dbTechNonDefaultRule : public dbObject
     dbVector< dbId<_dbTechViaGenerateRule> > _use_rules;
     dbVector< dbId<_dbTechLayer> >           _cut_layers;
     dbVector<int>                            _min_cuts;
+
+    // NON-PERSISTANT-NON-STREAMED-MEMBERS
+    dbId<_dbTechNonDefaultRule>              _next_entry;  // tech rules only
     
     _dbTechNonDefaultRule( _dbDatabase * );
     _dbTechNonDefaultRule( _dbDatabase *, const _dbTechNonDefaultRule & r );
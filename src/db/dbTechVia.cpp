@@ -452,6 +452,7 @@ dbTechVia::create( dbTech * tech_, const char * name_ )
     _dbTechVia * via = tech->_via_tbl->create();
     via->_name = strdup(name_);
     ZALLOCATED(via->_name);
+    tech->_via_hash.insert(via);
     tech->_via_cnt++;
     return (dbTechVia *) via;
 }
@@ -471,6 +472,7 @@ dbTechVia::clone( dbTechNonDefaultRule * rule_,  dbTechVia * invia_, const char
     _dbTechVia * via = tech->_via_tbl->create();
     via->_name = strdup(new_name);
     ZALLOCATED(via->_name);
+    tech->_via_hash.insert(via);
 
     via->_flags = _invia->_flags;
     via->_resistance = _invia->_resistance;
@@ -501,6 +503,7 @@ dbTechVia::create( dbTechNonDefaultRule * rule_, const char * name_ )
     _dbTechVia * via = tech->_via_tbl->create();
     via->_name = strdup(name_);
     ZALLOCATED(via->_name);
+    tech->_via_hash.insert(via);
     tech->_via_cnt++;
     via->_non_default_rule = rule->getOID();
     rule->_vias.push_back(via->getOID());
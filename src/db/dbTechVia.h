@@ -87,6 +87,9 @@ class _dbTechVia : public dbObject
     dbId<_dbTechViaGenerateRule> _generate_rule;   // via generated by tech-via-rule, 5.6 DEF
     _dbViaParams                 _via_params;      // params used to generate this via, 5.6 DEF
 
+    // NON-PERSISTANT-NON-STREAMED-MEMBERS
+    dbId<_dbTechVia>             _next_entry;      // dbTech::_via_hash chain
+
     _dbTechVia( _dbDatabase *, const _dbTechVia & v );
     _dbTechVia( _dbDatabase * );
     ~_dbTechVia();
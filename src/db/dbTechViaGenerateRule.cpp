@@ -180,6 +180,7 @@ dbTechViaGenerateRule:: create( dbTech * tech_, const char * name, bool is_defau
     rule->_name = strdup(name);
     ZALLOCATED(rule->_name);
     rule->_flags._default = is_default;
+    tech->_via_generate_rule_hash.insert(rule);
     return (dbTechViaGenerateRule *) rule;
 }
 
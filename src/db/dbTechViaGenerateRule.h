@@ -82,6 +82,9 @@ class _dbTechViaGenerateRule : public dbObject
     char *                      _name;
     dbVector<uint>              _layer_rules;
 
+    // NON-PERSISTANT-NON-STREAMED-MEMBERS
+    dbId<_dbTechViaGenerateRule> _next_entry;
+
     _dbTechViaGenerateRule( _dbDatabase *, const _dbTechViaGenerateRule & v );
     _dbTechViaGenerateRule( _dbDatabase * );
     ~_dbTechViaGenerateRule();
@@ -198,6 +198,7 @@ dbTechViaRule::create( dbTech * tech_, const char * name )
     _dbTechViaRule * rule = tech->_via_rule_tbl->create();
     rule->_name = strdup(name);
     ZALLOCATED(rule->_name);
+    tech->_via_rule_hash.insert(rule);
     return (dbTechViaRule *) rule;
 }
 
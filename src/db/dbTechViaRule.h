@@ -79,6 +79,9 @@ class _dbTechViaRule : public dbObject
     dbVector<uint>       _layer_rules;
     dbVector<uint>       _vias;
 
+    // NON-PERSISTANT-NON-STREAMED-MEMBERS
+    dbId<_dbTechViaRule> _next_entry;
+
     _dbTechViaRule( _dbDatabase *, const _dbTechViaRule & v );
     _dbTechViaRule( _dbDatabase * );
     ~_dbTechViaRule();
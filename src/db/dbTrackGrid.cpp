@@ -122,34 +122,8 @@ void dbTrackGrid::getGridX( std::vector<int> & x_grid )
 
     _dbTrackGrid * grid = (_dbTrackGrid *) this;
 
-    uint i;
-
-    for( i = 0; i < grid->_x_origin.size(); ++i )
-    {
-        int j;
-
-        int x = grid->_x_origin[i];
-        int count = grid->_x_count[i];
-        int step = grid->_x_step[i];
-
-        for ( j = 0; j < count; ++j )
-        {
-            x_grid.push_back( x );
-            x += step;
-        }
-    }
-
-    // empty grid
-    if ( x_grid.begin() == x_grid.end() )
-        return;
-    
-    // sort coords in asscending order
-    std::sort( x_grid.begin(), x_grid.end() );
-
-    // remove any duplicates
-    std::vector<int>::iterator new_end;
-    new_end = std::unique( x_grid.begin(), x_grid.end() );
-    x_grid.erase( new_end, x_grid.end() );
+    // coords in ascending order without duplicates
+    grid->getAxisX().getCoords( x_grid );
 }
 
 void dbTrackGrid::getGridY( std::vector<int> & y_grid )
@@ -158,34 +132,8 @@ void dbTrackGrid::getGridY( std::vector<int> & y_grid )
 
     _dbTrackGrid * grid = (_dbTrackGrid *) this;
 
-    uint i;
-
-    for( i = 0; i < grid->_y_origin.size(); ++i )
-    {
-        int j;
-
-        int y = grid->_y_origin[i];
-        int count = grid->_y_count[i];
-        int step = grid->_y_step[i];
-
-        for ( j = 0; j < count; ++j )
-        {
-            y_grid.push_back( y );
-            y += step;
-        }
-    }
-
-    // empty grid
-    if ( y_grid.begin() == y_grid.end() )
-        return;
-    
-    // sort coords in asscending order
-    std::sort( y_grid.begin(), y_grid.end() );
-
-    // remove any duplicates
-    std::vector<int>::iterator new_end;
-    new_end = std::unique( y_grid.begin(), y_grid.end() );
-    y_grid.erase( new_end, y_grid.end() );
+    // coords in ascending order without duplicates
+    grid->getAxisY().getCoords( y_grid );
 }
 
 dbBlock *
@@ -201,6 +149,7 @@ dbTrackGrid::addGridPatternX( int origin_x, int line_count, int step )
     grid->_x_origin.push_back( origin_x );
     grid->_x_count.push_back( line_count );
     grid->_x_step.push_back( step );
+    grid->_x_axis.build( grid->_x_origin, grid->_x_count, grid->_x_step );
 }
 
 void 
@@ -210,6 +159,7 @@ dbTrackGrid::addGridPatternY( int origin_y, int line_count, int step )
     grid->_y_origin.push_back( origin_y );
     grid->_y_count.push_back( line_count );
     grid->_y_step.push_back( step );
+    grid->_y_axis.build( grid->_y_origin, grid->_y_count, grid->_y_step );
 }
 
 int 
@@ -246,6 +196,76 @@ dbTrackGrid::getGridPatternY( int i, int & origin_y, int & line_count, int & ste
     step = grid->_y_step[i];
 }
 
+int
+dbTrackGrid::getGridCountX()
+{
+    _dbTrackGrid * grid = (_dbTrackGrid *) this;
+    return grid->getAxisX().getCount();
+}
+
+int
+dbTrackGrid::getGridCoordX( int idx )
+{
+    _dbTrackGrid * grid = (_dbTrackGrid *) this;
+    return grid->getAxisX().getCoord(idx);
+}
+
+int
+dbTrackGrid::findGridIndexX( int x )
+{
+    _dbTrackGrid * grid = (_dbTrackGrid *) this;
+    return grid->getAxisX().findIndex(x);
+}
+
+int
+dbTrackGrid::findNearestGridX( int x )
+{
+    _dbTrackGrid * grid = (_dbTrackGrid *) this;
+    return grid->getAxisX().findNearest(x);
+}
+
+void
+dbTrackGrid::findGridRangeX( int lo, int hi, int & first, int & end )
+{
+    _dbTrackGrid * grid = (_dbTrackGrid *) this;
+    grid->getAxisX().findRange(lo, hi, first, end);
+}
+
+int
+dbTrackGrid::getGridCountY()
+{
+    _dbTrackGrid * grid = (_dbTrackGrid *) this;
+    return grid->getAxisY().getCount();
+}
+
+int
+dbTrackGrid::getGridCoordY( int idx )
+{
+    _dbTrackGrid * grid = (_dbTrackGrid *) this;
+    return grid->getAxisY().getCoord(idx);
+}
+
+int
+dbTrackGrid::findGridIndexY( int y )
+{
+    _dbTrackGrid * grid = (_dbTrackGrid *) this;
+    return grid->getAxisY().findIndex(y);
+}
+
+int
+dbTrackGrid::findNearestGridY( int y )
+{
+    _dbTrackGrid * grid = (_dbTrackGrid *) this;
+    return grid->getAxisY().findNearest(y);
+}
+
+void
+dbTrackGrid::findGridRangeY( int lo, int hi, int & first, int & end )
+{
+    _dbTrackGrid * grid = (_dbTrackGrid *) this;
+    grid->getAxisY().findRange(lo, hi, first, end);
+}
+
 dbTrackGrid * dbTrackGrid::create( dbBlock * block_, dbTechLayer * layer_ )
 {
     _dbBlock * block = (_dbBlock *) block_;
@@ -52,6 +52,10 @@
 #include "dbVector.h"
 #endif
 
+#ifndef ADS_DB_GRID_AXIS_H
+#include "dbGridAxis.h"
+#endif
+
 namespace odb {
 
 class _dbTechLayer;
@@ -71,6 +75,10 @@ class _dbTrackGrid : public dbObject
     dbVector<int>      _y_count;
     dbVector<int>      _y_step;
     dbId<_dbTechLayer> _next_grid;
+
+    // NON-PERSISTANT-MEMBERS (rebuilt whenever the patterns change)
+    dbGridAxis         _x_axis;
+    dbGridAxis         _y_axis;
     
     _dbTrackGrid( _dbDatabase *, const _dbTrackGrid & g );
     _dbTrackGrid( _dbDatabase * );
@@ -92,6 +100,10 @@ class _dbTrackGrid : public dbObject
     
     void differences( dbDiff & diff, const char * field, const _dbTrackGrid & rhs ) const;
     void out( dbDiff & diff, char side, const char * field ) const;
+
+    const dbGridAxis & getAxisX() const { return _x_axis; }
+
+    const dbGridAxis & getAxisY() const { return _y_axis; }
 };
 
 inline _dbTrackGrid::_dbTrackGrid( _dbDatabase *, const _dbTrackGrid & g )
@@ -102,7 +114,9 @@ inline _dbTrackGrid::_dbTrackGrid( _dbDatabase *, const _dbTrackGrid & g )
           _y_origin(g._y_origin),
           _y_count(g._y_count),
           _y_step(g._y_step),
-          _next_grid(g._next_grid)
+          _next_grid(g._next_grid),
+          _x_axis(g._x_axis),
+          _y_axis(g._y_axis)
 {
 }
 
@@ -136,6 +150,8 @@ inline dbIStream & operator>>( dbIStream & stream, _dbTrackGrid & grid )
     stream >> grid._y_origin;
     stream >> grid._y_count;
     stream >> grid._y_step;
+    grid._x_axis.build( grid._x_origin, grid._x_count, grid._x_step );
+    grid._y_axis.build( grid._y_origin, grid._y_count, grid._y_step );
     stream >> grid._next_grid;
     return stream;
 }
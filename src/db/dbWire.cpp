@@ -38,11 +38,14 @@
 #include "dbTechLayerRule.h"
 #include "dbShape.h"
 #include "dbWireOpcode.h"
+#include "dbWireSpill.h"
 #include "dbTable.h"
+#include "dbJournal.h"
 #include "dbTable.hpp"
 #include "db.h"
 #include "dbRtTree.h"
 #include <algorithm>
+#include <string.h>
 
 namespace odb {
 
@@ -133,24 +136,64 @@ void _dbWire::out( dbDiff & diff, char side, const char * field ) const
 
 dbOStream & operator<<( dbOStream & stream, const _dbWire & wire )
 {
-    uint *bit_field = (uint *) &wire._flags;
-    stream << *bit_field;
-    stream << wire._data;
-    stream << wire._opcodes;
+    _dbWireFlags flags = wire._flags;
+    flags._spilled = 0;
+    uint bit_field;
+    memcpy( &bit_field, &flags, sizeof(bit_field) );
+    stream << bit_field;
+
+    if ( wire._flags._spilled )
+    {
+        // Copy the encoding back from the spill file, one wire at a time.
+        _dbBlock * block = (_dbBlock *) wire.getOwner();
+        dbVector<int> data;
+        dbVector<unsigned char> opcodes;
+        block->_wire_spill->restore( wire.getOID(), data, opcodes );
+        stream << data;
+        stream << opcodes;
+    }
+    else
+    {
+        stream << wire._data;
+        stream << wire._opcodes;
+    }
+
     stream << wire._net;
     return stream;
 }
 
 dbIStream & operator>>( dbIStream & stream, _dbWire & wire )
 {
-    uint *bit_field = (uint *) &wire._flags;
-    stream >> *bit_field;
+    uint bit_field;
+    stream >> bit_field;
+    memcpy( &wire._flags, &bit_field, sizeof(bit_field) );
     stream >> wire._data;
     stream >> wire._opcodes;
     stream >> wire._net;
     return stream;
 }
 
+void _dbWire::unspill()
+{
+    if ( ! _flags._spilled )
+        return;
+
+    _dbBlock * block = (_dbBlock *) getOwner();
+    block->_wire_spill->restore( getOID(), _data, _opcodes );
+    block->_wire_spill->release( getOID() );
+    _flags._spilled = 0;
+}
+
+void _dbWire::dropSpill()
+{
+    if ( ! _flags._spilled )
+        return;
+
+    _dbBlock * block = (_dbBlock *) getOwner();
+    block->_wire_spill->release( getOID() );
+    _flags._spilled = 0;
+}
+
 class dbDiffShapeCmp
 {
 public:
@@ -1661,6 +1704,9 @@ void dbWire::append( dbWire * src_, bool singleSegmentWire )
     _dbBlock * dst_block = (_dbBlock *) dst->getOwner();
 
     assert( dst->getDatabase() == src->getDatabase() );
+
+    src->unspill();
+    dst->unspill();
     
     // we can't move bterms or iterms of another block
     if ( src_block != dst_block && !singleSegmentWire)
@@ -1677,6 +1723,7 @@ void dbWire::append( dbWire * src_, bool singleSegmentWire )
         }
     }
 
+    dbWireUpdate update(dst);
     uint sz = dst->_opcodes.size();
     dst->_opcodes.insert( dst->_opcodes.end(), src->_opcodes.begin(), src->_opcodes.end() );
     dst->_data.insert( dst->_data.end(), src->_data.begin(), src->_data.end() );
@@ -1716,6 +1763,8 @@ void dbWire::append( dbWire * src_, bool singleSegmentWire )
         if ( (opcode == WOP_SHORT) || (opcode == WOP_JUNCTION) || (opcode == WOP_VWIRE) )
             dst->_data[i] += sz;
     }
+
+    update.end();
 }
 
 void dbWire::attach( dbNet * net_ )
@@ -1732,8 +1781,10 @@ void dbWire::attach( dbNet * net_ )
     if ( wire->_net != 0 )
         detach();
 
+    dbWireUpdate update( net, false );
     wire->_net = net->getOID();
     net->_wire = wire->getOID();
+    update.end();
 }
 
 void dbWire::detach()
@@ -1744,9 +1795,11 @@ void dbWire::detach()
     if ( wire->_net == 0 )
         return;
 
+    dbWireUpdate update(wire);
     _dbNet * net = (_dbNet *) getNet();
     net->_wire = 0;
     wire->_net = 0;
+    update.end();
 }
 
 void dbWire::ecoUpdate()
@@ -1763,6 +1816,10 @@ void dbWire::copy( dbWire * dst_, dbWire * src_, bool removeITermsBTerms, bool c
     _dbWire * src = (_dbWire *) src_;
 
     assert( dst->getDatabase() == src->getDatabase() );
+
+    src->unspill();
+    dbWireUpdate update(dst);
+    dst->dropSpill();
     
     uint n = src->_opcodes.size();
 
@@ -1822,10 +1879,14 @@ void dbWire::copy( dbWire * dst_, dbWire * src_, bool removeITermsBTerms, bool c
             }
         }
     }
+
+    update.end();
 }
 
 void dbWire::copy( dbWire * dst, dbWire * src, const adsRect & bbox, bool removeITermsBTerms, bool copyVias )
 {
+    ((_dbWire *) src)->unspill();
+
     dbRtTree tree;
     tree.decode(src,!removeITermsBTerms);
 
@@ -1888,6 +1949,7 @@ dbWire * dbWire::create( dbNet * net_, bool global_wire )
             return NULL;
     }
 
+    dbWireUpdate update( net, global_wire );
     _dbBlock * block = (_dbBlock *) net->getOwner();
     _dbWire * wire = block->_wire_tbl->create();
     wire->_net = net->getOID();
@@ -1902,6 +1964,7 @@ dbWire * dbWire::create( dbNet * net_, bool global_wire )
 
     net->_flags._wire_ordered = 0;
     net->_flags._disconnected = 0;
+    update.end();
     return (dbWire *) wire;
 }
 
@@ -1924,6 +1987,10 @@ void dbWire::destroy( dbWire * wire_ )
     _dbBlock * block = (_dbBlock *) wire->getOwner();
     _dbNet * net = (_dbNet *) wire_->getNet();
 
+    // The bbox of a spilled wire is the one of its spilled encoding.
+    wire->unspill();
+    dbWireUpdate update(wire);
+
     adsRect bbox;
 
     if ( wire_->getBBox(bbox) )
@@ -1943,6 +2010,7 @@ void dbWire::destroy( dbWire * wire_ )
     
     dbProperty::destroyProperties(wire);
     block->_wire_tbl->destroy(wire);
+    update.end();
 }
 
 } // namespace
@@ -61,7 +61,8 @@ class dbDiff;
 struct _dbWireFlags
 {
     uint _is_global : 1;
-    uint _spare_bits : 31;
+    uint _spilled : 1;   // encoding is in the block's dbWireSpill (not streamed)
+    uint _spare_bits : 30;
 };
 
 class _dbWire : public dbObject
@@ -72,7 +73,7 @@ public:
     dbVector<unsigned char>  _opcodes;
     dbId<_dbNet>             _net;
 
-    _dbWire( _dbDatabase * ) { _flags._is_global = 0; _flags._spare_bits = 0; }
+    _dbWire( _dbDatabase * ) { _flags._is_global = 0; _flags._spilled = 0; _flags._spare_bits = 0; }
 
     _dbWire( _dbDatabase *, const _dbWire & w )
         : _flags(w._flags),
@@ -86,6 +87,12 @@ public:
     
     uint length() { return _opcodes.size(); }
 
+    // Read the spilled encoding back into memory (see dbWireSpill).
+    void unspill();
+
+    // Forget the spilled encoding, the wire is given a new one.
+    void dropSpill();
+
     bool operator==( const _dbWire & rhs ) const;
     bool operator!=( const _dbWire & rhs ) const { return ! operator==(rhs); }
     void differences( dbDiff & diff, const char * field, const _dbWire & rhs ) const;
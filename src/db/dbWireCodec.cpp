@@ -37,6 +37,7 @@
 #include "dbTech.h"
 #include "dbTechLayerRule.h"
 #include "dbTable.h"
+#include "dbJournal.h"
 #include "logger.h"
 #include "db.h"
 #include <ctype.h>
@@ -181,6 +182,7 @@ void dbWireEncoder::append( dbWire * wire )
     _wire = (_dbWire *) wire;
     _block = wire->getBlock();
     _tech = _block->getDb()->getTech();
+    _wire->unspill();
     _data = _wire->_data;
     _opcodes = _wire->_opcodes;
     _layer = NULL;
@@ -607,6 +609,8 @@ void dbWireEncoder::end()
         return;
 
     uint n = _opcodes.size();
+    dbWireUpdate update(_wire);
+    _wire->dropSpill();
 
     // Free the old memory
     _wire->_data.~dbVector<int>();
@@ -623,6 +627,7 @@ void dbWireEncoder::end()
     // Should we calculate the bbox???
     ((_dbBlock *)_block)->_flags._valid_bbox = 0;
     _point_cnt = 0;
+    update.end();
 }
 
 
@@ -650,6 +655,7 @@ dbWireDecoder::~dbWireDecoder()
 void dbWireDecoder::begin( dbWire * wire )
 {
     _wire = (_dbWire *) wire;
+    ZASSERT( ! _wire->_flags._spilled );
     _block = wire->getBlock();
     _tech = _block->getDb()->getTech();
     _x = 0;
@@ -74,6 +74,7 @@ inline unsigned char dbWireShapeItr::peekOp()
 void dbWireShapeItr::begin( dbWire * wire )
 {
     _wire = (_dbWire *) wire;
+    ZASSERT( ! _wire->_flags._spilled );
     _block = wire->getBlock();
     _tech = _block->getDb()->getTech();
     _idx = 0;
@@ -0,0 +1,147 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+#include "dbWireSpill.h"
+#include "dbWire.h"
+#include "dbDatabase.h"
+#include "dbTable.h"
+#include "ZException.h"
+
+namespace odb {
+
+static FILE * createSpillFile()
+{
+    const char * dir = getenv("TMPDIR");
+
+    if ( (dir == NULL) || (dir[0] == 0) )
+        dir = "/tmp";
+
+    std::string name(dir);
+    name += "/odb_wires_XXXXXX";
+
+    std::vector<char> path( name.begin(), name.end() );
+    path.push_back(0);
+
+    int fd = mkstemp( &path[0] );
+
+    if ( fd == -1 )
+        throw ZException("cannot create wire spill file in %s", dir);
+
+    // The file is removed when it is closed.
+    unlink( &path[0] );
+
+    FILE * file = fdopen( fd, "w+b" );
+
+    if ( file == NULL )
+    {
+        close(fd);
+        throw ZException("cannot open wire spill file in %s", dir);
+    }
+
+    return file;
+}
+
+dbWireSpill::dbWireSpill( _dbDatabase * db )
+    : _db(db)
+{
+    _file = createSpillFile();
+}
+
+dbWireSpill::~dbWireSpill()
+{
+    fclose(_file);
+}
+
+void dbWireSpill::spill( _dbWire * wire )
+{
+    if ( wire->_flags._spilled )
+        return;
+
+    uint id = wire->getOID();
+
+    if ( _offset.size() <= id )
+        _offset.resize( id + 1, -1 );
+
+    if ( fseeko( _file, 0, SEEK_END ) != 0 )
+        throw ZIOError( ferror(_file), "seek failed on wire spill file" );
+
+    _offset[id] = ftello(_file);
+
+    dbOStream stream(_db, _file);
+    stream << wire->_data;
+    stream << wire->_opcodes;
+
+    dbVector<int>().swap(wire->_data);
+    dbVector<unsigned char>().swap(wire->_opcodes);
+    wire->_flags._spilled = 1;
+}
+
+void dbWireSpill::restore( uint id, dbVector<int> & data, dbVector<unsigned char> & opcodes )
+{
+    assert( (id < _offset.size()) && (_offset[id] != -1) );
+
+    if ( fseeko( _file, _offset[id], SEEK_SET ) != 0 )
+        throw ZIOError( ferror(_file), "seek failed on wire spill file" );
+
+    dbIStream stream(_db, _file);
+    stream >> data;
+    stream >> opcodes;
+}
+
+void dbWireSpill::release( uint id )
+{
+    if ( id < _offset.size() )
+        _offset[id] = -1;
+}
+
+void dbWireSpill::restore( dbTable<_dbWire> & wires )
+{
+    uint id;
+
+    for( id = 1; id < _offset.size(); ++id )
+    {
+        if ( (_offset[id] == -1) || ! wires.validId(id) )
+            continue;
+
+        _dbWire * wire = wires.getPtr(id);
+
+        if ( wire->_flags._spilled )
+        {
+            restore( id, wire->_data, wire->_opcodes );
+            wire->_flags._spilled = 0;
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_DB_WIRE_SPILL_H
+#define ADS_DB_WIRE_SPILL_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#ifndef ADS_DB_VECTOR_H
+#include "dbVector.h"
+#endif
+
+#include <stdio.h>
+#include <sys/types.h>
+#include <vector>
+
+namespace odb {
+
+class _dbDatabase;
+class _dbWire;
+template <class T> class dbTable;
+
+//
+// dbWireSpill - Temporary file holding the encoding of the spilled wires of a
+// block (see dbBlock::spillWire).
+//
+// The data and opcodes of a spilled wire are appended to the file in the
+// database stream format and the wire keeps only an empty encoding with the
+// "_spilled" flag set. The encoding is read back one wire at a time when the
+// wire table is written, so the stream of a spilled wire is identical to the
+// stream of the in-memory wire.
+//
+// The file is created in $TMPDIR (default /tmp) and unlinked on creation.
+//
+class dbWireSpill
+{
+    _dbDatabase *        _db;
+    FILE *               _file;
+    std::vector<off_t>   _offset;   // by wire-id
+
+  public:
+    dbWireSpill( _dbDatabase * db );
+    ~dbWireSpill();
+
+    // Move the encoding of this wire to the spill file.
+    void spill( _dbWire * wire );
+
+    // Read the encoding of the spilled wire "id" back from the spill file.
+    void restore( uint id, dbVector<int> & data, dbVector<unsigned char> & opcodes );
+
+    // Forget the spilled encoding of wire "id", its space in the file is not reused.
+    void release( uint id );
+
+    // Restore the encoding of the spilled wires of this table.
+    void restore( dbTable<_dbWire> & wires );
+};
+
+} // namespace
+
+#endif
@@ -84,3 +84,4 @@ void deflex_init();
 void deflex_done();
 void deflex_history();
 void deflex_extension();
+void deflex_skip_wire();
@@ -0,0 +1,5390 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         defparse
+#define yylex           deflex
+#define yyerror         deferror
+#define yydebug         defdebug
+#define yynerrs         defnerrs
+#define yylval          deflval
+#define yychar          defchar
+
+/* First part of user prologue.  */
+#line 32 "/root/repo/src/defin/def.ypp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "def.h"
+#include "definTypes.h"
+#include "definIBlockage.h"
+#include "definIComponent.h"
+#include "definIFill.h"
+#include "definIGCell.h"
+#include "definINet.h"
+#include "definIPin.h"
+#include "definIReader.h"
+#include "definIRow.h"
+#include "definISNet.h"
+#include "definITracks.h"
+#include "definIVia.h"
+#include "definIRegion.h"
+#include "definINonDefaultRule.h"
+#include "definIPropDefs.h"
+#include "definIPinProps.h"
+#include "def_parser.hpp"
+
+// Default readers.
+static definIBlockage  default_blockageR;
+static definIComponent default_componentR;
+static definIFill      default_fillR;
+static definIGCell     default_gcellR;
+static definINet       default_netR;
+static definIPin       default_pinR;
+static definIReader    default_readerR;
+static definIRow       default_rowR;
+static definISNet      default_snetR;
+static definITracks    default_tracksR;
+static definIVia       default_viaR;
+static definIRegion    default_regionR;
+static definINonDefaultRule default_non_default_ruleR;
+static definIPropDefs default_prop_defsR;
+static definIPinProps default_pin_propsR;
+
+static definIBlockage * blockageR = NULL;
+static definIComponent * componentR = NULL;
+static definIFill * fillR = NULL;
+static definIGCell * gcellR = NULL;
+static definINet * netR = NULL;
+static definIPin * pinR = NULL;
+static definIReader * readerR = NULL;
+static definIRow * rowR = NULL;
+static definISNet * snetR = NULL;
+static definITracks * tracksR = NULL;
+static definIVia * viaR = NULL;
+static definIRegion * regionR = NULL;
+static definINonDefaultRule * non_default_ruleR = NULL;
+static definIPropDefs * prop_defsR = NULL;
+static definIPinProps * pin_propsR = NULL;
+
+#define MAX_TOKEN_LEN 2048
+
+static int ignore_id_error = 0;
+void deferror( const char * msg );
+
+static int cur_x;
+static int cur_y;
+static defPoint cur_point;
+
+// When the reader drops the wire that just began, let the scanner jump
+// over its paths instead of parsing them. The mid-rule actions calling these
+// sit in states with only a default reduction, so bison has not read a
+// lookahead token yet and the first path token is scanned in SKIPWIRE.
+static void skipNetWire()
+{
+    if ( netR->skipWire() )
+        deflex_skip_wire();
+}
+
+static void skipSNetWire( defWireType type )
+{
+    if ( snetR->skipWire(type) )
+        deflex_skip_wire();
+}
+
+inline int is_keyword( int type )
+{
+    return (type > _DEF_KEYWORD_BASE_);
+}
+
+struct token
+{
+    int          _line;
+    int          _tid;
+    char *       _text;
+    token *      _free_next;
+    token *      _alloc_next;
+
+    operator const char *() { return _text; }
+};
+
+struct prop
+{
+    token *     _name;
+    defPropType _type;
+
+    union {
+        token * _str_val;
+        int     _int_val;
+        double  _flt_val;
+    } _value;
+};
+
+static void release( token * t );
+static token * create( int tid );
+static token * createQ( int tid );
+
+static void addComponentProps( std::vector<prop *> * props );
+static void addComponentPinProps( std::vector<prop *> * props );
+static void addNetProps( std::vector<prop *> * props );
+static void addSNetProps( std::vector<prop *> * props );
+static void addNonDefaultRuleProps( std::vector<prop *> * props );
+static void addRegionProps( std::vector<prop *> * props );
+static void addRowProps( std::vector<prop *> * props );
+
+static struct token * freelist = NULL;
+static struct token * alloclist = NULL;
+
+inline void release( token * tk )
+{
+    assert( tk->_line >= 0 );
+    tk->_line = -1;
+    tk->_free_next = freelist;
+    freelist = tk;
+}
+
+inline void freeProps( std::vector<prop *> * props )
+{
+    std::vector<prop*>::iterator itr;
+
+    for( itr = props->begin(); itr != props->end(); ++itr )
+    {
+        prop * p = *itr;
+        release(p->_name);
+
+        if ( p->_type == DEF_STRING )
+            release(p->_value._str_val);
+        delete p;
+    }
+
+    delete props;
+}
+
+
+#line 229 "/root/repo/src/defin/def_parser.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "def_parser.hpp"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IDENT = 3,                      /* IDENT  */
+  YYSYMBOL_QSTRING = 4,                    /* QSTRING  */
+  YYSYMBOL_NUM_INT = 5,                    /* NUM_INT  */
+  YYSYMBOL_NUM_DOUBLE = 6,                 /* NUM_DOUBLE  */
+  YYSYMBOL_HISTORY_TEXT = 7,               /* HISTORY_TEXT  */
+  YYSYMBOL_SKIPPED_WIRE = 8,               /* SKIPPED_WIRE  */
+  YYSYMBOL__DEF_KEYWORD_BASE_ = 9,         /* _DEF_KEYWORD_BASE_  */
+  YYSYMBOL_ANALOG_K = 10,                  /* ANALOG_K  */
+  YYSYMBOL_ANTENNAMODEL_K = 11,            /* ANTENNAMODEL_K  */
+  YYSYMBOL_ANTENNAPINDIFFAREA_K = 12,      /* ANTENNAPINDIFFAREA_K  */
+  YYSYMBOL_ANTENNAPINGATEAREA_K = 13,      /* ANTENNAPINGATEAREA_K  */
+  YYSYMBOL_ANTENNAPINMAXAREACAR_K = 14,    /* ANTENNAPINMAXAREACAR_K  */
+  YYSYMBOL_ANTENNAPINMAXCUTCAR_K = 15,     /* ANTENNAPINMAXCUTCAR_K  */
+  YYSYMBOL_ANTENNAPINMAXSIDEAREACAR_K = 16, /* ANTENNAPINMAXSIDEAREACAR_K  */
+  YYSYMBOL_ANTENNAPINPARTIALCUTAREA_K = 17, /* ANTENNAPINPARTIALCUTAREA_K  */
+  YYSYMBOL_ANTENNAPINPARTIALMETALAREA_K = 18, /* ANTENNAPINPARTIALMETALAREA_K  */
+  YYSYMBOL_ANTENNAPINPARTIALMETALSIDEAREA_K = 19, /* ANTENNAPINPARTIALMETALSIDEAREA_K  */
+  YYSYMBOL_BALANCED_K = 20,                /* BALANCED_K  */
+  YYSYMBOL_BEGINEXT_K = 21,                /* BEGINEXT_K  */
+  YYSYMBOL_BITS_K = 22,                    /* BITS_K  */
+  YYSYMBOL_BLOCKAGES_K = 23,               /* BLOCKAGES_K  */
+  YYSYMBOL_BUSBITCHARS_K = 24,             /* BUSBITCHARS_K  */
+  YYSYMBOL_BY_K = 25,                      /* BY_K  */
+  YYSYMBOL_CLOCK_K = 26,                   /* CLOCK_K  */
+  YYSYMBOL_COMMONSCANPINS_K = 27,          /* COMMONSCANPINS_K  */
+  YYSYMBOL_COMPONENTPIN_K = 28,            /* COMPONENTPIN_K  */
+  YYSYMBOL_COMPONENTS_K = 29,              /* COMPONENTS_K  */
+  YYSYMBOL_COMPONENT_K = 30,               /* COMPONENT_K  */
+  YYSYMBOL_COVER_K = 31,                   /* COVER_K  */
+  YYSYMBOL_DESIGN_K = 32,                  /* DESIGN_K  */
+  YYSYMBOL_DIEAREA_K = 33,                 /* DIEAREA_K  */
+  YYSYMBOL_DIRECTION_K = 34,               /* DIRECTION_K  */
+  YYSYMBOL_DISTANCE_K = 35,                /* DISTANCE_K  */
+  YYSYMBOL_DIST_K = 36,                    /* DIST_K  */
+  YYSYMBOL_DIVIDERCHAR_K = 37,             /* DIVIDERCHAR_K  */
+  YYSYMBOL_DO_K = 38,                      /* DO_K  */
+  YYSYMBOL_E_K = 39,                       /* E_K  */
+  YYSYMBOL_EEQMASTER_K = 40,               /* EEQMASTER_K  */
+  YYSYMBOL_ENDEXT_K = 41,                  /* ENDEXT_K  */
+  YYSYMBOL_END_K = 42,                     /* END_K  */
+  YYSYMBOL_ESTCAP_K = 43,                  /* ESTCAP_K  */
+  YYSYMBOL_FE_K = 44,                      /* FE_K  */
+  YYSYMBOL_FEEDTHRU_K = 45,                /* FEEDTHRU_K  */
+  YYSYMBOL_FENCE_K = 46,                   /* FENCE_K  */
+  YYSYMBOL_FILLS_K = 47,                   /* FILLS_K  */
+  YYSYMBOL_FIXEDBUMP_K = 48,               /* FIXEDBUMP_K  */
+  YYSYMBOL_FIXED_K = 49,                   /* FIXED_K  */
+  YYSYMBOL_FLOATING_K = 50,                /* FLOATING_K  */
+  YYSYMBOL_FN_K = 51,                      /* FN_K  */
+  YYSYMBOL_FOREIGN_K = 52,                 /* FOREIGN_K  */
+  YYSYMBOL_FREQUENCY_K = 53,               /* FREQUENCY_K  */
+  YYSYMBOL_FS_K = 54,                      /* FS_K  */
+  YYSYMBOL_FW_K = 55,                      /* FW_K  */
+  YYSYMBOL_GCELLGRID_K = 56,               /* GCELLGRID_K  */
+  YYSYMBOL_GROUND_K = 57,                  /* GROUND_K  */
+  YYSYMBOL_GROUPS_K = 58,                  /* GROUPS_K  */
+  YYSYMBOL_GROUP_K = 59,                   /* GROUP_K  */
+  YYSYMBOL_GUIDE_K = 60,                   /* GUIDE_K  */
+  YYSYMBOL_HISTORY_K = 61,                 /* HISTORY_K  */
+  YYSYMBOL_INOUT_K = 62,                   /* INOUT_K  */
+  YYSYMBOL_INPUT_K = 63,                   /* INPUT_K  */
+  YYSYMBOL_INTEGER_K = 64,                 /* INTEGER_K  */
+  YYSYMBOL_IN_K = 65,                      /* IN_K  */
+  YYSYMBOL_LAYER_K = 66,                   /* LAYER_K  */
+  YYSYMBOL_MAXBITS_K = 67,                 /* MAXBITS_K  */
+  YYSYMBOL_MICRONS_K = 68,                 /* MICRONS_K  */
+  YYSYMBOL_MUSTJOIN_K = 69,                /* MUSTJOIN_K  */
+  YYSYMBOL_N_K = 70,                       /* N_K  */
+  YYSYMBOL_NAMESCASESENSITIVE_K = 71,      /* NAMESCASESENSITIVE_K  */
+  YYSYMBOL_NETLIST_K = 72,                 /* NETLIST_K  */
+  YYSYMBOL_NETS_K = 73,                    /* NETS_K  */
+  YYSYMBOL_NET_K = 74,                     /* NET_K  */
+  YYSYMBOL_NEW_K = 75,                     /* NEW_K  */
+  YYSYMBOL_NONDEFAULTRULE_K = 76,          /* NONDEFAULTRULE_K  */
+  YYSYMBOL_NOSHIELD_K = 77,                /* NOSHIELD_K  */
+  YYSYMBOL_OFF_K = 78,                     /* OFF_K  */
+  YYSYMBOL_ON_K = 79,                      /* ON_K  */
+  YYSYMBOL_ORDERED_K = 80,                 /* ORDERED_K  */
+  YYSYMBOL_ORIGINAL_K = 81,                /* ORIGINAL_K  */
+  YYSYMBOL_OUTPUT_K = 82,                  /* OUTPUT_K  */
+  YYSYMBOL_OUT_K = 83,                     /* OUT_K  */
+  YYSYMBOL_OXIDE1_K = 84,                  /* OXIDE1_K  */
+  YYSYMBOL_OXIDE2_K = 85,                  /* OXIDE2_K  */
+  YYSYMBOL_OXIDE3_K = 86,                  /* OXIDE3_K  */
+  YYSYMBOL_OXIDE4_K = 87,                  /* OXIDE4_K  */
+  YYSYMBOL_PARTITION_K = 88,               /* PARTITION_K  */
+  YYSYMBOL_PATTERNNAME_K = 89,             /* PATTERNNAME_K  */
+  YYSYMBOL_PATTERN_K = 90,                 /* PATTERN_K  */
+  YYSYMBOL_PINPROPERTIES_K = 91,           /* PINPROPERTIES_K  */
+  YYSYMBOL_PINS_K = 92,                    /* PINS_K  */
+  YYSYMBOL_PLACED_K = 93,                  /* PLACED_K  */
+  YYSYMBOL_PLACEMENT_K = 94,               /* PLACEMENT_K  */
+  YYSYMBOL_POWER_K = 95,                   /* POWER_K  */
+  YYSYMBOL_PROPERTYDEFINITIONS_K = 96,     /* PROPERTYDEFINITIONS_K  */
+  YYSYMBOL_PROPERTY_K = 97,                /* PROPERTY_K  */
+  YYSYMBOL_PUSHDOWN_K = 98,                /* PUSHDOWN_K  */
+  YYSYMBOL_RANGE_K = 99,                   /* RANGE_K  */
+  YYSYMBOL_REAL_K = 100,                   /* REAL_K  */
+  YYSYMBOL_RECT_K = 101,                   /* RECT_K  */
+  YYSYMBOL_REGIONS_K = 102,                /* REGIONS_K  */
+  YYSYMBOL_REGION_K = 103,                 /* REGION_K  */
+  YYSYMBOL_RESET_K = 104,                  /* RESET_K  */
+  YYSYMBOL_ROUTED_K = 105,                 /* ROUTED_K  */
+  YYSYMBOL_ROW_K = 106,                    /* ROW_K  */
+  YYSYMBOL_S_K = 107,                      /* S_K  */
+  YYSYMBOL_SCANCHAINS_K = 108,             /* SCANCHAINS_K  */
+  YYSYMBOL_SCAN_K = 109,                   /* SCAN_K  */
+  YYSYMBOL_SHAPE_K = 110,                  /* SHAPE_K  */
+  YYSYMBOL_SHIELDNET_K = 111,              /* SHIELDNET_K  */
+  YYSYMBOL_SHIELD_K = 112,                 /* SHIELD_K  */
+  YYSYMBOL_SIGNAL_K = 113,                 /* SIGNAL_K  */
+  YYSYMBOL_SLOTS_K = 114,                  /* SLOTS_K  */
+  YYSYMBOL_SOURCE_K = 115,                 /* SOURCE_K  */
+  YYSYMBOL_SPECIALNETS_K = 116,            /* SPECIALNETS_K  */
+  YYSYMBOL_SPECIALNET_K = 117,             /* SPECIALNET_K  */
+  YYSYMBOL_SPECIAL_K = 118,                /* SPECIAL_K  */
+  YYSYMBOL_START_K = 119,                  /* START_K  */
+  YYSYMBOL_STEINER_K = 120,                /* STEINER_K  */
+  YYSYMBOL_STEP_K = 121,                   /* STEP_K  */
+  YYSYMBOL_STOP_K = 122,                   /* STOP_K  */
+  YYSYMBOL_STRING_K = 123,                 /* STRING_K  */
+  YYSYMBOL_SUBNET_K = 124,                 /* SUBNET_K  */
+  YYSYMBOL_SYNTHESIZED_K = 125,            /* SYNTHESIZED_K  */
+  YYSYMBOL_TAPERRULE_K = 126,              /* TAPERRULE_K  */
+  YYSYMBOL_TAPER_K = 127,                  /* TAPER_K  */
+  YYSYMBOL_TECHNOLOGY_K = 128,             /* TECHNOLOGY_K  */
+  YYSYMBOL_TEST_K = 129,                   /* TEST_K  */
+  YYSYMBOL_TIEOFF_K = 130,                 /* TIEOFF_K  */
+  YYSYMBOL_TIMING_K = 131,                 /* TIMING_K  */
+  YYSYMBOL_TRACKS_K = 132,                 /* TRACKS_K  */
+  YYSYMBOL_TRUNK_K = 133,                  /* TRUNK_K  */
+  YYSYMBOL_TYPE_K = 134,                   /* TYPE_K  */
+  YYSYMBOL_UNITS_K = 135,                  /* UNITS_K  */
+  YYSYMBOL_UNPLACED_K = 136,               /* UNPLACED_K  */
+  YYSYMBOL_USER_K = 137,                   /* USER_K  */
+  YYSYMBOL_USE_K = 138,                    /* USE_K  */
+  YYSYMBOL_VERSION_K = 139,                /* VERSION_K  */
+  YYSYMBOL_VIAS_K = 140,                   /* VIAS_K  */
+  YYSYMBOL_VOLTAGE_K = 141,                /* VOLTAGE_K  */
+  YYSYMBOL_VPIN_K = 142,                   /* VPIN_K  */
+  YYSYMBOL_WEIGHT_K = 143,                 /* WEIGHT_K  */
+  YYSYMBOL_WIREDLOGIC_K = 144,             /* WIREDLOGIC_K  */
+  YYSYMBOL_XTALK_K = 145,                  /* XTALK_K  */
+  YYSYMBOL_W_K = 146,                      /* W_K  */
+  YYSYMBOL_X_K = 147,                      /* X_K  */
+  YYSYMBOL_Y_K = 148,                      /* Y_K  */
+  YYSYMBOL_POLYGON_K = 149,                /* POLYGON_K  */
+  YYSYMBOL_SPACING_K = 150,                /* SPACING_K  */
+  YYSYMBOL_DESIGNRULEWIDTH_K = 151,        /* DESIGNRULEWIDTH_K  */
+  YYSYMBOL_NETEXPR_K = 152,                /* NETEXPR_K  */
+  YYSYMBOL_SUPPLYSENSITIVITY_K = 153,      /* SUPPLYSENSITIVITY_K  */
+  YYSYMBOL_GROUNDSENSITIVITY_K = 154,      /* GROUNDSENSITIVITY_K  */
+  YYSYMBOL_VIARULE_K = 155,                /* VIARULE_K  */
+  YYSYMBOL_CUTSIZE_K = 156,                /* CUTSIZE_K  */
+  YYSYMBOL_LAYERS_K = 157,                 /* LAYERS_K  */
+  YYSYMBOL_CUTSPACING_K = 158,             /* CUTSPACING_K  */
+  YYSYMBOL_ENCLOSURE_K = 159,              /* ENCLOSURE_K  */
+  YYSYMBOL_ROWCOL_K = 160,                 /* ROWCOL_K  */
+  YYSYMBOL_ORIGIN_K = 161,                 /* ORIGIN_K  */
+  YYSYMBOL_OFFSET_K = 162,                 /* OFFSET_K  */
+  YYSYMBOL_HARDSPACING_K = 163,            /* HARDSPACING_K  */
+  YYSYMBOL_WIDTH_K = 164,                  /* WIDTH_K  */
+  YYSYMBOL_DIAGWIDTH_K = 165,              /* DIAGWIDTH_K  */
+  YYSYMBOL_WIREEXT_K = 166,                /* WIREEXT_K  */
+  YYSYMBOL_MINCUTS_K = 167,                /* MINCUTS_K  */
+  YYSYMBOL_NONDEFAULTRULES_K = 168,        /* NONDEFAULTRULES_K  */
+  YYSYMBOL_VIA_K = 169,                    /* VIA_K  */
+  YYSYMBOL_HALO_K = 170,                   /* HALO_K  */
+  YYSYMBOL_STYLES_K = 171,                 /* STYLES_K  */
+  YYSYMBOL_STYLE_K = 172,                  /* STYLE_K  */
+  YYSYMBOL_PORT_K = 173,                   /* PORT_K  */
+  YYSYMBOL_174_ = 174,                     /* ';'  */
+  YYSYMBOL_175_ = 175,                     /* '+'  */
+  YYSYMBOL_176_ = 176,                     /* '-'  */
+  YYSYMBOL_177_ = 177,                     /* '('  */
+  YYSYMBOL_178_ = 178,                     /* ')'  */
+  YYSYMBOL_179_ = 179,                     /* '*'  */
+  YYSYMBOL_YYACCEPT = 180,                 /* $accept  */
+  YYSYMBOL_defFile = 181,                  /* defFile  */
+  YYSYMBOL_defHeader = 182,                /* defHeader  */
+  YYSYMBOL_183_1 = 183,                    /* $@1  */
+  YYSYMBOL_defHeaderOpts = 184,            /* defHeaderOpts  */
+  YYSYMBOL_defHeaderOpt = 185,             /* defHeaderOpt  */
+  YYSYMBOL_defCaseSens = 186,              /* defCaseSens  */
+  YYSYMBOL_defStatements = 187,            /* defStatements  */
+  YYSYMBOL_defStatement = 188,             /* defStatement  */
+  YYSYMBOL_defHistory = 189,               /* defHistory  */
+  YYSYMBOL_190_2 = 190,                    /* $@2  */
+  YYSYMBOL_defPropertyDefinitions = 191,   /* defPropertyDefinitions  */
+  YYSYMBOL_192_3 = 192,                    /* $@3  */
+  YYSYMBOL_defPropertyDefinitionList = 193, /* defPropertyDefinitionList  */
+  YYSYMBOL_defPropertyDefinition = 194,    /* defPropertyDefinition  */
+  YYSYMBOL_195_4 = 195,                    /* $@4  */
+  YYSYMBOL_196_5 = 196,                    /* $@5  */
+  YYSYMBOL_197_6 = 197,                    /* $@6  */
+  YYSYMBOL_defPropertyDefinitionRange = 198, /* defPropertyDefinitionRange  */
+  YYSYMBOL_defPropertyDefinitionValue = 199, /* defPropertyDefinitionValue  */
+  YYSYMBOL_defPropertyObjectType = 200,    /* defPropertyObjectType  */
+  YYSYMBOL_defPropertyType = 201,          /* defPropertyType  */
+  YYSYMBOL_defProperty = 202,              /* defProperty  */
+  YYSYMBOL_defPropertyValues = 203,        /* defPropertyValues  */
+  YYSYMBOL_defPropertyNameValue = 204,     /* defPropertyNameValue  */
+  YYSYMBOL_205_7 = 205,                    /* $@7  */
+  YYSYMBOL_206_8 = 206,                    /* @8  */
+  YYSYMBOL_defPropertyValue = 207,         /* defPropertyValue  */
+  YYSYMBOL_defRow = 208,                   /* defRow  */
+  YYSYMBOL_209_9 = 209,                    /* $@9  */
+  YYSYMBOL_210_10 = 210,                   /* $@10  */
+  YYSYMBOL_211_11 = 211,                   /* $@11  */
+  YYSYMBOL_212_12 = 212,                   /* $@12  */
+  YYSYMBOL_213_13 = 213,                   /* $@13  */
+  YYSYMBOL_214_14 = 214,                   /* $@14  */
+  YYSYMBOL_defRowProperties = 215,         /* defRowProperties  */
+  YYSYMBOL_defTrack = 216,                 /* defTrack  */
+  YYSYMBOL_217_15 = 217,                   /* $@15  */
+  YYSYMBOL_defDir = 218,                   /* defDir  */
+  YYSYMBOL_defTrackLayers = 219,           /* defTrackLayers  */
+  YYSYMBOL_defTrackLayerNames = 220,       /* defTrackLayerNames  */
+  YYSYMBOL_defGCellGrid = 221,             /* defGCellGrid  */
+  YYSYMBOL_defVias = 222,                  /* defVias  */
+  YYSYMBOL_defViaList = 223,               /* defViaList  */
+  YYSYMBOL_defVia = 224,                   /* defVia  */
+  YYSYMBOL_225_16 = 225,                   /* $@16  */
+  YYSYMBOL_defViaDef = 226,                /* defViaDef  */
+  YYSYMBOL_227_17 = 227,                   /* $@17  */
+  YYSYMBOL_defViaGeoms = 228,              /* defViaGeoms  */
+  YYSYMBOL_defViaGeom = 229,               /* defViaGeom  */
+  YYSYMBOL_defViaRects = 230,              /* defViaRects  */
+  YYSYMBOL_defViaRect = 231,               /* defViaRect  */
+  YYSYMBOL_defViaRule = 232,               /* defViaRule  */
+  YYSYMBOL_233_18 = 233,                   /* $@18  */
+  YYSYMBOL_defViaOpts = 234,               /* defViaOpts  */
+  YYSYMBOL_defViaOpt = 235,                /* defViaOpt  */
+  YYSYMBOL_defRegions = 236,               /* defRegions  */
+  YYSYMBOL_defRegionList = 237,            /* defRegionList  */
+  YYSYMBOL_defRegion = 238,                /* defRegion  */
+  YYSYMBOL_239_19 = 239,                   /* $@19  */
+  YYSYMBOL_defRegionRects = 240,           /* defRegionRects  */
+  YYSYMBOL_defRegionRect = 241,            /* defRegionRect  */
+  YYSYMBOL_defRegionOpts = 242,            /* defRegionOpts  */
+  YYSYMBOL_defRegionOpt = 243,             /* defRegionOpt  */
+  YYSYMBOL_defRegionType = 244,            /* defRegionType  */
+  YYSYMBOL_defComponents = 245,            /* defComponents  */
+  YYSYMBOL_defComponentList = 246,         /* defComponentList  */
+  YYSYMBOL_defComponent = 247,             /* defComponent  */
+  YYSYMBOL_248_20 = 248,                   /* $@20  */
+  YYSYMBOL_defComponentOpts = 249,         /* defComponentOpts  */
+  YYSYMBOL_defComponentOpt = 250,          /* defComponentOpt  */
+  YYSYMBOL_defOrient = 251,                /* defOrient  */
+  YYSYMBOL_defComponentSource = 252,       /* defComponentSource  */
+  YYSYMBOL_defPins = 253,                  /* defPins  */
+  YYSYMBOL_254_21 = 254,                   /* $@21  */
+  YYSYMBOL_defPinList = 255,               /* defPinList  */
+  YYSYMBOL_defPin = 256,                   /* defPin  */
+  YYSYMBOL_257_22 = 257,                   /* $@22  */
+  YYSYMBOL_defPinOpts = 258,               /* defPinOpts  */
+  YYSYMBOL_defPinOpt = 259,                /* defPinOpt  */
+  YYSYMBOL_defPinGeomOpt = 260,            /* defPinGeomOpt  */
+  YYSYMBOL_defPinDirection = 261,          /* defPinDirection  */
+  YYSYMBOL_defPinUse = 262,                /* defPinUse  */
+  YYSYMBOL_defPinOxide = 263,              /* defPinOxide  */
+  YYSYMBOL_defPinLayerOpt = 264,           /* defPinLayerOpt  */
+  YYSYMBOL_defPinProperties = 265,         /* defPinProperties  */
+  YYSYMBOL_defPinPropertyList = 266,       /* defPinPropertyList  */
+  YYSYMBOL_defPinProperty = 267,           /* defPinProperty  */
+  YYSYMBOL_268_23 = 268,                   /* $@23  */
+  YYSYMBOL_defPinPropertyValues = 269,     /* defPinPropertyValues  */
+  YYSYMBOL_defBlockages = 270,             /* defBlockages  */
+  YYSYMBOL_defBlockageList = 271,          /* defBlockageList  */
+  YYSYMBOL_defBlockage = 272,              /* defBlockage  */
+  YYSYMBOL_273_24 = 273,                   /* $@24  */
+  YYSYMBOL_274_25 = 274,                   /* $@25  */
+  YYSYMBOL_defBlockageRoutingOpts = 275,   /* defBlockageRoutingOpts  */
+  YYSYMBOL_defBlockageRoutingOpt = 276,    /* defBlockageRoutingOpt  */
+  YYSYMBOL_defBlockageRoutingGeoms = 277,  /* defBlockageRoutingGeoms  */
+  YYSYMBOL_defBlockageRoutingGeom = 278,   /* defBlockageRoutingGeom  */
+  YYSYMBOL_defPointList = 279,             /* defPointList  */
+  YYSYMBOL_defPoint = 280,                 /* defPoint  */
+  YYSYMBOL_defBlockagePlacementOpts = 281, /* defBlockagePlacementOpts  */
+  YYSYMBOL_defBlockagePlacementOpt = 282,  /* defBlockagePlacementOpt  */
+  YYSYMBOL_defBlockagePlacementRects = 283, /* defBlockagePlacementRects  */
+  YYSYMBOL_defSlots = 284,                 /* defSlots  */
+  YYSYMBOL_defSlotList = 285,              /* defSlotList  */
+  YYSYMBOL_defSlot = 286,                  /* defSlot  */
+  YYSYMBOL_defSlotGeoms = 287,             /* defSlotGeoms  */
+  YYSYMBOL_defSlotGeom = 288,              /* defSlotGeom  */
+  YYSYMBOL_defFills = 289,                 /* defFills  */
+  YYSYMBOL_defFillList = 290,              /* defFillList  */
+  YYSYMBOL_defFill = 291,                  /* defFill  */
+  YYSYMBOL_292_26 = 292,                   /* $@26  */
+  YYSYMBOL_defFillGeoms = 293,             /* defFillGeoms  */
+  YYSYMBOL_defFillGeom = 294,              /* defFillGeom  */
+  YYSYMBOL_defSpecialNets = 295,           /* defSpecialNets  */
+  YYSYMBOL_defSpecialNetList = 296,        /* defSpecialNetList  */
+  YYSYMBOL_defSpecialNet = 297,            /* defSpecialNet  */
+  YYSYMBOL_298_27 = 298,                   /* $@27  */
+  YYSYMBOL_defSpecialNetConnections = 299, /* defSpecialNetConnections  */
+  YYSYMBOL_defSpecialNetConnection = 300,  /* defSpecialNetConnection  */
+  YYSYMBOL_defSpecialNetOpts = 301,        /* defSpecialNetOpts  */
+  YYSYMBOL_defSpecialNetOpt = 302,         /* defSpecialNetOpt  */
+  YYSYMBOL_defSpecialNetSource = 303,      /* defSpecialNetSource  */
+  YYSYMBOL_defSpecialNetUse = 304,         /* defSpecialNetUse  */
+  YYSYMBOL_defSpecialNetPattern = 305,     /* defSpecialNetPattern  */
+  YYSYMBOL_defSpecialNetWiring = 306,      /* defSpecialNetWiring  */
+  YYSYMBOL_307_28 = 307,                   /* $@28  */
+  YYSYMBOL_308_29 = 308,                   /* $@29  */
+  YYSYMBOL_309_30 = 309,                   /* $@30  */
+  YYSYMBOL_310_31 = 310,                   /* $@31  */
+  YYSYMBOL_defSpecialNetWirePaths = 311,   /* defSpecialNetWirePaths  */
+  YYSYMBOL_defSpecialNetPathList = 312,    /* defSpecialNetPathList  */
+  YYSYMBOL_defSpecialNetPath = 313,        /* defSpecialNetPath  */
+  YYSYMBOL_314_32 = 314,                   /* $@32  */
+  YYSYMBOL_defSpecialNetWireShapeOpts = 315, /* defSpecialNetWireShapeOpts  */
+  YYSYMBOL_defSpecialNetWireShapeOpt = 316, /* defSpecialNetWireShapeOpt  */
+  YYSYMBOL_defSpecialNetPathPoints = 317,  /* defSpecialNetPathPoints  */
+  YYSYMBOL_defSpecialNetPathPoint = 318,   /* defSpecialNetPathPoint  */
+  YYSYMBOL_319_33 = 319,                   /* $@33  */
+  YYSYMBOL_320_34 = 320,                   /* $@34  */
+  YYSYMBOL_defNets = 321,                  /* defNets  */
+  YYSYMBOL_defNetList = 322,               /* defNetList  */
+  YYSYMBOL_defNet = 323,                   /* defNet  */
+  YYSYMBOL_324_35 = 324,                   /* $@35  */
+  YYSYMBOL_325_36 = 325,                   /* $@36  */
+  YYSYMBOL_326_37 = 326,                   /* $@37  */
+  YYSYMBOL_327_38 = 327,                   /* $@38  */
+  YYSYMBOL_328_39 = 328,                   /* $@39  */
+  YYSYMBOL_defNetConnections = 329,        /* defNetConnections  */
+  YYSYMBOL_defNetConnection = 330,         /* defNetConnection  */
+  YYSYMBOL_defNetOpts = 331,               /* defNetOpts  */
+  YYSYMBOL_defNetOpt = 332,                /* defNetOpt  */
+  YYSYMBOL_defNetSource = 333,             /* defNetSource  */
+  YYSYMBOL_defNetUse = 334,                /* defNetUse  */
+  YYSYMBOL_defNetPattern = 335,            /* defNetPattern  */
+  YYSYMBOL_defNetWire = 336,               /* defNetWire  */
+  YYSYMBOL_337_40 = 337,                   /* $@40  */
+  YYSYMBOL_338_41 = 338,                   /* $@41  */
+  YYSYMBOL_339_42 = 339,                   /* $@42  */
+  YYSYMBOL_340_43 = 340,                   /* $@43  */
+  YYSYMBOL_defNetWirePaths = 341,          /* defNetWirePaths  */
+  YYSYMBOL_defNetPathList = 342,           /* defNetPathList  */
+  YYSYMBOL_defNetPath = 343,               /* defNetPath  */
+  YYSYMBOL_344_44 = 344,                   /* $@44  */
+  YYSYMBOL_345_45 = 345,                   /* $@45  */
+  YYSYMBOL_346_46 = 346,                   /* $@46  */
+  YYSYMBOL_347_47 = 347,                   /* $@47  */
+  YYSYMBOL_348_48 = 348,                   /* $@48  */
+  YYSYMBOL_349_49 = 349,                   /* $@49  */
+  YYSYMBOL_defNetPathPoints = 350,         /* defNetPathPoints  */
+  YYSYMBOL_defNetPathPoint = 351,          /* defNetPathPoint  */
+  YYSYMBOL_defNetVPin = 352,               /* defNetVPin  */
+  YYSYMBOL_defNetVPinPlacement = 353,      /* defNetVPinPlacement  */
+  YYSYMBOL_defSubNet = 354,                /* defSubNet  */
+  YYSYMBOL_defSubNetConnections = 355,     /* defSubNetConnections  */
+  YYSYMBOL_defSubNetConnection = 356,      /* defSubNetConnection  */
+  YYSYMBOL_defSubNetOpts = 357,            /* defSubNetOpts  */
+  YYSYMBOL_defSubNetOpt = 358,             /* defSubNetOpt  */
+  YYSYMBOL_defSubNetWires = 359,           /* defSubNetWires  */
+  YYSYMBOL_defSubNetWire = 360,            /* defSubNetWire  */
+  YYSYMBOL_361_50 = 361,                   /* $@50  */
+  YYSYMBOL_362_51 = 362,                   /* $@51  */
+  YYSYMBOL_363_52 = 363,                   /* $@52  */
+  YYSYMBOL_364_53 = 364,                   /* $@53  */
+  YYSYMBOL_defSubNetWirePaths = 365,       /* defSubNetWirePaths  */
+  YYSYMBOL_defSubNetPathList = 366,        /* defSubNetPathList  */
+  YYSYMBOL_defSubNetPath = 367,            /* defSubNetPath  */
+  YYSYMBOL_defSubNetPathPoints = 368,      /* defSubNetPathPoints  */
+  YYSYMBOL_defSubNetPathPoint = 369,       /* defSubNetPathPoint  */
+  YYSYMBOL_defScanChains = 370,            /* defScanChains  */
+  YYSYMBOL_defScanChainList = 371,         /* defScanChainList  */
+  YYSYMBOL_defScanChain = 372,             /* defScanChain  */
+  YYSYMBOL_defScanChainOpts = 373,         /* defScanChainOpts  */
+  YYSYMBOL_defScanChainOpt = 374,          /* defScanChainOpt  */
+  YYSYMBOL_375_54 = 375,                   /* $@54  */
+  YYSYMBOL_376_55 = 376,                   /* $@55  */
+  YYSYMBOL_defScanChainCommonPinsOpt = 377, /* defScanChainCommonPinsOpt  */
+  YYSYMBOL_defScanChainOptPin = 378,       /* defScanChainOptPin  */
+  YYSYMBOL_defScanPinIn = 379,             /* defScanPinIn  */
+  YYSYMBOL_defScanPinOut = 380,            /* defScanPinOut  */
+  YYSYMBOL_defScanBits = 381,              /* defScanBits  */
+  YYSYMBOL_defScanComponentList = 382,     /* defScanComponentList  */
+  YYSYMBOL_defScanComponent = 383,         /* defScanComponent  */
+  YYSYMBOL_384_56 = 384,                   /* $@56  */
+  YYSYMBOL_385_57 = 385,                   /* $@57  */
+  YYSYMBOL_defScanComponentOpts = 386,     /* defScanComponentOpts  */
+  YYSYMBOL_defScanComponentOpt = 387,      /* defScanComponentOpt  */
+  YYSYMBOL_defGroups = 388,                /* defGroups  */
+  YYSYMBOL_defGroupList = 389,             /* defGroupList  */
+  YYSYMBOL_defGroup = 390,                 /* defGroup  */
+  YYSYMBOL_391_58 = 391,                   /* $@58  */
+  YYSYMBOL_392_59 = 392,                   /* $@59  */
+  YYSYMBOL_defGroupCompList = 393,         /* defGroupCompList  */
+  YYSYMBOL_defGroupOpts = 394,             /* defGroupOpts  */
+  YYSYMBOL_defGroupOpt = 395,              /* defGroupOpt  */
+  YYSYMBOL_defExtension = 396,             /* defExtension  */
+  YYSYMBOL_397_60 = 397,                   /* $@60  */
+  YYSYMBOL_defNonDefaultRules = 398,       /* defNonDefaultRules  */
+  YYSYMBOL_399_61 = 399,                   /* $@61  */
+  YYSYMBOL_400_62 = 400,                   /* $@62  */
+  YYSYMBOL_defNonDefaultRuleList = 401,    /* defNonDefaultRuleList  */
+  YYSYMBOL_defNonDefaultRule = 402,        /* defNonDefaultRule  */
+  YYSYMBOL_403_63 = 403,                   /* $@63  */
+  YYSYMBOL_defNonDefaultRuleAttrs = 404,   /* defNonDefaultRuleAttrs  */
+  YYSYMBOL_defNonDefaultRuleAttr = 405,    /* defNonDefaultRuleAttr  */
+  YYSYMBOL_406_64 = 406,                   /* $@64  */
+  YYSYMBOL_defNonDefaultRuleLayerAttrOpts = 407, /* defNonDefaultRuleLayerAttrOpts  */
+  YYSYMBOL_defNonDefaultRuleLayerAttrOpt = 408, /* defNonDefaultRuleLayerAttrOpt  */
+  YYSYMBOL_defStyles = 409,                /* defStyles  */
+  YYSYMBOL_defStyleTable = 410,            /* defStyleTable  */
+  YYSYMBOL_defStyle = 411,                 /* defStyle  */
+  YYSYMBOL_point = 412,                    /* point  */
+  YYSYMBOL_integer = 413,                  /* integer  */
+  YYSYMBOL_number = 414,                   /* number  */
+  YYSYMBOL_qstring = 415,                  /* qstring  */
+  YYSYMBOL_ident = 416,                    /* ident  */
+  YYSYMBOL_417_65 = 417                    /* $@65  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  9
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1692
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  180
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  238
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  564
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  1058
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   428
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+     177,   178,   179,   175,     2,   176,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,   174,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   393,   393,   397,   397,   402,   403,   407,   408,   409,
+     410,   414,   415,   419,   420,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,   435,   436,   437,   438,
+     439,   440,   441,   442,   443,   444,   445,   446,   450,   450,
+     454,   454,   458,   459,   463,   463,   464,   463,   475,   476,
+     477,   481,   482,   483,   484,   488,   489,   490,   491,   492,
+     493,   494,   495,   496,   500,   501,   502,   506,   510,   511,
+     515,   515,   515,   520,   525,   530,   539,   544,   538,   547,
+     563,   545,   566,   582,   564,   586,   587,   592,   591,   599,
+     600,   604,   605,   609,   610,   614,   619,   623,   624,   628,
+     628,   632,   633,   634,   637,   637,   641,   642,   646,   651,
+     659,   660,   664,   672,   672,   676,   677,   681,   682,   683,
+     684,   685,   686,   687,   688,   692,   696,   697,   702,   701,
+     713,   714,   718,   722,   723,   727,   728,   732,   733,   737,
+     741,   742,   746,   746,   755,   756,   760,   761,   762,   763,
+     764,   765,   766,   767,   768,   769,   770,   771,   775,   776,
+     777,   778,   779,   780,   781,   782,   786,   787,   788,   789,
+     793,   793,   797,   798,   802,   802,   811,   812,   816,   817,
+     818,   819,   820,   821,   822,   823,   824,   825,   826,   827,
+     828,   829,   830,   831,   832,   833,   834,   835,   836,   840,
+     841,   842,   846,   847,   848,   849,   853,   854,   855,   856,
+     857,   858,   859,   860,   864,   864,   864,   864,   868,   869,
+     873,   877,   878,   883,   882,   895,   896,   900,   904,   905,
+     909,   909,   914,   914,   921,   922,   926,   927,   928,   929,
+     930,   931,   935,   936,   940,   941,   945,   952,   956,   957,
+     958,   959,   963,   964,   968,   969,   973,   974,   978,   982,
+     983,   987,   991,   992,   996,   997,  1001,  1005,  1006,  1010,
+    1010,  1014,  1015,  1019,  1020,  1024,  1028,  1029,  1033,  1033,
+    1037,  1038,  1042,  1043,  1044,  1045,  1049,  1050,  1054,  1055,
+    1056,  1057,  1058,  1059,  1060,  1061,  1062,  1063,  1067,  1068,
+    1069,  1070,  1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,
+    1085,  1085,  1085,  1085,  1089,  1089,  1090,  1090,  1091,  1091,
+    1092,  1092,  1093,  1094,  1098,  1099,  1103,  1104,  1108,  1108,
+    1113,  1114,  1119,  1120,  1124,  1125,  1126,  1130,  1131,  1132,
+    1133,  1134,  1135,  1136,  1137,  1138,  1139,  1139,  1139,  1147,
+    1151,  1152,  1156,  1156,  1156,  1156,  1162,  1162,  1162,  1170,
+    1171,  1175,  1181,  1190,  1191,  1195,  1196,  1197,  1198,  1199,
+    1200,  1201,  1202,  1203,  1204,  1205,  1206,  1207,  1208,  1209,
+    1213,  1214,  1215,  1216,  1217,  1221,  1222,  1223,  1224,  1225,
+    1226,  1227,  1228,  1232,  1232,  1232,  1232,  1236,  1236,  1237,
+    1237,  1238,  1238,  1239,  1239,  1243,  1244,  1248,  1249,  1253,
+    1253,  1254,  1254,  1255,  1255,  1256,  1256,  1257,  1257,  1258,
+    1258,  1262,  1263,  1264,  1268,  1269,  1270,  1271,  1272,  1273,
+    1274,  1275,  1276,  1277,  1281,  1282,  1283,  1284,  1288,  1289,
+    1290,  1294,  1298,  1299,  1303,  1307,  1308,  1312,  1316,  1317,
+    1321,  1321,  1322,  1322,  1323,  1323,  1324,  1324,  1328,  1329,
+    1333,  1334,  1338,  1339,  1340,  1341,  1342,  1343,  1347,  1348,
+    1349,  1353,  1354,  1355,  1356,  1357,  1358,  1359,  1360,  1361,
+    1362,  1366,  1370,  1371,  1375,  1379,  1380,  1384,  1385,  1386,
+    1387,  1387,  1388,  1389,  1390,  1390,  1394,  1395,  1396,  1397,
+    1398,  1402,  1403,  1407,  1411,  1415,  1419,  1420,  1424,  1424,
+    1424,  1431,  1432,  1436,  1437,  1438,  1442,  1446,  1447,  1451,
+    1451,  1451,  1455,  1456,  1460,  1461,  1465,  1466,  1470,  1470,
+    1474,  1475,  1474,  1480,  1481,  1485,  1485,  1489,  1490,  1494,
+    1496,  1496,  1498,  1499,  1500,  1501,  1505,  1506,  1510,  1511,
+    1512,  1516,  1520,  1521,  1525,  1529,  1537,  1541,  1542,  1546,
+    1550,  1551,  1552,  1553,  1553
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "IDENT", "QSTRING",
+  "NUM_INT", "NUM_DOUBLE", "HISTORY_TEXT", "SKIPPED_WIRE",
+  "_DEF_KEYWORD_BASE_", "ANALOG_K", "ANTENNAMODEL_K",
+  "ANTENNAPINDIFFAREA_K", "ANTENNAPINGATEAREA_K", "ANTENNAPINMAXAREACAR_K",
+  "ANTENNAPINMAXCUTCAR_K", "ANTENNAPINMAXSIDEAREACAR_K",
+  "ANTENNAPINPARTIALCUTAREA_K", "ANTENNAPINPARTIALMETALAREA_K",
+  "ANTENNAPINPARTIALMETALSIDEAREA_K", "BALANCED_K", "BEGINEXT_K", "BITS_K",
+  "BLOCKAGES_K", "BUSBITCHARS_K", "BY_K", "CLOCK_K", "COMMONSCANPINS_K",
+  "COMPONENTPIN_K", "COMPONENTS_K", "COMPONENT_K", "COVER_K", "DESIGN_K",
+  "DIEAREA_K", "DIRECTION_K", "DISTANCE_K", "DIST_K", "DIVIDERCHAR_K",
+  "DO_K", "E_K", "EEQMASTER_K", "ENDEXT_K", "END_K", "ESTCAP_K", "FE_K",
+  "FEEDTHRU_K", "FENCE_K", "FILLS_K", "FIXEDBUMP_K", "FIXED_K",
+  "FLOATING_K", "FN_K", "FOREIGN_K", "FREQUENCY_K", "FS_K", "FW_K",
+  "GCELLGRID_K", "GROUND_K", "GROUPS_K", "GROUP_K", "GUIDE_K", "HISTORY_K",
+  "INOUT_K", "INPUT_K", "INTEGER_K", "IN_K", "LAYER_K", "MAXBITS_K",
+  "MICRONS_K", "MUSTJOIN_K", "N_K", "NAMESCASESENSITIVE_K", "NETLIST_K",
+  "NETS_K", "NET_K", "NEW_K", "NONDEFAULTRULE_K", "NOSHIELD_K", "OFF_K",
+  "ON_K", "ORDERED_K", "ORIGINAL_K", "OUTPUT_K", "OUT_K", "OXIDE1_K",
+  "OXIDE2_K", "OXIDE3_K", "OXIDE4_K", "PARTITION_K", "PATTERNNAME_K",
+  "PATTERN_K", "PINPROPERTIES_K", "PINS_K", "PLACED_K", "PLACEMENT_K",
+  "POWER_K", "PROPERTYDEFINITIONS_K", "PROPERTY_K", "PUSHDOWN_K",
+  "RANGE_K", "REAL_K", "RECT_K", "REGIONS_K", "REGION_K", "RESET_K",
+  "ROUTED_K", "ROW_K", "S_K", "SCANCHAINS_K", "SCAN_K", "SHAPE_K",
+  "SHIELDNET_K", "SHIELD_K", "SIGNAL_K", "SLOTS_K", "SOURCE_K",
+  "SPECIALNETS_K", "SPECIALNET_K", "SPECIAL_K", "START_K", "STEINER_K",
+  "STEP_K", "STOP_K", "STRING_K", "SUBNET_K", "SYNTHESIZED_K",
+  "TAPERRULE_K", "TAPER_K", "TECHNOLOGY_K", "TEST_K", "TIEOFF_K",
+  "TIMING_K", "TRACKS_K", "TRUNK_K", "TYPE_K", "UNITS_K", "UNPLACED_K",
+  "USER_K", "USE_K", "VERSION_K", "VIAS_K", "VOLTAGE_K", "VPIN_K",
+  "WEIGHT_K", "WIREDLOGIC_K", "XTALK_K", "W_K", "X_K", "Y_K", "POLYGON_K",
+  "SPACING_K", "DESIGNRULEWIDTH_K", "NETEXPR_K", "SUPPLYSENSITIVITY_K",
+  "GROUNDSENSITIVITY_K", "VIARULE_K", "CUTSIZE_K", "LAYERS_K",
+  "CUTSPACING_K", "ENCLOSURE_K", "ROWCOL_K", "ORIGIN_K", "OFFSET_K",
+  "HARDSPACING_K", "WIDTH_K", "DIAGWIDTH_K", "WIREEXT_K", "MINCUTS_K",
+  "NONDEFAULTRULES_K", "VIA_K", "HALO_K", "STYLES_K", "STYLE_K", "PORT_K",
+  "';'", "'+'", "'-'", "'('", "')'", "'*'", "$accept", "defFile",
+  "defHeader", "$@1", "defHeaderOpts", "defHeaderOpt", "defCaseSens",
+  "defStatements", "defStatement", "defHistory", "$@2",
+  "defPropertyDefinitions", "$@3", "defPropertyDefinitionList",
+  "defPropertyDefinition", "$@4", "$@5", "$@6",
+  "defPropertyDefinitionRange", "defPropertyDefinitionValue",
+  "defPropertyObjectType", "defPropertyType", "defProperty",
+  "defPropertyValues", "defPropertyNameValue", "$@7", "@8",
+  "defPropertyValue", "defRow", "$@9", "$@10", "$@11", "$@12", "$@13",
+  "$@14", "defRowProperties", "defTrack", "$@15", "defDir",
+  "defTrackLayers", "defTrackLayerNames", "defGCellGrid", "defVias",
+  "defViaList", "defVia", "$@16", "defViaDef", "$@17", "defViaGeoms",
+  "defViaGeom", "defViaRects", "defViaRect", "defViaRule", "$@18",
+  "defViaOpts", "defViaOpt", "defRegions", "defRegionList", "defRegion",
+  "$@19", "defRegionRects", "defRegionRect", "defRegionOpts",
+  "defRegionOpt", "defRegionType", "defComponents", "defComponentList",
+  "defComponent", "$@20", "defComponentOpts", "defComponentOpt",
+  "defOrient", "defComponentSource", "defPins", "$@21", "defPinList",
+  "defPin", "$@22", "defPinOpts", "defPinOpt", "defPinGeomOpt",
+  "defPinDirection", "defPinUse", "defPinOxide", "defPinLayerOpt",
+  "defPinProperties", "defPinPropertyList", "defPinProperty", "$@23",
+  "defPinPropertyValues", "defBlockages", "defBlockageList", "defBlockage",
+  "$@24", "$@25", "defBlockageRoutingOpts", "defBlockageRoutingOpt",
+  "defBlockageRoutingGeoms", "defBlockageRoutingGeom", "defPointList",
+  "defPoint", "defBlockagePlacementOpts", "defBlockagePlacementOpt",
+  "defBlockagePlacementRects", "defSlots", "defSlotList", "defSlot",
+  "defSlotGeoms", "defSlotGeom", "defFills", "defFillList", "defFill",
+  "$@26", "defFillGeoms", "defFillGeom", "defSpecialNets",
+  "defSpecialNetList", "defSpecialNet", "$@27", "defSpecialNetConnections",
+  "defSpecialNetConnection", "defSpecialNetOpts", "defSpecialNetOpt",
+  "defSpecialNetSource", "defSpecialNetUse", "defSpecialNetPattern",
+  "defSpecialNetWiring", "$@28", "$@29", "$@30", "$@31",
+  "defSpecialNetWirePaths", "defSpecialNetPathList", "defSpecialNetPath",
+  "$@32", "defSpecialNetWireShapeOpts", "defSpecialNetWireShapeOpt",
+  "defSpecialNetPathPoints", "defSpecialNetPathPoint", "$@33", "$@34",
+  "defNets", "defNetList", "defNet", "$@35", "$@36", "$@37", "$@38",
+  "$@39", "defNetConnections", "defNetConnection", "defNetOpts",
+  "defNetOpt", "defNetSource", "defNetUse", "defNetPattern", "defNetWire",
+  "$@40", "$@41", "$@42", "$@43", "defNetWirePaths", "defNetPathList",
+  "defNetPath", "$@44", "$@45", "$@46", "$@47", "$@48", "$@49",
+  "defNetPathPoints", "defNetPathPoint", "defNetVPin",
+  "defNetVPinPlacement", "defSubNet", "defSubNetConnections",
+  "defSubNetConnection", "defSubNetOpts", "defSubNetOpt", "defSubNetWires",
+  "defSubNetWire", "$@50", "$@51", "$@52", "$@53", "defSubNetWirePaths",
+  "defSubNetPathList", "defSubNetPath", "defSubNetPathPoints",
+  "defSubNetPathPoint", "defScanChains", "defScanChainList",
+  "defScanChain", "defScanChainOpts", "defScanChainOpt", "$@54", "$@55",
+  "defScanChainCommonPinsOpt", "defScanChainOptPin", "defScanPinIn",
+  "defScanPinOut", "defScanBits", "defScanComponentList",
+  "defScanComponent", "$@56", "$@57", "defScanComponentOpts",
+  "defScanComponentOpt", "defGroups", "defGroupList", "defGroup", "$@58",
+  "$@59", "defGroupCompList", "defGroupOpts", "defGroupOpt",
+  "defExtension", "$@60", "defNonDefaultRules", "$@61", "$@62",
+  "defNonDefaultRuleList", "defNonDefaultRule", "$@63",
+  "defNonDefaultRuleAttrs", "defNonDefaultRuleAttr", "$@64",
+  "defNonDefaultRuleLayerAttrOpts", "defNonDefaultRuleLayerAttrOpt",
+  "defStyles", "defStyleTable", "defStyle", "point", "integer", "number",
+  "qstring", "ident", "$@65", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-739)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-564)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     -48,   314,   143,  -739,  -739,  -739,  -739,   -68,   200,  -739,
+     318,  -739,  -739,  -739,   212,   212,    85,   197,   212,   -27,
+     212,  -739,   212,   212,   212,  -739,   212,   314,   212,   212,
+     212,   314,   -27,   232,   212,   212,   212,  -739,   116,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,   255,
+    -739,   135,   149,   212,   -18,  -739,   154,  -739,  -739,   212,
+     174,   327,   176,   185,  -739,  -739,   192,   314,   194,   201,
+     206,   211,   212,   321,   218,  -739,   220,  -739,   306,  -739,
+    -739,  -739,   212,  -739,     7,  -739,  -739,   358,  -739,  -739,
+    -739,  -739,   229,   541,  -739,   212,  -739,  -739,  -739,  -739,
+     380,   212,  -739,   247,   254,   424,   314,   424,   164,  -739,
+     -24,    23,   257,    12,    17,    31,   212,    34,    36,    46,
+    -739,  -739,  -739,  -739,   337,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,    83,   212,    84,    88,    90,   212,   270,
+      92,  -739,   276,    93,  -739,  -739,   277,   281,   283,  -739,
+    -739,   287,   440,    81,  -739,   441,   314,  -739,  -739,   290,
+     294,   299,   310,   443,   454,  -739,   390,   468,   314,  -739,
+     463,   471,  -739,   453,   314,  -739,    95,  -739,   314,   452,
+     314,  -739,   106,   450,   314,  -739,   458,   500,  -739,   459,
+     314,  -739,   465,  -739,   448,   314,  -739,    96,   212,   409,
+    -739,  -739,  -739,  -739,  -739,  -739,   314,  -739,  -739,   314,
+    -739,  -739,  -739,  -739,  -739,   314,   212,  -739,  -739,  -739,
+     515,   314,  -739,   314,   506,   314,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,   554,  -739,
+     427,  -739,   314,  -739,  -739,   212,  -739,  -739,  -739,   314,
+    -739,    85,  -739,  -739,  -739,  -739,  -739,   431,   314,  -739,
+    -739,  -739,  -739,   436,    48,   446,   212,  -739,   433,    10,
+    -739,     9,  -739,  -739,   449,   460,  -739,   134,  -739,    -9,
+    -739,    14,  -739,   498,  -739,   456,  -739,  -739,   542,  -739,
+    -739,  -739,  -739,   212,   446,  -739,   446,   596,   455,   457,
+    -739,  -739,   314,   314,   314,  -739,  -739,   446,    85,     0,
+    -739,   466,  -739,    15,   461,   470,  -739,  -739,  -739,  -739,
+    -739,    -3,   446,    85,    67,    18,  -739,  -739,   472,   225,
+     446,    85,     4,  -739,  -739,  -739,   314,   475,   305,   314,
+     555,   212,  -739,   322,  -739,   212,   558,   482,   190,  -739,
+     483,   485,   331,  -739,   314,   349,   590,  -739,  -739,   446,
+     486,  -739,  -739,    26,   355,    20,   314,   314,   314,   314,
+    -739,    30,  -739,   364,   446,   288,  -739,     6,   446,   486,
+     314,  -739,   446,  -739,  -739,  -739,   252,  -739,   446,   486,
+    -739,  -739,   368,   314,   314,  -739,   389,  -739,   558,  -739,
+     585,   367,   481,  -739,   -10,  -739,   540,  -739,  -739,  -739,
+     314,   314,   581,  -739,   600,  -739,  -739,  -739,   212,   498,
+     498,  -739,   314,   488,   314,  -739,   444,  -739,   314,  -739,
+    -739,   490,    85,  -739,  -739,   256,  -739,   446,   314,  -739,
+    -739,  -739,   663,   664,  -739,   496,  -739,   446,   446,   314,
+     446,   314,   446,   314,   227,   446,   666,   212,  -739,  -739,
+    -739,   129,  -739,   494,   314,  -739,   484,  -739,  -739,  -739,
+     668,   669,  -739,  -739,   502,  -739,  -739,    57,  -739,   212,
+    -739,   422,  -739,   314,   499,   503,  -739,  -739,  -739,  -739,
+    -739,   507,  -739,   509,  -739,   604,  -739,  -739,   314,   182,
+     314,  -739,   314,   253,   274,   604,   673,   314,  -739,  -739,
+     498,  -739,   510,   212,   486,   511,   314,   314,  -739,   314,
+     314,  -739,  -739,  -739,  -739,  -739,   514,   106,  -739,   106,
+     446,   106,  -739,  -739,  -739,  -739,  -739,  -739,   106,  -739,
+     212,   314,  -739,  -739,   146,  -739,   604,  -739,  -739,   604,
+     314,  -739,   314,   183,  -739,   314,   325,   314,   336,   314,
+     682,   684,  -739,  -739,  -739,  -739,   439,  -739,  -739,  -739,
+    -739,  -739,  -739,   212,   455,  -739,  -739,  -739,  -739,   497,
+     565,   566,   504,  -739,  -739,  -739,   504,  -739,  -739,  -739,
+    -739,  -739,  -739,   446,   504,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,    85,  -739,   591,   510,  -739,   212,   480,   511,
+    -739,   529,  -739,   212,  -739,  -739,  -739,   106,  -739,  -739,
+     212,  -739,  -739,   569,  -739,   545,  -739,   545,  -739,  -739,
+     545,  -739,  -739,  -739,  -739,  -739,  -739,   545,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,     5,  -739,  -739,  -739,   263,
+    -739,  -739,   521,   513,    71,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,   621,  -739,   212,  -739,   446,  -739,   504,
+     486,   314,  -739,   519,   314,   694,   314,   695,   697,   698,
+     699,   700,  -739,   212,  -739,  -739,   212,   445,   528,  -739,
+    -739,   632,  -739,   180,  -739,  -739,  -739,   531,   314,   446,
+     564,   604,   604,   604,   604,   604,   604,   604,   604,   446,
+     402,   446,   314,   446,  -739,   372,   314,   424,   314,   314,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,   212,   314,  -739,
+    -739,  -739,   532,   533,  -739,   706,   314,   707,   708,   709,
+     710,   711,  -739,  -739,  -739,  -739,   314,   314,   546,   212,
+     543,   314,  -739,   641,   446,   113,  -739,  -739,  -739,  -739,
+    -739,   653,   653,   655,   656,   657,   653,   653,   653,   106,
+    -739,  -739,  -739,  -739,  -739,   106,   396,   106,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,   396,  -739,  -739,
+    -739,   455,   547,  -739,  -739,   212,   212,  -739,   314,  -739,
+     719,  -739,  -739,   721,  -739,  -739,   556,   212,   543,  -739,
+     212,    32,   314,   314,  -739,    64,   446,   446,   446,   446,
+    -739,   314,  -739,  -739,   314,   314,   314,  -739,  -739,  -739,
+    -739,  -739,   722,   725,   446,  -739,    85,   557,  -739,   167,
+     212,   212,  -739,   727,   728,   148,   212,   543,  -739,    32,
+     543,   212,    19,  -739,   106,   559,  -739,  -739,  -739,  -739,
+    -739,  -739,   113,   314,   314,   314,  -739,  -739,  -739,  -739,
+    -739,  -739,   446,   486,  -739,   -21,   212,  -739,    38,   560,
+     561,  -739,  -739,   212,   212,   212,  -739,  -739,    32,   543,
+      32,    11,    21,    25,  -739,  -739,   598,   598,   598,   598,
+    -739,  -739,  -739,  -739,  -739,   314,   212,   212,    35,  -739,
+     696,   563,  -739,  -739,  -739,  -739,   543,    32,  -739,   567,
+      47,    52,    53,    55,  -739,  -739,   660,  -739,   160,  -739,
+    -739,  -739,  -739,  -739,    56,    37,    40,  -739,   212,    32,
+    -739,  -739,   568,  -739,   570,  -739,   571,  -739,   572,   314,
+     314,    -4,   212,   212,    50,  -739,   573,    58,    59,    61,
+      63,   212,   212,  -739,  -739,  -739,  -739,  -739,   133,   212,
+      50,   575,   212,    41,  -739,   106,  -739,  -739,   576,  -739,
+     577,  -739,   578,  -739,   579,   716,   580,   212,    50,   575,
+      50,    75,    44,    45,  -739,  -739,  -739,  -739,  -739,   212,
+    -739,   575,    50,  -739,   582,    76,    78,    79,    80,   615,
+      50,  -739,  -739,   583,  -739,   584,  -739,   587,  -739,   588,
+    -739,  -739,  -739,  -739,  -739,   212,   212,  -739
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,   563,     0,    13,   560,   561,   562,     0,     0,     1,
+       0,     3,   564,   528,     0,     0,     0,     0,     0,     0,
+       0,    38,     0,     0,     0,    40,     0,   563,     0,     0,
+       0,   563,     0,     0,     0,     0,     0,    14,     0,    18,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,     5,     0,
+     556,     0,     0,     0,     0,     2,     0,    89,    90,     0,
+       0,     0,     0,     0,   170,    42,     0,   563,     0,     0,
+       0,     0,     0,     0,     0,   530,     0,    17,     4,   529,
+     228,   140,     0,    19,     0,   247,   267,     0,   517,    39,
+     350,   221,     0,     0,   126,     0,   482,   259,   276,    15,
+       0,     0,    97,     0,     0,     0,   563,     0,     0,     6,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     172,    56,    55,    57,     0,    58,    59,    63,    60,    61,
+      62,    43,    44,     0,     0,     0,     0,     0,     0,     0,
+       0,   533,     0,     0,   552,   559,     0,     0,     0,    12,
+      11,     0,     0,     0,   229,     0,   563,   141,   246,     0,
+       0,     0,     0,     0,     0,   268,     0,     0,   563,   518,
+       0,   356,   351,     0,   563,   222,     0,    41,   563,     0,
+     563,   127,     0,     0,   563,   483,     0,     0,   260,     0,
+     563,   277,     0,    16,     0,   563,    98,     0,     0,     0,
+     553,     9,    10,     7,     8,   227,   563,   232,   139,   563,
+     251,   249,   250,   248,   266,   563,     0,   516,   519,   349,
+       0,   563,   220,   563,     0,   563,   173,    45,   125,   128,
+     160,   164,   162,   163,   165,   158,   159,   161,    76,   481,
+       0,   258,   563,   275,   278,     0,    96,    99,   531,   563,
+     534,     0,   551,   230,   252,   142,   269,     0,   563,   353,
+     357,   223,   171,     0,     0,     0,     0,    85,     0,     0,
+     485,     0,   280,    87,   101,     0,   535,     0,   234,     0,
+     144,     0,    95,   520,   522,     0,   359,   225,     0,    64,
+      65,    66,    46,     0,   133,   130,     0,     0,    77,   496,
+     508,   508,   563,   563,   563,   484,   486,     0,     0,     0,
+     262,   286,    91,     0,     0,   103,   106,   102,   532,   537,
+     554,     0,     0,     0,     0,     0,   242,   253,     0,     0,
+       0,     0,     0,   271,   524,   523,   563,   363,     0,   563,
+      48,     0,   131,     0,   132,     0,     0,     0,     0,   489,
+     497,   498,   508,   506,   563,   508,   487,   490,   494,     0,
+     265,   261,   263,   563,     0,     0,   563,   563,   563,   563,
+     100,     0,   107,     0,     0,     0,   235,     0,     0,   245,
+     563,   255,     0,   243,   233,   143,     0,   145,     0,   274,
+     270,   272,     0,   563,   563,   360,     0,   224,     0,   174,
+       0,    51,     0,   129,     0,   134,    79,    70,    86,    78,
+     563,   563,     0,   499,     0,   500,   507,   509,     0,   501,
+     501,   264,   563,     0,   563,   279,     0,   287,   563,    88,
+     104,     0,     0,   113,   536,     0,   538,     0,   563,   238,
+     239,   237,     0,     0,   231,   244,   254,     0,     0,   563,
+       0,   563,     0,   563,     0,   153,     0,     0,   157,   273,
+     521,     0,   525,     0,   563,   358,     0,   364,   226,   176,
+       0,     0,    52,    53,     0,    54,   555,     0,   136,     0,
+      85,    70,    68,   563,     0,     0,   511,   488,   491,   502,
+     495,   284,   281,   282,   314,     0,   291,   316,   563,     0,
+     563,   318,   563,     0,     0,     0,     0,   563,   297,   289,
+      92,    93,     0,     0,   109,     0,   563,   563,   539,   563,
+     563,   545,   244,   236,   240,   241,   244,     0,   146,     0,
+       0,     0,   155,   167,   166,   169,   168,   147,     0,   154,
+       0,   563,   527,   354,     0,   397,     0,   372,   399,     0,
+     563,   403,   563,     0,   401,   563,     0,   563,     0,   563,
+       0,     0,   379,   370,   366,   367,     0,    49,    50,    47,
+     137,   138,   135,     0,    80,    69,    71,   503,   504,   510,
+       0,     0,   563,   557,   558,   295,   563,   292,   310,   311,
+     312,   313,   294,     0,   563,   320,   298,   299,   300,   301,
+     290,   302,   303,   304,   305,   306,   307,   308,   309,   293,
+     288,   296,     0,    94,     0,   105,   110,     0,     0,   114,
+     115,     0,   543,     0,   542,   150,   149,     0,   151,   152,
+       0,   526,   363,     0,   361,   563,   377,   563,   373,   369,
+     563,   374,   393,   394,   395,   396,   376,   563,   365,   380,
+     381,   382,   383,   384,   371,   442,   385,   386,   387,   388,
+     389,   390,   391,   392,   375,     0,   378,   368,   175,     0,
+     177,    82,     0,     0,     0,   513,   514,   515,   512,   285,
+     283,   324,   315,   325,   326,     0,   317,     0,   319,   563,
+     323,   563,   111,     0,   563,     0,   563,     0,     0,     0,
+       0,     0,   116,     0,   544,   148,     0,     0,     0,   405,
+     398,   406,   407,   409,   400,   404,   402,   445,   563,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   563,     0,   178,     0,   563,     0,   563,   563,
+     193,    85,    81,    73,    74,    72,    75,     0,   563,   328,
+     322,   321,     0,     0,   124,     0,   563,     0,     0,     0,
+       0,     0,   540,   156,   355,   362,   563,   563,   411,     0,
+       0,   563,   443,   448,     0,   434,   214,   215,   216,   217,
+     188,   218,   218,     0,     0,     0,   218,   218,   218,     0,
+     205,   204,   202,   203,   179,     0,   199,     0,   206,   207,
+     208,   209,   210,   211,   212,   213,   180,   199,   181,   182,
+     183,    83,     0,   327,   330,     0,     0,   117,   563,   119,
+       0,   121,   122,     0,   546,   408,   413,     0,     0,   415,
+       0,   410,   563,   563,   446,   441,     0,     0,     0,     0,
+     435,   563,   187,   189,   563,   563,   563,   186,   184,   185,
+     196,   197,     0,     0,     0,   198,     0,     0,   505,     0,
+       0,     0,   118,     0,     0,   541,     0,     0,   417,   412,
+       0,     0,     0,   423,   432,     0,   447,   450,   452,   456,
+     454,   449,   436,   563,   563,   563,   219,   190,   192,   191,
+     200,   201,     0,   195,    84,     0,     0,   331,   329,     0,
+       0,   120,   123,     0,     0,     0,   547,   419,   414,     0,
+     416,     0,     0,     0,   433,   444,   563,   563,   563,   563,
+     437,   440,   439,   438,   194,   563,     0,     0,     0,   336,
+     345,     0,   108,   549,   548,   550,     0,   418,   421,     0,
+       0,     0,     0,     0,   458,   451,   459,   460,     0,   453,
+     457,   455,   332,   333,     0,     0,     0,   346,     0,   420,
+     422,   430,     0,   426,     0,   428,     0,   424,     0,   563,
+     563,     0,     0,     0,   462,   334,     0,     0,     0,     0,
+       0,     0,     0,   431,   427,   429,   425,   461,     0,     0,
+     463,     0,     0,     0,   470,   479,   335,   340,     0,   338,
+       0,   339,     0,   337,     0,     0,     0,     0,   464,     0,
+     465,     0,     0,     0,   480,   344,   342,   343,   341,     0,
+     112,     0,   466,   468,     0,     0,     0,     0,     0,     0,
+     467,   469,   477,     0,   473,     0,   475,     0,   471,     0,
+     347,   478,   474,   476,   472,     0,     0,   348
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,    86,  -739,   262,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -486,  -739,  -739,   712,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,   418,
+    -739,   122,  -739,  -739,  -739,   130,  -739,  -739,  -739,  -739,
+    -739,   467,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -514,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+     -54,  -739,  -739,  -739,  -355,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,   438,  -260,  -259,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,   451,  -739,
+    -739,  -739,  -739,  -739,   425,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -502,  -739,    16,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,   131,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -429,  -739,    -1,  -739,  -739,  -739,  -739,  -739,  -739,
+    -738,  -739,  -739,  -120,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -521,  -739,  -203,  -503,  -739,
+    -739,  -739,  -739,  -739,   501,  -739,  -739,  -739,   347,  -351,
+    -354,  -739,   473,    -8,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,  -739,
+    -739,   625,  -270,   -15,  -487,  -116,   652,  -739
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     2,     3,    58,    88,   119,   161,    10,    37,    38,
+      71,    39,    75,   103,   141,   188,   274,   350,   411,   484,
+     142,   302,   418,   491,   492,   493,   683,   755,    40,   277,
+     357,   490,   682,   751,   867,   308,    41,   322,    69,   375,
+     520,    42,    43,   150,   206,   284,   324,   522,   325,   326,
+     625,   626,   327,   525,   629,   630,    44,   143,   191,   275,
+     304,   305,   353,   415,   582,    45,   121,   167,   290,   339,
+     397,   248,   547,    46,   102,   186,   236,   479,   576,   680,
+     864,   804,   816,   790,   852,    47,   129,   185,   297,   348,
+      48,   120,   164,   288,   264,   331,   386,   335,   336,    64,
+      95,   289,   337,   338,    49,   146,   198,   319,   320,    50,
+     125,   175,   291,   342,   343,    51,   147,   201,   282,   321,
+     433,   374,   437,   610,   619,   602,   519,   592,   596,   604,
+     699,   692,   693,   694,   824,   869,   907,   908,   939,   991,
+    1055,    52,   128,   182,   230,   295,   642,   231,   296,   347,
+     405,   406,   477,   664,   674,   656,   573,   645,   647,   657,
+     650,   720,   721,   722,   780,   838,   877,   880,   919,   946,
+     841,   883,   574,   850,   575,   727,   782,   783,   844,   845,
+     891,   926,   927,   929,   928,   955,   956,   957,   984,  1004,
+      53,   145,   195,   279,   280,   429,   430,   359,   498,   360,
+     361,   687,   362,   363,   364,   496,   589,   688,    54,   127,
+     179,   268,   344,   293,   402,   472,    55,    59,    56,   113,
+     285,   207,   260,   329,   383,   446,   834,   875,   916,    57,
+     153,   154,   306,    61,   595,   156,   884,     8
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      62,   158,   287,    66,   584,    70,   423,    72,    73,    74,
+     425,    76,    60,    78,    79,    80,    60,    60,   162,    84,
+      85,    86,    60,   635,    60,   636,    60,   638,   620,     4,
+      60,     5,     6,  -563,   639,     4,   354,     5,     6,  -563,
+      60,     4,    60,     5,     6,    60,    60,   369,    92,    60,
+      60,  -563,    60,     4,    97,     5,     6,    60,    60,   370,
+      60,    60,   388,    60,    60,   165,    60,   110,    60,   646,
+     398,   728,   648,   173,   389,   393,   177,   122,   180,   124,
+      60,    60,   399,    60,    60,    60,   438,   417,   183,   935,
+     144,     1,   332,   757,   696,   887,   149,   390,   384,   431,
+     879,   317,   698,   580,   376,   340,    11,   384,   170,   172,
+     317,   176,   299,   888,   447,   340,   377,   581,   455,   392,
+      67,    68,   457,   715,   487,   189,   193,   393,   469,   192,
+     196,   377,   199,   202,   204,   209,   420,   234,   258,   918,
+     333,   889,   920,     9,   847,   240,   333,   216,   300,   318,
+     241,   936,   163,   341,   421,   333,    93,   242,   318,    94,
+     243,   244,   848,   341,   378,   391,   334,   333,   999,   890,
+     379,   301,   385,   983,   371,   217,   245,   532,   400,   378,
+     454,   947,   303,   524,   315,   278,   123,   536,   537,   948,
+     539,   169,   541,   261,   439,   548,   171,   761,   922,   166,
+     950,    12,   598,   652,   952,   432,   849,   174,   969,   882,
+     178,   267,   181,   246,   965,   938,   987,    60,   724,   989,
+    1022,   725,   184,  1035,  1037,   971,   417,  1003,   726,    65,
+     973,   975,   551,   977,   985,   686,  1007,  1009,   685,  1011,
+     283,  1013,   159,   160,   791,   792,   793,   794,   795,   796,
+     797,   798,   247,  1033,  1042,   420,  1044,  1046,  1048,   190,
+     194,   307,    63,   543,   197,   821,   200,    83,   205,   152,
+     637,   235,   259,   421,   730,   731,   732,   733,   734,   735,
+     736,   737,   738,   458,   611,   860,   980,   981,   351,   606,
+      87,   861,   459,   865,   739,   485,    89,   740,   913,   544,
+     612,   460,   599,   653,   461,  1017,   777,   778,   330,    90,
+     983,    94,   741,   914,   915,   600,   654,     4,   448,     5,
+       6,   643,   526,    91,   644,   607,   601,   655,    96,   742,
+     115,   613,   982,   697,    99,   449,   412,   983,   116,    13,
+     416,    14,   905,   117,   906,   462,   666,    15,    98,   417,
+     100,    16,   779,   417,   426,   463,   743,   426,   545,   101,
+      17,   659,   667,   700,   546,    18,   104,   464,   106,   614,
+     924,   155,   482,   483,    19,   107,    20,   118,   615,    21,
+     108,   744,   808,   616,   608,   109,   450,   617,   465,   111,
+     609,    22,   112,   668,   114,   466,   126,   660,   809,   395,
+     396,   745,   451,   130,   618,   729,   959,   960,   961,    23,
+      24,   527,   746,   497,    25,   747,   748,   749,   148,   528,
+      26,   151,   467,   529,    27,   530,    28,   760,   155,   810,
+     152,   669,    29,   187,    30,   168,   750,   853,   452,   453,
+     670,   857,   858,   859,   203,   671,    31,   800,   208,   672,
+      32,   211,   550,    33,   661,   212,   662,   213,    34,   785,
+     309,   214,   663,   215,   801,   802,   673,   811,   220,   799,
+     218,   805,   221,   807,   583,   504,   812,   222,  1000,   407,
+     408,   813,   468,   310,   803,   814,    35,   505,   223,    36,
+     224,  1024,   506,   507,   478,  1018,   413,   414,  1020,  -563,
+     488,     4,   815,     5,     6,  -492,  -492,     4,   627,     5,
+       6,   226,   691,   311,   846,   555,  1032,   155,   753,   754,
+     225,   312,   518,  -493,  -493,   508,   227,   556,  1040,   435,
+     436,   531,   557,   558,   509,   640,   229,   559,   444,   445,
+    -352,   417,   470,   471,   232,   510,   862,   863,     4,   511,
+       5,     6,   313,   719,   238,   314,   512,   552,   249,   513,
+     560,   561,   572,   475,   476,   562,   252,   756,   681,   131,
+     704,   132,   251,   133,   563,   253,   892,   893,   894,   895,
+     262,   417,   514,   134,   269,   515,   255,   516,   256,   564,
+     480,   481,   276,   517,   902,   565,   -67,   -67,   272,   566,
+     135,     4,   278,     5,     6,   292,   954,   903,   567,   593,
+     594,   298,   703,   678,   679,   136,   349,   137,   714,   774,
+     476,   355,   568,   303,   323,   716,   569,   570,   328,   571,
+     356,   818,   934,   346,   358,   380,   705,   706,   707,   708,
+     709,   710,   711,   373,   138,   381,   394,   139,   786,   787,
+     788,   789,   404,     7,   410,   417,   419,   428,   140,   486,
+     422,   489,   424,    94,   421,   420,   502,   523,   534,   535,
+    -256,   549,   553,   577,   684,   578,   579,   587,   621,    77,
+     759,   588,   590,    81,   591,   624,   628,   676,  -257,   677,
+     689,   690,   701,   713,   718,   752,   758,   763,   772,   765,
+     767,   773,   768,   769,   770,   771,   775,   776,   781,   825,
+     826,   827,   829,   830,   831,   832,   833,   843,   837,   851,
+     840,   854,   855,   856,   873,   868,   874,   900,   876,   105,
+     901,   904,   911,   912,   967,   979,  1050,   925,   941,   942,
+     968,  1029,   822,   382,    82,   970,   993,   702,   994,   995,
+     996,  1006,   983,   585,  1025,  1026,  1027,  1028,  1030,   712,
+    1041,  1051,  1052,   866,   839,  1053,  1054,   401,   157,   387,
+     372,   352,   930,   717,   823,   835,   997,   500,   210,     0,
+     316,     0,     0,     0,   365,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     870,   871,     0,     0,     0,     0,     0,     0,   219,     0,
+       0,     0,   878,     0,     0,   881,     0,     0,     0,     0,
+     228,     0,     0,     0,     0,     0,   233,     0,     0,     0,
+     237,     0,   239,     0,     0,     0,   250,     0,     0,     0,
+       0,     0,   254,     0,     0,   909,   910,   257,     0,     0,
+       0,   917,     0,     0,     0,     0,   921,   923,   263,     0,
+       0,   265,     0,     0,     0,     0,     0,   266,     0,     0,
+       0,     0,     0,   270,     0,   271,     0,   273,     0,     0,
+       0,   937,     0,     0,     0,     0,     0,     0,   943,   944,
+     945,     0,     0,     0,   281,     0,   949,   951,   953,     0,
+       0,   286,     0,     0,     0,     0,     0,     0,     0,     0,
+     294,   963,   964,   966,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   972,   974,   976,   978,     0,
+       0,     0,     0,     0,     0,   345,     0,     0,     0,   986,
+     988,   990,     0,   992,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   366,   367,   368,  1001,  1002,     0,
+       0,     0,  1008,  1010,  1012,  1014,  1015,  1016,     0,     0,
+       0,     0,     0,     0,  1019,     0,     0,  1021,  1023,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   403,     0,
+       0,   409,  1031,     0,     0,     0,  1034,  1036,  1038,     0,
+       0,     0,     0,     0,  1039,     0,   427,     0,     0,     0,
+    1043,  1045,  1047,  1049,     0,   434,     0,     0,   440,   441,
+     442,   443,     0,     0,     0,     0,     0,     0,     0,     0,
+    1056,  1057,   456,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   473,   474,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   494,   495,     0,     0,     0,     0,     0,     0,
+       0,   499,   499,     0,   501,     0,   503,     0,     0,     0,
+     521,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     533,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   538,     0,   540,     0,   542,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   554,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   586,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     597,     0,   603,     0,   605,     0,     0,     0,     0,   622,
+       0,     0,   623,     0,     0,     0,     0,     0,   631,   632,
+       0,   633,   634,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   641,     0,     0,     0,     0,     0,     0,
+       0,     0,   649,     0,   651,     0,     0,   658,     0,   665,
+       0,   675,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   695,     0,     0,     0,   695,     0,
+       0,     0,     0,     0,     0,     0,   695,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   723,     0,   723,
+       0,     0,   723,     0,     0,     0,     0,     0,     0,   723,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   695,     0,   762,     0,     0,   764,     0,   766,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     784,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   806,     0,     0,     0,   817,     0,
+     819,   820,     0,     0,     0,     0,     0,     0,     0,     0,
+     695,     0,     0,     0,     0,     0,     0,     0,   828,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   723,   836,
+       0,     0,     0,   842,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     872,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   885,   886,     0,     0,     0,     0,
+       0,     0,     0,   896,     0,     0,   897,   898,   899,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   931,   932,   933,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     940,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   958,   958,
+     958,   958,     0,     0,     0,     0,     0,   962,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   958,   998,     0,     0,     0,  1005,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1005,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1005,     0,  1005,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1005,     0,     0,     0,     0,     0,
+       0,     0,  1005
+};
+
+static const yytype_int16 yycheck[] =
+{
+      15,   117,   261,    18,   490,    20,   360,    22,    23,    24,
+     361,    26,     5,    28,    29,    30,     5,     5,    42,    34,
+      35,    36,     5,   537,     5,   539,     5,   541,   515,     3,
+       5,     5,     6,     1,   548,     3,   306,     5,     6,     1,
+       5,     3,     5,     5,     6,     5,     5,   317,    63,     5,
+       5,     1,     5,     3,    69,     5,     6,     5,     5,   318,
+       5,     5,   332,     5,     5,    42,     5,    82,     5,   556,
+     340,    66,   559,    42,   333,   335,    42,    92,    42,    94,
+       5,     5,   341,     5,     5,     5,    66,    97,    42,   110,
+     105,   139,   101,    22,   596,    31,   111,    30,   101,   369,
+     838,   101,   604,    46,    89,   101,   174,   101,   123,   124,
+     101,   126,    64,    49,   384,   101,   101,    60,   388,   101,
+     147,   148,   392,   637,   134,    42,    42,   387,   398,   144,
+      42,   101,    42,   148,    42,    42,    65,    42,    42,   877,
+     149,    77,   880,     0,    31,    39,   149,    66,   100,   149,
+      44,   172,   176,   149,    83,   149,   174,    51,   149,   177,
+      54,    55,    49,   149,   149,    98,   175,   149,   172,   105,
+     155,   123,   175,   177,   174,    94,    70,   447,   174,   149,
+     174,   919,   177,   442,   174,   175,   179,   457,   458,   178,
+     460,   179,   462,   208,   174,   465,   179,   699,   179,   176,
+     179,     1,    20,    20,   179,   179,    93,   176,   946,   177,
+     176,   226,   176,   107,   179,   177,   179,     5,   647,   179,
+     179,   650,   176,   179,   179,   178,    97,   177,   657,    32,
+     178,   178,   103,   178,   178,   589,   178,   178,   589,   178,
+     255,   178,    78,    79,   731,   732,   733,   734,   735,   736,
+     737,   738,   146,   178,   178,    65,   178,   178,   178,   176,
+     176,   276,   177,    36,   176,   751,   176,    35,   176,   176,
+     540,   176,   176,    83,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    31,    10,   799,   126,   127,   303,    36,
+     174,   805,    40,   807,    31,   411,    41,    34,   150,    72,
+      26,    49,   120,   120,    52,   172,   126,   127,   174,   174,
+     177,   177,    49,   165,   166,   133,   133,     3,    30,     5,
+       6,   175,    66,   174,   178,    72,   144,   144,   174,    66,
+      24,    57,   172,   603,     7,    47,   351,   177,    32,    21,
+     355,    23,   175,    37,   177,    93,    10,    29,   174,    97,
+     174,    33,   172,    97,   362,   103,    93,   365,   131,   174,
+      42,    36,    26,   622,   137,    47,   174,   115,   174,    95,
+     884,     4,     5,     6,    56,   174,    58,    71,   104,    61,
+     174,   118,    10,   109,   131,   174,    98,   113,   136,    68,
+     137,    73,   174,    57,   174,   143,    38,    72,    26,   174,
+     175,   138,   114,   174,   130,   675,   927,   928,   929,    91,
+      92,   155,   149,   428,    96,   152,   153,   154,    38,   163,
+     102,   174,   170,   167,   106,   169,   108,   697,     4,    57,
+     176,    95,   114,    96,   116,   178,   173,   792,   150,   151,
+     104,   796,   797,   798,   174,   109,   128,    45,   172,   113,
+     132,   174,   467,   135,   129,   174,   131,   174,   140,   729,
+      27,   174,   137,    23,    62,    63,   130,    95,   178,   739,
+      29,   741,   178,   743,   489,    31,   104,   178,   981,   174,
+     175,   109,   396,    50,    82,   113,   168,    43,   178,   171,
+      47,  1005,    48,    49,   408,   998,   174,   175,  1001,     1,
+     414,     3,   130,     5,     6,   174,   175,     3,   523,     5,
+       6,   121,     8,    80,   784,    31,  1019,     4,     5,     6,
+      66,    88,   436,   174,   175,    81,    58,    43,  1031,   174,
+     175,   445,    48,    49,    90,   550,    73,    53,   174,   175,
+      69,    97,   174,   175,    91,   101,   150,   151,     3,   105,
+       5,     6,   119,     8,   102,   122,   112,   471,   108,   115,
+      76,    77,   476,   174,   175,    81,    66,   683,   583,    28,
+      90,    30,   114,    32,    90,   116,   846,   847,   848,   849,
+     171,    97,   138,    42,    69,   141,   121,   143,   140,   105,
+       5,     6,    38,   149,   864,   111,   174,   175,    92,   115,
+      59,     3,   175,     5,     6,   174,     8,   866,   124,     5,
+       6,   175,   627,   174,   175,    74,    74,    76,   633,   174,
+     175,    25,   138,   177,   175,   640,   142,   143,   168,   145,
+     175,   747,   902,   177,   177,   174,   156,   157,   158,   159,
+     160,   161,   162,   177,   103,   175,   174,   106,    84,    85,
+      86,    87,   177,     1,    99,    97,   174,    67,   117,   178,
+     177,   121,   177,   177,    83,    65,   178,   177,     5,     5,
+     174,     5,   178,     5,   177,     6,   174,   178,     5,    27,
+     695,   178,   175,    31,   175,   175,   175,     5,   174,     5,
+     125,   125,   101,   164,   125,   174,    75,   178,   713,     5,
+       5,   716,     5,     5,     5,     5,   178,    75,   177,   177,
+     177,     5,     5,     5,     5,     5,     5,    76,   172,    66,
+     177,    66,    66,    66,     5,   178,     5,     5,   172,    77,
+       5,   174,     5,     5,    38,    75,   121,   178,   178,   178,
+     177,    25,   757,   325,    32,   178,   178,   625,   178,   178,
+     178,   178,   177,   491,   178,   178,   178,   178,   178,   629,
+     178,   178,   178,   817,   779,   178,   178,   342,   116,   331,
+     319,   304,   892,   642,   758,   776,   979,   430,   153,    -1,
+     279,    -1,    -1,    -1,   311,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     825,   826,    -1,    -1,    -1,    -1,    -1,    -1,   166,    -1,
+      -1,    -1,   837,    -1,    -1,   840,    -1,    -1,    -1,    -1,
+     178,    -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,    -1,
+     188,    -1,   190,    -1,    -1,    -1,   194,    -1,    -1,    -1,
+      -1,    -1,   200,    -1,    -1,   870,   871,   205,    -1,    -1,
+      -1,   876,    -1,    -1,    -1,    -1,   881,   882,   216,    -1,
+      -1,   219,    -1,    -1,    -1,    -1,    -1,   225,    -1,    -1,
+      -1,    -1,    -1,   231,    -1,   233,    -1,   235,    -1,    -1,
+      -1,   906,    -1,    -1,    -1,    -1,    -1,    -1,   913,   914,
+     915,    -1,    -1,    -1,   252,    -1,   921,   922,   923,    -1,
+      -1,   259,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     268,   936,   937,   938,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   950,   951,   952,   953,    -1,
+      -1,    -1,    -1,    -1,    -1,   293,    -1,    -1,    -1,   964,
+     965,   966,    -1,   968,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   312,   313,   314,   982,   983,    -1,
+      -1,    -1,   987,   988,   989,   990,   991,   992,    -1,    -1,
+      -1,    -1,    -1,    -1,   999,    -1,    -1,  1002,  1003,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   346,    -1,
+      -1,   349,  1017,    -1,    -1,    -1,  1021,  1022,  1023,    -1,
+      -1,    -1,    -1,    -1,  1029,    -1,   364,    -1,    -1,    -1,
+    1035,  1036,  1037,  1038,    -1,   373,    -1,    -1,   376,   377,
+     378,   379,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+    1055,  1056,   390,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   403,   404,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   420,   421,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   429,   430,    -1,   432,    -1,   434,    -1,    -1,    -1,
+     438,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     448,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   459,    -1,   461,    -1,   463,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   474,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   493,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     508,    -1,   510,    -1,   512,    -1,    -1,    -1,    -1,   517,
+      -1,    -1,   520,    -1,    -1,    -1,    -1,    -1,   526,   527,
+      -1,   529,   530,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   551,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   560,    -1,   562,    -1,    -1,   565,    -1,   567,
+      -1,   569,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   592,    -1,    -1,    -1,   596,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   604,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   645,    -1,   647,
+      -1,    -1,   650,    -1,    -1,    -1,    -1,    -1,    -1,   657,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   699,    -1,   701,    -1,    -1,   704,    -1,   706,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     728,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   742,    -1,    -1,    -1,   746,    -1,
+     748,   749,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     758,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   766,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   776,   777,
+      -1,    -1,    -1,   781,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     828,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   842,   843,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   851,    -1,    -1,   854,   855,   856,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   893,   894,   895,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     908,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   926,   927,
+     928,   929,    -1,    -1,    -1,    -1,    -1,   935,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   979,   980,    -1,    -1,    -1,   984,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,  1000,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+    1018,    -1,  1020,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,  1032,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,  1040
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,   139,   181,   182,     3,     5,     6,   416,   417,     0,
+     187,   174,     1,    21,    23,    29,    33,    42,    47,    56,
+      58,    61,    73,    91,    92,    96,   102,   106,   108,   114,
+     116,   128,   132,   135,   140,   168,   171,   188,   189,   191,
+     208,   216,   221,   222,   236,   245,   253,   265,   270,   284,
+     289,   295,   321,   370,   388,   396,   398,   409,   183,   397,
+       5,   413,   413,   177,   279,    32,   413,   147,   148,   218,
+     413,   190,   413,   413,   413,   192,   413,   416,   413,   413,
+     413,   416,   218,    35,   413,   413,   413,   174,   184,    41,
+     174,   174,   413,   174,   177,   280,   174,   413,   174,     7,
+     174,   174,   254,   193,   174,   416,   174,   174,   174,   174,
+     413,    68,   174,   399,   174,    24,    32,    37,    71,   185,
+     271,   246,   413,   179,   413,   290,    38,   389,   322,   266,
+     174,    28,    30,    32,    42,    59,    74,    76,   103,   106,
+     117,   194,   200,   237,   413,   371,   285,   296,    38,   413,
+     223,   174,   176,   410,   411,     4,   415,   416,   415,    78,
+      79,   186,    42,   176,   272,    42,   176,   247,   178,   179,
+     413,   179,   413,    42,   176,   291,   413,    42,   176,   390,
+      42,   176,   323,    42,   176,   267,   255,    96,   195,    42,
+     176,   238,   413,    42,   176,   372,    42,   176,   286,    42,
+     176,   297,   413,   174,    42,   176,   224,   401,   172,    42,
+     411,   174,   174,   174,   174,    23,    66,    94,    29,   416,
+     178,   178,   178,   178,    47,    66,   121,    58,   416,    73,
+     324,   327,    91,   416,    42,   176,   256,   416,   102,   416,
+      39,    44,    51,    54,    55,    70,   107,   146,   251,   108,
+     416,   114,    66,   116,   416,   121,   140,   416,    42,   176,
+     402,   413,   171,   416,   274,   416,   416,   413,   391,    69,
+     416,   416,    92,   416,   196,   239,    38,   209,   175,   373,
+     374,   416,   298,   413,   225,   400,   416,   279,   273,   281,
+     248,   292,   174,   393,   416,   325,   328,   268,   175,    64,
+     100,   123,   201,   177,   240,   241,   412,   413,   215,    27,
+      50,    80,    88,   119,   122,   174,   374,   101,   149,   287,
+     288,   299,   217,   175,   226,   228,   229,   232,   168,   403,
+     174,   275,   101,   149,   175,   277,   278,   282,   283,   249,
+     101,   149,   293,   294,   392,   416,   177,   329,   269,    74,
+     197,   413,   241,   242,   412,    25,   175,   210,   177,   377,
+     379,   380,   382,   383,   384,   382,   416,   416,   416,   412,
+     279,   174,   288,   177,   301,   219,    89,   101,   149,   155,
+     174,   175,   229,   404,   101,   175,   276,   277,   412,   279,
+      30,    98,   101,   278,   174,   174,   175,   250,   412,   279,
+     174,   294,   394,   416,   177,   330,   331,   174,   175,   416,
+      99,   198,   413,   174,   175,   243,   413,    97,   202,   174,
+      65,    83,   177,   380,   177,   379,   383,   416,    67,   375,
+     376,   412,   179,   300,   416,   174,   175,   302,    66,   174,
+     416,   416,   416,   416,   174,   175,   405,   412,    30,    47,
+      98,   114,   150,   151,   174,   412,   416,   412,    31,    40,
+      49,    52,    93,   103,   115,   136,   143,   170,   202,   412,
+     174,   175,   395,   416,   416,   174,   175,   332,   202,   257,
+       5,     6,     5,     6,   199,   415,   178,   134,   202,   121,
+     211,   203,   204,   205,   416,   416,   385,   413,   378,   416,
+     378,   416,   178,   416,    31,    43,    48,    49,    81,    90,
+     101,   105,   112,   115,   138,   141,   143,   149,   202,   306,
+     220,   416,   227,   177,   279,   233,    66,   155,   163,   167,
+     169,   202,   412,   416,     5,     5,   412,   412,   416,   412,
+     416,   412,   416,    36,    72,   131,   137,   252,   412,     5,
+     413,   103,   202,   178,   416,    31,    43,    48,    49,    53,
+      76,    77,    81,    90,   105,   111,   115,   124,   138,   142,
+     143,   145,   202,   336,   352,   354,   258,     5,     6,   174,
+      46,    60,   244,   413,   215,   204,   416,   178,   178,   386,
+     175,   175,   307,     5,     6,   414,   308,   416,    20,   120,
+     133,   144,   305,   416,   309,   416,    36,    72,   131,   137,
+     303,    10,    26,    57,    95,   104,   109,   113,   130,   304,
+     414,     5,   416,   416,   175,   230,   231,   413,   175,   234,
+     235,   416,   416,   416,   416,   251,   251,   412,   251,   251,
+     413,   416,   326,   175,   178,   337,   414,   338,   414,   416,
+     340,   416,    20,   120,   133,   144,   335,   339,   416,    36,
+      72,   129,   131,   137,   333,   416,    10,    26,    57,    95,
+     104,   109,   113,   130,   334,   416,     5,     5,   174,   175,
+     259,   413,   212,   206,   177,   379,   380,   381,   387,   125,
+     125,     8,   311,   312,   313,   416,   311,   412,   311,   310,
+     279,   101,   231,   413,    90,   156,   157,   158,   159,   160,
+     161,   162,   235,   164,   413,   251,   413,   331,   125,     8,
+     341,   342,   343,   416,   341,   341,   341,   355,    66,   412,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    31,
+      34,    49,    66,    93,   118,   138,   149,   152,   153,   154,
+     173,   213,   174,     5,     6,   207,   415,    22,    75,   413,
+     412,   311,   416,   178,   416,     5,   416,     5,     5,     5,
+       5,     5,   413,   413,   174,   178,    75,   126,   127,   172,
+     344,   177,   356,   357,   416,   412,    84,    85,    86,    87,
+     263,   414,   414,   414,   414,   414,   414,   414,   414,   412,
+      45,    62,    63,    82,   261,   412,   416,   412,    10,    26,
+      57,    95,   104,   109,   113,   130,   262,   416,   415,   416,
+     416,   215,   413,   313,   314,   177,   177,     5,   416,     5,
+       5,     5,     5,     5,   406,   343,   416,   172,   345,   413,
+     177,   350,   416,    76,   358,   359,   412,    31,    49,    93,
+     353,    66,   264,   264,    66,    66,    66,   264,   264,   264,
+     251,   251,   150,   151,   260,   251,   260,   214,   178,   315,
+     413,   413,   416,     5,     5,   407,   172,   346,   413,   350,
+     347,   413,   177,   351,   416,   416,   416,    31,    49,    77,
+     105,   360,   412,   412,   412,   412,   416,   416,   416,   416,
+       5,     5,   412,   279,   174,   175,   177,   316,   317,   413,
+     413,     5,     5,   150,   165,   166,   408,   413,   350,   348,
+     350,   413,   179,   413,   251,   178,   361,   362,   364,   363,
+     353,   416,   416,   416,   412,   110,   172,   413,   177,   318,
+     416,   178,   178,   413,   413,   413,   349,   350,   178,   413,
+     179,   413,   179,   413,     8,   365,   366,   367,   416,   365,
+     365,   365,   416,   413,   413,   179,   413,    38,   177,   350,
+     178,   178,   413,   178,   413,   178,   413,   178,   413,    75,
+     126,   127,   172,   177,   368,   178,   413,   179,   413,   179,
+     413,   319,   413,   178,   178,   178,   178,   367,   416,   172,
+     368,   413,   413,   177,   369,   416,   178,   178,   413,   178,
+     413,   178,   413,   178,   413,   413,   413,   172,   368,   413,
+     368,   413,   179,   413,   251,   178,   178,   178,   178,    25,
+     178,   413,   368,   178,   413,   179,   413,   179,   413,   413,
+     368,   178,   178,   413,   178,   413,   178,   413,   178,   413,
+     121,   178,   178,   178,   178,   320,   413,   413
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   180,   181,   183,   182,   184,   184,   185,   185,   185,
+     185,   186,   186,   187,   187,   188,   188,   188,   188,   188,
+     188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
+     188,   188,   188,   188,   188,   188,   188,   188,   190,   189,
+     192,   191,   193,   193,   195,   196,   197,   194,   198,   198,
+     198,   199,   199,   199,   199,   200,   200,   200,   200,   200,
+     200,   200,   200,   200,   201,   201,   201,   202,   203,   203,
+     205,   206,   204,   207,   207,   207,   209,   210,   208,   211,
+     212,   208,   213,   214,   208,   215,   215,   217,   216,   218,
+     218,   219,   219,   220,   220,   221,   222,   223,   223,   225,
+     224,   226,   226,   226,   227,   226,   228,   228,   229,   229,
+     230,   230,   231,   233,   232,   234,   234,   235,   235,   235,
+     235,   235,   235,   235,   235,   236,   237,   237,   239,   238,
+     240,   240,   241,   242,   242,   243,   243,   244,   244,   245,
+     246,   246,   248,   247,   249,   249,   250,   250,   250,   250,
+     250,   250,   250,   250,   250,   250,   250,   250,   251,   251,
+     251,   251,   251,   251,   251,   251,   252,   252,   252,   252,
+     254,   253,   255,   255,   257,   256,   258,   258,   259,   259,
+     259,   259,   259,   259,   259,   259,   259,   259,   259,   259,
+     259,   259,   259,   259,   259,   259,   259,   259,   259,   260,
+     260,   260,   261,   261,   261,   261,   262,   262,   262,   262,
+     262,   262,   262,   262,   263,   263,   263,   263,   264,   264,
+     265,   266,   266,   268,   267,   269,   269,   270,   271,   271,
+     273,   272,   274,   272,   275,   275,   276,   276,   276,   276,
+     276,   276,   277,   277,   278,   278,   279,   279,   280,   280,
+     280,   280,   281,   281,   282,   282,   283,   283,   284,   285,
+     285,   286,   287,   287,   288,   288,   289,   290,   290,   292,
+     291,   293,   293,   294,   294,   295,   296,   296,   298,   297,
+     299,   299,   300,   300,   300,   300,   301,   301,   302,   302,
+     302,   302,   302,   302,   302,   302,   302,   302,   303,   303,
+     303,   303,   304,   304,   304,   304,   304,   304,   304,   304,
+     305,   305,   305,   305,   307,   306,   308,   306,   309,   306,
+     310,   306,   306,   306,   311,   311,   312,   312,   314,   313,
+     315,   315,   316,   316,   317,   317,   317,   318,   318,   318,
+     318,   318,   318,   318,   318,   318,   319,   320,   318,   321,
+     322,   322,   324,   325,   326,   323,   327,   328,   323,   329,
+     329,   330,   330,   331,   331,   332,   332,   332,   332,   332,
+     332,   332,   332,   332,   332,   332,   332,   332,   332,   332,
+     333,   333,   333,   333,   333,   334,   334,   334,   334,   334,
+     334,   334,   334,   335,   335,   335,   335,   337,   336,   338,
+     336,   339,   336,   340,   336,   341,   341,   342,   342,   344,
+     343,   345,   343,   346,   343,   347,   343,   348,   343,   349,
+     343,   350,   350,   350,   351,   351,   351,   351,   351,   351,
+     351,   351,   351,   351,   352,   352,   352,   352,   353,   353,
+     353,   354,   355,   355,   356,   357,   357,   358,   359,   359,
+     361,   360,   362,   360,   363,   360,   364,   360,   365,   365,
+     366,   366,   367,   367,   367,   367,   367,   367,   368,   368,
+     368,   369,   369,   369,   369,   369,   369,   369,   369,   369,
+     369,   370,   371,   371,   372,   373,   373,   374,   374,   374,
+     375,   374,   374,   374,   376,   374,   377,   377,   377,   377,
+     377,   378,   378,   379,   380,   381,   382,   382,   384,   385,
+     383,   386,   386,   387,   387,   387,   388,   389,   389,   391,
+     392,   390,   393,   393,   394,   394,   395,   395,   397,   396,
+     399,   400,   398,   401,   401,   403,   402,   404,   404,   405,
+     406,   405,   405,   405,   405,   405,   407,   407,   408,   408,
+     408,   409,   410,   410,   411,   412,   413,   414,   414,   415,
+     416,   416,   416,   417,   416
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     4,     0,     5,     0,     2,     3,     3,     3,
+       3,     1,     1,     0,     2,     3,     5,     2,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     3,
+       0,     5,     0,     2,     0,     0,     0,     9,     0,     3,
+       3,     0,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     2,     1,     2,
+       0,     0,     4,     1,     1,     1,     0,     0,    10,     0,
+       0,    14,     0,     0,    17,     0,     3,     0,    10,     1,
+       1,     0,     3,     1,     2,     8,     6,     0,     2,     0,
+       5,     0,     1,     1,     0,     5,     1,     2,    11,     4,
+       1,     2,    11,     0,     5,     1,     2,     4,     5,     4,
+       6,     4,     4,     6,     3,     6,     0,     2,     0,     6,
+       1,     2,     2,     0,     2,     3,     2,     1,     1,     6,
+       0,     2,     0,     6,     0,     2,     3,     3,     5,     4,
+       4,     4,     4,     2,     3,     3,     6,     2,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       0,     7,     0,     2,     0,     8,     0,     2,     2,     3,
+       3,     3,     3,     3,     4,     4,     4,     4,     3,     4,
+       5,     5,     5,     2,     6,     5,     4,     4,     4,     0,
+       2,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     2,
+       6,     0,     2,     0,     6,     0,     3,     6,     0,     2,
+       0,     7,     0,     6,     0,     2,     3,     2,     2,     2,
+       3,     3,     1,     2,     3,     2,     4,     2,     4,     4,
+       4,     4,     0,     2,     3,     2,     3,     4,     6,     0,
+       2,     5,     1,     2,     3,     2,     6,     0,     2,     0,
+       6,     1,     2,     3,     2,     6,     0,     2,     0,     6,
+       0,     4,     2,     4,     2,     4,     0,     2,     3,     2,
+       3,     2,     3,     3,     3,     3,     3,     2,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     3,     0,     3,     0,     3,
+       0,     4,     4,     3,     1,     1,     1,     3,     0,     5,
+       0,     2,     3,     3,     4,     5,     2,     4,     4,     4,
+       4,     5,     5,     5,     5,     1,     0,     0,    10,     6,
+       0,     2,     0,     0,     0,    11,     0,     0,     7,     0,
+       2,     4,     6,     0,     2,     3,     2,     2,     3,     3,
+       2,     3,     2,     3,     3,     3,     3,     3,     3,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     3,     0,
+       3,     0,     3,     0,     3,     1,     1,     1,     3,     0,
+       3,     0,     4,     0,     5,     0,     5,     0,     6,     0,
+       7,     4,     5,     2,     4,     5,     4,     5,     4,     5,
+       4,     5,     1,     2,     4,     5,     6,     7,     3,     3,
+       3,     5,     0,     2,     4,     0,     2,     2,     0,     2,
+       0,     3,     0,     3,     0,     3,     0,     3,     1,     1,
+       1,     3,     2,     3,     4,     4,     5,     6,     4,     5,
+       2,     4,     5,     4,     5,     4,     5,     4,     5,     1,
+       2,     6,     0,     2,     4,     1,     2,     3,     5,     3,
+       0,     5,     3,     3,     0,     5,     0,     1,     1,     2,
+       2,     0,     1,     4,     4,     4,     1,     2,     0,     0,
+       4,     0,     2,     1,     1,     1,     6,     0,     2,     0,
+       0,     7,     1,     2,     0,     2,     3,     2,     0,     3,
+       0,     0,     8,     0,     2,     0,     5,     0,     2,     2,
+       0,     7,     3,     3,     4,     2,     0,     2,     2,     2,
+       2,     6,     1,     2,     5,     4,     1,     1,     1,     1,
+       1,     1,     1,     0,     2
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 3: /* $@1: %empty  */
+#line 397 "/root/repo/src/defin/def.ypp"
+                                   { release( (yyvsp[-1]._token) ); }
+#line 2594 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 7: /* defHeaderOpt: DIVIDERCHAR_K qstring ';'  */
+#line 407 "/root/repo/src/defin/def.ypp"
+                                   { release((yyvsp[-1]._token)); }
+#line 2600 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 9: /* defHeaderOpt: BUSBITCHARS_K qstring ';'  */
+#line 409 "/root/repo/src/defin/def.ypp"
+                                   { release((yyvsp[-1]._token)); }
+#line 2606 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 10: /* defHeaderOpt: DESIGN_K ident ';'  */
+#line 410 "/root/repo/src/defin/def.ypp"
+                                   { release( (yyvsp[-1]._token) ); }
+#line 2612 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 11: /* defCaseSens: ON_K  */
+#line 414 "/root/repo/src/defin/def.ypp"
+               { deflex_casesens = true; }
+#line 2618 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 12: /* defCaseSens: OFF_K  */
+#line 415 "/root/repo/src/defin/def.ypp"
+               { deflex_casesens = false; }
+#line 2624 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 15: /* defStatement: TECHNOLOGY_K ident ';'  */
+#line 424 "/root/repo/src/defin/def.ypp"
+                                { release( (yyvsp[-1]._token) ); }
+#line 2630 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 16: /* defStatement: UNITS_K DISTANCE_K MICRONS_K integer ';'  */
+#line 425 "/root/repo/src/defin/def.ypp"
+                                                  { readerR->units((yyvsp[-1]._int)); }
+#line 2636 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 19: /* defStatement: DIEAREA_K defPointList ';'  */
+#line 428 "/root/repo/src/defin/def.ypp"
+                                    { readerR->dieArea( *(yyvsp[-1]._points) ); delete (yyvsp[-1]._points); }
+#line 2642 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 38: /* $@2: %empty  */
+#line 450 "/root/repo/src/defin/def.ypp"
+                   {deflex_history();}
+#line 2648 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 40: /* $@3: %empty  */
+#line 454 "/root/repo/src/defin/def.ypp"
+                               { prop_defsR->beginDefinitions(); }
+#line 2654 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 41: /* defPropertyDefinitions: PROPERTYDEFINITIONS_K $@3 defPropertyDefinitionList END_K PROPERTYDEFINITIONS_K  */
+#line 454 "/root/repo/src/defin/def.ypp"
+                                                                                                                         { prop_defsR->endDefinitions(); }
+#line 2660 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 44: /* $@4: %empty  */
+#line 463 "/root/repo/src/defin/def.ypp"
+                               { deflex_kid = ANY_ID; }
+#line 2666 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 45: /* $@5: %empty  */
+#line 463 "/root/repo/src/defin/def.ypp"
+                                                              { deflex_kid = 0; }
+#line 2672 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 46: /* $@6: %empty  */
+#line 464 "/root/repo/src/defin/def.ypp"
+         {
+             prop_defsR->begin((defObjectType) (yyvsp[-4]._int), *(yyvsp[-2]._token), (defPropType) (yyvsp[0]._int));
+         }
+#line 2680 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 47: /* defPropertyDefinition: defPropertyObjectType $@4 ident $@5 defPropertyType $@6 defPropertyDefinitionRange defPropertyDefinitionValue ';'  */
+#line 468 "/root/repo/src/defin/def.ypp"
+         {
+             prop_defsR->end();
+             release((yyvsp[-6]._token));
+         }
+#line 2689 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 49: /* defPropertyDefinitionRange: RANGE_K NUM_INT NUM_INT  */
+#line 476 "/root/repo/src/defin/def.ypp"
+                                 { prop_defsR->range((yyvsp[-1]._int),(yyvsp[0]._int)); }
+#line 2695 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 50: /* defPropertyDefinitionRange: RANGE_K NUM_DOUBLE NUM_DOUBLE  */
+#line 477 "/root/repo/src/defin/def.ypp"
+                                       { prop_defsR->range((yyvsp[-1]._double),(yyvsp[0]._double)); }
+#line 2701 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 52: /* defPropertyDefinitionValue: NUM_INT  */
+#line 482 "/root/repo/src/defin/def.ypp"
+                 { prop_defsR->value((yyvsp[0]._int)); }
+#line 2707 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 53: /* defPropertyDefinitionValue: NUM_DOUBLE  */
+#line 483 "/root/repo/src/defin/def.ypp"
+                    { prop_defsR->value((yyvsp[0]._double)); }
+#line 2713 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 54: /* defPropertyDefinitionValue: qstring  */
+#line 484 "/root/repo/src/defin/def.ypp"
+                 { prop_defsR->value(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 2719 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 55: /* defPropertyObjectType: COMPONENT_K  */
+#line 488 "/root/repo/src/defin/def.ypp"
+                       { (yyval._int) = DEF_COMPONENT; }
+#line 2725 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 56: /* defPropertyObjectType: COMPONENTPIN_K  */
+#line 489 "/root/repo/src/defin/def.ypp"
+                       { (yyval._int) = DEF_COMPONENTPIN; }
+#line 2731 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 57: /* defPropertyObjectType: DESIGN_K  */
+#line 490 "/root/repo/src/defin/def.ypp"
+                       { (yyval._int) = DEF_DESIGN; }
+#line 2737 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 58: /* defPropertyObjectType: GROUP_K  */
+#line 491 "/root/repo/src/defin/def.ypp"
+                       { (yyval._int) = DEF_GROUP; }
+#line 2743 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 59: /* defPropertyObjectType: NET_K  */
+#line 492 "/root/repo/src/defin/def.ypp"
+                       { (yyval._int) = DEF_NET; }
+#line 2749 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 60: /* defPropertyObjectType: REGION_K  */
+#line 493 "/root/repo/src/defin/def.ypp"
+                       { (yyval._int) = DEF_REGION; }
+#line 2755 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 61: /* defPropertyObjectType: ROW_K  */
+#line 494 "/root/repo/src/defin/def.ypp"
+                       { (yyval._int) = DEF_ROW; }
+#line 2761 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 62: /* defPropertyObjectType: SPECIALNET_K  */
+#line 495 "/root/repo/src/defin/def.ypp"
+                       { (yyval._int) = DEF_SPECIALNET; }
+#line 2767 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 63: /* defPropertyObjectType: NONDEFAULTRULE_K  */
+#line 496 "/root/repo/src/defin/def.ypp"
+                       { (yyval._int) = DEF_NONDEFAULTRULE; }
+#line 2773 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 64: /* defPropertyType: INTEGER_K  */
+#line 500 "/root/repo/src/defin/def.ypp"
+                { (yyval._int) = DEF_INTEGER; }
+#line 2779 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 65: /* defPropertyType: REAL_K  */
+#line 501 "/root/repo/src/defin/def.ypp"
+             { (yyval._int) = DEF_REAL; }
+#line 2785 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 66: /* defPropertyType: STRING_K  */
+#line 502 "/root/repo/src/defin/def.ypp"
+               { (yyval._int) = DEF_STRING; }
+#line 2791 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 67: /* defProperty: PROPERTY_K defPropertyValues  */
+#line 506 "/root/repo/src/defin/def.ypp"
+                                      { (yyval._props) = (yyvsp[0]._props); }
+#line 2797 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 68: /* defPropertyValues: defPropertyNameValue  */
+#line 510 "/root/repo/src/defin/def.ypp"
+                              { (yyval._props) = new std::vector<prop*>; (yyval._props)->push_back((yyvsp[0]._prop)); }
+#line 2803 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 69: /* defPropertyValues: defPropertyValues defPropertyNameValue  */
+#line 511 "/root/repo/src/defin/def.ypp"
+                                                { (yyval._props) = (yyvsp[-1]._props); (yyval._props)->push_back((yyvsp[0]._prop)); }
+#line 2809 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 70: /* $@7: %empty  */
+#line 515 "/root/repo/src/defin/def.ypp"
+         { deflex_kid = ANY_ID; }
+#line 2815 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 71: /* @8: %empty  */
+#line 515 "/root/repo/src/defin/def.ypp"
+                                        { deflex_kid = 0; (yyval._prop) = new prop; }
+#line 2821 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 72: /* defPropertyNameValue: $@7 ident @8 defPropertyValue  */
+#line 516 "/root/repo/src/defin/def.ypp"
+         { (yyval._prop) = (yyvsp[-1]._prop); (yyval._prop)->_name = (yyvsp[-2]._token); }
+#line 2827 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 73: /* defPropertyValue: NUM_INT  */
+#line 521 "/root/repo/src/defin/def.ypp"
+         { 
+             (yyvsp[-1]._prop)->_type = DEF_INTEGER;
+             (yyvsp[-1]._prop)->_value._int_val = (yyvsp[0]._int);
+         }
+#line 2836 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 74: /* defPropertyValue: NUM_DOUBLE  */
+#line 526 "/root/repo/src/defin/def.ypp"
+         { 
+             (yyvsp[-1]._prop)->_type = DEF_REAL;
+             (yyvsp[-1]._prop)->_value._flt_val = (yyvsp[0]._double);
+         }
+#line 2845 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 75: /* defPropertyValue: qstring  */
+#line 531 "/root/repo/src/defin/def.ypp"
+         { 
+             (yyvsp[-1]._prop)->_type = DEF_STRING;
+             (yyvsp[-1]._prop)->_value._str_val = (yyvsp[0]._token);
+         }
+#line 2854 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 76: /* $@9: %empty  */
+#line 539 "/root/repo/src/defin/def.ypp"
+         {
+             rowR->begin( *(yyvsp[-4]._token), *(yyvsp[-3]._token), (yyvsp[-2]._int), (yyvsp[-1]._int), (defOrient) (yyvsp[0]._tid), DEF_HORIZONTAL, 1, 0 );
+             release((yyvsp[-4]._token));
+             release((yyvsp[-3]._token));
+         }
+#line 2864 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 77: /* $@10: %empty  */
+#line 544 "/root/repo/src/defin/def.ypp"
+                          { rowR->end(); }
+#line 2870 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 79: /* $@11: %empty  */
+#line 547 "/root/repo/src/defin/def.ypp"
+         {
+             if ( (yyvsp[0]._int) == 1 )
+             {
+                 rowR->begin( *(yyvsp[-8]._token), *(yyvsp[-7]._token), (yyvsp[-6]._int), (yyvsp[-5]._int), (defOrient) (yyvsp[-4]._tid), DEF_HORIZONTAL, (yyvsp[-2]._int), 0 );
+             }
+             else if ( (yyvsp[-2]._int) == 1 )
+             {
+                 rowR->begin( *(yyvsp[-8]._token), *(yyvsp[-7]._token), (yyvsp[-6]._int), (yyvsp[-5]._int), (defOrient) (yyvsp[-4]._tid), DEF_VERTICAL, (yyvsp[0]._int), 0 );
+             }
+             else
+             {
+                 deferror("invalid row statement, statement contains illegal (multi-row) step pattern");
+             }
+             release((yyvsp[-8]._token));
+             release((yyvsp[-7]._token));
+         }
+#line 2891 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 80: /* $@12: %empty  */
+#line 563 "/root/repo/src/defin/def.ypp"
+                          { rowR->end(); }
+#line 2897 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 82: /* $@13: %empty  */
+#line 566 "/root/repo/src/defin/def.ypp"
+         {
+             if ( (yyvsp[-3]._int) == 1 )
+             {
+                 rowR->begin( *(yyvsp[-11]._token), *(yyvsp[-10]._token), (yyvsp[-9]._int), (yyvsp[-8]._int), (defOrient) (yyvsp[-7]._tid), DEF_HORIZONTAL, (yyvsp[-5]._int), (yyvsp[-1]._int) );
+             }
+             else if ( (yyvsp[-5]._int) == 1 )
+             {
+                 rowR->begin( *(yyvsp[-11]._token), *(yyvsp[-10]._token), (yyvsp[-9]._int), (yyvsp[-8]._int), (defOrient) (yyvsp[-7]._tid), DEF_VERTICAL, (yyvsp[-3]._int), (yyvsp[0]._int) );
+             }
+             else
+             {
+                 deferror("invalid row statement, statement contains illegal (multi-row) step pattern");
+             }
+             release((yyvsp[-11]._token));
+             release((yyvsp[-10]._token));
+         }
+#line 2918 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 83: /* $@14: %empty  */
+#line 582 "/root/repo/src/defin/def.ypp"
+                          { rowR->end(); }
+#line 2924 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 86: /* defRowProperties: defRowProperties '+' defProperty  */
+#line 587 "/root/repo/src/defin/def.ypp"
+                                         { addRowProps((yyvsp[0]._props)); }
+#line 2930 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 87: /* $@15: %empty  */
+#line 592 "/root/repo/src/defin/def.ypp"
+             { tracksR->tracksBegin((defDirection) (yyvsp[-5]._tid), (yyvsp[-4]._int), (yyvsp[-2]._int), (yyvsp[0]._int)); }
+#line 2936 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 88: /* defTrack: TRACKS_K defDir integer DO_K integer STEP_K integer $@15 defTrackLayers ';'  */
+#line 593 "/root/repo/src/defin/def.ypp"
+         {
+             tracksR->tracksEnd();
+         }
+#line 2944 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 89: /* defDir: X_K  */
+#line 599 "/root/repo/src/defin/def.ypp"
+             { (yyval._tid) = DEF_X; }
+#line 2950 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 90: /* defDir: Y_K  */
+#line 600 "/root/repo/src/defin/def.ypp"
+             { (yyval._tid) = DEF_Y; }
+#line 2956 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 93: /* defTrackLayerNames: ident  */
+#line 609 "/root/repo/src/defin/def.ypp"
+            { tracksR->tracksLayer(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 2962 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 94: /* defTrackLayerNames: defTrackLayerNames ident  */
+#line 610 "/root/repo/src/defin/def.ypp"
+                               { tracksR->tracksLayer(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 2968 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 95: /* defGCellGrid: GCELLGRID_K defDir integer DO_K integer STEP_K integer ';'  */
+#line 615 "/root/repo/src/defin/def.ypp"
+            { gcellR->gcell( (defDirection) (yyvsp[-6]._tid), (yyvsp[-5]._int), (yyvsp[-3]._int), (yyvsp[-1]._int) ); }
+#line 2974 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 99: /* $@16: %empty  */
+#line 628 "/root/repo/src/defin/def.ypp"
+                   { viaR->viaBegin( *(yyvsp[0]._token)); }
+#line 2980 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 100: /* defVia: '-' ident $@16 defViaDef ';'  */
+#line 628 "/root/repo/src/defin/def.ypp"
+                                                           { viaR->viaEnd(); release((yyvsp[-3]._token)); }
+#line 2986 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 104: /* $@17: %empty  */
+#line 637 "/root/repo/src/defin/def.ypp"
+                                 { viaR->viaPattern(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 2992 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 108: /* defViaGeom: '+' RECT_K ident '(' integer integer ')' '(' integer integer ')'  */
+#line 647 "/root/repo/src/defin/def.ypp"
+         {
+             viaR->viaRect( *(yyvsp[-8]._token), (yyvsp[-6]._int), (yyvsp[-5]._int), (yyvsp[-2]._int), (yyvsp[-1]._int) );
+             release((yyvsp[-8]._token));
+         }
+#line 3001 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 109: /* defViaGeom: '+' POLYGON_K ident defPointList  */
+#line 652 "/root/repo/src/defin/def.ypp"
+         {
+             delete (yyvsp[0]._points);
+             release((yyvsp[-1]._token));
+         }
+#line 3010 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 112: /* defViaRect: '+' RECT_K ident '(' integer integer ')' '(' integer integer ')'  */
+#line 665 "/root/repo/src/defin/def.ypp"
+         {
+             viaR->viaRect( *(yyvsp[-8]._token), (yyvsp[-6]._int), (yyvsp[-5]._int), (yyvsp[-2]._int), (yyvsp[-1]._int) );
+             release((yyvsp[-8]._token));
+         }
+#line 3019 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 113: /* $@18: %empty  */
+#line 672 "/root/repo/src/defin/def.ypp"
+                             { viaR->viaRule(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 3025 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 117: /* defViaOpt: '+' CUTSIZE_K NUM_INT NUM_INT  */
+#line 681 "/root/repo/src/defin/def.ypp"
+                                       { viaR->viaCutSize( (yyvsp[-1]._int), (yyvsp[0]._int) ); }
+#line 3031 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 118: /* defViaOpt: '+' LAYERS_K ident ident ident  */
+#line 682 "/root/repo/src/defin/def.ypp"
+                                        { viaR->viaLayers(*(yyvsp[-2]._token), *(yyvsp[-1]._token), *(yyvsp[0]._token)); release((yyvsp[-2]._token)); release((yyvsp[-1]._token)); release((yyvsp[0]._token)); }
+#line 3037 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 119: /* defViaOpt: '+' CUTSPACING_K NUM_INT NUM_INT  */
+#line 683 "/root/repo/src/defin/def.ypp"
+                                          { viaR->viaCutSpacing( (yyvsp[-1]._int), (yyvsp[0]._int) ); }
+#line 3043 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 120: /* defViaOpt: '+' ENCLOSURE_K NUM_INT NUM_INT NUM_INT NUM_INT  */
+#line 684 "/root/repo/src/defin/def.ypp"
+                                                         { viaR->viaEnclosure( (yyvsp[-3]._int), (yyvsp[-2]._int), (yyvsp[-1]._int), (yyvsp[0]._int) ); }
+#line 3049 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 121: /* defViaOpt: '+' ROWCOL_K NUM_INT NUM_INT  */
+#line 685 "/root/repo/src/defin/def.ypp"
+                                      { viaR->viaRowCol( (yyvsp[-1]._int), (yyvsp[0]._int) ); }
+#line 3055 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 122: /* defViaOpt: '+' ORIGIN_K NUM_INT NUM_INT  */
+#line 686 "/root/repo/src/defin/def.ypp"
+                                      { viaR->viaOrigin( (yyvsp[-1]._int), (yyvsp[0]._int) ); }
+#line 3061 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 123: /* defViaOpt: '+' OFFSET_K NUM_INT NUM_INT NUM_INT NUM_INT  */
+#line 687 "/root/repo/src/defin/def.ypp"
+                                                      { viaR->viaOffset( (yyvsp[-3]._int), (yyvsp[-2]._int), (yyvsp[-1]._int), (yyvsp[0]._int) ); }
+#line 3067 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 124: /* defViaOpt: '+' PATTERN_K ident  */
+#line 688 "/root/repo/src/defin/def.ypp"
+                             { viaR->viaPattern(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 3073 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 128: /* $@19: %empty  */
+#line 702 "/root/repo/src/defin/def.ypp"
+         {
+             regionR->begin(*(yyvsp[0]._token));
+         }
+#line 3081 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 129: /* defRegion: '-' ident $@19 defRegionRects defRegionOpts ';'  */
+#line 706 "/root/repo/src/defin/def.ypp"
+         {
+             release((yyvsp[-4]._token));
+             regionR->end();
+         }
+#line 3090 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 132: /* defRegionRect: point point  */
+#line 718 "/root/repo/src/defin/def.ypp"
+                     { regionR->boundary( (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (yyvsp[0]._point)._x, (yyvsp[0]._point)._y ); }
+#line 3096 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 136: /* defRegionOpt: '+' defProperty  */
+#line 728 "/root/repo/src/defin/def.ypp"
+                         { addRegionProps((yyvsp[0]._props)); }
+#line 3102 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 137: /* defRegionType: FENCE_K  */
+#line 732 "/root/repo/src/defin/def.ypp"
+                  { regionR->type( DEF_FENCE ); }
+#line 3108 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 138: /* defRegionType: GUIDE_K  */
+#line 733 "/root/repo/src/defin/def.ypp"
+                  { regionR->type( DEF_GUIDE ); }
+#line 3114 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 142: /* $@20: %empty  */
+#line 746 "/root/repo/src/defin/def.ypp"
+                         { componentR->begin( *(yyvsp[-1]._token), *(yyvsp[0]._token) ); }
+#line 3120 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 143: /* defComponent: '-' ident ident $@20 defComponentOpts ';'  */
+#line 747 "/root/repo/src/defin/def.ypp"
+         {
+             componentR->end();
+             release((yyvsp[-4]._token));
+             release((yyvsp[-3]._token));
+         }
+#line 3130 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 146: /* defComponentOpt: '+' EEQMASTER_K ident  */
+#line 760 "/root/repo/src/defin/def.ypp"
+                                             { release((yyvsp[0]._token)); }
+#line 3136 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 147: /* defComponentOpt: '+' SOURCE_K defComponentSource  */
+#line 761 "/root/repo/src/defin/def.ypp"
+                                             { componentR->source( (defSource) (yyvsp[0]._int) ); }
+#line 3142 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 148: /* defComponentOpt: '+' FOREIGN_K ident point defOrient  */
+#line 762 "/root/repo/src/defin/def.ypp"
+                                             { release((yyvsp[-2]._token)); }
+#line 3148 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 149: /* defComponentOpt: '+' FIXED_K point defOrient  */
+#line 763 "/root/repo/src/defin/def.ypp"
+                                             { componentR->placement( DEF_PLACEMENT_FIXED, (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (defOrient) (yyvsp[0]._tid) ); }
+#line 3154 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 150: /* defComponentOpt: '+' COVER_K point defOrient  */
+#line 764 "/root/repo/src/defin/def.ypp"
+                                             { componentR->placement( DEF_PLACEMENT_COVER, (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (defOrient) (yyvsp[0]._tid) ); }
+#line 3160 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 151: /* defComponentOpt: '+' PLACED_K point defOrient  */
+#line 765 "/root/repo/src/defin/def.ypp"
+                                             { componentR->placement( DEF_PLACEMENT_PLACED, (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (defOrient) (yyvsp[0]._tid) ); }
+#line 3166 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 152: /* defComponentOpt: '+' UNPLACED_K point defOrient  */
+#line 766 "/root/repo/src/defin/def.ypp"
+                                             { componentR->placement( DEF_PLACEMENT_UNPLACED, (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (defOrient) (yyvsp[0]._tid) ); }
+#line 3172 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 153: /* defComponentOpt: '+' UNPLACED_K  */
+#line 767 "/root/repo/src/defin/def.ypp"
+                                             { componentR->placement( DEF_PLACEMENT_UNPLACED, 0, 0, DEF_ORIENT_N ); }
+#line 3178 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 154: /* defComponentOpt: '+' WEIGHT_K NUM_INT  */
+#line 768 "/root/repo/src/defin/def.ypp"
+                                             { componentR->weight( (yyvsp[0]._int) ); }
+#line 3184 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 155: /* defComponentOpt: '+' REGION_K ident  */
+#line 769 "/root/repo/src/defin/def.ypp"
+                                             { componentR->region( *(yyvsp[0]._token) ); release((yyvsp[0]._token)); }
+#line 3190 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 156: /* defComponentOpt: '+' HALO_K integer integer integer integer  */
+#line 770 "/root/repo/src/defin/def.ypp"
+                                                    { componentR->halo( (yyvsp[-3]._int), (yyvsp[-2]._int), (yyvsp[-1]._int), (yyvsp[0]._int) ); }
+#line 3196 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 157: /* defComponentOpt: '+' defProperty  */
+#line 771 "/root/repo/src/defin/def.ypp"
+                         { addComponentProps((yyvsp[0]._props)); }
+#line 3202 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 158: /* defOrient: N_K  */
+#line 775 "/root/repo/src/defin/def.ypp"
+              { (yyval._tid) = DEF_ORIENT_N; }
+#line 3208 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 159: /* defOrient: S_K  */
+#line 776 "/root/repo/src/defin/def.ypp"
+              { (yyval._tid) = DEF_ORIENT_S; }
+#line 3214 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 160: /* defOrient: E_K  */
+#line 777 "/root/repo/src/defin/def.ypp"
+              { (yyval._tid) = DEF_ORIENT_E; }
+#line 3220 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 161: /* defOrient: W_K  */
+#line 778 "/root/repo/src/defin/def.ypp"
+              { (yyval._tid) = DEF_ORIENT_W; }
+#line 3226 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 162: /* defOrient: FN_K  */
+#line 779 "/root/repo/src/defin/def.ypp"
+              { (yyval._tid) = DEF_ORIENT_FN; }
+#line 3232 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 163: /* defOrient: FS_K  */
+#line 780 "/root/repo/src/defin/def.ypp"
+              { (yyval._tid) = DEF_ORIENT_FS; }
+#line 3238 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 164: /* defOrient: FE_K  */
+#line 781 "/root/repo/src/defin/def.ypp"
+              { (yyval._tid) = DEF_ORIENT_FE; }
+#line 3244 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 165: /* defOrient: FW_K  */
+#line 782 "/root/repo/src/defin/def.ypp"
+              { (yyval._tid) = DEF_ORIENT_FW; }
+#line 3250 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 166: /* defComponentSource: NETLIST_K  */
+#line 786 "/root/repo/src/defin/def.ypp"
+                 { (yyval._int) = DEF_NETLIST; }
+#line 3256 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 167: /* defComponentSource: DIST_K  */
+#line 787 "/root/repo/src/defin/def.ypp"
+                 { (yyval._int) = DEF_DIST; }
+#line 3262 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 168: /* defComponentSource: USER_K  */
+#line 788 "/root/repo/src/defin/def.ypp"
+                 { (yyval._int) = DEF_USER; }
+#line 3268 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 169: /* defComponentSource: TIMING_K  */
+#line 789 "/root/repo/src/defin/def.ypp"
+                  { (yyval._int) = DEF_TIMING; }
+#line 3274 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 170: /* $@21: %empty  */
+#line 793 "/root/repo/src/defin/def.ypp"
+                        { pinR->pinsBegin((yyvsp[0]._int)); }
+#line 3280 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 171: /* defPins: PINS_K integer $@21 ';' defPinList END_K PINS_K  */
+#line 793 "/root/repo/src/defin/def.ypp"
+                                                                             { pinR->pinsEnd(); }
+#line 3286 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 174: /* $@22: %empty  */
+#line 802 "/root/repo/src/defin/def.ypp"
+                                   { pinR->pinBegin( *(yyvsp[-3]._token), *(yyvsp[0]._token) ); }
+#line 3292 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 175: /* defPin: '-' ident '+' NET_K ident $@22 defPinOpts ';'  */
+#line 803 "/root/repo/src/defin/def.ypp"
+         {
+             pinR->pinEnd();
+             release((yyvsp[-6]._token));
+             release((yyvsp[-3]._token));
+         }
+#line 3302 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 178: /* defPinOpt: '+' SPECIAL_K  */
+#line 816 "/root/repo/src/defin/def.ypp"
+                        { pinR->pinSpecial(); }
+#line 3308 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 181: /* defPinOpt: '+' NETEXPR_K qstring  */
+#line 819 "/root/repo/src/defin/def.ypp"
+                               { release((yyvsp[0]._token)); }
+#line 3314 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 182: /* defPinOpt: '+' SUPPLYSENSITIVITY_K ident  */
+#line 820 "/root/repo/src/defin/def.ypp"
+                                       { pinR->pinSupplyPin(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 3320 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 183: /* defPinOpt: '+' GROUNDSENSITIVITY_K ident  */
+#line 821 "/root/repo/src/defin/def.ypp"
+                                       { pinR->pinGroundPin(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 3326 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 190: /* defPinOpt: '+' ANTENNAPINMAXAREACAR_K number LAYER_K ident  */
+#line 828 "/root/repo/src/defin/def.ypp"
+                                                                    { release((yyvsp[0]._token)); }
+#line 3332 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 191: /* defPinOpt: '+' ANTENNAPINMAXSIDEAREACAR_K number LAYER_K ident  */
+#line 829 "/root/repo/src/defin/def.ypp"
+                                                                    { release((yyvsp[0]._token)); }
+#line 3338 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 192: /* defPinOpt: '+' ANTENNAPINMAXCUTCAR_K number LAYER_K ident  */
+#line 830 "/root/repo/src/defin/def.ypp"
+                                                                    { release((yyvsp[0]._token)); }
+#line 3344 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 194: /* defPinOpt: '+' LAYER_K ident defPinGeomOpt point point  */
+#line 832 "/root/repo/src/defin/def.ypp"
+                                                     { pinR->pinRect( *(yyvsp[-3]._token), (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (yyvsp[0]._point)._x, (yyvsp[0]._point)._y ); release((yyvsp[-3]._token)); }
+#line 3350 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 195: /* defPinOpt: '+' POLYGON_K ident defPinGeomOpt defPointList  */
+#line 833 "/root/repo/src/defin/def.ypp"
+                                                        { pinR->pinPolygon( *(yyvsp[0]._points) ); delete (yyvsp[0]._points); release((yyvsp[-2]._token)); }
+#line 3356 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 196: /* defPinOpt: '+' COVER_K point defOrient  */
+#line 834 "/root/repo/src/defin/def.ypp"
+                                       { pinR->pinPlacement( DEF_PLACEMENT_COVER, (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (defOrient) (yyvsp[0]._tid) ); }
+#line 3362 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 197: /* defPinOpt: '+' FIXED_K point defOrient  */
+#line 835 "/root/repo/src/defin/def.ypp"
+                                       { pinR->pinPlacement( DEF_PLACEMENT_FIXED, (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (defOrient) (yyvsp[0]._tid) ); }
+#line 3368 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 198: /* defPinOpt: '+' PLACED_K point defOrient  */
+#line 836 "/root/repo/src/defin/def.ypp"
+                                       { pinR->pinPlacement( DEF_PLACEMENT_PLACED, (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (defOrient) (yyvsp[0]._tid) ); }
+#line 3374 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 200: /* defPinGeomOpt: SPACING_K NUM_INT  */
+#line 841 "/root/repo/src/defin/def.ypp"
+                        { pinR->pinMinSpacing((yyvsp[0]._int)); }
+#line 3380 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 201: /* defPinGeomOpt: DESIGNRULEWIDTH_K NUM_INT  */
+#line 842 "/root/repo/src/defin/def.ypp"
+                                { pinR->pinEffectiveWidth((yyvsp[0]._int)); }
+#line 3386 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 202: /* defPinDirection: INPUT_K  */
+#line 846 "/root/repo/src/defin/def.ypp"
+                    { pinR->pinDirection( DEF_IO_INPUT ); }
+#line 3392 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 203: /* defPinDirection: OUTPUT_K  */
+#line 847 "/root/repo/src/defin/def.ypp"
+                    { pinR->pinDirection( DEF_IO_OUTPUT ); }
+#line 3398 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 204: /* defPinDirection: INOUT_K  */
+#line 848 "/root/repo/src/defin/def.ypp"
+                    { pinR->pinDirection( DEF_IO_INOUT ); }
+#line 3404 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 205: /* defPinDirection: FEEDTHRU_K  */
+#line 849 "/root/repo/src/defin/def.ypp"
+                    { pinR->pinDirection( DEF_IO_FEEDTHRU ); }
+#line 3410 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 206: /* defPinUse: ANALOG_K  */
+#line 853 "/root/repo/src/defin/def.ypp"
+                  { pinR->pinUse( DEF_SIG_ANALOG ); }
+#line 3416 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 207: /* defPinUse: CLOCK_K  */
+#line 854 "/root/repo/src/defin/def.ypp"
+                  { pinR->pinUse( DEF_SIG_CLOCK ); }
+#line 3422 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 208: /* defPinUse: GROUND_K  */
+#line 855 "/root/repo/src/defin/def.ypp"
+                  { pinR->pinUse( DEF_SIG_GROUND ); }
+#line 3428 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 209: /* defPinUse: POWER_K  */
+#line 856 "/root/repo/src/defin/def.ypp"
+                  { pinR->pinUse( DEF_SIG_POWER ); }
+#line 3434 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 210: /* defPinUse: RESET_K  */
+#line 857 "/root/repo/src/defin/def.ypp"
+                  { pinR->pinUse( DEF_SIG_RESET ); }
+#line 3440 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 211: /* defPinUse: SCAN_K  */
+#line 858 "/root/repo/src/defin/def.ypp"
+                  { pinR->pinUse( DEF_SIG_SCAN ); }
+#line 3446 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 212: /* defPinUse: SIGNAL_K  */
+#line 859 "/root/repo/src/defin/def.ypp"
+                  { pinR->pinUse( DEF_SIG_SIGNAL ); }
+#line 3452 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 213: /* defPinUse: TIEOFF_K  */
+#line 860 "/root/repo/src/defin/def.ypp"
+                  { pinR->pinUse( DEF_SIG_TIEOFF ); }
+#line 3458 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 219: /* defPinLayerOpt: LAYER_K ident  */
+#line 869 "/root/repo/src/defin/def.ypp"
+                       { release((yyvsp[0]._token)); }
+#line 3464 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 223: /* $@23: %empty  */
+#line 883 "/root/repo/src/defin/def.ypp"
+         {
+             pin_propsR->begin( *(yyvsp[-1]._token), *(yyvsp[0]._token));
+             release((yyvsp[-1]._token));
+             release((yyvsp[0]._token));
+         }
+#line 3474 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 224: /* defPinProperty: '-' ident ident $@23 defPinPropertyValues ';'  */
+#line 889 "/root/repo/src/defin/def.ypp"
+         {
+             pin_propsR->end();
+         }
+#line 3482 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 226: /* defPinPropertyValues: defPinPropertyValues '+' defProperty  */
+#line 896 "/root/repo/src/defin/def.ypp"
+                                              { addComponentPinProps((yyvsp[0]._props)); }
+#line 3488 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 230: /* $@24: %empty  */
+#line 909 "/root/repo/src/defin/def.ypp"
+                           { blockageR->blockageRoutingBegin(*(yyvsp[0]._token)); }
+#line 3494 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 231: /* defBlockage: '-' LAYER_K ident $@24 defBlockageRoutingOpts defBlockageRoutingGeoms ';'  */
+#line 910 "/root/repo/src/defin/def.ypp"
+         { 
+             blockageR->blockageRoutingEnd();
+             release((yyvsp[-4]._token)); 
+         }
+#line 3503 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 232: /* $@25: %empty  */
+#line 914 "/root/repo/src/defin/def.ypp"
+                         { blockageR->blockagePlacementBegin(); }
+#line 3509 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 233: /* defBlockage: '-' PLACEMENT_K $@25 defBlockagePlacementOpts defBlockagePlacementRects ';'  */
+#line 915 "/root/repo/src/defin/def.ypp"
+         { 
+             blockageR->blockagePlacementEnd();
+         }
+#line 3517 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 236: /* defBlockageRoutingOpt: '+' COMPONENT_K ident  */
+#line 926 "/root/repo/src/defin/def.ypp"
+                               { blockageR->blockageRoutingComponent(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 3523 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 237: /* defBlockageRoutingOpt: '+' SLOTS_K  */
+#line 927 "/root/repo/src/defin/def.ypp"
+                               { blockageR->blockageRoutingSlots(); }
+#line 3529 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 238: /* defBlockageRoutingOpt: '+' FILLS_K  */
+#line 928 "/root/repo/src/defin/def.ypp"
+                               { blockageR->blockageRoutingFills(); }
+#line 3535 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 239: /* defBlockageRoutingOpt: '+' PUSHDOWN_K  */
+#line 929 "/root/repo/src/defin/def.ypp"
+                               { blockageR->blockageRoutingPushdown(); }
+#line 3541 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 240: /* defBlockageRoutingOpt: '+' SPACING_K NUM_INT  */
+#line 930 "/root/repo/src/defin/def.ypp"
+                                { blockageR->blockageRoutingMinSpacing((yyvsp[0]._int)); }
+#line 3547 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 241: /* defBlockageRoutingOpt: '+' DESIGNRULEWIDTH_K NUM_INT  */
+#line 931 "/root/repo/src/defin/def.ypp"
+                                        { blockageR->blockageRoutingEffectiveWidth((yyvsp[0]._int)); }
+#line 3553 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 244: /* defBlockageRoutingGeom: RECT_K point point  */
+#line 940 "/root/repo/src/defin/def.ypp"
+                                        { blockageR->blockageRoutingRect( (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (yyvsp[0]._point)._x, (yyvsp[0]._point)._y ); }
+#line 3559 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 245: /* defBlockageRoutingGeom: POLYGON_K defPointList  */
+#line 941 "/root/repo/src/defin/def.ypp"
+                                 { blockageR->blockageRoutingPolygon( *(yyvsp[0]._points) ); delete (yyvsp[0]._points); }
+#line 3565 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 246: /* defPointList: '(' integer integer ')'  */
+#line 946 "/root/repo/src/defin/def.ypp"
+      { 
+          (yyval._points) = new std::vector<defPoint>; 
+          cur_point._x = (yyvsp[-2]._int);
+          cur_point._y = (yyvsp[-1]._int);
+          (yyval._points)->push_back( cur_point );
+      }
+#line 3576 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 247: /* defPointList: defPointList defPoint  */
+#line 952 "/root/repo/src/defin/def.ypp"
+                            { (yyvsp[-1]._points)->push_back( cur_point ); (yyval._points) = (yyvsp[-1]._points); }
+#line 3582 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 248: /* defPoint: '(' integer integer ')'  */
+#line 956 "/root/repo/src/defin/def.ypp"
+                                 { cur_point._x = (yyvsp[-2]._int); cur_point._y = (yyvsp[-1]._int); }
+#line 3588 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 249: /* defPoint: '(' '*' integer ')'  */
+#line 957 "/root/repo/src/defin/def.ypp"
+                                 { cur_point._y = (yyvsp[-1]._int); }
+#line 3594 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 250: /* defPoint: '(' integer '*' ')'  */
+#line 958 "/root/repo/src/defin/def.ypp"
+                                 { cur_point._x = (yyvsp[-2]._int); }
+#line 3600 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 251: /* defPoint: '(' '*' '*' ')'  */
+#line 959 "/root/repo/src/defin/def.ypp"
+                                 { }
+#line 3606 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 254: /* defBlockagePlacementOpt: '+' COMPONENT_K ident  */
+#line 968 "/root/repo/src/defin/def.ypp"
+                               { blockageR->blockagePlacementComponent(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 3612 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 255: /* defBlockagePlacementOpt: '+' PUSHDOWN_K  */
+#line 969 "/root/repo/src/defin/def.ypp"
+                               { blockageR->blockagePlacementPushdown(); }
+#line 3618 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 256: /* defBlockagePlacementRects: RECT_K point point  */
+#line 973 "/root/repo/src/defin/def.ypp"
+                                                    { blockageR->blockagePlacementRect( (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (yyvsp[0]._point)._x, (yyvsp[0]._point)._y ); }
+#line 3624 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 257: /* defBlockagePlacementRects: defBlockageRoutingGeoms RECT_K point point  */
+#line 974 "/root/repo/src/defin/def.ypp"
+                                                    { blockageR->blockagePlacementRect( (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (yyvsp[0]._point)._x, (yyvsp[0]._point)._y ); }
+#line 3630 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 261: /* defSlot: '-' LAYER_K ident defSlotGeoms ';'  */
+#line 987 "/root/repo/src/defin/def.ypp"
+                                            { release((yyvsp[-2]._token)); }
+#line 3636 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 265: /* defSlotGeom: POLYGON_K defPointList  */
+#line 997 "/root/repo/src/defin/def.ypp"
+                                { delete (yyvsp[0]._points); }
+#line 3642 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 269: /* $@26: %empty  */
+#line 1010 "/root/repo/src/defin/def.ypp"
+                           { fillR->fillBegin(*(yyvsp[0]._token)); }
+#line 3648 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 270: /* defFill: '-' LAYER_K ident $@26 defFillGeoms ';'  */
+#line 1010 "/root/repo/src/defin/def.ypp"
+                                                                       { fillR->fillEnd(); release((yyvsp[-3]._token)); }
+#line 3654 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 273: /* defFillGeom: RECT_K point point  */
+#line 1019 "/root/repo/src/defin/def.ypp"
+                            { fillR->fillRect( (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (yyvsp[0]._point)._x, (yyvsp[0]._point)._y ); }
+#line 3660 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 274: /* defFillGeom: POLYGON_K defPointList  */
+#line 1020 "/root/repo/src/defin/def.ypp"
+                                { fillR->fillPolygon(*(yyvsp[0]._points)); delete (yyvsp[0]._points); }
+#line 3666 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 278: /* $@27: %empty  */
+#line 1033 "/root/repo/src/defin/def.ypp"
+                   { snetR->begin(*(yyvsp[0]._token)); }
+#line 3672 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 279: /* defSpecialNet: '-' ident $@27 defSpecialNetConnections defSpecialNetOpts ';'  */
+#line 1033 "/root/repo/src/defin/def.ypp"
+                                                                                         { snetR->end(); release((yyvsp[-4]._token)); }
+#line 3678 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 282: /* defSpecialNetConnection: ident ident  */
+#line 1042 "/root/repo/src/defin/def.ypp"
+                                         { snetR->connection(*(yyvsp[-1]._token),*(yyvsp[0]._token), false); release((yyvsp[-1]._token)); release((yyvsp[0]._token)); }
+#line 3684 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 283: /* defSpecialNetConnection: ident ident '+' SYNTHESIZED_K  */
+#line 1043 "/root/repo/src/defin/def.ypp"
+                                         { snetR->connection(*(yyvsp[-3]._token),*(yyvsp[-2]._token), true); release((yyvsp[-3]._token)); release((yyvsp[-2]._token)); }
+#line 3690 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 284: /* defSpecialNetConnection: '*' ident  */
+#line 1044 "/root/repo/src/defin/def.ypp"
+                                         { snetR->connection("*",*(yyvsp[0]._token), false); release((yyvsp[0]._token)); }
+#line 3696 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 285: /* defSpecialNetConnection: '*' ident '+' SYNTHESIZED_K  */
+#line 1045 "/root/repo/src/defin/def.ypp"
+                                         { snetR->connection("*",*(yyvsp[-2]._token), true); release((yyvsp[-2]._token)); }
+#line 3702 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 290: /* defSpecialNetOpt: '+' SOURCE_K defSpecialNetSource  */
+#line 1056 "/root/repo/src/defin/def.ypp"
+                                          { snetR->source( (defSource) (yyvsp[0]._int)) ;}
+#line 3708 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 291: /* defSpecialNetOpt: '+' FIXEDBUMP_K  */
+#line 1057 "/root/repo/src/defin/def.ypp"
+                         { snetR->fixedbump(); }
+#line 3714 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 292: /* defSpecialNetOpt: '+' ORIGINAL_K ident  */
+#line 1058 "/root/repo/src/defin/def.ypp"
+                              { release((yyvsp[0]._token)); }
+#line 3720 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 296: /* defSpecialNetOpt: '+' WEIGHT_K NUM_INT  */
+#line 1062 "/root/repo/src/defin/def.ypp"
+                              { snetR->weight((yyvsp[0]._int)); }
+#line 3726 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 297: /* defSpecialNetOpt: '+' defProperty  */
+#line 1063 "/root/repo/src/defin/def.ypp"
+                         { addSNetProps((yyvsp[0]._props)); }
+#line 3732 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 298: /* defSpecialNetSource: DIST_K  */
+#line 1067 "/root/repo/src/defin/def.ypp"
+                 { (yyval._int) = DEF_DIST; }
+#line 3738 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 299: /* defSpecialNetSource: NETLIST_K  */
+#line 1068 "/root/repo/src/defin/def.ypp"
+                 { (yyval._int) = DEF_NETLIST; }
+#line 3744 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 300: /* defSpecialNetSource: TIMING_K  */
+#line 1069 "/root/repo/src/defin/def.ypp"
+                 { (yyval._int) = DEF_TIMING; }
+#line 3750 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 301: /* defSpecialNetSource: USER_K  */
+#line 1070 "/root/repo/src/defin/def.ypp"
+                 { (yyval._int) = DEF_USER; }
+#line 3756 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 302: /* defSpecialNetUse: ANALOG_K  */
+#line 1074 "/root/repo/src/defin/def.ypp"
+                  { snetR->use( DEF_SIG_ANALOG ); }
+#line 3762 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 303: /* defSpecialNetUse: CLOCK_K  */
+#line 1075 "/root/repo/src/defin/def.ypp"
+                  { snetR->use( DEF_SIG_CLOCK ); }
+#line 3768 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 304: /* defSpecialNetUse: GROUND_K  */
+#line 1076 "/root/repo/src/defin/def.ypp"
+                  { snetR->use( DEF_SIG_GROUND ); }
+#line 3774 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 305: /* defSpecialNetUse: POWER_K  */
+#line 1077 "/root/repo/src/defin/def.ypp"
+                  { snetR->use( DEF_SIG_POWER ); }
+#line 3780 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 306: /* defSpecialNetUse: RESET_K  */
+#line 1078 "/root/repo/src/defin/def.ypp"
+                  { snetR->use( DEF_SIG_RESET ); }
+#line 3786 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 307: /* defSpecialNetUse: SCAN_K  */
+#line 1079 "/root/repo/src/defin/def.ypp"
+                  { snetR->use( DEF_SIG_SCAN ); }
+#line 3792 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 308: /* defSpecialNetUse: SIGNAL_K  */
+#line 1080 "/root/repo/src/defin/def.ypp"
+                  { snetR->use( DEF_SIG_SIGNAL ); }
+#line 3798 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 309: /* defSpecialNetUse: TIEOFF_K  */
+#line 1081 "/root/repo/src/defin/def.ypp"
+                  { snetR->use( DEF_SIG_TIEOFF ); }
+#line 3804 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 314: /* $@28: %empty  */
+#line 1089 "/root/repo/src/defin/def.ypp"
+                        { snetR->wire( DEF_WIRE_COVER, NULL ); skipSNetWire( DEF_WIRE_COVER ); }
+#line 3810 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 315: /* defSpecialNetWiring: COVER_K $@28 defSpecialNetWirePaths  */
+#line 1089 "/root/repo/src/defin/def.ypp"
+                                                                                                                          { snetR->wireEnd(); }
+#line 3816 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 316: /* $@29: %empty  */
+#line 1090 "/root/repo/src/defin/def.ypp"
+                        { snetR->wire( DEF_WIRE_FIXED, NULL ); skipSNetWire( DEF_WIRE_FIXED ); }
+#line 3822 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 317: /* defSpecialNetWiring: FIXED_K $@29 defSpecialNetWirePaths  */
+#line 1090 "/root/repo/src/defin/def.ypp"
+                                                                                                                          { snetR->wireEnd(); }
+#line 3828 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 318: /* $@30: %empty  */
+#line 1091 "/root/repo/src/defin/def.ypp"
+                        { snetR->wire( DEF_WIRE_ROUTED, NULL ); skipSNetWire( DEF_WIRE_ROUTED ); }
+#line 3834 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 319: /* defSpecialNetWiring: ROUTED_K $@30 defSpecialNetWirePaths  */
+#line 1091 "/root/repo/src/defin/def.ypp"
+                                                                                                                           { snetR->wireEnd(); }
+#line 3840 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 320: /* $@31: %empty  */
+#line 1092 "/root/repo/src/defin/def.ypp"
+                        { snetR->wire( DEF_WIRE_SHIELD, *(yyvsp[0]._token) ); skipSNetWire( DEF_WIRE_SHIELD ); }
+#line 3846 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 321: /* defSpecialNetWiring: SHIELD_K ident $@31 defSpecialNetWirePaths  */
+#line 1092 "/root/repo/src/defin/def.ypp"
+                                                                                                                           { snetR->wireEnd(); release((yyvsp[-2]._token)); }
+#line 3852 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 322: /* defSpecialNetWiring: RECT_K ident point point  */
+#line 1093 "/root/repo/src/defin/def.ypp"
+                                  { snetR->rect( *(yyvsp[-2]._token), (yyvsp[-1]._point)._x, (yyvsp[-1]._point)._y, (yyvsp[0]._point)._x, (yyvsp[0]._point)._y ); release((yyvsp[-2]._token)); }
+#line 3858 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 323: /* defSpecialNetWiring: POLYGON_K ident defPointList  */
+#line 1094 "/root/repo/src/defin/def.ypp"
+                                      { snetR->polygon( *(yyvsp[-1]._token), *(yyvsp[0]._points) ); release((yyvsp[-1]._token)); delete (yyvsp[0]._points); }
+#line 3864 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 328: /* $@32: %empty  */
+#line 1108 "/root/repo/src/defin/def.ypp"
+                       { snetR->path( *(yyvsp[-1]._token), (yyvsp[0]._int) ); }
+#line 3870 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 329: /* defSpecialNetPath: ident integer $@32 defSpecialNetWireShapeOpts defSpecialNetPathPoints  */
+#line 1109 "/root/repo/src/defin/def.ypp"
+             { snetR->pathEnd(); deflex_kid = 0; release((yyvsp[-4]._token)); }
+#line 3876 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 332: /* defSpecialNetWireShapeOpt: '+' SHAPE_K ident  */
+#line 1119 "/root/repo/src/defin/def.ypp"
+                           { snetR->pathShape( *(yyvsp[0]._token) ); release((yyvsp[0]._token)); }
+#line 3882 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 333: /* defSpecialNetWireShapeOpt: '+' STYLE_K integer  */
+#line 1120 "/root/repo/src/defin/def.ypp"
+                             { snetR->pathStyle( (yyvsp[0]._int) ); }
+#line 3888 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 334: /* defSpecialNetPathPoints: '(' integer integer ')'  */
+#line 1124 "/root/repo/src/defin/def.ypp"
+                                 { cur_x = (yyvsp[-2]._int); cur_y = (yyvsp[-1]._int); snetR->pathPoint( cur_x, cur_y ); deflex_kid = SNET_PATH_ID; }
+#line 3894 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 335: /* defSpecialNetPathPoints: '(' integer integer integer ')'  */
+#line 1125 "/root/repo/src/defin/def.ypp"
+                                         { cur_x = (yyvsp[-3]._int); cur_y = (yyvsp[-2]._int); snetR->pathPoint( cur_x, cur_y, (yyvsp[-1]._int) ); deflex_kid = SNET_PATH_ID; }
+#line 3900 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 337: /* defSpecialNetPathPoint: '(' integer integer ')'  */
+#line 1130 "/root/repo/src/defin/def.ypp"
+                                 { cur_x = (yyvsp[-2]._int); cur_y = (yyvsp[-1]._int); snetR->pathPoint( cur_x, cur_y ); }
+#line 3906 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 338: /* defSpecialNetPathPoint: '(' '*' integer ')'  */
+#line 1131 "/root/repo/src/defin/def.ypp"
+                                 { cur_y = (yyvsp[-1]._int); snetR->pathPoint( cur_x, cur_y ); }
+#line 3912 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 339: /* defSpecialNetPathPoint: '(' integer '*' ')'  */
+#line 1132 "/root/repo/src/defin/def.ypp"
+                                 { cur_x = (yyvsp[-2]._int); snetR->pathPoint( cur_x, cur_y ); }
+#line 3918 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 340: /* defSpecialNetPathPoint: '(' '*' '*' ')'  */
+#line 1133 "/root/repo/src/defin/def.ypp"
+                                 { deferror("illegal colinear point"); }
+#line 3924 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 341: /* defSpecialNetPathPoint: '(' integer integer integer ')'  */
+#line 1134 "/root/repo/src/defin/def.ypp"
+                                         { cur_x = (yyvsp[-3]._int); cur_y = (yyvsp[-2]._int); snetR->pathPoint( cur_x, cur_y, (yyvsp[-1]._int) ); }
+#line 3930 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 342: /* defSpecialNetPathPoint: '(' '*' integer integer ')'  */
+#line 1135 "/root/repo/src/defin/def.ypp"
+                                         { cur_y = (yyvsp[-2]._int); snetR->pathPoint( cur_x, cur_y, (yyvsp[-1]._int) ); }
+#line 3936 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 343: /* defSpecialNetPathPoint: '(' integer '*' integer ')'  */
+#line 1136 "/root/repo/src/defin/def.ypp"
+                                         { cur_x = (yyvsp[-3]._int); snetR->pathPoint( cur_x, cur_y, (yyvsp[-1]._int) ); }
+#line 3942 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 344: /* defSpecialNetPathPoint: '(' '*' '*' integer ')'  */
+#line 1137 "/root/repo/src/defin/def.ypp"
+                                         { deferror("illegal colinear point"); }
+#line 3948 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 345: /* defSpecialNetPathPoint: ident  */
+#line 1138 "/root/repo/src/defin/def.ypp"
+                                 { snetR->pathVia( *(yyvsp[0]._token) ); release((yyvsp[0]._token)); }
+#line 3954 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 346: /* $@33: %empty  */
+#line 1139 "/root/repo/src/defin/def.ypp"
+                    { deflex_kid = 0; }
+#line 3960 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 347: /* $@34: %empty  */
+#line 1139 "/root/repo/src/defin/def.ypp"
+                                                                    { deflex_kid = SNET_PATH_ID;}
+#line 3966 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 348: /* defSpecialNetPathPoint: ident DO_K $@33 integer BY_K integer STEP_K $@34 integer integer  */
+#line 1140 "/root/repo/src/defin/def.ypp"
+         {
+             snetR->pathViaArray( *(yyvsp[-9]._token), (yyvsp[-6]._int), (yyvsp[-4]._int), (yyvsp[-1]._int), (yyvsp[0]._int) );
+             release((yyvsp[-9]._token));
+         }
+#line 3975 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 352: /* $@35: %empty  */
+#line 1156 "/root/repo/src/defin/def.ypp"
+             { deflex_kid = NET_ID; }
+#line 3981 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 353: /* $@36: %empty  */
+#line 1156 "/root/repo/src/defin/def.ypp"
+                                                   { deflex_kid = 0; }
+#line 3987 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 354: /* $@37: %empty  */
+#line 1156 "/root/repo/src/defin/def.ypp"
+                                                                                           { netR->beginMustjoin( *(yyvsp[-2]._token), *(yyvsp[-1]._token) ); }
+#line 3993 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 355: /* defNet: '-' $@35 MUSTJOIN_K $@36 '(' ident ident ')' $@37 defNetOpts ';'  */
+#line 1157 "/root/repo/src/defin/def.ypp"
+         {
+             netR->end();
+             release((yyvsp[-5]._token));
+             release((yyvsp[-4]._token));
+         }
+#line 4003 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 356: /* $@38: %empty  */
+#line 1162 "/root/repo/src/defin/def.ypp"
+             { deflex_kid = NET_ID; }
+#line 4009 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 357: /* $@39: %empty  */
+#line 1162 "/root/repo/src/defin/def.ypp"
+                                             { deflex_kid = 0; netR->begin(*(yyvsp[0]._token)); }
+#line 4015 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 358: /* defNet: '-' $@38 ident $@39 defNetConnections defNetOpts ';'  */
+#line 1163 "/root/repo/src/defin/def.ypp"
+         {
+             netR->end();
+             release((yyvsp[-4]._token));
+         }
+#line 4024 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 361: /* defNetConnection: '(' ident ident ')'  */
+#line 1176 "/root/repo/src/defin/def.ypp"
+         {
+             netR->connection( *(yyvsp[-2]._token), *(yyvsp[-1]._token) );
+             release((yyvsp[-2]._token));
+             release((yyvsp[-1]._token));
+         }
+#line 4034 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 362: /* defNetConnection: '(' ident ident '+' SYNTHESIZED_K ')'  */
+#line 1182 "/root/repo/src/defin/def.ypp"
+         {
+             netR->connection( *(yyvsp[-4]._token), *(yyvsp[-3]._token) );
+             release((yyvsp[-4]._token));
+             release((yyvsp[-3]._token));
+         }
+#line 4044 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 365: /* defNetOpt: '+' SHIELDNET_K ident  */
+#line 1195 "/root/repo/src/defin/def.ypp"
+                               { release((yyvsp[0]._token)); }
+#line 4050 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 368: /* defNetOpt: '+' XTALK_K NUM_INT  */
+#line 1198 "/root/repo/src/defin/def.ypp"
+                             { netR->xtalk((yyvsp[0]._int)); }
+#line 4056 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 369: /* defNetOpt: '+' NONDEFAULTRULE_K ident  */
+#line 1199 "/root/repo/src/defin/def.ypp"
+                                    { netR->nonDefaultRule(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 4062 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 371: /* defNetOpt: '+' SOURCE_K defNetSource  */
+#line 1201 "/root/repo/src/defin/def.ypp"
+                                   { netR->source((defSource)(yyvsp[0]._int)); }
+#line 4068 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 372: /* defNetOpt: '+' FIXEDBUMP_K  */
+#line 1202 "/root/repo/src/defin/def.ypp"
+                         { netR->fixedbump(); }
+#line 4074 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 374: /* defNetOpt: '+' ORIGINAL_K ident  */
+#line 1204 "/root/repo/src/defin/def.ypp"
+                              { release((yyvsp[0]._token)); }
+#line 4080 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 378: /* defNetOpt: '+' WEIGHT_K NUM_INT  */
+#line 1208 "/root/repo/src/defin/def.ypp"
+                              { netR->weight((yyvsp[0]._int)); }
+#line 4086 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 379: /* defNetOpt: '+' defProperty  */
+#line 1209 "/root/repo/src/defin/def.ypp"
+                         { addNetProps((yyvsp[0]._props)); }
+#line 4092 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 380: /* defNetSource: DIST_K  */
+#line 1213 "/root/repo/src/defin/def.ypp"
+                { (yyval._int) = DEF_DIST; }
+#line 4098 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 381: /* defNetSource: NETLIST_K  */
+#line 1214 "/root/repo/src/defin/def.ypp"
+                { (yyval._int) = DEF_NETLIST; }
+#line 4104 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 382: /* defNetSource: TEST_K  */
+#line 1215 "/root/repo/src/defin/def.ypp"
+                { (yyval._int) = DEF_TEST; }
+#line 4110 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 383: /* defNetSource: TIMING_K  */
+#line 1216 "/root/repo/src/defin/def.ypp"
+                { (yyval._int) = DEF_TIMING; }
+#line 4116 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 384: /* defNetSource: USER_K  */
+#line 1217 "/root/repo/src/defin/def.ypp"
+                { (yyval._int) = DEF_USER; }
+#line 4122 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 385: /* defNetUse: ANALOG_K  */
+#line 1221 "/root/repo/src/defin/def.ypp"
+                  { netR->use( DEF_SIG_ANALOG ); }
+#line 4128 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 386: /* defNetUse: CLOCK_K  */
+#line 1222 "/root/repo/src/defin/def.ypp"
+                  { netR->use( DEF_SIG_CLOCK ); }
+#line 4134 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 387: /* defNetUse: GROUND_K  */
+#line 1223 "/root/repo/src/defin/def.ypp"
+                  { netR->use( DEF_SIG_GROUND ); }
+#line 4140 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 388: /* defNetUse: POWER_K  */
+#line 1224 "/root/repo/src/defin/def.ypp"
+                  { netR->use( DEF_SIG_POWER ); }
+#line 4146 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 389: /* defNetUse: RESET_K  */
+#line 1225 "/root/repo/src/defin/def.ypp"
+                  { netR->use( DEF_SIG_RESET ); }
+#line 4152 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 390: /* defNetUse: SCAN_K  */
+#line 1226 "/root/repo/src/defin/def.ypp"
+                  { netR->use( DEF_SIG_SCAN ); }
+#line 4158 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 391: /* defNetUse: SIGNAL_K  */
+#line 1227 "/root/repo/src/defin/def.ypp"
+                  { netR->use( DEF_SIG_SIGNAL ); }
+#line 4164 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 392: /* defNetUse: TIEOFF_K  */
+#line 1228 "/root/repo/src/defin/def.ypp"
+                  { netR->use( DEF_SIG_TIEOFF ); }
+#line 4170 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 397: /* $@40: %empty  */
+#line 1236 "/root/repo/src/defin/def.ypp"
+                    { netR->wire( DEF_WIRE_COVER ); skipNetWire(); }
+#line 4176 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 398: /* defNetWire: COVER_K $@40 defNetWirePaths  */
+#line 1236 "/root/repo/src/defin/def.ypp"
+                                                                                        { netR->wireEnd(); }
+#line 4182 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 399: /* $@41: %empty  */
+#line 1237 "/root/repo/src/defin/def.ypp"
+                    { netR->wire( DEF_WIRE_FIXED ); skipNetWire(); }
+#line 4188 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 400: /* defNetWire: FIXED_K $@41 defNetWirePaths  */
+#line 1237 "/root/repo/src/defin/def.ypp"
+                                                                                        { netR->wireEnd(); }
+#line 4194 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 401: /* $@42: %empty  */
+#line 1238 "/root/repo/src/defin/def.ypp"
+                    { netR->wire( DEF_WIRE_ROUTED ); skipNetWire(); }
+#line 4200 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 402: /* defNetWire: ROUTED_K $@42 defNetWirePaths  */
+#line 1238 "/root/repo/src/defin/def.ypp"
+                                                                                        { netR->wireEnd(); }
+#line 4206 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 403: /* $@43: %empty  */
+#line 1239 "/root/repo/src/defin/def.ypp"
+                    { netR->wire( DEF_WIRE_NOSHIELD ); skipNetWire(); }
+#line 4212 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 404: /* defNetWire: NOSHIELD_K $@43 defNetWirePaths  */
+#line 1239 "/root/repo/src/defin/def.ypp"
+                                                                                        { netR->wireEnd(); }
+#line 4218 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 409: /* $@44: %empty  */
+#line 1253 "/root/repo/src/defin/def.ypp"
+                                                 { netR->path( *(yyvsp[0]._token) ); }
+#line 4224 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 410: /* defNetPath: ident $@44 defNetPathPoints  */
+#line 1253 "/root/repo/src/defin/def.ypp"
+                                                                                                                               { netR->pathEnd(); deflex_kid = 0; release((yyvsp[-2]._token)); }
+#line 4230 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 411: /* $@45: %empty  */
+#line 1254 "/root/repo/src/defin/def.ypp"
+                                                 { netR->pathTaper( *(yyvsp[-1]._token) ); }
+#line 4236 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 412: /* defNetPath: ident TAPER_K $@45 defNetPathPoints  */
+#line 1254 "/root/repo/src/defin/def.ypp"
+                                                                                                                               { netR->pathEnd(); deflex_kid = 0; release((yyvsp[-3]._token)); }
+#line 4242 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 413: /* $@46: %empty  */
+#line 1255 "/root/repo/src/defin/def.ypp"
+                                                 { netR->pathTaperRule( *(yyvsp[-2]._token), *(yyvsp[0]._token) ); }
+#line 4248 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 414: /* defNetPath: ident TAPERRULE_K ident $@46 defNetPathPoints  */
+#line 1255 "/root/repo/src/defin/def.ypp"
+                                                                                                                               { netR->pathEnd(); deflex_kid = 0; release((yyvsp[-4]._token)); release((yyvsp[-2]._token)); }
+#line 4254 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 415: /* $@47: %empty  */
+#line 1256 "/root/repo/src/defin/def.ypp"
+                                                 { netR->path( *(yyvsp[-2]._token) ); netR->pathStyle((yyvsp[0]._int)); }
+#line 4260 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 416: /* defNetPath: ident STYLE_K integer $@47 defNetPathPoints  */
+#line 1256 "/root/repo/src/defin/def.ypp"
+                                                                                                                            { netR->pathEnd(); deflex_kid = 0; release((yyvsp[-4]._token)); }
+#line 4266 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 417: /* $@48: %empty  */
+#line 1257 "/root/repo/src/defin/def.ypp"
+                                                 { netR->pathTaper( *(yyvsp[-3]._token) );  netR->pathStyle((yyvsp[0]._int));}
+#line 4272 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 418: /* defNetPath: ident TAPER_K STYLE_K integer $@48 defNetPathPoints  */
+#line 1257 "/root/repo/src/defin/def.ypp"
+                                                                                                                            { netR->pathEnd(); deflex_kid = 0; release((yyvsp[-5]._token)); }
+#line 4278 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 419: /* $@49: %empty  */
+#line 1258 "/root/repo/src/defin/def.ypp"
+                                                 { netR->pathTaperRule( *(yyvsp[-4]._token), *(yyvsp[-2]._token) ); netR->pathStyle((yyvsp[0]._int)); }
+#line 4284 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 420: /* defNetPath: ident TAPERRULE_K ident STYLE_K integer $@49 defNetPathPoints  */
+#line 1258 "/root/repo/src/defin/def.ypp"
+                                                                                                                            { netR->end(); deflex_kid = 0; release((yyvsp[-6]._token)); release((yyvsp[-4]._token)); }
+#line 4290 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 421: /* defNetPathPoints: '(' integer integer ')'  */
+#line 1262 "/root/repo/src/defin/def.ypp"
+                                         { deflex_kid = NET_PATH_ID; cur_x = (yyvsp[-2]._int); cur_y = (yyvsp[-1]._int); netR->pathPoint( cur_x, cur_y ); }
+#line 4296 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 422: /* defNetPathPoints: '(' integer integer integer ')'  */
+#line 1263 "/root/repo/src/defin/def.ypp"
+                                         { deflex_kid = NET_PATH_ID; cur_x = (yyvsp[-3]._int); cur_y = (yyvsp[-2]._int); netR->pathPoint( cur_x, cur_y, (yyvsp[-1]._int) ); }
+#line 4302 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 424: /* defNetPathPoint: '(' integer integer ')'  */
+#line 1268 "/root/repo/src/defin/def.ypp"
+                                         { cur_x = (yyvsp[-2]._int); cur_y = (yyvsp[-1]._int); netR->pathPoint( cur_x, cur_y ); }
+#line 4308 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 425: /* defNetPathPoint: '(' integer integer integer ')'  */
+#line 1269 "/root/repo/src/defin/def.ypp"
+                                         { cur_x = (yyvsp[-3]._int); cur_y = (yyvsp[-2]._int); netR->pathPoint( cur_x, cur_y, (yyvsp[-1]._int) ); }
+#line 4314 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 426: /* defNetPathPoint: '(' '*' integer ')'  */
+#line 1270 "/root/repo/src/defin/def.ypp"
+                                         { cur_y = (yyvsp[-1]._int); netR->pathPoint( cur_x, cur_y ); }
+#line 4320 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 427: /* defNetPathPoint: '(' '*' integer integer ')'  */
+#line 1271 "/root/repo/src/defin/def.ypp"
+                                         { cur_y = (yyvsp[-2]._int); netR->pathPoint( cur_x, cur_y, (yyvsp[-1]._int) ); }
+#line 4326 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 428: /* defNetPathPoint: '(' integer '*' ')'  */
+#line 1272 "/root/repo/src/defin/def.ypp"
+                                         { cur_x = (yyvsp[-2]._int); netR->pathPoint( cur_x, cur_y ); }
+#line 4332 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 429: /* defNetPathPoint: '(' integer '*' integer ')'  */
+#line 1273 "/root/repo/src/defin/def.ypp"
+                                         { cur_x = (yyvsp[-3]._int); netR->pathPoint( cur_x, cur_y, (yyvsp[-1]._int) ); }
+#line 4338 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 430: /* defNetPathPoint: '(' '*' '*' ')'  */
+#line 1274 "/root/repo/src/defin/def.ypp"
+                                         { netR->pathPoint( cur_x, cur_y ); }
+#line 4344 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 431: /* defNetPathPoint: '(' '*' '*' integer ')'  */
+#line 1275 "/root/repo/src/defin/def.ypp"
+                                         { netR->pathPoint( cur_x, cur_y, (yyvsp[-1]._int) ); }
+#line 4350 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 432: /* defNetPathPoint: ident  */
+#line 1276 "/root/repo/src/defin/def.ypp"
+                                         { netR->pathVia(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 4356 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 433: /* defNetPathPoint: ident defOrient  */
+#line 1277 "/root/repo/src/defin/def.ypp"
+                                         { netR->pathVia(*(yyvsp[-1]._token),(yyvsp[0]._tid)); release((yyvsp[-1]._token)); }
+#line 4362 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 434: /* defNetVPin: VPIN_K ident point point  */
+#line 1281 "/root/repo/src/defin/def.ypp"
+                                                                    { release((yyvsp[-2]._token)); }
+#line 4368 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 435: /* defNetVPin: VPIN_K ident point point defNetVPinPlacement  */
+#line 1282 "/root/repo/src/defin/def.ypp"
+                                                                    { release((yyvsp[-3]._token)); }
+#line 4374 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 436: /* defNetVPin: VPIN_K ident LAYER_K ident point point  */
+#line 1283 "/root/repo/src/defin/def.ypp"
+                                                                    { release((yyvsp[-4]._token)); release((yyvsp[-2]._token)); }
+#line 4380 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 437: /* defNetVPin: VPIN_K ident LAYER_K ident point point defNetVPinPlacement  */
+#line 1284 "/root/repo/src/defin/def.ypp"
+                                                                    { release((yyvsp[-5]._token)); release((yyvsp[-3]._token));}
+#line 4386 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 438: /* defNetVPinPlacement: PLACED_K point ident  */
+#line 1288 "/root/repo/src/defin/def.ypp"
+                               { release((yyvsp[0]._token)); }
+#line 4392 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 439: /* defNetVPinPlacement: FIXED_K point ident  */
+#line 1289 "/root/repo/src/defin/def.ypp"
+                               { release((yyvsp[0]._token)); }
+#line 4398 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 440: /* defNetVPinPlacement: COVER_K point ident  */
+#line 1290 "/root/repo/src/defin/def.ypp"
+                               { release((yyvsp[0]._token)); }
+#line 4404 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 441: /* defSubNet: SUBNET_K ident defSubNetConnections defSubNetOpts defSubNetWires  */
+#line 1294 "/root/repo/src/defin/def.ypp"
+                                                                          { release((yyvsp[-3]._token)); }
+#line 4410 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 444: /* defSubNetConnection: '(' ident ident ')'  */
+#line 1303 "/root/repo/src/defin/def.ypp"
+                             { release((yyvsp[-2]._token)); release((yyvsp[-1]._token));}
+#line 4416 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 447: /* defSubNetOpt: NONDEFAULTRULE_K ident  */
+#line 1312 "/root/repo/src/defin/def.ypp"
+                                { release((yyvsp[0]._token)); }
+#line 4422 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 450: /* $@50: %empty  */
+#line 1321 "/root/repo/src/defin/def.ypp"
+                 { skipNetWire(); }
+#line 4428 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 452: /* $@51: %empty  */
+#line 1322 "/root/repo/src/defin/def.ypp"
+                 { skipNetWire(); }
+#line 4434 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 454: /* $@52: %empty  */
+#line 1323 "/root/repo/src/defin/def.ypp"
+                  { skipNetWire(); }
+#line 4440 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 456: /* $@53: %empty  */
+#line 1324 "/root/repo/src/defin/def.ypp"
+                    { skipNetWire(); }
+#line 4446 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 462: /* defSubNetPath: ident defSubNetPathPoints  */
+#line 1338 "/root/repo/src/defin/def.ypp"
+                                                     { deflex_kid = 0; release((yyvsp[-1]._token)); }
+#line 4452 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 463: /* defSubNetPath: ident TAPER_K defSubNetPathPoints  */
+#line 1339 "/root/repo/src/defin/def.ypp"
+                                                     { deflex_kid = 0; release((yyvsp[-2]._token)); }
+#line 4458 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 464: /* defSubNetPath: ident TAPERRULE_K ident defSubNetPathPoints  */
+#line 1340 "/root/repo/src/defin/def.ypp"
+                                                     { deflex_kid = 0; release((yyvsp[-3]._token)); release((yyvsp[-1]._token)); }
+#line 4464 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 465: /* defSubNetPath: ident STYLE_K integer defSubNetPathPoints  */
+#line 1341 "/root/repo/src/defin/def.ypp"
+                                                     { deflex_kid = 0; release((yyvsp[-3]._token)); }
+#line 4470 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 466: /* defSubNetPath: ident TAPER_K STYLE_K integer defSubNetPathPoints  */
+#line 1342 "/root/repo/src/defin/def.ypp"
+                                                           { deflex_kid = 0; release((yyvsp[-4]._token)); }
+#line 4476 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 467: /* defSubNetPath: ident TAPERRULE_K ident STYLE_K integer defSubNetPathPoints  */
+#line 1343 "/root/repo/src/defin/def.ypp"
+                                                                     { deflex_kid = 0; release((yyvsp[-5]._token)); release((yyvsp[-3]._token)); }
+#line 4482 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 468: /* defSubNetPathPoints: '(' integer integer ')'  */
+#line 1347 "/root/repo/src/defin/def.ypp"
+                                         { deflex_kid = NET_PATH_ID; }
+#line 4488 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 469: /* defSubNetPathPoints: '(' integer integer integer ')'  */
+#line 1348 "/root/repo/src/defin/def.ypp"
+                                         { deflex_kid = NET_PATH_ID; }
+#line 4494 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 479: /* defSubNetPathPoint: ident  */
+#line 1361 "/root/repo/src/defin/def.ypp"
+                          { release((yyvsp[0]._token)); }
+#line 4500 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 480: /* defSubNetPathPoint: ident defOrient  */
+#line 1362 "/root/repo/src/defin/def.ypp"
+                          { release((yyvsp[-1]._token)); }
+#line 4506 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 484: /* defScanChain: '-' ident defScanChainOpts ';'  */
+#line 1375 "/root/repo/src/defin/def.ypp"
+                                         { release((yyvsp[-2]._token)); }
+#line 4512 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 487: /* defScanChainOpt: '+' PARTITION_K ident  */
+#line 1384 "/root/repo/src/defin/def.ypp"
+                                { release((yyvsp[0]._token)); }
+#line 4518 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 488: /* defScanChainOpt: '+' PARTITION_K ident MAXBITS_K integer  */
+#line 1385 "/root/repo/src/defin/def.ypp"
+                                                  { release((yyvsp[-2]._token)); }
+#line 4524 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 490: /* $@54: %empty  */
+#line 1387 "/root/repo/src/defin/def.ypp"
+                           { deflex_kid = ANY_ID; }
+#line 4530 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 491: /* defScanChainOpt: '+' START_K ident $@54 defScanChainOptPin  */
+#line 1387 "/root/repo/src/defin/def.ypp"
+                                                                       { deflex_kid = 0; release((yyvsp[-2]._token)); }
+#line 4536 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 494: /* $@55: %empty  */
+#line 1390 "/root/repo/src/defin/def.ypp"
+                          { deflex_kid = ANY_ID; }
+#line 4542 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 495: /* defScanChainOpt: '+' STOP_K ident $@55 defScanChainOptPin  */
+#line 1390 "/root/repo/src/defin/def.ypp"
+                                                                      { deflex_kid = 0; release((yyvsp[-2]._token)); }
+#line 4548 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 502: /* defScanChainOptPin: ident  */
+#line 1403 "/root/repo/src/defin/def.ypp"
+               { release((yyvsp[0]._token)); }
+#line 4554 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 503: /* defScanPinIn: '(' IN_K ident ')'  */
+#line 1407 "/root/repo/src/defin/def.ypp"
+                            { release((yyvsp[-1]._token)); }
+#line 4560 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 504: /* defScanPinOut: '(' OUT_K ident ')'  */
+#line 1411 "/root/repo/src/defin/def.ypp"
+                             { release((yyvsp[-1]._token)); }
+#line 4566 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 508: /* $@56: %empty  */
+#line 1424 "/root/repo/src/defin/def.ypp"
+         { deflex_kid = ANY_ID; }
+#line 4572 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 509: /* $@57: %empty  */
+#line 1424 "/root/repo/src/defin/def.ypp"
+                                        { deflex_kid = 0; }
+#line 4578 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 510: /* defScanComponent: $@56 ident $@57 defScanComponentOpts  */
+#line 1425 "/root/repo/src/defin/def.ypp"
+         {
+             release((yyvsp[-2]._token));
+         }
+#line 4586 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 519: /* $@58: %empty  */
+#line 1451 "/root/repo/src/defin/def.ypp"
+                   { deflex_kid = ANY_ID; regionR->begin(*(yyvsp[0]._token),true); }
+#line 4592 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 520: /* $@59: %empty  */
+#line 1451 "/root/repo/src/defin/def.ypp"
+                                                                                       { deflex_kid = 0; }
+#line 4598 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 521: /* defGroup: '-' ident $@58 defGroupCompList $@59 defGroupOpts ';'  */
+#line 1451 "/root/repo/src/defin/def.ypp"
+                                                                                                                            { release((yyvsp[-5]._token)); regionR->end(); }
+#line 4604 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 522: /* defGroupCompList: ident  */
+#line 1455 "/root/repo/src/defin/def.ypp"
+               { regionR->inst(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 4610 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 523: /* defGroupCompList: defGroupCompList ident  */
+#line 1456 "/root/repo/src/defin/def.ypp"
+                                { regionR->inst(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 4616 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 526: /* defGroupOpt: '+' REGION_K ident  */
+#line 1465 "/root/repo/src/defin/def.ypp"
+                            { regionR->parent(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 4622 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 527: /* defGroupOpt: '+' defProperty  */
+#line 1466 "/root/repo/src/defin/def.ypp"
+                         { addRegionProps((yyvsp[0]._props)); }
+#line 4628 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 528: /* $@60: %empty  */
+#line 1470 "/root/repo/src/defin/def.ypp"
+                    {deflex_extension();}
+#line 4634 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 530: /* $@61: %empty  */
+#line 1474 "/root/repo/src/defin/def.ypp"
+                                { non_default_ruleR->beginRules((yyvsp[0]._int)); }
+#line 4640 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 531: /* $@62: %empty  */
+#line 1475 "/root/repo/src/defin/def.ypp"
+                                          { non_default_ruleR->endRules(); }
+#line 4646 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 535: /* $@63: %empty  */
+#line 1485 "/root/repo/src/defin/def.ypp"
+                { non_default_ruleR->beginRule(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 4652 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 536: /* defNonDefaultRule: '-' ident $@63 defNonDefaultRuleAttrs ';'  */
+#line 1485 "/root/repo/src/defin/def.ypp"
+                                                                                               { non_default_ruleR->endRule(); }
+#line 4658 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 539: /* defNonDefaultRuleAttr: '+' HARDSPACING_K  */
+#line 1494 "/root/repo/src/defin/def.ypp"
+                        { non_default_ruleR->hardSpacing(); }
+#line 4664 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 540: /* $@64: %empty  */
+#line 1496 "/root/repo/src/defin/def.ypp"
+                                        { non_default_ruleR->beginLayerRule(*(yyvsp[-2]._token), (yyvsp[0]._int) ); }
+#line 4670 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 541: /* defNonDefaultRuleAttr: '+' LAYER_K ident WIDTH_K integer $@64 defNonDefaultRuleLayerAttrOpts  */
+#line 1497 "/root/repo/src/defin/def.ypp"
+                                        { release((yyvsp[-4]._token)); non_default_ruleR->endLayerRule(); }
+#line 4676 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 542: /* defNonDefaultRuleAttr: '+' VIA_K ident  */
+#line 1498 "/root/repo/src/defin/def.ypp"
+                      { non_default_ruleR->via(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 4682 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 543: /* defNonDefaultRuleAttr: '+' VIARULE_K ident  */
+#line 1499 "/root/repo/src/defin/def.ypp"
+                          { non_default_ruleR->viaRule(*(yyvsp[0]._token)); release((yyvsp[0]._token)); }
+#line 4688 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 544: /* defNonDefaultRuleAttr: '+' MINCUTS_K ident integer  */
+#line 1500 "/root/repo/src/defin/def.ypp"
+                                  { non_default_ruleR->minCuts(*(yyvsp[-1]._token),(yyvsp[0]._int)); release((yyvsp[-1]._token)); }
+#line 4694 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 545: /* defNonDefaultRuleAttr: '+' defProperty  */
+#line 1501 "/root/repo/src/defin/def.ypp"
+                      { addNonDefaultRuleProps((yyvsp[0]._props)); }
+#line 4700 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 549: /* defNonDefaultRuleLayerAttrOpt: SPACING_K integer  */
+#line 1511 "/root/repo/src/defin/def.ypp"
+                        { non_default_ruleR->spacing((yyvsp[0]._int)); }
+#line 4706 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 550: /* defNonDefaultRuleLayerAttrOpt: WIREEXT_K integer  */
+#line 1512 "/root/repo/src/defin/def.ypp"
+                        { non_default_ruleR->wireExt((yyvsp[0]._int)); }
+#line 4712 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 555: /* point: '(' integer integer ')'  */
+#line 1530 "/root/repo/src/defin/def.ypp"
+          {
+              (yyval._point)._x = (yyvsp[-2]._int);
+              (yyval._point)._y = (yyvsp[-1]._int);
+          }
+#line 4721 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 557: /* number: NUM_INT  */
+#line 1541 "/root/repo/src/defin/def.ypp"
+                 { (yyval._double) = (double) (yyvsp[0]._int); }
+#line 4727 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 559: /* qstring: QSTRING  */
+#line 1546 "/root/repo/src/defin/def.ypp"
+                 { (yyval._token) = createQ(QSTRING); }
+#line 4733 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 560: /* ident: IDENT  */
+#line 1550 "/root/repo/src/defin/def.ypp"
+                 { (yyval._token) = create(IDENT); }
+#line 4739 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 561: /* ident: NUM_INT  */
+#line 1551 "/root/repo/src/defin/def.ypp"
+                 { (yyval._token) = create(IDENT); }
+#line 4745 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 562: /* ident: NUM_DOUBLE  */
+#line 1552 "/root/repo/src/defin/def.ypp"
+                    { (yyval._token) = create(IDENT); }
+#line 4751 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 563: /* $@65: %empty  */
+#line 1553 "/root/repo/src/defin/def.ypp"
+         { ignore_id_error = true; }
+#line 4757 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+  case 564: /* ident: $@65 error  */
+#line 1554 "/root/repo/src/defin/def.ypp"
+         { 
+             /*
+              * If the grammer was expecting a identifier and we received a keyword ,
+              * accept the token and continue. This approach works when there is no keyword
+              * and identifier colision. Where there is an identifier colision, the scanner must
+              * be told to return a identifier. See the varible "deflex_kid". There are a couple
+              * of places in the grammer where the "ident" rule occurs as an optional reduction.
+              * These case also require the deflex_kid set to ANY_ID.
+              */
+
+             if ( is_keyword(yychar) )
+             {
+#if YYDEBUG
+                 if ( defdebug )
+                     printf("KID (%s)\n", deftext );
+#endif
+                (yyval._token) = create(IDENT);
+                 yyerrok; 
+                 yyclearin; 
+             }
+             else
+             {
+                 ignore_id_error = false;
+                 deferror("parse error");
+             }
+         }
+#line 4788 "/root/repo/src/defin/def_parser.cpp"
+    break;
+
+
+#line 4792 "/root/repo/src/defin/def_parser.cpp"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 1581 "/root/repo/src/defin/def.ypp"
+
+
+void defparse_init( FILE * file )
+{
+    extern FILE * defin;
+    defin = file;
+    deflex_init();
+    blockageR = &default_blockageR;
+    componentR = &default_componentR;
+    fillR = &default_fillR;
+    gcellR = & default_gcellR;
+    netR = &default_netR;
+    pinR = &default_pinR;
+    readerR = &default_readerR;
+    rowR = &default_rowR;
+    snetR = &default_snetR;
+    tracksR = &default_tracksR;
+    viaR = &default_viaR;
+    regionR = &default_regionR;
+    non_default_ruleR = &default_non_default_ruleR;
+    prop_defsR = &default_prop_defsR;
+    pin_propsR = &default_pin_propsR;
+}
+
+void defin_set_IBlockage( definIBlockage * blockage )
+{
+    blockageR = blockage;
+}
+
+void defin_set_IComponent( definIComponent * component )
+{
+    componentR = component;
+}
+
+void defin_set_IFill( definIFill * fill )
+{
+    fillR = fill;
+}
+
+void defin_set_IGCell( definIGCell * gcell )
+{
+    gcellR = gcell;
+}
+
+void defin_set_INet( definINet * net )
+{
+    netR = net;
+}
+
+void defin_set_IPin( definIPin * pin )
+{
+    pinR = pin;
+}
+
+void defin_set_IReader( definIReader * reader )
+{
+    readerR = reader;
+}
+
+void defin_set_IRow( definIRow * row )
+{
+    rowR = row;
+}
+
+void defin_set_ISNet( definISNet * snet )
+{
+    snetR = snet;
+}
+
+void defin_set_ITracks( definITracks * tracks )
+{
+    tracksR = tracks;
+}
+
+void defin_set_IVia( definIVia * via )
+{
+    viaR = via;
+}
+
+void defin_set_IRegion( definIRegion * region )
+{
+    regionR = region;
+}
+
+void defin_set_INonDefaultRule( definINonDefaultRule * rule )
+{
+    non_default_ruleR = rule;
+}
+
+void defin_set_IPropDefs( definIPropDefs * defs )
+{
+    prop_defsR = defs;
+}
+
+void defin_set_IPinProps( definIPinProps * props )
+{
+    pin_propsR = props;
+}
+
+void defparse_done()
+{
+    int i = 0;
+    token * tk = alloclist;
+    token * next;
+
+    while( tk )
+   {
+        next = tk->_alloc_next;
+
+#ifndef NDEBUG
+        if ( tk->_line >= 0 )
+            fprintf(stderr, "deflex: token leaked from line %d with value %s\n", tk->_line, tk->_text );
+#endif
+
+        free( (void *) tk->_text );
+        free( (void *) tk );
+        tk = next;
+        ++i;
+    }
+
+    alloclist = NULL;
+    freelist = NULL;
+    deflex_done();
+}
+
+void deferror( const char * msg )
+{
+    if ( ignore_id_error )
+    {
+         ignore_id_error = 0;
+         return;
+    }
+
+    char buffer[BUFSIZ];
+    snprintf( buffer, BUFSIZ, "DEF:%d: %s, reading %s\n", deflex_lineno, msg, deftext);
+    readerR->error(buffer);
+}
+
+token * create( int tid )
+{
+    token * tk = freelist;
+
+    if ( tk != NULL )
+    {
+        freelist = tk->_free_next;
+    }
+    else
+    {
+        tk = (token *) malloc(sizeof(token));
+        assert(tk);
+        tk->_text = (char *) malloc(MAX_TOKEN_LEN);
+        assert(tk->_text);
+        tk->_free_next = NULL;
+        tk->_alloc_next = alloclist;
+        alloclist = tk;
+    }
+
+    tk->_line = deflex_lineno;
+    tk->_tid = tid;
+
+    char * p = deftext;
+    char * t = tk->_text;
+    char * limit = t + MAX_TOKEN_LEN;
+    while( (t < limit) && ((*t++ = *p++) != '\0') );
+
+    if ( t == limit )
+    {
+        tk->_text[MAX_TOKEN_LEN-1] = 0;
+        fprintf(stderr, "deflex:%d: exceeded maximum string length\n", deflex_lineno );
+    }
+
+    return tk;
+}
+
+token * createQ( int tid )
+{
+    token * tk = freelist;
+
+    if ( tk != NULL )
+    {
+        freelist = tk->_free_next;
+    }
+    else
+    {
+        tk = (token *) malloc(sizeof(token));
+        assert(tk);
+        tk->_text = (char *) malloc(MAX_TOKEN_LEN);
+        assert(tk->_text);
+        tk->_free_next = NULL;
+        tk->_alloc_next = alloclist;
+        alloclist = tk;
+    }
+
+    tk->_line = deflex_lineno;
+    tk->_tid = tid;
+
+    assert( deftext[0] == '"' );
+    char * p = deftext + 1;
+    char * t = tk->_text;
+    char * limit = t + MAX_TOKEN_LEN;
+    while( (t < limit) && ((*t++ = *p++) != '\0') );
+
+    if ( t == limit )
+    {
+        tk->_text[MAX_TOKEN_LEN-1] = 0;
+        fprintf(stderr, "deflex:%d: exceeded maximum string length\n", deflex_lineno );
+    }
+
+    --t;
+    --t;
+    assert( *t == '"' );
+    *t = '\0';
+    return tk;
+}
+
+void defparse_linecnt()
+{
+    readerR->line(deflex_lineno);
+}
+
+void addComponentProps( std::vector<prop *> * props )
+{
+    std::vector<prop *>::iterator itr;
+
+    for( itr = props->begin(); itr != props->end(); ++itr )
+    {
+        prop * p = *itr;
+
+        switch( p->_type )
+        {
+            case DEF_INTEGER:
+                componentR->property( p->_name->_text, p->_value._int_val );
+                break;
+
+            case DEF_REAL:
+                componentR->property( p->_name->_text, p->_value._flt_val );
+                break;
+
+            case DEF_STRING:
+                componentR->property( p->_name->_text, p->_value._str_val->_text );
+                break;
+        }
+    }
+
+    freeProps(props);
+}
+
+void addComponentPinProps( std::vector<prop *> * props )
+{ 
+    std::vector<prop *>::iterator itr;
+
+    for( itr = props->begin(); itr != props->end(); ++itr )
+    {
+        prop * p = *itr;
+
+        switch( p->_type )
+        {
+            case DEF_INTEGER:
+                pin_propsR->property( p->_name->_text, p->_value._int_val );
+                break;
+
+            case DEF_REAL:
+                pin_propsR->property( p->_name->_text, p->_value._flt_val );
+                break;
+
+            case DEF_STRING:
+                pin_propsR->property( p->_name->_text, p->_value._str_val->_text );
+                break;
+        }
+    }
+
+    freeProps(props);
+}
+
+void addNetProps( std::vector<prop *> * props )
+{
+    std::vector<prop *>::iterator itr;
+
+    for( itr = props->begin(); itr != props->end(); ++itr )
+    {
+        prop * p = *itr;
+
+        switch( p->_type )
+        {
+            case DEF_INTEGER:
+                netR->property( p->_name->_text, p->_value._int_val );
+                break;
+
+            case DEF_REAL:
+                netR->property( p->_name->_text, p->_value._flt_val );
+                break;
+
+            case DEF_STRING:
+                netR->property( p->_name->_text, p->_value._str_val->_text );
+                break;
+        }
+    }
+
+    freeProps(props);
+}
+
+void addSNetProps( std::vector<prop *> * props )
+{
+    std::vector<prop *>::iterator itr;
+
+    for( itr = props->begin(); itr != props->end(); ++itr )
+    {
+        prop * p = *itr;
+
+        switch( p->_type )
+        {
+            case DEF_INTEGER:
+                snetR->property( p->_name->_text, p->_value._int_val );
+                break;
+
+            case DEF_REAL:
+                snetR->property( p->_name->_text, p->_value._flt_val );
+                break;
+
+            case DEF_STRING:
+                snetR->property( p->_name->_text, p->_value._str_val->_text );
+                break;
+        }
+    }
+
+    freeProps(props);
+}
+
+void addNonDefaultRuleProps( std::vector<prop *> * props )
+{  
+    std::vector<prop *>::iterator itr;
+
+    for( itr = props->begin(); itr != props->end(); ++itr )
+    {
+        prop * p = *itr;
+
+        switch( p->_type )
+        {
+            case DEF_INTEGER:
+                non_default_ruleR->property( p->_name->_text, p->_value._int_val );
+                break;
+
+            case DEF_REAL:
+                non_default_ruleR->property( p->_name->_text, p->_value._flt_val );
+                break;
+
+            case DEF_STRING:
+                non_default_ruleR->property( p->_name->_text, p->_value._str_val->_text );
+                break;
+        }
+    }
+    freeProps(props);
+}
+
+void addRegionProps( std::vector<prop *> * props )
+{
+   std::vector<prop *>::iterator itr;
+
+    for( itr = props->begin(); itr != props->end(); ++itr )
+    {
+        prop * p = *itr;
+
+        switch( p->_type )
+        {
+            case DEF_INTEGER:
+                regionR->property( p->_name->_text, p->_value._int_val );
+                break;
+
+            case DEF_REAL:
+                regionR->property( p->_name->_text, p->_value._flt_val );
+                break;
+
+            case DEF_STRING:
+                regionR->property( p->_name->_text, p->_value._str_val->_text );
+                break;
+        }
+    }
+    freeProps(props);
+}
+
+void addRowProps( std::vector<prop *> * props )
+{
+    std::vector<prop *>::iterator itr;
+
+    for( itr = props->begin(); itr != props->end(); ++itr )
+    {
+        prop * p = *itr;
+
+        switch( p->_type )
+        {
+            case DEF_INTEGER:
+                rowR->property( p->_name->_text, p->_value._int_val );
+                break;
+
+            case DEF_REAL:
+                rowR->property( p->_name->_text, p->_value._flt_val );
+                break;
+
+            case DEF_STRING:
+                rowR->property( p->_name->_text, p->_value._str_val->_text );
+                break;
+        }
+    }
+    freeProps(props);
+}
+
@@ -0,0 +1,262 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_DEF_ROOT_REPO_SRC_DEFIN_DEF_PARSER_HPP_INCLUDED
+# define YY_DEF_ROOT_REPO_SRC_DEFIN_DEF_PARSER_HPP_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int defdebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IDENT = 258,                   /* IDENT  */
+    QSTRING = 259,                 /* QSTRING  */
+    NUM_INT = 260,                 /* NUM_INT  */
+    NUM_DOUBLE = 261,              /* NUM_DOUBLE  */
+    HISTORY_TEXT = 262,            /* HISTORY_TEXT  */
+    SKIPPED_WIRE = 263,            /* SKIPPED_WIRE  */
+    _DEF_KEYWORD_BASE_ = 264,      /* _DEF_KEYWORD_BASE_  */
+    ANALOG_K = 265,                /* ANALOG_K  */
+    ANTENNAMODEL_K = 266,          /* ANTENNAMODEL_K  */
+    ANTENNAPINDIFFAREA_K = 267,    /* ANTENNAPINDIFFAREA_K  */
+    ANTENNAPINGATEAREA_K = 268,    /* ANTENNAPINGATEAREA_K  */
+    ANTENNAPINMAXAREACAR_K = 269,  /* ANTENNAPINMAXAREACAR_K  */
+    ANTENNAPINMAXCUTCAR_K = 270,   /* ANTENNAPINMAXCUTCAR_K  */
+    ANTENNAPINMAXSIDEAREACAR_K = 271, /* ANTENNAPINMAXSIDEAREACAR_K  */
+    ANTENNAPINPARTIALCUTAREA_K = 272, /* ANTENNAPINPARTIALCUTAREA_K  */
+    ANTENNAPINPARTIALMETALAREA_K = 273, /* ANTENNAPINPARTIALMETALAREA_K  */
+    ANTENNAPINPARTIALMETALSIDEAREA_K = 274, /* ANTENNAPINPARTIALMETALSIDEAREA_K  */
+    BALANCED_K = 275,              /* BALANCED_K  */
+    BEGINEXT_K = 276,              /* BEGINEXT_K  */
+    BITS_K = 277,                  /* BITS_K  */
+    BLOCKAGES_K = 278,             /* BLOCKAGES_K  */
+    BUSBITCHARS_K = 279,           /* BUSBITCHARS_K  */
+    BY_K = 280,                    /* BY_K  */
+    CLOCK_K = 281,                 /* CLOCK_K  */
+    COMMONSCANPINS_K = 282,        /* COMMONSCANPINS_K  */
+    COMPONENTPIN_K = 283,          /* COMPONENTPIN_K  */
+    COMPONENTS_K = 284,            /* COMPONENTS_K  */
+    COMPONENT_K = 285,             /* COMPONENT_K  */
+    COVER_K = 286,                 /* COVER_K  */
+    DESIGN_K = 287,                /* DESIGN_K  */
+    DIEAREA_K = 288,               /* DIEAREA_K  */
+    DIRECTION_K = 289,             /* DIRECTION_K  */
+    DISTANCE_K = 290,              /* DISTANCE_K  */
+    DIST_K = 291,                  /* DIST_K  */
+    DIVIDERCHAR_K = 292,           /* DIVIDERCHAR_K  */
+    DO_K = 293,                    /* DO_K  */
+    E_K = 294,                     /* E_K  */
+    EEQMASTER_K = 295,             /* EEQMASTER_K  */
+    ENDEXT_K = 296,                /* ENDEXT_K  */
+    END_K = 297,                   /* END_K  */
+    ESTCAP_K = 298,                /* ESTCAP_K  */
+    FE_K = 299,                    /* FE_K  */
+    FEEDTHRU_K = 300,              /* FEEDTHRU_K  */
+    FENCE_K = 301,                 /* FENCE_K  */
+    FILLS_K = 302,                 /* FILLS_K  */
+    FIXEDBUMP_K = 303,             /* FIXEDBUMP_K  */
+    FIXED_K = 304,                 /* FIXED_K  */
+    FLOATING_K = 305,              /* FLOATING_K  */
+    FN_K = 306,                    /* FN_K  */
+    FOREIGN_K = 307,               /* FOREIGN_K  */
+    FREQUENCY_K = 308,             /* FREQUENCY_K  */
+    FS_K = 309,                    /* FS_K  */
+    FW_K = 310,                    /* FW_K  */
+    GCELLGRID_K = 311,             /* GCELLGRID_K  */
+    GROUND_K = 312,                /* GROUND_K  */
+    GROUPS_K = 313,                /* GROUPS_K  */
+    GROUP_K = 314,                 /* GROUP_K  */
+    GUIDE_K = 315,                 /* GUIDE_K  */
+    HISTORY_K = 316,               /* HISTORY_K  */
+    INOUT_K = 317,                 /* INOUT_K  */
+    INPUT_K = 318,                 /* INPUT_K  */
+    INTEGER_K = 319,               /* INTEGER_K  */
+    IN_K = 320,                    /* IN_K  */
+    LAYER_K = 321,                 /* LAYER_K  */
+    MAXBITS_K = 322,               /* MAXBITS_K  */
+    MICRONS_K = 323,               /* MICRONS_K  */
+    MUSTJOIN_K = 324,              /* MUSTJOIN_K  */
+    N_K = 325,                     /* N_K  */
+    NAMESCASESENSITIVE_K = 326,    /* NAMESCASESENSITIVE_K  */
+    NETLIST_K = 327,               /* NETLIST_K  */
+    NETS_K = 328,                  /* NETS_K  */
+    NET_K = 329,                   /* NET_K  */
+    NEW_K = 330,                   /* NEW_K  */
+    NONDEFAULTRULE_K = 331,        /* NONDEFAULTRULE_K  */
+    NOSHIELD_K = 332,              /* NOSHIELD_K  */
+    OFF_K = 333,                   /* OFF_K  */
+    ON_K = 334,                    /* ON_K  */
+    ORDERED_K = 335,               /* ORDERED_K  */
+    ORIGINAL_K = 336,              /* ORIGINAL_K  */
+    OUTPUT_K = 337,                /* OUTPUT_K  */
+    OUT_K = 338,                   /* OUT_K  */
+    OXIDE1_K = 339,                /* OXIDE1_K  */
+    OXIDE2_K = 340,                /* OXIDE2_K  */
+    OXIDE3_K = 341,                /* OXIDE3_K  */
+    OXIDE4_K = 342,                /* OXIDE4_K  */
+    PARTITION_K = 343,             /* PARTITION_K  */
+    PATTERNNAME_K = 344,           /* PATTERNNAME_K  */
+    PATTERN_K = 345,               /* PATTERN_K  */
+    PINPROPERTIES_K = 346,         /* PINPROPERTIES_K  */
+    PINS_K = 347,                  /* PINS_K  */
+    PLACED_K = 348,                /* PLACED_K  */
+    PLACEMENT_K = 349,             /* PLACEMENT_K  */
+    POWER_K = 350,                 /* POWER_K  */
+    PROPERTYDEFINITIONS_K = 351,   /* PROPERTYDEFINITIONS_K  */
+    PROPERTY_K = 352,              /* PROPERTY_K  */
+    PUSHDOWN_K = 353,              /* PUSHDOWN_K  */
+    RANGE_K = 354,                 /* RANGE_K  */
+    REAL_K = 355,                  /* REAL_K  */
+    RECT_K = 356,                  /* RECT_K  */
+    REGIONS_K = 357,               /* REGIONS_K  */
+    REGION_K = 358,                /* REGION_K  */
+    RESET_K = 359,                 /* RESET_K  */
+    ROUTED_K = 360,                /* ROUTED_K  */
+    ROW_K = 361,                   /* ROW_K  */
+    S_K = 362,                     /* S_K  */
+    SCANCHAINS_K = 363,            /* SCANCHAINS_K  */
+    SCAN_K = 364,                  /* SCAN_K  */
+    SHAPE_K = 365,                 /* SHAPE_K  */
+    SHIELDNET_K = 366,             /* SHIELDNET_K  */
+    SHIELD_K = 367,                /* SHIELD_K  */
+    SIGNAL_K = 368,                /* SIGNAL_K  */
+    SLOTS_K = 369,                 /* SLOTS_K  */
+    SOURCE_K = 370,                /* SOURCE_K  */
+    SPECIALNETS_K = 371,           /* SPECIALNETS_K  */
+    SPECIALNET_K = 372,            /* SPECIALNET_K  */
+    SPECIAL_K = 373,               /* SPECIAL_K  */
+    START_K = 374,                 /* START_K  */
+    STEINER_K = 375,               /* STEINER_K  */
+    STEP_K = 376,                  /* STEP_K  */
+    STOP_K = 377,                  /* STOP_K  */
+    STRING_K = 378,                /* STRING_K  */
+    SUBNET_K = 379,                /* SUBNET_K  */
+    SYNTHESIZED_K = 380,           /* SYNTHESIZED_K  */
+    TAPERRULE_K = 381,             /* TAPERRULE_K  */
+    TAPER_K = 382,                 /* TAPER_K  */
+    TECHNOLOGY_K = 383,            /* TECHNOLOGY_K  */
+    TEST_K = 384,                  /* TEST_K  */
+    TIEOFF_K = 385,                /* TIEOFF_K  */
+    TIMING_K = 386,                /* TIMING_K  */
+    TRACKS_K = 387,                /* TRACKS_K  */
+    TRUNK_K = 388,                 /* TRUNK_K  */
+    TYPE_K = 389,                  /* TYPE_K  */
+    UNITS_K = 390,                 /* UNITS_K  */
+    UNPLACED_K = 391,              /* UNPLACED_K  */
+    USER_K = 392,                  /* USER_K  */
+    USE_K = 393,                   /* USE_K  */
+    VERSION_K = 394,               /* VERSION_K  */
+    VIAS_K = 395,                  /* VIAS_K  */
+    VOLTAGE_K = 396,               /* VOLTAGE_K  */
+    VPIN_K = 397,                  /* VPIN_K  */
+    WEIGHT_K = 398,                /* WEIGHT_K  */
+    WIREDLOGIC_K = 399,            /* WIREDLOGIC_K  */
+    XTALK_K = 400,                 /* XTALK_K  */
+    W_K = 401,                     /* W_K  */
+    X_K = 402,                     /* X_K  */
+    Y_K = 403,                     /* Y_K  */
+    POLYGON_K = 404,               /* POLYGON_K  */
+    SPACING_K = 405,               /* SPACING_K  */
+    DESIGNRULEWIDTH_K = 406,       /* DESIGNRULEWIDTH_K  */
+    NETEXPR_K = 407,               /* NETEXPR_K  */
+    SUPPLYSENSITIVITY_K = 408,     /* SUPPLYSENSITIVITY_K  */
+    GROUNDSENSITIVITY_K = 409,     /* GROUNDSENSITIVITY_K  */
+    VIARULE_K = 410,               /* VIARULE_K  */
+    CUTSIZE_K = 411,               /* CUTSIZE_K  */
+    LAYERS_K = 412,                /* LAYERS_K  */
+    CUTSPACING_K = 413,            /* CUTSPACING_K  */
+    ENCLOSURE_K = 414,             /* ENCLOSURE_K  */
+    ROWCOL_K = 415,                /* ROWCOL_K  */
+    ORIGIN_K = 416,                /* ORIGIN_K  */
+    OFFSET_K = 417,                /* OFFSET_K  */
+    HARDSPACING_K = 418,           /* HARDSPACING_K  */
+    WIDTH_K = 419,                 /* WIDTH_K  */
+    DIAGWIDTH_K = 420,             /* DIAGWIDTH_K  */
+    WIREEXT_K = 421,               /* WIREEXT_K  */
+    MINCUTS_K = 422,               /* MINCUTS_K  */
+    NONDEFAULTRULES_K = 423,       /* NONDEFAULTRULES_K  */
+    VIA_K = 424,                   /* VIA_K  */
+    HALO_K = 425,                  /* HALO_K  */
+    STYLES_K = 426,                /* STYLES_K  */
+    STYLE_K = 427,                 /* STYLE_K  */
+    PORT_K = 428                   /* PORT_K  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 184 "/root/repo/src/defin/def.ypp"
+
+    struct token * _token;
+    struct point { int _x, _y; }  _point;
+    double         _double;
+    int            _int;
+    int            _tid;
+    std::vector<defPoint> * _points;
+    std::vector<struct prop *> * _props;
+    struct prop * _prop;
+
+#line 248 "/root/repo/src/defin/def_parser.hpp"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE deflval;
+
+
+int defparse (void);
+
+
+#endif /* !YY_DEF_ROOT_REPO_SRC_DEFIN_DEF_PARSER_HPP_INCLUDED  */
@@ -0,0 +1,265 @@
+// Hand-written emulation of src/defin/def.l for local testing (no flex).
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "definTypes.h"
+#include "def_parser.hpp"
+#include "hash.h"
+#include "def.h"
+
+extern YYSTYPE deflval;
+int deflex_kid = 0;
+bool deflex_casesens = true;
+int deflex_linecnt = 1000000;
+int deflex_lineno = 1;
+int defdebug;
+FILE * defin = NULL;
+char * deftext = NULL;
+static hashTable keywords;
+static std::vector<char> textbuf;
+static std::string buf;
+static size_t pos = 0;
+static bool loaded = false;
+static int state = 0; // 0 INITIAL, 1 HISTORY, 2 EXTENSION, 3 SKIPWIRE
+static bool skip_plus = false;
+#define yytext deftext
+#define DEF_DEBUG(msg)
+static void unput( char c ) { buf[--pos] = c; }
+
+#include "/tmp/fake/netpath.inc"
+#include "/tmp/fake/id.inc"
+
+static bool isPathOption( const char * word )
+{
+    return (strcmp( word, "SHAPE" ) == 0) || (strcmp( word, "STYLE" ) == 0);
+}
+
+static void load()
+{
+    if ( loaded ) return;
+    loaded = true;
+    buf.clear();
+    char b[65536];
+    size_t n;
+    while ( (n = fread(b, 1, sizeof(b), defin)) > 0 )
+        buf.append(b, n);
+    pos = 0;
+}
+
+static void setText( size_t start, size_t len )
+{
+    textbuf.assign( buf.begin() + start, buf.begin() + start + len );
+    textbuf.push_back(0);
+    deftext = textbuf.data();
+}
+
+static bool isWs( char c ) { return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\b'; }
+static bool isSpace( char c ) { return isWs(c) || c == '\n'; }
+
+static bool isInt( const std::string & s, size_t i )
+{
+    if ( i < s.size() && (s[i] == '-' || s[i] == '+') ) ++i;
+    if ( i >= s.size() ) return false;
+    for( ; i < s.size(); ++i ) if ( s[i] < '0' || s[i] > '9' ) return false;
+    return true;
+}
+
+static bool isHex( const std::string & s )
+{
+    size_t i = 0;
+    if ( s[i] == '-' || s[i] == '+' ) ++i;
+    if ( i + 2 >= s.size() + 0 && !(i + 2 < s.size()) ) return false;
+    if ( s[i] != '0' || (s[i+1] != 'x' && s[i+1] != 'X') ) return false;
+    i += 2;
+    if ( i >= s.size() ) return false;
+    for( ; i < s.size(); ++i ) if ( !isxdigit((unsigned char) s[i]) ) return false;
+    return true;
+}
+
+static bool isOct( const std::string & s )
+{
+    size_t i = 0;
+    if ( s[i] == '-' || s[i] == '+' ) ++i;
+    if ( s.compare(i, 2, "00") != 0 ) return false;
+    i += 2;
+    if ( i >= s.size() ) return false;
+    for( ; i < s.size(); ++i ) if ( s[i] < '0' || s[i] > '7' ) return false;
+    return true;
+}
+
+static bool isFloat( const std::string & s )
+{
+    size_t i = 0;
+    if ( s[i] == '-' || s[i] == '+' ) ++i;
+    size_t d0 = i;
+    while ( i < s.size() && isdigit((unsigned char) s[i]) ) ++i;
+    size_t nd = i - d0;
+    if ( i < s.size() && s[i] == '.' )
+    {
+        ++i;
+        size_t f0 = i;
+        while ( i < s.size() && isdigit((unsigned char) s[i]) ) ++i;
+        if ( i == f0 ) return false;
+    }
+    else if ( nd == 0 )
+        return false;
+    if ( i < s.size() && (s[i] == 'e' || s[i] == 'E') )
+    {
+        ++i;
+        if ( i < s.size() && (s[i] == '-' || s[i] == '+') ) ++i;
+        size_t e0 = i;
+        while ( i < s.size() && isdigit((unsigned char) s[i]) ) ++i;
+        if ( i == e0 ) return false;
+    }
+    return i == s.size();
+}
+
+// Longest numeric prefix match (flex picks the longest match; a number only
+// wins over an identifier when it covers the whole word).
+int deflex()
+{
+    load();
+
+    for(;;)
+    {
+        if ( pos >= buf.size() )
+            return 0;
+
+        char c = buf[pos];
+
+        if ( c == '\n' )
+        {
+            ++pos;
+            ++deflex_lineno;
+            if ( (deflex_lineno % deflex_linecnt) == 0 ) defparse_linecnt();
+            continue;
+        }
+
+        if ( isWs(c) )
+        {
+            while ( pos < buf.size() && isWs(buf[pos]) ) ++pos;
+            continue;
+        }
+
+        size_t start = pos;
+        size_t end = pos;
+        while ( end < buf.size() && !isSpace(buf[end]) ) ++end;
+
+        if ( state == 1 ) // HISTORY
+        {
+            pos = end;
+            setText(start, end - start);
+            if ( yytext[0] == ';' && yytext[1] == 0 )
+            {
+                unput(';');
+                state = 0;
+                return HISTORY_TEXT;
+            }
+            continue;
+        }
+
+        if ( state == 2 ) // EXTENSION
+        {
+            pos = end;
+            setText(start, end - start);
+            if ( strcmp(yytext, "ENDEXT") == 0 )
+            {
+                unput('T'); unput('X'); unput('E'); unput('D'); unput('N'); unput('E');
+                state = 0;
+            }
+            continue;
+        }
+
+        if ( c == '#' )
+        {
+            while ( pos < buf.size() && buf[pos] != '\n' && buf[pos] != '\r' ) ++pos;
+            continue;
+        }
+
+        if ( state == 3 ) // SKIPWIRE
+        {
+            pos = end;
+            setText(start, end - start);
+
+            if ( strcmp(yytext, ";") == 0 )
+            {
+                unput(';');
+                state = 0;
+                return SKIPPED_WIRE;
+            }
+
+            if ( strcmp(yytext, "+") == 0 )
+            {
+                skip_plus = true;
+                continue;
+            }
+
+            if ( skip_plus )
+            {
+                skip_plus = false;
+                std::string word = yytext;
+
+                if ( deflex_casesens == false )
+                    upcase( yytext );
+
+                if ( ! isPathOption(yytext) )
+                {
+                    int i;
+
+                    for( i = word.size() - 1; i >= 0; --i )
+                        unput(word[i]);
+
+                    unput(' ');
+                    unput('+');
+                    state = 0;
+                    return SKIPPED_WIRE;
+                }
+            }
+            continue;
+        }
+
+        if ( c == '"' )
+        {
+            size_t e = pos + 1;
+            while ( e < buf.size() && buf[e] != '"' && buf[e] != '\n' ) ++e;
+            if ( e < buf.size() ) ++e;
+            pos = e;
+            setText(start, e - start);
+            return QSTRING;
+        }
+
+        std::string word( buf, start, end - start );
+        pos = end;
+        setText(start, end - start);
+
+        if ( isHex(word) ) { deflval._int = strtol( yytext, NULL, 16 ); return NUM_INT; }
+        if ( isOct(word) ) { deflval._int = strtol( yytext, NULL, 8 ); return NUM_INT; }
+        if ( isInt(word, 0) ) { deflval._int = strtol( yytext, NULL, 10 ); return NUM_INT; }
+        if ( isFloat(word) ) { deflval._double = strtod( yytext, NULL ); return NUM_DOUBLE; }
+        return id();
+    }
+}
+
+void deflex_init()
+{
+    static bool init_keywords = false;
+
+    if ( init_keywords == false )
+    {
+        keywords.setSize(512);
+#include "/tmp/fake/keywords.inc"
+        init_keywords = true;
+    }
+
+    deflex_lineno = 1;
+    deflex_casesens = true;
+    state = 0;
+    loaded = false;
+}
+
+void deflex_done() { loaded = false; }
+void deflex_history() { state = 1; }
+void deflex_extension() { state = 2; }
+void deflex_skip_wire() { skip_plus = false; state = 3; }
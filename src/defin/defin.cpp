@@ -113,4 +113,14 @@ bool defin::replaceWires( dbBlock * block, const char * def_file )
     return _reader->replaceWires(block,def_file);
 }
 
+bool defin::convertToDb( std::vector<dbLib *> & libs,
+                         const char * def_file,
+                         const char * db_file )
+{
+    if ( libs.size() == 0 )
+        return false;
+
+    return _reader->convertToDb( libs, def_file, db_file );
+}
+
 } // namespace
@@ -46,6 +46,7 @@ class definINet
     virtual void nonDefaultRule( const char * rulename ) {}
     virtual void use( defSigType type ) {}
     virtual void wire( defWireType type ) {}
+    virtual bool skipWire() { return false; }
     virtual void path( const char * layer ) {}
     virtual void pathStyle( int style ) {}
     virtual void pathTaper( const char * layer ) {}
@@ -46,6 +46,7 @@ class definISNet
     virtual void connection( const char * iname, const char * pname, bool synthesized ) {}
     virtual void use( defSigType type ) {}
     virtual void wire( defWireType type, const char * shield ) {}
+    virtual bool skipWire( defWireType type ) { return false; }
     virtual void rect( const char * layer, int x1, int y1, int x2, int y2 ) {}
     virtual void polygon( const char * layer, std::vector<defPoint> & points ) {}
     virtual void path( const char * layer, int width ) {}
@@ -66,6 +66,7 @@ definNet::definNet()
     _replace_wires = false;
     _names_are_ids = false;
     _assembly_mode = false;
+    _spill_wires = false;
 }
 
 definNet::~definNet()
@@ -375,6 +376,11 @@ void definNet::xtalk(int value)
     _cur_net->setXTalkClass( value );
 }
 
+bool definNet::skipWire()
+{
+    return _skip_wires;
+}
+
 void definNet::wire( defWireType type )
 {
     if ( _skip_wires )
@@ -752,6 +758,8 @@ void definNet::end()
 
             if ( _replace_wires )
                 _cur_net->setWireAltered(true);
+            else if ( _spill_wires )
+                _block->spillWire(_wire);
         }
     }
     else
@@ -69,6 +69,7 @@ class definNet : public definINet, public definBase
     bool                   _names_are_ids;
     bool                   _assembly_mode;
     bool                   _found_new_routing;
+    bool                   _spill_wires;
     dbNet *                _cur_net;
     dbTechLayer *          _cur_layer;
     dbWireEncoder          _wire_encoder;
@@ -99,6 +100,7 @@ class definNet : public definINet, public definBase
     virtual void nonDefaultRule( const char * rule );
     virtual void use( defSigType type );
     virtual void wire( defWireType type );
+    virtual bool skipWire();
     virtual void path( const char * layer );
     virtual void pathStyle( int style );
     virtual void pathTaper( const char * layer );
@@ -131,6 +133,7 @@ class definNet : public definINet, public definBase
     void replaceWires()    { _replace_wires = true; }
     void setAssemblyMode() { _assembly_mode = true; }
     void namesAreDBIDs()   { _names_are_ids = true; }
+    void spillWires( bool value ) { _spill_wires = value; }
 };
     
 } // namespace
@@ -616,6 +616,33 @@ definReader::replaceWires( dbBlock * block, const char * def_file )
     return errors() == 0;
 }
 
+bool
+definReader::convertToDb( std::vector<dbLib *> & libs, const char * def_file, const char * db_file )
+{
+    // The routing of each net is spilled to disk as soon as the net is read.
+    _netR->spillWires(true);
+    dbChip * chip = createChip( libs, def_file );
+    _netR->spillWires(false);
+
+    if ( chip == NULL )
+        return false;
+
+    FILE * f = fopen( db_file, "wb" );
+
+    if ( f == NULL )
+    {
+        notice(0,"error: Cannot open database file %s\n", db_file );
+        dbChip::destroy(chip);
+        return false;
+    }
+
+    notice(0,"Writing database file: %s\n", db_file );
+    _db->write(f);
+    fclose(f);
+    dbChip::destroy(chip);
+    return true;
+}
+
 bool definReader::createBlock( const char * file )
 {
     FILE * f = fopen(file, "r");
@@ -115,6 +115,7 @@ class definReader : public definIReader, public definBase
     dbChip * createChip( std::vector<dbLib *> & search_libs, const char * def_file );
     dbBlock * createBlock( dbBlock * parent, std::vector<dbLib *> & search_libs, const char * def_file );
     bool replaceWires( dbBlock * block, const char * def_file );
+    bool convertToDb( std::vector<dbLib *> & search_libs, const char * def_file, const char * db_file );
 };
     
 } // namespace
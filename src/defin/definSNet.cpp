@@ -333,6 +333,14 @@ void definSNet::polygon( const char * layer_name, std::vector<defPoint> & points
     }
 }
 
+bool definSNet::skipWire( defWireType type )
+{
+    if ( _skip_special_wires )
+        return true;
+
+    return _skip_shields && (type == DEF_WIRE_SHIELD);
+}
+
 void definSNet::wire( defWireType type, const char * shield )
 {
     if ( _skip_special_wires )
@@ -89,6 +89,7 @@ class definSNet : public definISNet, public definBase
     virtual void rect( const char * layer, int x1, int y1, int x2, int y2 );
     virtual void polygon( const char * layer, std::vector<defPoint> & points );
     virtual void wire( defWireType type, const char * shield );
+    virtual bool skipWire( defWireType type );
     virtual void path( const char * layer, int width );
     virtual void pathStyle( int style );
     virtual void pathShape( const char * type );
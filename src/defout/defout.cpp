@@ -72,6 +72,16 @@ void defout::setVersion( Version v )
     _writer->setVersion( v );
 }
 
+void defout::selectWindow( const adsRect & window )
+{
+    _writer->selectWindow( window );
+}
+
+void defout::setThreads( uint threads )
+{
+    _writer->setThreads( threads );
+}
+
 bool
 defout::writeBlock( dbBlock * block, const char * def_file )
 {
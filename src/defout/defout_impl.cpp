@@ -30,10 +30,12 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdio.h>
+#include <algorithm>
 #include "db.h"
 #include "dbMap.h"
 #include "defout_impl.h"
 #include "dbWireCodec.h"
+#include "dbParallel.h"
 
 namespace odb {
 
@@ -97,7 +99,8 @@ void defout_impl::selectInst( dbInst *inst )
 bool defout_impl::writeBlock( dbBlock * block, const char * def_file )
 {
     if (! _select_net_list.empty()) {
-        _select_net_map = new dbMap<dbNet,char> (block->getNets());
+        if (!_select_net_map)
+            _select_net_map = new dbMap<dbNet,char> (block->getNets());
         std::list<dbNet*>::iterator sitr;
         for (sitr = _select_net_list.begin(); sitr != _select_net_list.end(); ++sitr) {
             dbNet *net = *sitr;
@@ -124,6 +127,9 @@ bool defout_impl::writeBlock( dbBlock * block, const char * def_file )
         }
     }
 
+    if ( _use_window )
+        selectWindow(block);
+
     _dist_factor = (double) block->getDefUnits() / (double) block->getDbUnitsPerMicron();
     _out = fopen( def_file, "w" );
 
@@ -172,6 +178,14 @@ bool defout_impl::writeBlock( dbBlock * block, const char * def_file )
     adsRect r;
     block->getDieArea(r);
 
+    if ( _use_window )
+    {
+        if ( r.area() == 0 )
+            r = _window;
+        else
+            r = r.intersect(_window);
+    }
+
     int x1 = defdist(r.xMin());
     int y1 = defdist(r.yMin());
     int x2 = defdist(r.xMax());
@@ -199,6 +213,9 @@ bool defout_impl::writeBlock( dbBlock * block, const char * def_file )
         delete _select_net_map;
     if (_select_inst_map)
         delete _select_inst_map;
+    _select_net_map = NULL;
+    _select_inst_map = NULL;
+    std::vector< std::vector<WindowPath> >().swap(_window_paths);
     return true;
 }
 
@@ -210,6 +227,16 @@ void defout_impl::writeRows( dbBlock * block )
     for( itr = rows.begin(); itr != rows.end(); ++itr )
     {
         dbRow * row = *itr;
+
+        if ( _use_window )
+        {
+            adsRect bbox;
+            row->getBBox(bbox);
+
+            if ( ! _window.intersects(bbox) )
+                continue;
+        }
+
         dbString n;
         int x, y, s, c;
         n = row->getName();
@@ -432,10 +459,19 @@ void defout_impl::writeVia( dbVia * via )
 void defout_impl::writeInsts( dbBlock * block )
 {
     dbSet<dbInst> insts = block->getInsts();
-
-    fprintf(_out, "COMPONENTS %u ;\n", insts.size() );
-    
     dbSet<dbInst>::iterator itr;
+    uint cnt = insts.size();
+
+    if ( _select_inst_map )
+    {
+        cnt = 0;
+
+        for( itr = insts.begin(); itr != insts.end(); ++itr )
+            if ( (*_select_inst_map)[*itr] )
+                ++cnt;
+    }
+
+    fprintf(_out, "COMPONENTS %u ;\n", cnt );
 
     for( itr = insts.begin(); itr != insts.end(); ++itr )
     {
@@ -693,6 +729,9 @@ void defout_impl::writeBTerms( dbBlock * block )
         if (net && _select_net_map && !(*_select_net_map)[net] )
             continue;
 
+        if ( _use_window && ! inWindow(bterm) )
+            continue;
+
         dbSet<dbBPin> bpins = bterm->getBPins();
         uint pcnt = bpins.size();
 
@@ -710,6 +749,8 @@ void defout_impl::writeBTerms( dbBlock * block )
         dbNet * net = bterm->getNet();
         if (net && _select_net_map && !(*_select_net_map)[net] )
             continue;
+        if ( _use_window && ! inWindow(bterm) )
+            continue;
         writeBTerm( bterm );
     }
 
@@ -832,11 +873,14 @@ void defout_impl::writeGroups( dbBlock * block )
         dbSet<dbInst>::iterator iitr;
         cnt = 0;
 
-        for( iitr = insts.begin(); iitr != insts.end(); ++iitr, ++cnt )
+        for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
         {
             dbInst * inst = *iitr;
 
-            if ( (cnt & 0x3) == 0x3 )
+            if ( _select_inst_map && !(*_select_inst_map)[inst] )
+                continue;
+
+            if ( (cnt++ & 0x3) == 0x3 )
                  fprintf(_out, "\n        " );
 
             dbString name = inst->getName();
@@ -1281,6 +1325,8 @@ void defout_impl::writeSNet( dbNet * net )
                 continue;
             
             dbInst * inst = iterm->getInst();
+            if ( _use_window && !(*_select_inst_map)[inst] )
+                continue;
             dbMTerm * mterm = iterm->getMTerm();
             //dbString mtname = mterm->getName();
             char *mtname = mterm->getName(inst, &ttname[0]);
@@ -1318,7 +1364,12 @@ void defout_impl::writeSNet( dbNet * net )
     dbSet<dbSWire>::iterator itr;
 
     for( itr = swires.begin(); itr != swires.end(); ++itr )
+    {
+        if ( _use_window && ! inWindow(*itr) )
+            continue;
+
         writeSWire( *itr );
+    }
 
     dbSourceType source = net->getSourceType();
 
@@ -1596,6 +1647,9 @@ void defout_impl::writeSWire( dbSWire * wire )
     {
         dbSBox * box = *itr;
 
+        if ( _use_window && ! inWindow(box) )
+            continue;
+
         if ( i++ > 0 )
             fprintf(_out, "\n      NEW");
             
@@ -1649,23 +1703,16 @@ void defout_impl::writeSWire( dbSWire * wire )
     }
 }
 
-void defout_impl::writeSpecialPath( dbSBox * box )
+// Compute the centerline and width of a special-wire path.
+static void
+specialPath( dbSBox * box, int & x1, int & y1, int & x2, int & y2, uint & w )
 {
-    dbTechLayer * l = box->getTechLayer();
-    dbString ln;
-
-    if ( _use_alias && l->hasAlias() )
-        ln = l->getAlias();
-    else
-        ln = l->getName();
-
-    int x1 = box->xMin();
-    int y1 = box->yMin();
-    int x2 = box->xMax();
-    int y2 = box->yMax();
+    x1 = box->xMin();
+    y1 = box->yMin();
+    x2 = box->xMax();
+    y2 = box->yMax();
     uint dx = x2 - x1;
     uint dy = y2 - y1;
-    uint w;
 
     switch( box->getDirection() )
     {
@@ -1738,6 +1785,24 @@ void defout_impl::writeSpecialPath( dbSBox * box )
             break;
         }
     }
+}
+
+void defout_impl::writeSpecialPath( dbSBox * box )
+{
+    dbTechLayer * l = box->getTechLayer();
+    dbString ln;
+
+    if ( _use_alias && l->hasAlias() )
+        ln = l->getAlias();
+    else
+        ln = l->getName();
+
+    int x1, y1, x2, y2;
+    uint w;
+    specialPath( box, x1, y1, x2, y2, w );
+
+    if ( _use_window )
+        clipSegment( x1, y1, x2, y2 );
 
     dbWireShapeType type = box->getWireShapeType();
 
@@ -1819,7 +1884,12 @@ void defout_impl::writeNet( dbNet * net )
     dbWire * wire = net->getWire();
     
     if ( wire )
-        writeWire( wire );
+    {
+        if ( _use_window )
+            writeWindowWire( net );
+        else
+            writeWire( wire );
+    }
 
    dbSourceType source = net->getSourceType();
 
@@ -2105,4 +2175,413 @@ void defout_impl::writePinProperties( dbBlock * block )
     fprintf(_out, "END PINPROPERTIES\n");
 }
 
+//
+// Window mode: select the instances, pins and nets that intersect the window.
+// The instance scan and the wire clipping are independent per object, so both
+// run in parallel; the selection maps are then filled in serially.
+//
+void defout_impl::selectWindow( dbBlock * block )
+{
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbNet> nets = block->getNets();
+    std::vector<dbInst *> inst_vec;
+    std::vector<dbNet *> net_vec;
+    uint max_id = 0;
+
+    inst_vec.reserve( insts.size() );
+    net_vec.reserve( nets.size() );
+
+    dbSet<dbInst>::iterator iitr;
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+        inst_vec.push_back( *iitr );
+
+    dbSet<dbNet>::iterator nitr;
+
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+    {
+        dbNet * net = *nitr;
+        net_vec.push_back( net );
+
+        if ( net->getId() > max_id )
+            max_id = net->getId();
+    }
+
+    std::vector<char> inst_in( inst_vec.size(), 0 );
+    std::vector<char> net_in( net_vec.size(), 0 );
+    _window_paths.clear();
+    _window_paths.resize( max_id + 1 );
+
+    dbParallelFor( inst_vec.size(), _threads, [&]( uint i )
+    {
+        adsRect bbox;
+        inst_vec[i]->getBBox()->getBox(bbox);
+        inst_in[i] = _window.intersects(bbox);
+    }, 1024 );
+
+    dbParallelFor( net_vec.size(), _threads, [&]( uint i )
+    {
+        dbNet * net = net_vec[i];
+
+        if ( net->isSpecial() )
+        {
+            dbSet<dbSWire> swires = net->getSWires();
+            dbSet<dbSWire>::iterator sitr;
+
+            for( sitr = swires.begin(); sitr != swires.end(); ++sitr )
+            {
+                if ( inWindow(*sitr) )
+                {
+                    net_in[i] = 1;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            dbWire * wire = net->getWire();
+
+            if ( wire )
+            {
+                std::vector<WindowPath> & paths = _window_paths[net->getId()];
+                clipWire( wire, paths );
+                net_in[i] = ! paths.empty();
+            }
+        }
+    }, 16 );
+
+    if ( _select_inst_map == NULL )
+        _select_inst_map = new dbMap<dbInst,char> (insts);
+
+    if ( _select_net_map == NULL )
+        _select_net_map = new dbMap<dbNet,char> (nets);
+
+    uint i;
+
+    for( i = 0; i < inst_vec.size(); ++i )
+        if ( inst_in[i] )
+            (*_select_inst_map)[inst_vec[i]] = 1;
+
+    // A net is written if it is routed through the window or if it connects
+    // to a written instance or pin.
+    for( i = 0; i < net_vec.size(); ++i )
+    {
+        dbNet * net = net_vec[i];
+
+        if ( net_in[i] )
+        {
+            (*_select_net_map)[net] = 1;
+            continue;
+        }
+
+        dbSet<dbITerm> iterms = net->getITerms();
+        dbSet<dbITerm>::iterator titr;
+
+        for( titr = iterms.begin(); titr != iterms.end(); ++titr )
+        {
+            if ( (*_select_inst_map)[(*titr)->getInst()] )
+            {
+                (*_select_net_map)[net] = 1;
+                break;
+            }
+        }
+
+        if ( (*_select_net_map)[net] )
+            continue;
+
+        dbSet<dbBTerm> bterms = net->getBTerms();
+        dbSet<dbBTerm>::iterator bitr;
+
+        for( bitr = bterms.begin(); bitr != bterms.end(); ++bitr )
+        {
+            if ( inWindow(*bitr) )
+            {
+                (*_select_net_map)[net] = 1;
+                break;
+            }
+        }
+    }
+}
+
+bool defout_impl::inWindow( dbBTerm * bterm )
+{
+    dbSet<dbBPin> bpins = bterm->getBPins();
+    dbSet<dbBPin>::iterator itr;
+
+    for( itr = bpins.begin(); itr != bpins.end(); ++itr )
+    {
+        adsRect r;
+        (*itr)->getBox()->getBox(r);
+
+        if ( _window.intersects(r) )
+            return true;
+    }
+
+    return false;
+}
+
+bool defout_impl::inWindow( dbSBox * box )
+{
+    if ( box->isVia() )
+    {
+        int x, y;
+        box->getViaXY(x,y);
+        return _window.intersects( adsPoint(x,y) );
+    }
+
+    int x1, y1, x2, y2;
+    uint w;
+    specialPath( box, x1, y1, x2, y2, w );
+    return clipSegment( x1, y1, x2, y2 );
+}
+
+bool defout_impl::inWindow( dbSWire * wire )
+{
+    dbSet<dbSBox> boxes = wire->getWires();
+    dbSet<dbSBox>::iterator itr;
+
+    for( itr = boxes.begin(); itr != boxes.end(); ++itr )
+        if ( inWindow(*itr) )
+            return true;
+
+    return false;
+}
+
+//
+// Clip the segment (x1,y1)-(x2,y2) to the window. Returns false if the
+// segment lies outside the window. Only orthogonal segments are clipped,
+// other segments are kept if both end-points are in the window.
+//
+bool defout_impl::clipSegment( int & x1, int & y1, int & x2, int & y2 )
+{
+    if ( (x1 != x2) && (y1 != y2) )
+        return _window.intersects( adsPoint(x1,y1) ) && _window.intersects( adsPoint(x2,y2) );
+
+    if ( (std::max(x1,x2) < _window.xMin()) || (std::min(x1,x2) > _window.xMax())
+         || (std::max(y1,y2) < _window.yMin()) || (std::min(y1,y2) > _window.yMax()) )
+        return false;
+
+    x1 = std::min( std::max( x1, _window.xMin() ), _window.xMax() );
+    x2 = std::min( std::max( x2, _window.xMin() ), _window.xMax() );
+    y1 = std::min( std::max( y1, _window.yMin() ), _window.yMax() );
+    y2 = std::min( std::max( y2, _window.yMin() ), _window.yMax() );
+    return true;
+}
+
+//
+// Decode the wire into clipped segments and vias. The decoder state follows
+// writeWire(). An extension is kept only on an end-point that was not clipped.
+//
+void defout_impl::clipWire( dbWire * wire, std::vector<WindowPath> & paths )
+{
+    dbWireDecoder decode;
+    WindowPath path;
+    bool fixed = (wire->getNet()->getWireType() == dbWireType::FIXED);
+    bool has_prev = false;
+    bool prev_has_ext = false;
+    int prev_x = 0;
+    int prev_y = 0;
+    int prev_ext = 0;
+
+    path._layer = NULL;
+    path._rule = NULL;
+    path._via = NULL;
+    path._tech_via = NULL;
+    path._has_ext1 = false;
+    path._has_ext2 = false;
+    path._ext1 = 0;
+    path._ext2 = 0;
+
+    for(  decode.begin(wire);; )
+    {
+        dbWireDecoder::OpCode opcode = decode.next();
+
+        switch( opcode )
+        {
+            case dbWireDecoder::PATH:
+            case dbWireDecoder::SHORT:
+            case dbWireDecoder::VWIRE:
+            case dbWireDecoder::JUNCTION:
+            {
+                path._layer = decode.getLayer();
+                path._type = decode.getWireType();
+                if ( fixed )
+                    path._type = dbWireType::FIXED;
+                path._rule = NULL;
+                has_prev = false;
+                break;
+            }
+
+            case dbWireDecoder::RULE:
+            {
+                if ( ! has_prev )
+                    path._rule = decode.getRule();
+                break;
+            }
+
+            case dbWireDecoder::POINT:
+            case dbWireDecoder::POINT_EXT:
+            {
+                int x, y;
+                int ext = 0;
+                bool has_ext = (opcode == dbWireDecoder::POINT_EXT);
+
+                if ( has_ext )
+                    decode.getPoint(x,y,ext);
+                else
+                    decode.getPoint(x,y);
+
+                if ( has_prev && ((x != prev_x) || (y != prev_y)) )
+                {
+                    WindowPath seg = path;
+                    seg._x1 = prev_x;
+                    seg._y1 = prev_y;
+                    seg._x2 = x;
+                    seg._y2 = y;
+
+                    if ( clipSegment( seg._x1, seg._y1, seg._x2, seg._y2 ) )
+                    {
+                        seg._has_ext1 = prev_has_ext && (seg._x1 == prev_x) && (seg._y1 == prev_y);
+                        seg._ext1 = prev_ext;
+                        seg._has_ext2 = has_ext && (seg._x2 == x) && (seg._y2 == y);
+                        seg._ext2 = ext;
+                        paths.push_back(seg);
+                    }
+                }
+
+                prev_x = x;
+                prev_y = y;
+                prev_ext = ext;
+                prev_has_ext = has_ext;
+                has_prev = true;
+                break;
+            }
+
+            case dbWireDecoder::VIA:
+            case dbWireDecoder::TECH_VIA:
+            {
+                if ( has_prev && _window.intersects( adsPoint(prev_x, prev_y) ) )
+                {
+                    WindowPath v = path;
+
+                    if ( opcode == dbWireDecoder::VIA )
+                        v._via = decode.getVia();
+                    else
+                        v._tech_via = decode.getTechVia();
+
+                    v._x1 = v._x2 = prev_x;
+                    v._y1 = v._y2 = prev_y;
+                    paths.push_back(v);
+                }
+
+                path._layer = decode.getLayer();
+                break;
+            }
+
+            case dbWireDecoder::ITERM:
+            case dbWireDecoder::BTERM:
+            case dbWireDecoder::BTERM_MAP_ID:
+                break;
+
+            case dbWireDecoder::END_DECODE:
+                return;
+        }
+    }
+}
+
+//
+// Write the clipped wire of this net, one DEF path per segment or via.
+//
+void defout_impl::writeWindowWire( dbNet * net )
+{
+    std::vector<WindowPath> & paths = _window_paths[net->getId()];
+    dbWireType prev_wire_type = dbWireType::NONE;
+    uint i;
+
+    for( i = 0; i < paths.size(); ++i )
+    {
+        WindowPath & p = paths[i];
+        dbString lname;
+
+        if ( _use_alias && p._layer->hasAlias() )
+            lname = p._layer->getAlias();
+        else
+            lname = p._layer->getName();
+
+        if ( (i == 0) || (p._type != prev_wire_type) )
+            fprintf(_out, "\n      + %s %s", p._type.getString(), lname.c_str() );
+        else
+            fprintf(_out, "\n      NEW %s", lname.c_str() );
+
+        prev_wire_type = p._type;
+
+        if ( p._rule )
+        {
+            dbTechNonDefaultRule * taper_rule = p._rule->getNonDefaultRule();
+
+            if ( _non_default_rule != taper_rule )
+            {
+                dbString name = taper_rule->getName();
+                fprintf(_out, " TAPERRULE %s ", name.c_str() );
+            }
+        }
+        else if ( _non_default_rule )
+        {
+            fprintf(_out, " TAPER");
+        }
+
+        int x1 = defdist(p._x1);
+        int y1 = defdist(p._y1);
+
+        if ( p._has_ext1 )
+            fprintf(_out, " ( %d %d %d )", x1, y1, defdist(p._ext1) );
+        else
+            fprintf(_out, " ( %d %d )", x1, y1 );
+
+        if ( p._via )
+        {
+            dbVia * via = p._via;
+
+            if ( (_version >= defout::DEF_5_6) && via->isViaRotated() )
+            {
+                dbString vname;
+
+                if ( via->getTechVia() )
+                    vname = via->getTechVia()->getName();
+                else
+                    vname = via->getBlockVia()->getName();
+
+                fprintf(_out, " %s %s", vname.c_str(), defOrient(via->getOrient()) );
+            }
+            else
+            {
+                dbString vname = via->getName();
+                fprintf(_out, " %s", vname.c_str() );
+            }
+        }
+        else if ( p._tech_via )
+        {
+            dbString vname = p._tech_via->getName();
+            fprintf(_out, " %s", vname.c_str() );
+        }
+        else
+        {
+            int x2 = defdist(p._x2);
+            int y2 = defdist(p._y2);
+
+            if ( x2 == x1 )
+                fprintf(_out, " ( * %d", y2 );
+            else if ( y2 == y1 )
+                fprintf(_out, " ( %d *", x2 );
+            else
+                fprintf(_out, " ( %d %d", x2, y2 );
+
+            if ( p._has_ext2 )
+                fprintf(_out, " %d )", defdist(p._ext2) );
+            else
+                fprintf(_out, " )" );
+        }
+    }
+}
+
 } // namespace
@@ -40,9 +40,18 @@
 #include "dbMap.h"
 #endif
 
+#ifndef ADS_DB_TYPES_H
+#include "dbTypes.h"
+#endif
+
+#ifndef ADS_GEOM_H
+#include "geom.h"
+#endif
+
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 #include "defout.h"
 
 namespace odb {
@@ -52,6 +61,9 @@ class dbBTerm;
 class dbInst;
 class dbTechNonDefaultRule;
 class dbTechLayerRule;;
+class dbTechLayer;
+class dbTechVia;
+class dbVia;
 
 class defout_impl
 {
@@ -67,6 +79,24 @@ class defout_impl
         ROW,
         SPECIALNET
     };
+
+    // A routed-wire segment or via, clipped to the window.
+    struct WindowPath
+    {
+        dbTechLayer *     _layer;
+        dbWireType        _type;
+        dbTechLayerRule * _rule;
+        dbVia *           _via;
+        dbTechVia *       _tech_via;
+        int               _x1;
+        int               _y1;
+        int               _x2;
+        int               _y2;
+        int               _ext1;
+        int               _ext2;
+        bool              _has_ext1;
+        bool              _has_ext2;
+    };
     
     double    _dist_factor;
     FILE *    _out;
@@ -80,6 +110,10 @@ class defout_impl
     dbTechNonDefaultRule * _non_default_rule;
     int       _version;
     std::map<std::string,bool> _prop_defs[9];
+    bool      _use_window;
+    adsRect   _window;
+    uint      _threads;
+    std::vector< std::vector<WindowPath> > _window_paths; // by net-id
 
     int defdist( int value ) 
     {
@@ -118,6 +152,13 @@ class defout_impl
     void writeProperties( dbObject * object );
     void writePinProperties( dbBlock * block );
     bool hasProperties( dbObject * object, ObjType type );
+    void selectWindow( dbBlock * block );
+    bool inWindow( dbBTerm * bterm );
+    bool inWindow( dbSBox * box );
+    bool inWindow( dbSWire * wire );
+    bool clipSegment( int & x1, int & y1, int & x2, int & y2 );
+    void clipWire( dbWire * wire, std::vector<WindowPath> & paths );
+    void writeWindowWire( dbNet * net );
     
   public:
 
@@ -129,6 +170,8 @@ class defout_impl
         _select_net_map = NULL;
         _select_inst_map = NULL;
         _version = defout::DEF_5_5;
+        _use_window = false;
+        _threads = 0;
     }
 
     ~defout_impl() {}
@@ -152,6 +195,14 @@ class defout_impl
 
     void selectInst( dbInst *inst );
     void setVersion( int v ) { _version = v; } 
+
+    void selectWindow( const adsRect & window )
+    {
+        _use_window = true;
+        _window = window;
+    }
+
+    void setThreads( uint threads ) { _threads = threads; }
     
     bool writeBlock( dbBlock * block, const char * def_file);
 };
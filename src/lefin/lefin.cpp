@@ -54,6 +54,7 @@
 #include <list>
 #include <algorithm>
 #include "lefin.h"
+#include "lefinMacro.h"
 #include "logger.h"
 
 extern int lefrRelaxMode; // This variable turns off strick checking in the lef 5.6 parser.
@@ -96,7 +97,10 @@ lefin::lefin( dbDatabase * db, bool ignore_non_routing_layers )
           _area_factor(1000000.0),
           _dbu_per_micron(1000),
           _override_lef_dbu(false),
-          _ignore_non_routing_layers(ignore_non_routing_layers)
+          _ignore_non_routing_layers(ignore_non_routing_layers),
+          _pipeline_macros(false),
+          _macro_queue(NULL),
+          _macro_record(NULL)
 {
 }
 
@@ -877,6 +881,17 @@ void lefin::layer( lefiLayer * layer )
 }
 
 void lefin::macroBegin( const char * name )
+{
+    if ( _macro_queue )
+    {
+        _macro_record = new lefinMacro(name);
+        return;
+    }
+
+    beginMaster(name);
+}
+
+void lefin::beginMaster( const char * name )
 {
     _master = NULL;
 
@@ -896,64 +911,88 @@ void lefin::macroBegin( const char * name )
 
 void lefin::macro( lefiMacro * macro )
 {
+    if ( _macro_record )
+    {
+        _macro_record->addAttributes(macro);
+        return;
+    }
+
     if ( _master == NULL )
         return;
 
-    if (macro->hasClass())
+    lefinMacroAttributes attr(macro);
+    setMasterAttributes(attr);
+}
+
+void lefin::setMasterAttributes( lefinMacroAttributes & attr )
+{
+    if (attr._has_class)
     {
-        dbMasterType type( macro->macroClass() );
+        dbMasterType type( attr._class.c_str() );
         _master->setType(type);
     }
     
-    if (macro->hasEEQ())
+    if (attr._has_eeq)
     {
-        dbMaster * eeq = _lib->findMaster( macro->EEQ() );
+        dbMaster * eeq = _lib->findMaster( attr._eeq.c_str() );
         _master->setEEQ(eeq);
     }
 
-    if (macro->hasLEQ())
+    if (attr._has_leq)
     {
-        dbMaster * leq = _lib->findMaster( macro->LEQ() );
+        dbMaster * leq = _lib->findMaster( attr._leq.c_str() );
         _master->setLEQ(leq);
     }
     
-    if (macro->hasSize())
+    if (attr._has_size)
     {
-        int w = dbdist( macro->sizeX() );
-        int h = dbdist( macro->sizeY() );
+        int w = dbdist( attr._size_x );
+        int h = dbdist( attr._size_y );
         _master->setWidth( w );
         _master->setHeight( h );
     }
     
-    if (macro->hasOrigin())
+    if (attr._has_origin)
     {
        
-        int x = dbdist( macro->originX() );
-        int y = dbdist( macro->originY() );
+        int x = dbdist( attr._origin_x );
+        int y = dbdist( attr._origin_y );
         _master->setOrigin(x,y);
     }
 
-    if (macro->hasSiteName())
+    if (attr._has_site)
     {
-        dbSite * site = _lib->findSite( macro->siteName() );
+        dbSite * site = _lib->findSite( attr._site.c_str() );
 
         if ( site == NULL )
-            notice(0,"warning: macro %s references unkown site %s\n", macro->name(), macro->siteName() );
+            notice(0,"warning: macro %s references unkown site %s\n", attr._name.c_str(), attr._site.c_str() );
         else
             _master->setSite(site);
     }
 
-    if ( macro->hasXSymmetry() )
+    if ( attr._symmetry_x )
         _master->setSymmetryX();
 
-    if ( macro->hasYSymmetry() )
+    if ( attr._symmetry_y )
         _master->setSymmetryY();
 
-    if ( macro->has90Symmetry() )
+    if ( attr._symmetry_r90 )
         _master->setSymmetryR90();
 }
 
 void lefin::macroEnd( const char * macroName )
+{
+    if ( _macro_record )
+    {
+        _macro_queue->push(_macro_record);
+        _macro_record = NULL;
+        return;
+    }
+
+    endMaster();
+}
+
+void lefin::endMaster()
 {
     if ( _master )
     {
@@ -976,6 +1015,36 @@ void lefin::macroEnd( const char * macroName )
     }
 }
 
+void lefin::commitMacro( lefinMacro * macro )
+{
+    beginMaster( macro->_name.c_str() );
+
+    if ( _master )
+    {
+        std::vector<lefinMacro::Item>::iterator itr;
+
+        for( itr = macro->_items.begin(); itr != macro->_items.end(); ++itr )
+        {
+            switch( itr->_type )
+            {
+                case lefinMacro::PIN:
+                    createPin( *itr->_pin );
+                    break;
+
+                case lefinMacro::OBSTRUCTION:
+                    addObstructions( itr->_obstruction );
+                    break;
+
+                case lefinMacro::ATTRIBUTES:
+                    setMasterAttributes( *itr->_attributes );
+                    break;
+            }
+        }
+    }
+
+    endMaster();
+}
+
 void lefin::manufacturing( double num )
 {
   _tech->setManufacturingGrid(dbdist(num));
@@ -1105,11 +1174,25 @@ void lefin::nonDefault( lefiNonDefault * rule )
 
 void lefin::obstruction( lefiObstruction * obs )
 {
-    if ( (_master == NULL) || (_skip_obstructions == true) )
+    if ( _skip_obstructions == true )
+        return;
+
+    if ( _macro_record )
+    {
+        if ( obs->geometries()->numItems() )
+            _macro_record->addObstruction( obs->geometries() );
+
+        return;
+    }
+
+    if ( _master == NULL )
         return;
 
-    lefiGeometries * geometries = obs->geometries();
+    addObstructions( obs->geometries() );
+}
 
+void lefin::addObstructions( lefiGeometries * geometries )
+{
     if ( geometries->numItems() )
     {
         addGeoms(_master, false, geometries);
@@ -1121,27 +1204,55 @@ void lefin::obstruction( lefiObstruction * obs )
     }
 }
 
+//
+// Resolve the layer of an antenna entry, NULL if the entry has no layer.
+//
+static dbTechLayer * antenna_layer( dbTech * tech, const lefinAntenna & a, dbMTerm * term )
+{
+    if ( ! a._has_layer )
+        return NULL;
+
+    dbTechLayer * layer = tech->findLayer( a._layer.c_str() );
+
+    if ( layer == NULL )
+        notice(0,"Invalid layer name %s in antenna info for term %s\n", a._layer.c_str(), term->getName().c_str());
+
+    return layer;
+}
+
 void lefin::pin( lefiPin * pin )
 {
+    if ( _macro_record )
+    {
+        _macro_record->addPin(pin);
+        return;
+    }
+
     if (_master == NULL)
        return;
 
+    lefinPin p(pin, false);
+    createPin(p);
+}
+
+void lefin::createPin( lefinPin & pin )
+{
     dbIoType io_type;
     
-    if ( pin->hasDirection() )
+    if ( pin._has_direction )
     {
-        if( streq( pin->direction(), "OUTPUT TRISTATE" ) )
+        if( streq( pin._direction.c_str(), "OUTPUT TRISTATE" ) )
             io_type = dbIoType( dbIoType::OUTPUT );
         else
-            io_type = dbIoType( pin->direction() );
+            io_type = dbIoType( pin._direction.c_str() );
     }
 
     dbSigType sig_type;
     
-    if (pin->lefiPin::hasUse())
-        sig_type = dbSigType( pin->use() );
+    if ( pin._has_use )
+        sig_type = dbSigType( pin._use.c_str() );
     
-    dbMTerm * term = _master->findMTerm( pin->name() );
+    dbMTerm * term = _master->findMTerm( pin._name.c_str() );
 
     if ( term == NULL )
     {
@@ -1149,154 +1260,67 @@ void lefin::pin( lefiPin * pin )
         {
             dbString n = _master->getName();
             notice(0,"Cannot add a new PIN (%s) to MACRO (%s), because the pins have already been defined. \n",
-                   pin->name(), n.c_str() );
+                   pin._name.c_str(), n.c_str() );
             return;
         }
         
-        term = dbMTerm::create( _master, pin->name(), io_type, sig_type );
+        term = dbMTerm::create( _master, pin._name.c_str(), io_type, sig_type );
     }
     
     //
-    // Parse and install antenna info
+    // Install antenna info
     //
-    int i;
-    dbTechLayer *tply;
-
-    if (pin->lefiPin::hasAntennaPartialMetalArea())
-      for (i = 0; i < pin->lefiPin::numAntennaPartialMetalArea(); i++)
-	{
-	  tply = NULL;
-	  if (pin->lefiPin::antennaPartialMetalAreaLayer(i))
-	    {
-	      tply = _tech->findLayer(pin->lefiPin::antennaPartialMetalAreaLayer(i));
-	      if (!tply)
-		notice(0,"Invalid layer name %s in antenna info for term %s\n", pin->lefiPin::antennaPartialMetalAreaLayer(i), term->getName().c_str());
-	    }
-
-	  term->addPartialMetalAreaEntry( pin->lefiPin::antennaPartialMetalArea(i), tply);
-	}
+    uint i;
 
-    if (pin->lefiPin::hasAntennaPartialMetalSideArea())
-      for (i = 0; i < pin->lefiPin::numAntennaPartialMetalSideArea(); i++)
-	{
-	  tply = NULL;
-	  if (pin->lefiPin::antennaPartialMetalSideAreaLayer(i))
-	    {
-	      tply = _tech->findLayer(pin->lefiPin::antennaPartialMetalSideAreaLayer(i));
-	      if (!tply)
-		notice(0,"Invalid layer name %s in antenna info for term %s\n", pin->lefiPin::antennaPartialMetalSideAreaLayer(i), term->getName().c_str());
-	    }
-
-	  term->addPartialMetalSideAreaEntry( pin->lefiPin::antennaPartialMetalSideArea(i), tply);
-	}
+    for( i = 0; i < pin._partial_metal_area.size(); ++i )
+    {
+        lefinAntenna & a = pin._partial_metal_area[i];
+        term->addPartialMetalAreaEntry( a._value, antenna_layer(_tech, a, term) );
+    }
 
-    if (pin->lefiPin::hasAntennaPartialCutArea())
-      for (i = 0; i < pin->lefiPin::numAntennaPartialCutArea(); i++)
-	{
-	  tply = NULL;
-	  if (pin->lefiPin::antennaPartialCutAreaLayer(i))
-	    {
-	      tply = _tech->findLayer(pin->lefiPin::antennaPartialCutAreaLayer(i));
-	      if (!tply)
-		notice(0,"Invalid layer name %s in antenna info for term %s\n", pin->lefiPin::antennaPartialCutAreaLayer(i), term->getName().c_str());
-	    }
-
-	  term->addPartialCutAreaEntry( pin->lefiPin::antennaPartialCutArea(i), tply);
-	}
+    for( i = 0; i < pin._partial_metal_side_area.size(); ++i )
+    {
+        lefinAntenna & a = pin._partial_metal_side_area[i];
+        term->addPartialMetalSideAreaEntry( a._value, antenna_layer(_tech, a, term) );
+    }
 
-    if (pin->lefiPin::hasAntennaDiffArea())
-      for (i = 0; i < pin->lefiPin::numAntennaDiffArea(); i++)
-	{
-	  tply = NULL;
-	  if (pin->lefiPin::antennaDiffAreaLayer(i))
-	    {
-	      tply = _tech->findLayer(pin->lefiPin::antennaDiffAreaLayer(i));
-	      if (!tply)
-		notice(0,"Invalid layer name %s in antenna info for term %s\n", pin->lefiPin::antennaDiffAreaLayer(i), term->getName().c_str());
-	    }
-
-	  term->addDiffAreaEntry( pin->lefiPin::antennaDiffArea(i), tply);
-	}
+    for( i = 0; i < pin._partial_cut_area.size(); ++i )
+    {
+        lefinAntenna & a = pin._partial_cut_area[i];
+        term->addPartialCutAreaEntry( a._value, antenna_layer(_tech, a, term) );
+    }
 
-    int j;
-    dbTechAntennaPinModel *curmodel;
-    lefiPinAntennaModel   *curlefmodel;
-    if (pin->lefiPin::numAntennaModel() > 0)
-      {
-	// NOTE: Only two different oxides supported for now!
-	for (i = 0; (i < pin->lefiPin::numAntennaModel()) && (i < 2); i++)
-	  {
-	    curmodel = (i == 1) ? term->createOxide2AntennaModel() : term->createDefaultAntennaModel();
-	    curlefmodel = pin->lefiPin::antennaModel(i);
+    for( i = 0; i < pin._diff_area.size(); ++i )
+    {
+        lefinAntenna & a = pin._diff_area[i];
+        term->addDiffAreaEntry( a._value, antenna_layer(_tech, a, term) );
+    }
 
-	    if (curlefmodel->hasAntennaGateArea())
-	      {
-		for (j = 0; j < curlefmodel->numAntennaGateArea(); j++)
-		  {
-		    tply = NULL;
-		    if (curlefmodel->antennaGateAreaLayer(j))
-		      {
-			tply = _tech->findLayer(curlefmodel->antennaGateAreaLayer(j));
-			if (!tply)
-			  notice(0,"Invalid layer name %s in antenna info for term %s\n", curlefmodel->antennaGateAreaLayer(j), term->getName().c_str());
-		      }
-		    curmodel->addGateAreaEntry( curlefmodel->antennaGateArea(j), tply);
-		  }
-	      }
+    uint j;
 
-	    if (curlefmodel->hasAntennaMaxAreaCar())
-	      {
-		for (j = 0; j < curlefmodel->numAntennaMaxAreaCar(); j++)
-		  {
-		    tply = NULL;
-		    if (curlefmodel->antennaMaxAreaCarLayer(j))
-		      {
-			tply = _tech->findLayer(curlefmodel->antennaMaxAreaCarLayer(j));
-			if (!tply)
-			  notice(0,"Invalid layer name %s in antenna info for term %s\n", curlefmodel->antennaMaxAreaCarLayer(j), term->getName().c_str());
-		      }
-		    curmodel->addMaxAreaCAREntry( curlefmodel->antennaMaxAreaCar(j), tply);
-		  }
-	      }
+    for( i = 0; i < pin._antenna_models.size(); ++i )
+    {
+        lefinAntennaModel & m = pin._antenna_models[i];
+        dbTechAntennaPinModel * model = (i == 1) ? term->createOxide2AntennaModel() : term->createDefaultAntennaModel();
 
-	    if (curlefmodel->hasAntennaMaxSideAreaCar())
-	      {
-		for (j = 0; j < curlefmodel->numAntennaMaxSideAreaCar(); j++)
-		  {
-		    tply = NULL;
-		    if (curlefmodel->antennaMaxSideAreaCarLayer(j))
-		      {
-			tply = _tech->findLayer(curlefmodel->antennaMaxSideAreaCarLayer(j));
-			if (!tply)
-			  notice(0,"Invalid layer name %s in antenna info for term %s\n", curlefmodel->antennaMaxSideAreaCarLayer(j), term->getName().c_str());
-		      }
-		    curmodel->addMaxSideAreaCAREntry( curlefmodel->antennaMaxSideAreaCar(j), tply);
-		  }
-	      }
+        for( j = 0; j < m._gate_area.size(); ++j )
+            model->addGateAreaEntry( m._gate_area[j]._value, antenna_layer(_tech, m._gate_area[j], term) );
 
-	    if (curlefmodel->hasAntennaMaxCutCar())
-	      {
-		for (j = 0; j < curlefmodel->numAntennaMaxCutCar(); j++)
-		  {
-		    tply = NULL;
-		    if (curlefmodel->antennaMaxCutCarLayer(j))
-		      {
-			tply = _tech->findLayer(curlefmodel->antennaMaxCutCarLayer(j));
-			if (!tply)
-			  notice(0,"Invalid layer name %s in antenna info for term %s\n", curlefmodel->antennaMaxCutCarLayer(j), term->getName().c_str());
-		      }
-		    curmodel->addMaxCutCAREntry( curlefmodel->antennaMaxCutCar(j), tply);
-		  }
-	      }
+        for( j = 0; j < m._max_area_car.size(); ++j )
+            model->addMaxAreaCAREntry( m._max_area_car[j]._value, antenna_layer(_tech, m._max_area_car[j], term) );
 
-	  }
-      }
+        for( j = 0; j < m._max_side_area_car.size(); ++j )
+            model->addMaxSideAreaCAREntry( m._max_side_area_car[j]._value, antenna_layer(_tech, m._max_side_area_car[j], term) );
+
+        for( j = 0; j < m._max_cut_car.size(); ++j )
+            model->addMaxCutCAREntry( m._max_cut_car[j]._value, antenna_layer(_tech, m._max_cut_car[j], term) );
+    }
 
     bool created_mpins = false;
-    int numPorts = pin->lefiPin::numPorts();
-    for (i = 0; i < numPorts; i++)
+
+    for( i = 0; i < pin._ports.size(); ++i )
     {
-        lefiGeometries * geometries = pin->lefiPin::port(i);
+        lefiGeometries * geometries = pin._ports[i];
         if ( geometries->numItems() )
         {
             dbMPin * dbpin = dbMPin::create(term);
@@ -1818,11 +1842,42 @@ void lefin::lineNumber(int lineNo)
     notice(0,"%d lines parsed!\n", lineNo);
 }
 
+void lefin::beginCallback()
+{
+    if ( _macro_queue )
+        _macro_queue->lock();
+}
+
+void lefin::endCallback()
+{
+    if ( _macro_queue )
+        _macro_queue->unlock();
+}
+
+void lefin::startMacroQueue()
+{
+    if ( _pipeline_macros && _macro_queue == NULL )
+        _macro_queue = new lefinMacroQueue(this);
+}
+
+void lefin::stopMacroQueue()
+{
+    // Commits the queued macros; an unfinished one is dropped.
+    delete _macro_queue;
+    delete _macro_record;
+    _macro_queue = NULL;
+    _macro_record = NULL;
+}
+
 bool lefin::readLef( const char * lef_file )
 {
     notice(0,"Reading LEF file:  %s\n", lef_file );
 
+    if ( _create_lib )
+        startMacroQueue();
+
     bool r =  lefin_parse( this, lef_file );
+    stopMacroQueue();
 
     if ( _layer_cnt )
         notice(0,"    Created %d technology layers\n", _layer_cnt);
@@ -1982,10 +2037,18 @@ dbLib * lefin::createTechAndLib( const char *lib_name, std::list<std::string> &f
 
     std::list<std::string>::iterator it;
     for (it = file_list.begin(); it != file_list.end(); ++it ) {
+      // The first file is the technology LEF; the macros of the remaining
+      // files are committed by the pipeline thread.
+      if ( it != file_list.begin() )
+        startMacroQueue();
+
       std::string str = *it;
       const char *lef_file = str.c_str(); 
+      beginCallback();
       notice(0,"Reading LEF file:  %s ...\n", lef_file );
+      endCallback();
       if (! lefin_parse( this, lef_file )) {
+        stopMacroQueue();
         notice(0,"Error reading %s\n",lef_file);
 
         if ( _lib )
@@ -1993,8 +2056,12 @@ dbLib * lefin::createTechAndLib( const char *lib_name, std::list<std::string> &f
         dbTech::destroy(_tech);
         return NULL;
       }
+      beginCallback();
       notice(0,"Finished LEF file:  %s\n", lef_file );
+      endCallback();
     }
+
+    stopMacroQueue();
                                                                                 
     if ( _layer_cnt )
         notice(0,"    Created %d technology layers\n", _layer_cnt);
@@ -0,0 +1,437 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "lefiMacro.hpp"
+#include "lefiMisc.hpp"
+#include "lefinMacro.h"
+#include "lefin.h"
+
+namespace odb {
+
+static void copy_antenna( lefinAntennaList & list, int n, double (lefiPin::*value)(int) const,
+                          const char * (lefiPin::*layer)(int) const, lefiPin * pin )
+{
+    list.resize(n);
+
+    int i;
+    for( i = 0; i < n; ++i )
+    {
+        const char * name = (pin->*layer)(i);
+        list[i]._value = (pin->*value)(i);
+        list[i]._has_layer = (name != NULL);
+
+        if ( name )
+            list[i]._layer = name;
+    }
+}
+
+static void copy_antenna( lefinAntennaList & list, int n, double (lefiPinAntennaModel::*value)(int) const,
+                          const char * (lefiPinAntennaModel::*layer)(int) const, lefiPinAntennaModel * model )
+{
+    list.resize(n);
+
+    int i;
+    for( i = 0; i < n; ++i )
+    {
+        const char * name = (model->*layer)(i);
+        list[i]._value = (model->*value)(i);
+        list[i]._has_layer = (name != NULL);
+
+        if ( name )
+            list[i]._layer = name;
+    }
+}
+
+static void copy_points( lefiGeometries * g, int n, const double * x, const double * y )
+{
+    int i;
+    for( i = 0; i < n; ++i )
+    {
+        if ( i == 0 )
+            g->startList(x[i], y[i]);
+        else
+            g->addToList(x[i], y[i]);
+    }
+}
+
+//
+// Copy the geometries through the lefiGeometries builder interface, the
+// same calls the parser uses to fill them.
+//
+static lefiGeometries * copy_geometries( lefiGeometries * src )
+{
+    lefiGeometries * g = new lefiGeometries;
+    int n = src->numItems();
+    int i;
+
+    for( i = 0; i < n; ++i )
+    {
+        switch( src->itemType(i) )
+        {
+            case lefiGeomLayerE:
+                g->addLayer( src->getLayer(i) );
+                break;
+
+            case lefiGeomLayerMinSpacingE:
+                g->addLayerMinSpacing( src->getLayerMinSpacing(i) );
+                break;
+
+            case lefiGeomLayerRuleWidthE:
+                g->addLayerRuleWidth( src->getLayerRuleWidth(i) );
+                break;
+
+            case lefiGeomWidthE:
+                g->addWidth( src->getWidth(i) );
+                break;
+
+            case lefiGeomPathE:
+            {
+                lefiGeomPath * p = src->getPath(i);
+                copy_points(g, p->numPoints, p->x, p->y);
+                g->addPath();
+                break;
+            }
+
+            case lefiGeomPathIterE:
+            {
+                lefiGeomPathIter * p = src->getPathIter(i);
+                copy_points(g, p->numPoints, p->x, p->y);
+                g->addStepPattern(p->xStart, p->yStart, p->xStep, p->yStep);
+                g->addPathIter();
+                break;
+            }
+
+            case lefiGeomRectE:
+            {
+                lefiGeomRect * r = src->getRect(i);
+                g->addRect(r->xl, r->yl, r->xh, r->yh);
+                break;
+            }
+
+            case lefiGeomRectIterE:
+            {
+                lefiGeomRectIter * r = src->getRectIter(i);
+                g->addStepPattern(r->xStart, r->yStart, r->xStep, r->yStep);
+                g->addRectIter(r->xl, r->yl, r->xh, r->yh);
+                break;
+            }
+
+            case lefiGeomPolygonE:
+            {
+                lefiGeomPolygon * p = src->getPolygon(i);
+                copy_points(g, p->numPoints, p->x, p->y);
+                g->addPolygon();
+                break;
+            }
+
+            case lefiGeomPolygonIterE:
+            {
+                lefiGeomPolygonIter * p = src->getPolygonIter(i);
+                copy_points(g, p->numPoints, p->x, p->y);
+                g->addStepPattern(p->xStart, p->yStart, p->xStep, p->yStep);
+                g->addPolygonIter();
+                break;
+            }
+
+            case lefiGeomViaE:
+            {
+                lefiGeomVia * v = src->getVia(i);
+                g->addVia(v->x, v->y, v->name);
+                break;
+            }
+
+            case lefiGeomViaIterE:
+            {
+                lefiGeomViaIter * v = src->getViaIter(i);
+                g->addStepPattern(v->xStart, v->yStart, v->xStep, v->yStep);
+                g->addViaIter(v->x, v->y, v->name);
+                break;
+            }
+
+            case lefiGeomClassE:
+                g->addClass( src->getClass(i) );
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return g;
+}
+
+lefinPin::lefinPin( lefiPin * pin, bool copy_ports )
+        : _name( pin->name() ),
+          _has_direction( pin->hasDirection() != 0 ),
+          _has_use( pin->lefiPin::hasUse() != 0 ),
+          _own_ports( copy_ports )
+{
+    if ( _has_direction )
+        _direction = pin->direction();
+
+    if ( _has_use )
+        _use = pin->use();
+
+    if ( pin->hasAntennaPartialMetalArea() )
+        copy_antenna( _partial_metal_area, pin->numAntennaPartialMetalArea(),
+                      &lefiPin::antennaPartialMetalArea, &lefiPin::antennaPartialMetalAreaLayer, pin );
+
+    if ( pin->hasAntennaPartialMetalSideArea() )
+        copy_antenna( _partial_metal_side_area, pin->numAntennaPartialMetalSideArea(),
+                      &lefiPin::antennaPartialMetalSideArea, &lefiPin::antennaPartialMetalSideAreaLayer, pin );
+
+    if ( pin->hasAntennaPartialCutArea() )
+        copy_antenna( _partial_cut_area, pin->numAntennaPartialCutArea(),
+                      &lefiPin::antennaPartialCutArea, &lefiPin::antennaPartialCutAreaLayer, pin );
+
+    if ( pin->hasAntennaDiffArea() )
+        copy_antenna( _diff_area, pin->numAntennaDiffArea(),
+                      &lefiPin::antennaDiffArea, &lefiPin::antennaDiffAreaLayer, pin );
+
+    // NOTE: Only two different oxides supported for now!
+    int num_models = pin->numAntennaModel() < 2 ? pin->numAntennaModel() : 2;
+    _antenna_models.resize( num_models );
+
+    int i;
+    for( i = 0; i < num_models; ++i )
+    {
+        lefiPinAntennaModel * m = pin->antennaModel(i);
+        lefinAntennaModel & model = _antenna_models[i];
+
+        if ( m->hasAntennaGateArea() )
+            copy_antenna( model._gate_area, m->numAntennaGateArea(),
+                          &lefiPinAntennaModel::antennaGateArea, &lefiPinAntennaModel::antennaGateAreaLayer, m );
+
+        if ( m->hasAntennaMaxAreaCar() )
+            copy_antenna( model._max_area_car, m->numAntennaMaxAreaCar(),
+                          &lefiPinAntennaModel::antennaMaxAreaCar, &lefiPinAntennaModel::antennaMaxAreaCarLayer, m );
+
+        if ( m->hasAntennaMaxSideAreaCar() )
+            copy_antenna( model._max_side_area_car, m->numAntennaMaxSideAreaCar(),
+                          &lefiPinAntennaModel::antennaMaxSideAreaCar, &lefiPinAntennaModel::antennaMaxSideAreaCarLayer, m );
+
+        if ( m->hasAntennaMaxCutCar() )
+            copy_antenna( model._max_cut_car, m->numAntennaMaxCutCar(),
+                          &lefiPinAntennaModel::antennaMaxCutCar, &lefiPinAntennaModel::antennaMaxCutCarLayer, m );
+    }
+
+    int num_ports = pin->numPorts();
+    _ports.reserve( num_ports );
+
+    for( i = 0; i < num_ports; ++i )
+    {
+        lefiGeometries * g = pin->port(i);
+        _ports.push_back( copy_ports ? copy_geometries(g) : g );
+    }
+}
+
+lefinPin::~lefinPin()
+{
+    if ( ! _own_ports )
+        return;
+
+    std::vector<lefiGeometries *>::iterator itr;
+
+    for( itr = _ports.begin(); itr != _ports.end(); ++itr )
+        delete *itr;
+}
+
+lefinMacroAttributes::lefinMacroAttributes( lefiMacro * macro )
+        : _name( macro->name() ),
+          _has_class( macro->hasClass() != 0 ),
+          _has_eeq( macro->hasEEQ() != 0 ),
+          _has_leq( macro->hasLEQ() != 0 ),
+          _has_size( macro->hasSize() != 0 ),
+          _size_x( 0.0 ),
+          _size_y( 0.0 ),
+          _has_origin( macro->hasOrigin() != 0 ),
+          _origin_x( 0.0 ),
+          _origin_y( 0.0 ),
+          _has_site( macro->hasSiteName() != 0 ),
+          _symmetry_x( macro->hasXSymmetry() != 0 ),
+          _symmetry_y( macro->hasYSymmetry() != 0 ),
+          _symmetry_r90( macro->has90Symmetry() != 0 )
+{
+    if ( _has_class )
+        _class = macro->macroClass();
+
+    if ( _has_eeq )
+        _eeq = macro->EEQ();
+
+    if ( _has_leq )
+        _leq = macro->LEQ();
+
+    if ( _has_size )
+    {
+        _size_x = macro->sizeX();
+        _size_y = macro->sizeY();
+    }
+
+    if ( _has_origin )
+    {
+        _origin_x = macro->originX();
+        _origin_y = macro->originY();
+    }
+
+    if ( _has_site )
+        _site = macro->siteName();
+}
+
+lefinMacro::~lefinMacro()
+{
+    std::vector<Item>::iterator itr;
+
+    for( itr = _items.begin(); itr != _items.end(); ++itr )
+    {
+        delete itr->_pin;
+        delete itr->_obstruction;
+        delete itr->_attributes;
+    }
+}
+
+void lefinMacro::addPin( lefiPin * pin )
+{
+    Item item = { PIN, new lefinPin(pin, true), NULL, NULL };
+    _items.push_back(item);
+}
+
+void lefinMacro::addObstruction( lefiGeometries * geometries )
+{
+    Item item = { OBSTRUCTION, NULL, copy_geometries(geometries), NULL };
+    _items.push_back(item);
+}
+
+void lefinMacro::addAttributes( lefiMacro * macro )
+{
+    Item item = { ATTRIBUTES, NULL, NULL, new lefinMacroAttributes(macro) };
+    _items.push_back(item);
+}
+
+lefinMacroQueue::lefinMacroQueue( lefin * lef )
+        : _lef(lef),
+          _busy(false),
+          _done(false),
+          _lock_depth(0),
+          _lock(_mutex, std::defer_lock)
+{
+    _worker = std::thread( &lefinMacroQueue::run, this );
+}
+
+lefinMacroQueue::~lefinMacroQueue()
+{
+    flush();
+
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        _done = true;
+    }
+
+    _cond.notify_all();
+    _worker.join();
+}
+
+void lefinMacroQueue::run()
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+
+    for(;;)
+    {
+        while( _pending.empty() && ! _done )
+            _cond.wait(guard);
+
+        if ( _pending.empty() )
+            break;
+
+        lefinMacro * macro = _pending.front();
+        _pending.pop_front();
+        _busy = true;
+        guard.unlock();
+        _cond.notify_all();
+
+        _lef->commitMacro(macro);
+        delete macro;
+
+        guard.lock();
+        _busy = false;
+
+        if ( _pending.empty() )
+            _cond.notify_all();
+    }
+}
+
+void lefinMacroQueue::push( lefinMacro * macro )
+{
+    _batch.push_back(macro);
+
+    if ( _batch.size() >= BATCH_SIZE )
+        flush();
+}
+
+void lefinMacroQueue::flush()
+{
+    if ( _batch.empty() )
+        return;
+
+    {
+        std::unique_lock<std::mutex> guard(_mutex);
+
+        while( _pending.size() >= MAX_PENDING )
+            _cond.wait(guard);
+
+        _pending.insert( _pending.end(), _batch.begin(), _batch.end() );
+    }
+
+    _batch.clear();
+    _cond.notify_all();
+}
+
+void lefinMacroQueue::lock()
+{
+    if ( _lock_depth++ != 0 )
+        return;
+
+    flush();
+    _lock.lock();
+
+    while( _busy || ! _pending.empty() )
+        _cond.wait(_lock);
+}
+
+void lefinMacroQueue::unlock()
+{
+    if ( --_lock_depth != 0 )
+        return;
+
+    _lock.unlock();
+}
+
+} // namespace
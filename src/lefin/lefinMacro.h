@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef ADS_LEFIN_MACRO_H
+#define ADS_LEFIN_MACRO_H
+
+#ifndef ADS_H
+#include "ads.h"
+#endif
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class lefiGeometries;
+class lefiMacro;
+class lefiPin;
+
+namespace odb {
+
+class lefin;
+
+//
+// Macro records: a parser-independent copy of the MACRO data lefin consumes.
+// The lef parser reuses its lefiMacro/lefiPin objects, so a macro that is
+// committed after the parser moved on must be captured first.
+//
+struct lefinAntenna
+{
+    double       _value;
+    bool         _has_layer;
+    std::string  _layer;
+};
+
+typedef std::vector<lefinAntenna> lefinAntennaList;
+
+struct lefinAntennaModel
+{
+    lefinAntennaList _gate_area;
+    lefinAntennaList _max_area_car;
+    lefinAntennaList _max_side_area_car;
+    lefinAntennaList _max_cut_car;
+};
+
+class lefinPin
+{
+  public:
+    std::string                     _name;
+    bool                            _has_direction;
+    std::string                     _direction;
+    bool                            _has_use;
+    std::string                     _use;
+    lefinAntennaList                _partial_metal_area;
+    lefinAntennaList                _partial_metal_side_area;
+    lefinAntennaList                _partial_cut_area;
+    lefinAntennaList                _diff_area;
+    std::vector<lefinAntennaModel>  _antenna_models;
+    std::vector<lefiGeometries *>   _ports;
+    bool                            _own_ports;
+
+    // If copy_ports is false, the ports refer to the parser's geometries.
+    lefinPin( lefiPin * pin, bool copy_ports );
+    ~lefinPin();
+};
+
+class lefinMacroAttributes
+{
+  public:
+    std::string  _name;
+    bool         _has_class;
+    std::string  _class;
+    bool         _has_eeq;
+    std::string  _eeq;
+    bool         _has_leq;
+    std::string  _leq;
+    bool         _has_size;
+    double       _size_x;
+    double       _size_y;
+    bool         _has_origin;
+    double       _origin_x;
+    double       _origin_y;
+    bool         _has_site;
+    std::string  _site;
+    bool         _symmetry_x;
+    bool         _symmetry_y;
+    bool         _symmetry_r90;
+
+    lefinMacroAttributes( lefiMacro * macro );
+};
+
+class lefinMacro
+{
+  public:
+    enum ItemType { PIN, OBSTRUCTION, ATTRIBUTES };
+
+    struct Item
+    {
+        ItemType                _type;
+        lefinPin *              _pin;
+        lefiGeometries *        _obstruction;
+        lefinMacroAttributes *  _attributes;
+    };
+
+    std::string        _name;
+    std::vector<Item>  _items;   // in parser callback order
+
+    lefinMacro( const char * name ) : _name(name) {}
+    ~lefinMacro();
+
+    void addPin( lefiPin * pin );
+    void addObstruction( lefiGeometries * geometries );
+    void addAttributes( lefiMacro * macro );
+};
+
+//
+// lefinMacroQueue - Commits recorded macros on a worker thread, in the order
+// they were pushed. The parser thread calls lock()/unlock() around anything
+// else that touches the database; lock() returns once every queued macro is
+// committed, so the database is never written by both threads at once.
+//
+class lefinMacroQueue
+{
+    enum Params { BATCH_SIZE = 32, MAX_PENDING = 256 };
+
+    lefin *                    _lef;
+    std::vector<lefinMacro *>  _batch;   // parser side, not yet handed over
+    std::mutex                 _mutex;
+    std::condition_variable    _cond;
+    std::deque<lefinMacro *>   _pending;
+    bool                       _busy;
+    bool                       _done;
+    int                        _lock_depth;
+    std::unique_lock<std::mutex> _lock;
+    std::thread                _worker;
+
+    void run();
+    void flush();
+
+  public:
+    lefinMacroQueue( lefin * lef );
+
+    // Commits the remaining macros and stops the worker.
+    ~lefinMacroQueue();
+
+    void push( lefinMacro * macro );
+    void lock();
+    void unlock();
+};
+
+} // namespace
+
+#endif
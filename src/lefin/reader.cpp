@@ -50,9 +50,23 @@
 
 namespace odb {
 
+//
+// lefinCallback - Wraps the lefin of a callback that may update the database.
+// When macros are pipelined the callback waits for the pending macros.
+//
+class lefinCallback
+{
+    lefin * _lef;
+
+  public:
+    lefinCallback( lefiUserData ud ) : _lef( (lefin *) ud ) { _lef->beginCallback(); }
+    ~lefinCallback() { _lef->endCallback(); }
+    lefin * operator->() { return _lef; }
+};
+
 static int antennaCB(lefrCallbackType_e c, double value, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     
     switch (c)
     {
@@ -83,133 +97,133 @@ static int antennaCB(lefrCallbackType_e c, double value, lefiUserData ud)
 
 static int arrayBeginCB(lefrCallbackType_e c, const char* name, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->arrayBegin(name);
     return 0;
 }
 
 static int arrayCB(lefrCallbackType_e c, lefiArray* a, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->array(a);
     return 0;
 }
 
 static int arrayEndCB(lefrCallbackType_e c, const char* name, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->arrayEnd(name);
     return 0;
 }
 
 static int busBitCharsCB(lefrCallbackType_e c, const char* busBit, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->busBitChars(busBit);
     return 0;
 }
 
 static int caseSensCB(lefrCallbackType_e c, int caseSense, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->caseSense(caseSense);
     return 0;
 }
 
 static int clearanceCB(lefrCallbackType_e c, const char* name, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->clearance(name);
     return 0;
 }
 
 static int dividerCB(lefrCallbackType_e c, const char* name, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->divider(name);
     return 0;
 }
 
 static int noWireExtCB(lefrCallbackType_e c, const char* name, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->noWireExt(name);
     return 0;
 }
 
 static int noiseMarCB(lefrCallbackType_e c, lefiNoiseMargin *noise, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->noiseMargin(noise);
     return 0;
 }
 
 static int edge1CB(lefrCallbackType_e c, double value, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->edge1(value);
     return 0;
 }
 
 static int edge2CB(lefrCallbackType_e c, double value, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->edge2(value);
     return 0;
 }
 
 static int edgeScaleCB(lefrCallbackType_e c, double value, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->edgeScale(value);
     return 0;
 }
 
 static int noiseTableCB(lefrCallbackType_e c, lefiNoiseTable *noise, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->noiseTable(noise);
     return 0;
 }
 
 static int correctionCB(lefrCallbackType_e c, lefiCorrectionTable *corr, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->correction(corr);
     return 0;
 }
 
 static int dielectricCB(lefrCallbackType_e c, double dielectric, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->dielectric(dielectric);
     return 0;
 }
 
 static int irdropBeginCB(lefrCallbackType_e c, void * ptr, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->irdropBegin(ptr);
     return 0;
 }
 
 static int irdropCB(lefrCallbackType_e c, lefiIRDrop* irdrop, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->irdrop(irdrop);
     return 0;
 }
 
 static int irdropEndCB(lefrCallbackType_e c, void* ptr, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->irdropEnd(ptr);
     return 0;
 }
 
 static int layerCB(lefrCallbackType_e c, lefiLayer* layer, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->layer(layer);
     return 0;
 }
@@ -237,28 +251,28 @@ static int macroEndCB(lefrCallbackType_e c, const char* name, lefiUserData ud)
 
 static int manufacturingCB(lefrCallbackType_e c, double num, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->manufacturing( num );
     return 0;
 }
 
 static int maxStackViaCB(lefrCallbackType_e c, lefiMaxStackVia * max, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->maxStackVia( max );
     return 0;
 }
 
 static int minFeatureCB(lefrCallbackType_e c, lefiMinFeature * min, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->minFeature( min );
     return 0;
 }
 
 static int nonDefaultCB(lefrCallbackType_e c, lefiNonDefault * def, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->nonDefault( def );
     return 0;
 }
@@ -279,63 +293,63 @@ static int pinCB(lefrCallbackType_e c, lefiPin * pin, lefiUserData ud)
 
 static int propDefBeginCB(lefrCallbackType_e c, void * ptr, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->propDefBegin( ptr );
     return 0;
 }
 
 static int propDefCB(lefrCallbackType_e c, lefiProp * prop, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->propDef( prop );
     return 0;
 }
 
 static int propDefEndCB(lefrCallbackType_e c, void * ptr, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->propDefEnd( ptr );
     return 0;
 }
 
 static int siteCB(lefrCallbackType_e c, lefiSite * site, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->site( site );
     return 0;
 }
 
 static int spacingBeginCB(lefrCallbackType_e c, void * ptr, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->spacingBegin( ptr );
     return 0;
 }
 
 static int spacingCB(lefrCallbackType_e c, lefiSpacing * spacing, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->spacing( spacing );
     return 0;
 }
 
 static int spacingEndCB(lefrCallbackType_e c, void * ptr, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->spacingEnd( ptr );
     return 0;
 }
 
 static int timingCB(lefrCallbackType_e c, lefiTiming * timing, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->timing( timing );
     return 0;
 }
 
 static int unitsCB(lefrCallbackType_e c, lefiUnits * unit, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->units( unit );
     return 0;
 }
@@ -343,54 +357,54 @@ static int unitsCB(lefrCallbackType_e c, lefiUnits * unit, lefiUserData ud)
 static int useMinSpacingCB(lefrCallbackType_e c, lefiUseMinSpacing * spacing,
                     lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->useMinSpacing( spacing );
     return 0;
 }
 
 static int versionCB(lefrCallbackType_e c, double num, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->version( num );
     return 0;
 }
 
 static int viaCB(lefrCallbackType_e c, lefiVia * via, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->via( via );
     return 0;
 }
 
 static int viaRuleCB(lefrCallbackType_e c, lefiViaRule * rule, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->viaRule( rule );
     return 0;
 }
 
 static int doneCB(lefrCallbackType_e c, void * ptr, lefiUserData ud)
 {
-    lefin * lef = (lefin *) ud;
+    lefinCallback lef(ud);
     lef->done( ptr );
     return 0;
 }
  
 static void errorCB(const char * msg)
 {
-    lefin * lef = (lefin *) lefrGetUserData();
+    lefinCallback lef(lefrGetUserData());
     lef->error( msg );
 }
 
 static void warningCB(const char * msg)
 {
-    lefin * lef = (lefin *) lefrGetUserData();
+    lefinCallback lef(lefrGetUserData());
     lef->warning( msg );
 }
 
 static void lineNumberCB(int line)
 {
-    lefin * lef = (lefin *) lefrGetUserData();
+    lefinCallback lef(lefrGetUserData());
     lef->lineNumber( line );
 }
 
@@ -0,0 +1,120 @@
+// Lazy iteration: obj.iterX() returns a dbSetCursor, a python iterator over
+// the objects of obj.getX() that does not build the list first.
+//
+// grid.iterGridX() (and iterGridY) of a dbTrackGrid or dbGCellGrid yields
+// the coordinates of grid.getGridX() one at a time, computing each
+// coordinate from the grid patterns.
+//
+// The other getters filling a std::vector (dbBlock getMasters and
+// findSome*, dbInst getConnectivity, dbNet getSrcCCSegs/getTgtCCSegs,
+// dbRSeg getCcSegs, dbTech getSameNetRules, dbTechLayer
+// getMinimumCutRules/getMinEnclosureRules, dbTechNonDefaultRule
+// getLayerRules/getVias/getSameNetRules/getUseVias/getUseViaRules) have no
+// iter variant: they build the vector in C++ before returning, so a lazy
+// wrapper would not save anything.
+%{
+static swig_type_info * dbObjectSwigType( odb::dbObject * obj )
+{
+    static swig_type_info * types[odb::dbNameObj + 1];
+    odb::dbObjectType type = obj->getObjectType();
+
+    if ( types[type] == NULL )
+    {
+        std::string name = std::string("odb::") + odb::dbObject::getObjName(type) + " *";
+        types[type] = SWIG_TypeQuery(name.c_str());
+    }
+
+    return types[type];
+}
+%}
+
+%extend odb::dbSetCursor {
+    PyObject * __next__()
+    {
+        odb::dbObject * obj = $self->next();
+
+        if ( obj == NULL )
+        {
+            PyErr_SetNone(PyExc_StopIteration);
+            return NULL;
+        }
+
+        return SWIG_NewInstanceObj(obj, dbObjectSwigType(obj), 0);
+    }
+
+    %pythoncode %{
+    def __iter__(self):
+        return self
+    %}
+}
+
+%define WRAP_DB_ITERATOR(CLASS, GETTER, ITER)
+%newobject odb::CLASS::ITER;
+%extend odb::CLASS {
+    odb::dbSetCursor * ITER() { return new odb::dbSetCursor( $self->GETTER() ); }
+}
+%enddef
+
+WRAP_DB_ITERATOR(dbDatabase, getLibs, iterLibs)
+WRAP_DB_ITERATOR(dbDatabase, getChips, iterChips)
+WRAP_DB_ITERATOR(dbBlock, getChildren, iterChildren)
+WRAP_DB_ITERATOR(dbBlock, getBTerms, iterBTerms)
+WRAP_DB_ITERATOR(dbBlock, getITerms, iterITerms)
+WRAP_DB_ITERATOR(dbBlock, getInsts, iterInsts)
+WRAP_DB_ITERATOR(dbBlock, getObstructions, iterObstructions)
+WRAP_DB_ITERATOR(dbBlock, getBlockages, iterBlockages)
+WRAP_DB_ITERATOR(dbBlock, getNets, iterNets)
+WRAP_DB_ITERATOR(dbBlock, getCapNodes, iterCapNodes)
+WRAP_DB_ITERATOR(dbBlock, getRSegs, iterRSegs)
+WRAP_DB_ITERATOR(dbBlock, getVias, iterVias)
+WRAP_DB_ITERATOR(dbBlock, getTrackGrids, iterTrackGrids)
+WRAP_DB_ITERATOR(dbBlock, getRows, iterRows)
+WRAP_DB_ITERATOR(dbBlock, getCCSegs, iterCCSegs)
+WRAP_DB_ITERATOR(dbBlock, getRegions, iterRegions)
+WRAP_DB_ITERATOR(dbBlock, getNonDefaultRules, iterNonDefaultRules)
+WRAP_DB_ITERATOR(dbBTerm, getBPins, iterBPins)
+WRAP_DB_ITERATOR(dbNet, getITerms, iterITerms)
+WRAP_DB_ITERATOR(dbNet, getBTerms, iterBTerms)
+WRAP_DB_ITERATOR(dbNet, getSWires, iterSWires)
+WRAP_DB_ITERATOR(dbNet, getCapNodes, iterCapNodes)
+WRAP_DB_ITERATOR(dbNet, getRSegs, iterRSegs)
+WRAP_DB_ITERATOR(dbInst, getITerms, iterITerms)
+WRAP_DB_ITERATOR(dbInst, getChildren, iterChildren)
+WRAP_DB_ITERATOR(dbVia, getBoxes, iterBoxes)
+WRAP_DB_ITERATOR(dbSWire, getWires, iterWires)
+WRAP_DB_ITERATOR(dbCapNode, getCCSegs, iterCCSegs)
+WRAP_DB_ITERATOR(dbRegion, getRegionInsts, iterRegionInsts)
+WRAP_DB_ITERATOR(dbRegion, getBoundaries, iterBoundaries)
+WRAP_DB_ITERATOR(dbRegion, getChildren, iterChildren)
+WRAP_DB_ITERATOR(dbLib, getMasters, iterMasters)
+WRAP_DB_ITERATOR(dbLib, getSites, iterSites)
+WRAP_DB_ITERATOR(dbMaster, getMTerms, iterMTerms)
+WRAP_DB_ITERATOR(dbMaster, getObstructions, iterObstructions)
+WRAP_DB_ITERATOR(dbMTerm, getMPins, iterMPins)
+WRAP_DB_ITERATOR(dbMTerm, getTargets, iterTargets)
+WRAP_DB_ITERATOR(dbMPin, getGeometry, iterGeometry)
+WRAP_DB_ITERATOR(dbTech, getLayers, iterLayers)
+WRAP_DB_ITERATOR(dbTech, getVias, iterVias)
+WRAP_DB_ITERATOR(dbTech, getNonDefaultRules, iterNonDefaultRules)
+WRAP_DB_ITERATOR(dbTech, getViaRules, iterViaRules)
+WRAP_DB_ITERATOR(dbTech, getViaGenerateRules, iterViaGenerateRules)
+WRAP_DB_ITERATOR(dbTechLayer, getMinCutRules, iterMinCutRules)
+WRAP_DB_ITERATOR(dbTechLayer, getMinEncRules, iterMinEncRules)
+WRAP_DB_ITERATOR(dbTechVia, getBoxes, iterBoxes)
+
+%define WRAP_DB_GRID_ITERATORS(CLASS)
+%extend odb::CLASS {
+    %pythoncode %{
+    def iterGridX(self):
+        for i in range(self.getGridCountX()):
+            yield self.getGridCoordX(i)
+
+    def iterGridY(self):
+        for i in range(self.getGridCountY()):
+            yield self.getGridCoordY(i)
+    %}
+}
+%enddef
+
+WRAP_DB_GRID_ITERATORS(dbTrackGrid)
+WRAP_DB_GRID_ITERATORS(dbGCellGrid)
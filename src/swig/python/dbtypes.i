@@ -125,6 +125,261 @@ WRAP_OBJECT_RETURN_REF(odb::dbViaParams, params_return)
 %apply std::vector<odb::dbShape> &OUTPUT { std::vector<odb::dbShape> & boxes };
 
 
+// Bulk arrays (dbBulkAccess, dbNetlistGraph): output vectors are returned as
+// read-only typed memoryviews over the vector items, without a copy
+// (numpy.frombuffer wraps them without a copy either). Input vectors accept
+// any C-contiguous buffer of the matching item type.
+%{
+#include <map>
+
+//
+// dbArrayBuffer - The object exporting the items of an array to a memoryview.
+// The array is either a vector owned by the buffer (the output vectors of
+// dbBulkAccess), or an array of the C++ object wrapped by owner, which the
+// buffer keeps alive (the arrays of a dbNetlistGraph). The exports of the
+// arrays of an object are counted by object in dbArrayExports, so the object
+// can refuse to reallocate its arrays while they are viewed.
+//
+struct dbArrayBuffer
+{
+    PyObject_HEAD
+    PyObject *   owner;
+    void *       vec;
+    void      (* free_vec)( void * vec );
+    const void * key;
+    void *       data;
+    Py_ssize_t   count;
+    Py_ssize_t   itemsize;
+    const char * format;
+};
+
+static std::map<const void *, int> dbArrayExports;
+
+static int dbArrayBufferGet( PyObject * obj, Py_buffer * view, int flags )
+{
+    static char empty[8];
+    dbArrayBuffer * b = (dbArrayBuffer *) obj;
+    void * data = b->data ? b->data : (void *) empty;
+
+    if ( PyBuffer_FillInfo( view, obj, data, b->count * b->itemsize, 1, flags ) != 0 )
+        return -1;
+
+    view->itemsize = b->itemsize;
+
+    if ( flags & PyBUF_FORMAT )
+        view->format = (char *) b->format;
+
+    if ( flags & PyBUF_ND )
+        view->shape = &b->count;
+
+    if ( b->key )
+        ++dbArrayExports[b->key];
+
+    return 0;
+}
+
+static void dbArrayBufferRelease( PyObject * obj, Py_buffer * )
+{
+    dbArrayBuffer * b = (dbArrayBuffer *) obj;
+
+    if ( b->key && (--dbArrayExports[b->key] == 0) )
+        dbArrayExports.erase(b->key);
+}
+
+static void dbArrayBufferFree( PyObject * obj )
+{
+    dbArrayBuffer * b = (dbArrayBuffer *) obj;
+    Py_XDECREF(b->owner);
+
+    if ( b->vec )
+        (*b->free_vec)(b->vec);
+
+    PyObject_Del(obj);
+}
+
+static PyTypeObject * dbArrayBufferType()
+{
+    static PyBufferProcs procs;
+    static PyTypeObject type = { PyVarObject_HEAD_INIT(NULL, 0) };
+
+    if ( type.tp_name == NULL )
+    {
+        procs.bf_getbuffer = dbArrayBufferGet;
+        procs.bf_releasebuffer = dbArrayBufferRelease;
+        type.tp_name = "opendbpy.dbArrayBuffer";
+        type.tp_basicsize = sizeof(dbArrayBuffer);
+        type.tp_flags = Py_TPFLAGS_DEFAULT;
+        type.tp_dealloc = dbArrayBufferFree;
+        type.tp_as_buffer = &procs;
+
+        if ( PyType_Ready(&type) < 0 )
+        {
+            type.tp_name = NULL;
+            return NULL;
+        }
+    }
+
+    return &type;
+}
+
+// A memoryview over count items at data, NULL (with the Python error set)
+// on failure. The vector vec is freed if the view cannot be created.
+static PyObject * dbArrayView( void * data, size_t count, size_t itemsize, const char * fmt,
+                               const void * key, void * vec, void (* free_vec)( void * ) )
+{
+    PyTypeObject * type = dbArrayBufferType();
+    dbArrayBuffer * b = type ? PyObject_New(dbArrayBuffer, type) : NULL;
+
+    if ( b == NULL )
+    {
+        if ( vec )
+            (*free_vec)(vec);
+
+        return NULL;
+    }
+
+    b->owner = NULL;
+    b->vec = vec;
+    b->free_vec = free_vec;
+    b->key = key;
+    b->data = data;
+    b->count = count;
+    b->itemsize = itemsize;
+    b->format = fmt;
+
+    PyObject * view = PyMemoryView_FromObject( (PyObject *) b );
+    Py_DECREF(b);
+    return view;
+}
+
+template <class T>
+static void dbArrayFree( void * vec )
+{
+    delete (std::vector< T > *) vec;
+}
+
+// A view over the items of a vector, moved into the view.
+template <class T>
+static PyObject * dbArrayViewMove( std::vector< T > & v, const char * fmt )
+{
+    std::vector< T > * vec = new std::vector< T >;
+    vec->swap(v);
+    return dbArrayView( vec->data(), vec->size(), sizeof( T ), fmt, NULL, vec, dbArrayFree< T > );
+}
+
+// A view over an array of the C++ object key. dbArrayViewKeep must tie it
+// to the Python object of key before the array can be reallocated.
+template <class T>
+static PyObject * dbArrayViewOf( const void * key, const std::vector< T > & v, const char * fmt )
+{
+    return dbArrayView( (void *) v.data(), v.size(), sizeof( T ), fmt, key, NULL, NULL );
+}
+%}
+
+%inline %{
+// Make a view returned by dbArrayViewOf keep owner alive.
+PyObject * dbArrayViewKeep( PyObject * view, PyObject * owner )
+{
+    if ( PyMemoryView_Check(view) )
+    {
+        PyObject * base = PyMemoryView_GET_BASE(view);
+
+        if ( base && (Py_TYPE(base) == dbArrayBufferType()) && (((dbArrayBuffer *) base)->owner == NULL) )
+        {
+            Py_INCREF(owner);
+            ((dbArrayBuffer *) base)->owner = owner;
+        }
+    }
+
+    Py_INCREF(view);
+    return view;
+}
+
+// True if an array of the C++ object is viewed.
+bool dbArrayViewed( const void * key )
+{
+    return dbArrayExports.find(key) != dbArrayExports.end();
+}
+%}
+
+%define WRAP_DB_ARRAY(T, FMT, ACCEPT)
+%typemap(in, numinputs=0) std::vector< T > &ARRAY_OUT (std::vector< T > temp) {
+    $1 = &temp;
+}
+
+%typemap(argout) std::vector< T > &ARRAY_OUT {
+    PyObject *o = dbArrayViewMove( *$1, FMT );
+
+    if ( o == NULL )
+        SWIG_fail;
+
+    $result = SWIG_Python_AppendOutput($result, o);
+}
+
+%typemap(in) const std::vector< T > &ARRAY_IN (std::vector< T > temp) {
+    Py_buffer view;
+
+    if ( PyObject_GetBuffer($input, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0 )
+        SWIG_fail;
+
+    const char *fmt = view.format ? view.format : "B";
+
+    if ( (*fmt == '@') || (*fmt == '=') || (*fmt == '<') )
+        ++fmt;
+
+    if ( (view.itemsize != sizeof( T )) || (strchr(ACCEPT, *fmt) == NULL) ) {
+        PyBuffer_Release(&view);
+        PyErr_SetString(PyExc_TypeError, "buffer of " #T " expected");
+        SWIG_fail;
+    }
+
+    temp.assign( (T *) view.buf, (T *) view.buf + view.len / sizeof( T ) );
+    PyBuffer_Release(&view);
+    $1 = &temp;
+}
+
+%typemap(typecheck) const std::vector< T > &ARRAY_IN {
+    $1 = PyObject_CheckBuffer($input) ? 1 : 0;
+}
+
+// arg1 is the object of the getter.
+%typemap(out) const std::vector< T > &ARRAY_RET {
+    $result = dbArrayViewOf( arg1, *$1, FMT );
+
+    if ( $result == NULL )
+        SWIG_fail;
+}
+%enddef
+
+WRAP_DB_ARRAY(int, "i", "il")
+WRAP_DB_ARRAY(uint, "I", "IL")
+WRAP_DB_ARRAY(double, "d", "d")
+
+%apply std::vector< uint > &ARRAY_OUT {
+    std::vector< uint > & inst_ids, std::vector< uint > & inst_masters,
+    std::vector< uint > & net_ids, std::vector< uint > & net_iterm_begin,
+    std::vector< uint > & iterm_ids, std::vector< uint > & iterm_insts,
+    std::vector< uint > & seg_nets, std::vector< uint > & seg_levels,
+    std::vector< uint > & rseg_ids, std::vector< uint > & rseg_nets,
+    std::vector< uint > & rseg_sources, std::vector< uint > & rseg_targets,
+    std::vector< uint > & node_ids, std::vector< uint > & node_nets
+};
+%apply std::vector< int > &ARRAY_OUT {
+    std::vector< int > & inst_x, std::vector< int > & inst_y, std::vector< int > & inst_orients,
+    std::vector< int > & seg_x1, std::vector< int > & seg_y1,
+    std::vector< int > & seg_x2, std::vector< int > & seg_y2
+};
+%apply std::vector< double > &ARRAY_OUT {
+    std::vector< double > & rseg_res, std::vector< double > & rseg_cap,
+    std::vector< double > & node_cap
+};
+%apply const std::vector< uint > &ARRAY_IN { const std::vector< uint > & inst_ids };
+%apply const std::vector< int > &ARRAY_IN {
+    const std::vector< int > & inst_x, const std::vector< int > & inst_y,
+    const std::vector< int > & inst_orients
+};
+
+
 // Wrap containers
 WRAP_DB_CONTAINER(odb::dbProperty)
 WRAP_DB_CONTAINER(odb::dbLib)
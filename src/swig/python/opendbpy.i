@@ -27,6 +27,8 @@
 #include "dbCCSegSet.h"
 #include "dbSet.h"
 #include "geom.h"
+#include "dbBulkAccess.h"
+#include "dbNetlistGraph.h"
 using namespace odb;
 %}
 
@@ -53,6 +55,15 @@ using namespace odb;
 %include "dbhelpers.i"
 %include "parserenums.i"
 
+// The bulk accessors of dbAttrColumn take raw arrays and are not wrapped,
+// use the per-object get/set methods.
+%ignore odb::dbAttrColumn::getInts;
+%ignore odb::dbAttrColumn::setInts;
+%ignore odb::dbAttrColumn::getDoubles;
+%ignore odb::dbAttrColumn::setDoubles;
+%ignore odb::dbAttrColumn::getBools;
+%ignore odb::dbAttrColumn::setBools;
+
 %include "geom.h"
 %include "dbObject.h"
 %include "dbViaParams.h"
@@ -78,6 +89,45 @@ using namespace odb;
 %include "dbgdefines.h"
 %include "dbCCSegSet.h"
 %include "dbSet.h"
+%include "dbiterators.i"
+%include "dbBulkAccess.h"
+
+// The CSR arrays of dbNetlistGraph are returned as read-only typed
+// memoryviews over the arrays of the graph. A view keeps the graph alive,
+// and build and clear raise BufferError while a view is alive.
+%define WRAP_DB_GRAPH_ARRAY(GETTER)
+%pythonappend odb::dbNetlistGraph::GETTER %{
+    val = dbArrayViewKeep(val, self)
+%}
+%enddef
+
+WRAP_DB_GRAPH_ARRAY(getNetIds)
+WRAP_DB_GRAPH_ARRAY(getInstIds)
+WRAP_DB_GRAPH_ARRAY(getNetPinBegin)
+WRAP_DB_GRAPH_ARRAY(getPinInsts)
+WRAP_DB_GRAPH_ARRAY(getPinNets)
+WRAP_DB_GRAPH_ARRAY(getPinIds)
+WRAP_DB_GRAPH_ARRAY(getPinOffsetX)
+WRAP_DB_GRAPH_ARRAY(getPinOffsetY)
+WRAP_DB_GRAPH_ARRAY(getInstNetBegin)
+WRAP_DB_GRAPH_ARRAY(getInstNets)
+WRAP_DB_GRAPH_ARRAY(getNetWeights)
+WRAP_DB_GRAPH_ARRAY(getInstWeights)
+
+%pythonprepend odb::dbNetlistGraph::build %{
+    if dbArrayViewed(self):
+        raise BufferError("the arrays of the graph are viewed")
+%}
+%pythonprepend odb::dbNetlistGraph::clear %{
+    if dbArrayViewed(self):
+        raise BufferError("the arrays of the graph are viewed")
+%}
+
+%apply const std::vector< int > &ARRAY_RET { const std::vector< int > & };
+%apply const std::vector< uint > &ARRAY_RET { const std::vector< uint > & };
+%include "dbNetlistGraph.h"
+%clear const std::vector< int > &;
+%clear const std::vector< uint > &;
 
 
 // Support file operations
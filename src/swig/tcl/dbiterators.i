@@ -0,0 +1,169 @@
+// Lazy iteration: "$obj foreachX var body" evaluates body with var set to
+// each object of "$obj getX", without building the list first. break and
+// continue behave as in foreach.
+//
+// "$grid foreachGridX var body" (and foreachGridY) walks the coordinates of
+// a dbTrackGrid or dbGCellGrid the same way, computing each coordinate from
+// the grid patterns.
+//
+// The other getters filling a std::vector (dbBlock getMasters and
+// findSome*, dbInst getConnectivity, dbNet getSrcCCSegs/getTgtCCSegs,
+// dbRSeg getCcSegs, dbTech getSameNetRules, dbTechLayer
+// getMinimumCutRules/getMinEnclosureRules, dbTechNonDefaultRule
+// getLayerRules/getVias/getSameNetRules/getUseVias/getUseViaRules) have no
+// foreach variant: they build the vector in C++ before returning, so a lazy
+// wrapper would not save anything.
+%{
+static swig_type_info * dbObjectSwigType( odb::dbObject * obj )
+{
+    static swig_type_info * types[odb::dbNameObj + 1];
+    odb::dbObjectType type = obj->getObjectType();
+
+    if ( types[type] == NULL )
+    {
+        std::string name = std::string("odb::") + odb::dbObject::getObjName(type) + " *";
+        types[type] = SWIG_TypeQuery(name.c_str());
+    }
+
+    return types[type];
+}
+
+typedef int dbTclCode;
+
+// Set var to value and evaluate body. Returns TCL_OK to go on, TCL_BREAK to
+// leave the loop, or the code the loop returns.
+static dbTclCode dbForeachStep( Tcl_Interp * interp, const char * var, Tcl_Obj * value, Tcl_Obj * body )
+{
+    if ( Tcl_SetVar2Ex(interp, var, NULL, value, TCL_LEAVE_ERR_MSG) == NULL )
+        return TCL_ERROR;
+
+    int code = Tcl_EvalObjEx(interp, body, 0);
+
+    if ( code == TCL_CONTINUE )
+        return TCL_OK;
+
+    return code;
+}
+
+static dbTclCode dbSetForeach( Tcl_Interp * interp, odb::dbSetCursor cursor, const char * var, Tcl_Obj * body )
+{
+    odb::dbObject * obj;
+
+    while ( (obj = cursor.next()) != NULL )
+    {
+        Tcl_Obj * o = SWIG_NewInstanceObj(obj, dbObjectSwigType(obj), 0);
+        int code = dbForeachStep(interp, var, o, body);
+
+        if ( code == TCL_BREAK )
+            break;
+
+        if ( code != TCL_OK )
+            return code;
+    }
+
+    Tcl_ResetResult(interp);
+    return TCL_OK;
+}
+
+template <class GRID>
+static dbTclCode dbGridForeach( Tcl_Interp * interp, GRID * grid, bool x, const char * var, Tcl_Obj * body )
+{
+    int n = x ? grid->getGridCountX() : grid->getGridCountY();
+    int i;
+
+    for( i = 0; i < n; ++i )
+    {
+        int coord = x ? grid->getGridCoordX(i) : grid->getGridCoordY(i);
+        int code = dbForeachStep(interp, var, Tcl_NewIntObj(coord), body);
+
+        if ( code == TCL_BREAK )
+            break;
+
+        if ( code != TCL_OK )
+            return code;
+    }
+
+    Tcl_ResetResult(interp);
+    return TCL_OK;
+}
+%}
+
+typedef int dbTclCode;
+
+%typemap(out) dbTclCode {
+    if ( $1 != TCL_OK )
+        return $1;
+}
+
+%define WRAP_DB_ITERATOR(CLASS, GETTER, ITER)
+%extend odb::CLASS {
+    dbTclCode ITER( Tcl_Interp * interp, const char * var, Tcl_Obj * body )
+    {
+        return dbSetForeach( interp, odb::dbSetCursor( $self->GETTER() ), var, body );
+    }
+}
+%enddef
+
+WRAP_DB_ITERATOR(dbDatabase, getLibs, foreachLibs)
+WRAP_DB_ITERATOR(dbDatabase, getChips, foreachChips)
+WRAP_DB_ITERATOR(dbBlock, getChildren, foreachChildren)
+WRAP_DB_ITERATOR(dbBlock, getBTerms, foreachBTerms)
+WRAP_DB_ITERATOR(dbBlock, getITerms, foreachITerms)
+WRAP_DB_ITERATOR(dbBlock, getInsts, foreachInsts)
+WRAP_DB_ITERATOR(dbBlock, getObstructions, foreachObstructions)
+WRAP_DB_ITERATOR(dbBlock, getBlockages, foreachBlockages)
+WRAP_DB_ITERATOR(dbBlock, getNets, foreachNets)
+WRAP_DB_ITERATOR(dbBlock, getCapNodes, foreachCapNodes)
+WRAP_DB_ITERATOR(dbBlock, getRSegs, foreachRSegs)
+WRAP_DB_ITERATOR(dbBlock, getVias, foreachVias)
+WRAP_DB_ITERATOR(dbBlock, getTrackGrids, foreachTrackGrids)
+WRAP_DB_ITERATOR(dbBlock, getRows, foreachRows)
+WRAP_DB_ITERATOR(dbBlock, getCCSegs, foreachCCSegs)
+WRAP_DB_ITERATOR(dbBlock, getRegions, foreachRegions)
+WRAP_DB_ITERATOR(dbBlock, getNonDefaultRules, foreachNonDefaultRules)
+WRAP_DB_ITERATOR(dbBTerm, getBPins, foreachBPins)
+WRAP_DB_ITERATOR(dbNet, getITerms, foreachITerms)
+WRAP_DB_ITERATOR(dbNet, getBTerms, foreachBTerms)
+WRAP_DB_ITERATOR(dbNet, getSWires, foreachSWires)
+WRAP_DB_ITERATOR(dbNet, getCapNodes, foreachCapNodes)
+WRAP_DB_ITERATOR(dbNet, getRSegs, foreachRSegs)
+WRAP_DB_ITERATOR(dbInst, getITerms, foreachITerms)
+WRAP_DB_ITERATOR(dbInst, getChildren, foreachChildren)
+WRAP_DB_ITERATOR(dbVia, getBoxes, foreachBoxes)
+WRAP_DB_ITERATOR(dbSWire, getWires, foreachWires)
+WRAP_DB_ITERATOR(dbCapNode, getCCSegs, foreachCCSegs)
+WRAP_DB_ITERATOR(dbRegion, getRegionInsts, foreachRegionInsts)
+WRAP_DB_ITERATOR(dbRegion, getBoundaries, foreachBoundaries)
+WRAP_DB_ITERATOR(dbRegion, getChildren, foreachChildren)
+WRAP_DB_ITERATOR(dbLib, getMasters, foreachMasters)
+WRAP_DB_ITERATOR(dbLib, getSites, foreachSites)
+WRAP_DB_ITERATOR(dbMaster, getMTerms, foreachMTerms)
+WRAP_DB_ITERATOR(dbMaster, getObstructions, foreachObstructions)
+WRAP_DB_ITERATOR(dbMTerm, getMPins, foreachMPins)
+WRAP_DB_ITERATOR(dbMTerm, getTargets, foreachTargets)
+WRAP_DB_ITERATOR(dbMPin, getGeometry, foreachGeometry)
+WRAP_DB_ITERATOR(dbTech, getLayers, foreachLayers)
+WRAP_DB_ITERATOR(dbTech, getVias, foreachVias)
+WRAP_DB_ITERATOR(dbTech, getNonDefaultRules, foreachNonDefaultRules)
+WRAP_DB_ITERATOR(dbTech, getViaRules, foreachViaRules)
+WRAP_DB_ITERATOR(dbTech, getViaGenerateRules, foreachViaGenerateRules)
+WRAP_DB_ITERATOR(dbTechLayer, getMinCutRules, foreachMinCutRules)
+WRAP_DB_ITERATOR(dbTechLayer, getMinEncRules, foreachMinEncRules)
+WRAP_DB_ITERATOR(dbTechVia, getBoxes, foreachBoxes)
+
+%define WRAP_DB_GRID_ITERATORS(CLASS)
+%extend odb::CLASS {
+    dbTclCode foreachGridX( Tcl_Interp * interp, const char * var, Tcl_Obj * body )
+    {
+        return dbGridForeach( interp, $self, true, var, body );
+    }
+
+    dbTclCode foreachGridY( Tcl_Interp * interp, const char * var, Tcl_Obj * body )
+    {
+        return dbGridForeach( interp, $self, false, var, body );
+    }
+}
+%enddef
+
+WRAP_DB_GRID_ITERATORS(dbTrackGrid)
+WRAP_DB_GRID_ITERATORS(dbGCellGrid)
@@ -27,6 +27,7 @@
 #include "dbCCSegSet.h"
 #include "dbSet.h"
 #include "dbTypes.h"
+#include "dbNetlistGraph.h"
 #include "geom.h"
 using namespace odb;
 %}
@@ -47,6 +48,15 @@ using namespace odb;
 %include "dbtypes.i"
 
 
+// The bulk accessors of dbAttrColumn take raw arrays and are not wrapped,
+// use the per-object get/set methods.
+%ignore odb::dbAttrColumn::getInts;
+%ignore odb::dbAttrColumn::setInts;
+%ignore odb::dbAttrColumn::getDoubles;
+%ignore odb::dbAttrColumn::setDoubles;
+%ignore odb::dbAttrColumn::getBools;
+%ignore odb::dbAttrColumn::setBools;
+
 %include "geom.h"
 %include "db.h"
 
@@ -73,6 +83,29 @@ using namespace odb;
 %include "dbRtTree.h"
 %include "dbgdefines.h"
 %include "dbCCSegSet.h"
+%include "dbiterators.i"
+
+// The CSR arrays of dbNetlistGraph are returned as lists of integers. Tcl has
+// no typed view of a C array, so unlike the Python memoryviews they are copies.
+%typemap(out) const std::vector< int > & {
+    Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
+
+    for( size_t i = 0; i < $1->size(); ++i )
+        Tcl_ListObjAppendElement(interp, list, Tcl_NewIntObj( (*$1)[i] ));
+
+    Tcl_SetObjResult(interp, list);
+}
+%typemap(out) const std::vector< uint > & {
+    Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
+
+    for( size_t i = 0; i < $1->size(); ++i )
+        Tcl_ListObjAppendElement(interp, list, Tcl_NewWideIntObj( (*$1)[i] ));
+
+    Tcl_SetObjResult(interp, list);
+}
+%include "dbNetlistGraph.h"
+%clear const std::vector< int > &;
+%clear const std::vector< uint > &;
 // Support file operations
 FILE *fopen(const char *name, const char *mode);
 int fclose(FILE *);
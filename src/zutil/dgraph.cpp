@@ -37,8 +37,13 @@ _________________________________________________________________*/
 #include "dgraph.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <deque>
 #include "assert.h"
 #include "logger.h"
+#include "dbParallel.h"
+
+// spfa() results
+enum { SPFA_OK = 0, SPFA_UPPER = 1, SPFA_CYCLE = 2 };
 
 
 Dgraph::Dgraph(int n) {
@@ -52,6 +57,10 @@ Dgraph::Dgraph(int n) {
   for(i = 0; i<n; i++)
    _upper[i] = 1e99;
   _n = n;
+  _csr_valid = false;
+  _ncomp = 0;
+  _solved = false;
+  _threads = 0;
 } 
 Dgraph::~Dgraph() {
   if(!_n)
@@ -72,7 +81,6 @@ Dgraph::~Dgraph() {
     delete cycles.get(i);
 }
 Dedge* Dgraph::add_edge(int s, int d, double wt, bool is_hold, bool preserve) {
-  Dedge *e = (Dedge *) malloc(sizeof(Dedge));
   if(s>=_n) {
     printf("Cannot add this edge, as source is > %d\n", _n);
     return NULL;
@@ -82,6 +90,7 @@ Dedge* Dgraph::add_edge(int s, int d, double wt, bool is_hold, bool preserve) {
     return NULL;
   }
   
+  Dedge *e = (Dedge *) malloc(sizeof(Dedge));
   e->s = s;
   e->d = d;
   e->wt = wt; 
@@ -96,7 +105,9 @@ Dedge* Dgraph::add_edge(int s, int d, double wt, bool is_hold, bool preserve) {
      _neighbors.insert(s, nei);
   }
   nei->insert(e, 1);
-  return NULL;
+  _csr_valid = false;
+  _solved = false;
+  return e;
 }
 void Dgraph::remove_edge(Dedge *e) {
   int v;
@@ -106,6 +117,8 @@ void Dgraph::remove_edge(Dedge *e) {
     return;
   } 
   nei->remove(e, v);
+  _csr_valid = false;
+  _solved = false;
 }
 void Dgraph::remove_negative_edges() {
   Darr<Dedge*> negative;
@@ -181,6 +194,7 @@ void Dgraph::modify(int i, double delta) {
       if(vul>0 && e->wt-vul>upe+0.001) {
         delta -= e->wt;
         e->wt = upe;
+        _dirty_edges.push_back(e);
         i = _pred[i];
         l++;
         continue;
@@ -192,8 +206,10 @@ void Dgraph::modify(int i, double delta) {
   double s;
   Dedge *e;
   sl.begin();
-  while(sl.next(e, s)) 
+  while(sl.next(e, s)) {
     e->wt -= s;
+    _dirty_edges.push_back(e);
+  }
 }
 bool Dgraph::relax(Dedge *e, bool *rest) {
   if(dist[e->d]<dist[e->s]+e->wt-1e-7) {
@@ -215,6 +231,8 @@ bool Dgraph::uppers_met() {
   return true; 
 } 
 void Dgraph::set_upper_bound(int i, double j) {
+  if(j<_upper[i])
+    _dirty_uppers.push_back(i);
   _upper[i] = j;
 }
 double Dgraph::get_upper_bound(int i) {
@@ -269,14 +287,18 @@ bool Dgraph::has_cycle() {
     while(_pred[k] != val-1) {
       if(!(_prede[k]->preserve)) {
         double w = _prede[k]->cwt+res;
-        if(w<_prede[k]->wt)
+        if(w<_prede[k]->wt) {
           _prede[k]->wt = w; 
+          _dirty_edges.push_back(_prede[k]);
+        }
       }
       k = _pred[k];
     }
     double w = _prede[k]->cwt+res;
-    if(!_prede[k]->preserve && w<_prede[k]->wt)
+    if(!_prede[k]->preserve && w<_prede[k]->wt) {
       _prede[k]->wt = w; 
+      _dirty_edges.push_back(_prede[k]);
+    }
     return true;
   }
   return false;
@@ -314,54 +336,286 @@ void Dgraph::get_slacks() {
   printf("The worst slack before is %g and after is %g\n", wsb, wsa);
   printf("The tns before is %g and after is %g\n", tnsb, tnsa);
 }
-bool Dgraph::bellmanford(bool *rest) {
+//
+// Build the CSR adjacency and the weakly connected components (union-find)
+// of the graph.
+//
+void Dgraph::build_csr() {
+  int i;
+  _csr_begin.assign(_n+1, 0);
+  _csr_edges.clear();
+  std::vector<int> parent(_n);
+  for(i = 0; i<_n; i++)
+    parent[i] = i;
+  for(i = 0; i<_n; i++) {
+    _csr_begin[i] = _csr_edges.size();
+    if(!neighbors_begin(i))
+      continue;
+    Dedge *e = NULL;
+    while(next_neighbor(e)) {
+      _csr_edges.push_back(e);
+      int a = e->s;
+      int b = e->d;
+      while(parent[a] != a)
+        a = parent[a] = parent[parent[a]];
+      while(parent[b] != b)
+        b = parent[b] = parent[parent[b]];
+      if(a != b)
+        parent[a<b ? b : a] = a<b ? a : b;
+    }
+  }
+  _csr_begin[_n] = _csr_edges.size();
+  _comp.resize(_n);
+  _ncomp = 0;
+  for(i = 0; i<_n; i++) {
+    int r = i;
+    while(parent[r] != r)
+      r = parent[r];
+    _comp[i] = (r == i) ? _ncomp++ : _comp[r];
+  }
+  _len.assign(_n, 0);
+  _inq.assign(_n, 0);
+  _csr_valid = true;
+}
+//
+// The predecessor graph has a cycle through the ancestors of i: a simple
+// path has less than nverts edges.
+//
+bool Dgraph::pred_cycle(int i, int nverts) {
   int j;
+  for(j = 0; j<nverts; j++) {
+    if(_pred[i] == i)
+      return false;
+    i = _pred[i];
+  }
+  return true;
+}
+//
+// Queue based (SPFA) longest-path relaxation from the seed vertices, which
+// are given in topological order. A positive cycle is detected from the
+// predecessor graph, checked each time the path length of a vertex grows by
+// nverts edges. Returns SPFA_OK, or SPFA_UPPER/SPFA_CYCLE with the vertex
+// in bad; the vertices left to propagate are added to pending.
+//
+int Dgraph::spfa(const int *seeds, int nseeds, int nverts, bool check_upper, int &bad, std::vector<int> &pending) {
+  std::deque<int> queue;
+  int i;
+  for(i = 0; i<nseeds; i++) {
+    if(_inq[seeds[i]])
+      continue;
+    _inq[seeds[i]] = 1;
+    queue.push_back(seeds[i]);
+  }
+  int status = SPFA_OK;
+  while(!queue.empty() && status == SPFA_OK) {
+    int v = queue.front();
+    queue.pop_front();
+    _inq[v] = 0;
+    int j;
+    for(j = _csr_begin[v]; j<_csr_begin[v+1]; j++) {
+      Dedge *e = _csr_edges[j];
+      int d = e->d;
+      // A self loop is never on a longest path.
+      if(d == v || !(dist[d]<dist[v]+e->wt-1e-7))
+        continue;
+      _pred[d] = v;
+      _prede[d] = e;
+      dist[d] = dist[v]+e->wt;
+      _len[d] = _len[v]+1;
+      if(check_upper && dist[d]>_upper[d]*(1+1e-3)+0.001) {
+        bad = d;
+        status = SPFA_UPPER;
+        break;
+      }
+      if(_len[d]%nverts == 0 && pred_cycle(d, nverts)) {
+        bad = d;
+        status = SPFA_CYCLE;
+        break;
+      }
+      if(!_inq[d]) {
+        _inq[d] = 1;
+        queue.push_back(d);
+      }
+    }
+  }
+  for(i = 0; i<(int)queue.size(); i++) {
+    _inq[queue[i]] = 0;
+    pending.push_back(queue[i]);
+  }
+  if(status != SPFA_OK)
+    pending.push_back(bad);
+  return status;
+}
+//
+// Handle the result of a relaxation: an upper bound violation is fixed with
+// modify() and a cycle with has_cycle(), as bellmanford() always did. After
+// a violation resolve() carries on from the pending vertices; a cycle needs
+// a new bellmanford().
+//
+bool Dgraph::solved(int status, int bad, bool *rest) {
+  if(status == SPFA_UPPER) {
+    *rest = true;
+    double delta = dist[bad]-_upper[bad];
+    assert(delta>0);
+    modify(bad, delta);
+    return false;
+  }
+  if(status == SPFA_CYCLE && has_cycle()) {
+    _solved = false;
+    return false;
+  }
+  return true;
+}
+//
+// Longest paths from all vertices (every distance starts at zero). Each
+// weakly connected component is relaxed from a queue seeded in topological
+// order, so an acyclic component settles in one pass over its edges; the
+// components are solved in parallel.
+//
+bool Dgraph::bellmanford(bool *rest) {
   int i;
   init();
-  Dedge *e = NULL;
-  double delta = 0;
+  if(!_csr_valid)
+    build_csr();
   if(rest)
     *rest = false;
-  for(j = _n-1; j>=0; j--) {
-    bool changed = false; 
-    for(i = _n-1; i>=0; i--) {
-      int k = _topo_sorted.get(i);
-      if(!neighbors_begin(k))
-        continue;
-      while(next_neighbor(e)) {
-        if(rest)
-          *rest = false;
-        if(relax(e, rest)) {
-          changed = true;
-          if(rest && *rest) {
-            delta = dist[e->d]-_upper[e->d];
-            assert(delta>0);
-            modify(e->d, delta);
-            return false;
-          } 
-        }
+  _solved = false;
+  _dirty_edges.clear();
+  _dirty_uppers.clear();
+  std::vector<int> comp_begin(_ncomp+1, 0);
+  std::vector<int> comp_verts(_n);
+  for(i = 0; i<_n; i++)
+    comp_begin[_comp[i]+1]++;
+  for(i = 0; i<_ncomp; i++)
+    comp_begin[i+1] += comp_begin[i];
+  std::vector<int> pos(comp_begin.begin(), comp_begin.end()-1);
+  for(i = _n-1; i>=0; i--) {
+    int k = _topo_sorted.get(i);
+    comp_verts[pos[_comp[k]]++] = k;
+  }
+  for(i = 0; i<_n; i++)
+    _len[i] = 0;
+  std::vector<int> status(_ncomp, SPFA_OK);
+  std::vector<int> bad(_ncomp, 0);
+  std::vector< std::vector<int> > pending(_ncomp);
+  odb::dbParallelFor(_ncomp, _threads, [&](uint c) {
+    int nverts = comp_begin[c+1]-comp_begin[c];
+    int v = comp_verts[comp_begin[c]];
+    if(nverts>1 || _csr_begin[v+1]>_csr_begin[v])
+      status[c] = spfa(&comp_verts[comp_begin[c]], nverts, nverts, rest != NULL, bad[c], pending[c]);
+  }, 1);
+  _pending.clear();
+  for(i = 0; i<_ncomp; i++)
+    _pending.insert(_pending.end(), pending[i].begin(), pending[i].end());
+  _solved = true;
+  for(i = 0; i<_ncomp; i++) {
+    if(status[i] != SPFA_OK)
+      return solved(status[i], bad[i], rest);
+  }
+  return true;
+}
+//
+// Re-solve after modify()/set_upper_bound() without starting over: only the
+// vertices whose longest path used a modified edge are reset, and they are
+// relaxed again from their in-edges together with the vertices a stopped
+// relaxation left pending. Falls back to bellmanford() if the graph changed
+// or was not solved.
+//
+bool Dgraph::resolve(bool *rest) {
+  if(!_solved || !_csr_valid)
+    return bellmanford(rest);
+  if(rest)
+    *rest = false;
+  int i;
+  // The weights only decrease, so the distances of the subtrees (in the
+  // predecessor tree) below the modified edges are no longer valid.
+  std::vector<int> child_begin(_n+1, 0);
+  std::vector<int> children(_n);
+  for(i = 0; i<_n; i++) {
+    if(_pred[i] != i)
+      child_begin[_pred[i]+1]++;
+  }
+  for(i = 0; i<_n; i++)
+    child_begin[i+1] += child_begin[i];
+  std::vector<int> pos(child_begin.begin(), child_begin.end()-1);
+  for(i = 0; i<_n; i++) {
+    if(_pred[i] != i)
+      children[pos[_pred[i]]++] = i;
+  }
+  std::vector<char> reset(_n, 0);
+  std::vector<char> seed(_n, 0);
+  std::vector<int> stack;
+  for(i = 0; i<(int)_pending.size(); i++)
+    seed[_pending[i]] = 1;
+  _pending.clear();
+  for(i = 0; i<(int)_dirty_edges.size(); i++) {
+    Dedge *e = _dirty_edges[i];
+    seed[e->s] = 1;
+    if(_prede[e->d] != e || reset[e->d])
+      continue;
+    reset[e->d] = 1;
+    stack.push_back(e->d);
+  }
+  _dirty_edges.clear();
+  while(!stack.empty()) {
+    int k = stack.back();
+    stack.pop_back();
+    dist[k] = 0;
+    _pred[k] = k;
+    _prede[k] = NULL;
+    _len[k] = 0;
+    seed[k] = 1;
+    int j;
+    for(j = child_begin[k]; j<child_begin[k+1]; j++) {
+      if(!reset[children[j]]) {
+        reset[children[j]] = 1;
+        stack.push_back(children[j]);
       }
     }
-    if(!changed) {
-      return true;
-    }
-    if(has_cycle()) {
-      return false;
+  }
+  // The reset vertices are relaxed again from all of their in-edges.
+  for(i = 0; i<(int)_csr_edges.size(); i++) {
+    Dedge *e = _csr_edges[i];
+    if(reset[e->d])
+      seed[e->s] = 1;
+  }
+  std::vector<int> seeds;
+  for(i = _n-1; i>=0; i--) {
+    int k = _topo_sorted.get(i);
+    if(seed[k])
+      seeds.push_back(k);
+  }
+  // A lowered upper bound of a vertex that keeps its distance.
+  if(rest) {
+    for(i = 0; i<(int)_dirty_uppers.size(); i++) {
+      int k = _dirty_uppers[i];
+      if(!reset[k] && dist[k]>_upper[k]*(1+1e-3)+0.001) {
+        _pending = seeds;
+        return solved(SPFA_UPPER, k, rest);
+      }
     }
   }
-  return true;
+  _dirty_uppers.clear();
+  if(seeds.empty())
+    return true;
+  int bad = 0;
+  int status = spfa(&seeds[0], seeds.size(), _n, rest != NULL, bad, _pending);
+  return solved(status, bad, rest);
+}
+void Dgraph::set_threads(int threads) {
+  _threads = threads;
 }
 bool Dgraph::find_longest_path() {
   int i;
   init();
+  if(!_csr_valid)
+    build_csr();
+  _solved = false;
   for(i = _n-1; i>=0; i--) {
     int k = _topo_sorted.get(i);
-    if(!neighbors_begin(k))
-      continue;
-    Dedge *e = NULL;
-    while(next_neighbor(e)) {
-      relax(e);
-    }
+    int j;
+    for(j = _csr_begin[k]; j<_csr_begin[k+1]; j++)
+      relax(_csr_edges[j]);
   }
   return true;
 }
@@ -35,11 +35,17 @@
 #include "graph.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <algorithm>
+#include <functional>
+#include <queue>
 #include "assert.h"
 #include "logger.h"
+#include "dbParallel.h"
 
 #define MAXIT 1000
 #define LARGE 2000000000
+#define POT_LARGE (LONG_MAX/4)
 int cmpwt(const void *a, const void *b) {
   Edge *ae = *(Edge**)a;
   Edge *be = *(Edge**)b;
@@ -94,6 +100,10 @@ void Graph::sort_neighbor_weights(void) {
 Graph::Graph(int n) {
   _num_left = n;
   _num_vert = n;
+  _csr_valid = false;
+  _ncomp = 0;
+  _opt_valid = false;
+  _threads = 0;
   _match = (int *) malloc(n*sizeof(int));
   int i;
   for(i = 0; i<n; i++) {
@@ -107,6 +117,8 @@ void Graph::set_num_left(int n=0) {
   assert(_num_left == 0);
   _num_left = n;
   _num_vert = n;
+  _csr_valid = false;
+  _opt_valid = false;
   _match = (int *) malloc(n*sizeof(int));
   int i;
   for(i = 0; i<n; i++) {
@@ -122,6 +134,8 @@ int Graph::get_num_left(void) {
 void Graph::add_right_vertex(int thresh) {
   Darr<Edge *> *neigh = new Darr<Edge *>;
   _num_vert++;
+  _csr_valid = false;
+  _opt_valid = false;
   _neighbors.insert(neigh);
   _degree.insert(0);
   _thresh.insert(thresh);
@@ -137,9 +151,15 @@ void Graph::add_edge(int left, int right, long wt) {
   kv.val = right;
   Edge *ed;
   if(_edge_table.find(kv, ed)) {
+    if(ed->wt != wt) {
+      _csr_valid = false;
+      _dirty.push_back(left);
+    }
     ed->wt = wt;
     return;
   }
+  _csr_valid = false;
+  _dirty.push_back(left);
   ed = (Edge *) malloc(sizeof(Edge));
   ed->left = left;
   ed->right = right;
@@ -241,99 +261,6 @@ void Graph::dfs(int i, int *vis, int k, Darr<Edge*> *edg, Hash<Edge*, int> &edge
   }
 }
 
-static void relax(int u, int v, long wt, long *dist, int *pred) {
-  if(dist[u] >= LARGE)
-    return;
-  int d = dist[u]+wt;
-  if(d<dist[v]) {
-    dist[v] = d;
-    pred[v] = u;
-  }
-  return;
-}
-static int cycle_rec(int i, int *pred, int *vis, int l, int &k) {
-  if(vis[i] == l ) {
-    k = i;
-    return 1;
-  }
-  if(vis[i])
-    return 0;
-  if(pred[i] == i)
-    return 0;
-  vis[i] = l;
-  return cycle_rec(pred[i], pred, vis, l, k);
-}
-int Graph::_negative_cycle(long *dist, int *pred, int *vis, int *rightd, int &k) {
-  int i;
-  int n = _num_vert;
-  for(i = 0; i<n; i++) 
-    vis[i] = 0;
-  int l = 0;
-  for(i = 0; i<n; i++) {
-    if(vis[i])
-      continue;
-    l++;
-    if(cycle_rec(i, pred, vis, l, k)) {
-      if(k<_num_left)
-        k = pred[k];
-      return 1;
-    }
-  }
-  for(i = _num_left; i<n; i++) {
-    if((dist[i]<0) && (rightd[i-_num_left] <_thresh.get(i-_num_left))) {
-      k = i;
-      return 1;
-    }
-  }
-  return 0;
-} 
-
-int no_change(long *dist, long *predist, int n) {
-  int i;
-  for(i = 0; i<n; i++) {
-    if(dist[i] != predist[i])
-      return 0;
-  }
-  return 1;
-}
-int Graph::_bellman_ford(Darr<Edge*> *edg, long *dist, int *pred, int *vis, int *rightd, int factor, int &k) {
-  int i;
-  int n = _num_vert;
-  long *predist = (long *) malloc(n*sizeof(long));
-  for(i = 0; i<n; i++) {
-    pred[i] = i;
-  }
-  for(i = _num_left; i<n; i++) {
-    dist[i] = LARGE;
-  }
-  for(i = 0; i<_num_left; i++) {
-    dist[i] = LARGE;
-    dist[_match[i]] = 0;
-  }
-  int val = 0;
-  for(i = 0; i<n; i++) {
-    int j;
-    int l;
-    for(l = 0; l<n; l++) 
-       predist[l] = dist[l]; 
-    for(j = 0; j<edg->n(); j++) {
-      int left = edg->get(j)->left;
-      int right = edg->get(j)->right;
-      long wt = edg->get(j)->wt/factor;
-      if(_match[left] == right)
-        relax(right, left, -wt, dist, pred); 
-      else
-        relax(left, right, wt, dist, pred);
-    }
-    if(no_change(dist, predist, n))
-      break;
-    val=_negative_cycle(dist, pred, vis, rightd, k);
-    if(val)
-      break;
-  }
-  free(predist);
-  return val;
-}
 long Graph::matchwt() {
   int i;
   long ww = 0;
@@ -439,185 +366,410 @@ int Graph::find_hall_set(Darr<Darr<int>*> &hall) {
   free(parent); 
   return 1;
 } 
-int Graph::find_matching(Matchkind kind) {
-  //this->print();
-  int i;
-  //for(i = 0; i<_num_left; i++) {
-   // if(_degree.get(i) == 0)
-    //  return 0;
-  //}
-  int noniso = 0;
-  //odb::notice(0,"Numright is %d\n", _num_vert-_num_left); 
-  //odb::notice(0,"Number of edges is %d\n", _edges.n());
-  for(i = _num_left; i<_num_vert; i++) {
-    if(_degree.get(i)>0)
-      noniso += _thresh.get(i-_num_left);
-  }
-  //if(_num_left>noniso++)
-   // return 0;
-  int n = _num_vert;
-  Queue qu(2*_edges.n()+2*n+1);
-  int *pred = (int *) malloc(n*sizeof(int));
-  int *visited = (int *) malloc(n*sizeof(int));
-  Darr<int> chpr;
-  Darr<int> chvis;
-  
-
-  //sort_neighbor_weights();  
-  int found = 1;
-  int *rightd = (int *) malloc((n-_num_left)*sizeof(int));
-  for(i = 0; i<n-_num_left; i++) {
-      rightd[i] = 0;
+void Graph::set_threads(int threads) {
+  _threads = threads;
+}
+static int find_root(std::vector<int> &parent, int i) {
+  while(parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
   }
-  for(i = 0; i<_num_left; i++) {
-    if(_match[i] != -1)
-      (rightd[_match[i]-_num_left])++;
+  return i;
+}
+void Graph::_build_csr() {
+  int i;
+  int nl = _num_left;
+  int nr = _num_vert-_num_left;
+  int m = _edges.n();
+  _left_begin.assign(nl+1, 0);
+  _right_begin.assign(nr+1, 0);
+  for(i = 0; i<m; i++) {
+    Edge *ed = _edges.get(i);
+    _left_begin[ed->left+1]++;
+    _right_begin[ed->right-nl+1]++;
+  }
+  for(i = 0; i<nl; i++)
+    _left_begin[i+1] += _left_begin[i];
+  for(i = 0; i<nr; i++)
+    _right_begin[i+1] += _right_begin[i];
+  _left_right.resize(m);
+  _left_wt.resize(m);
+  _right_left.resize(m);
+  _right_wt.resize(m);
+  std::vector<int> lpos(_left_begin.begin(), _left_begin.end()-1);
+  std::vector<int> rpos(_right_begin.begin(), _right_begin.end()-1);
+  std::vector<int> parent(_num_vert);
+  for(i = 0; i<_num_vert; i++)
+    parent[i] = i;
+  for(i = 0; i<m; i++) {
+    Edge *ed = _edges.get(i);
+    int j = lpos[ed->left]++;
+    _left_right[j] = ed->right;
+    _left_wt[j] = ed->wt;
+    j = rpos[ed->right-nl]++;
+    _right_left[j] = ed->left;
+    _right_wt[j] = ed->wt;
+    int a = find_root(parent, ed->left);
+    int b = find_root(parent, ed->right);
+    if(a != b)
+      parent[a] = b;
+  }
+  _comp.assign(_num_vert, -1);
+  _ncomp = 0;
+  for(i = 0; i<_num_vert; i++) {
+    int r = find_root(parent, i);
+    if(_comp[r] == -1)
+      _comp[r] = _ncomp++;
+    _comp[i] = _comp[r];
+  }
+  // Reattach the matching kept from the previous calls to the new edges.
+  _match_edge.assign(nl, -1);
+  for(i = 0; i<nl; i++) {
+    if(_match[i] == -1)
+      continue;
+    int j;
+    for(j = _left_begin[i]; j<_left_begin[i+1]; j++) {
+      if(_left_right[j] == _match[i])
+        _match_edge[i] = j;
+    }
+    if(_match_edge[i] == -1)
+      _match[i] = -1;
   }
-  for(i = 0; i<n; i++) {
-    pred[i] = i;
-    visited[i] = 0;
-  }
-  while(found) {
-    found = 0;
-    qu.reset();
-    for(i = 0; i<_num_left; i++) {
-      if(_match[i] == -1)
-        qu.insert(i);
+  _csr_valid = true;
+}
+//
+// Hopcroft-Karp for the right vertices of capacity _thresh: each phase finds
+// the shortest augmenting paths from all the free left vertices with one BFS
+// and augments a maximal set of disjoint ones with DFS. It starts from the
+// current matching, so a few new edges only cost a few phases.
+//
+int Graph::_hopcroft_karp() {
+  int i;
+  int nl = _num_left;
+  std::vector<int> dist(nl);
+  std::vector<int> it(nl);
+  std::vector<int> queue;
+  queue.reserve(nl);
+  while(true) {
+    queue.clear();
+    for(i = 0; i<nl; i++) {
+      if(_match[i] == -1) {
+        dist[i] = 0;
+        queue.push_back(i);
+      } else {
+        dist[i] = LARGE;
+      }
     }
-    for(i = 0; i<chpr.n(); i++) {
-      int m = chpr.get(i);
-      pred[m] = m;
-    } 
-    for(i = 0; i<chvis.n(); i++) {
-      int m = chvis.get(i);
-      visited[m] = 0;
-    } 
-    chpr.reset();
-    chvis.reset();
-    int ne;
-    while(!found) {
-      if(qu.is_empty())
-        break;
-      int el = qu.remove();
-      if(visited[el])
-        continue;
-      chvis.insert(el);
-      visited[el] = 1;
-      if(el<_num_left) {
-        Darr<Edge*> *edges = _neighbors.get(el);
-        for(i = 0; i<edges->n(); i++) {
-          Edge *ed = edges->get(i);
-          ne = ed->right;
-          if(_match[el] == ne)
-            continue;
-          if(pred[ne] == ne)
-            chpr.insert(ne);
-          if(!visited[ne]) {
-            pred[ne] = el;
-            qu.insert(ne);
-          }
-          if(rightd[ne-_num_left]<_thresh.get(ne-_num_left)) {
-            (rightd[ne-_num_left])++;
-            found = 1;
-            break;
-          }
-        }
-        if(found)
-          break;
+    int limit = LARGE;
+    size_t h;
+    for(h = 0; h<queue.size(); h++) {
+      int l = queue[h];
+      if(dist[l]+1>=limit)
         continue;
-      }
-      Darr<Edge*> *edges = _neighbors.get(el);
-      for(i = 0; i<edges->n(); i++) {
-        Edge *ed = edges->get(i);
-        ne = ed->left;
-        if(_match[ne] != el)
+      int j;
+      for(j = _left_begin[l]; j<_left_begin[l+1]; j++) {
+        int r = _left_right[j];
+        if(_match[l] == r)
+          continue;
+        if(_load[r-nl]<_thresh.get(r-nl)) {
+          limit = dist[l]+1;
           continue;
-        if(pred[ne] == ne)
-          chpr.insert(ne);
-        if(!visited[ne]) {
-          pred[ne] = el;
-          qu.insert(ne);
+        }
+        int k;
+        for(k = _right_begin[r-nl]; k<_right_begin[r-nl+1]; k++) {
+          int l2 = _right_left[k];
+          if(_match[l2] != r || dist[l2] != LARGE)
+            continue;
+          dist[l2] = dist[l]+1;
+          queue.push_back(l2);
         }
       }
     }
+    if(limit == LARGE)
+      break;
+    for(i = 0; i<nl; i++)
+      it[i] = _left_begin[i];
+    int found = 0;
+    for(i = 0; i<nl; i++) {
+      if(_match[i] == -1 && dist[i] == 0 && _hk_augment(i, dist, it, limit))
+        found++;
+    }
     if(!found)
       break;
-    int j = ne;
-    while(pred[j] != j) {
-      assert(j>=_num_left);
-      _match[pred[j]] = j;
-      j = pred[pred[j]];
+  }
+  int unmatched = 0;
+  for(i = 0; i<nl; i++) {
+    if(_match[i] == -1)
+      unmatched++;
+  }
+  return unmatched;
+}
+bool Graph::_hk_augment(int i, std::vector<int> &dist, std::vector<int> &it, int limit) {
+  int nl = _num_left;
+  for(; it[i]<_left_begin[i+1]; it[i]++) {
+    int j = it[i];
+    int r = _left_right[j];
+    if(_match[i] == r)
+      continue;
+    if(dist[i]+1 == limit) {
+      if(_load[r-nl]<_thresh.get(r-nl)) {
+        (_load[r-nl])++;
+        _match[i] = r;
+        _match_edge[i] = j;
+        return true;
+      }
+      continue;
+    }
+    int k;
+    for(k = _right_begin[r-nl]; k<_right_begin[r-nl+1]; k++) {
+      int l2 = _right_left[k];
+      if(_match[l2] != r || dist[l2] != dist[i]+1)
+        continue;
+      if(_hk_augment(l2, dist, it, limit)) {
+        _match[i] = r;
+        _match_edge[i] = j;
+        return true;
+      }
     }
   }
-  for(i = 0; i<_num_left; i++) {
-    if(_match[i] == -1) {
-      free(visited);
-      free(pred);
-      free(rightd);
-      return 0;
+  dist[i] = LARGE;
+  return false;
+}
+//
+// The weighted matching is a min cost flow from the left vertices to a sink
+// per component. Its residual graph has the arcs left->right (unmatched edge,
+// cost wt), right->left (matched edge, cost -wt), right->sink (spare
+// capacity) and sink->right (used capacity). fn(v, cost, e) is called for the
+// arcs leaving u, e being the edge of a left->right arc, until it returns false.
+//
+template <class FN>
+void Graph::_residual_arcs(int u, int sink, const int *verts, int nverts, FN fn) {
+  int nl = _num_left;
+  int j;
+  if(u == sink) {
+    for(j = 0; j<nverts; j++) {
+      int r = verts[j];
+      if(r>=nl && _load[r-nl]>0 && !fn(r, 0L, -1))
+        return;
     }
+    return;
   }
-  if(kind == NOOPT) {
-    free(visited);
-    free(pred);
-    free(rightd);
-    return 1; 
+  if(u<nl) {
+    for(j = _left_begin[u]; j<_left_begin[u+1]; j++) {
+      if(j == _match_edge[u])
+        continue;
+      if(!fn(_left_right[j], _left_wt[j], j))
+        return;
+    }
+    return;
   }
-  long *dist = (long *) malloc(n*sizeof(long));
-  int k;
-
-  //long matw = LARGE;
-  Darr<Darr<Edge*>*> ed;
-  find_connected_components(ed);
-  int ll;
-  for(ll = 0; ll<ed.n(); ll++) {
-
-   int factor = 1;
-   int maxwt = 0;
-   for(i = 0; i<ed.get(ll)->n(); i++) {
-     if(maxwt<ed.get(ll)->get(i)->wt)
-       maxwt = ed.get(ll)->get(i)->wt;
-   }
-   while(true) {
-     if(10*factor>maxwt)
-       break;
-     factor = 2*factor;
-   }
-
-   while(true){
-
-    /*long nm = matchwt();
-    assert(nm<matw); */
-    int val = _bellman_ford(ed.get(ll), dist, pred, visited, rightd, factor, k);
-    if(val) {
-      int l = k;
-      assert(k>=_num_left);
-      while(pred[l] != l) {
-        _match[pred[l]] = l;
-        l = pred[pred[l]];
-        if(l == k)
+  if(_load[u-nl]<_thresh.get(u-nl) && !fn(sink, 0L, -1))
+    return;
+  for(j = _right_begin[u-nl]; j<_right_begin[u-nl+1]; j++) {
+    int l = _right_left[j];
+    if(_match[l] != u)
+      continue;
+    if(!fn(l, -_right_wt[j], -1))
+      return;
+  }
+}
+// Push one unit along the arc u->v. A left vertex entered from a right one
+// leaves it by its next arc, which rematches it.
+void Graph::_flip(int u, int v, int e, int sink) {
+  if(u<_num_left) {
+    _match[u] = v;
+    _match_edge[u] = e;
+  } else if(v == sink) {
+    (_load[u-_num_left])++;
+  } else if(u == sink) {
+    (_load[v-_num_left])--;
+  }
+}
+// The left vertices are the supply; the sink of a component takes what is
+// left unmatched in it, and a right vertex takes its reserved capacity.
+bool Graph::_is_deficit(int u, int sink, int need) {
+  if(u == sink)
+    return need>0;
+  return (u>=_num_left && _reserved[u-_num_left]>0);
+}
+//
+// Minimum weight matching of one component by successive shortest paths:
+// from each free left vertex Dijkstra over the reduced costs runs to the
+// nearest deficit, only the potentials of the vertices it settled are
+// lowered, and the path is augmented, so an augmentation costs the region
+// it explored. The potentials are left with a zero sink, so they stay valid
+// when components merge. Returns false if some left vertex cannot be matched.
+//
+bool Graph::_min_cost_matching(int sink, const int *verts, int nverts) {
+  int i;
+  int nl = _num_left;
+  int need = 0;
+  for(i = 0; i<nverts; i++) {
+    int v = verts[i];
+    if(v<nl)
+      need++;
+    else
+      need -= _load[v-nl];
+    _mark[v] = 0;
+  }
+  _mark[sink] = 0;
+  _pot[sink] = 0;
+  int stamp = 0;
+  typedef std::pair<long, int> Item;
+  std::priority_queue<Item, std::vector<Item>, std::greater<Item> > heap;
+  std::vector<int> settled;
+  for(i = 0; i<nverts; i++) {
+    int l = verts[i];
+    if(l>=nl || _match[l] != -1)
+      continue;
+    stamp++;
+    heap = std::priority_queue<Item, std::vector<Item>, std::greater<Item> >();
+    settled.clear();
+    _mark[l] = stamp;
+    _dist[l] = 0;
+    _pred[l] = -1;
+    heap.push(Item(0, l));
+    int end = -1;
+    while(!heap.empty()) {
+      Item top = heap.top();
+      heap.pop();
+      int u = top.second;
+      if(top.first>_dist[u])
+        continue;
+      if(_is_deficit(u, sink, need)) {
+        end = u;
+        break;
+      }
+      settled.push_back(u);
+      _residual_arcs(u, sink, verts, nverts, [&](int v, long cost, int e) {
+        long d = top.first+cost+_pot[u]-_pot[v];
+        if(_mark[v] != stamp || d<_dist[v]) {
+          _mark[v] = stamp;
+          _dist[v] = d;
+          _pred[v] = u;
+          _pred_edge[v] = e;
+          heap.push(Item(d, v));
+        }
+        return true;
+      });
+    }
+    if(end == -1)
+      return false;
+    long dmin = _dist[end];
+    size_t k;
+    for(k = 0; k<settled.size(); k++)
+      _pot[settled[k]] -= dmin-_dist[settled[k]];
+    if(end == sink)
+      need--;
+    else
+      (_reserved[end-nl])--;
+    int v = end;
+    while(_pred[v] != -1) {
+      _flip(_pred[v], v, _pred_edge[v], sink);
+      v = _pred[v];
+    }
+  }
+  for(i = 0; i<nverts; i++)
+    _pot[verts[i]] -= _pot[sink];
+  _pot[sink] = 0;
+  return true;
+}
+int Graph::find_matching(Matchkind kind) {
+  int i;
+  int nl = _num_left;
+  int n = _num_vert;
+  if(!_csr_valid)
+    _build_csr();
+  _reserved.assign(n-nl, 0);
+  if(kind == OPT && !_opt_valid) {
+    // Cold start: each left vertex takes a cheapest edge while its right
+    // vertex has capacity, with potentials that make those edges tight.
+    _pot.assign(n+_ncomp, 0);
+    std::vector<int> used(n-nl, 0);
+    for(i = 0; i<nl; i++) {
+      _match[i] = -1;
+      _match_edge[i] = -1;
+      int j;
+      for(j = _left_begin[i]; j<_left_begin[i+1]; j++) {
+        if(j == _left_begin[i] || _left_wt[j]<-_pot[i])
+          _pot[i] = -_left_wt[j];
+      }
+      for(j = _left_begin[i]; j<_left_begin[i+1]; j++) {
+        int r = _left_right[j];
+        if(_left_wt[j] == -_pot[i] && used[r-nl]<_thresh.get(r-nl)) {
+          (used[r-nl])++;
+          _match[i] = r;
+          _match_edge[i] = j;
           break;
+        }
       }
-      if(pred[l] == l) {
-        (rightd[l-_num_left])--;
-        (rightd[k-_num_left])++;
-        /*assert(rightd[l-_num_left]>=0);
-        assert(rightd[k-_num_left]<=1); */
+    }
+  } else if(kind == OPT) {
+    // Warm start: drop the matches of the left vertices whose edges changed
+    // and lower their potentials below their edges.
+    _pot.resize(n+_ncomp, 0);
+    for(i = 0; i<(int)_dirty.size(); i++) {
+      int l = _dirty[i];
+      if(_match[l] == -1)
+        continue;
+      (_reserved[_match[l]-nl])++;
+      _match[l] = -1;
+      _match_edge[l] = -1;
+    }
+    for(i = 0; i<(int)_dirty.size(); i++) {
+      int l = _dirty[i];
+      int j;
+      for(j = _left_begin[l]; j<_left_begin[l+1]; j++) {
+        if(j == _left_begin[l] || _pot[l]<_pot[_left_right[j]]-_left_wt[j])
+          _pot[l] = _pot[_left_right[j]]-_left_wt[j];
       }
-    } else {
-      factor = factor/2;
-      if(factor<=1000)
-        break;
     }
-   } // while
-  } // for
-  /*for(i = 0; i<_num_left; i++)
-    odb::notice(0,"%d %d\n", i, _match[i]); */
-  for(i = 0; i<ed.n(); i++)
-    delete ed.get(i); 
-  free(visited);
-  free(pred);
-  free(dist);
-  free(rightd);
+  }
+  _dirty.clear();
+  _load.assign(n-nl, 0);
+  for(i = 0; i<nl; i++) {
+    if(_match[i] != -1)
+      (_load[_match[i]-nl])++;
+  }
+  for(i = 0; i<n-nl; i++)
+    _load[i] += _reserved[i];
+  if(kind == NOOPT) {
+    _opt_valid = false;
+    return (_hopcroft_karp() == 0);
+  }
+  _dist.resize(n+_ncomp);
+  _pred.resize(n+_ncomp);
+  _pred_edge.resize(n+_ncomp);
+  _mark.resize(n+_ncomp);
+  std::vector<int> comp_begin(_ncomp+1, 0);
+  std::vector<int> comp_verts(n);
+  for(i = 0; i<n; i++)
+    comp_begin[_comp[i]+1]++;
+  for(i = 0; i<_ncomp; i++)
+    comp_begin[i+1] += comp_begin[i];
+  std::vector<int> pos(comp_begin.begin(), comp_begin.end()-1);
+  for(i = 0; i<n; i++)
+    comp_verts[pos[_comp[i]]++] = i;
+  std::vector<char> ok(_ncomp, 1);
+  odb::dbParallelFor(_ncomp, _threads, [&](uint c) {
+    int *verts = &comp_verts[comp_begin[c]];
+    int nverts = comp_begin[c+1]-comp_begin[c];
+    if(verts[0]<nl)
+      ok[c] = _min_cost_matching(n+c, verts, nverts);
+  }, 1);
+  _opt_valid = true;
+  for(i = 0; i<_ncomp; i++) {
+    if(!ok[i])
+      _opt_valid = false;
+  }
+  if(!_opt_valid) {
+    // Leave a maximum matching for find_hall_set().
+    for(i = 0; i<n-nl; i++) {
+      _load[i] -= _reserved[i];
+      _reserved[i] = 0;
+    }
+    _hopcroft_karp();
+    return 0;
+  }
   return 1;
 }
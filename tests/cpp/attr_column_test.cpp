@@ -0,0 +1,291 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// dbAttrColumn: the dbProperty API on top of the columns, validation of the
+// bulk setters, and a write/read round trip of the columns (schemas 52 and 54).
+//
+#include "db.h"
+#include "dbDatabase.h"
+#include "dbProperty.h"
+#include "dbStream.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+static dbInst * inst( dbBlock * block, int i )
+{
+    char name[16];
+    sprintf(name, "u%d", i);
+    return block->findInst(name);
+}
+
+static void testProperties()
+{
+    dbDatabase * db = dbDatabase::create();
+    dbBlock * block = createBlock(db, 8);
+
+    // A property created before the column is imported.
+    dbIntProperty::create(inst(block, 0), "weight", 11);
+    dbAttrColumn * weight = dbAttrColumn::create(block, "weight", dbInstObj, dbAttrColumn::INT_ATTR);
+    check("existing property imported", weight->getInt(inst(block, 0)) == 11);
+
+    // Column values are not properties, lookups do not create them.
+    weight->setInt(inst(block, 1), 5);
+    check("column value not found as property", dbIntProperty::find(inst(block, 1), "weight") == NULL);
+    check("column value not found as any type", dbProperty::find(inst(block, 1), "weight") == NULL);
+    check("lookup creates no property", dbProperty::getProperties(inst(block, 1)).empty());
+
+    // Creating the property backs it by the column.
+    dbIntProperty * p1 = dbIntProperty::create(inst(block, 1), "weight", 5);
+    check("created property on a column value", p1 && p1->getValue() == 5);
+    check("no value, no property", dbIntProperty::find(inst(block, 2), "weight") == NULL);
+    check("no value, no property of any type", dbProperty::find(inst(block, 2), "weight") == NULL);
+
+    // Property writes go to the column, column writes are seen by the property.
+    p1->setValue(7);
+    check("property write seen by column", weight->getInt(inst(block, 1)) == 7);
+    weight->setInt(inst(block, 1), 9);
+    check("column write seen by property", p1->getValue() == 9);
+
+    dbIntProperty * p2 = dbIntProperty::create(inst(block, 2), "weight", 3);
+    check("created property sets column", p2 && weight->getInt(inst(block, 2)) == 3);
+    check("create refuses an existing property", dbIntProperty::create(inst(block, 1), "weight", 1) == NULL);
+
+    int values[3] = { 20, 21, 22 };
+    uint first = inst(block, 3)->getId();
+    check("bulk set", weight->setInts(first, 3, values));
+    check("bulk value not found as property", dbIntProperty::find(inst(block, 4), "weight") == NULL);
+
+    // exportProperties creates the properties of the column values.
+    check("export", weight->exportProperties() == 6);
+    dbIntProperty * p3 = dbIntProperty::find(inst(block, 4), "weight");
+    check("exported value found as property", p3 && p3->getValue() == 21);
+
+    dbSet<dbProperty> props = dbProperty::getProperties(inst(block, 5));
+    dbSet<dbProperty>::iterator itr;
+    int found = 0;
+
+    for( itr = props.begin(); itr != props.end(); ++itr )
+        if ( strcmp(itr->getName().c_str(), "weight") == 0 )
+            found = ((dbIntProperty *) *itr)->getValue();
+
+    check("getProperties lists exported values", found == 22);
+
+    // Destroying a property clears the value, clearing a value destroys the property.
+    dbProperty::destroy(p2);
+    check("destroyed property clears column", ! weight->hasValue(inst(block, 2)));
+    weight->clearValue(inst(block, 1));
+    check("cleared value destroys property", dbProperty::find(inst(block, 1), "weight") == NULL);
+
+    // String and double columns.
+    dbAttrColumn * cell = dbAttrColumn::create(block, "cell", dbInstObj, dbAttrColumn::STRING_ATTR);
+    cell->setString(inst(block, 0), "left");
+    check("string value not found as property", dbStringProperty::find(inst(block, 0), "cell") == NULL);
+    dbStringProperty * sp = dbStringProperty::create(inst(block, 0), "cell", "left");
+    check("string column as property", sp && sp->getValue() == "left");
+    sp->setValue("right");
+    check("string property write", strcmp(cell->getString(inst(block, 0)), "right") == 0);
+
+    dbAttrColumn * slack = dbAttrColumn::create(block, "slack", dbInstObj, dbAttrColumn::DOUBLE_ATTR);
+    dbDoubleProperty::create(inst(block, 6), "slack", -0.25);
+    check("double property sets column", slack->getDouble(inst(block, 6)) == -0.25);
+
+    // A property of another type is not backed by the column.
+    dbBoolProperty::create(inst(block, 7), "weight", true);
+    check("other type not in column", ! weight->hasValue(inst(block, 7)));
+    check("other type keeps its value", dbBoolProperty::find(inst(block, 7), "weight")->getValue());
+
+    // Destroying the column leaves the properties with the column values.
+    weight->setInt(inst(block, 4), 42);
+    dbAttrColumn::destroy(weight);
+    check("property survives column", p3->getValue() == 42);
+    check("exported values survive column", dbIntProperty::find(inst(block, 3), "weight")->getValue() == 20);
+
+    // Clearing a column destroys its properties.
+    cell->clear();
+    check("cleared column destroys properties", dbStringProperty::find(inst(block, 0), "cell") == NULL);
+
+    dbDatabase::destroy(db);
+}
+
+static void testBulkValidation()
+{
+    dbDatabase * db = dbDatabase::create();
+    dbBlock * block = createBlock(db, 8);
+    dbAttrColumn * c = dbAttrColumn::create(block, "w", dbInstObj, dbAttrColumn::INT_ATTR);
+    dbAttrColumn * d = dbAttrColumn::create(block, "d", dbInstObj, dbAttrColumn::DOUBLE_ATTR);
+    dbAttrColumn * b = dbAttrColumn::create(block, "b", dbInstObj, dbAttrColumn::BOOL_ATTR);
+    int ints[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    double doubles[8] = { 0.5, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5, 7.5 };
+    bool bools[8] = { true, false, true, false, true, false, true, false };
+    uint first = inst(block, 0)->getId();
+
+    check("id 0 rejected", ! c->setInts(0, 2, ints));
+    check("ids past the table rejected", ! c->setInts(first, 100, ints));
+    check("range overflow rejected", ! d->setDoubles(first, 0xffffffffU, doubles));
+    check("rejected range sets nothing", c->size() == 0);
+
+    dbInst::destroy(inst(block, 3));
+    check("destroyed id rejected", ! b->setBools(first, 8, bools));
+    check("valid range accepted", b->setBools(first, 3, bools) && b->getBool(inst(block, 2)));
+    check("empty range accepted", c->setInts(first, 0, ints));
+
+    dbDatabase::destroy(db);
+}
+
+static void writeRead( dbDatabase * db, dbDatabase * rdb )
+{
+    std::string file = "attr_column_test.db";
+    FILE * fp = fopen(file.c_str(), "w");
+    db->write(fp);
+    fclose(fp);
+
+    fp = fopen(file.c_str(), "r");
+    rdb->read(fp);
+    fclose(fp);
+    remove(file.c_str());
+}
+
+// The number of bytes a property row takes in a .db file.
+static long streamedSize( dbDatabase * db, dbProperty * prop )
+{
+    FILE * file = tmpfile();
+    {
+        dbOStream stream( (_dbDatabase *) db, file );
+        stream << *(_dbProperty *) prop;
+    }
+
+    long size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+static void testRoundTrip()
+{
+    dbDatabase * db = dbDatabase::create();
+    dbBlock * block = createBlock(db, 100);
+    dbAttrColumn * w = dbAttrColumn::create(block, "w", dbInstObj, dbAttrColumn::INT_ATTR);
+    dbAttrColumn * d = dbAttrColumn::create(block, "d", dbInstObj, dbAttrColumn::DOUBLE_ATTR);
+    dbAttrColumn * b = dbAttrColumn::create(block, "b", dbInstObj, dbAttrColumn::BOOL_ATTR);
+    dbAttrColumn * s = dbAttrColumn::create(block, "s", dbInstObj, dbAttrColumn::STRING_ATTR);
+    int i;
+
+    for( i = 0; i < 100; i += 3 )
+    {
+        w->setInt(inst(block, i), i * 7 - 50);
+        d->setDouble(inst(block, i + 1 < 100 ? i + 1 : i), i / 8.0);
+        b->setBool(inst(block, i), (i % 2) == 0);
+        s->setString(inst(block, i), (i % 5) == 0 ? "five" : "other");
+    }
+
+    // Properties written through the property API, the values are saved
+    // with the columns only.
+    dbIntProperty::create(inst(block, 3), "w", 0)->setValue(1234);
+    dbStringProperty::create(inst(block, 15), "s", "five");
+    dbIntProperty::create(inst(block, 6), "other", 66);
+    dbDoubleProperty * backed = dbDoubleProperty::create(inst(block, 10), "d", 2.5);
+    dbDoubleProperty * plain = dbDoubleProperty::create(inst(block, 10), "e", 2.5);
+    check("backed value not streamed", streamedSize(db, backed) + (long) sizeof(double) == streamedSize(db, plain));
+
+    dbDatabase * rdb = dbDatabase::create();
+    writeRead(db, rdb);
+    dbBlock * rblock = rdb->getChip()->getBlock();
+    dbAttrColumn * rw = dbAttrColumn::find(rblock, "w", dbInstObj);
+    dbAttrColumn * rd = dbAttrColumn::find(rblock, "d", dbInstObj);
+    dbAttrColumn * rb = dbAttrColumn::find(rblock, "b", dbInstObj);
+    dbAttrColumn * rs = dbAttrColumn::find(rblock, "s", dbInstObj);
+    check("columns read", rw && rd && rb && rs);
+
+    if ( !(rw && rd && rb && rs) )
+        return;
+
+    check("column types read", rd->getType() == dbAttrColumn::DOUBLE_ATTR
+          && rs->getType() == dbAttrColumn::STRING_ATTR);
+
+    int mismatches = 0;
+
+    for( i = 0; i < 100; ++i )
+    {
+        dbInst * i1 = inst(block, i);
+        dbInst * i2 = inst(rblock, i);
+
+        if ( w->hasValue(i1) != rw->hasValue(i2) || w->getInt(i1) != rw->getInt(i2) )
+            ++mismatches;
+
+        if ( d->hasValue(i1) != rd->hasValue(i2) || d->getDouble(i1) != rd->getDouble(i2) )
+            ++mismatches;
+
+        if ( b->hasValue(i1) != rb->hasValue(i2) || b->getBool(i1) != rb->getBool(i2) )
+            ++mismatches;
+
+        if ( s->hasValue(i1) != rs->hasValue(i2) )
+            ++mismatches;
+        else if ( s->hasValue(i1) && strcmp(s->getString(i1), rs->getString(i2)) != 0 )
+            ++mismatches;
+    }
+
+    check("column values read back", mismatches == 0);
+
+    dbIntProperty * p = dbIntProperty::find(inst(rblock, 3), "w");
+    check("property read back", p && p->getValue() == 1234);
+    dbStringProperty * sp = dbStringProperty::find(inst(rblock, 15), "s");
+    check("string property read back", sp && sp->getValue() == "five");
+    dbIntProperty * op = dbIntProperty::find(inst(rblock, 6), "other");
+    check("plain property read back", op && op->getValue() == 66);
+
+    // Reads do not create properties.
+    FILE * out = tmpfile();
+    check("no differences after a read", ! dbDatabase::diff( db, rdb, out, 2 ));
+    check("column value read as no property", dbIntProperty::find(inst(rblock, 9), "w") == NULL);
+    check("no property listed", dbProperty::getProperties(inst(rblock, 9)).empty());
+    check("no differences after lookups", ! dbDatabase::diff( db, rdb, out, 2 ));
+    fclose(out);
+
+    // The backed property takes its value from the column when the column goes.
+    dbAttrColumn::destroy(rw);
+    check("backed value restored from column", p->getValue() == 1234);
+
+    dbDatabase::destroy(rdb);
+    dbDatabase::destroy(db);
+}
+
+int main( int argc, char ** argv )
+{
+    testProperties();
+    testBulkValidation();
+    testRoundTrip();
+    return exit_summary();
+}
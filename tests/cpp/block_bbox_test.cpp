@@ -0,0 +1,342 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// The block bbox is kept up to date incrementally through instance creates,
+// moves and destroys, bpin, obstruction, special wire and wire edits, and
+// matches a walk over all the shapes of the block after every edit.
+//
+#include "db.h"
+#include "dbBlock.h"
+#include "dbWireCodec.h"
+#include "test_helpers.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+static void mergeRect( adsRect & bbox, const adsRect & r )
+{
+    bbox.reset( std::min( bbox.xMin(), r.xMin() ), std::min( bbox.yMin(), r.yMin() ),
+                std::max( bbox.xMax(), r.xMax() ), std::max( bbox.yMax(), r.yMax() ) );
+}
+
+// Reference: the hull of every shape of the block.
+static adsRect walkBBox( dbBlock * block )
+{
+    adsRect bbox;
+    bbox.reset( INT_MAX, INT_MAX, INT_MIN, INT_MIN );
+    adsRect r;
+
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator iitr;
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+    {
+        iitr->getBBox()->getBox(r);
+        mergeRect( bbox, r );
+    }
+
+    dbSet<dbBTerm> bterms = block->getBTerms();
+    dbSet<dbBTerm>::iterator bitr;
+
+    for( bitr = bterms.begin(); bitr != bterms.end(); ++bitr )
+    {
+        dbSet<dbBPin> bpins = bitr->getBPins();
+        dbSet<dbBPin>::iterator pitr;
+
+        for( pitr = bpins.begin(); pitr != bpins.end(); ++pitr )
+        {
+            if ( pitr->getBox() == NULL )
+                continue;
+
+            pitr->getBox()->getBox(r);
+            mergeRect( bbox, r );
+        }
+    }
+
+    dbSet<dbObstruction> obstructions = block->getObstructions();
+    dbSet<dbObstruction>::iterator oitr;
+
+    for( oitr = obstructions.begin(); oitr != obstructions.end(); ++oitr )
+    {
+        oitr->getBBox()->getBox(r);
+        mergeRect( bbox, r );
+    }
+
+    dbSet<dbNet> nets = block->getNets();
+    dbSet<dbNet>::iterator nitr;
+
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+    {
+        dbSet<dbSWire> swires = nitr->getSWires();
+        dbSet<dbSWire>::iterator switr;
+
+        for( switr = swires.begin(); switr != swires.end(); ++switr )
+        {
+            dbSet<dbSBox> sboxes = switr->getWires();
+            dbSet<dbSBox>::iterator sitr;
+
+            for( sitr = sboxes.begin(); sitr != sboxes.end(); ++sitr )
+            {
+                sitr->getBox(r);
+                mergeRect( bbox, r );
+            }
+        }
+
+        dbWire * wire = nitr->getWire();
+
+        if ( wire && wire->getBBox(r) )
+            mergeRect( bbox, r );
+    }
+
+    return bbox;
+}
+
+static bool bboxValid( dbBlock * block )
+{
+    return ((_dbBlock *) block)->_flags._valid_bbox;
+}
+
+static adsRect blockBBox( dbBlock * block )
+{
+    adsRect r;
+    block->getBBox()->getBox(r);
+    return r;
+}
+
+static void encodeWire( dbNet * net, dbTechLayer * layer )
+{
+    dbWire * wire = dbWire::create(net);
+    dbWireEncoder encoder;
+    encoder.begin(wire);
+    encoder.newPath( layer, dbWireType::ROUTED );
+    int x = rand() % 50000;
+    int y = rand() % 50000;
+    encoder.addPoint( x, y );
+    encoder.addPoint( x + rand() % 5000, y );
+    encoder.end();
+}
+
+int main( int argc, char ** argv )
+{
+    srand(39);
+
+    dbDatabase * db = dbDatabase::create();
+    dbTech * tech = dbTech::create(db);
+    dbTechLayer * layer = dbTechLayer::create(tech, "M1", dbTechLayerType::ROUTING);
+    layer->setWidth(100);
+    dbLib * lib = dbLib::create(db, "lib");
+    std::vector<dbMaster *> masters;
+    int i;
+
+    for( i = 1; i <= 4; ++i )
+    {
+        char name[8];
+        sprintf(name, "M%d", i);
+        dbMaster * master = dbMaster::create(lib, name);
+        master->setWidth( 200 * i );
+        master->setHeight( 1400 );
+        master->setFrozen();
+        masters.push_back(master);
+    }
+
+    dbChip * chip = dbChip::create(db);
+    dbBlock * block = dbBlock::create(chip, "top");
+    check("empty block", blockBBox(block) == walkBBox(block));
+
+    std::vector<dbInst *> insts;
+    std::vector<dbBPin *> bpins;
+    std::vector<dbSWire *> swires;
+    std::vector<dbNet *> nets;
+    dbNet * power = dbNet::create(block, "VDD");
+
+    int errors = 0;
+    int count = 0;
+
+    for( i = 0; i < 3000; ++i )
+    {
+        int op = rand() % 12;
+
+        if ( (op <= 2) || insts.empty() )
+        {
+            char name[16];
+            sprintf(name, "i%d", count++);
+            dbInst * inst = dbInst::create( block, masters[rand() % masters.size()], name );
+            inst->setLocation( rand() % 50000, rand() % 50000 );
+            inst->setPlacementStatus( dbPlacementStatus::PLACED );
+            insts.push_back(inst);
+        }
+        else if ( op <= 5 )
+        {
+            dbInst * inst = insts[rand() % insts.size()];
+
+            if ( rand() % 2 )
+                inst->setOrient( dbOrientType::R90 );
+
+            inst->setLocation( rand() % 50000, rand() % 50000 );
+        }
+        else if ( op == 6 )
+        {
+            int k = rand() % insts.size();
+            dbInst::destroy( insts[k] );
+            insts.erase( insts.begin() + k );
+        }
+        else if ( (op == 7) || ((op == 8) && bpins.empty()) )
+        {
+            char name[16];
+            sprintf(name, "p%d", count++);
+            dbNet * net = dbNet::create(block, name);
+            dbBPin * bpin = dbBPin::create( dbBTerm::create(net, name) );
+            int x = rand() % 52000 - 1000;
+            int y = rand() % 52000 - 1000;
+            dbBox::create( bpin, layer, x, y, x + 100, y + 100 );
+            bpins.push_back(bpin);
+        }
+        else if ( op == 8 )
+        {
+            int k = rand() % bpins.size();
+            dbBPin::destroy( bpins[k] );
+            bpins.erase( bpins.begin() + k );
+        }
+        else if ( (op == 9) || swires.empty() )
+        {
+            dbSWire * swire = dbSWire::create( power, dbWireType::ROUTED );
+            int y = rand() % 50000;
+            dbSBox::create( swire, layer, rand() % 1000 - 2000, y, 50000 + rand() % 1000, y + 200,
+                            dbWireShapeType::STRIPE );
+            swires.push_back(swire);
+        }
+        else if ( op == 10 )
+        {
+            int k = rand() % swires.size();
+            dbSWire::destroy( swires[k] );
+            swires.erase( swires.begin() + k );
+        }
+        else if ( nets.empty() || (rand() % 2) )
+        {
+            char name[16];
+            sprintf(name, "n%d", count++);
+            dbNet * net = dbNet::create(block, name);
+            encodeWire( net, layer );
+            nets.push_back(net);
+        }
+        else
+        {
+            dbNet * net = nets[rand() % nets.size()];
+
+            if ( net->getWire() )
+                dbWire::destroy( net->getWire() );
+            else
+                encodeWire( net, layer );
+        }
+
+        if ( rand() % 50 == 0 )
+        {
+            int x = rand() % 50000;
+            int y = rand() % 50000;
+            dbObstruction::create( block, layer, x, y, x + rand() % 3000, y + rand() % 3000 );
+        }
+
+        errors += blockBBox(block) != walkBBox(block);
+    }
+
+    check("bbox matches the walk after every edit", errors == 0);
+
+    // Moves inside the hull keep the bbox valid.
+    adsRect hull = blockBBox(block);
+    dbInst * inner = dbInst::create( block, masters[0], "inner" );
+    inner->setLocation( hull.xMin() + 5000, hull.yMin() + 5000 );
+    int invalidated = 0;
+
+    for( i = 0; i < 100; ++i )
+    {
+        inner->setLocation( hull.xMin() + 5000 + i * 10, hull.yMin() + 5000 + i * 10 );
+        invalidated += ! bboxValid(block);
+        blockBBox(block);
+    }
+
+    check("inner moves keep the bbox valid", invalidated == 0);
+    dbInst::destroy(inner);
+    check("inner destroy keeps the bbox valid", bboxValid(block));
+
+    // An instance that stays on an edge keeps the bbox valid.
+    dbInst * edge = dbInst::create( block, masters[0], "edge" );
+    edge->setLocation( hull.xMin() - 1000, hull.yMin() + 5000 );
+    blockBBox(block);
+    edge->setLocation( hull.xMin() - 1000, hull.yMin() + 6000 );
+    check("move along an edge keeps the bbox valid", bboxValid(block));
+    check("move along an edge", blockBBox(block) == walkBBox(block));
+    edge->setLocation( hull.xMin() + 5000, hull.yMin() + 6000 );
+    check("move off an edge", blockBBox(block) == walkBBox(block));
+
+    // Edits after a read, the edge counts start at zero.
+    std::string file = "block_bbox_test.db";
+    FILE * fp = fopen(file.c_str(), "w");
+    db->write(fp);
+    fclose(fp);
+
+    dbDatabase * rdb = dbDatabase::create();
+    fp = fopen(file.c_str(), "r");
+    rdb->read(fp);
+    fclose(fp);
+    remove(file.c_str());
+
+    dbBlock * rblock = rdb->getChip()->getBlock();
+    check("read bbox", blockBBox(rblock) == walkBBox(rblock));
+
+    errors = 0;
+    std::vector<dbInst *> rinsts;
+    dbSet<dbInst> rset = rblock->getInsts();
+    dbSet<dbInst>::iterator ritr;
+
+    for( ritr = rset.begin(); ritr != rset.end(); ++ritr )
+        rinsts.push_back( *ritr );
+
+    for( i = 0; i < (int) rinsts.size(); ++i )
+    {
+        if ( i % 2 )
+            dbInst::destroy( rinsts[i] );
+        else
+            rinsts[i]->setLocation( rand() % 50000, rand() % 50000 );
+
+        errors += blockBBox(rblock) != walkBBox(rblock);
+    }
+
+    check("read block edits match the walk", errors == 0);
+
+    dbDatabase::destroy(rdb);
+    dbDatabase::destroy(db);
+    return exit_summary();
+}
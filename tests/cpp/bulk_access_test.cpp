@@ -0,0 +1,268 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// The columnar wire segments, rsegs and cap-nodes of dbBulkAccess match the
+// per-object walk (dbWireShapeItr, dbNet::getRSegs, dbNet::getCapNodes) at
+// every extraction corner, on one and several threads.
+//
+#include "db.h"
+#include "dbBulkAccess.h"
+#include "dbShape.h"
+#include "dbWireCodec.h"
+#include "lefin.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+static const int corners = 3;
+
+// The caps live on the cap-nodes: the cap values of the nodes and of the
+// rsegs share one id indexed table.
+static void addParasitics( dbNet * net )
+{
+    int num_nodes = 2 + rand() % 6;
+    std::vector<dbCapNode *> nodes;
+    int n, c;
+
+    for( n = 0; n < num_nodes; ++n )
+    {
+        dbCapNode * node = dbCapNode::create( net, n + 1, true );
+        node->setInternalFlag();
+
+        for( c = 0; c < corners; ++c )
+            node->setCapacitance( 0.1 * (rand() % 100) + c, c );
+
+        nodes.push_back(node);
+    }
+
+    for( n = 1; n < num_nodes; ++n )
+    {
+        dbRSeg * seg = dbRSeg::create( net, 0, 0, 0, false );
+        seg->setSourceNode( nodes[rand() % n]->getId() );
+        seg->setTargetNode( nodes[n]->getId() );
+
+        for( c = 0; c < corners; ++c )
+            seg->setResistance( 1.0 + rand() % 100 + c, c );
+    }
+}
+
+static bool checkWireSegments( dbBlock * block, uint threads )
+{
+    std::vector<uint> seg_nets, seg_levels;
+    std::vector<int> seg_x1, seg_y1, seg_x2, seg_y2;
+    uint cnt = dbBulkAccess::getWireSegments( block, seg_nets, seg_levels, seg_x1,
+                                              seg_y1, seg_x2, seg_y2, threads );
+
+    if ( (seg_nets.size() != cnt) || (seg_levels.size() != cnt) || (seg_x1.size() != cnt)
+         || (seg_y1.size() != cnt) || (seg_x2.size() != cnt) || (seg_y2.size() != cnt) )
+        return false;
+
+    uint k = 0;
+    dbSet<dbNet> nets = block->getNets();
+    dbSet<dbNet>::iterator nitr;
+
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+    {
+        dbWire * wire = nitr->getWire();
+
+        if ( wire == NULL )
+            continue;
+
+        dbWireShapeItr itr;
+        dbShape shape;
+
+        for( itr.begin(wire); itr.next(shape); )
+        {
+            if ( shape.isVia() )
+                continue;
+
+            adsRect r;
+            shape.getBox(r);
+
+            if ( (k >= cnt) || (seg_nets[k] != nitr->getId())
+                 || (seg_levels[k] != (uint) shape.getTechLayer()->getRoutingLevel())
+                 || (seg_x1[k] != r.xMin()) || (seg_y1[k] != r.yMin())
+                 || (seg_x2[k] != r.xMax()) || (seg_y2[k] != r.yMax()) )
+                return false;
+
+            ++k;
+        }
+    }
+
+    return k == cnt;
+}
+
+static bool checkRSegs( dbBlock * block, uint corner, uint threads )
+{
+    std::vector<uint> ids, nets_, sources, targets;
+    std::vector<double> res, cap;
+    uint cnt = dbBulkAccess::getRSegs( block, corner, ids, nets_, sources, targets,
+                                       res, cap, threads );
+
+    if ( (ids.size() != cnt) || (nets_.size() != cnt) || (sources.size() != cnt)
+         || (targets.size() != cnt) || (res.size() != cnt) || (cap.size() != cnt) )
+        return false;
+
+    if ( corner >= (uint) corners )
+        return cnt == 0;
+
+    uint k = 0;
+    dbSet<dbNet> nets = block->getNets();
+    dbSet<dbNet>::iterator nitr;
+
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+    {
+        dbSet<dbRSeg> rsegs = nitr->getRSegs();
+        dbSet<dbRSeg>::iterator ritr;
+
+        for( ritr = rsegs.begin(); ritr != rsegs.end(); ++ritr, ++k )
+        {
+            dbRSeg * seg = *ritr;
+
+            if ( (k >= cnt) || (ids[k] != seg->getId()) || (nets_[k] != nitr->getId())
+                 || (sources[k] != seg->getSourceNode())
+                 || (targets[k] != seg->getTargetNode())
+                 || (res[k] != seg->getResistance(corner))
+                 || (cap[k] != seg->getCapacitance(corner)) )
+                return false;
+        }
+    }
+
+    return k == cnt;
+}
+
+static bool checkCapNodes( dbBlock * block, uint corner, uint threads )
+{
+    std::vector<uint> ids, nets_;
+    std::vector<double> cap;
+    uint cnt = dbBulkAccess::getCapNodes( block, corner, ids, nets_, cap, threads );
+
+    if ( (ids.size() != cnt) || (nets_.size() != cnt) || (cap.size() != cnt) )
+        return false;
+
+    if ( corner >= (uint) corners )
+        return cnt == 0;
+
+    uint k = 0;
+    dbSet<dbNet> nets = block->getNets();
+    dbSet<dbNet>::iterator nitr;
+
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+    {
+        dbSet<dbCapNode> nodes = nitr->getCapNodes();
+        dbSet<dbCapNode>::iterator citr;
+
+        for( citr = nodes.begin(); citr != nodes.end(); ++citr, ++k )
+        {
+            if ( (k >= cnt) || (ids[k] != citr->getId()) || (nets_[k] != nitr->getId())
+                 || (cap[k] != citr->getCapacitance(corner)) )
+                return false;
+        }
+    }
+
+    return k == cnt;
+}
+
+int main( int argc, char ** argv )
+{
+    dbDatabase * db = dbDatabase::create();
+    lefin reader(db, false);
+    std::string lef = data_file(argc, argv, "Nangate45/NangateOpenCellLibrary.mod.lef");
+    dbLib * lib = reader.createTechAndLib("lib", lef.c_str());
+    check("read lef", lib != NULL);
+
+    if ( lib == NULL )
+        return exit_summary();
+
+    dbTech * tech = db->getTech();
+    dbChip * chip = dbChip::create(db);
+    dbBlock * block = dbBlock::create(chip, "top");
+    block->setCornerCount(corners);
+    srand(3);
+
+    // Nets without wires or parasitics, with a global wire only, with a
+    // wire, with parasitics, and with both.
+    int i;
+
+    for( i = 0; i < 400; ++i )
+    {
+        char name[16];
+        sprintf(name, "n%d", i);
+        dbNet * net = dbNet::create(block, name);
+
+        if ( i % 5 == 1 )
+            routeNet(net, tech, true, 4);
+        else if ( i % 5 >= 2 )
+            routeNet(net, tech, false, 4);
+
+        if ( (i % 5 == 3) || (i % 5 == 4) || (i % 7 == 0) )
+            addParasitics(net);
+    }
+
+    // Destroyed objects leave holes in the id ranges.
+    dbNet::destroy( block->findNet("n3") );
+    dbNet::destroy( block->findNet("n4") );
+
+    uint threads[2] = { 1, 4 };
+    int t;
+
+    for( t = 0; t < 2; ++t )
+    {
+        check("wire segments match the wire shapes", checkWireSegments(block, threads[t]));
+
+        int corner;
+        bool rsegs = true;
+        bool nodes = true;
+
+        for( corner = 0; corner <= corners; ++corner )
+        {
+            rsegs = rsegs && checkRSegs(block, corner, threads[t]);
+            nodes = nodes && checkCapNodes(block, corner, threads[t]);
+        }
+
+        check("rsegs match the net rsegs", rsegs);
+        check("cap-nodes match the net cap-nodes", nodes);
+    }
+
+    std::vector<uint> seg_nets, seg_levels;
+    std::vector<int> seg_x1, seg_y1, seg_x2, seg_y2;
+    check("the block has wire segments",
+          dbBulkAccess::getWireSegments( block, seg_nets, seg_levels, seg_x1,
+                                         seg_y1, seg_x2, seg_y2 ) > 400);
+
+    dbDatabase::destroy(db);
+    return exit_summary();
+}
@@ -0,0 +1,311 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// A DEF read with skipWires(), skipSpecialWires() or skipShields() has the
+// connectivity and net options of a full read and only lacks the dropped
+// wires, for routed regular nets (NEW paths, vias, TAPER/STYLE, subnets, a
+// comment inside a path and options after the routing) and special nets.
+//
+#include "db.h"
+#include "defin.h"
+#include "lefin.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+using namespace odb;
+
+enum SkipMode
+{
+    SKIP_NONE,
+    SKIP_WIRES,
+    SKIP_SPECIAL_WIRES,
+    SKIP_SHIELDS,
+    SKIP_ALL
+};
+
+static dbBlock * readDesign( int argc, char ** argv, const char * def_name, SkipMode mode )
+{
+    dbDatabase * db = dbDatabase::create();
+    lefin lef_reader(db, false);
+    std::string lef = data_file(argc, argv, "Nangate45/NangateOpenCellLibrary.mod.lef");
+    dbLib * lib = lef_reader.createTechAndLib("lib", lef.c_str());
+
+    if ( lib == NULL )
+        return NULL;
+
+    std::vector<dbLib *> libs;
+    libs.push_back(lib);
+    defin def_reader(db);
+
+    if ( (mode == SKIP_WIRES) || (mode == SKIP_ALL) )
+        def_reader.skipWires();
+
+    if ( (mode == SKIP_SPECIAL_WIRES) || (mode == SKIP_ALL) )
+        def_reader.skipSpecialWires();
+
+    if ( mode == SKIP_SHIELDS )
+        def_reader.skipShields();
+
+    std::string def = data_file(argc, argv, def_name);
+    dbChip * chip = def_reader.createChip(libs, def.c_str());
+
+    if ( chip == NULL )
+        return NULL;
+
+    return chip->getBlock();
+}
+
+// The sorted "inst/mterm" and bterm names of a net.
+static std::vector<std::string> connections( dbNet * net )
+{
+    std::vector<std::string> conns;
+    dbSet<dbITerm> iterms = net->getITerms();
+    dbSet<dbITerm>::iterator iitr;
+
+    for( iitr = iterms.begin(); iitr != iterms.end(); ++iitr )
+    {
+        dbITerm * iterm = *iitr;
+        std::string name = iterm->getInst()->getConstName();
+        name += "/";
+        name += iterm->getMTerm()->getConstName();
+        conns.push_back(name);
+    }
+
+    dbSet<dbBTerm> bterms = net->getBTerms();
+    dbSet<dbBTerm>::iterator bitr;
+
+    for( bitr = bterms.begin(); bitr != bterms.end(); ++bitr )
+        conns.push_back(std::string("PIN ") + bitr->getConstName());
+
+    std::sort(conns.begin(), conns.end());
+    return conns;
+}
+
+static int countSBoxes( dbNet * net, dbWireType type )
+{
+    int cnt = 0;
+    dbSet<dbSWire> swires = net->getSWires();
+    dbSet<dbSWire>::iterator itr;
+
+    for( itr = swires.begin(); itr != swires.end(); ++itr )
+    {
+        if ( itr->getWireType() == type )
+            cnt += itr->getWires().size();
+    }
+
+    return cnt;
+}
+
+// Compare the netlist of a skipped read with the full read. The regular
+// and the special wires are compared unless they were dropped.
+static bool sameDesign( dbBlock * full, dbBlock * skipped, SkipMode mode )
+{
+    if ( full->getNets().size() != skipped->getNets().size() )
+        return false;
+
+    if ( full->getInsts().size() != skipped->getInsts().size() )
+        return false;
+
+    if ( full->getBTerms().size() != skipped->getBTerms().size() )
+        return false;
+
+    bool keep_wires = (mode == SKIP_SPECIAL_WIRES) || (mode == SKIP_SHIELDS);
+    bool keep_swires = (mode == SKIP_WIRES);
+    dbSet<dbNet> nets = full->getNets();
+    dbSet<dbNet>::iterator itr;
+
+    for( itr = nets.begin(); itr != nets.end(); ++itr )
+    {
+        dbNet * n1 = *itr;
+        dbNet * n2 = skipped->findNet(n1->getConstName());
+
+        if ( n2 == NULL )
+            return false;
+
+        if ( connections(n1) != connections(n2) )
+            return false;
+
+        if ( (n1->getSigType() != n2->getSigType()) || (n1->getWeight() != n2->getWeight())
+             || (n1->getSourceType() != n2->getSourceType()) || (n1->isSpecial() != n2->isSpecial()) )
+            return false;
+
+        if ( keep_wires )
+        {
+            if ( ! sameWire(n1->getWire(), n2->getWire()) )
+                return false;
+        }
+        else if ( n2->getWire() != NULL )
+            return false;
+
+        int routed = countSBoxes(n2, dbWireType::ROUTED) + countSBoxes(n2, dbWireType::FIXED);
+        int shield = countSBoxes(n2, dbWireType::SHIELD);
+
+        if ( keep_swires )
+        {
+            if ( (routed != countSBoxes(n1, dbWireType::ROUTED) + countSBoxes(n1, dbWireType::FIXED))
+                 || (shield != countSBoxes(n1, dbWireType::SHIELD)) )
+                return false;
+        }
+        else if ( mode == SKIP_SHIELDS )
+        {
+            if ( (routed != countSBoxes(n1, dbWireType::ROUTED) + countSBoxes(n1, dbWireType::FIXED))
+                 || (shield != 0) )
+                return false;
+        }
+        else if ( routed + shield != 0 )
+            return false;
+    }
+
+    return true;
+}
+
+static std::string upper( std::string name )
+{
+    uint i;
+
+    for( i = 0; i < name.size(); ++i )
+        if ( (name[i] >= 'a') && (name[i] <= 'z') )
+            name[i] = name[i] - 'a' + 'A';
+
+    return name;
+}
+
+// Compare a skip-all read with NAMESCASESENSITIVE OFF, whose names are
+// upper-cased, with the skip-all read of the same design.
+static bool sameUpperDesign( dbBlock * block, dbBlock * upper_block )
+{
+    if ( (block->getNets().size() != upper_block->getNets().size())
+         || (block->getInsts().size() != upper_block->getInsts().size()) )
+        return false;
+
+    dbSet<dbNet> nets = block->getNets();
+    dbSet<dbNet>::iterator itr;
+
+    for( itr = nets.begin(); itr != nets.end(); ++itr )
+    {
+        dbNet * n1 = *itr;
+        dbNet * n2 = upper_block->findNet(upper(n1->getConstName()).c_str());
+
+        if ( n2 == NULL )
+            return false;
+
+        std::vector<std::string> conns = connections(n1);
+        std::vector<std::string>::iterator citr;
+
+        for( citr = conns.begin(); citr != conns.end(); ++citr )
+            *citr = upper(*citr);
+
+        std::sort(conns.begin(), conns.end());
+
+        if ( conns != connections(n2) )
+            return false;
+
+        if ( (n1->getSigType() != n2->getSigType()) || (n1->getWeight() != n2->getWeight())
+             || (n1->getSourceType() != n2->getSourceType()) || (n1->isSpecial() != n2->isSpecial()) )
+            return false;
+
+        if ( (n2->getWire() != NULL) || (n2->getSWires().size() != 0) )
+            return false;
+    }
+
+    return true;
+}
+
+int main( int argc, char ** argv )
+{
+    dbBlock * full = readDesign(argc, argv, "routed.def", SKIP_NONE);
+    check("read routed def", full != NULL);
+
+    if ( full == NULL )
+        return exit_summary();
+
+    // The full read has the routing the skipped reads must drop.
+    check("in1 routed", full->findNet("in1")->getWire() != NULL);
+    check("n1 routed", full->findNet("n1")->getWire() != NULL);
+    check("n3 routed", full->findNet("n3")->getWire() != NULL);
+    check("clk unrouted", full->findNet("clk")->getWire() == NULL);
+    check("VDD stripes", countSBoxes(full->findNet("VDD"), dbWireType::ROUTED) == 3);
+    check("VDD shield", countSBoxes(full->findNet("VDD"), dbWireType::SHIELD) == 1);
+    check("VSS followpin", countSBoxes(full->findNet("VSS"), dbWireType::FIXED) == 1);
+    check("n1 connections", connections(full->findNet("n1")).size() == 3);
+    check("in2 source", full->findNet("in2")->getSourceType() == dbSourceType::TIMING);
+    check("n2 weight", full->findNet("n2")->getWeight() == 3);
+    check("VSS weight", full->findNet("VSS")->getWeight() == 2);
+    check("clk use", full->findNet("clk")->getSigType() == dbSigType::CLOCK);
+
+    dbBlock * block = readDesign(argc, argv, "routed.def", SKIP_WIRES);
+    check("skipWires read", block != NULL);
+    check("skipWires matches the full read", block && sameDesign(full, block, SKIP_WIRES));
+
+    block = readDesign(argc, argv, "routed.def", SKIP_SPECIAL_WIRES);
+    check("skipSpecialWires read", block != NULL);
+    check("skipSpecialWires matches the full read", block && sameDesign(full, block, SKIP_SPECIAL_WIRES));
+
+    block = readDesign(argc, argv, "routed.def", SKIP_SHIELDS);
+    check("skipShields read", block != NULL);
+    check("skipShields matches the full read", block && sameDesign(full, block, SKIP_SHIELDS));
+
+    block = readDesign(argc, argv, "routed.def", SKIP_ALL);
+    check("skip all read", block != NULL);
+    check("skip all matches the full read", block && sameDesign(full, block, SKIP_ALL));
+
+    // With NAMESCASESENSITIVE OFF the keywords that end a skipped wire, and
+    // the "+ shape"/"+ style" options stepped over inside it, are in any
+    // case. The layers of the full read would be upper-cased too, which the
+    // Nangate45 LEF does not define, so only the skipped reads are compared.
+    dbBlock * upper_block = readDesign(argc, argv, "routed_nocase.def", SKIP_ALL);
+    check("case insensitive skip all read", (block != NULL) && (upper_block != NULL));
+    check("case insensitive skip all matches", block && upper_block && sameUpperDesign(block, upper_block));
+    check("case insensitive VDD use", upper_block && upper_block->findNet("VDD")->getSigType() == dbSigType::POWER);
+    check("case insensitive VSS weight", upper_block && upper_block->findNet("VSS")->getWeight() == 2);
+
+    // The power grid of gcd, the same read as tests/python/20-def_skip_wires_test.py
+    dbBlock * pdn = readDesign(argc, argv, "gcd/gcd_pdn.def", SKIP_NONE);
+    block = readDesign(argc, argv, "gcd/gcd_pdn.def", SKIP_ALL);
+    check("read gcd_pdn", (pdn != NULL) && (block != NULL));
+
+    if ( (pdn == NULL) || (block == NULL) )
+        return exit_summary();
+
+    check("gcd_pdn has stripes", pdn->findNet("VDD")->getSWires().size() > 0);
+    check("gcd_pdn skipped nets", block->getNets().size() == 2);
+    check("gcd_pdn skipped vias", block->getVias().size() == 6);
+    check("gcd_pdn skipped rows", block->getRows().size() == 112);
+    check("gcd_pdn skip all matches the full read", sameDesign(pdn, block, SKIP_ALL));
+    check("gcd_pdn VDD use", block->findNet("VDD")->getSigType() == dbSigType::POWER);
+    check("gcd_pdn VSS use", block->findNet("VSS")->getSigType() == dbSigType::GROUND);
+
+    return exit_summary();
+}
@@ -0,0 +1,443 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// defout::selectWindow writes the instances, pins and nets of a window:
+// gcd with its 482 components, and a routed design whose wires and special
+// wires cross the window edge. The written DEF reads back with the
+// selected objects, its section counts match the section bodies and every
+// written wire point lies in the window.
+//
+#include "db.h"
+#include "defin.h"
+#include "defout.h"
+#include "dbWireCodec.h"
+#include "lefin.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+
+using namespace odb;
+
+static dbBlock * readDesign( int argc, char ** argv, const char * def_file )
+{
+    dbDatabase * db = dbDatabase::create();
+    lefin lef_reader(db, false);
+    std::string lef = data_file(argc, argv, "Nangate45/NangateOpenCellLibrary.mod.lef");
+    dbLib * lib = lef_reader.createTechAndLib("lib", lef.c_str());
+
+    if ( lib == NULL )
+        return NULL;
+
+    std::vector<dbLib *> libs;
+    libs.push_back(lib);
+    defin def_reader(db);
+    dbChip * chip = def_reader.createChip(libs, def_file);
+
+    if ( chip == NULL )
+        return NULL;
+
+    return chip->getBlock();
+}
+
+static bool isNumber( const std::string & s )
+{
+    char * end;
+    strtol(s.c_str(), &end, 10);
+    return (s.size() > 0) && (*end == 0);
+}
+
+//
+// The written DEF as text: the count in the header of a section and the
+// number of "-" entries in its body, and the points of the NETS and
+// SPECIALNETS paths ("*" resolved against the previous point).
+//
+struct DefText
+{
+    std::vector<std::string> _sections;
+    std::vector<int>         _header_counts;
+    std::vector<int>         _body_counts;
+    std::vector<int>         _xs;
+    std::vector<int>         _ys;
+
+    bool read( const char * file )
+    {
+        std::ifstream in(file);
+
+        if ( ! in )
+            return false;
+
+        std::vector<std::string> words;
+        std::string word;
+
+        while( in >> word )
+            words.push_back(word);
+
+        int cur = -1;
+        bool in_nets = false;
+        int x = 0;
+        int y = 0;
+        uint i;
+
+        for( i = 0; i < words.size(); ++i )
+        {
+            const std::string & w = words[i];
+
+            if ( (w == "COMPONENTS" || w == "PINS" || w == "NETS" || w == "SPECIALNETS")
+                 && (i + 1 < words.size()) && isNumber(words[i+1]) )
+            {
+                _sections.push_back(w);
+                _header_counts.push_back(atoi(words[i+1].c_str()));
+                _body_counts.push_back(0);
+                cur = _sections.size() - 1;
+                in_nets = (w == "NETS") || (w == "SPECIALNETS");
+                ++i;
+            }
+            else if ( w == "END" )
+            {
+                cur = -1;
+                in_nets = false;
+            }
+            else if ( (cur >= 0) && (w == "-") )
+                ++_body_counts[cur];
+            else if ( in_nets && (w == "(") )
+            {
+                // A point is "( x y [ext] )", "( inst term )" is a connection.
+                std::vector<std::string> group;
+
+                for( ++i; (i < words.size()) && (words[i] != ")"); ++i )
+                    group.push_back(words[i]);
+
+                if ( group.size() < 2 )
+                    continue;
+
+                if ( ! (isNumber(group[0]) || group[0] == "*") || ! (isNumber(group[1]) || group[1] == "*") )
+                    continue;
+
+                if ( group[0] != "*" )
+                    x = atoi(group[0].c_str());
+
+                if ( group[1] != "*" )
+                    y = atoi(group[1].c_str());
+
+                _xs.push_back(x);
+                _ys.push_back(y);
+            }
+        }
+
+        return true;
+    }
+
+    bool countsMatch()
+    {
+        uint i;
+
+        for( i = 0; i < _sections.size(); ++i )
+        {
+            if ( _header_counts[i] != _body_counts[i] )
+            {
+                fprintf(stderr, "%s %d != %d\n", _sections[i].c_str(), _header_counts[i], _body_counts[i]);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    int count( const char * section )
+    {
+        uint i;
+
+        for( i = 0; i < _sections.size(); ++i )
+            if ( _sections[i] == section )
+                return _header_counts[i];
+
+        return 0;
+    }
+
+    bool pointsIn( const adsRect & window )
+    {
+        uint i;
+
+        for( i = 0; i < _xs.size(); ++i )
+            if ( ! window.intersects( adsPoint(_xs[i], _ys[i]) ) )
+                return false;
+
+        return true;
+    }
+};
+
+static bool bpinInWindow( dbBTerm * bterm, const adsRect & window )
+{
+    dbSet<dbBPin> bpins = bterm->getBPins();
+    dbSet<dbBPin>::iterator itr;
+
+    for( itr = bpins.begin(); itr != bpins.end(); ++itr )
+    {
+        adsRect r;
+        itr->getBox()->getBox(r);
+
+        if ( window.intersects(r) )
+            return true;
+    }
+
+    return false;
+}
+
+static int instsInWindow( dbBlock * block, const adsRect & window )
+{
+    int cnt = 0;
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator itr;
+
+    for( itr = insts.begin(); itr != insts.end(); ++itr )
+    {
+        adsRect bbox;
+        itr->getBBox()->getBox(bbox);
+
+        if ( window.intersects(bbox) )
+            ++cnt;
+    }
+
+    return cnt;
+}
+
+static int bTermsInWindow( dbBlock * block, const adsRect & window )
+{
+    int cnt = 0;
+    dbSet<dbBTerm> bterms = block->getBTerms();
+    dbSet<dbBTerm>::iterator itr;
+
+    for( itr = bterms.begin(); itr != bterms.end(); ++itr )
+        if ( bpinInWindow(*itr, window) )
+            ++cnt;
+
+    return cnt;
+}
+
+// Nets of an unrouted block that connect to an instance or a pin of the window.
+static int netsInWindow( dbBlock * block, const adsRect & window )
+{
+    int cnt = 0;
+    dbSet<dbNet> nets = block->getNets();
+    dbSet<dbNet>::iterator itr;
+
+    for( itr = nets.begin(); itr != nets.end(); ++itr )
+    {
+        bool in = false;
+        dbSet<dbITerm> iterms = itr->getITerms();
+        dbSet<dbITerm>::iterator titr;
+
+        for( titr = iterms.begin(); titr != iterms.end() && ! in; ++titr )
+        {
+            adsRect bbox;
+            titr->getInst()->getBBox()->getBox(bbox);
+            in = window.intersects(bbox);
+        }
+
+        dbSet<dbBTerm> bterms = itr->getBTerms();
+        dbSet<dbBTerm>::iterator bitr;
+
+        for( bitr = bterms.begin(); bitr != bterms.end() && ! in; ++bitr )
+            in = bpinInWindow(*bitr, window);
+
+        if ( in )
+            ++cnt;
+    }
+
+    return cnt;
+}
+
+// Every decoded wire point and every special-wire path of the block lies in the window.
+static bool wiresIn( dbBlock * block, const adsRect & window )
+{
+    dbSet<dbNet> nets = block->getNets();
+    dbSet<dbNet>::iterator itr;
+
+    for( itr = nets.begin(); itr != nets.end(); ++itr )
+    {
+        dbWire * wire = itr->getWire();
+
+        if ( wire )
+        {
+            dbWireDecoder decoder;
+            decoder.begin(wire);
+            dbWireDecoder::OpCode opcode;
+
+            while( (opcode = decoder.next()) != dbWireDecoder::END_DECODE )
+            {
+                if ( (opcode != dbWireDecoder::POINT) && (opcode != dbWireDecoder::POINT_EXT) )
+                    continue;
+
+                int x, y;
+                decoder.getPoint(x,y);
+
+                if ( ! window.intersects( adsPoint(x,y) ) )
+                    return false;
+            }
+        }
+
+        dbSet<dbSWire> swires = itr->getSWires();
+        dbSet<dbSWire>::iterator sitr;
+
+        for( sitr = swires.begin(); sitr != swires.end(); ++sitr )
+        {
+            dbSet<dbSBox> boxes = sitr->getWires();
+            dbSet<dbSBox>::iterator bitr;
+
+            for( bitr = boxes.begin(); bitr != boxes.end(); ++bitr )
+            {
+                adsRect r;
+                bitr->getBox(r);
+                adsPoint center((r.xMin() + r.xMax()) / 2, (r.yMin() + r.yMax()) / 2);
+
+                if ( ! window.intersects(center) )
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static bool writeWindow( dbBlock * block, const adsRect & window, uint threads, const char * file )
+{
+    defout writer;
+    writer.setVersion(defout::DEF_5_6);
+    writer.selectWindow(window);
+    writer.setThreads(threads);
+    return writer.writeBlock(block, file);
+}
+
+int main( int argc, char ** argv )
+{
+    // gcd: unplaced components at the origin, fixed cells and pins on the
+    // die, no routing. The upper-right quarter drops the unplaced ones.
+    std::string def = data_file(argc, argv, "gcd/floorplan.def");
+    dbBlock * gcd = readDesign(argc, argv, def.c_str());
+    check("read gcd", gcd != NULL);
+
+    if ( gcd == NULL )
+        return exit_summary();
+
+    check("gcd components", gcd->getInsts().size() == 482);
+    check("gcd pins", gcd->getBTerms().size() == 54);
+    check("gcd nets", gcd->getNets().size() == 385);
+
+    adsRect die;
+    gcd->getDieArea(die);
+    adsRect window(die.xMin() + die.dx() / 2, die.yMin() + die.dy() / 2, die.xMax(), die.yMax());
+    int insts = instsInWindow(gcd, window);
+    int pins = bTermsInWindow(gcd, window);
+    int nets = netsInWindow(gcd, window);
+    check("window drops components", (insts > 0) && (insts < 482));
+    check("window drops pins", (pins > 0) && (pins < 54));
+    check("window drops nets", (nets > 0) && (nets < 385));
+
+    const char * gcd_file = "def_window_test_gcd.def";
+    uint threads;
+
+    for( threads = 1; threads <= 4; threads += 3 )
+    {
+        check("write gcd window", writeWindow(gcd, window, threads, gcd_file));
+
+        DefText text;
+        check("read gcd window text", text.read(gcd_file));
+        check("gcd section counts match the bodies", text.countsMatch());
+        check("gcd COMPONENTS count", text.count("COMPONENTS") == insts);
+        check("gcd PINS count", text.count("PINS") == pins);
+        check("gcd NETS count", text.count("NETS") == nets);
+
+        dbBlock * block = readDesign(argc, argv, gcd_file);
+        check("read back gcd window", block != NULL);
+
+        if ( block == NULL )
+            continue;
+
+        adsRect area;
+        block->getDieArea(area);
+        check("gcd die area is the window", area == window);
+        check("gcd window components", (int) block->getInsts().size() == insts);
+        check("gcd window pins", (int) block->getBTerms().size() == pins);
+        check("gcd window nets", (int) block->getNets().size() == nets);
+    }
+
+    remove(gcd_file);
+
+    // A routed design, the window cuts through wires and special wires.
+    def = data_file(argc, argv, "routed.def");
+    dbBlock * routed = readDesign(argc, argv, def.c_str());
+    check("read routed", routed != NULL);
+
+    if ( routed == NULL )
+        return exit_summary();
+
+    adsRect rwindow(0, 0, 10000, 40000);
+    check("routed wires cross the window", ! wiresIn(routed, rwindow));
+
+    const char * routed_file = "def_window_test_routed.def";
+
+    for( threads = 1; threads <= 4; threads += 3 )
+    {
+        check("write routed window", writeWindow(routed, rwindow, threads, routed_file));
+
+        // Both files have the units of the LEF, DEF points are database points.
+        DefText text;
+        check("read routed window text", text.read(routed_file));
+        check("routed section counts match the bodies", text.countsMatch());
+        check("routed COMPONENTS count", text.count("COMPONENTS") == 2);
+        check("routed NETS count", text.count("NETS") == 4);
+        check("routed SPECIALNETS count", text.count("SPECIALNETS") == 2);
+        check("routed paths were written", text._xs.size() > 0);
+        check("routed paths lie in the window", text.pointsIn(rwindow));
+
+        dbBlock * block = readDesign(argc, argv, routed_file);
+        check("read back routed window", block != NULL);
+
+        if ( block == NULL )
+            continue;
+
+        check("routed window wires lie in the window", wiresIn(block, rwindow));
+        check("n1 is clipped", (block->findNet("n1") != NULL) && (block->findNet("n1")->getWire() != NULL));
+        check("n2 is clipped", (block->findNet("n2") != NULL) && (block->findNet("n2")->getWire() != NULL));
+        check("out is dropped", block->findNet("out") == NULL);
+        check("n3 is dropped", block->findNet("n3") == NULL);
+        check("VDD is clipped", (block->findNet("VDD") != NULL) && (block->findNet("VDD")->getSWires().size() > 0));
+    }
+
+    remove(routed_file);
+    return exit_summary();
+}
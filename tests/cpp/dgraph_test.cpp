@@ -0,0 +1,412 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// Dgraph::bellmanford, find_longest_path and resolve give the longest paths
+// of the sweep they replaced (the bellmanford of the previous release),
+// on an acyclic graph of several components, with upper bounds fixed by
+// modify() and with a positive cycle fixed by has_cycle().
+//
+#include "dgraph.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+struct EdgeSpec
+{
+    int    _s;
+    int    _d;
+    double _wt;
+    bool   _preserve;
+};
+
+// Reference: the bellmanford of the previous release, a sweep over the
+// vertices in topological order until nothing changes.
+static bool oldBellmanford( Dgraph & g, bool * rest )
+{
+    int j;
+    int i;
+    g.init();
+    Dedge * e = NULL;
+    double delta = 0;
+
+    if ( rest )
+        *rest = false;
+
+    for( j = g.n() - 1; j >= 0; j-- )
+    {
+        bool changed = false;
+
+        for( i = g.n() - 1; i >= 0; i-- )
+        {
+            int k = g._topo_sorted.get(i);
+
+            if ( ! g.neighbors_begin(k) )
+                continue;
+
+            while( g.next_neighbor(e) )
+            {
+                if ( rest )
+                    *rest = false;
+
+                if ( g.relax(e, rest) )
+                {
+                    changed = true;
+
+                    if ( rest && *rest )
+                    {
+                        delta = g.dist[e->d] - g.get_upper_bound(e->d);
+                        g.modify(e->d, delta);
+                        return false;
+                    }
+                }
+            }
+        }
+
+        if ( ! changed )
+            return true;
+
+        if ( g.has_cycle() )
+            return false;
+    }
+
+    return true;
+}
+
+// Reference: the find_longest_path of the previous release.
+static void oldFindLongestPath( Dgraph & g )
+{
+    int i;
+    g.init();
+
+    for( i = g.n() - 1; i >= 0; i-- )
+    {
+        int k = g._topo_sorted.get(i);
+
+        if ( ! g.neighbors_begin(k) )
+            continue;
+
+        Dedge * e = NULL;
+
+        while( g.next_neighbor(e) )
+            g.relax(e);
+    }
+}
+
+static void addEdges( Dgraph & g, const std::vector<EdgeSpec> & specs, std::vector<Dedge *> & edges )
+{
+    uint i;
+
+    for( i = 0; i < specs.size(); ++i )
+        edges.push_back( g.add_edge(specs[i]._s, specs[i]._d, specs[i]._wt, false, specs[i]._preserve) );
+
+    g.topo_sort();
+}
+
+static double randomWeight()
+{
+    return (rand() % 200001 - 100000) / 10000.0 + (rand() % 1000) * 1e-7;
+}
+
+//
+// An acyclic graph of ncomp components of size vertices each, the vertex
+// labels are shuffled so the topological order is not the label order.
+// The vertices past ncomp * size are isolated.
+//
+static std::vector<EdgeSpec> makeDag( int n, int ncomp, int size, int degree )
+{
+    std::vector<int> label(n);
+    int i;
+
+    for( i = 0; i < n; ++i )
+        label[i] = i;
+
+    for( i = n - 1; i > 0; --i )
+        std::swap( label[i], label[rand() % (i + 1)] );
+
+    std::vector<EdgeSpec> specs;
+    int c;
+
+    for( c = 0; c < ncomp; ++c )
+    {
+        int base = c * size;
+
+        for( i = 1; i < size; ++i )
+        {
+            int k;
+
+            for( k = 0; k < degree; ++k )
+            {
+                EdgeSpec e;
+                e._s = label[base + rand() % i];
+                e._d = label[base + i];
+                e._wt = randomWeight();
+                e._preserve = (rand() % 10 == 0);
+                specs.push_back(e);
+            }
+        }
+    }
+
+    return specs;
+}
+
+static bool sameDist( Dgraph & g1, Dgraph & g2 )
+{
+    int i;
+
+    for( i = 0; i < g1.n(); ++i )
+    {
+        if ( fabs(g1.dist[i] - g2.dist[i]) > 1e-6 )
+        {
+            fprintf(stderr, "dist %d: %g != %g\n", i, g1.dist[i], g2.dist[i]);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// The upper bounds are met within the tolerance of the solvers.
+static bool boundsMet( Dgraph & g )
+{
+    int i;
+
+    for( i = 0; i < g.n(); ++i )
+    {
+        if ( g.dist[i] > g.get_upper_bound(i) * (1 + 1e-3) + 0.001 )
+            return false;
+    }
+
+    return true;
+}
+
+// The distances of g are the longest paths for its current edge weights.
+static bool isLongestPath( Dgraph & g )
+{
+    std::vector<double> dist(g.dist, g.dist + g.n());
+    oldBellmanford(g, NULL);
+    int i;
+    bool same = true;
+
+    for( i = 0; i < g.n(); ++i )
+    {
+        if ( fabs(g.dist[i] - dist[i]) > 1e-6 )
+            same = false;
+
+        g.dist[i] = dist[i];
+    }
+
+    return same;
+}
+
+int main( int argc, char ** argv )
+{
+    srand(11);
+    const int n = 3000;
+    const int ncomp = 6;
+    const int size = 480;
+    std::vector<EdgeSpec> specs = makeDag(n, ncomp, size, 3);
+
+    // Longest paths of an acyclic graph.
+    Dgraph ref(n);
+    Dgraph g(n);
+    std::vector<Dedge *> ref_edges;
+    std::vector<Dedge *> edges;
+    addEdges(ref, specs, ref_edges);
+    addEdges(g, specs, edges);
+
+    oldBellmanford(ref, NULL);
+    int threads;
+
+    for( threads = 1; threads <= 4; threads += 3 )
+    {
+        g.set_threads(threads);
+        check("bellmanford", g.bellmanford());
+        check("bellmanford matches the sweep", sameDist(ref, g));
+    }
+
+    // The topological order ignores the negative edges, so one pass
+    // depends on the edge order: compare on the same graph.
+    oldFindLongestPath(g);
+    std::vector<double> swept(g.dist, g.dist + n);
+    g.find_longest_path();
+    check("find_longest_path matches the sweep", std::equal(swept.begin(), swept.end(), g.dist));
+
+    // Upper bounds below the longest paths, fixed with modify() by the
+    // sweep and by bellmanford; resolve carries on without starting over.
+    std::vector<int> bounded;
+    int i;
+    uint k;
+    oldBellmanford(ref, NULL);
+
+    for( i = 0; i < n; ++i )
+    {
+        if ( (ref.dist[i] > 5) && (rand() % 20 == 0) )
+            bounded.push_back(i);
+    }
+
+    check("bounded vertices", bounded.size() > 10);
+
+    Dgraph ub_ref(n);
+    Dgraph ub_bf(n);
+    Dgraph ub_re(n);
+    std::vector<Dedge *> ub_ref_edges;
+    std::vector<Dedge *> ub_bf_edges;
+    std::vector<Dedge *> ub_re_edges;
+    addEdges(ub_ref, specs, ub_ref_edges);
+    addEdges(ub_bf, specs, ub_bf_edges);
+    addEdges(ub_re, specs, ub_re_edges);
+
+    for( i = 0; i < (int) bounded.size(); ++i )
+    {
+        double upper = 0.7 * ref.dist[bounded[i]];
+        ub_ref.set_upper_bound(bounded[i], upper);
+        ub_bf.set_upper_bound(bounded[i], upper);
+        ub_re.set_upper_bound(bounded[i], upper);
+    }
+
+    bool rest = false;
+    int it = 0;
+
+    while( ! oldBellmanford(ub_ref, &rest) && (++it < MAXIT) );
+
+    check("sweep meets the upper bounds", boundsMet(ub_ref));
+
+    it = 0;
+    ub_bf.set_threads(4);
+
+    while( ! ub_bf.bellmanford(&rest) && (++it < MAXIT) );
+
+    check("bellmanford meets the upper bounds", boundsMet(ub_bf));
+    check("bellmanford after modify is the longest path", isLongestPath(ub_bf));
+
+    int iso = n - 1;
+    check("isolated vertex", iso >= ncomp * size);
+    bool ok = ub_re.bellmanford(&rest);
+    check("bellmanford stops at an upper bound", ! ok && rest);
+
+    // resolve() only relaxes the modified part of the graph: the distance
+    // of an isolated vertex is left alone.
+    ub_re.dist[iso] = 7;
+    it = 0;
+
+    while( ! ok && (++it < MAXIT) )
+        ok = ub_re.resolve(&rest);
+
+    check("resolve converges", ok);
+    check("resolve is incremental", ub_re.dist[iso] == 7);
+    ub_re.dist[iso] = 0;
+    check("resolve meets the upper bounds", boundsMet(ub_re));
+    check("resolve after modify is the longest path", isLongestPath(ub_re));
+
+    // A new upper bound on the solved graph.
+    int v = bounded[0];
+    ub_re.set_upper_bound(v, 0.5 * ub_re.dist[v]);
+    ok = ub_re.resolve(&rest);
+    check("resolve sees a lowered upper bound", ! ok && rest);
+    it = 0;
+
+    while( ! ok && (++it < MAXIT) )
+        ok = ub_re.resolve(&rest);
+
+    check("resolve meets the lowered upper bound", ok && boundsMet(ub_re));
+    check("resolve after the new bound is the longest path", isLongestPath(ub_re));
+
+    // A positive cycle: a chain of positive edges closed by a back edge, in
+    // an acyclic graph of edges negative enough that no other cycle is
+    // positive. has_cycle() spreads the cycle weight over its edges, so
+    // the sweep, bellmanford and resolve end with the same weights and
+    // distances.
+    std::vector<EdgeSpec> cyclic = makeDag(600, 1, 600, 2);
+
+    for( k = 0; k < cyclic.size(); ++k )
+        cyclic[k]._wt = -25 - (rand() % 1000) / 100.0;
+
+    const int chain = 10;
+    int c;
+
+    for( c = 0; c < chain; ++c )
+    {
+        EdgeSpec e;
+        e._s = (c == 0) ? 0 : 40 * c;
+        e._d = (c == chain - 1) ? 0 : 40 * (c + 1);
+        e._wt = 0.5 + (rand() % 150) / 100.0;
+        e._preserve = false;
+        cyclic.push_back(e);
+    }
+
+    Dgraph cy_ref(600);
+    Dgraph cy_bf(600);
+    Dgraph cy_re(600);
+    std::vector<Dedge *> cy_ref_edges;
+    std::vector<Dedge *> cy_bf_edges;
+    std::vector<Dedge *> cy_re_edges;
+    addEdges(cy_ref, cyclic, cy_ref_edges);
+    addEdges(cy_bf, cyclic, cy_bf_edges);
+    addEdges(cy_re, cyclic, cy_re_edges);
+
+    it = 0;
+
+    while( ! oldBellmanford(cy_ref, NULL) && (++it < MAXIT) );
+
+    check("sweep finds the cycle", cy_ref.cycles.n() == 1);
+
+    it = 0;
+
+    while( ! cy_bf.bellmanford() && (++it < MAXIT) );
+
+    check("bellmanford finds the cycle", cy_bf.cycles.n() == 1);
+    check("bellmanford matches the sweep on a cycle", sameDist(cy_ref, cy_bf));
+
+    ok = cy_re.bellmanford();
+    it = 0;
+
+    while( ! ok && (++it < MAXIT) )
+        ok = cy_re.resolve();
+
+    check("resolve finds the cycle", cy_re.cycles.n() == 1);
+    check("resolve matches the sweep on a cycle", sameDist(cy_ref, cy_re));
+
+    bool same_wt = true;
+
+    for( k = 0; k < cyclic.size(); ++k )
+    {
+        if ( (fabs(cy_ref_edges[k]->wt - cy_bf_edges[k]->wt) > 1e-9)
+             || (fabs(cy_ref_edges[k]->wt - cy_re_edges[k]->wt) > 1e-9) )
+            same_wt = false;
+    }
+
+    check("cycle weights match the sweep", same_wt);
+    return exit_summary();
+}
@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// Savepoint rollback over actions that cannot be undone, and eco files in
+// the legacy format whose disconnect records do not carry the net.
+//
+#include "db.h"
+#include "dbDatabase.h"
+#include "dbJournal.h"
+#include "dbStream.h"
+#include "ZException.h"
+#include "test_helpers.h"
+
+using namespace odb;
+
+static void testRollback()
+{
+    dbDatabase * db = dbDatabase::create();
+    dbBlock * block = createBlock( db, 3 );
+    dbInst * u2 = block->findInst( "u2" );
+    dbITerm * a = u2->findITerm( "A" );
+    dbNet * n1 = block->findNet( "n1" );
+
+    dbDatabase::beginEco( block );
+
+    // A disconnect records the net and is undone.
+    dbDatabase::setSavepoint( block, "disconnect" );
+    dbITerm::disconnect( a );
+    check( "rollback disconnect", dbDatabase::rollbackToSavepoint( block, "disconnect" ) );
+    check( "iterm reconnected", a->getNet() == n1 );
+
+    // Deleted nets and instances are created again under their ids.
+    dbDatabase::setSavepoint( block, "destroy" );
+    uint u2_id = u2->getId();
+    uint a_id = a->getId();
+    dbInst::destroy( u2 );
+    dbNet::destroy( n1 );
+    check( "rollback destroy", dbDatabase::rollbackToSavepoint( block, "destroy" ) );
+    check( "inst restored", (block->findInst( "u2" ) == u2) && (u2->getId() == u2_id) );
+    check( "net restored", block->findNet( "n1" ) == n1 );
+    check( "iterm restored", (u2->findITerm( "A" ) == a) && (a->getId() == a_id) && (a->getNet() == n1) );
+    check( "net iterms restored", n1->getITerms().size() == 2 );
+
+    // A net deleted with a property cannot be restored, the rollback fails
+    // without undoing the other changes.
+    dbDatabase::setSavepoint( block, "delete" );
+    u2->setOrigin( 100, 200 );
+    dbNet * tmp = dbNet::create( block, "tmp" );
+    dbIntProperty::create( tmp, "weight", 1 );
+    dbNet::destroy( tmp );
+    int size = dbDatabase::checkEco( block );
+    bool thrown = false;
+
+    try
+    {
+        dbDatabase::rollbackToSavepoint( block, "delete" );
+    }
+    catch( ZException & )
+    {
+        thrown = true;
+    }
+
+    int x, y;
+    u2->getOrigin( x, y );
+    check( "rollback over delete throws", thrown );
+    check( "eco unchanged", dbDatabase::checkEco( block ) == size );
+    check( "origin kept", (x == 100) && (y == 200) );
+
+    dbDatabase::endEco( block );
+    dbDatabase::destroy( db );
+}
+
+static void testLegacyEco()
+{
+    dbDatabase * db = dbDatabase::create();
+    dbBlock * block = createBlock( db, 3 );
+    dbITerm * a = block->findInst( "u2" )->findITerm( "A" );
+
+    // Write a disconnect with the legacy record layout and file format.
+    dbJournal legacy( block );
+    legacy.beginAction( dbJournal::DISCONNECT_OBJECT );
+    legacy.pushParam( dbITermObj );
+    legacy.pushParam( a->getId() );
+    legacy.endAction();
+
+    FILE * file = tmpfile();
+    {
+        dbOStream stream( (_dbDatabase *) db, file );
+        stream << legacy;
+    }
+
+    // Read it back, write it out again (still legacy) and commit it.
+    rewind( file );
+    dbDatabase::readEco( block, file );
+    fclose( file );
+
+    file = tmpfile();
+    dbDatabase::writeEco( block, file );
+    rewind( file );
+    dbDatabase::readEco( block, file );
+    fclose( file );
+
+    dbDatabase::commitEco( block );
+    check( "legacy disconnect applied", a->getNet() == NULL );
+    check( "other iterm kept", block->findInst( "u1" )->findITerm( "Z" )->getNet() != NULL );
+
+    dbDatabase::destroy( db );
+}
+
+int main( int argc, char ** argv )
+{
+    testRollback();
+    testLegacyEco();
+    return exit_summary();
+}
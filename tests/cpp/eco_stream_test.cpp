@@ -0,0 +1,155 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// An eco written in the compact stream format and in the legacy format
+// must both reproduce the edited block when committed to a copy of the
+// original block.
+//
+#include "db.h"
+#include "dbDatabase.h"
+#include "dbBlock.h"
+#include "dbJournal.h"
+#include "dbStream.h"
+#include "test_helpers.h"
+#include <string>
+
+using namespace odb;
+
+static const int insts = 40;
+
+//
+// Move instances, and with "rewire" move some inputs to new nets. Legacy
+// eco files predate the net in disconnect records, so the legacy eco is
+// written without rewiring.
+//
+static void edit( dbBlock * block, bool rewire )
+{
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator itr;
+    int i = 0;
+
+    for( itr = insts.begin(); itr != insts.end(); ++itr, ++i )
+    {
+        dbInst * inst = *itr;
+        int step;
+
+        for( step = 0; step < 5; ++step )
+            inst->setOrigin( 1000 * i + 17 * step, 300 * step );
+
+        if ( rewire && (i % 5 == 0) )
+        {
+            dbITerm * a = inst->findITerm( "A" );
+
+            if ( a->getNet() )
+            {
+                char name[16];
+                sprintf( name, "eco%d", i );
+                dbITerm::disconnect( a );
+                dbITerm::connect( a, dbNet::create( block, name ) );
+            }
+        }
+    }
+}
+
+static std::string connection( dbITerm * iterm )
+{
+    return iterm->getNet() ? iterm->getNet()->getConstName() : "";
+}
+
+static bool sameBlock( dbBlock * a, dbBlock * b )
+{
+    if ( a->getNets().size() != b->getNets().size() )
+        return false;
+
+    dbSet<dbInst> insts = a->getInsts();
+    dbSet<dbInst>::iterator itr;
+
+    for( itr = insts.begin(); itr != insts.end(); ++itr )
+    {
+        dbInst * ia = *itr;
+        dbInst * ib = b->findInst( ia->getConstName() );
+        int xa, ya, xb, yb;
+        ia->getOrigin( xa, ya );
+        ib->getOrigin( xb, yb );
+        adsRect ra, rb;
+        ia->getBBox()->getBox( ra );
+        ib->getBBox()->getBox( rb );
+
+        if ( (xa != xb) || (ya != yb) || (ra != rb)
+             || (ia->getOrient() != ib->getOrient())
+             || (ia->getPlacementStatus() != ib->getPlacementStatus())
+             || (connection( ia->findITerm("A") ) != connection( ib->findITerm("A") ))
+             || (connection( ia->findITerm("Z") ) != connection( ib->findITerm("Z") )) )
+            return false;
+    }
+
+    return true;
+}
+
+static void roundTrip( bool legacy )
+{
+    dbDatabase * db = dbDatabase::create();
+    dbBlock * block = createBlock( db, insts );
+    dbDatabase::beginEco( block );
+    edit( block, ! legacy );
+    dbDatabase::endEco( block );
+
+    FILE * file = tmpfile();
+
+    if ( legacy )
+    {
+        dbOStream stream( (_dbDatabase *) db, file );
+        stream << *((_dbBlock *) block)->_journal_pending;
+    }
+    else
+        dbDatabase::writeEco( block, file );
+
+    rewind( file );
+
+    dbDatabase * db2 = dbDatabase::create();
+    dbBlock * block2 = createBlock( db2, insts );
+    check( "copy differs before commit", ! sameBlock( block, block2 ) );
+    dbDatabase::readEco( block2, file );
+    dbDatabase::commitEco( block2 );
+    check( "committed eco matches", sameBlock( block, block2 ) );
+
+    fclose( file );
+    dbDatabase::destroy( db2 );
+    dbDatabase::destroy( db );
+}
+
+int main( int argc, char ** argv )
+{
+    roundTrip( false );
+    roundTrip( true );
+    return exit_summary();
+}
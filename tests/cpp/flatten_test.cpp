@@ -0,0 +1,289 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// Flattening stages the copies of the child objects on several threads and
+// commits them serially in child order, so a block flattened on 2 or 4
+// threads is identical to the block flattened on one: same objects, wires,
+// special wires and bterm map properties. The child blocks have more nets
+// than a staging batch.
+//
+#include "db.h"
+#include "dbWireCodec.h"
+#include "dbFlatten.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+static dbBlock * buildDesign( dbDatabase * db, int num_children, int num_insts )
+{
+    srand(7);
+
+    dbTech * tech = dbTech::create(db);
+    dbLib * lib = dbLib::create(db, "lib");
+    dbTechLayer * m1 = dbTechLayer::create(tech, "M1", dbTechLayerType::ROUTING);
+    dbTechLayer * m2 = dbTechLayer::create(tech, "M2", dbTechLayerType::ROUTING);
+
+    dbMaster * inv = dbMaster::create(lib, "INV");
+    inv->setWidth(100);
+    inv->setHeight(200);
+    dbMTerm::create(inv, "A", dbIoType::INPUT);
+    dbMTerm::create(inv, "Y", dbIoType::OUTPUT);
+    inv->setFrozen();
+
+    dbMaster * hier = dbMaster::create(lib, "H");
+    hier->setWidth(10000);
+    hier->setHeight(10000);
+    hier->setType(dbMasterType::BLOCK);
+    dbMTerm::create(hier, "I", dbIoType::INPUT);
+    dbMTerm::create(hier, "O", dbIoType::OUTPUT);
+    hier->setFrozen();
+
+    dbChip * chip = dbChip::create(db);
+    dbBlock * top = dbBlock::create(chip, "top", '/');
+    std::vector<dbNet *> top_nets;
+    int k;
+
+    for( k = 0; k <= num_children; ++k )
+    {
+        char name[16];
+        sprintf(name, "t%d", k);
+        top_nets.push_back( dbNet::create(top, name) );
+    }
+
+    dbBTerm::create(top_nets[0], "in");
+
+    for( k = 0; k < num_children; ++k )
+    {
+        char name[16];
+        sprintf(name, "c%d", k);
+        dbBlock * child = dbBlock::create(top, name, '/');
+        child->setDieArea( adsRect(0, 0, 10000, 10000) );
+
+        dbVia * via = dbVia::create(child, "V12");
+        dbBox::create(via, m1, -5, -5, 5, 5);
+        dbBox::create(via, m2, -5, -5, 5, 5);
+
+        std::vector<dbNet *> nets;
+        std::vector<dbInst *> insts;
+        int i;
+
+        for( i = 0; i <= num_insts; ++i )
+        {
+            char net_name[16];
+            sprintf(net_name, "n%d", i);
+            nets.push_back( dbNet::create(child, net_name) );
+        }
+
+        dbBTerm::create(nets[0], "I");
+        dbBTerm::create(nets[num_insts], "O");
+
+        for( i = 0; i < num_insts; ++i )
+        {
+            char inst_name[16];
+            sprintf(inst_name, "u%d", i);
+            dbInst * inst = dbInst::create(child, inv, inst_name);
+            inst->setLocation( rand() % 9000, rand() % 9000 );
+            inst->setOrient( dbOrientType((dbOrientType::Value) (rand() % 8)) );
+            inst->setPlacementStatus(dbPlacementStatus::PLACED);
+            dbITerm::connect( inst->findITerm("A"), nets[i] );
+            dbITerm::connect( inst->findITerm("Y"), nets[i+1] );
+            insts.push_back(inst);
+        }
+
+        // Routed and global wires from the driver to the load, with a via
+        // and a branch.
+        for( i = 0; i <= num_insts; ++i )
+        {
+            dbNet * net = nets[i];
+
+            if ( rand() % 5 == 0 )
+                continue;
+
+            int global;
+
+            for( global = 0; global < 2; ++global )
+            {
+                if ( global && (rand() % 2) )
+                    continue;
+
+                dbWire * wire = dbWire::create(net, global);
+                dbWireEncoder encoder;
+                encoder.begin(wire);
+                encoder.newPath(m1, dbWireType::ROUTED);
+                int x = rand() % 9000;
+                int y = rand() % 9000;
+                encoder.addPoint(x, y);
+
+                if ( i > 0 )
+                    encoder.addITerm( insts[i-1]->findITerm("Y") );
+                else
+                    encoder.addBTerm( *net->getBTerms().begin() );
+
+                int j = encoder.addPoint(x + 100, y);
+                encoder.addVia(via);
+                encoder.newPath(m2, dbWireType::ROUTED);
+                encoder.addPoint(x + 100, y);
+                encoder.addPoint(x + 100, y + 300);
+
+                if ( i < num_insts )
+                    encoder.addITerm( insts[i]->findITerm("A") );
+                else
+                    encoder.addBTerm( *net->getBTerms().begin() );
+
+                encoder.newPath(j, dbWireType::ROUTED);
+                encoder.addPoint(x + 100, y - 200);
+                encoder.end();
+            }
+        }
+
+        dbNet * vdd = dbNet::create(child, "VDD");
+        vdd->setSigType(dbSigType::POWER);
+        dbSWire * swire = dbSWire::create(vdd, dbWireType::ROUTED);
+        dbSBox::create(swire, m1, 0, 0, 10000, 100, dbWireShapeType::STRIPE);
+        dbSBox::create(swire, via, 500, 50, dbWireShapeType::STRIPE);
+
+        dbSWire * shield = dbSWire::create(nets[1], dbWireType::SHIELD);
+        dbSBox::create(shield, m2, 0, 0, 100, 10000, dbWireShapeType::NONE);
+
+        dbInst * inst = dbInst::create(top, hier, name);
+        inst->setLocation(k * 11000, 0);
+        inst->setOrient( dbOrientType((dbOrientType::Value) (k % 8)) );
+        inst->setPlacementStatus(dbPlacementStatus::PLACED);
+        dbITerm::connect( inst->findITerm("I"), top_nets[k] );
+        dbITerm::connect( inst->findITerm("O"), top_nets[k+1] );
+        inst->bindBlock(child);
+    }
+
+    return top;
+}
+
+static bool sameProperties( dbObject * o1, dbObject * o2 )
+{
+    dbSet<dbProperty> p1 = dbProperty::getProperties(o1);
+    dbSet<dbProperty> p2 = dbProperty::getProperties(o2);
+
+    if ( p1.size() != p2.size() )
+        return false;
+
+    dbSet<dbProperty>::iterator i1 = p1.begin();
+    dbSet<dbProperty>::iterator i2 = p2.begin();
+
+    for( ; i1 != p1.end(); ++i1, ++i2 )
+    {
+        if ( (i1->getName() != i2->getName()) || (i1->getType() != i2->getType()) )
+            return false;
+
+        if ( (i1->getType() == dbProperty::INT_PROP)
+             && (((dbIntProperty *) *i1)->getValue() != ((dbIntProperty *) *i2)->getValue()) )
+            return false;
+
+        if ( ! sameProperties(*i1, *i2) )
+            return false;
+    }
+
+    return true;
+}
+
+static bool sameBlock( dbBlock * b1, dbBlock * b2 )
+{
+    if ( dbBlock::differences(b1, b2, stdout) )
+        return false;
+
+    dbSet<dbNet> nets = b1->getNets();
+    dbSet<dbNet>::iterator nitr;
+
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+    {
+        dbNet * n1 = *nitr;
+        dbNet * n2 = b2->findNet( n1->getConstName() );
+
+        if ( n2 == NULL )
+            return false;
+
+        if ( ! sameWire( n1->getWire(), n2->getWire() ) )
+            return false;
+
+        if ( ! sameWire( n1->getGlobalWire(), n2->getGlobalWire() ) )
+            return false;
+
+        if ( n1->getSWires().size() != n2->getSWires().size() )
+            return false;
+    }
+
+    return sameProperties(b1, b2);
+}
+
+int main( int argc, char ** argv )
+{
+    const int num_children = 3;
+    const int num_insts = 1300;
+    int bterm_map;
+
+    for( bterm_map = 0; bterm_map < 2; ++bterm_map )
+    {
+        dbDatabase * serial_db = dbDatabase::create();
+        dbBlock * serial = buildDesign(serial_db, num_children, num_insts);
+        dbFlatten flatten;
+        flatten.setCreateBTermMap(bterm_map);
+        flatten.setThreads(1);
+        check("serial flatten", flatten.flatten(serial, 1));
+        check("children flattened",
+              serial->findInst("c0/u0") != NULL
+              && serial->getInsts().size() == (uint) (num_children * num_insts));
+
+        if ( bterm_map )
+            check("bterm map created", dbProperty::find(serial, "_ADS_BTERM_MAP") != NULL);
+
+        uint threads[2] = { 2, 4 };
+        int t;
+
+        for( t = 0; t < 2; ++t )
+        {
+            dbDatabase * db = dbDatabase::create();
+            dbBlock * block = buildDesign(db, num_children, num_insts);
+            dbFlatten parallel;
+            parallel.setCreateBTermMap(bterm_map);
+            parallel.setThreads( threads[t] );
+            check("parallel flatten", parallel.flatten(block, 1));
+            check("parallel flatten matches serial flatten", sameBlock(serial, block));
+            dbDatabase::destroy(db);
+        }
+
+        dbDatabase::destroy(serial_db);
+    }
+
+    return exit_summary();
+}
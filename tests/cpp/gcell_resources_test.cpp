@@ -0,0 +1,260 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// dbGCellResources: removing the usage of a wire restores the counters
+// exactly, counters above 16 bits are kept, and the resources are written,
+// read back (schema ADS_DB_GCELL_RESOURCES) and reported by the db diff.
+//
+#include "db.h"
+#include "dbWireCodec.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+// All the counters of the grid, layer by layer.
+static void getCounters( dbGCellGrid * grid, std::vector<dbTechLayer *> & layers,
+                         std::vector<uint> & counters )
+{
+    counters.clear();
+    uint i;
+
+    for( i = 0; i < layers.size(); ++i )
+    {
+        int col, row;
+
+        for( row = 0; row < grid->getNumRows(); ++row )
+            for( col = 0; col < grid->getNumCols(); ++col )
+            {
+                counters.push_back( grid->getCapacity( layers[i], col, row ) );
+                counters.push_back( grid->getUsage( layers[i], col, row ) );
+                counters.push_back( grid->getBlockage( layers[i], col, row ) );
+            }
+    }
+}
+
+static void addRandomWire( dbNet * net, std::vector<dbTechLayer *> & layers )
+{
+    dbWire * wire = dbWire::create(net);
+    dbWireEncoder encoder;
+    encoder.begin(wire);
+
+    int i;
+
+    for( i = 0; i < 4; ++i )
+    {
+        uint level = rand() % layers.size();
+        dbTechLayer * layer = layers[level];
+        int x = rand() % 19000 + 500;
+        int y = rand() % 19000 + 500;
+        int len = rand() % 8000;
+
+        encoder.newPath( layer, dbWireType::ROUTED );
+        encoder.addPoint( x, y );
+
+        if ( layer->getDirection() == dbTechLayerDir::HORIZONTAL )
+            encoder.addPoint( std::min( x + len, 19900 ), y );
+        else
+            encoder.addPoint( x, std::min( y + len, 19900 ) );
+    }
+
+    encoder.end();
+}
+
+int main( int argc, char ** argv )
+{
+    srand(36);
+
+    dbDatabase * db = dbDatabase::create();
+    dbTech * tech = dbTech::create(db);
+    std::vector<dbTechLayer *> layers;
+    int i;
+
+    for( i = 1; i <= 3; ++i )
+    {
+        char name[8];
+        sprintf(name, "M%d", i);
+        dbTechLayer * layer = dbTechLayer::create(tech, name, dbTechLayerType::ROUTING);
+        layer->setWidth(100);
+        layer->setPitch(200);
+        layer->setDirection( i % 2 ? dbTechLayerDir::HORIZONTAL : dbTechLayerDir::VERTICAL );
+        layers.push_back(layer);
+    }
+
+    dbChip * chip = dbChip::create(db);
+    dbBlock * block = dbBlock::create(chip, "top");
+    block->setDieArea( adsRect(0, 0, 20000, 20000) );
+
+    for( i = 0; i < 3; ++i )
+    {
+        dbTrackGrid * tracks = dbTrackGrid::create(block, layers[i]);
+
+        if ( layers[i]->getDirection() == dbTechLayerDir::HORIZONTAL )
+            tracks->addGridPatternY( 100, 100, 200 );
+        else
+            tracks->addGridPatternX( 100, 100, 200 );
+    }
+
+    dbGCellGrid * grid = dbGCellGrid::create(block);
+    grid->addGridPatternX( 0, 21, 1000 );
+    grid->addGridPatternY( 0, 21, 1000 );
+
+    std::vector<dbNet *> nets;
+
+    for( i = 0; i < 40; ++i )
+    {
+        char name[16];
+        sprintf(name, "n%d", i);
+        dbNet * net = dbNet::create(block, name);
+        addRandomWire( net, layers );
+        nets.push_back(net);
+    }
+
+    grid->computeResources(1);
+    check("resources computed", grid->hasResources());
+
+    std::vector<uint> counters;
+    getCounters( grid, layers, counters );
+
+    uint total_usage = 0;
+    uint k;
+
+    for( k = 1; k < counters.size(); k += 3 )
+        total_usage += counters[k];
+
+    check("wires have usage", total_usage > 0);
+
+    // Add/remove symmetry for every wire, in both orders.
+    int errors = 0;
+
+    for( i = 0; i < (int) nets.size(); ++i )
+    {
+        std::vector<uint> after;
+        grid->addWireUsage( nets[i]->getWire() );
+        grid->addWireUsage( nets[i]->getWire() );
+        grid->addWireUsage( nets[i]->getWire(), true );
+        grid->addWireUsage( nets[i]->getWire(), true );
+        getCounters( grid, layers, after );
+        errors += after != counters;
+
+        grid->addWireUsage( nets[i]->getWire(), true );
+        grid->addWireUsage( nets[i]->getWire() );
+        getCounters( grid, layers, after );
+        errors += after != counters;
+    }
+
+    check("add then remove restores the usage", errors == 0);
+
+    // Rerouting a net: remove the old wire, route, add the new one.
+    dbNet * net = nets[0];
+    grid->addWireUsage( net->getWire(), true );
+    dbWire::destroy( net->getWire() );
+    addRandomWire( net, layers );
+    grid->addWireUsage( net->getWire() );
+
+    std::vector<uint> rerouted;
+    getCounters( grid, layers, rerouted );
+    grid->computeResources(1);
+    getCounters( grid, layers, counters );
+    check("incremental reroute matches a full compute", rerouted == counters);
+
+    // Counters above 16 bits.
+    grid->setUsage( layers[1], 3, 4, 70000 );
+    check("set above 16 bits", grid->getUsage( layers[1], 3, 4 ) == 70000);
+    grid->addUsage( layers[1], 3, 4, 100000 );
+    check("add above 16 bits", grid->getUsage( layers[1], 3, 4 ) == 170000);
+    grid->addUsage( layers[1], 3, 4, -100000 );
+    check("remove above 16 bits", grid->getUsage( layers[1], 3, 4 ) == 70000);
+    grid->addUsage( layers[1], 3, 4, -80000 );
+    check("usage is clamped to zero", grid->getUsage( layers[1], 3, 4 ) == 0);
+    grid->setCapacity( layers[2], 19, 19, 1 << 20 );
+    grid->setBlockage( layers[0], 0, 19, 65536 );
+    getCounters( grid, layers, counters );
+
+    // Write and read back.
+    std::string file = "gcell_resources_test.db";
+    FILE * fp = fopen(file.c_str(), "w");
+    db->write(fp);
+    fclose(fp);
+
+    dbDatabase * rdb = dbDatabase::create();
+    fp = fopen(file.c_str(), "r");
+    rdb->read(fp);
+    fclose(fp);
+    remove(file.c_str());
+
+    dbGCellGrid * rgrid = rdb->getChip()->getBlock()->getGCellGrid();
+    std::vector<dbTechLayer *> rlayers;
+
+    for( i = 0; i < 3; ++i )
+        rlayers.push_back( rdb->getTech()->findLayer( layers[i]->getConstName() ) );
+
+    std::vector<uint> read_counters;
+    check("read resources", rgrid->hasResources());
+    getCounters( rgrid, rlayers, read_counters );
+    check("read counters match", read_counters == counters);
+    check("read capacity above 16 bits", rgrid->getCapacity( rlayers[2], 19, 19 ) == (1 << 20));
+
+    // The diff reports the resources.
+    FILE * out = tmpfile();
+    check("no differences after a read", ! dbDatabase::diff( db, rdb, out, 2 ));
+    fclose(out);
+
+    rgrid->addUsage( rlayers[0], 5, 6, 3 );
+    out = tmpfile();
+    check("usage difference", dbDatabase::diff( db, rdb, out, 2 ));
+    rewind(out);
+
+    char line[256];
+    bool reported = false;
+
+    while( fgets( line, sizeof(line), out ) )
+        if ( strstr( line, "usage[1][5,6]" ) )
+            reported = true;
+
+    fclose(out);
+    check("usage difference reports the gcell", reported);
+
+    rgrid->clearResources();
+    out = tmpfile();
+    check("missing resources difference", dbDatabase::diff( db, rdb, out, 2 ));
+    fclose(out);
+
+    dbDatabase::destroy(rdb);
+    dbDatabase::destroy(db);
+    return exit_summary();
+}
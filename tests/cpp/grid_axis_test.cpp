@@ -0,0 +1,266 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// The track and gcell grid queries return the coordinates of the baseline
+// getGridX/getGridY walk (every pattern expanded, sorted, duplicates removed)
+// after every pattern edit, through reads and duplicates, and concurrently.
+//
+#include "db.h"
+#include "dbParallel.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+struct Patterns
+{
+    std::vector<int> _origin;
+    std::vector<int> _count;
+    std::vector<int> _step;
+};
+
+// Reference: the baseline walk.
+static void walkGrid( const Patterns & p, std::vector<int> & grid )
+{
+    grid.clear();
+    uint i;
+
+    for( i = 0; i < p._origin.size(); ++i )
+    {
+        int j;
+        int x = p._origin[i];
+
+        for ( j = 0; j < p._count[i]; ++j )
+        {
+            grid.push_back( x );
+            x += p._step[i];
+        }
+    }
+
+    std::sort( grid.begin(), grid.end() );
+    grid.erase( std::unique( grid.begin(), grid.end() ), grid.end() );
+}
+
+static void randomPattern( Patterns & p )
+{
+    p._origin.push_back( rand() % 2000 - 1000 );
+    p._count.push_back( rand() % 22 - 1 );
+    p._step.push_back( rand() % 101 - 50 );
+}
+
+// Index of the last coordinate <= x, -1 if there is none.
+static int walkIndex( const std::vector<int> & grid, int x )
+{
+    return (int) (std::upper_bound( grid.begin(), grid.end(), x ) - grid.begin()) - 1;
+}
+
+static int walkNearest( const std::vector<int> & grid, int x )
+{
+    if ( grid.empty() )
+        return -1;
+
+    int idx = walkIndex( grid, x );
+
+    if ( idx < 0 )
+        return 0;
+
+    if ( idx + 1 < (int) grid.size() && (grid[idx + 1] - x) < (x - grid[idx]) )
+        return idx + 1;
+
+    return idx;
+}
+
+// Number of mismatches between the queries of one axis and the walk.
+template <class GRID>
+static int compareX( GRID * grid, const Patterns & p )
+{
+    std::vector<int> ref;
+    walkGrid( p, ref );
+
+    std::vector<int> coords;
+    grid->getGridX( coords );
+
+    int errors = coords != ref;
+
+    if ( grid->getGridCountX() != (int) ref.size() )
+        return errors + 1;
+
+    int i;
+
+    for( i = 0; i < (int) ref.size(); ++i )
+        errors += grid->getGridCoordX(i) != ref[i];
+
+    for( i = -1100; i <= 1100; i += 7 )
+    {
+        errors += grid->findGridIndexX(i) != walkIndex( ref, i );
+        errors += grid->findNearestGridX(i) != walkNearest( ref, i );
+
+        int first, end;
+        grid->findGridRangeX( i, i + 60, first, end );
+        errors += first != walkIndex( ref, i - 1 ) + 1;
+        errors += end != walkIndex( ref, i + 59 ) + 1;
+    }
+
+    return errors;
+}
+
+template <class GRID>
+static int compareY( GRID * grid, const Patterns & p )
+{
+    std::vector<int> ref;
+    walkGrid( p, ref );
+
+    std::vector<int> coords;
+    grid->getGridY( coords );
+
+    int errors = coords != ref;
+
+    if ( grid->getGridCountY() != (int) ref.size() )
+        return errors + 1;
+
+    int i;
+
+    for( i = 0; i < (int) ref.size(); ++i )
+        errors += grid->getGridCoordY(i) != ref[i];
+
+    for( i = -1100; i <= 1100; i += 7 )
+        errors += grid->findGridIndexY(i) != walkIndex( ref, i );
+
+    return errors;
+}
+
+int main( int argc, char ** argv )
+{
+    srand(35);
+
+    dbDatabase * db = dbDatabase::create();
+    dbTech * tech = dbTech::create(db);
+    dbTechLayer * layer = dbTechLayer::create(tech, "M1", dbTechLayerType::ROUTING);
+    dbChip * chip = dbChip::create(db);
+    dbBlock * block = dbBlock::create(chip, "top");
+    dbGCellGrid * gcell = dbGCellGrid::create(block);
+    dbTrackGrid * track = dbTrackGrid::create(block, layer);
+
+    Patterns gx, gy, tx, ty;
+    check("empty gcell grid", compareX(gcell, gx) == 0 && compareY(gcell, gy) == 0);
+    check("empty track grid", compareX(track, tx) == 0 && compareY(track, ty) == 0);
+
+    // Each edit is followed by queries, so a stale axis shows up.
+    int gcell_errors = 0;
+    int track_errors = 0;
+    int i;
+
+    for( i = 0; i < 12; ++i )
+    {
+        randomPattern(gx);
+        gcell->addGridPatternX( gx._origin.back(), gx._count.back(), gx._step.back() );
+        gcell_errors += compareX(gcell, gx);
+
+        randomPattern(gy);
+        gcell->addGridPatternY( gy._origin.back(), gy._count.back(), gy._step.back() );
+        gcell_errors += compareY(gcell, gy);
+
+        randomPattern(tx);
+        track->addGridPatternX( tx._origin.back(), tx._count.back(), tx._step.back() );
+        track_errors += compareX(track, tx);
+
+        randomPattern(ty);
+        track->addGridPatternY( ty._origin.back(), ty._count.back(), ty._step.back() );
+        track_errors += compareY(track, ty);
+    }
+
+    check("gcell grid matches the walk after each edit", gcell_errors == 0);
+    check("track grid matches the walk after each edit", track_errors == 0);
+
+    // Disjoint patterns (no merged list).
+    dbGCellGrid * disjoint = dbGCellGrid::create(dbBlock::create(chip->getBlock(), "child"));
+    Patterns dx;
+
+    for( i = 0; i < 5; ++i )
+    {
+        dx._origin.push_back( -1000 + i * 400 );
+        dx._count.push_back( 10 );
+        dx._step.push_back( i % 2 ? 30 : -30 );
+        disjoint->addGridPatternX( dx._origin.back(), dx._count.back(), dx._step.back() );
+    }
+
+    check("disjoint patterns match the walk", compareX(disjoint, dx) == 0);
+
+    // Duplicated and read databases have their axes.
+    dbDatabase * dup = dbDatabase::duplicate(db);
+    dbBlock * dup_block = dup->getChip()->getBlock();
+    check("duplicated gcell grid",
+          compareX(dup_block->getGCellGrid(), gx) == 0 && compareY(dup_block->getGCellGrid(), gy) == 0);
+    dbTrackGrid * dup_track = dup_block->findTrackGrid(dup->getTech()->findLayer("M1"));
+    check("duplicated track grid", compareX(dup_track, tx) == 0 && compareY(dup_track, ty) == 0);
+    dbDatabase::destroy(dup);
+
+    std::string file = "grid_axis_test.db";
+    FILE * fp = fopen(file.c_str(), "w");
+    db->write(fp);
+    fclose(fp);
+
+    dbDatabase * rdb = dbDatabase::create();
+    fp = fopen(file.c_str(), "r");
+    rdb->read(fp);
+    fclose(fp);
+    remove(file.c_str());
+    dbBlock * rblock = rdb->getChip()->getBlock();
+    check("read gcell grid",
+          compareX(rblock->getGCellGrid(), gx) == 0 && compareY(rblock->getGCellGrid(), gy) == 0);
+    dbTrackGrid * rtrack = rblock->findTrackGrid(rdb->getTech()->findLayer("M1"));
+    check("read track grid", compareX(rtrack, tx) == 0 && compareY(rtrack, ty) == 0);
+    dbDatabase::destroy(rdb);
+
+    // Concurrent queries.
+    std::vector<int> errors(64, 0);
+    dbParallelFor(errors.size(), 8, [&](int n) {
+        if ( n % 2 )
+            errors[n] = compareX(gcell, gx) + compareY(gcell, gy);
+        else
+            errors[n] = compareX(track, tx) + compareY(track, ty);
+    });
+
+    int parallel_errors = 0;
+
+    for( i = 0; i < (int) errors.size(); ++i )
+        parallel_errors += errors[i];
+
+    check("concurrent queries match the walk", parallel_errors == 0);
+
+    dbDatabase::destroy(db);
+    return exit_summary();
+}
@@ -0,0 +1,242 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// dbInst::setLocations moves the instances like setOrient and setLocation
+// one at a time: same origins, orientations, bboxes, block bbox and eco
+// journal, and it rejects invalid or repeated ids without changing anything.
+//
+#include "db.h"
+#include "dbBlockCallBackObj.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+class MoveCounter : public dbBlockCallBackObj
+{
+  public:
+    int _single;
+    int _batch;
+
+    MoveCounter() : _single(0), _batch(0) {}
+
+    void inDbMoveInst( dbInst * ) { ++_single; }
+
+    void inDbMoveInsts( const std::vector<dbInst *> & insts )
+    {
+        ++_batch;
+        dbBlockCallBackObj::inDbMoveInsts(insts);
+    }
+};
+
+// Number of instances that differ between the two blocks.
+static int compareBlocks( dbBlock * a, dbBlock * b, const std::vector<uint> & ids )
+{
+    int errors = 0;
+    uint i;
+
+    for( i = 0; i < ids.size(); ++i )
+    {
+        dbInst * ia = dbInst::getInst( a, ids[i] );
+        dbInst * ib = dbInst::getInst( b, ids[i] );
+        int xa, ya, xb, yb;
+        ia->getOrigin( xa, ya );
+        ib->getOrigin( xb, yb );
+        adsRect ra, rb;
+        ia->getBBox()->getBox( ra );
+        ib->getBBox()->getBox( rb );
+        errors += (xa != xb) || (ya != yb) || (ra != rb) || (ia->getOrient() != ib->getOrient());
+    }
+
+    adsRect ra, rb;
+    a->getBBox()->getBox( ra );
+    b->getBBox()->getBox( rb );
+    errors += ra != rb;
+    return errors;
+}
+
+static std::string ecoBytes( dbBlock * block )
+{
+    FILE * fp = tmpfile();
+    dbDatabase::writeEco( block, fp );
+    rewind(fp);
+
+    std::string bytes;
+    int c;
+
+    while( (c = fgetc(fp)) != EOF )
+        bytes += (char) c;
+
+    fclose(fp);
+    return bytes;
+}
+
+int main( int argc, char ** argv )
+{
+    srand(38);
+
+    dbDatabase * db = dbDatabase::create();
+    dbTech::create(db);
+    dbLib * lib = dbLib::create(db, "lib");
+    std::vector<dbMaster *> masters;
+    int i;
+
+    // Masters with an origin, so the orientation moves the bbox.
+    for( i = 1; i <= 3; ++i )
+    {
+        char name[8];
+        sprintf(name, "M%d", i);
+        dbMaster * master = dbMaster::create(lib, name);
+        master->setWidth( 10 * i );
+        master->setHeight( 100 + i );
+        master->setOrigin( 3 * i, -i );
+        master->setFrozen();
+        masters.push_back(master);
+    }
+
+    dbChip * chip = dbChip::create(db);
+    dbBlock * a = dbBlock::create(chip, "a");
+    dbBlock * b = dbBlock::create(a, "b");
+
+    const int N = 5000;
+    std::vector<uint> ids;
+    std::vector<int> xs, ys;
+    std::vector<dbOrientType::Value> orients;
+    int id_errors = 0;
+
+    for( i = 0; i < N; ++i )
+    {
+        char name[16];
+        sprintf(name, "i%d", i);
+        dbMaster * master = masters[rand() % masters.size()];
+        dbInst * ia = dbInst::create(a, master, name);
+        dbInst * ib = dbInst::create(b, master, name);
+        id_errors += ia->getId() != ib->getId();
+        ids.push_back( ia->getId() );
+        xs.push_back( rand() % 100000 - 500 );
+        ys.push_back( rand() % 100000 );
+        orients.push_back( (dbOrientType::Value) (rand() % 8) );
+    }
+
+    check("same ids in both blocks", id_errors == 0);
+
+    // Keep the block bboxes valid so the incremental update is exercised.
+    adsRect r;
+    a->getBBox()->getBox(r);
+    b->getBBox()->getBox(r);
+
+    MoveCounter counter;
+    counter.addOwner(b);
+
+    dbDatabase::beginEco(a);
+    dbDatabase::beginEco(b);
+
+    for( i = 0; i < N; ++i )
+    {
+        dbInst * inst = dbInst::getInst( a, ids[i] );
+        inst->setOrient( orients[i] );
+        inst->setLocation( xs[i], ys[i] );
+    }
+
+    check("batch move", dbInst::setLocations( b, N, &ids[0], &xs[0], &ys[0], &orients[0], 4 ));
+    check("one batch callback", (counter._batch == 1) && (counter._single == N));
+    check("batch matches single moves", compareBlocks( a, b, ids ) == 0);
+
+    int errors = 0;
+
+    for( i = 0; i < N; ++i )
+    {
+        int x, y;
+        dbInst::getInst( b, ids[i] )->getLocation( x, y );
+        errors += (x != xs[i]) || (y != ys[i]);
+    }
+
+    check("locations", errors == 0);
+
+    dbDatabase::endEco(a);
+    dbDatabase::endEco(b);
+    check("same eco journal", ecoBytes(a) == ecoBytes(b));
+
+    // Without orientations.
+    for( i = 0; i < N; ++i )
+    {
+        xs[i] += 7;
+        dbInst::getInst( a, ids[i] )->setLocation( xs[i], ys[i] );
+    }
+
+    check("batch move without orients", dbInst::setLocations( b, N, &ids[0], &xs[0], &ys[0] ));
+    check("without orients matches single moves", compareBlocks( a, b, ids ) == 0);
+
+    // Invalid and repeated ids change nothing.
+    std::vector<uint> bad_ids( ids.begin(), ids.begin() + 10 );
+    std::vector<int> zeros( 10, 0 );
+    bad_ids[5] = 0;
+    check("id 0 rejected", ! dbInst::setLocations( b, 10, &bad_ids[0], &zeros[0], &zeros[0] ));
+    bad_ids[5] = ids.back() + 100;
+    check("unallocated id rejected", ! dbInst::setLocations( b, 10, &bad_ids[0], &zeros[0], &zeros[0] ));
+
+    dbInst::destroy( dbInst::getInst( b, ids[7] ) );
+    dbInst::destroy( dbInst::getInst( a, ids[7] ) );
+    bad_ids[5] = ids[7];
+    check("destroyed id rejected", ! dbInst::setLocations( b, 10, &bad_ids[0], &zeros[0], &zeros[0] ));
+    bad_ids[5] = bad_ids[2];
+    check("repeated id rejected", ! dbInst::setLocations( b, 10, &bad_ids[0], &zeros[0], &zeros[0] ));
+
+    ids.erase( ids.begin() + 7 );
+    check("rejected batches change nothing", compareBlocks( a, b, ids ) == 0);
+    check("empty batch", dbInst::setLocations( b, 0, NULL, NULL, NULL ));
+
+    // A snapshot records the orientations, the revert restores them.
+    std::vector<dbOrientType::Value> new_orients( ids.size() );
+    std::vector<int> new_x( ids.size() ), new_y( ids.size() );
+
+    for( i = 0; i < (int) ids.size(); ++i )
+    {
+        new_orients[i] = (dbOrientType::Value) (rand() % 8);
+        new_x[i] = rand() % 1000;
+        new_y[i] = rand() % 1000;
+    }
+
+    check("begin snapshot", dbDatabase::beginSnapshot(b));
+    check("batch move in a snapshot",
+          dbInst::setLocations( b, ids.size(), &ids[0], &new_x[0], &new_y[0], &new_orients[0] ));
+    check("revert snapshot", dbDatabase::revertSnapshot(b));
+    dbDatabase::endSnapshot(b);
+    check("revert restores the orientations and locations", compareBlocks( a, b, ids ) == 0);
+
+    counter.removeOwner();
+    dbDatabase::destroy(db);
+    return exit_summary();
+}
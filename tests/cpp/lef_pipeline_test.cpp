@@ -0,0 +1,163 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// Pipelined macro creation (lefin::pipelineMacros) builds the same database
+// as the serial LEF reader, for every read that creates or updates a library.
+//
+#include "db.h"
+#include "lefin.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <list>
+#include <string>
+
+using namespace odb;
+
+// The written database, byte for byte.
+static std::string dbBytes( dbDatabase * db )
+{
+    FILE * fp = tmpfile();
+    db->write(fp);
+    fflush(fp);
+
+    std::string bytes;
+    char buf[8192];
+    size_t n;
+    rewind(fp);
+
+    while( (n = fread(buf, 1, sizeof(buf), fp)) > 0 )
+        bytes.append(buf, n);
+
+    fclose(fp);
+    return bytes;
+}
+
+enum ReadMode { TECH_AND_LIB, TECH_AND_LIB_LIST, CREATE_LIB, UPDATE_LIB };
+
+static dbDatabase * readLef( ReadMode mode, const std::string & tech_lef,
+                             const std::string & lib_lef, bool pipeline,
+                             int & masters )
+{
+    dbDatabase * db = dbDatabase::create();
+    dbLib * lib = NULL;
+
+    switch( mode )
+    {
+        case TECH_AND_LIB:
+        {
+            lefin reader(db, false);
+
+            if ( pipeline )
+                reader.pipelineMacros();
+
+            lib = reader.createTechAndLib("lib", lib_lef.c_str());
+            break;
+        }
+
+        case TECH_AND_LIB_LIST:
+        {
+            lefin reader(db, false);
+
+            if ( pipeline )
+                reader.pipelineMacros();
+
+            std::list<std::string> files;
+            files.push_back(tech_lef);
+            files.push_back(lib_lef);
+            lib = reader.createTechAndLib("lib", files);
+            break;
+        }
+
+        case CREATE_LIB:
+        {
+            lefin tech_reader(db, false);
+            tech_reader.createTech(tech_lef.c_str());
+
+            lefin reader(db, false);
+
+            if ( pipeline )
+                reader.pipelineMacros();
+
+            lib = reader.createLib("lib", lib_lef.c_str());
+            break;
+        }
+
+        case UPDATE_LIB:
+        {
+            lefin tech_reader(db, false);
+            tech_reader.createTech(tech_lef.c_str());
+            lib = dbLib::create(db, "lib");
+
+            lefin reader(db, false);
+
+            if ( pipeline )
+                reader.pipelineMacros();
+
+            if ( ! reader.updateLib(lib, lib_lef.c_str()) )
+                lib = NULL;
+            break;
+        }
+    }
+
+    masters = lib ? lib->getMasters().size() : -1;
+    return db;
+}
+
+static void compareReads( ReadMode mode, const std::string & tech_lef,
+                          const std::string & lib_lef )
+{
+    int serial_masters, pipeline_masters;
+    dbDatabase * serial = readLef(mode, tech_lef, lib_lef, false, serial_masters);
+    dbDatabase * pipeline = readLef(mode, tech_lef, lib_lef, true, pipeline_masters);
+
+    check("serial read creates masters", serial_masters > 0);
+    check("pipelined read creates the same masters", pipeline_masters == serial_masters);
+    check("pipelined read writes the same database", dbBytes(serial) == dbBytes(pipeline));
+
+    dbDatabase::destroy(serial);
+    dbDatabase::destroy(pipeline);
+}
+
+int main( int argc, char ** argv )
+{
+    std::string nangate = data_file(argc, argv, "Nangate45/NangateOpenCellLibrary.mod.lef");
+    std::string gscl = data_file(argc, argv, "gscl45nm.lef");
+
+    compareReads(TECH_AND_LIB, nangate, nangate);
+    compareReads(TECH_AND_LIB, gscl, gscl);
+    compareReads(TECH_AND_LIB_LIST, nangate, nangate);
+    compareReads(CREATE_LIB, nangate, nangate);
+    compareReads(CREATE_LIB, gscl, gscl);
+    compareReads(UPDATE_LIB, nangate, nangate);
+
+    return exit_summary();
+}
@@ -0,0 +1,266 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// The wavefront levelizer gives every instance of gcd the level of the
+// breadth-first dbBlock::levelize/dbNet::setLevelAtFanout walk it replaced,
+// from the primary inputs and from the sequential instances, on one and
+// several threads, with a combinational loop and a chain deeper than the
+// 255 level limit added to the design.
+//
+#include "db.h"
+#include "defin.h"
+#include "lefin.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+using namespace odb;
+
+// Reference: the levelizeFromPrimaryInputs of the previous release.
+static void oldLevelizeFromPrimaryInputs( dbBlock * block )
+{
+    dbSet<dbBTerm> bterms = block->getBTerms();
+    dbSet<dbBTerm>::iterator bitr;
+    std::vector<dbInst *> instsToBeLeveled;
+
+    for( bitr = bterms.begin(); bitr != bterms.end(); ++bitr )
+    {
+        dbNet * net = bitr->getNet();
+
+        if ( net == NULL )
+            continue;
+
+        if ( (net->getSigType() == dbSigType::GROUND) || (net->getSigType() == dbSigType::POWER) )
+            continue;
+
+        net->setLevelAtFanout(1, true, instsToBeLeveled);
+    }
+
+    while ( instsToBeLeveled.size() > 0 )
+    {
+        std::vector<dbInst *> startingInsts = instsToBeLeveled;
+        instsToBeLeveled.clear();
+        block->levelize(startingInsts, instsToBeLeveled);
+    }
+}
+
+// Reference: the levelizeFromSequential of the previous release.
+static void oldLevelizeFromSequential( dbBlock * block )
+{
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator iitr;
+    std::vector<dbInst *> instsToBeLeveled;
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+    {
+        if ( ! iitr->getMaster()->isSequential() )
+            continue;
+
+        iitr->setLevel(1, false);
+        instsToBeLeveled.push_back(*iitr);
+    }
+
+    while ( instsToBeLeveled.size() > 0 )
+    {
+        std::vector<dbInst *> startingInsts = instsToBeLeveled;
+        instsToBeLeveled.clear();
+        block->levelize(startingInsts, instsToBeLeveled);
+    }
+}
+
+static void clearLevels( dbBlock * block )
+{
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator iitr;
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+        iitr->setLevel(0, false);
+}
+
+static std::vector<int> levels( dbBlock * block )
+{
+    std::vector<int> result;
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator iitr;
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+        result.push_back( iitr->getLevel() );
+
+    return result;
+}
+
+static uint leveled( const std::vector<int> & l )
+{
+    return l.size() - std::count( l.begin(), l.end(), 0 );
+}
+
+enum Mode
+{
+    FROM_PI,
+    FROM_SEQUENTIAL,
+    SEQUENTIAL_THEN_PI
+};
+
+static void compareLevels( dbBlock * block, const char * what )
+{
+    int mismatches = 0;
+    int bad_counts = 0;
+    int leveled_insts = 0;
+    int mode;
+
+    for( mode = FROM_PI; mode <= SEQUENTIAL_THEN_PI; ++mode )
+    {
+        clearLevels(block);
+
+        if ( mode != FROM_PI )
+            oldLevelizeFromSequential(block);
+
+        if ( mode != FROM_SEQUENTIAL )
+            oldLevelizeFromPrimaryInputs(block);
+
+        std::vector<int> expected = levels(block);
+        leveled_insts += leveled(expected);
+
+        uint threads[3] = { 1, 2, 4 };
+        int t;
+
+        for( t = 0; t < 3; ++t )
+        {
+            clearLevels(block);
+            uint cnt = 0;
+
+            if ( mode != FROM_PI )
+                cnt = block->levelizeFromSequential( threads[t] );
+
+            if ( mode == FROM_PI )
+                cnt = block->levelizeFromPrimaryInputs( threads[t] );
+            else if ( mode == SEQUENTIAL_THEN_PI )
+                block->levelizeFromPrimaryInputs( threads[t] );
+
+            std::vector<int> result = levels(block);
+
+            if ( result != expected )
+                ++mismatches;
+
+            // The count is the number of instances given a level; from the
+            // sequential instances it includes the sequential instances.
+            if ( (mode != SEQUENTIAL_THEN_PI) && (cnt != leveled(result)) )
+                ++bad_counts;
+        }
+    }
+
+    check(what, mismatches == 0);
+    check("levelize returns the number of leveled instances", bad_counts == 0);
+    check("the design is leveled", leveled_insts > 0);
+}
+
+static dbITerm * iterm( dbInst * inst, const char * name )
+{
+    return inst->findITerm(name);
+}
+
+int main( int argc, char ** argv )
+{
+    dbDatabase * db = dbDatabase::create();
+    lefin lef_reader(db, false);
+    std::string lef = data_file(argc, argv, "Nangate45/NangateOpenCellLibrary.mod.lef");
+    dbLib * lib = lef_reader.createTechAndLib("lib", lef.c_str());
+    check("read lef", lib != NULL);
+
+    if ( lib == NULL )
+        return exit_summary();
+
+    std::vector<dbLib *> libs;
+    libs.push_back(lib);
+    defin def_reader(db);
+    std::string def = data_file(argc, argv, "gcd/floorplan.def");
+    dbChip * chip = def_reader.createChip(libs, def.c_str());
+    check("read def", chip != NULL);
+
+    if ( chip == NULL )
+        return exit_summary();
+
+    dbBlock * block = chip->getBlock();
+    compareLevels(block, "gcd levels match the walk");
+
+    std::vector<dbInst *> loops;
+    uint gcd_loops = block->findCombinationalLoops(loops, 2);
+
+    // A loop entered from a primary input: a = NAND2(in, b), b = INV(a),
+    // and an inverter hanging off the loop.
+    dbBTerm * in = block->findBTerm("req_msg[0]");
+    dbMaster * nand2 = lib->findMaster("NAND2_X1");
+    dbMaster * inv = lib->findMaster("INV_X1");
+    dbNet * na = dbNet::create(block, "loop_a");
+    dbNet * nb = dbNet::create(block, "loop_b");
+    dbNet * nc = dbNet::create(block, "loop_c");
+    dbInst * a = dbInst::create(block, nand2, "loop_nand");
+    dbInst * b = dbInst::create(block, inv, "loop_inv");
+    dbInst * c = dbInst::create(block, inv, "loop_out");
+    dbITerm::connect( iterm(a, "A1"), in->getNet() );
+    dbITerm::connect( iterm(a, "A2"), nb );
+    dbITerm::connect( iterm(a, "ZN"), na );
+    dbITerm::connect( iterm(b, "A"), na );
+    dbITerm::connect( iterm(b, "ZN"), nb );
+    dbITerm::connect( iterm(c, "A"), na );
+    dbITerm::connect( iterm(c, "ZN"), nc );
+
+    // A chain of 300 buffers from a primary input.
+    dbNet * prev = block->findBTerm("req_msg[1]")->getNet();
+    dbMaster * buf = lib->findMaster("BUF_X1");
+    int i;
+
+    for( i = 0; i < 300; ++i )
+    {
+        char name[32];
+        sprintf(name, "chain_%d", i);
+        dbNet * next = dbNet::create(block, name);
+        dbInst * inst = dbInst::create(block, buf, name);
+        dbITerm::connect( iterm(inst, "A"), prev );
+        dbITerm::connect( iterm(inst, "Z"), next );
+        prev = next;
+    }
+
+    compareLevels(block, "levels with a loop and a deep chain match the walk");
+
+    uint cnt = block->findCombinationalLoops(loops, 2);
+    check("the loop is found", cnt == gcd_loops + 2);
+    check("the loop instances are reported",
+          std::find(loops.begin(), loops.end(), a) != loops.end()
+          && std::find(loops.begin(), loops.end(), b) != loops.end()
+          && std::find(loops.begin(), loops.end(), c) == loops.end());
+
+    dbDatabase::destroy(db);
+    return exit_summary();
+}
@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// dbDatabase::findMaster resolves a name to the master of the first library
+// (in table order) that defines it, like the walk over dbLib::findMaster it
+// replaced, through library edits, destroys, reads and duplicates.
+//
+#include "db.h"
+#include "dbParallel.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+// Reference: the walk over the libraries.
+static dbMaster * walkMaster( dbDatabase * db, const char * name )
+{
+    dbSet<dbLib> libs = db->getLibs();
+    dbSet<dbLib>::iterator itr;
+
+    for( itr = libs.begin(); itr != libs.end(); ++itr )
+    {
+        dbMaster * master = itr->findMaster(name);
+
+        if ( master )
+            return master;
+    }
+
+    return NULL;
+}
+
+static int compareAll( dbDatabase * db, const std::vector<std::string> & names )
+{
+    int errors = 0;
+    uint i;
+
+    for( i = 0; i < names.size(); ++i )
+        if ( db->findMaster(names[i].c_str()) != walkMaster(db, names[i].c_str()) )
+            ++errors;
+
+    return errors;
+}
+
+static const char * libOf( dbDatabase * db, const char * name )
+{
+    dbMaster * master = db->findMaster(name);
+    return master ? master->getLib()->getConstName() : "";
+}
+
+int main( int argc, char ** argv )
+{
+    dbDatabase * db = dbDatabase::create();
+    dbTech::create(db);
+    dbLib * lib1 = dbLib::create(db, "lib1");
+    dbLib * lib2 = dbLib::create(db, "lib2");
+    dbLib * lib3 = dbLib::create(db, "lib3");
+
+    std::vector<std::string> names;
+    names.push_back("INV");
+    names.push_back("BUF");
+    names.push_back("NAND2");
+    names.push_back("ONLY2");
+    names.push_back("ONLY3");
+    names.push_back("MISSING");
+
+    // INV in every library, the later ones created first.
+    dbMaster::create(lib3, "INV");
+    dbMaster::create(lib2, "INV");
+    dbMaster::create(lib1, "INV");
+    check("duplicate resolves to the first library", std::string(libOf(db, "INV")) == "lib1");
+
+    // BUF is added to lib1 after lib2 defined it.
+    dbMaster::create(lib2, "BUF");
+    check("single definition", std::string(libOf(db, "BUF")) == "lib2");
+    dbMaster::create(lib1, "BUF");
+    check("earlier library shadows a later one", std::string(libOf(db, "BUF")) == "lib1");
+
+    dbMaster::create(lib1, "NAND2");
+    dbMaster::create(lib3, "NAND2");
+    dbMaster::create(lib2, "ONLY2");
+    dbMaster::create(lib3, "ONLY3");
+    check("missing name", db->findMaster("MISSING") == NULL);
+    check("created masters match the walk", compareAll(db, names) == 0);
+
+    // A duplicate reads back with the same resolution.
+    dbDatabase * dup = dbDatabase::duplicate(db);
+    check("duplicate matches the walk", compareAll(dup, names) == 0);
+    check("duplicate resolves to the first library", std::string(libOf(dup, "INV")) == "lib1");
+    dbDatabase::destroy(dup);
+
+    // So does a database written and read back.
+    std::string file = "master_index_test.db";
+    FILE * fp = fopen(file.c_str(), "w");
+    db->write(fp);
+    fclose(fp);
+
+    dbDatabase * rdb = dbDatabase::create();
+    fp = fopen(file.c_str(), "r");
+    rdb->read(fp);
+    fclose(fp);
+    remove(file.c_str());
+    check("read db matches the walk", compareAll(rdb, names) == 0);
+    check("read db resolves to the first library", std::string(libOf(rdb, "BUF")) == "lib1");
+    dbDatabase::destroy(rdb);
+
+    // Concurrent lookups.
+    std::vector<int> errors(256, 0);
+    dbParallelFor(errors.size(), 8, [&](int n) {
+        const std::string & name = names[n % names.size()];
+        errors[n] = db->findMaster(name.c_str()) != walkMaster(db, name.c_str());
+    });
+
+    int parallel_errors = 0;
+    uint i;
+
+    for( i = 0; i < errors.size(); ++i )
+        parallel_errors += errors[i];
+
+    check("concurrent lookups match the walk", parallel_errors == 0);
+
+    // Destroying the first library uncovers the next definitions.
+    dbLib::destroy(lib1);
+    check("destroyed library matches the walk", compareAll(db, names) == 0);
+    check("destroyed library uncovers lib2", std::string(libOf(db, "INV")) == "lib2");
+    check("destroyed library uncovers lib3", std::string(libOf(db, "NAND2")) == "lib3");
+
+    dbDatabase::destroy(db);
+    return exit_summary();
+}
@@ -0,0 +1,346 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// The per-orientation master shape cache reproduces the dbMTerm/dbMPin/dbBox
+// walk the instance and iterm shape iterators used to do, in all eight
+// orientations, with and without expanded vias, and when the tables are
+// built by several threads at once.
+//
+#include "db.h"
+#include "dbShape.h"
+#include "dbTransform.h"
+#include "dbParallel.h"
+#include "lefin.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+struct Shape
+{
+    int           type;
+    adsRect       rect;
+    dbTechLayer * layer;
+    dbTechVia *   via;
+
+    bool operator==( const Shape & s ) const
+    {
+        return type == s.type && rect == s.rect && layer == s.layer && via == s.via;
+    }
+};
+
+static Shape makeShape( const dbShape & s )
+{
+    Shape r;
+    r.type = s.getType();
+    s.getBox(r.rect);
+    r.layer = s.getTechLayer();
+    r.via = s.getTechVia();
+    return r;
+}
+
+// Reference: the shapes of a box the way the uncached iterators built them.
+static void walkBox( dbBox * box, const dbTransform & t, bool expand_vias,
+                     std::vector<Shape> & shapes )
+{
+    dbShape shape;
+
+    if ( expand_vias && box->isVia() )
+    {
+        int vx, vy;
+        box->getViaXY(vx, vy);
+        dbTechVia * via = box->getTechVia();
+        dbSet<dbBox> boxes = via->getBoxes();
+        dbSet<dbBox>::iterator itr;
+
+        for( itr = boxes.begin(); itr != boxes.end(); ++itr )
+        {
+            adsRect b;
+            itr->getBox(b);
+            adsRect r( b.xMin() + vx, b.yMin() + vy, b.xMax() + vx, b.yMax() + vy );
+            t.apply(r);
+            shape.setViaBox(via, itr->getTechLayer(), r);
+            shapes.push_back( makeShape(shape) );
+        }
+
+        return;
+    }
+
+    adsRect r;
+    box->getBox(r);
+    t.apply(r);
+
+    if ( box->getTechVia() )
+        shape.setVia(box->getTechVia(), r);
+    else
+        shape.setSegment(box->getTechLayer(), r);
+
+    shapes.push_back( makeShape(shape) );
+}
+
+static void walkMTerm( dbMTerm * mterm, const dbTransform & t, bool expand_vias,
+                       std::vector<Shape> & shapes )
+{
+    dbSet<dbMPin> mpins = mterm->getMPins();
+    dbSet<dbMPin>::iterator pitr;
+
+    for( pitr = mpins.begin(); pitr != mpins.end(); ++pitr )
+    {
+        dbSet<dbBox> boxes = pitr->getGeometry();
+        dbSet<dbBox>::iterator bitr;
+
+        for( bitr = boxes.begin(); bitr != boxes.end(); ++bitr )
+            walkBox(*bitr, t, expand_vias, shapes);
+    }
+}
+
+static void walkInst( dbInst * inst, dbInstShapeItr::IteratorType type, bool expand_vias,
+                      std::vector<Shape> & shapes )
+{
+    int x, y;
+    inst->getOrigin(x, y);
+    dbTransform t( inst->getOrient(), adsPoint(x, y) );
+    dbMaster * master = inst->getMaster();
+
+    if ( type != dbInstShapeItr::OBSTRUCTIONS )
+    {
+        dbSet<dbMTerm> mterms = master->getMTerms();
+        dbSet<dbMTerm>::iterator itr;
+
+        for( itr = mterms.begin(); itr != mterms.end(); ++itr )
+            walkMTerm(*itr, t, expand_vias, shapes);
+    }
+
+    if ( type != dbInstShapeItr::PINS )
+    {
+        dbSet<dbBox> boxes = master->getObstructions();
+        dbSet<dbBox>::iterator itr;
+
+        for( itr = boxes.begin(); itr != boxes.end(); ++itr )
+            walkBox(*itr, t, expand_vias, shapes);
+    }
+}
+
+// Compare the iterators of an instance with the walk, returns the mismatches.
+static int compareInst( dbInst * inst )
+{
+    int errors = 0;
+    int e, k;
+
+    for( e = 0; e < 2; ++e )
+    {
+        bool expand_vias = e == 1;
+
+        for( k = 0; k < 3; ++k )
+        {
+            dbInstShapeItr::IteratorType type = (dbInstShapeItr::IteratorType) k;
+            std::vector<Shape> expected, shapes;
+            walkInst(inst, type, expand_vias, expected);
+
+            dbInstShapeItr itr(expand_vias);
+            dbShape shape;
+            itr.begin(inst, type);
+
+            while( itr.next(shape) )
+                shapes.push_back( makeShape(shape) );
+
+            if ( !(shapes == expected) )
+                ++errors;
+        }
+
+        dbSet<dbITerm> iterms = inst->getITerms();
+        dbSet<dbITerm>::iterator iitr;
+
+        for( iitr = iterms.begin(); iitr != iterms.end(); ++iitr )
+        {
+            dbITerm * iterm = *iitr;
+            int x, y;
+            inst->getOrigin(x, y);
+            dbTransform t( inst->getOrient(), adsPoint(x, y) );
+            std::vector<Shape> expected, shapes;
+            walkMTerm(iterm->getMTerm(), t, expand_vias, expected);
+
+            dbITermShapeItr itr(expand_vias);
+            dbShape shape;
+            itr.begin(iterm);
+
+            while( itr.next(shape) )
+                shapes.push_back( makeShape(shape) );
+
+            if ( !(shapes == expected) )
+                ++errors;
+
+            if ( expand_vias )
+                continue;
+
+            // The bbox and center of the unexpanded shapes.
+            adsRect bbox, r;
+            bool has_bbox = iterm->getBBox(r);
+            double xx = 0.0, yy = 0.0;
+            uint i;
+
+            for( i = 0; i < expected.size(); ++i )
+            {
+                if ( i == 0 )
+                    bbox = expected[i].rect;
+                else
+                    bbox.merge(expected[i].rect);
+
+                xx += expected[i].rect.xMin() + expected[i].rect.xMax();
+                yy += expected[i].rect.yMin() + expected[i].rect.yMax();
+            }
+
+            if ( has_bbox != ! expected.empty() || (has_bbox && !(r == bbox)) )
+                ++errors;
+
+            if ( ! expected.empty() )
+            {
+                int ax, ay;
+                iterm->getAvgXY(&ax, &ay);
+                int n = 2 * expected.size();
+
+                if ( ax != int(xx / n) || ay != int(yy / n) )
+                    ++errors;
+            }
+        }
+    }
+
+    return errors;
+}
+
+// A master with via pins and via obstructions, the library has none.
+static dbMaster * createViaMaster( dbLib * lib, dbTech * tech )
+{
+    dbSet<dbTechVia> vias = tech->getVias();
+    dbTechVia * via1 = *vias.begin();
+    dbTechLayer * m1 = tech->findRoutingLayer(1);
+    dbTechLayer * m2 = tech->findRoutingLayer(2);
+
+    dbMaster * master = dbMaster::create(lib, "VIA_CELL");
+    master->setWidth(3800);
+    master->setHeight(2800);
+
+    dbMTerm * a = dbMTerm::create(master, "A", dbIoType::INPUT);
+    dbMPin * pa = dbMPin::create(a);
+    dbBox::create(pa, m1, 100, 200, 500, 900);
+    dbBox::create(pa, via1, 300, 500);
+
+    dbMTerm * z = dbMTerm::create(master, "Z", dbIoType::OUTPUT);
+    dbMPin * pz1 = dbMPin::create(z);
+    dbBox::create(pz1, m2, 2000, 100, 2400, 2600);
+    dbMPin * pz2 = dbMPin::create(z);
+    dbBox::create(pz2, via1, 2200, 1400);
+
+    dbMTerm::create(master, "NC", dbIoType::INOUT);
+
+    dbBox::create(master, m1, 0, 2500, 3800, 2800);
+    dbBox::create(master, via1, 1200, 1200);
+    master->setFrozen();
+    return master;
+}
+
+int main( int argc, char ** argv )
+{
+    dbDatabase * db = dbDatabase::create();
+    lefin reader(db, false);
+    std::string lef = data_file(argc, argv, "Nangate45/NangateOpenCellLibrary.mod.lef");
+    dbLib * lib = reader.createTechAndLib("lib", lef.c_str());
+    check("read lef", lib != NULL);
+
+    if ( lib == NULL )
+        return exit_summary();
+
+    createViaMaster(lib, db->getTech());
+
+    dbChip * chip = dbChip::create(db);
+    dbBlock * block = dbBlock::create(chip, "top");
+    dbSet<dbMaster> masters = lib->getMasters();
+    dbSet<dbMaster>::iterator mitr;
+    std::vector<dbInst *> insts;
+    int n = 0;
+    srand(5);
+
+    for( mitr = masters.begin(); mitr != masters.end(); ++mitr )
+    {
+        int o;
+
+        for( o = 0; o < 8; ++o )
+        {
+            char name[16];
+            sprintf(name, "u%d", n++);
+            dbInst * inst = dbInst::create(block, *mitr, name);
+            inst->setOrient( dbOrientType((dbOrientType::Value) o) );
+            inst->setLocation( rand() % 100000, rand() % 100000 );
+            inst->setPlacementStatus(dbPlacementStatus::PLACED);
+            insts.push_back(inst);
+        }
+    }
+
+    // Build the tables on several threads at once.
+    std::vector<int> errors(insts.size(), 0);
+    dbParallelFor(insts.size(), 8, [&](int i) {
+        errors[i] = compareInst(insts[i]);
+    }, 1);
+
+    int parallel_errors = 0;
+    uint i;
+
+    for( i = 0; i < errors.size(); ++i )
+        parallel_errors += errors[i];
+
+    check("concurrent shapes match the walk", parallel_errors == 0);
+
+    int serial_errors = 0;
+
+    for( i = 0; i < insts.size(); ++i )
+        serial_errors += compareInst(insts[i]);
+
+    check("cached shapes match the walk", serial_errors == 0);
+
+    // Master edits drop the tables.
+    dbMaster * via_master = lib->findMaster("VIA_CELL");
+    dbMPin * extra = dbMPin::create( via_master->findMTerm("NC") );
+    dbBox::create(extra, db->getTech()->findRoutingLayer(1), 1000, 1000, 1100, 1100);
+    int edit_errors = 0;
+
+    for( i = 0; i < insts.size(); ++i )
+        if ( insts[i]->getMaster() == via_master )
+            edit_errors += compareInst(insts[i]);
+
+    check("edited master shapes match the walk", edit_errors == 0);
+
+    dbDatabase::destroy(db);
+    return exit_summary();
+}
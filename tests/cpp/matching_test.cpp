@@ -0,0 +1,310 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// Graph::find_matching on small random bipartite graphs with right vertex
+// capacities: the OPT matching has the weight of a brute-force optimum,
+// NOOPT (Hopcroft-Karp) matches every left vertex when that is possible,
+// and a warm start after add_edge gives the weight of a cold start.
+//
+#include "graph.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <vector>
+
+struct MatchEdge
+{
+    int  _left;
+    int  _right;
+    long _wt;
+};
+
+struct MatchProblem
+{
+    int                    _num_left;
+    std::vector<int>       _thresh;
+    std::vector<MatchEdge> _edges;
+
+    // Set the weight of an edge, or add it.
+    void setEdge( int left, int right, long wt )
+    {
+        uint i;
+
+        for( i = 0; i < _edges.size(); ++i )
+        {
+            if ( (_edges[i]._left == left) && (_edges[i]._right == right) )
+            {
+                _edges[i]._wt = wt;
+                return;
+            }
+        }
+
+        MatchEdge e;
+        e._left = left;
+        e._right = right;
+        e._wt = wt;
+        _edges.push_back(e);
+    }
+};
+
+static MatchProblem randomProblem( int num_left, int num_right, int max_thresh, int degree )
+{
+    MatchProblem p;
+    p._num_left = num_left;
+    int i;
+
+    for( i = 0; i < num_right; ++i )
+        p._thresh.push_back( 1 + rand() % max_thresh );
+
+    for( i = 0; i < num_left; ++i )
+    {
+        int k;
+
+        for( k = 0; k < degree; ++k )
+            p.setEdge( i, rand() % num_right, rand() % 151 - 50 );
+    }
+
+    return p;
+}
+
+static void build( Graph & g, const MatchProblem & p )
+{
+    uint i;
+
+    for( i = 0; i < p._thresh.size(); ++i )
+        g.add_right_vertex( p._thresh[i] );
+
+    for( i = 0; i < p._edges.size(); ++i )
+        g.add_edge( p._edges[i]._left, p._num_left + p._edges[i]._right, p._edges[i]._wt );
+}
+
+// Minimum weight assignment of every left vertex, LONG_MAX if there is none.
+static void bruteForce( const MatchProblem & p, int left, std::vector<int> & load, long wt, long & best )
+{
+    if ( left == p._num_left )
+    {
+        if ( wt < best )
+            best = wt;
+
+        return;
+    }
+
+    uint i;
+
+    for( i = 0; i < p._edges.size(); ++i )
+    {
+        const MatchEdge & e = p._edges[i];
+
+        if ( (e._left != left) || (load[e._right] == p._thresh[e._right]) )
+            continue;
+
+        ++load[e._right];
+        bruteForce( p, left + 1, load, wt + e._wt, best );
+        --load[e._right];
+    }
+}
+
+static long optimum( const MatchProblem & p )
+{
+    std::vector<int> load( p._thresh.size(), 0 );
+    long best = LONG_MAX;
+    bruteForce( p, 0, load, 0, best );
+    return best;
+}
+
+// Every matched left vertex uses one of its edges and no right vertex is
+// over its capacity; the number of matched left vertices.
+static int checkMatching( Graph & g, const MatchProblem & p, bool & valid )
+{
+    std::vector<int> load( p._thresh.size(), 0 );
+    int matched = 0;
+    int i;
+    valid = true;
+
+    for( i = 0; i < p._num_left; ++i )
+    {
+        int r = g.get_matched_vertex(i);
+
+        if ( r == -1 )
+            continue;
+
+        ++matched;
+        r -= p._num_left;
+
+        if ( (r < 0) || (r >= (int) p._thresh.size()) )
+        {
+            valid = false;
+            continue;
+        }
+
+        bool edge = false;
+        uint k;
+
+        for( k = 0; k < p._edges.size(); ++k )
+            if ( (p._edges[k]._left == i) && (p._edges[k]._right == r) )
+                edge = true;
+
+        if ( ! edge || (++load[r] > p._thresh[r]) )
+            valid = false;
+    }
+
+    return matched;
+}
+
+int main( int argc, char ** argv )
+{
+    srand(5);
+    int opt_mismatch = 0;
+    int opt_invalid = 0;
+    int noopt_mismatch = 0;
+    int warm_mismatch = 0;
+    int feasible = 0;
+    int infeasible = 0;
+    int trial;
+
+    for( trial = 0; trial < 300; ++trial )
+    {
+        int num_left = 2 + rand() % 6;
+        int num_right = 1 + rand() % 4;
+        MatchProblem p = randomProblem( num_left, num_right, 3, 1 + rand() % 3 );
+        long best = optimum(p);
+
+        if ( best == LONG_MAX )
+            ++infeasible;
+        else
+            ++feasible;
+
+        // Weighted matching, against the brute-force optimum.
+        Graph g( num_left );
+        build( g, p );
+        g.set_threads( (trial % 2) ? 4 : 1 );
+        int ok = g.find_matching(OPT);
+        bool valid;
+        int matched = checkMatching( g, p, valid );
+
+        if ( ok != (best != LONG_MAX) )
+            ++opt_mismatch;
+        else if ( ok && (g.matchwt() != best) )
+            ++opt_mismatch;
+
+        if ( ! valid || (ok && (matched != num_left)) )
+            ++opt_invalid;
+
+        // Hopcroft-Karp, every left vertex matched when it is possible.
+        Graph hk( num_left );
+        build( hk, p );
+        ok = hk.find_matching(NOOPT);
+        matched = checkMatching( hk, p, valid );
+
+        if ( ! valid || (ok != (best != LONG_MAX)) || (ok && (matched != num_left)) )
+            ++noopt_mismatch;
+
+        // Warm starts: edit edges after an optimal solve.
+        if ( best == LONG_MAX )
+            continue;
+
+        int edit;
+
+        for( edit = 0; edit < 3; ++edit )
+        {
+            int left = rand() % num_left;
+            int right = rand() % num_right;
+            long wt = rand() % 151 - 50;
+            p.setEdge( left, right, wt );
+            g.add_edge( left, num_left + right, wt );
+
+            // An existing edge made cheaper or dearer as well.
+            const MatchEdge & e = p._edges[ rand() % p._edges.size() ];
+            wt = e._wt + rand() % 61 - 30;
+            g.add_edge( e._left, num_left + e._right, wt );
+            p.setEdge( e._left, e._right, wt );
+
+            best = optimum(p);
+            ok = g.find_matching(OPT);
+            checkMatching( g, p, valid );
+
+            if ( ! valid || (ok != (best != LONG_MAX)) || (ok && (g.matchwt() != best)) )
+                ++warm_mismatch;
+
+            if ( ! ok )
+                break;
+        }
+    }
+
+    check("feasible problems", feasible > 50);
+    check("infeasible problems", infeasible > 20);
+    check("OPT weight is the brute-force optimum", opt_mismatch == 0);
+    check("OPT matching is valid", opt_invalid == 0);
+    check("NOOPT matches every left vertex when possible", noopt_mismatch == 0);
+    check("warm start after add_edge is optimal", warm_mismatch == 0);
+
+    // A larger graph, feasible through the edges i - (i % 150): warm starts
+    // after edits against a cold start.
+    MatchProblem p = randomProblem( 400, 150, 1, 4 );
+    int i;
+
+    for( i = 0; i < 150; ++i )
+        p._thresh[i] = 3;
+
+    for( i = 0; i < 400; ++i )
+        p.setEdge( i, i % 150, rand() % 151 - 50 );
+
+    Graph g( 400 );
+    build( g, p );
+    g.set_threads(4);
+    int ok = g.find_matching(OPT);
+    check("large graph is matched", ok == 1);
+
+    int edit;
+    int large_mismatch = 0;
+
+    for( edit = 0; ok && (edit < 20); ++edit )
+    {
+        int left = rand() % 400;
+        int right = rand() % 150;
+        long wt = rand() % 151 - 50;
+        p.setEdge( left, right, wt );
+        g.add_edge( left, 400 + right, wt );
+        ok = g.find_matching(OPT);
+
+        Graph cold( 400 );
+        build( cold, p );
+        int cold_ok = cold.find_matching(OPT);
+
+        if ( (ok != cold_ok) || (ok && (g.matchwt() != cold.matchwt())) )
+            ++large_mismatch;
+    }
+
+    check("large graph warm starts match a cold start", large_mismatch == 0);
+    return exit_summary();
+}
@@ -0,0 +1,456 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// The netlist graph arrays match a walk of the block through the public
+// netlist API, with every combination of the net filters and on one and
+// several threads, and the graph goes stale on the netlist edits it cannot
+// follow.
+//
+#include "db.h"
+#include "dbNetlistGraph.h"
+#include "dbTransform.h"
+#include "lefin.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+using namespace odb;
+
+struct RefGraph
+{
+    std::vector<uint> net_ids;
+    std::vector<uint> inst_ids;
+    std::vector<int>  net_pin_begin;
+    std::vector<int>  pin_insts;
+    std::vector<int>  pin_nets;
+    std::vector<uint> pin_ids;
+    std::vector<int>  pin_dx;
+    std::vector<int>  pin_dy;
+    std::vector<int>  inst_net_begin;
+    std::vector<int>  inst_nets;
+    std::vector<int>  net_weights;
+    std::vector<int>  inst_weights;
+};
+
+static int indexOf( const std::vector<uint> & ids, uint id )
+{
+    std::vector<uint>::const_iterator itr = std::find( ids.begin(), ids.end(), id );
+    return itr == ids.end() ? -1 : (int) (itr - ids.begin());
+}
+
+// Reference: the pin bbox of an iterm, merged from the boxes of its mpins.
+static bool pinBBox( dbITerm * iterm, adsRect & bbox )
+{
+    dbInst * inst = iterm->getInst();
+    int x, y;
+    inst->getOrigin(x, y);
+    dbTransform t( inst->getOrient(), adsPoint(x, y) );
+    dbSet<dbMPin> mpins = iterm->getMTerm()->getMPins();
+    dbSet<dbMPin>::iterator pitr;
+    bool found = false;
+
+    for( pitr = mpins.begin(); pitr != mpins.end(); ++pitr )
+    {
+        dbSet<dbBox> boxes = pitr->getGeometry();
+        dbSet<dbBox>::iterator bitr;
+
+        for( bitr = boxes.begin(); bitr != boxes.end(); ++bitr )
+        {
+            adsRect r;
+            bitr->getBox(r);
+            t.apply(r);
+
+            if ( found )
+                bbox.merge(r);
+            else
+                bbox = r;
+
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+static void walkBlock( dbBlock * block, bool skip_supply, uint max_fanout,
+                       bool include_bterms, RefGraph & g )
+{
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator iitr;
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+    {
+        g.inst_ids.push_back( iitr->getId() );
+        g.inst_weights.push_back( iitr->getWeight() );
+    }
+
+    dbSet<dbNet> nets = block->getNets();
+    dbSet<dbNet>::iterator nitr;
+
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+    {
+        dbNet * net = *nitr;
+        dbSigType type = net->getSigType();
+
+        if ( skip_supply && ((type == dbSigType::POWER) || (type == dbSigType::GROUND)) )
+            continue;
+
+        dbSet<dbITerm> iterms = net->getITerms();
+        dbSet<dbBTerm> bterms = net->getBTerms();
+        uint cnt = iterms.size() + (include_bterms ? bterms.size() : 0);
+
+        if ( max_fanout && (cnt > max_fanout) )
+            continue;
+
+        int n = g.net_ids.size();
+        g.net_ids.push_back( net->getId() );
+        g.net_weights.push_back( net->getWeight() );
+        g.net_pin_begin.push_back( g.pin_ids.size() );
+
+        dbSet<dbITerm>::iterator titr;
+
+        for( titr = iterms.begin(); titr != iterms.end(); ++titr )
+        {
+            dbITerm * iterm = *titr;
+            dbInst * inst = iterm->getInst();
+            adsRect ibox;
+            inst->getBBox()->getBox(ibox);
+            adsRect pbox;
+            int dx = 0;
+            int dy = 0;
+
+            if ( pinBBox(iterm, pbox) )
+            {
+                dx = (pbox.xMin() + pbox.xMax()) / 2 - (ibox.xMin() + ibox.xMax()) / 2;
+                dy = (pbox.yMin() + pbox.yMax()) / 2 - (ibox.yMin() + ibox.yMax()) / 2;
+            }
+
+            g.pin_insts.push_back( indexOf(g.inst_ids, inst->getId()) );
+            g.pin_nets.push_back(n);
+            g.pin_ids.push_back( iterm->getId() );
+            g.pin_dx.push_back(dx);
+            g.pin_dy.push_back(dy);
+        }
+
+        if ( include_bterms )
+        {
+            dbSet<dbBTerm>::iterator bitr;
+
+            for( bitr = bterms.begin(); bitr != bterms.end(); ++bitr )
+            {
+                int x, y;
+                bitr->getFirstPinLocation(x, y);
+                g.pin_insts.push_back(-1);
+                g.pin_nets.push_back(n);
+                g.pin_ids.push_back( bitr->getId() );
+                g.pin_dx.push_back(x);
+                g.pin_dy.push_back(y);
+            }
+        }
+    }
+
+    g.net_pin_begin.push_back( g.pin_ids.size() );
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+    {
+        std::vector<int> inets;
+        dbSet<dbITerm> iterms = iitr->getITerms();
+        dbSet<dbITerm>::iterator titr;
+
+        for( titr = iterms.begin(); titr != iterms.end(); ++titr )
+        {
+            dbNet * net = titr->getNet();
+
+            if ( net == NULL )
+                continue;
+
+            int n = indexOf(g.net_ids, net->getId());
+
+            if ( n >= 0 )
+                inets.push_back(n);
+        }
+
+        std::sort( inets.begin(), inets.end() );
+        inets.erase( std::unique( inets.begin(), inets.end() ), inets.end() );
+        g.inst_net_begin.push_back( g.inst_nets.size() );
+        g.inst_nets.insert( g.inst_nets.end(), inets.begin(), inets.end() );
+    }
+
+    g.inst_net_begin.push_back( g.inst_nets.size() );
+}
+
+static bool sameGraph( dbNetlistGraph & graph, dbBlock * block, const RefGraph & g )
+{
+    bool same = graph.getNetIds() == g.net_ids
+        && graph.getInstIds() == g.inst_ids
+        && graph.getNetPinBegin() == g.net_pin_begin
+        && graph.getPinInsts() == g.pin_insts
+        && graph.getPinNets() == g.pin_nets
+        && graph.getPinIds() == g.pin_ids
+        && graph.getPinOffsetX() == g.pin_dx
+        && graph.getPinOffsetY() == g.pin_dy
+        && graph.getInstNetBegin() == g.inst_net_begin
+        && graph.getInstNets() == g.inst_nets
+        && graph.getNetWeights() == g.net_weights
+        && graph.getInstWeights() == g.inst_weights
+        && graph.getNumNets() == (int) g.net_ids.size()
+        && graph.getNumInsts() == (int) g.inst_ids.size()
+        && graph.getNumPins() == (int) g.pin_ids.size();
+
+    dbSet<dbNet> nets = block->getNets();
+    dbSet<dbNet>::iterator nitr;
+
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+        if ( graph.findNet(*nitr) != indexOf(g.net_ids, nitr->getId()) )
+            same = false;
+
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator iitr;
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+        if ( graph.findInst(*iitr) != indexOf(g.inst_ids, iitr->getId()) )
+            same = false;
+
+    return same;
+}
+
+static void compareAll( dbBlock * block, const char * what )
+{
+    int mismatches = 0;
+    int supply;
+
+    for( supply = 0; supply < 2; ++supply )
+    {
+        uint fanouts[3] = { 0, 8, 40 };
+        int f;
+
+        for( f = 0; f < 3; ++f )
+        {
+            int bterms;
+
+            for( bterms = 0; bterms < 2; ++bterms )
+            {
+                RefGraph g;
+                walkBlock(block, supply, fanouts[f], bterms, g);
+
+                uint threads[2] = { 1, 4 };
+                int t;
+
+                for( t = 0; t < 2; ++t )
+                {
+                    dbNetlistGraph graph;
+                    graph.setSkipSupplyNets(supply);
+                    graph.setMaxFanout(fanouts[f]);
+                    graph.setIncludeBTerms(bterms);
+                    graph.build(block, threads[t]);
+
+                    if ( graph.isStale() || ! sameGraph(graph, block, g) )
+                        ++mismatches;
+                }
+            }
+        }
+    }
+
+    check(what, mismatches == 0);
+}
+
+static dbNet * randomSignalNet( const std::vector<dbNet *> & nets )
+{
+    return nets[ rand() % nets.size() ];
+}
+
+int main( int argc, char ** argv )
+{
+    dbDatabase * db = dbDatabase::create();
+    lefin reader(db, false);
+    std::string lef = data_file(argc, argv, "Nangate45/NangateOpenCellLibrary.mod.lef");
+    dbLib * lib = reader.createTechAndLib("lib", lef.c_str());
+    check("read lef", lib != NULL);
+
+    if ( lib == NULL )
+        return exit_summary();
+
+    dbTechLayer * metal = db->getTech()->findRoutingLayer(3);
+    std::vector<dbMaster *> masters;
+    dbSet<dbMaster> mset = lib->getMasters();
+    dbSet<dbMaster>::iterator mitr;
+
+    for( mitr = mset.begin(); mitr != mset.end(); ++mitr )
+        if ( mitr->getMTerms().size() > 2 )
+            masters.push_back(*mitr);
+
+    dbChip * chip = dbChip::create(db);
+    dbBlock * block = dbBlock::create(chip, "top");
+    dbNet * vdd = dbNet::create(block, "VDD");
+    dbNet * vss = dbNet::create(block, "VSS");
+    vdd->setSigType(dbSigType::POWER);
+    vss->setSigType(dbSigType::GROUND);
+
+    std::vector<dbNet *> nets;
+    int i;
+    srand(11);
+
+    for( i = 0; i < 120; ++i )
+    {
+        char name[16];
+        sprintf(name, "n%d", i);
+        dbNet * net = dbNet::create(block, name);
+        net->setWeight( 1 + rand() % 4 );
+        nets.push_back(net);
+    }
+
+    dbNet * clk = dbNet::create(block, "clk");
+
+    for( i = 0; i < 300; ++i )
+    {
+        char name[16];
+        sprintf(name, "u%d", i);
+        dbInst * inst = dbInst::create(block, masters[rand() % masters.size()], name);
+        inst->setOrient( dbOrientType((dbOrientType::Value) (rand() % 8)) );
+        inst->setLocation( rand() % 200000, rand() % 200000 );
+        inst->setPlacementStatus(dbPlacementStatus::PLACED);
+        inst->setWeight( rand() % 3 );
+
+        dbSet<dbITerm> iterms = inst->getITerms();
+        dbSet<dbITerm>::iterator titr;
+
+        for( titr = iterms.begin(); titr != iterms.end(); ++titr )
+        {
+            dbITerm * iterm = *titr;
+            dbSigType type = iterm->getMTerm()->getSigType();
+
+            if ( type == dbSigType::POWER )
+                dbITerm::connect(iterm, vdd);
+            else if ( type == dbSigType::GROUND )
+                dbITerm::connect(iterm, vss);
+            else if ( rand() % 10 == 0 )
+                dbITerm::connect(iterm, clk);
+            else if ( rand() % 10 != 0 )
+                dbITerm::connect(iterm, randomSignalNet(nets));
+        }
+    }
+
+    // Block terminals, some without a placed pin.
+    for( i = 0; i < 30; ++i )
+    {
+        char name[16];
+        sprintf(name, "p%d", i);
+        dbBTerm * bterm = dbBTerm::create(randomSignalNet(nets), name);
+
+        if ( i % 3 == 0 )
+            continue;
+
+        dbBPin * bpin = dbBPin::create(bterm);
+        int x = rand() % 200000;
+        int y = rand() % 200000;
+        dbBox::create(bpin, metal, x, y, x + 140, y + 280);
+        bpin->setPlacementStatus(dbPlacementStatus::PLACED);
+    }
+
+    compareAll(block, "graph matches the walk");
+
+    // Staleness
+    dbNetlistGraph graph;
+    graph.build(block, 2);
+    check("fresh graph", ! graph.isStale());
+
+    dbInst * u0 = block->findInst("u0");
+    u0->setLocation(1000, 1000);
+    check("moving an instance keeps the graph", ! graph.isStale());
+
+    dbBTerm * p1 = block->findBTerm("p1");
+    dbBPin * bpin = *p1->getBPins().begin();
+    bpin->setPlacementStatus(dbPlacementStatus::FIRM);
+    check("editing a bpin keeps the graph", ! graph.isStale());
+
+    dbBTerm::destroy(p1);
+    check("destroying a bterm makes the graph stale", graph.isStale());
+    graph.build(block, 2);
+    dbBTerm::create(nets[0], "p1");
+    check("creating a bterm makes the graph stale", graph.isStale());
+
+    graph.setIncludeBTerms(false);
+    graph.build(block, 2);
+    dbBTerm::destroy( block->findBTerm("p2") );
+    dbBTerm::create(nets[1], "p2");
+    check("bterms are ignored without bterm pins", ! graph.isStale());
+    graph.setIncludeBTerms(true);
+
+    dbITerm * iterm = NULL;
+    dbSet<dbITerm> iterms = block->getITerms();
+    dbSet<dbITerm>::iterator titr;
+
+    for( titr = iterms.begin(); titr != iterms.end(); ++titr )
+        if ( titr->getNet() && (titr->getNet()->getSigType() == dbSigType::SIGNAL) )
+        {
+            iterm = *titr;
+            break;
+        }
+
+    graph.build(block, 2);
+    dbITerm::disconnect(iterm);
+    check("disconnecting an iterm makes the graph stale", graph.isStale());
+    graph.build(block, 2);
+    dbITerm::connect(iterm, nets[2]);
+    check("connecting an iterm makes the graph stale", graph.isStale());
+
+    graph.build(block, 2);
+    dbNet::create(block, "extra");
+    check("creating a net makes the graph stale", graph.isStale());
+    graph.build(block, 2);
+    dbNet::destroy( block->findNet("extra") );
+    check("destroying a net makes the graph stale", graph.isStale());
+
+    graph.build(block, 2);
+    dbInst * extra = dbInst::create(block, masters[0], "extra");
+    check("creating an instance makes the graph stale", graph.isStale());
+    graph.build(block, 2);
+    dbInst::destroy(extra);
+    check("destroying an instance makes the graph stale", graph.isStale());
+
+    dbInst * inv = dbInst::create(block, lib->findMaster("INV_X1"), "inv");
+    graph.build(block, 2);
+    inv->swapMaster( lib->findMaster("INV_X2") );
+    check("swapping a master makes the graph stale", graph.isStale());
+
+    graph.clear();
+    dbNet::create(block, "extra2");
+    check("a cleared graph stays stale", graph.isStale() && graph.getNumNets() == 0);
+
+    compareAll(block, "graph matches the walk after the edits");
+
+    dbDatabase::destroy(db);
+    return exit_summary();
+}
@@ -0,0 +1,226 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// dbNet::reduceParasitics must conserve the total capacitance of every
+// corner, both for foreign (cap-node) and allocated (rseg) cap storage.
+//
+#include "db.h"
+#include "test_helpers.h"
+#include <math.h>
+#include <vector>
+
+using namespace odb;
+
+static const int corners = 2;
+
+static double totalCap( dbNet * net, int corner )
+{
+    double cap = 0.0;
+    dbSet<dbCapNode> nodes = net->getCapNodes();
+    dbSet<dbCapNode>::iterator nitr;
+
+    for( nitr = nodes.begin(); nitr != nodes.end(); ++nitr )
+        cap += (*nitr)->getCapacitance(corner);
+
+    // getRSegs() skips the zero rseg, which holds the driver cap
+    dbRSeg * zero = net->getZeroRSeg();
+
+    if ( zero->allocatedCap() )
+        cap += zero->getCapacitance(corner);
+
+    dbSet<dbRSeg> segs = net->getRSegs();
+    dbSet<dbRSeg>::iterator sitr;
+
+    for( sitr = segs.begin(); sitr != segs.end(); ++sitr )
+    {
+        if ( (*sitr)->allocatedCap() )
+            cap += (*sitr)->getCapacitance(corner);
+    }
+
+    return cap;
+}
+
+static uint capNodeCount( dbNet * net )
+{
+    return net->getCapNodes().size();
+}
+
+//
+// Build the RC tree
+//
+//   1 - 2 - 3 - 4 - 5     (1 driver, 5 load)
+//           |
+//           6 - 7         (dangling branch)
+//
+// Nodes listed in "plain" are created without cap storage when the
+// caps live on the nodes.
+//
+static dbNet * buildNet( dbBlock * block, const char * name, bool alloc_cap,
+                         const std::vector<int> & plain )
+{
+    dbNet * net = dbNet::create( block, name );
+    static const int edges[][2] = { {1,2}, {2,3}, {3,4}, {4,5}, {3,6}, {6,7} };
+    const int nedges = sizeof(edges) / sizeof(edges[0]);
+    std::vector<dbCapNode *> nodes(8, (dbCapNode *) NULL);
+    int n, e, c;
+
+    std::vector<bool> has_cap(8, ! alloc_cap);
+
+    for( e = 0; e < (int) plain.size(); ++e )
+        has_cap[ plain[e] ] = false;
+
+    // Create the foreign nodes first, a node without cap storage does not
+    // take a slot in the (id indexed) cap value table.
+    std::vector<int> order;
+
+    for( n = 7; n >= 1; --n )
+    {
+        if ( has_cap[n] )
+            order.push_back(n);
+    }
+
+    for( n = 7; n >= 1; --n )
+    {
+        if ( ! has_cap[n] )
+            order.push_back(n);
+    }
+
+    uint i;
+    for( i = 0; i < order.size(); ++i )
+    {
+        n = order[i];
+        bool foreign = has_cap[n];
+        nodes[n] = dbCapNode::create( net, n, foreign );
+
+        if ( (n == 1) || (n == 5) )
+            nodes[n]->setBTermFlag();
+        else
+            nodes[n]->setInternalFlag();
+
+        if ( foreign )
+        {
+            for( c = 0; c < corners; ++c )
+                nodes[n]->setCapacitance( 1.0 + n + 0.5 * c, c );
+        }
+    }
+
+    for( e = nedges - 1; e >= 0; --e )
+    {
+        dbRSeg * seg = dbRSeg::create( net, 0, 0, 0, alloc_cap );
+        seg->setSourceNode( nodes[ edges[e][0] ]->getId() );
+        seg->setTargetNode( nodes[ edges[e][1] ]->getId() );
+
+        for( c = 0; c < corners; ++c )
+        {
+            seg->setResistance( 10.0 * (e + 1) + c, c );
+
+            if ( alloc_cap )
+                seg->setCapacitance( 2.0 + e + 0.25 * c, c );
+        }
+    }
+
+    dbRSeg * zero = dbRSeg::create( net, 0, 0, 0, alloc_cap );
+    zero->setSourceNode( 0 );
+    zero->setTargetNode( nodes[1]->getId() );
+
+    if ( alloc_cap )
+    {
+        for( c = 0; c < corners; ++c )
+            zero->setCapacitance( 0.5 + c, c );
+    }
+
+    return net;
+}
+
+static void checkReduce( dbNet * net, bool expect_reduced )
+{
+    std::vector<double> before;
+    int c;
+
+    for( c = 0; c < corners; ++c )
+        before.push_back( totalCap(net, c) );
+
+    uint nodes = capNodeCount(net);
+    uint removed = net->reduceParasitics(0.0);
+
+    if ( expect_reduced )
+    {
+        check( "nodes removed", removed > 0 );
+        check( "node count", capNodeCount(net) == nodes - removed );
+    }
+    else
+    {
+        check( "net left as is", removed == 0 );
+        check( "node count", capNodeCount(net) == nodes );
+    }
+
+    for( c = 0; c < corners; ++c )
+        check( "total cap conserved", fabs( totalCap(net, c) - before[c] ) < 1e-4 * before[c] );
+}
+
+//
+// The cap values of cap nodes and rsegs share one table indexed by object
+// id, so each storage scheme gets a block of its own.
+//
+static dbBlock * createCornerBlock( dbDatabase * db )
+{
+    dbChip * chip = dbChip::create( db );
+    dbBlock * block = dbBlock::create( chip, "top" );
+    block->setCornerCount( corners );
+    return block;
+}
+
+int main( int argc, char ** argv )
+{
+    std::vector<int> none;
+    dbDatabase * db = dbDatabase::create();
+    dbTech::create( db );
+    checkReduce( buildNet( createCornerBlock(db), "foreign", false, none ), true );
+    dbDatabase::destroy( db );
+
+    db = dbDatabase::create();
+    dbTech::create( db );
+    checkReduce( buildNet( createCornerBlock(db), "allocated", true, none ), true );
+    dbDatabase::destroy( db );
+
+    // The load and an internal node have no cap storage, the load would
+    // not be able to hold the cap folded into it.
+    std::vector<int> plain;
+    plain.push_back(5);
+    plain.push_back(6);
+    db = dbDatabase::create();
+    dbTech::create( db );
+    checkReduce( buildNet( createCornerBlock(db), "mixed", false, plain ), false );
+    dbDatabase::destroy( db );
+
+    return exit_summary();
+}
@@ -0,0 +1,408 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// dbRowOccupancy answers the site count and free span queries like a brute
+// force walk over every site of every row, after a parallel build and
+// through instance moves, master swaps, placement status changes, creates
+// and destroys.
+//
+#include "db.h"
+#include "dbRowOccupancy.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+
+using namespace odb;
+
+// Reference: the sites of every horizontal row and the placed instances
+// covering each of them.
+struct RefRow
+{
+    int _x;
+    int _y;
+    int _height;
+    int _site_width;
+    int _spacing;
+    std::vector<int> _cover;
+};
+
+static void buildRef( dbBlock * block, std::vector<RefRow> & rows )
+{
+    rows.clear();
+
+    dbSet<dbRow> row_set = block->getRows();
+    dbSet<dbRow>::iterator ritr;
+
+    for( ritr = row_set.begin(); ritr != row_set.end(); ++ritr )
+    {
+        dbRow * row = *ritr;
+
+        if ( row->getDirection() != dbRowDir::HORIZONTAL )
+            continue;
+
+        RefRow r;
+        row->getOrigin( r._x, r._y );
+        r._height = row->getSite()->getHeight();
+        r._site_width = row->getSite()->getWidth();
+        r._spacing = row->getSpacing() > 0 ? row->getSpacing() : r._site_width;
+        r._cover.assign( row->getSiteCount(), 0 );
+        rows.push_back(r);
+    }
+
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator iitr;
+
+    for( iitr = insts.begin(); iitr != insts.end(); ++iitr )
+    {
+        if ( ! iitr->getPlacementStatus().isPlaced() )
+            continue;
+
+        adsRect b;
+        iitr->getBBox()->getBox(b);
+
+        uint i;
+        for( i = 0; i < rows.size(); ++i )
+        {
+            RefRow & r = rows[i];
+
+            if ( (r._y >= b.yMax()) || (r._y + r._height <= b.yMin()) )
+                continue;
+
+            uint s;
+            for( s = 0; s < r._cover.size(); ++s )
+            {
+                int x = r._x + s * r._spacing;
+
+                if ( (x < b.xMax()) && (x + r._site_width > b.xMin()) )
+                    ++r._cover[s];
+            }
+        }
+    }
+}
+
+static void refSiteCount( const std::vector<RefRow> & rows, const adsRect & region,
+                          uint & used, uint & total )
+{
+    used = 0;
+    total = 0;
+
+    uint i;
+    for( i = 0; i < rows.size(); ++i )
+    {
+        const RefRow & r = rows[i];
+
+        if ( (r._y >= region.yMax()) || (r._y + r._height <= region.yMin()) )
+            continue;
+
+        uint s;
+        for( s = 0; s < r._cover.size(); ++s )
+        {
+            int x = r._x + s * r._spacing;
+
+            if ( (x < region.xMax()) && (x + r._site_width > region.xMin()) )
+            {
+                ++total;
+
+                if ( r._cover[s] )
+                    ++used;
+            }
+        }
+    }
+}
+
+// Number of sites a cell of this width spans.
+static int spanSites( const RefRow & r, int width )
+{
+    int w = 1;
+
+    while ( (w - 1) * r._spacing + r._site_width < width )
+        ++w;
+
+    return w;
+}
+
+static bool isFree( const RefRow & r, int s, int w )
+{
+    if ( (s < 0) || (s + w > (int) r._cover.size()) )
+        return false;
+
+    int k;
+    for( k = s; k < s + w; ++k )
+        if ( r._cover[k] )
+            return false;
+
+    return true;
+}
+
+// Distance to the nearest free span, -1 if there is none.
+static long long refNearest( const std::vector<RefRow> & rows, int x, int y, int width )
+{
+    long long best = -1;
+
+    uint i;
+    for( i = 0; i < rows.size(); ++i )
+    {
+        const RefRow & r = rows[i];
+        int w = spanSites( r, width );
+        int s;
+
+        for( s = 0; s < (int) r._cover.size(); ++s )
+        {
+            if ( ! isFree( r, s, w ) )
+                continue;
+
+            long long d = llabs( (long long) r._y - y ) + llabs( (long long) r._x + s * r._spacing - x );
+
+            if ( (best < 0) || (d < best) )
+                best = d;
+        }
+    }
+
+    return best;
+}
+
+// Number of queries that disagree with the reference.
+static int compare( dbBlock * block, dbRowOccupancy & occ, int queries )
+{
+    std::vector<RefRow> rows;
+    buildRef( block, rows );
+
+    int errors = 0;
+    int q;
+
+    for( q = 0; q < queries; ++q )
+    {
+        int x = rand() % 42000 - 1000;
+        int y = rand() % 44000 - 1000;
+        adsRect region( x, y, x + rand() % 6000 + 1, y + rand() % 5000 + 1 );
+
+        uint used, total, ref_used, ref_total;
+        occ.getSiteCount( region, used, total );
+        refSiteCount( rows, region, ref_used, ref_total );
+        errors += (used != ref_used) || (total != ref_total);
+
+        int width = rand() % 2000 + 1;
+        int span_x, span_y;
+        dbRow * row = NULL;
+        long long ref = refNearest( rows, x, y, width );
+
+        if ( ! occ.findFreeSpan( x, y, width, span_x, span_y, &row ) )
+        {
+            errors += ref >= 0;
+            continue;
+        }
+
+        long long d = llabs( (long long) span_y - y ) + llabs( (long long) span_x - x );
+        errors += d != ref;
+
+        // The span found is free in the reference.
+        uint i;
+        bool found = false;
+
+        for( i = 0; i < rows.size(); ++i )
+        {
+            const RefRow & r = rows[i];
+            int ox, oy;
+            row->getOrigin( ox, oy );
+
+            if ( (r._x != ox) || (r._y != oy) || ((span_x - r._x) % r._spacing) )
+                continue;
+
+            found = isFree( r, (span_x - r._x) / r._spacing, spanSites( r, width ) );
+        }
+
+        errors += ! found;
+    }
+
+    return errors;
+}
+
+static void place( dbInst * inst )
+{
+    inst->setOrient( rand() % 2 ? dbOrientType::R0 : dbOrientType::MX );
+    inst->setLocation( rand() % 40000, (rand() % 30) * 1400 + (rand() % 8 ? 0 : 700) );
+    inst->setPlacementStatus( rand() % 10 ? dbPlacementStatus::PLACED : dbPlacementStatus::FIRM );
+}
+
+int main( int argc, char ** argv )
+{
+    srand(37);
+
+    dbDatabase * db = dbDatabase::create();
+    dbTech::create(db);
+    dbLib * lib = dbLib::create(db, "lib");
+    dbSite * site = dbSite::create(lib, "CORE");
+    site->setWidth(190);
+    site->setHeight(1400);
+
+    // Site multiples, a width between sites and a double height cell.
+    std::vector<dbMaster *> masters;
+    int widths[] = { 190, 380, 250, 950, 1900, 570 };
+    int heights[] = { 1400, 1400, 1400, 1400, 1400, 2800 };
+    int i;
+
+    for( i = 0; i < 6; ++i )
+    {
+        char name[16];
+        sprintf(name, "M%d", i);
+        dbMaster * master = dbMaster::create(lib, name);
+        master->setWidth( widths[i] );
+        master->setHeight( heights[i] );
+        master->setFrozen();
+        masters.push_back(master);
+    }
+
+    dbChip * chip = dbChip::create(db);
+    dbBlock * block = dbBlock::create(chip, "top");
+
+    // Abutting rows, rows with a gap between sites, an offset row and a
+    // vertical row (ignored).
+    for( i = 0; i < 30; ++i )
+    {
+        char name[16];
+        sprintf(name, "row%d", i);
+        int spacing = (i % 5 == 3) ? 200 : (i % 7 == 2 ? 0 : 190);
+        int x = (i % 4 == 1) ? 95 : 0;
+        dbRow::create( block, name, site, x, i * 1400, dbOrientType::R0, dbRowDir::HORIZONTAL, 200, spacing );
+    }
+
+    dbRow::create( block, "vrow", site, 39000, 0, dbOrientType::R0, dbRowDir::VERTICAL, 20, 1400 );
+
+    std::vector<dbInst *> insts;
+
+    for( i = 0; i < 800; ++i )
+    {
+        char name[16];
+        sprintf(name, "i%d", i);
+        dbInst * inst = dbInst::create( block, masters[rand() % masters.size()], name );
+
+        if ( rand() % 8 )
+            place(inst);
+
+        insts.push_back(inst);
+    }
+
+    dbRowOccupancy occ;
+    occ.build( block, 4 );
+    check("rows built", occ.getRowCount() == 30);
+    check("built occupancy matches the walk", compare( block, occ, 400 ) == 0);
+
+    // Moves and orient changes through the callbacks.
+    for( i = 0; i < 200; ++i )
+    {
+        dbInst * inst = insts[rand() % insts.size()];
+
+        if ( inst->getPlacementStatus().isPlaced() )
+        {
+            inst->setOrient( dbOrientType::MY );
+            inst->setLocation( rand() % 40000, (rand() % 30) * 1400 );
+        }
+    }
+
+    check("moves match the walk", compare( block, occ, 400 ) == 0);
+
+    // Master swaps.
+    for( i = 0; i < 100; ++i )
+        insts[rand() % insts.size()]->swapMaster( masters[rand() % masters.size()] );
+
+    check("master swaps match the walk", compare( block, occ, 400 ) == 0);
+
+    // Placement status changes need updateInst.
+    for( i = 0; i < 100; ++i )
+    {
+        dbInst * inst = insts[rand() % insts.size()];
+
+        if ( inst->getPlacementStatus().isPlaced() )
+            inst->setPlacementStatus( dbPlacementStatus::UNPLACED );
+        else
+            place(inst);
+
+        occ.updateInst(inst);
+    }
+
+    check("status changes match the walk", compare( block, occ, 400 ) == 0);
+
+    // Destroys, then creates reusing the ids.
+    for( i = 0; i < 150; ++i )
+    {
+        int k = rand() % insts.size();
+        dbInst::destroy( insts[k] );
+        insts.erase( insts.begin() + k );
+    }
+
+    check("destroys match the walk", compare( block, occ, 400 ) == 0);
+
+    for( i = 0; i < 150; ++i )
+    {
+        char name[16];
+        sprintf(name, "n%d", i);
+        dbInst * inst = dbInst::create( block, masters[rand() % masters.size()], name );
+        place(inst);
+        occ.updateInst(inst);
+        insts.push_back(inst);
+    }
+
+    check("creates match the walk", compare( block, occ, 400 ) == 0);
+
+    // Queries outside of the rows.
+    uint used, total;
+    occ.getSiteCount( adsRect(-100000, -100000, -90000, -90000), used, total );
+    check("region outside the rows", (used == 0) && (total == 0) && (occ.getUtilization( adsRect(-100000, -100000, -90000, -90000) ) == 0.0));
+
+    int span_x, span_y;
+    check("span wider than a row", ! occ.findFreeSpan( 0, 0, 200 * 200 + 1, span_x, span_y ));
+
+    // A rebuild and an incrementally maintained occupancy agree.
+    dbRowOccupancy rebuilt;
+    rebuilt.build( block, 1 );
+    int diffs = 0;
+
+    for( i = 0; i < 300; ++i )
+    {
+        int x = rand() % 40000;
+        int y = rand() % 42000;
+        adsRect region( x, y, x + 3000, y + 2800 );
+        uint u1, t1, u2, t2;
+        occ.getSiteCount( region, u1, t1 );
+        rebuilt.getSiteCount( region, u2, t2 );
+        diffs += (u1 != u2) || (t1 != t2);
+    }
+
+    check("rebuild matches the incremental occupancy", diffs == 0);
+
+    rebuilt.clear();
+    occ.clear();
+    dbDatabase::destroy(db);
+    return exit_summary();
+}
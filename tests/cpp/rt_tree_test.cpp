@@ -0,0 +1,244 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// Every dbRtTree owns its pool, so wires can be decoded into trees and
+// encoded back on several threads. The wires encoded by the threads match
+// the ones encoded on the calling thread, and a tree moved into another
+// tree keeps its nodes and edges after the source tree is destroyed.
+//
+#include "db.h"
+#include "dbParallel.h"
+#include "dbRtTree.h"
+#include "dbWireCodec.h"
+#include "lefin.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+static const uint threads = 4;
+
+static int countNodes( dbRtTree & tree )
+{
+    int cnt = 0;
+    dbRtTree::node_iterator itr;
+
+    for( itr = tree.begin_nodes(); itr != tree.end_nodes(); ++itr )
+        ++cnt;
+
+    return cnt;
+}
+
+static int countEdges( dbRtTree & tree )
+{
+    int cnt = 0;
+    dbRtTree::edge_iterator itr;
+
+    for( itr = tree.begin_edges(); itr != tree.end_edges(); ++itr )
+        ++cnt;
+
+    return cnt;
+}
+
+// Decode wire "a" into a tree, move the tree of wire "b" into it, destroy
+// the moved tree and encode the result into "out".
+static void moveTrees( dbWire * a, dbWire * b, dbWire * out )
+{
+    dbRtTree tree;
+    tree.decode(a);
+
+    dbRtTree * other = new dbRtTree;
+    other->decode(b);
+    tree.move(other);
+    delete other;
+
+    tree.encode(out);
+}
+
+// The wire of the net "<name><suffix>", every wire is created on the calling
+// thread, the threads only encode into them.
+static std::vector<dbWire *> createWires( dbBlock * block, const std::vector<dbNet *> & nets,
+                                          const char * suffix )
+{
+    std::vector<dbWire *> wires;
+    uint i;
+
+    for( i = 0; i < nets.size(); ++i )
+    {
+        std::string name = nets[i]->getConstName();
+        name += suffix;
+        dbNet * net = dbNet::create(block, name.c_str());
+        wires.push_back( dbWire::create(net) );
+    }
+
+    return wires;
+}
+
+int main( int argc, char ** argv )
+{
+    dbDatabase * db = dbDatabase::create();
+    lefin reader(db, false);
+    std::string lef = data_file(argc, argv, "Nangate45/NangateOpenCellLibrary.mod.lef");
+    dbLib * lib = reader.createTechAndLib("lib", lef.c_str());
+    check("read lef", lib != NULL);
+
+    if ( lib == NULL )
+        return exit_summary();
+
+    dbTech * tech = db->getTech();
+    dbChip * chip = dbChip::create(db);
+    dbBlock * block = dbBlock::create(chip, "top");
+    srand(5);
+
+    std::vector<dbNet *> nets;
+    uint i;
+
+    for( i = 0; i < 2000; ++i )
+    {
+        char name[16];
+        sprintf(name, "n%u", i);
+        dbNet * net = dbNet::create(block, name);
+        routeNet(net, tech, false, 6);
+        nets.push_back(net);
+    }
+
+    uint cnt = nets.size();
+    std::vector<dbWire *> serial = createWires(block, nets, "_serial");
+    std::vector<dbWire *> parallel = createWires(block, nets, "_parallel");
+    std::vector<dbWire *> serial_moved = createWires(block, nets, "_serial_moved");
+    std::vector<dbWire *> parallel_moved = createWires(block, nets, "_parallel_moved");
+
+    // decode/encode round trip, on the calling thread and on several threads
+    for( i = 0; i < cnt; ++i )
+    {
+        dbRtTree tree;
+        tree.decode( nets[i]->getWire() );
+        tree.encode( serial[i] );
+    }
+
+    dbParallelFor( cnt, threads, [&]( uint n )
+    {
+        dbRtTree tree;
+        tree.decode( nets[n]->getWire() );
+        tree.encode( parallel[n] );
+    }, 8 );
+
+    int diffs = 0;
+
+    for( i = 0; i < cnt; ++i )
+        if ( ! sameWire( serial[i], parallel[i] ) )
+            ++diffs;
+
+    check("parallel round trip matches the serial one", diffs == 0);
+
+    // the round trip keeps the connectivity of the wire
+    diffs = 0;
+
+    for( i = 0; i < cnt; ++i )
+    {
+        dbRtTree a, b;
+        a.decode( nets[i]->getWire() );
+        b.decode( parallel[i] );
+
+        if ( countNodes(a) != countNodes(b) || countEdges(a) != countEdges(b) )
+            ++diffs;
+    }
+
+    check("round trip keeps the nodes and edges", diffs == 0);
+
+    // A tree moved into another tree takes the memory of its nodes and edges
+    // along, the source tree is destroyed before the result is encoded.
+    for( i = 0; i < cnt; ++i )
+        moveTrees( nets[i]->getWire(), nets[(i + 1) % cnt]->getWire(), serial_moved[i] );
+
+    dbParallelFor( cnt, threads, [&]( uint n )
+    {
+        moveTrees( nets[n]->getWire(), nets[(n + 1) % cnt]->getWire(), parallel_moved[n] );
+    }, 8 );
+
+    diffs = 0;
+    int size_diffs = 0;
+
+    for( i = 0; i < cnt; ++i )
+    {
+        if ( ! sameWire( serial_moved[i], parallel_moved[i] ) )
+            ++diffs;
+
+        dbRtTree a, b, moved;
+        a.decode( nets[i]->getWire() );
+        b.decode( nets[(i + 1) % cnt]->getWire() );
+        moved.decode( parallel_moved[i] );
+
+        if ( countNodes(moved) != countNodes(a) + countNodes(b)
+             || countEdges(moved) != countEdges(a) + countEdges(b) )
+            ++size_diffs;
+    }
+
+    check("parallel move matches the serial one", diffs == 0);
+    check("moved tree holds the nodes and edges of both trees", size_diffs == 0);
+
+    // A moved tree empties its source, and the moved nodes stay valid while
+    // the destination keeps allocating and freeing.
+    dbRtTree dst;
+    dst.decode( nets[0]->getWire() );
+    int dst_nodes = countNodes(dst);
+    int dst_edges = countEdges(dst);
+
+    dbRtTree * src = new dbRtTree;
+    src->decode( nets[1]->getWire() );
+    int src_nodes = countNodes(*src);
+    int src_edges = countEdges(*src);
+
+    dst.move(src);
+    check("move empties the source nodes", countNodes(*src) == 0);
+    check("move empties the source edges", countEdges(*src) == 0);
+    delete src;
+
+    check("move adds the nodes", countNodes(dst) == dst_nodes + src_nodes);
+    check("move adds the edges", countEdges(dst) == dst_edges + src_edges);
+
+    dbRtTree::edge_iterator eitr;
+
+    for( eitr = dst.begin_edges(); eitr != dst.end_edges(); )
+        eitr = dst.deleteEdge(eitr, true);
+
+    check("deleting the moved edges empties the tree", countNodes(dst) == 0);
+
+    dst.decode( nets[2]->getWire() );
+    dst.encode( parallel[0] );
+    check("tree is reusable after a move", sameWire( serial[2], parallel[0] ));
+
+    return exit_summary();
+}
@@ -0,0 +1,264 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// Snapshots revert and restore journaled changes (placement, connections,
+// buffer removal, rerouting), share the journal of an active eco, and refuse
+// to undo a deletion the journal cannot restore.
+//
+#include "db.h"
+#include "dbWireCodec.h"
+#include "ZException.h"
+#include "test_helpers.h"
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+// A chain of 20 buffers, net n<i> routed on M1 from its driver.
+static dbBlock * createRoutedBlock( dbDatabase * db )
+{
+    dbBlock * block = createBlock( db, 20 );
+    dbTechLayer * m1 = dbTechLayer::create( db->getTech(), "M1", dbTechLayerType::ROUTING );
+    int i;
+
+    for( i = 0; i < 20; ++i )
+    {
+        char name[16];
+        sprintf( name, "n%d", i );
+        routeNet( block->findNet( name ), m1, 1000 * i, 0, 1000 );
+    }
+
+    return block;
+}
+
+// Placement, connectivity and wires of the block, with the ids, as a string.
+static std::string state( dbBlock * block )
+{
+    std::string s;
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator itr;
+
+    for( itr = insts.begin(); itr != insts.end(); ++itr )
+    {
+        dbInst * inst = *itr;
+        int x, y;
+        inst->getOrigin( x, y );
+        adsRect r;
+        inst->getBBox()->getBox( r );
+        char buf[256];
+        dbNet * a = inst->findITerm("A")->getNet();
+        sprintf( buf, "%s %u %d %d %d %d %d %d %s %s %s %u %u\n", inst->getConstName(), inst->getId(), x, y,
+                 r.xMin(), r.yMin(), r.xMax(), r.yMax(),
+                 inst->getOrient().getString(), inst->getPlacementStatus().getString(),
+                 a ? a->getConstName() : "-",
+                 inst->findITerm("A")->getId(), inst->findITerm("Z")->getId() );
+        s += buf;
+    }
+
+    dbSet<dbNet> nets = block->getNets();
+    dbSet<dbNet>::iterator nitr;
+
+    for( nitr = nets.begin(); nitr != nets.end(); ++nitr )
+    {
+        dbNet * net = *nitr;
+        dbWire * wire = net->getWire();
+        char buf[64];
+        sprintf( buf, "%s %u %u", net->getConstName(), net->getId(), net->getITerms().size() );
+        s += buf;
+
+        if ( wire )
+        {
+            uint i;
+            for( i = 0; i < wire->length(); ++i )
+            {
+                sprintf( buf, " %u:%d", wire->getOpcode(i), wire->getData(i) );
+                s += buf;
+            }
+        }
+
+        s += "\n";
+    }
+
+    return s;
+}
+
+// Remove the buffer u<i>, its fanout is driven by the net of its input.
+static void removeBuffer( dbBlock * block, int i )
+{
+    char name[16];
+    sprintf( name, "u%d", i );
+    dbInst * inst = block->findInst( name );
+    dbNet * in = inst->findITerm("A")->getNet();
+    dbNet * out = inst->findITerm("Z")->getNet();
+    dbSet<dbITerm> iterms = out->getITerms();
+    std::vector<dbITerm *> sinks;
+    dbSet<dbITerm>::iterator itr;
+
+    for( itr = iterms.begin(); itr != iterms.end(); ++itr )
+        if ( itr->getInst() != inst )
+            sinks.push_back( *itr );
+
+    dbInst::destroy( inst );
+    dbNet::destroy( out );
+
+    uint k;
+    for( k = 0; k < sinks.size(); ++k )
+        dbITerm::connect( sinks[k], in );
+
+    // reroute the merged net
+    if ( in->getWire() )
+        dbWire::destroy( in->getWire() );
+
+    dbTechLayer * m1 = block->getDb()->getTech()->findLayer( "M1" );
+    routeNet( in, m1, 1000 * (i - 1), 0, 2000 );
+}
+
+static void edit( dbBlock * block, int seed )
+{
+    srand( seed );
+    dbSet<dbInst> insts = block->getInsts();
+    dbSet<dbInst>::iterator itr;
+    int i = 0;
+
+    for( itr = insts.begin(); itr != insts.end(); ++itr, ++i )
+    {
+        dbInst * inst = *itr;
+        inst->setOrigin( rand() % 50000, rand() % 50000 );
+
+        if ( rand() % 2 )
+            inst->setOrient( dbOrientType::MY );
+
+        if ( rand() % 3 == 0 )
+            inst->setPlacementStatus( dbPlacementStatus::FIRM );
+    }
+
+    char name[16];
+    sprintf( name, "v%d", seed );
+    dbITerm * a = block->findInst("u5")->findITerm("A");
+    dbITerm::disconnect( a );
+    dbITerm::connect( a, dbNet::create( block, name ) );
+}
+
+int main( int argc, char ** argv )
+{
+    dbDatabase * db = dbDatabase::create();
+    dbBlock * block = createRoutedBlock( db );
+    std::string base = state( block );
+
+    check( "begin", dbDatabase::beginSnapshot( block ) );
+
+
+    edit( block, 1 );
+    std::string v1 = state( block );
+    check( "save v1", dbDatabase::saveSnapshot( block, "v1" ) );
+    check( "revert v1", dbDatabase::revertSnapshot( block ) );
+    check( "reverted to base", state( block ) == base );
+
+    edit( block, 2 );
+    std::string v2 = state( block );
+    check( "variants differ", v1 != v2 );
+    check( "save v2", dbDatabase::saveSnapshot( block, "v2" ) );
+
+    check( "restore v1", dbDatabase::restoreSnapshot( block, "v1" ) );
+    check( "v1 restored", state( block ) == v1 );
+    check( "restore v2", dbDatabase::restoreSnapshot( block, "v2" ) );
+    check( "v2 restored", state( block ) == v2 );
+    check( "restore unknown", ! dbDatabase::restoreSnapshot( block, "v3" ) );
+
+    FILE * out = tmpfile();
+    check( "diff v1", dbDatabase::diffSnapshot( block, "v1", out ) );
+    fclose( out );
+
+    // Remove a buffer and reroute: deletions and wire updates are journaled.
+    check( "revert v2", dbDatabase::revertSnapshot( block ) );
+    removeBuffer( block, 10 );
+    std::string removed = state( block );
+    check( "buffer removed", (block->findInst("u10") == NULL) && (block->findNet("n10") == NULL) );
+    check( "save removed", dbDatabase::saveSnapshot( block, "removed" ) );
+    check( "revert removed", dbDatabase::revertSnapshot( block ) );
+    check( "buffer restored", state( block ) == base );
+    check( "restore removed", dbDatabase::restoreSnapshot( block, "removed" ) );
+    check( "removal restored", state( block ) == removed );
+    check( "restore v1 over removal", dbDatabase::restoreSnapshot( block, "v1" ) );
+    check( "v1 restored over removal", state( block ) == v1 );
+
+    // A net deleted with a property cannot be restored: the revert throws
+    // and leaves the block as it is.
+    dbNet * tmp = block->findNet( "n3" );
+    dbIntProperty::create( tmp, "weight", 1 );
+    dbNet::destroy( tmp );
+    std::string edited = state( block );
+    check( "save after delete", dbDatabase::saveSnapshot( block, "v3" ) );
+    bool thrown = false;
+
+    try
+    {
+        dbDatabase::revertSnapshot( block );
+    }
+    catch( ZException & )
+    {
+        thrown = true;
+    }
+
+    check( "revert after delete throws", thrown );
+    check( "block kept", state( block ) == edited );
+    dbDatabase::endSnapshot( block );
+
+    // A snapshot inside an eco shares its journal, the eco records the
+    // variant the block is left in.
+    std::string start = state( block );
+    dbDatabase::beginEco( block );
+    dbDatabase::setSavepoint( block, "eco" );
+    block->findInst("u0")->setOrigin( 7, 7 );
+    std::string eco = state( block );
+    check( "snapshot in eco", dbDatabase::beginSnapshot( block ) );
+    removeBuffer( block, 5 );
+    std::string in_eco = state( block );
+    check( "save in eco", dbDatabase::saveSnapshot( block, "removed" ) );
+    check( "revert in eco", dbDatabase::revertSnapshot( block ) );
+    check( "reverted to eco", state( block ) == eco );
+    check( "restore in eco", dbDatabase::restoreSnapshot( block, "removed" ) );
+    check( "restored in eco", state( block ) == in_eco );
+    dbDatabase::endSnapshot( block );
+    check( "eco kept the variant", state( block ) == in_eco );
+    check( "eco rollback", dbDatabase::rollbackToSavepoint( block, "eco" ) );
+    check( "eco rolled back", state( block ) == start );
+    dbDatabase::endEco( block );
+
+    check( "new snapshot", dbDatabase::beginSnapshot( block ) );
+    check( "clean snapshot", dbDatabase::saveSnapshot( block, "v1" ) );
+    dbDatabase::endSnapshot( block );
+
+    dbDatabase::destroy( db );
+    return exit_summary();
+}
@@ -0,0 +1,372 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// The compiled layer rule cache answers getSpacing and the wide DRC range
+// queries exactly like the walk over the layer rules it replaced, also when
+// the queries run on several threads after an edit dropped the cache.
+//
+#include "db.h"
+#include "dbParallel.h"
+#include "dbTechLayer.h"
+#include "lefin.h"
+#include "test_helpers.h"
+#include <stdlib.h>
+#include <vector>
+
+using namespace odb;
+
+//
+// Reference: the uncached rule walk of dbTechLayer::getSpacing.
+//
+static int walkSpacing( dbTechLayer * tech_layer, int w, int l )
+{
+    _dbTechLayer * layer = (_dbTechLayer *) tech_layer;
+    dbSet<dbTechLayerSpacingRule> v54rules;
+
+    bool found_spacing = false;
+    uint spacing = MAX_INT;
+
+    bool found_over_spacing = false;
+    uint over_spacing = MAX_INT;
+    uint width = (uint) w;
+    uint length = (uint) l;
+
+    if ( tech_layer->getV54SpacingRules(v54rules) )
+    {
+        dbSet<dbTechLayerSpacingRule>::iterator ritr;
+        uint rmin, rmax;
+
+        for( ritr = v54rules.begin(); ritr != v54rules.end(); ++ritr )
+        {
+            dbTechLayerSpacingRule * cur_rule = *ritr;
+
+            if ( cur_rule->getRange(rmin, rmax) )
+            {
+                if ( (width >= rmin) && (width <= rmax) )
+                {
+                    spacing = MIN(spacing, cur_rule->getSpacing());
+                    found_spacing = true;
+                }
+
+                if ( width > rmax )
+                {
+                    found_over_spacing = true;
+                    over_spacing = MIN(over_spacing, cur_rule->getSpacing());
+                }
+            }
+        }
+    }
+
+    std::vector< std::vector<uint> > v55rules;
+    uint i, j;
+
+    if ( tech_layer->getV55SpacingTable(v55rules) )
+    {
+        for( i = 1; (i < layer->_v55sp_width_idx.size()) && (width > layer->_v55sp_width_idx[i]); i++ );
+        for( j = 1; (j < layer->_v55sp_length_idx.size()) && (length > layer->_v55sp_length_idx[j]); j++ );
+        found_spacing = true;
+        spacing = v55rules[i-1][j-1];
+    }
+
+    if ( !found_spacing && found_over_spacing )
+    {
+        found_spacing = true;
+        spacing = over_spacing;
+    }
+
+    return found_spacing ? spacing : tech_layer->getSpacing();
+}
+
+//
+// Reference: the uncached walks of get{Max,Min}WideDRCRange.
+//
+static void walkWideDRCRange( dbTechLayer * tech_layer, bool max_range,
+                              int & owidth, int & olength )
+{
+    _dbTechLayer * layer = (_dbTechLayer *) tech_layer;
+    dbSet<dbTechLayerSpacingRule> v54rules;
+
+    owidth = olength = tech_layer->getWidth();
+
+    if ( tech_layer->getV54SpacingRules(v54rules) )
+    {
+        dbSet<dbTechLayerSpacingRule>::iterator ritr;
+        uint rmin, rmax;
+        bool range_found = false;
+
+        for( ritr = v54rules.begin(); ritr != v54rules.end(); ++ritr )
+        {
+            if ( ! (*ritr)->getRange(rmin, rmax) )
+                continue;
+
+            if ( max_range )
+            {
+                if ( rmin > (uint) owidth )
+                    owidth = olength = rmin;
+            }
+            else if ( (rmin < (uint) owidth) || !range_found )
+                owidth = olength = rmin;
+        }
+    }
+
+    if ( tech_layer->hasV55SpacingRules() )
+    {
+        if ( max_range )
+        {
+            owidth = layer->_v55sp_width_idx[layer->_v55sp_width_idx.size()-1];
+            olength = layer->_v55sp_length_idx[layer->_v55sp_length_idx.size()-1];
+        }
+        else
+        {
+            // The old walk read past the end of one entry indexes.
+            uint w = layer->_v55sp_width_idx.size() > 1 ? 1 : 0;
+            uint l = layer->_v55sp_length_idx.size() > 1 ? 1 : 0;
+            owidth = layer->_v55sp_width_idx[w];
+            olength = layer->_v55sp_length_idx[l];
+        }
+    }
+}
+
+// The cached rule list must hold the rules of the collection, in order.
+template <class T>
+static bool sameRules( dbSet<T> rules, const std::vector<T *> & cached )
+{
+    if ( rules.size() != cached.size() )
+        return false;
+
+    typename dbSet<T>::iterator itr;
+    uint i = 0;
+
+    for( itr = rules.begin(); itr != rules.end(); ++itr, ++i )
+        if ( *itr != cached[i] )
+            return false;
+
+    return true;
+}
+
+static int compareRuleLists( dbTechLayer * layer )
+{
+    int errors = 0;
+    std::vector<dbTechV55InfluenceEntry *> inf_rules;
+    std::vector<dbTechMinCutRule *> cut_rules;
+    std::vector<dbTechMinEncRule *> enc_rules;
+
+    if ( layer->getV55InfluenceRules(inf_rules) != ! inf_rules.empty()
+         || ! sameRules(layer->getV55InfluenceEntries(), inf_rules) )
+        ++errors;
+
+    if ( layer->getMinimumCutRules(cut_rules) != ! cut_rules.empty()
+         || ! sameRules(layer->getMinCutRules(), cut_rules) )
+        ++errors;
+
+    if ( layer->getMinEnclosureRules(enc_rules) != ! enc_rules.empty()
+         || ! sameRules(layer->getMinEncRules(), enc_rules) )
+        ++errors;
+
+    return errors;
+}
+
+// Compare every query for widths and lengths up to limit, returns the
+// number of mismatches.
+static int compareLayer( dbTechLayer * layer, int limit, int step )
+{
+    int errors = compareRuleLists(layer);
+    int w, l;
+
+    for( w = 0; w <= limit; w += step )
+        for( l = 0; l <= limit; l += step )
+            if ( layer->getSpacing(w, l) != walkSpacing(layer, w, l) )
+                ++errors;
+
+    int x0, y0, x1, y1;
+    layer->getMaxWideDRCRange(x0, y0);
+    walkWideDRCRange(layer, true, x1, y1);
+
+    if ( x0 != x1 || y0 != y1 )
+        ++errors;
+
+    layer->getMinWideDRCRange(x0, y0);
+    walkWideDRCRange(layer, false, x1, y1);
+
+    if ( x0 != x1 || y0 != y1 )
+        ++errors;
+
+    return errors;
+}
+
+static void createRangeRules( dbTechLayer * layer, int count )
+{
+    int i;
+
+    for( i = 0; i < count; ++i )
+    {
+        dbTechLayerSpacingRule * rule = dbTechLayerSpacingRule::create(layer);
+        uint rmin = rand() % 4000;
+        rule->setRange(rmin, rmin + rand() % 2000);
+        rule->setSpacing(100 + rand() % 500);
+    }
+}
+
+static void createSpacingTable( dbTechLayer * layer )
+{
+    uint widths[] = { 0, 180, 400, 900, 1800 };
+    uint lengths[] = { 0, 1000, 3000 };
+    uint i, j;
+
+    layer->initV55WidthIndex(5);
+    layer->initV55LengthIndex(3);
+
+    for( i = 0; i < 5; ++i )
+        layer->addV55WidthEntry(widths[i]);
+
+    for( j = 0; j < 3; ++j )
+        layer->addV55LengthEntry(lengths[j]);
+
+    layer->initV55SpacingTable(5, 3);
+
+    for( i = 0; i < 5; ++i )
+        for( j = 0; j < 3; ++j )
+            layer->addV55SpacingTableEntry(i, j, 140 + 60 * i + 20 * j);
+}
+
+int main( int argc, char ** argv )
+{
+    srand(11);
+
+    //
+    // Synthetic range rules and spacing tables.
+    //
+    dbDatabase * db = dbDatabase::create();
+    dbTech * tech = dbTech::create(db);
+    std::vector<dbTechLayer *> layers;
+    int i;
+
+    for( i = 0; i < 6; ++i )
+    {
+        char name[16];
+        sprintf(name, "M%d", i + 1);
+        dbTechLayer * layer = dbTechLayer::create(tech, name, dbTechLayerType::ROUTING);
+        layer->setWidth(140 + 10 * i);
+        layer->setSpacing(130 + 10 * i);
+        layers.push_back(layer);
+    }
+
+    // M1: no rules, M2..M4: range rules, M5: table, M6: both.
+    createRangeRules(layers[1], 1);
+    createRangeRules(layers[2], 4);
+    createRangeRules(layers[3], 12);
+    createSpacingTable(layers[4]);
+    createRangeRules(layers[5], 5);
+    createSpacingTable(layers[5]);
+
+    for( i = 0; i < 6; ++i )
+        check("synthetic layer matches the rule walk", compareLayer(layers[i], 7000, 37) == 0);
+
+    // Edits drop the cache, the next lookup sees them.
+    dbSet<dbTechLayerSpacingRule> rules;
+    layers[3]->getV54SpacingRules(rules);
+    dbTechLayerSpacingRule * first = *rules.begin();
+    first->setRange(0, 6000);
+    first->setSpacing(50);
+    check("edited layer matches the rule walk", compareLayer(layers[3], 7000, 37) == 0);
+    check("edited spacing is used", layers[3]->getSpacing(3000) == 50);
+
+    // New influence, min-cut and min-enclosure rules drop the cache too.
+    for( i = 0; i < 3; ++i )
+    {
+        dbTechV55InfluenceEntry::create(layers[5])->setV55InfluenceEntry(400 + i, 200, 150);
+        check("new influence rule is listed", compareRuleLists(layers[5]) == 0);
+        dbTechMinCutRule::create(layers[5])->setMinimumCuts(2 + i, 300, false, false);
+        check("new min-cut rule is listed", compareRuleLists(layers[5]) == 0);
+        dbTechMinEncRule::create(layers[5])->setEnclosure(1000 * (i + 1));
+        check("new min-enclosure rule is listed", compareRuleLists(layers[5]) == 0);
+    }
+
+    std::vector<dbTechMinCutRule *> cut_rules;
+    check("min-cut rules are listed", layers[5]->getMinimumCutRules(cut_rules) && cut_rules.size() == 3);
+    check("layer without rules lists none", ! layers[0]->getMinimumCutRules(cut_rules) && cut_rules.empty());
+
+    //
+    // Concurrent lookups on caches dropped by the edits above.
+    //
+    createRangeRules(layers[2], 3);
+    layers[5]->addV55SpacingTableEntry(0, 0, 90);
+
+    std::vector<int> errors(64, 0);
+    dbParallelFor(errors.size(), 8, [&](int n) {
+        errors[n] = compareLayer(layers[n % layers.size()], 7000, 101);
+    });
+
+    int parallel_errors = 0;
+
+    for( i = 0; i < (int) errors.size(); ++i )
+        parallel_errors += errors[i];
+
+    check("concurrent lookups match the rule walk", parallel_errors == 0);
+    dbDatabase::destroy(db);
+
+    //
+    // Rules read from LEF.
+    //
+    db = dbDatabase::create();
+    lefin reader(db, false);
+    std::string lef = data_file(argc, argv, "Nangate45/NangateOpenCellLibrary.mod.lef");
+    tech = reader.createTech(lef.c_str());
+    check("read lef", tech != NULL);
+
+    if ( tech )
+    {
+        dbSet<dbTechLayer> tech_layers = tech->getLayers();
+        dbSet<dbTechLayer>::iterator itr;
+        int with_rules = 0;
+
+        for( itr = tech_layers.begin(); itr != tech_layers.end(); ++itr )
+        {
+            dbTechLayer * layer = *itr;
+
+            if ( layer->getType() != dbTechLayerType::ROUTING )
+                continue;
+
+            dbSet<dbTechLayerSpacingRule> v54;
+
+            if ( layer->hasV55SpacingRules() || layer->getV54SpacingRules(v54) )
+                ++with_rules;
+
+            check("lef layer matches the rule walk", compareLayer(layer, 20000, 97) == 0);
+        }
+
+        check("lef has spacing rules", with_rules > 0);
+    }
+
+    dbDatabase::destroy(db);
+    return exit_summary();
+}
@@ -0,0 +1,208 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ADS_TEST_HELPERS_H
+#define ADS_TEST_HELPERS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include "db.h"
+#include "dbWireCodec.h"
+
+//
+// Minimal check/summary helpers for the C++ regression tests, mirroring
+// tests/tcl/test_helpers.tcl. A test main() returns exit_summary(), which
+// is the number of failed checks.
+//
+static int failing_checks = 0;
+static int passing_checks = 0;
+
+#define check(description, cond)                                        \
+    do {                                                                \
+        if ( cond )                                                     \
+            ++passing_checks;                                           \
+        else                                                            \
+        {                                                               \
+            ++failing_checks;                                           \
+            fprintf(stderr, "ERROR: %s: %s (%s:%d)\n", description,    \
+                    #cond, __FILE__, __LINE__);                         \
+        }                                                               \
+    } while(0)
+
+static inline int exit_summary()
+{
+    int total_checks = passing_checks + failing_checks;
+
+    if ( total_checks > 0 )
+        printf("Summary %d / %d (%d%% pass)\n", passing_checks, total_checks,
+               (int) (100.0 * passing_checks / total_checks + 0.5));
+    else
+        printf("Summary 0 checks run\n");
+
+    return failing_checks;
+}
+
+// Path of a file in tests/data, the data directory is the first argument
+// of every test.
+static inline std::string data_file( int argc, char ** argv, const char * name )
+{
+    std::string dir = argc > 1 ? argv[1] : "data";
+    return dir + "/" + name;
+}
+
+//
+// Block builders shared by the database tests.
+//
+
+// A block of a chain of "insts" placed buffers (master BUF, pins A and Z):
+// instance u<i> at (1000 * i, 0) drives net n<i>, which feeds u<i+1>.
+static inline odb::dbBlock * createBlock( odb::dbDatabase * db, int insts )
+{
+    odb::dbTech::create( db );
+    odb::dbLib * lib = odb::dbLib::create( db, "lib" );
+    odb::dbMaster * buf = odb::dbMaster::create( lib, "BUF" );
+    buf->setWidth( 1000 );
+    buf->setHeight( 2000 );
+    odb::dbMTerm::create( buf, "A", odb::dbIoType::INPUT );
+    odb::dbMTerm::create( buf, "Z", odb::dbIoType::OUTPUT );
+    buf->setFrozen();
+
+    odb::dbChip * chip = odb::dbChip::create( db );
+    odb::dbBlock * block = odb::dbBlock::create( chip, "top" );
+    odb::dbNet * prev = NULL;
+    int i;
+
+    for( i = 0; i < insts; ++i )
+    {
+        char name[16];
+        sprintf( name, "u%d", i );
+        odb::dbInst * inst = odb::dbInst::create( block, buf, name );
+        inst->setOrigin( 1000 * i, 0 );
+        inst->setPlacementStatus( odb::dbPlacementStatus::PLACED );
+
+        if ( prev )
+            odb::dbITerm::connect( inst, prev, buf->findMTerm("A") );
+
+        sprintf( name, "n%d", i );
+        prev = odb::dbNet::create( block, name );
+        odb::dbITerm::connect( inst, prev, buf->findMTerm("Z") );
+    }
+
+    return block;
+}
+
+// Route a net with an L of two segments of "length" on layer, from (x, y).
+static inline void routeNet( odb::dbNet * net, odb::dbTechLayer * layer, int x, int y, int length )
+{
+    odb::dbWire * wire = odb::dbWire::create( net );
+    odb::dbWireEncoder encoder;
+    encoder.begin( wire );
+    encoder.newPath( layer, odb::dbWireType::ROUTED );
+    encoder.addPoint( x, y );
+    encoder.addPoint( x + length, y );
+    encoder.addPoint( x + length, y + length );
+    encoder.end();
+}
+
+// Route a net with a random wire of 1 to max_paths paths on the first three
+// routing layers of tech, with branches and tech vias (when the tech has some).
+static inline void routeNet( odb::dbNet * net, odb::dbTech * tech, bool global, int max_paths )
+{
+    odb::dbWire * wire = odb::dbWire::create( net, global );
+    odb::dbWireEncoder encoder;
+    encoder.begin( wire );
+
+    int level = 1 + rand() % 3;
+    int x = rand() % 100000;
+    int y = rand() % 100000;
+    encoder.newPath( tech->findRoutingLayer( level ), odb::dbWireType::ROUTED );
+    encoder.addPoint( x, y );
+
+    int k;
+    int paths = 1 + rand() % max_paths;
+
+    for( k = 0; k < paths; ++k )
+    {
+        if ( level % 2 )
+            x += 140 * (1 + rand() % 50);
+        else
+            y += 140 * (1 + rand() % 50);
+
+        int j = encoder.addPoint( x, y );
+
+        if ( rand() % 3 == 0 )
+        {
+            // a branch at the junction, the path continues from its end
+            encoder.newPath( j, odb::dbWireType::ROUTED );
+            x += 280;
+            encoder.addPoint( x, y );
+        }
+
+        if ( level < 3 )
+        {
+            odb::dbSet<odb::dbTechVia> vias = tech->getVias();
+            odb::dbSet<odb::dbTechVia>::iterator vitr;
+
+            for( vitr = vias.begin(); vitr != vias.end(); ++vitr )
+                if ( vitr->getBottomLayer() == tech->findRoutingLayer( level ) )
+                    break;
+
+            if ( vitr != vias.end() )
+            {
+                encoder.addTechVia( *vitr );
+                ++level;
+            }
+        }
+    }
+
+    encoder.end();
+}
+
+// True if both wires are NULL, or have the same opcodes and data.
+static inline bool sameWire( odb::dbWire * w1, odb::dbWire * w2 )
+{
+    if ( (w1 == NULL) || (w2 == NULL) )
+        return w1 == w2;
+
+    if ( w1->length() != w2->length() )
+        return false;
+
+    uint i;
+
+    for( i = 0; i < w1->length(); ++i )
+        if ( (w1->getOpcode(i) != w2->getOpcode(i)) || (w1->getData(i) != w2->getData(i)) )
+            return false;
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,256 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Nefelus Inc
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// A spilled wire (dbBlock::spillWire, used by defin::convertToDb) streams
+// the encoding it has when the database is written: the spilled one, or
+// the one it was given after the spill by the encoder, dbWire::copy,
+// dbWire::append or dbWire::destroy. The database written with spilled
+// wires is byte for byte the database written without spilling.
+//
+#include "db.h"
+#include "dbBlock.h"
+#include "dbWire.h"
+#include "dbWireSpill.h"
+#include "dbWireCodec.h"
+#include "defin.h"
+#include "lefin.h"
+#include "test_helpers.h"
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+using namespace odb;
+
+static dbDatabase * readDesign( int argc, char ** argv )
+{
+    dbDatabase * db = dbDatabase::create();
+    lefin lef_reader(db, false);
+    std::string lef = data_file(argc, argv, "Nangate45/NangateOpenCellLibrary.mod.lef");
+    dbLib * lib = lef_reader.createTechAndLib("lib", lef.c_str());
+
+    if ( lib == NULL )
+        return NULL;
+
+    std::vector<dbLib *> libs;
+    libs.push_back(lib);
+    defin def_reader(db);
+    std::string def = data_file(argc, argv, "routed.def");
+
+    if ( def_reader.createChip(libs, def.c_str()) == NULL )
+        return NULL;
+
+    return db;
+}
+
+// What defin::convertToDb does for each routed net.
+static void spill( dbBlock * block_, dbWire * wire )
+{
+    _dbBlock * block = (_dbBlock *) block_;
+
+    if ( block->_wire_spill == NULL )
+        block->_wire_spill = new dbWireSpill( block->getDatabase() );
+
+    block->_wire_spill->spill( (_dbWire *) wire );
+}
+
+static std::vector<char> writeDb( dbDatabase * db, const char * file )
+{
+    FILE * fp = fopen(file, "w");
+    db->write(fp);
+    fclose(fp);
+
+    std::vector<char> bytes;
+    fp = fopen(file, "r");
+    int c;
+
+    while( (c = fgetc(fp)) != EOF )
+        bytes.push_back((char) c);
+
+    fclose(fp);
+    remove(file);
+    return bytes;
+}
+
+//
+// Edit the routing of the block; the wires are spilled first if "spilled"
+// is set, the edits are the same either way.
+//
+static void editWires( dbBlock * block, bool spilled )
+{
+    dbNet * in1 = block->findNet("in1");
+    dbNet * in2 = block->findNet("in2");
+    dbNet * n1 = block->findNet("n1");
+    dbNet * n2 = block->findNet("n2");
+    dbNet * n3 = block->findNet("n3");
+    dbNet * out = block->findNet("out");
+
+    if ( spilled )
+    {
+        spill(block, in1->getWire());
+        spill(block, in2->getWire());
+        spill(block, n1->getWire());
+        spill(block, n2->getWire());
+        spill(block, n3->getWire());
+        spill(block, out->getWire());
+    }
+
+    dbTechLayer * metal2 = block->getDataBase()->getTech()->findLayer("metal2");
+
+    // A new encoding of a spilled wire.
+    dbWireEncoder encoder;
+    encoder.begin(in1->getWire());
+    encoder.newPath(metal2, dbWireType::ROUTED);
+    encoder.addPoint(4200, 0);
+    encoder.addPoint(4200, 3000);
+    encoder.end();
+
+    // A spilled wire appended to, with the encoder and with dbWire::append.
+    encoder.append(n1->getWire());
+    encoder.newPath(metal2, dbWireType::ROUTED);
+    encoder.addPoint(9000, 6400);
+    encoder.addPoint(9000, 9000);
+    encoder.end();
+
+    // n2 copied over n3, both spilled.
+    dbWire::copy(n3->getWire(), n2->getWire());
+
+    // in2 (spilled) appended to a new wire and destroyed.
+    dbNet * extra = dbNet::create(block, "extra");
+    dbWire * wire = dbWire::create(extra);
+    wire->append(in2->getWire());
+    dbWire::destroy(in2->getWire());
+
+    // A spilled wire destroyed and the wire id reused.
+    dbWire::destroy(out->getWire());
+    wire = dbWire::create(out);
+    encoder.begin(wire);
+    encoder.newPath(metal2, dbWireType::FIXED);
+    encoder.addPoint(20400, 11800);
+    encoder.addPoint(20400, 20000);
+    encoder.end();
+}
+
+int main( int argc, char ** argv )
+{
+    dbDatabase * ref_db = readDesign(argc, argv);
+    dbDatabase * db = readDesign(argc, argv);
+    check("read routed def", (ref_db != NULL) && (db != NULL));
+
+    if ( (ref_db == NULL) || (db == NULL) )
+        return exit_summary();
+
+    dbBlock * ref_block = ref_db->getChip()->getBlock();
+    dbBlock * block = db->getChip()->getBlock();
+    check("the two reads are the same", writeDb(ref_db, "wire_spill_test_ref.db") == writeDb(db, "wire_spill_test.db"));
+
+    // Spilled wires are streamed as the in-memory wires.
+    spill(block, block->findNet("n1")->getWire());
+    spill(block, block->findNet("n2")->getWire());
+    check("spilled wires are empty", block->findNet("n1")->getWire()->length() == 0);
+    check("spilled wires are written", writeDb(ref_db, "wire_spill_test_ref.db") == writeDb(db, "wire_spill_test.db"));
+
+    // Edits of spilled wires are written, not the spilled encoding.
+    editWires(ref_block, false);
+    editWires(block, true);
+    check("edited in1", block->findNet("in1")->getWire()->length() == ref_block->findNet("in1")->getWire()->length());
+    check("appended n1", block->findNet("n1")->getWire()->length() == ref_block->findNet("n1")->getWire()->length());
+    check("copied n3", block->findNet("n3")->getWire()->length() == ref_block->findNet("n2")->getWire()->length());
+    check("appended extra", block->findNet("extra")->getWire()->length() > 0);
+    check("edited wires are written", writeDb(ref_db, "wire_spill_test_ref.db") == writeDb(db, "wire_spill_test.db"));
+
+    // The written database reads back with the edited wires.
+    FILE * fp = fopen("wire_spill_test.db", "w");
+    db->write(fp);
+    fclose(fp);
+    dbDatabase * rdb = dbDatabase::create();
+    fp = fopen("wire_spill_test.db", "r");
+    rdb->read(fp);
+    fclose(fp);
+    remove("wire_spill_test.db");
+
+    dbBlock * rblock = rdb->getChip()->getBlock();
+    dbSet<dbNet> nets = ref_block->getNets();
+    dbSet<dbNet>::iterator itr;
+    bool same = true;
+
+    for( itr = nets.begin(); itr != nets.end(); ++itr )
+    {
+        dbWire * w1 = itr->getWire();
+        dbWire * w2 = rblock->findNet(itr->getConstName())->getWire();
+
+        if ( (w1 == NULL) || (w2 == NULL) )
+        {
+            same = same && (w1 == w2);
+            continue;
+        }
+
+        same = same && (w1->length() == w2->length());
+
+        uint i;
+
+        for( i = 0; same && (i < w1->length()); ++i )
+            same = (w1->getOpcode(i) == w2->getOpcode(i)) && (w1->getData(i) == w2->getData(i));
+    }
+
+    check("read back wires", same);
+
+    // defin::convertToDb spills every routed net, the database it writes
+    // is the one of a full read.
+    dbDatabase * cdb = dbDatabase::create();
+    lefin lef_reader(cdb, false);
+    std::string lef = data_file(argc, argv, "Nangate45/NangateOpenCellLibrary.mod.lef");
+    std::vector<dbLib *> libs;
+    libs.push_back(lef_reader.createTechAndLib("lib", lef.c_str()));
+    defin def_reader(cdb);
+    std::string def = data_file(argc, argv, "routed.def");
+    check("convert routed def", def_reader.convertToDb(libs, def.c_str(), "wire_spill_test_convert.db"));
+    check("converted chip is released", cdb->getChip() == NULL);
+
+    dbDatabase * full_db = readDesign(argc, argv);
+    std::vector<char> full = writeDb(full_db, "wire_spill_test_ref.db");
+    std::vector<char> converted;
+    fp = fopen("wire_spill_test_convert.db", "r");
+
+    if ( fp )
+    {
+        int c;
+
+        while( (c = fgetc(fp)) != EOF )
+            converted.push_back((char) c);
+
+        fclose(fp);
+        remove("wire_spill_test_convert.db");
+    }
+
+    check("converted database is the full read", converted == full);
+    return exit_summary();
+}
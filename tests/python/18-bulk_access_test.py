@@ -0,0 +1,58 @@
+import opendbpy as odb
+import os
+import array
+
+current_dir = os.path.dirname(os.path.realpath(__file__))
+tests_dir = os.path.abspath(os.path.join(current_dir, os.pardir))
+opendb_dir = os.path.abspath(os.path.join(tests_dir, os.pardir))
+data_dir = os.path.join(tests_dir, "data")
+
+db = odb.dbDatabase.create()
+chip = odb.odb_read_design(db, [os.path.join(data_dir, "Nangate45/NangateOpenCellLibrary.mod.lef")], [os.path.join(data_dir, "gcd/floorplan.def")])
+block = chip.getBlock()
+orients = ["R0", "R90", "R180", "R270", "MY", "MYR90", "MX", "MXR90"]
+
+## Instance placement
+cnt, ids, xs, ys, ors, masters = odb.dbBulkAccess.getInstPlacement(block)
+insts = block.getInsts()
+assert cnt == len(insts), "Number of instances mismatch"
+assert len(ids) == cnt and len(xs) == cnt and len(ys) == cnt, "Array length mismatch"
+assert ids.format == "I" and xs.format == "i", "Array format mismatch"
+for i, inst in enumerate(insts):
+    assert ids[i] == inst.getId(), "Instance id mismatch"
+    assert [xs[i], ys[i]] == inst.getLocation(), "Instance location mismatch"
+    assert orients[ors[i]] == inst.getOrient(), "Instance orientation mismatch"
+    assert masters[i] == inst.getMaster().getId(), "Instance master mismatch"
+
+## Move every instance by a fixed offset
+new_x = array.array("i", [x + 380 for x in xs])
+new_y = array.array("i", [y + 2800 for y in ys])
+assert odb.dbBulkAccess.setInstPlacement(block, ids, new_x, new_y, array.array("i")), "setInstPlacement failed"
+for i, inst in enumerate(block.getInsts()):
+    assert inst.getLocation() == [new_x[i], new_y[i]], "Moved location mismatch"
+    assert orients[ors[i]] == inst.getOrient(), "Orientation changed"
+
+## Mismatched arrays are rejected without changes
+assert not odb.dbBulkAccess.setInstPlacement(block, ids, xs, array.array("i"), array.array("i")), "Size mismatch accepted"
+assert block.getInsts()[0].getLocation() == [new_x[0], new_y[0]], "Rejected update applied"
+
+## Net connectivity
+cnt, net_ids, begin, iterm_ids, iterm_insts = odb.dbBulkAccess.getNetITerms(block)
+nets = block.getNets()
+assert cnt == len(nets), "Number of nets mismatch"
+assert len(begin) == cnt + 1, "Net offsets length mismatch"
+for n, net in enumerate(nets):
+    assert net_ids[n] == net.getId(), "Net id mismatch"
+    iterms = net.getITerms()
+    assert begin[n + 1] - begin[n] == len(iterms), "Net iterm count mismatch"
+    for k, iterm in enumerate(iterms):
+        assert iterm_ids[begin[n] + k] == iterm.getId(), "ITerm id mismatch"
+        assert iterm_insts[begin[n] + k] == iterm.getInst().getId(), "ITerm instance mismatch"
+
+## The floorplan has no wires and no parasitics
+cnt, seg_nets, seg_levels, x1, y1, x2, y2 = odb.dbBulkAccess.getWireSegments(block)
+assert cnt == 0 and len(seg_nets) == 0 and x1.format == "i", "Unexpected wire segments"
+cnt, rseg_ids, rseg_nets, sources, targets, res, cap = odb.dbBulkAccess.getRSegs(block, 0)
+assert cnt == 0 and len(rseg_ids) == 0 and res.format == "d", "Unexpected rsegs"
+cnt, node_ids, node_nets, node_cap = odb.dbBulkAccess.getCapNodes(block, 0)
+assert cnt == 0 and len(node_ids) == 0 and node_cap.format == "d", "Unexpected cap-nodes"
@@ -0,0 +1,36 @@
+import opendbpy as odb
+import os
+
+current_dir = os.path.dirname(os.path.realpath(__file__))
+tests_dir = os.path.abspath(os.path.join(current_dir, os.pardir))
+opendb_dir = os.path.abspath(os.path.join(tests_dir, os.pardir))
+data_dir = os.path.join(tests_dir, "data")
+
+db = odb.dbDatabase.create()
+chip = odb.odb_read_design(db, [os.path.join(data_dir, "Nangate45/NangateOpenCellLibrary.mod.lef")], [os.path.join(data_dir, "gcd/floorplan.def")])
+block = chip.getBlock()
+
+## The lazy iterators visit the same objects, in the same order, as the lists
+assert [i.getName() for i in block.iterInsts()] == [i.getName() for i in block.getInsts()], "Instance iteration mismatch"
+assert [n.getName() for n in block.iterNets()] == [n.getName() for n in block.getNets()], "Net iteration mismatch"
+
+## Objects keep their own type
+net = next(block.iterNets())
+assert isinstance(net, odb.dbNet), "Iterated object type mismatch"
+assert len(list(net.iterITerms())) == len(net.getITerms()), "Net iterm iteration mismatch"
+
+## Early exit
+clk = next((n for n in block.iterNets() if n.getName() == "clk"), None)
+assert clk is not None and clk.getName() == "clk", "Early exit lookup failed"
+
+## A cursor is exhausted once
+rows = block.iterRows()
+assert len(list(rows)) == len(block.getRows()), "Row iteration mismatch"
+assert len(list(rows)) == 0, "Exhausted cursor restarted"
+
+## Grid coordinates, ascending without duplicates
+grid = block.getTrackGrids()[0]
+xs = list(grid.iterGridX())
+assert len(xs) == grid.getGridCountX() and xs == sorted(set(xs)), "Track grid X iteration mismatch"
+ys = list(grid.iterGridY())
+assert len(ys) == grid.getGridCountY() and ys[0] == grid.getGridCoordY(0), "Track grid Y iteration mismatch"
@@ -0,0 +1,77 @@
+import opendbpy as odb
+import os
+
+current_dir = os.path.dirname(os.path.realpath(__file__))
+tests_dir = os.path.abspath(os.path.join(current_dir, os.pardir))
+opendb_dir = os.path.abspath(os.path.join(tests_dir, os.pardir))
+data_dir = os.path.join(tests_dir, "data")
+
+db = odb.dbDatabase.create()
+lef_parser = odb.lefin(db, True)
+lib = lef_parser.createTechAndLib("Nangate45", os.path.join(data_dir, "Nangate45/NangateOpenCellLibrary.mod.lef"))
+def_parser = odb.defin(db)
+def_parser.skipWires()
+def_parser.skipSpecialWires()
+chip = def_parser.createChip([lib], os.path.join(data_dir, "gcd/gcd_pdn.def"))
+assert chip != None, "Read DEF Failed"
+block = chip.getBlock()
+
+## The routing is skipped, everything around it is read
+assert len(block.getNets()) == 2, "Number of nets mismatch"
+assert len(block.getVias()) == 6, "Number of vias mismatch"
+assert len(block.getRows()) == 112, "Number of rows mismatch"
+
+vdd = block.findNet("VDD")
+vss = block.findNet("VSS")
+assert vdd.isSpecial() == 1, "Net is special mismatch"
+assert len(vdd.getSWires()) == 0, "Skipped special wires were read"
+assert len(vss.getSWires()) == 0, "Skipped special wires were read"
+
+## Net options after the skipped routing are still parsed
+assert vdd.getSigType() == "POWER", "VDD sig type mismatch"
+assert vss.getSigType() == "GROUND", "VSS sig type mismatch"
+
+## Routed regular nets: skipping the wires keeps the connectivity of a full read
+def read_routed(skip, def_file="routed.def"):
+    db = odb.dbDatabase.create()
+    lef_parser = odb.lefin(db, True)
+    lib = lef_parser.createTechAndLib("Nangate45", os.path.join(data_dir, "Nangate45/NangateOpenCellLibrary.mod.lef"))
+    def_parser = odb.defin(db)
+    if skip:
+        def_parser.skipWires()
+        def_parser.skipSpecialWires()
+    chip = def_parser.createChip([lib], os.path.join(data_dir, def_file))
+    assert chip != None, "Read DEF Failed"
+    return chip.getBlock()
+
+def connections(net):
+    conns = [iterm.getInst().getConstName() + "/" + iterm.getMTerm().getConstName() for iterm in net.getITerms()]
+    conns += ["PIN " + bterm.getConstName() for bterm in net.getBTerms()]
+    return sorted(conns)
+
+full = read_routed(False)
+skipped = read_routed(True)
+assert len(full.getNets()) == len(skipped.getNets()), "Number of nets mismatch"
+assert full.findNet("n1").getWire() != None, "Routed net has no wire"
+
+for net in full.getNets():
+    other = skipped.findNet(net.getConstName())
+    assert other != None, "Net missing"
+    assert connections(net) == connections(other), "Net connections mismatch"
+    assert net.getSigType() == other.getSigType(), "Net sig type mismatch"
+    assert net.getWeight() == other.getWeight(), "Net weight mismatch"
+    assert other.getWire() == None, "Skipped wire was read"
+
+## NAMESCASESENSITIVE OFF: lower-case "+ shape"/"+ style" inside a skipped
+## special wire and lower-case net options after it, names are upper-cased
+upper = read_routed(True, "routed_nocase.def")
+assert len(upper.getNets()) == len(skipped.getNets()), "Number of nets mismatch"
+
+for net in skipped.getNets():
+    other = upper.findNet(net.getConstName().upper())
+    assert other != None, "Net missing"
+    assert sorted([c.upper() for c in connections(net)]) == connections(other), "Net connections mismatch"
+    assert net.getSigType() == other.getSigType(), "Net sig type mismatch"
+    assert net.getWeight() == other.getWeight(), "Net weight mismatch"
+    assert other.getWire() == None, "Skipped wire was read"
+    assert len(other.getSWires()) == 0, "Skipped special wires were read"
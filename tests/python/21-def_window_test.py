@@ -0,0 +1,99 @@
+import opendbpy as odb
+import os
+
+current_dir = os.path.dirname(os.path.realpath(__file__))
+tests_dir = os.path.abspath(os.path.join(current_dir, os.pardir))
+opendb_dir = os.path.abspath(os.path.join(tests_dir, os.pardir))
+data_dir = os.path.join(tests_dir, "data")
+lef_file = os.path.join(data_dir, "Nangate45/NangateOpenCellLibrary.mod.lef")
+
+def read_def(def_file):
+    db = odb.dbDatabase.create()
+    lib = odb.lefin(db, True).createTechAndLib("Nangate45", lef_file)
+    chip = odb.defin(db).createChip([lib], def_file)
+    assert chip != None, "Read DEF Failed"
+    return chip.getBlock()
+
+def write_window(block, window, out_file):
+    writer = odb.defout()
+    writer.selectWindow(window)
+    writer.setThreads(2)
+    assert writer.writeBlock(block, out_file), "Write DEF Failed"
+
+## The header count of each section matches the entries of its body
+def section_counts(def_file):
+    counts = {}
+    section = None
+    for line in open(def_file):
+        words = line.split()
+        if len(words) >= 2 and words[0] in ("COMPONENTS", "PINS", "NETS", "SPECIALNETS"):
+            section = words[0]
+            counts[section] = [int(words[1]), 0]
+        elif words and words[0] == "END":
+            section = None
+        elif section and words and words[0] == "-":
+            counts[section][1] += 1
+    for name, (header, body) in counts.items():
+        assert header == body, name + " count does not match the body"
+    return counts
+
+def inst_in_window(inst, window):
+    box = odb.adsRect()
+    inst.getBBox().getBox(box)
+    return window.intersects(box)
+
+## gcd: the upper-right quarter of the die
+block = read_def(os.path.join(data_dir, "gcd/floorplan.def"))
+assert len(block.getInsts()) == 482, "Number of components mismatch"
+assert len(block.getBTerms()) == 54, "Number of pins mismatch"
+assert len(block.getNets()) == 385, "Number of nets mismatch"
+
+die = odb.adsRect()
+block.getDieArea(die)
+window = odb.adsRect(die.xMin() + die.dx() // 2, die.yMin() + die.dy() // 2, die.xMax(), die.yMax())
+
+out_file = os.path.join(opendb_dir, "build", "window_out.def")
+write_window(block, window, out_file)
+counts = section_counts(out_file)
+
+expected = len([inst for inst in block.getInsts() if inst_in_window(inst, window)])
+assert counts["COMPONENTS"][0] == expected, "COMPONENTS count mismatch"
+
+block2 = read_def(out_file)
+die2 = odb.adsRect()
+block2.getDieArea(die2)
+assert die2.xMin() == window.xMin() and die2.yMax() == window.yMax(), "Die area is not the window"
+assert len(block2.getInsts()) == expected, "Number of instances mismatch"
+assert len(block2.getInsts()) < len(block.getInsts()), "Window did not drop instances"
+assert len(block2.getBTerms()) < len(block.getBTerms()), "Window did not drop pins"
+assert len(block2.getNets()) == counts["NETS"][0], "NETS count mismatch"
+
+## A routed design: the wires and special wires are clipped to the window
+block = read_def(os.path.join(data_dir, "routed.def"))
+window = odb.adsRect(0, 0, 10000, 40000)
+write_window(block, window, out_file)
+counts = section_counts(out_file)
+assert counts["COMPONENTS"][0] == 2, "COMPONENTS count mismatch"
+assert counts["NETS"][0] == 4, "NETS count mismatch"
+
+block2 = read_def(out_file)
+assert block2.findNet("n1").getWire() != None, "Clipped wire missing"
+assert block2.findNet("out") == None, "Net outside the window was written"
+
+for net in block2.getNets():
+    wire = net.getWire()
+    if wire != None:
+        decoder = odb.dbWireDecoder()
+        decoder.begin(wire)
+        opcode = decoder.next()
+        while opcode != odb.dbWireDecoder.END_DECODE:
+            if opcode == odb.dbWireDecoder.POINT:
+                x, y = decoder.getPoint()
+                assert window.intersects(odb.adsPoint(x, y)), "Wire outside the window"
+            opcode = decoder.next()
+    for swire in net.getSWires():
+        for sbox in swire.getWires():
+            box = odb.adsRect()
+            sbox.getBox(box)
+            center = odb.adsPoint((box.xMin() + box.xMax()) // 2, (box.yMin() + box.yMax()) // 2)
+            assert window.intersects(center), "Special wire outside the window"
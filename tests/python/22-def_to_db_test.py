@@ -0,0 +1,53 @@
+import opendbpy as odb
+import os
+
+current_dir = os.path.dirname(os.path.realpath(__file__))
+tests_dir = os.path.abspath(os.path.join(current_dir, os.pardir))
+opendb_dir = os.path.abspath(os.path.join(tests_dir, os.pardir))
+data_dir = os.path.join(tests_dir, "data")
+lef_file = os.path.join(data_dir, "gscl45nm.lef")
+
+db = odb.dbDatabase.create()
+chip = odb.odb_read_design(db, [lef_file], [os.path.join(data_dir, "design.def")])
+assert chip != None, "Read DEF Failed"
+tech = db.getTech()
+block = chip.getBlock()
+
+## Route a few nets
+via = tech.getVias()[0]
+layer = via.getBottomLayer()
+for i in range(10):
+    net = odb.dbNet_create(block, "w%d" % i)
+    wire = odb.dbWire_create(net)
+    encoder = odb.dbWireEncoder()
+    encoder.begin(wire)
+    encoder.newPath(layer, "ROUTED")
+    encoder.addPoint(2000, 2000 + 400 * i)
+    encoder.addPoint(10000 + 1000 * i, 2000 + 400 * i)
+    encoder.addTechVia(via)
+    encoder.end()
+
+def_file = os.path.join(opendb_dir, "build", "def_to_db.def")
+db_file = os.path.join(opendb_dir, "build", "def_to_db.db")
+assert odb.odb_write_def(block, def_file) == 1, "Write DEF Failed"
+
+## Convert with the routing spilled to disk
+db2 = odb.dbDatabase.create()
+libs = odb.odb_read_lef(db2, [lef_file])
+assert odb.defin(db2).convertToDb(libs, def_file, db_file), "DEF to DB conversion failed"
+assert db2.getChip() == None, "Chip was not released after the conversion"
+
+## The database file holds the whole block
+db3 = odb.odb_import_db(None, db_file)
+assert db3 != None, "Read DB Failed"
+block3 = db3.getChip().getBlock()
+assert len(block3.getNets()) == len(block.getNets()), "Number of nets mismatch"
+assert len(block3.getInsts()) == len(block.getInsts()), "Number of instances mismatch"
+
+for i in range(10):
+    name = "w%d" % i
+    wire = block.findNet(name).getWire()
+    wire3 = block3.findNet(name).getWire()
+    assert wire3 != None, "Missing wire"
+    assert wire3.length() == wire.length(), "Wire length mismatch"
+    assert wire3.count() == wire.count(), "Wire segment count mismatch"
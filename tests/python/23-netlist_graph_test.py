@@ -0,0 +1,60 @@
+import opendbpy as odb
+import os
+
+current_dir = os.path.dirname(os.path.realpath(__file__))
+tests_dir = os.path.abspath(os.path.join(current_dir, os.pardir))
+opendb_dir = os.path.abspath(os.path.join(tests_dir, os.pardir))
+data_dir = os.path.join(tests_dir, "data")
+
+db = odb.dbDatabase.create()
+chip = odb.odb_read_design(db, [os.path.join(data_dir, "Nangate45/NangateOpenCellLibrary.mod.lef")], [os.path.join(data_dir, "gcd/floorplan.def")])
+block = chip.getBlock()
+
+graph = odb.dbNetlistGraph()
+graph.build(block)
+assert not graph.isStale(), "New graph is stale"
+
+## The CSR arrays are typed memoryviews
+net_ids = graph.getNetIds()
+begin = graph.getNetPinBegin()
+pin_insts = graph.getPinInsts()
+pin_ids = graph.getPinIds()
+inst_ids = graph.getInstIds()
+assert net_ids.format == "I" and begin.format == "i", "Array format mismatch"
+assert len(begin) == graph.getNumNets() + 1, "Net offsets length mismatch"
+assert len(pin_insts) == graph.getNumPins(), "Pin array length mismatch"
+
+## Net pins match the iterms and bterms of the nets
+for n in range(graph.getNumNets()):
+    net = odb.dbNet.getNet(block, net_ids[n])
+    iterms = [iterm.getId() for iterm in net.getITerms()]
+    bterms = [bterm.getId() for bterm in net.getBTerms()]
+    pins = range(begin[n], begin[n + 1])
+    assert sorted(pin_ids[p] for p in pins if pin_insts[p] >= 0) == sorted(iterms), "Net iterms mismatch"
+    assert sorted(pin_ids[p] for p in pins if pin_insts[p] < 0) == sorted(bterms), "Net bterms mismatch"
+    for p in pins:
+        if pin_insts[p] >= 0:
+            iterm = odb.dbITerm.getITerm(block, pin_ids[p])
+            assert inst_ids[pin_insts[p]] == iterm.getInst().getId(), "Pin instance mismatch"
+
+## The views are read-only, and the graph is not rebuilt under them
+assert net_ids.readonly, "Array view is writable"
+try:
+    graph.build(block)
+    assert False, "Graph rebuilt while viewed"
+except BufferError:
+    pass
+for view in (net_ids, begin, pin_insts, pin_ids, inst_ids):
+    view.release()
+
+## Re-creating a block terminal on another net makes the graph stale
+bterm = block.getBTerms()[0]
+name = bterm.getName()
+net = bterm.getNet()
+other = [n for n in block.getNets() if n.getId() != net.getId() and n.getSigType() == "SIGNAL"][0]
+odb.dbBTerm.destroy(bterm)
+assert graph.isStale(), "BTerm destroy did not make the graph stale"
+graph.build(block)
+odb.dbBTerm.create(other, name)
+assert graph.isStale(), "BTerm create did not make the graph stale"
+graph.clear()
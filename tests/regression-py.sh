@@ -95,3 +95,33 @@ echo "[17] Database read/write test"
 python3 $BASE_DIR/python/17-db_read-write_test.py
 echo "SUCCESS!"
 echo ""
+
+echo "[18] Bulk access test"
+python3 $BASE_DIR/python/18-bulk_access_test.py
+echo "SUCCESS!"
+echo ""
+
+echo "[19] Lazy iterators test"
+python3 $BASE_DIR/python/19-lazy_iterators_test.py
+echo "SUCCESS!"
+echo ""
+
+echo "[20] DEF skip wires test"
+python3 $BASE_DIR/python/20-def_skip_wires_test.py
+echo "SUCCESS!"
+echo ""
+
+echo "[21] DEF window test"
+python3 $BASE_DIR/python/21-def_window_test.py
+echo "SUCCESS!"
+echo ""
+
+echo "[22] DEF to DB test"
+python3 $BASE_DIR/python/22-def_to_db_test.py
+echo "SUCCESS!"
+echo ""
+
+echo "[23] Netlist graph test"
+python3 $BASE_DIR/python/23-netlist_graph_test.py
+echo "SUCCESS!"
+echo ""
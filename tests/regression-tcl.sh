@@ -97,4 +97,19 @@ echo ""
 echo "[18] Check routing tracks test"
 $APP $BASE_DIR/tcl/18-check_routing_tracks.tcl
 echo "SUCCESS!"
-echo ""
\ No newline at end of file
+echo ""
+
+echo "[19] ECO savepoint test"
+$APP $BASE_DIR/tcl/19-eco_savepoint_test.tcl
+echo "SUCCESS!"
+echo ""
+
+echo "[20] Lazy iterators test"
+$APP $BASE_DIR/tcl/20-lazy_iterators_test.tcl
+echo "SUCCESS!"
+echo ""
+
+echo "[21] Netlist graph test"
+$APP $BASE_DIR/tcl/21-netlist_graph_test.tcl
+echo "SUCCESS!"
+echo ""
@@ -0,0 +1,30 @@
+source [file join [file dirname [info script]] "test_helpers.tcl"]
+set current_dir [file dirname [file normalize [info script]]]
+set tests_dir [find_parent_dir $current_dir]
+set data_dir [file join $tests_dir "data"]
+
+set db [dbDatabase_create]
+set chip [odb_read_design $db $data_dir/Nangate45/NangateOpenCellLibrary.mod.lef $data_dir/gcd/floorplan.def]
+set block [$chip getBlock]
+set inst [lindex [$block getInsts] 0]
+set orig [$inst getOrigin]
+
+dbDatabase_beginEco $block
+dbDatabase_setSavepoint $block "outer"
+$inst setOrigin 1000 2000
+dbDatabase_setSavepoint $block "inner"
+$inst setOrigin 3000 4000
+set net [dbNet_create $block "sp_net"]
+
+check "rollback inner" {dbDatabase_rollbackToSavepoint $block "inner"} 1
+check "origin after inner rollback" {$inst getOrigin} "1000 2000"
+check "net removed" {$block findNet "sp_net"} "NULL"
+
+check "rollback outer" {dbDatabase_rollbackToSavepoint $block "outer"} 1
+check "origin after outer rollback" {$inst getOrigin} $orig
+check "inner discarded" {dbDatabase_rollbackToSavepoint $block "inner"} 0
+check "release outer" {dbDatabase_releaseSavepoint $block "outer"} 1
+check "eco empty" {dbDatabase_ecoEmpty $block} 1
+dbDatabase_endEco $block
+
+exit_summary
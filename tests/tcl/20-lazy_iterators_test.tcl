@@ -0,0 +1,60 @@
+source [file join [file dirname [info script]] "test_helpers.tcl"]
+set current_dir [file dirname [file normalize [info script]]]
+set tests_dir [find_parent_dir $current_dir]
+set data_dir [file join $tests_dir "data"]
+
+set db [dbDatabase_create]
+set chip [odb_read_design $db $data_dir/Nangate45/NangateOpenCellLibrary.mod.lef $data_dir/gcd/floorplan.def]
+set block [$chip getBlock]
+
+set names {}
+$block foreachInsts inst {
+    lappend names [$inst getName]
+}
+check "lazy instances" {set names} [lmap inst [$block getInsts] {$inst getName}]
+
+set count 0
+$block foreachNets net {
+    if {[$net getName] == "clk"} {
+        break
+    }
+    incr count
+}
+check "break in lazy loop" {expr $count < [llength [$block getNets]]} 1
+
+set inst [lindex [$block getInsts] 0]
+set connected 0
+foreach iterm [$inst getITerms] {
+    if {[$iterm getNet] != "NULL"} {
+        incr connected
+    }
+}
+set count 0
+$inst foreachITerms iterm {
+    if {[$iterm getNet] == "NULL"} {
+        continue
+    }
+    incr count
+}
+check "continue in lazy loop" {set count} $connected
+
+check "error in lazy loop" {catch {$block foreachRows row {error "stop"}}} 1
+
+set grid [lindex [$block getTrackGrids] 0]
+set xs {}
+$grid foreachGridX x {
+    lappend xs $x
+}
+check "lazy grid count" {llength $xs} [$grid getGridCountX]
+check "lazy grid order" {lsort -integer -unique $xs} $xs
+
+set count 0
+$grid foreachGridY y {
+    incr count
+    if {$count == 3} {
+        break
+    }
+}
+check "break in lazy grid loop" {set count} [expr min(3, [$grid getGridCountY])]
+
+exit_summary
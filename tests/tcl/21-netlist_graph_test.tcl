@@ -0,0 +1,42 @@
+source [file join [file dirname [info script]] "test_helpers.tcl"]
+set current_dir [file dirname [file normalize [info script]]]
+set tests_dir [find_parent_dir $current_dir]
+set data_dir [file join $tests_dir "data"]
+
+set db [dbDatabase_create]
+set chip [odb_read_design $db $data_dir/Nangate45/NangateOpenCellLibrary.mod.lef $data_dir/gcd/floorplan.def]
+set block [$chip getBlock]
+
+set graph [dbNetlistGraph]
+$graph build $block
+check "new graph not stale" {$graph isStale} 0
+
+# The CSR arrays are lists
+set net_ids [$graph getNetIds]
+set begin [$graph getNetPinBegin]
+set pin_insts [$graph getPinInsts]
+set pin_ids [$graph getPinIds]
+check "net offsets length" {llength $begin} [expr [$graph getNumNets] + 1]
+check "pin array length" {llength $pin_insts} [$graph getNumPins]
+
+# The pins of a net are its iterms and bterms
+set n [lsearch -exact $net_ids [[$block findNet "clk"] getId]]
+set iterms {}
+set bterms {}
+for {set p [lindex $begin $n]} {$p < [lindex $begin [expr $n + 1]]} {incr p} {
+    if {[lindex $pin_insts $p] >= 0} {
+        lappend iterms [lindex $pin_ids $p]
+    } else {
+        lappend bterms [lindex $pin_ids $p]
+    }
+}
+set net [$block findNet "clk"]
+check "net iterms" {lsort -integer $iterms} [lsort -integer [lmap iterm [$net getITerms] {$iterm getId}]]
+check "net bterms" {lsort -integer $bterms} [lsort -integer [lmap bterm [$net getBTerms] {$bterm getId}]]
+
+# Destroying a net makes the graph stale
+dbNet_destroy [dbNet_create $block "graph_net"]
+check "net destroy makes the graph stale" {$graph isStale} 1
+$graph clear
+
+exit_summary